@@ -0,0 +1,46 @@
+// Graph planning micro-benchmarks over chain lengths: the compile-time path that
+// plan caches and specialization pay on every miss.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "bench_util.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+
+namespace {
+
+using namespace infer;
+
+// Arg: number of nodes
+void BM_TopologicalSort(benchmark::State& state) {
+    std::unique_ptr<Graph> g = bench::buildReluChain(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(g->topologicalSort());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_TopologicalSort)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+
+void BM_PlanMemory(benchmark::State& state) {
+    std::unique_ptr<Graph> g = bench::buildReluChain(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(g->planMemory());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_PlanMemory)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+
+void BM_Compile(benchmark::State& state) {
+    std::unique_ptr<Graph> g = bench::buildReluChain(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(g->compile());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Compile)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+
+} // namespace
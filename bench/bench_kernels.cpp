@@ -0,0 +1,135 @@
+// Kernel micro-benchmarks: FP32/INT8 GEMM and buffer quantization over size sweeps.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bench_util.h"
+#include "inference_engine/core/dtype.h"
+#include "inference_engine/kernels/linear.h"
+#include "inference_engine/kernels/linear_int8.h"
+
+namespace {
+
+using inference_engine::core::DataType;
+using namespace infer;
+
+// Args: {m, k, n}
+void BM_LinearFp32(benchmark::State& state) {
+    const auto m = static_cast<std::size_t>(state.range(0));
+    const auto k = static_cast<std::size_t>(state.range(1));
+    const auto n = static_cast<std::size_t>(state.range(2));
+    const std::vector<float> x = bench::randomFloats(m * k);
+    const std::vector<float> w = bench::randomFloats(k * n, 0.1f, 7);
+    const std::vector<float> bias = bench::randomFloats(n, 0.01f, 9);
+    std::vector<float> y(m * n);
+
+    LinearArgs args;
+    args.x = x.data();
+    args.ldx = k;
+    args.w = w.data();
+    args.ldw = n;
+    args.bias = bias.data();
+    args.y = y.data();
+    args.ldy = n;
+    args.m = m;
+    args.k = k;
+    args.n = n;
+    args.activation = Activation::ReLU;
+
+    for (auto _ : state) {
+        linear(args);
+        benchmark::DoNotOptimize(y.data());
+        benchmark::ClobberMemory();
+    }
+    const double flops = 2.0 * static_cast<double>(m * k * n);
+    state.counters["FLOP/s"] = benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>((m * k + k * n + m * n) * sizeof(float)));
+}
+BENCHMARK(BM_LinearFp32)
+    ->ArgNames({"m", "k", "n"})
+    ->Args({1, 256, 256})
+    ->Args({1, 1024, 1024})
+    ->Args({16, 128, 256})
+    ->Args({16, 512, 512})
+    ->Args({64, 512, 512})
+    ->Args({128, 1024, 1024});
+
+// Args: {m, k, n}
+void BM_LinearInt8(benchmark::State& state) {
+    const auto m = static_cast<std::size_t>(state.range(0));
+    const auto k = static_cast<std::size_t>(state.range(1));
+    const auto n = static_cast<std::size_t>(state.range(2));
+    std::vector<std::uint8_t> x(m * k);
+    std::vector<std::int8_t> w(k * n);
+    for (std::size_t i = 0; i < x.size(); ++i) x[i] = static_cast<std::uint8_t>((i * 37) % 251);
+    for (std::size_t i = 0; i < w.size(); ++i) w[i] = static_cast<std::int8_t>(static_cast<int>((i * 11) % 255) - 127);
+    const PackedInt8Weights packed = pack_int8_weights(w.data(), k, n);
+    const std::vector<float> scales(n, 1e-4f);
+    std::vector<std::uint8_t> y(m * n);
+
+    LinearInt8Args args;
+    args.x = x.data();
+    args.ldx = k;
+    args.x_dtype = DataType::UINT8;
+    args.x_zero_point = 128;
+    args.w = &packed;
+    args.scales = scales.data();
+    args.y = y.data();
+    args.ldy = n;
+    args.y_dtype = DataType::UINT8;
+    args.y_zero_point = 128;
+    args.m = m;
+    args.n = n;
+
+    for (auto _ : state) {
+        linear_int8(args);
+        benchmark::DoNotOptimize(y.data());
+        benchmark::ClobberMemory();
+    }
+    const double ops = 2.0 * static_cast<double>(m * k * n);
+    state.counters["OP/s"] = benchmark::Counter(ops, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_LinearInt8)
+    ->ArgNames({"m", "k", "n"})
+    ->Args({1, 256, 256})
+    ->Args({1, 1024, 1024})
+    ->Args({16, 512, 512})
+    ->Args({64, 512, 512})
+    ->Args({128, 1024, 1024});
+
+void BM_QuantizeInt8(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<float> in = bench::randomFloats(count);
+    std::vector<std::int8_t> out(count);
+    for (auto _ : state) {
+        inference_engine::core::quantize_buffer_symmetric_int8(in.data(), out.data(), count, 1.0f / 127.0f);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(count * (sizeof(float) + sizeof(std::int8_t))));
+}
+BENCHMARK(BM_QuantizeInt8)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+void BM_DequantizeInt8(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<std::int8_t> in(count);
+    for (std::size_t i = 0; i < count; ++i) in[i] = static_cast<std::int8_t>(static_cast<int>(i % 255) - 127);
+    std::vector<float> out(count);
+    for (auto _ : state) {
+        inference_engine::core::dequantize_buffer_symmetric_int8(in.data(), out.data(), count, 1.0f / 127.0f);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(count * (sizeof(float) + sizeof(std::int8_t))));
+}
+BENCHMARK(BM_DequantizeInt8)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+} // namespace
@@ -0,0 +1,58 @@
+// Entry point of the `bench` target. Accepts every Google Benchmark flag plus:
+//
+//   --pin_cpu=N   pin the process to CPU N before running (Linux only)
+//
+// Machine-readable results: --benchmark_format=json, or --benchmark_out=FILE
+// --benchmark_out_format=json to keep the console table as well.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace {
+
+bool pinToCpu(int cpu) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    // Strip our own flags before Google Benchmark sees (and rejects) them.
+    int kept = 1;
+    for (int i = 1; i < argc; ++i) {
+        constexpr const char* kPin = "--pin_cpu=";
+        if (std::strncmp(argv[i], kPin, std::strlen(kPin)) == 0) {
+            const int cpu = std::atoi(argv[i] + std::strlen(kPin));
+            if (!pinToCpu(cpu)) {
+                std::cerr << "bench: could not pin to CPU " << cpu << "\n";
+                return 1;
+            }
+            benchmark::AddCustomContext("pinned_cpu", std::to_string(cpu));
+            continue;
+        }
+        argv[kept++] = argv[i];
+    }
+    argc = kept;
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,103 @@
+// Allocator micro-benchmarks: one allocate/free cycle of `batch` blocks per iteration.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "inference_engine/memory/allocator.h"
+#include "inference_engine/memory/arena.h"
+#include "inference_engine/memory/pool_allocator.h"
+
+namespace {
+
+using inference_engine::core::ArenaAllocator;
+using inference_engine::core::PoolAllocator;
+using inference_engine::core::SystemAllocator;
+using inference_engine::memory::Arena;
+
+constexpr std::size_t kBlocksPerCycle = 64;
+
+// Arg: block size in bytes
+void BM_SystemAllocator(benchmark::State& state) {
+    const auto size = static_cast<std::int64_t>(state.range(0));
+    SystemAllocator alloc;
+    std::vector<void*> blocks(kBlocksPerCycle);
+    for (auto _ : state) {
+        for (void*& p : blocks) p = alloc.allocate(size);
+        benchmark::DoNotOptimize(blocks.data());
+        for (void* p : blocks) alloc.deallocate(p);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBlocksPerCycle));
+}
+BENCHMARK(BM_SystemAllocator)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+// Tracking enabled, one allocator shared by every benchmark thread.
+void BM_SystemAllocatorTracked(benchmark::State& state) {
+    static SystemAllocator alloc(inference_engine::core::AllocatorConfig{alignof(std::max_align_t), true});
+    std::vector<void*> blocks(kBlocksPerCycle);
+    for (auto _ : state) {
+        for (void*& p : blocks) p = alloc.allocate(256);
+        benchmark::DoNotOptimize(blocks.data());
+        for (void* p : blocks) alloc.deallocate(p);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBlocksPerCycle));
+}
+BENCHMARK(BM_SystemAllocatorTracked)->ThreadRange(1, 32)->UseRealTime();
+
+void BM_PoolAllocator(benchmark::State& state) {
+    const auto size = static_cast<std::int64_t>(state.range(0));
+    static PoolAllocator alloc;
+    std::vector<void*> blocks(kBlocksPerCycle);
+    for (auto _ : state) {
+        for (void*& p : blocks) p = alloc.allocate(size);
+        benchmark::DoNotOptimize(blocks.data());
+        for (void* p : blocks) alloc.deallocate(p);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBlocksPerCycle));
+}
+BENCHMARK(BM_PoolAllocator)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(BM_PoolAllocator)->Arg(4096)->ThreadRange(1, 32)->UseRealTime();
+
+void BM_ArenaAllocator(benchmark::State& state) {
+    const auto size = static_cast<std::int64_t>(state.range(0));
+    ArenaAllocator alloc(static_cast<std::size_t>(size + 64) * kBlocksPerCycle);
+    std::vector<void*> blocks(kBlocksPerCycle);
+    for (auto _ : state) {
+        for (void*& p : blocks) p = alloc.allocate(size);
+        benchmark::DoNotOptimize(blocks.data());
+        alloc.reset();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBlocksPerCycle));
+}
+BENCHMARK(BM_ArenaAllocator)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+void BM_ArenaBump(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    Arena arena((size + 64) * kBlocksPerCycle, 64);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < kBlocksPerCycle; ++i) {
+            benchmark::DoNotOptimize(arena.allocate(size, 64));
+        }
+        arena.reset();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBlocksPerCycle));
+}
+BENCHMARK(BM_ArenaBump)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+// Kernel-style scratch: take blocks inside a ScratchScope of the thread arena.
+void BM_ThreadScratchScope(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    Arena& scratch = inference_engine::memory::thread_scratch_arena();
+    for (auto _ : state) {
+        Arena::ScratchScope scope(scratch);
+        for (std::size_t i = 0; i < kBlocksPerCycle; ++i) {
+            benchmark::DoNotOptimize(scratch.allocate(size, 64));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBlocksPerCycle));
+}
+BENCHMARK(BM_ThreadScratchScope)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+} // namespace
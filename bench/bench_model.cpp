@@ -0,0 +1,90 @@
+// End-to-end model benchmarks: a compiled MLP across batch sizes and thread counts.
+// Each iteration is one ExecutionPlan::run, timed individually so the report carries
+// latency percentiles next to the mean.
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "bench_util.h"
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+namespace {
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+constexpr std::int64_t kInDim = 256;
+constexpr std::int64_t kHidden = 512;
+constexpr std::int64_t kClasses = 64;
+constexpr int kLayers = 3;
+// Untimed runs before measuring: first-touch of the arena, kernel dispatch, caches.
+constexpr int kWarmupRuns = 10;
+
+// Args: {batch, threads}
+void BM_MlpInference(benchmark::State& state) {
+    const std::int64_t batch = state.range(0);
+    const auto threads = static_cast<std::size_t>(state.range(1));
+
+    std::unique_ptr<Graph> g = bench::buildMlp(batch, kInDim, kHidden, kClasses, kLayers);
+    std::unique_ptr<ExecutionPlan> plan = g->compile();
+
+    std::vector<float> buf = bench::randomFloats(static_cast<std::size_t>(batch * kInDim));
+    const std::vector<Tensor> inputs = {Tensor(Shape({batch, kInDim}), DataType::FP32, buf.data(), false)};
+    std::vector<Tensor> outputs;
+
+    // The calling thread takes part in parallelFor, so `threads` counts it.
+    std::unique_ptr<ThreadPool> pool;
+    if (threads > 1) pool = std::make_unique<ThreadPool>(threads - 1);
+    ThreadPool::Scope scope(pool.get());
+
+    for (int i = 0; i < kWarmupRuns; ++i) {
+        plan->run(inputs, outputs);
+    }
+
+    std::vector<double> latencies_us;
+    for (auto _ : state) {
+        const auto t0 = std::chrono::steady_clock::now();
+        plan->run(inputs, outputs);
+        const auto t1 = std::chrono::steady_clock::now();
+        benchmark::DoNotOptimize(outputs[0].data());
+        const double seconds = std::chrono::duration<double>(t1 - t0).count();
+        state.SetIterationTime(seconds);
+        latencies_us.push_back(seconds * 1e6);
+    }
+
+    double total_us = 0.0;
+    for (double us : latencies_us) total_us += us;
+    state.counters["p50_us"] = bench::percentile(latencies_us, 0.50);
+    state.counters["p90_us"] = bench::percentile(latencies_us, 0.90);
+    state.counters["p99_us"] = bench::percentile(latencies_us, 0.99);
+    state.counters["samples/s"] =
+        total_us > 0.0 ? static_cast<double>(batch) * static_cast<double>(latencies_us.size()) / (total_us * 1e-6)
+                       : 0.0;
+    double flops = 0.0;
+    for (const ExecutionPlan::Step& step : plan->steps()) flops += static_cast<double>(step.op->estimateFlops());
+    state.counters["GFLOP/s"] = total_us > 0.0 ? flops * static_cast<double>(latencies_us.size()) / (total_us * 1e3) : 0.0;
+}
+
+void MlpSweep(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"batch", "threads"});
+    for (std::int64_t threads : {1, 2, 4}) {
+        for (std::int64_t batch : {1, 8, 32, 128}) {
+            b->Args({batch, threads});
+        }
+    }
+}
+BENCHMARK(BM_MlpInference)->Apply(MlpSweep)->UseManualTime()->MinWarmUpTime(0.05)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,91 @@
+#include "bench_util.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/softmax.h"
+#include "inference_engine/passes/fusion.h"
+
+namespace infer::bench {
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+
+std::unique_ptr<Graph> buildMlp(std::int64_t batch, std::int64_t in_dim, std::int64_t hidden, std::int64_t classes,
+                                int layers) {
+    auto g = std::make_unique<Graph>();
+    Value* x = g->createValue(Shape({batch, in_dim}), DataType::FP32, "x");
+    g->setInputs({x});
+
+    Value* cur = x;
+    std::int64_t width = in_dim;
+    std::uint32_t seed = 1;
+    for (int l = 0; l < layers; ++l) {
+        const std::string id = std::to_string(l);
+        Value* h = g->createValue(Shape({batch, hidden}), DataType::FP32, "h" + id);
+        Value* a = g->createValue(Shape({batch, hidden}), DataType::FP32, "a" + id);
+        const float range = 1.0f / std::sqrt(static_cast<float>(width));
+        Node* fc = g->addNode(std::make_unique<MatMulBiasOp>(width, hidden,
+                                                             randomFloats(static_cast<std::size_t>(width * hidden),
+                                                                          range, seed++),
+                                                             randomFloats(static_cast<std::size_t>(hidden), 0.01f,
+                                                                          seed++)),
+                              "fc" + id);
+        fc->setInputs({cur});
+        fc->setOutputs({h});
+        Node* relu = g->addNode(std::make_unique<ReluOp>(), "relu" + id);
+        relu->setInputs({h});
+        relu->setOutputs({a});
+        cur = a;
+        width = hidden;
+    }
+
+    Value* logits = g->createValue(Shape({batch, classes}), DataType::FP32, "logits");
+    Value* probs = g->createValue(Shape({batch, classes}), DataType::FP32, "probs");
+    Node* head = g->addNode(std::make_unique<MatMulBiasOp>(width, classes,
+                                                           randomFloats(static_cast<std::size_t>(width * classes),
+                                                                        0.1f, seed++),
+                                                           randomFloats(static_cast<std::size_t>(classes), 0.01f,
+                                                                        seed++)),
+                            "head");
+    head->setInputs({cur});
+    head->setOutputs({logits});
+    Node* softmax = g->addNode(std::make_unique<SoftmaxOp>(), "softmax");
+    softmax->setInputs({logits});
+    softmax->setOutputs({probs});
+    g->setOutputs({probs});
+
+    FusionPass fusion;
+    g->applyPass(fusion);
+    return g;
+}
+
+std::unique_ptr<Graph> buildReluChain(std::size_t length, std::int64_t rows, std::int64_t cols) {
+    auto g = std::make_unique<Graph>();
+    Value* cur = g->createValue(Shape({rows, cols}), DataType::FP32, "x");
+    g->setInputs({cur});
+    for (std::size_t i = 0; i < length; ++i) {
+        Value* next = g->createValue(Shape({rows, cols}), DataType::FP32, "v" + std::to_string(i));
+        Node* relu = g->addNode(std::make_unique<ReluOp>(), "relu" + std::to_string(i));
+        relu->setInputs({cur});
+        relu->setOutputs({next});
+        cur = next;
+    }
+    g->setOutputs({cur});
+    return g;
+}
+
+double percentile(std::vector<double>& samples, double q) {
+    if (samples.empty()) return 0.0;
+    std::sort(samples.begin(), samples.end());
+    const double rank = std::ceil(q * static_cast<double>(samples.size()));
+    const std::size_t index = rank < 1.0 ? 0 : static_cast<std::size_t>(rank) - 1;
+    return samples[std::min(index, samples.size() - 1)];
+}
+
+} // namespace infer::bench
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "inference_engine/graph/graph.h"
+
+namespace infer::bench {
+
+// Deterministic pseudo-random floats in [-range, range].
+inline std::vector<float> randomFloats(std::size_t count, float range = 1.0f, std::uint32_t seed = 42) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-range, range);
+    std::vector<float> out(count);
+    for (float& v : out) v = dist(rng);
+    return out;
+}
+
+// MLP of `layers` MatMulBias(+ReLU) layers of width `hidden` on [batch, in_dim],
+// followed by a softmax. Fused and ready to compile.
+std::unique_ptr<Graph> buildMlp(std::int64_t batch, std::int64_t in_dim, std::int64_t hidden, std::int64_t classes,
+                                int layers);
+
+// Chain of `length` ReLU nodes on [rows, cols]: a graph whose planning cost grows
+// with its node count only.
+std::unique_ptr<Graph> buildReluChain(std::size_t length, std::int64_t rows = 16, std::int64_t cols = 64);
+
+// Nearest-rank percentile (q in [0, 1]) of `samples`; sorts in place.
+double percentile(std::vector<double>& samples, double q);
+
+} // namespace infer::bench
@@ -0,0 +1,471 @@
+// Performance regression tier (`ctest -L perf`). Measures a fixed set of metrics
+// (kernel throughput, allocator cost, graph compile time, end-to-end MLP latency)
+// and compares them with the stored baseline of the host's machine class:
+//
+//   perf_tests [--suite=NAME]... [--baselines=DIR] [--machine_class=NAME] [--record] [--list]
+//
+// Baselines live in DIR/<machine class>.txt, one "metric value tolerance" line per
+// metric; the tolerance is the relative regression allowed before the metric
+// fails. The machine class is "<arch>-<isa>-<cpu model>" (max_isa(), so the
+// INFER_ENGINE_MAX_ISA cap applies; the CPU model separates parts of one ISA that
+// differ by 2x), or IE_PERF_MACHINE_CLASS when set. Baselines are committed, one per
+// class; noise between boxes of a class is absorbed by the tolerances. --record
+// measures and writes the selected suites into that file, keeping the other entries
+// and any hand-tuned tolerance.
+//
+// Every metric is the best of several timed runs, which filters out interference
+// from other processes; run on an otherwise idle machine before recording.
+//
+// Exit status: 0 when no metric regressed, 1 when one did, 77 (skipped under ctest)
+// when there is no baseline for the machine class, 2 for bad arguments or files.
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "bench_util.h"
+#include "inference_engine/core/dtype.h"
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/kernels/cpu_features.h"
+#include "inference_engine/kernels/linear.h"
+#include "inference_engine/memory/allocator.h"
+#include "inference_engine/memory/arena.h"
+#include "inference_engine/memory/pool_allocator.h"
+
+#ifndef IE_PERF_BASELINE_DIR
+#define IE_PERF_BASELINE_DIR "bench/baselines"
+#endif
+
+namespace {
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+using Clock = std::chrono::steady_clock;
+
+constexpr int kExitRegressed = 1;
+constexpr int kExitUsage = 2;
+constexpr int kExitSkipped = 77;
+
+// Each timed run lasts at least this long; the best of kRepeats runs is kept.
+constexpr std::chrono::milliseconds kMinRun{20};
+constexpr int kRepeats = 5;
+
+volatile float g_sink = 0.0f;
+
+// Nanoseconds per call of `fn`, best of kRepeats runs.
+template <typename Fn>
+double bestNsPerCall(Fn&& fn) {
+    fn(); // first touch, kernel dispatch
+    auto timeRun = [&fn](std::size_t iters) {
+        const auto t0 = Clock::now();
+        for (std::size_t i = 0; i < iters; ++i) fn();
+        return std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+    };
+    std::size_t iters = 1;
+    double ns = timeRun(iters);
+    while (ns < std::chrono::duration<double, std::nano>(kMinRun).count() && iters < (std::size_t{1} << 30)) {
+        iters *= 2;
+        ns = timeRun(iters);
+    }
+    double best = ns / static_cast<double>(iters);
+    for (int r = 1; r < kRepeats; ++r) best = std::min(best, timeRun(iters) / static_cast<double>(iters));
+    return best;
+}
+
+// ==================== Measurements ====================
+
+double gemmFp32Gflops() {
+    constexpr std::size_t m = 64, k = 512, n = 512;
+    const std::vector<float> x = bench::randomFloats(m * k);
+    const std::vector<float> w = bench::randomFloats(k * n, 0.1f, 7);
+    const std::vector<float> bias = bench::randomFloats(n, 0.01f, 9);
+    std::vector<float> y(m * n);
+    LinearArgs args;
+    args.x = x.data();
+    args.ldx = k;
+    args.w = w.data();
+    args.ldw = n;
+    args.bias = bias.data();
+    args.y = y.data();
+    args.ldy = n;
+    args.m = m;
+    args.k = k;
+    args.n = n;
+    args.activation = Activation::ReLU;
+    const double ns = bestNsPerCall([&] {
+        linear(args);
+        g_sink = y[0];
+    });
+    return 2.0 * static_cast<double>(m * k * n) / ns;
+}
+
+constexpr std::size_t kQuantizeCount = std::size_t{1} << 20;
+
+double quantizeInt8Gbps() {
+    const std::vector<float> in = bench::randomFloats(kQuantizeCount);
+    std::vector<std::int8_t> out(kQuantizeCount);
+    const double ns = bestNsPerCall([&] {
+        inference_engine::core::quantize_buffer_symmetric_int8(in.data(), out.data(), kQuantizeCount, 1.0f / 127.0f);
+        g_sink = out[0];
+    });
+    return static_cast<double>(kQuantizeCount * (sizeof(float) + sizeof(std::int8_t))) / ns;
+}
+
+double dequantizeInt8Gbps() {
+    std::vector<std::int8_t> in(kQuantizeCount);
+    for (std::size_t i = 0; i < in.size(); ++i) in[i] = static_cast<std::int8_t>(static_cast<int>(i % 255) - 127);
+    std::vector<float> out(kQuantizeCount);
+    const double ns = bestNsPerCall([&] {
+        inference_engine::core::dequantize_buffer_symmetric_int8(in.data(), out.data(), kQuantizeCount,
+                                                                 1.0f / 127.0f);
+        g_sink = out[0];
+    });
+    return static_cast<double>(kQuantizeCount * (sizeof(float) + sizeof(std::int8_t))) / ns;
+}
+
+constexpr std::size_t kBlocksPerCycle = 64;
+
+// Nanoseconds per allocate/deallocate pair, `kBlocksPerCycle` blocks live at once.
+double allocFreeNs(inference_engine::core::Allocator& alloc, std::int64_t size) {
+    std::vector<void*> blocks(kBlocksPerCycle);
+    const double ns = bestNsPerCall([&] {
+        for (void*& p : blocks) p = alloc.allocate(size);
+        g_sink = static_cast<float>(reinterpret_cast<std::uintptr_t>(blocks.back()) & 1);
+        for (void* p : blocks) alloc.deallocate(p);
+    });
+    return ns / kBlocksPerCycle;
+}
+
+double poolAllocFreeNs() {
+    inference_engine::core::PoolAllocator alloc;
+    return allocFreeNs(alloc, 4096);
+}
+
+double systemAllocFreeNs() {
+    inference_engine::core::SystemAllocator alloc;
+    return allocFreeNs(alloc, 256);
+}
+
+double arenaBumpNs() {
+    inference_engine::memory::Arena arena((256 + 64) * kBlocksPerCycle, 64);
+    const double ns = bestNsPerCall([&] {
+        for (std::size_t i = 0; i < kBlocksPerCycle; ++i) g_sink = arena.allocate(256, 64) != nullptr;
+        arena.reset();
+    });
+    return ns / kBlocksPerCycle;
+}
+
+constexpr std::size_t kChainNodes = 1024;
+
+double compileChainMs() {
+    std::unique_ptr<Graph> g = bench::buildReluChain(kChainNodes);
+    return bestNsPerCall([&] { g_sink = static_cast<float>(g->compile()->steps().size()); }) * 1e-6;
+}
+
+double planMemoryChainMs() {
+    std::unique_ptr<Graph> g = bench::buildReluChain(kChainNodes);
+    return bestNsPerCall([&] { g_sink = static_cast<float>(g->planMemory().arena_bytes); }) * 1e-6;
+}
+
+// Per-run latencies (us) of the benchmark.cpp MLP (batch 16, 128 -> 256 -> 64 and a
+// softmax), in kRepeats rounds; measured once and shared by the MLP metrics.
+const std::vector<std::vector<double>>& mlpLatencyRounds() {
+    static const std::vector<std::vector<double>> rounds = [] {
+        constexpr std::int64_t batch = 16, in_dim = 128;
+        constexpr int kRunsPerRound = 500;
+        std::unique_ptr<Graph> g = bench::buildMlp(batch, in_dim, 256, 64, 1);
+        std::unique_ptr<ExecutionPlan> plan = g->compile();
+        std::vector<float> buf = bench::randomFloats(static_cast<std::size_t>(batch * in_dim));
+        const std::vector<Tensor> inputs = {Tensor(Shape({batch, in_dim}), DataType::FP32, buf.data(), false)};
+        std::vector<Tensor> outputs;
+        for (int i = 0; i < 20; ++i) plan->run(inputs, outputs);
+
+        std::vector<std::vector<double>> out(kRepeats);
+        for (auto& samples : out) {
+            samples.reserve(kRunsPerRound);
+            for (int i = 0; i < kRunsPerRound; ++i) {
+                const auto t0 = Clock::now();
+                plan->run(inputs, outputs);
+                samples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count());
+            }
+            g_sink = outputs[0].data_as<float>()[0];
+        }
+        return out;
+    }();
+    return rounds;
+}
+
+// Best round's percentile `q` of the MLP latency.
+double mlpLatencyUs(double q) {
+    double best = 0.0;
+    for (std::vector<double> samples : mlpLatencyRounds()) {
+        const double p = bench::percentile(samples, q);
+        best = best == 0.0 ? p : std::min(best, p);
+    }
+    return best;
+}
+
+// ==================== Metrics ====================
+
+enum class Better { Higher, Lower };
+
+struct Metric {
+    const char* suite;
+    const char* name;
+    Better better;
+    double tolerance; // default relative regression allowed; baselines may override
+    double (*measure)();
+};
+
+const std::vector<Metric>& metrics() {
+    static const std::vector<Metric> all = {
+        {"kernels", "gemm_fp32_64x512x512_gflops", Better::Higher, 0.35, gemmFp32Gflops},
+        {"kernels", "quantize_int8_1m_gbps", Better::Higher, 0.35, quantizeInt8Gbps},
+        {"kernels", "dequantize_int8_1m_gbps", Better::Higher, 0.35, dequantizeInt8Gbps},
+        {"memory", "pool_alloc_free_4k_ns", Better::Lower, 0.35, poolAllocFreeNs},
+        {"memory", "system_alloc_free_256_ns", Better::Lower, 0.35, systemAllocFreeNs},
+        {"memory", "arena_bump_256_ns", Better::Lower, 0.50, arenaBumpNs},
+        {"graph", "compile_chain_1024_ms", Better::Lower, 0.35, compileChainMs},
+        {"graph", "plan_memory_chain_1024_ms", Better::Lower, 0.35, planMemoryChainMs},
+        {"model", "mlp_b16_p50_us", Better::Lower, 0.30, [] { return mlpLatencyUs(0.50); }},
+        {"model", "mlp_b16_p99_us", Better::Lower, 1.00, [] { return mlpLatencyUs(0.99); }},
+    };
+    return all;
+}
+
+// The CPU model string as a lowercase slug, e.g. "intel-xeon-platinum-8375c-2-90ghz";
+// empty where the platform does not report one.
+std::string cpuModel() {
+    std::string model;
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    for (std::string line; std::getline(cpuinfo, line);) {
+        if (line.compare(0, 10, "model name") == 0) {
+            model = line.substr(line.find(':') + 1);
+            break;
+        }
+    }
+    for (const char* mark : {"(R)", "(r)", "(TM)", "(tm)", " CPU ", "@"}) {
+        for (std::size_t at = model.find(mark); at != std::string::npos; at = model.find(mark)) {
+            model.replace(at, std::strlen(mark), " ");
+        }
+    }
+    std::string slug;
+    for (const unsigned char c : model) {
+        if (std::isalnum(c) != 0) {
+            slug += static_cast<char>(std::tolower(c));
+        } else if (!slug.empty() && slug.back() != '-') {
+            slug += '-';
+        }
+    }
+    if (!slug.empty() && slug.back() == '-') slug.pop_back();
+    return slug;
+}
+
+std::string machineClass() {
+    if (const char* env = std::getenv("IE_PERF_MACHINE_CLASS"); env != nullptr && *env != '\0') return env;
+#if defined(__x86_64__) || defined(_M_X64)
+    const char* arch = "x86_64";
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    const char* arch = "aarch64";
+#else
+    const char* arch = "other";
+#endif
+    const std::string model = cpuModel();
+    return std::string(arch) + "-" + isa_to_string(max_isa()) + (model.empty() ? "" : "-" + model);
+}
+
+// ==================== Baseline files ====================
+
+struct Baseline {
+    double value = 0.0;
+    double tolerance = 0.0;
+};
+
+// Reads `path` into `out`; false if it does not exist. Throws on a malformed line.
+bool readBaselines(const std::string& path, std::map<std::string, Baseline>& out) {
+    std::ifstream in(path);
+    if (!in) return false;
+    std::string line;
+    for (int number = 1; std::getline(in, line); ++number) {
+        const std::size_t start = line.find_first_not_of(" \t\r");
+        if (start == std::string::npos || line[start] == '#') continue;
+        std::istringstream fields(line);
+        std::string name;
+        Baseline b;
+        if (!(fields >> name >> b.value >> b.tolerance) || b.value <= 0.0 || b.tolerance < 0.0) {
+            throw std::runtime_error(path + ":" + std::to_string(number) + ": expected \"metric value tolerance\"");
+        }
+        out[name] = b;
+    }
+    return true;
+}
+
+void writeBaselines(const std::string& path, const std::string& machine, const std::map<std::string, Baseline>& all) {
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) throw std::runtime_error("cannot write " + path);
+    out << "# Perf baselines for machine class " << machine << ", written by perf_tests --record.\n"
+        << "# Tolerance: relative regression allowed before the metric fails.\n"
+        << "# metric                          value        tolerance\n";
+    for (const Metric& m : metrics()) {
+        const auto it = all.find(m.name);
+        if (it == all.end()) continue;
+        out << std::left << std::setw(34) << m.name << std::setw(13) << std::setprecision(6) << it->second.value
+            << std::setprecision(3) << it->second.tolerance << '\n';
+    }
+}
+
+// ==================== Report ====================
+
+struct Result {
+    const Metric* metric;
+    double measured;
+};
+
+// Prints measured against baseline per metric; returns the number that regressed.
+int report(const std::vector<Result>& results, const std::map<std::string, Baseline>& baselines, std::ostream& os) {
+    int regressed = 0;
+    os << std::left << std::setw(30) << "metric" << std::right << std::setw(12) << "baseline" << std::setw(12)
+       << "measured" << std::setw(10) << "change" << std::setw(10) << "allowed" << "  status\n";
+    os << std::fixed;
+    for (const Result& r : results) {
+        const Metric& m = *r.metric;
+        os << std::left << std::setw(30) << m.name << std::right << std::setprecision(3);
+        const auto it = baselines.find(m.name);
+        if (it == baselines.end()) {
+            os << std::setw(12) << "-" << std::setw(12) << r.measured << std::setw(10) << "-" << std::setw(10) << "-"
+               << "  new (no baseline)\n";
+            continue;
+        }
+        const Baseline& b = it->second;
+        const double change = r.measured / b.value - 1.0;
+        // Positive: better than the baseline.
+        const double gain = m.better == Better::Higher ? change : -change;
+        const char* status = "ok";
+        if (gain < -b.tolerance) {
+            status = "REGRESSED";
+            ++regressed;
+        } else if (gain > b.tolerance) {
+            status = "improved (re-record the baseline)";
+        }
+        std::ostringstream pct, allowed;
+        pct << std::showpos << std::fixed << std::setprecision(1) << 100.0 * change << '%';
+        allowed << (m.better == Better::Higher ? '-' : '+') << std::fixed << std::setprecision(1)
+                << 100.0 * b.tolerance << '%';
+        os << std::setw(12) << b.value << std::setw(12) << r.measured << std::setw(10) << pct.str() << std::setw(10)
+           << allowed.str() << "  " << status << '\n';
+    }
+    return regressed;
+}
+
+int usage(const char* argv0) {
+    std::cerr << "usage: " << argv0
+              << " [--suite=kernels|memory|graph|model]... [--baselines=DIR] [--machine_class=NAME] [--record]"
+                 " [--list]\n";
+    return kExitUsage;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::set<std::string> suites;
+    std::string dir = IE_PERF_BASELINE_DIR;
+    std::string machine = machineClass();
+    bool record = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&arg](const char* flag) {
+            const std::size_t n = std::strlen(flag);
+            return arg.compare(0, n, flag) == 0 ? arg.substr(n) : std::string();
+        };
+        if (!value("--suite=").empty()) {
+            suites.insert(value("--suite="));
+        } else if (!value("--baselines=").empty()) {
+            dir = value("--baselines=");
+        } else if (!value("--machine_class=").empty()) {
+            machine = value("--machine_class=");
+        } else if (arg == "--record") {
+            record = true;
+        } else if (arg == "--list") {
+            for (const Metric& m : metrics()) std::cout << m.suite << '\t' << m.name << '\n';
+            return 0;
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    for (const std::string& s : suites) {
+        const bool known = std::any_of(metrics().begin(), metrics().end(),
+                                       [&s](const Metric& m) { return s == m.suite; });
+        if (!known) {
+            std::cerr << "perf_tests: unknown suite " << s << "\n";
+            return usage(argv[0]);
+        }
+    }
+
+    const std::string path = dir + "/" + machine + ".txt";
+    std::map<std::string, Baseline> baselines;
+    bool have_baselines = false;
+    try {
+        have_baselines = readBaselines(path, baselines);
+    } catch (const std::exception& e) {
+        std::cerr << "perf_tests: " << e.what() << "\n";
+        return kExitUsage;
+    }
+    if (!have_baselines && !record) {
+        std::cout << "perf_tests: no baselines for machine class " << machine << " (" << path
+                  << "); record them with --record. Skipping.\n";
+        return kExitSkipped;
+    }
+
+    std::vector<Result> results;
+    for (const Metric& m : metrics()) {
+        if (!suites.empty() && suites.count(m.suite) == 0) continue;
+        results.push_back({&m, m.measure()});
+    }
+
+    std::cout << "machine class " << machine << ", baselines " << path << "\n";
+    if (record) {
+        for (const Result& r : results) {
+            const auto it = baselines.find(r.metric->name);
+            const double tolerance = it != baselines.end() ? it->second.tolerance : r.metric->tolerance;
+            baselines[r.metric->name] = Baseline{r.measured, tolerance};
+        }
+        try {
+            writeBaselines(path, machine, baselines);
+        } catch (const std::exception& e) {
+            std::cerr << "perf_tests: " << e.what() << "\n";
+            return kExitUsage;
+        }
+        (void)report(results, baselines, std::cout);
+        std::cout << "recorded " << results.size() << " metrics\n";
+        return 0;
+    }
+
+    const int regressed = report(results, baselines, std::cout);
+    if (regressed > 0) {
+        std::cout << "FAILED: " << regressed << " metric" << (regressed == 1 ? "" : "s")
+                  << " regressed beyond the tolerance of the " << machine << " baseline\n";
+        return kExitRegressed;
+    }
+    return 0;
+}
@@ -1,220 +1,41 @@
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <limits>
 #include <random>
 #include <vector>
 
 #include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/execution_plan.h"
 #include "inference_engine/graph/graph.h"
 #include "inference_engine/graph/node.h"
 #include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/profiler.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/softmax.h"
+#include "inference_engine/passes/fusion.h"
 
 using inference_engine::core::DataType;
 using inference_engine::core::Shape;
 using inference_engine::core::Tensor;
 using namespace infer;
 
-namespace {
-class MatMulBiasOp final : public Operator {
-public:
-    MatMulBiasOp(int64_t in_dim, int64_t out_dim, std::vector<float> weights, std::vector<float> bias)
-        : Operator("MatMulBias"), in_dim_(in_dim), out_dim_(out_dim), weights_(std::move(weights)), bias_(std::move(bias)) {
-        if (weights_.size() != static_cast<std::size_t>(in_dim_ * out_dim_)) {
-            throw std::invalid_argument("MatMulBiasOp: weight size mismatch");
+// Usage: benchmark [--profile [trace.json]]
+int main(int argc, char** argv) {
+    bool profile = false;
+    const char* trace_path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--profile") == 0) {
+            profile = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-') trace_path = argv[++i];
         }
-        if (bias_.size() != static_cast<std::size_t>(out_dim_)) {
-            throw std::invalid_argument("MatMulBiasOp: bias size mismatch");
-        }
-    }
-
-    void execute() override {
-        validate();
-        if (inputs().size() != 1 || outputs().size() != 1) {
-            throw std::invalid_argument("MatMulBiasOp expects 1 input and 1 output");
-        }
-
-        const Value* in_val = inputs()[0];
-        Value* out_val = outputs()[0];
-        if (in_val == nullptr || out_val == nullptr) {
-            throw std::invalid_argument("MatMulBiasOp: null Value*");
-        }
-
-        const Tensor* input = in_val->tensor();
-        if (input == nullptr) {
-            throw std::runtime_error("MatMulBiasOp: input tensor is null");
-        }
-        if (input->dtype() != DataType::FP32) {
-            throw std::invalid_argument("MatMulBiasOp only supports FP32");
-        }
-
-        const auto& s = in_val->shape();
-        if (s.rank() != 2 || s.dim(1) != in_dim_) {
-            throw std::invalid_argument("MatMulBiasOp: expected [batch, in_dim] input shape");
-        }
-
-        const int64_t batch = s.dim(0);
-        const float* x = input->data_as<float>();
-        if (x == nullptr) {
-            throw std::runtime_error("MatMulBiasOp: input tensor has null data");
-        }
-
-        output_buf_.assign(static_cast<std::size_t>(batch * out_dim_), 0.0f);
-
-        for (int64_t b = 0; b < batch; ++b) {
-            for (int64_t j = 0; j < out_dim_; ++j) {
-                float acc = bias_[static_cast<std::size_t>(j)];
-                const std::size_t base_in = static_cast<std::size_t>(b * in_dim_);
-                const std::size_t base_w = static_cast<std::size_t>(j);
-                for (int64_t i = 0; i < in_dim_; ++i) {
-                    acc += x[base_in + static_cast<std::size_t>(i)] *
-                           weights_[static_cast<std::size_t>(i * out_dim_) + base_w];
-                }
-                output_buf_[static_cast<std::size_t>(b * out_dim_ + j)] = acc;
-            }
-        }
-
-        output_tensor_ = Tensor(Shape({batch, out_dim_}), DataType::FP32,
-                                static_cast<void*>(output_buf_.data()), false);
-        out_val->setTensor(&output_tensor_);
-    }
-
-    std::unique_ptr<Operator> clone() const override {
-        return std::make_unique<MatMulBiasOp>(*this);
-    }
-
-private:
-    int64_t in_dim_;
-    int64_t out_dim_;
-    std::vector<float> weights_;
-    std::vector<float> bias_;
-    std::vector<float> output_buf_{};
-    Tensor output_tensor_{};
-};
-
-class ReluOp final : public Operator {
-public:
-    ReluOp() : Operator("ReLU") {}
-
-    void execute() override {
-        validate();
-        if (inputs().size() != 1 || outputs().size() != 1) {
-            throw std::invalid_argument("ReLU expects 1 input and 1 output");
-        }
-
-        const Value* in_val = inputs()[0];
-        Value* out_val = outputs()[0];
-        if (in_val == nullptr || out_val == nullptr) {
-            throw std::invalid_argument("ReLU: null Value*");
-        }
-
-        const Tensor* input = in_val->tensor();
-        if (input == nullptr) {
-            throw std::runtime_error("ReLU: input tensor is null");
-        }
-        if (input->dtype() != DataType::FP32) {
-            throw std::invalid_argument("ReLU only supports FP32");
-        }
-
-        const std::size_t elems = static_cast<std::size_t>(input->num_elements());
-        const float* x = input->data_as<float>();
-        if (x == nullptr) {
-            throw std::runtime_error("ReLU: input tensor has null data");
-        }
-
-        output_buf_.resize(elems);
-        for (std::size_t idx = 0; idx < elems; ++idx) {
-            output_buf_[idx] = std::max(0.0f, x[idx]);
-        }
-
-        output_tensor_ = Tensor(in_val->shape(), DataType::FP32,
-                                static_cast<void*>(output_buf_.data()), false);
-        out_val->setTensor(&output_tensor_);
     }
 
-    std::unique_ptr<Operator> clone() const override {
-        return std::make_unique<ReluOp>(*this);
-    }
-
-private:
-    std::vector<float> output_buf_{};
-    Tensor output_tensor_{};
-};
-
-class SoftmaxOp final : public Operator {
-public:
-    SoftmaxOp() : Operator("Softmax") {}
-
-    void execute() override {
-        validate();
-        if (inputs().size() != 1 || outputs().size() != 1) {
-            throw std::invalid_argument("Softmax expects 1 input and 1 output");
-        }
-
-        const Value* in_val = inputs()[0];
-        Value* out_val = outputs()[0];
-        if (in_val == nullptr || out_val == nullptr) {
-            throw std::invalid_argument("Softmax: null Value*");
-        }
-
-        const Tensor* input = in_val->tensor();
-        if (input == nullptr) {
-            throw std::runtime_error("Softmax: input tensor is null");
-        }
-        if (input->dtype() != DataType::FP32) {
-            throw std::invalid_argument("Softmax only supports FP32");
-        }
-
-        const auto& s = in_val->shape();
-        if (s.rank() != 2) {
-            throw std::invalid_argument("Softmax: expected 2D input [batch, classes]");
-        }
-
-        const int64_t batch = s.dim(0);
-        const int64_t classes = s.dim(1);
-        const float* x = input->data_as<float>();
-        if (x == nullptr) {
-            throw std::runtime_error("Softmax: input tensor has null data");
-        }
-
-        output_buf_.assign(static_cast<std::size_t>(batch * classes), 0.0f);
-
-        for (int64_t b = 0; b < batch; ++b) {
-            const std::size_t base = static_cast<std::size_t>(b * classes);
-            float max_v = -std::numeric_limits<float>::infinity();
-            for (int64_t c = 0; c < classes; ++c) {
-                max_v = std::max(max_v, x[base + static_cast<std::size_t>(c)]);
-            }
-
-            float sum = 0.0f;
-            for (int64_t c = 0; c < classes; ++c) {
-                const float e = std::exp(x[base + static_cast<std::size_t>(c)] - max_v);
-                output_buf_[base + static_cast<std::size_t>(c)] = e;
-                sum += e;
-            }
-
-            const float inv_sum = (sum == 0.0f) ? 0.0f : 1.0f / sum;
-            for (int64_t c = 0; c < classes; ++c) {
-                output_buf_[base + static_cast<std::size_t>(c)] *= inv_sum;
-            }
-        }
-
-        output_tensor_ = Tensor(s, DataType::FP32, static_cast<void*>(output_buf_.data()), false);
-        out_val->setTensor(&output_tensor_);
-    }
-
-    std::unique_ptr<Operator> clone() const override {
-        return std::make_unique<SoftmaxOp>(*this);
-    }
-
-private:
-    std::vector<float> output_buf_{};
-    Tensor output_tensor_{};
-};
-} // namespace
-
-int main() {
     std::cout << "Benchmark (2-layer MLP + softmax)" << std::endl;
 
     constexpr int64_t batch = 16;
@@ -269,18 +90,31 @@ int main() {
     }
     Tensor input(Shape({batch, in_dim}), DataType::FP32, static_cast<void*>(buf.data()), false);
 
+    // Fold relu1 into linear1's GEMM epilogue; h1 disappears from the arena.
+    const std::size_t nodes_before = g.nodes().size();
+    FusionPass fusion;
+    g.applyPass(fusion);
+    std::cout << "nodes: " << nodes_before << " -> " << g.nodes().size() << " after fusion\n";
+
+    // Compile once: validation, sorting and arena planning are off the hot path.
+    auto plan = g.compile();
+    const MemoryPlan& mem = plan->memoryPlan();
+    std::cout << "arena: " << mem.arena_bytes << " bytes (peak live " << mem.peak_bytes << ")\n";
+    const std::vector<Tensor> inputs = {input};
+    std::vector<Tensor> outputs;
+
     constexpr int warmup = 20;
     constexpr int iters = 2000;
 
     for (int i = 0; i < warmup; ++i) {
-        (void)g.execute(input);
+        plan->run(inputs, outputs);
     }
 
     volatile float sink = 0.0f;
     const auto t0 = std::chrono::steady_clock::now();
     for (int i = 0; i < iters; ++i) {
-        Tensor out = g.execute(input);
-        sink += out.data_as<float>()[0];
+        plan->run(inputs, outputs);
+        sink += outputs[0].data_as<float>()[0];
     }
     const auto t1 = std::chrono::steady_clock::now();
 
@@ -294,5 +128,23 @@ int main() {
     std::cout << "latency: " << us_per_iter << " us/iter\n";
     std::cout << "throughput: " << iters_per_s << " iters/s\n";
     std::cout << "sink: " << sink << "\n";
+
+    if (profile) {
+        // Separate from the timed loop so the numbers above stay uninstrumented.
+        Profiler profiler;
+        {
+            Profiler::Scope scope(&profiler);
+            for (int i = 0; i < 200; ++i) {
+                plan->run(inputs, outputs);
+            }
+        }
+        std::cout << "\nper-op profile (200 iters):\n";
+        profiler.printSummary(std::cout);
+        if (trace_path != nullptr) {
+            std::ofstream trace(trace_path);
+            profiler.writeChromeTrace(trace);
+            std::cout << "trace: " << trace_path << "\n";
+        }
+    }
     return 0;
 }
@@ -1,6 +1,64 @@
+// Runs an ONNX model on a deterministic input and prints the first output.
+//
+//   onnx_inference model.onnx [--batch N]
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <iostream>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/onnx/onnx_model.h"
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
 
-int main() {
+int main(int argc, char** argv) {
     std::cout << "ONNX Inference Example" << std::endl;
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " model.onnx [--batch N]\n";
+        return 2;
+    }
+    OnnxImportOptions options;
+    if (argc >= 4 && std::strcmp(argv[2], "--batch") == 0) {
+        options.symbolic_dim_value = std::atoll(argv[3]);
+    }
+
+    try {
+        OnnxModel model(argv[1]);
+        Graph g;
+        model.buildGraph(g, options);
+        if (g.inputs().size() != 1 || g.outputs().empty()) {
+            std::cerr << "onnx_inference: expected a single-input model\n";
+            return 1;
+        }
+        const Value* in = g.inputs()[0];
+        if (in->dtype() != DataType::FP32) {
+            std::cerr << "onnx_inference: input '" << in->name() << "' is not FP32\n";
+            return 1;
+        }
+
+        std::vector<float> data(static_cast<std::size_t>(in->shape().num_elements()));
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<float>(static_cast<int>(i % 17) - 8) / 8.0f;
+        }
+        Tensor x(in->shape(), DataType::FP32, data.data(), false);
+        const Tensor y = g.execute(x);
+
+        std::cout << "Loaded " << model.nodes().size() << " nodes, "
+                  << model.loadedWeightBytes() << " weight bytes used\n";
+        std::cout << "Output '" << g.outputs()[0]->name() << "' " << inference_engine::core::shape_to_string(y.shape()) << ":";
+        const std::size_t shown = std::min<std::size_t>(static_cast<std::size_t>(y.num_elements()), 16);
+        for (std::size_t i = 0; i < shown; ++i) std::cout << ' ' << y.data_as<float>()[i];
+        std::cout << (shown < static_cast<std::size_t>(y.num_elements()) ? " ..." : "") << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "onnx_inference: " << e.what() << '\n';
+        return 1;
+    }
     return 0;
 }
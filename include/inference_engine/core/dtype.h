@@ -11,6 +11,8 @@
 #include <type_traits>
 #include <vector>
 
+#include "inference_engine/core/half.h"
+
 namespace inference_engine {
 namespace core {    
     enum class DataType:int{
@@ -100,7 +102,7 @@ constexpr bool is_quantized(DataType dt)noexcept {
         using type = float;
     };
     template<>struct DataTypeToCppType<DataType::FP16>{
-        using type = uint16_t; 
+        using type = Half;
     };
     template<>struct DataTypeToCppType<DataType::INT8>{
         using type = int8_t;
@@ -136,19 +138,20 @@ constexpr bool is_quantized(DataType dt)noexcept {
     template <typename T>
     constexpr DataType cpp_type_to_datatype() noexcept {
         if constexpr (std::is_same_v<T, float>) return DataType::FP32;
-        else if constexpr (std::is_same_v<T, uint16_t>) return DataType::FP16;
+        else if constexpr (std::is_same_v<T, Half>) return DataType::FP16;
         else if constexpr (std::is_same_v<T, int8_t>) return DataType::INT8;
         else if constexpr (std::is_same_v<T, int16_t>) return DataType::INT16;
         else if constexpr (std::is_same_v<T, int32_t>) return DataType::INT32;
         else if constexpr (std::is_same_v<T, int64_t>) return DataType::INT64;
         else if constexpr (std::is_same_v<T, uint8_t>) return DataType::UINT8;
+        else if constexpr (std::is_same_v<T, uint16_t>) return DataType::UINT16;
         else if constexpr (std::is_same_v<T, uint32_t>) return DataType::UINT32;
         else if constexpr (std::is_same_v<T, uint64_t>) return DataType::UINT64;
         else if constexpr (std::is_same_v<T, bool>) return DataType::BOOL;
         else return DataType::UNKNOWN;
     }
 
-/* Quantization parameters supporting per-tensor and per-channel INT8/UINT8 quantization. */
+/* Quantization parameters supporting per-tensor, per-channel and block-wise (grouped) quantization. */
 struct QuantizationParams {
     // Per-tensor scale and zero_point used when per_channel_scales is empty.
     float scale = 1.0f;
@@ -165,15 +168,30 @@ struct QuantizationParams {
     // Whether scales are symmetric (zero_point assumed zero)
     bool symmetric = false;
 
+    // Block-wise (grouped) symmetric scales, for weight-only quantization. When
+    // group_size > 0, every run of group_size consecutive elements along `axis` has
+    // its own FP16 scale, and values are stored in `bits` bits (4 or 8). The scales
+    // are laid out like the tensor with dims[axis] replaced by the group count
+    // ceil(dims[axis] / group_size).
+    int32_t group_size = 0;
+    int32_t bits = 8;
+    std::vector<Half> group_scales;
+
     QuantizationParams() = default;
 
     bool is_per_channel() const noexcept { return !per_channel_scales.empty(); }
+    bool is_grouped() const noexcept { return group_size > 0; }
 
     bool operator==(QuantizationParams const& o) const noexcept {
+        if (group_scales.size() != o.group_scales.size()) return false;
+        for (std::size_t i = 0; i < group_scales.size(); ++i) {
+            if (!group_scales[i].same_bits(o.group_scales[i])) return false;
+        }
         return scale == o.scale && zero_point == o.zero_point &&
                per_channel_scales == o.per_channel_scales &&
                per_channel_zero_points == o.per_channel_zero_points &&
-               axis == o.axis && symmetric == o.symmetric;
+               axis == o.axis && symmetric == o.symmetric &&
+               group_size == o.group_size && bits == o.bits;
     }
 };
 
@@ -193,7 +211,9 @@ QuantizationParams calculate_per_channel_quant_params(
     const std::vector<float>& channel_max,
     int axis, bool symmetric, DataType target_dtype);
 
-// Batch quantization operations
+// Batch quantization operations. Scales are validated once per call and the work
+// runs on the SIMD kernel selected for the host (see kernels/registry.h); results
+// are identical to applying the scalar helpers element by element.
 void quantize_buffer_symmetric_int8(
     const float* input, int8_t* output, std::size_t count, float scale);
 void quantize_buffer_asymmetric_uint8(
@@ -205,6 +225,46 @@ void dequantize_buffer_asymmetric_uint8(
     const uint8_t* input, float* output, std::size_t count,
     float scale, int32_t zero_point);
 
+// Per-channel batch operations over a dense row-major tensor with dimensions `dims`.
+// Channels run along params.axis (negative counts from the back) and use
+// params.per_channel_scales, plus params.per_channel_zero_points when present
+// (otherwise params.zero_point). Throws std::invalid_argument when params are not
+// per-channel, the axis is out of range, the channel count does not match
+// dims[axis], or a scale is not positive.
+void quantize_buffer_per_channel_int8(
+    const float* input, int8_t* output, const std::vector<int64_t>& dims,
+    const QuantizationParams& params);
+void quantize_buffer_per_channel_uint8(
+    const float* input, uint8_t* output, const std::vector<int64_t>& dims,
+    const QuantizationParams& params);
+void dequantize_buffer_per_channel_int8(
+    const int8_t* input, float* output, const std::vector<int64_t>& dims,
+    const QuantizationParams& params);
+void dequantize_buffer_per_channel_uint8(
+    const uint8_t* input, float* output, const std::vector<int64_t>& dims,
+    const QuantizationParams& params);
+
+// Block-wise symmetric quantization over a dense row-major tensor with dimensions
+// `dims`, groups of `group_size` elements running along `axis` (negative counts
+// from the back). Each group's scale is max|x| / (2^(bits-1) - 1) rounded to FP16;
+// quantized values are stored one per int8 in [-(2^(bits-1) - 1), 2^(bits-1) - 1]
+// (kernels pack them further). Throws std::invalid_argument for bits other than 4
+// or 8, a non-positive group size, an out-of-range axis, or a scale beyond FP16.
+QuantizationParams calculate_group_quant_params(
+    const float* input, const std::vector<int64_t>& dims, int axis,
+    int32_t group_size, int32_t bits);
+void quantize_buffer_grouped(
+    const float* input, int8_t* output, const std::vector<int64_t>& dims,
+    const QuantizationParams& params);
+void dequantize_buffer_grouped(
+    const int8_t* input, float* output, const std::vector<int64_t>& dims,
+    const QuantizationParams& params);
+
+// FP32 <-> FP16 buffer conversion on the host's fastest kernel (F16C, AVX-512 or
+// NEON). Round to nearest even; bit-identical to Half's scalar conversions.
+void convert_fp32_to_fp16(const float* input, Half* output, std::size_t count);
+void convert_fp16_to_fp32(const Half* input, float* output, std::size_t count);
+
 // Type compatibility
 bool can_cast_dtype(DataType from, DataType to);
 DataType promote_dtypes(DataType a, DataType b);
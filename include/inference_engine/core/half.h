@@ -0,0 +1,112 @@
+#ifndef INFERENCE_ENGINE_CORE_HALF_H_
+#define INFERENCE_ENGINE_CORE_HALF_H_
+
+/*
+ * IEEE 754 binary16 storage type.
+ * Half only stores and converts; arithmetic happens in FP32. The scalar
+ * conversions round to nearest even, keep subnormals, and quiet NaNs while keeping
+ * their upper payload bits, exactly like F16C (vcvtps2ph/vcvtph2ps) and the
+ * AArch64 FCVT instructions, so every conversion kernel agrees bit for bit.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+namespace inference_engine {
+namespace core {
+
+constexpr std::uint16_t fp32_bits_to_fp16_bits(std::uint32_t x) noexcept {
+    const std::uint16_t sign = static_cast<std::uint16_t>((x >> 16) & 0x8000u);
+    const std::uint32_t a = x & 0x7FFFFFFFu;
+    if (a > 0x7F800000u) {
+        // NaN: set the quiet bit and keep the top 9 payload bits.
+        return static_cast<std::uint16_t>(sign | 0x7E00u | ((a >> 13) & 0x3FFu));
+    }
+    if (a >= 0x47800000u) {
+        return static_cast<std::uint16_t>(sign | 0x7C00u); // >= 2^16 (or Inf) overflows
+    }
+    if (a >= 0x38800000u) {
+        // Normal half: rebias the exponent (127 - 15 = 112) and round the 13 dropped
+        // mantissa bits to nearest even. A carry out of 65504 lands on Inf.
+        std::uint32_t r = a - 0x38000000u;
+        r += 0xFFFu + ((r >> 13) & 1u);
+        return static_cast<std::uint16_t>(sign | (r >> 13));
+    }
+    if (a <= 0x33000000u) {
+        return sign; // at most 2^-25: rounds (ties to even) to zero
+    }
+    // Subnormal half: value / 2^-24, rounded to nearest even.
+    const std::uint32_t e = a >> 23;
+    const std::uint32_t m = (a & 0x7FFFFFu) | 0x800000u;
+    const std::uint32_t shift = 126u - e;
+    std::uint32_t q = m >> shift;
+    const std::uint32_t rem = m & ((1u << shift) - 1u);
+    const std::uint32_t halfway = 1u << (shift - 1u);
+    if (rem > halfway || (rem == halfway && (q & 1u) != 0)) {
+        ++q;
+    }
+    return static_cast<std::uint16_t>(sign | q);
+}
+
+constexpr std::uint32_t fp16_bits_to_fp32_bits(std::uint16_t h) noexcept {
+    const std::uint32_t sign = static_cast<std::uint32_t>(h & 0x8000u) << 16;
+    std::uint32_t e = (h >> 10) & 0x1Fu;
+    std::uint32_t m = h & 0x3FFu;
+    if (e == 0x1Fu) {
+        // Inf stays Inf; NaN gains the quiet bit.
+        return sign | 0x7F800000u | (m != 0 ? 0x400000u : 0u) | (m << 13);
+    }
+    if (e == 0) {
+        if (m == 0) return sign;
+        // Subnormal half: normalize into an FP32 normal.
+        e = 1;
+        while ((m & 0x400u) == 0) {
+            m <<= 1;
+            --e;
+        }
+        m &= 0x3FFu;
+    }
+    return sign | ((e + 112u) << 23) | (m << 13);
+}
+
+inline std::uint16_t fp32_to_fp16(float f) noexcept {
+    std::uint32_t x = 0;
+    std::memcpy(&x, &f, sizeof(x));
+    return fp32_bits_to_fp16_bits(x);
+}
+
+inline float fp16_to_fp32(std::uint16_t h) noexcept {
+    const std::uint32_t x = fp16_bits_to_fp32_bits(h);
+    float f = 0.0f;
+    std::memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+/*
+ * Element type of DataType::FP16 tensors. Layout-compatible with uint16_t so
+ * buffers of Half can be handed to the conversion and compute kernels directly.
+ */
+struct Half {
+    std::uint16_t bits = 0;
+
+    Half() noexcept = default;
+    explicit Half(float f) noexcept : bits(fp32_to_fp16(f)) {}
+
+    static constexpr Half from_bits(std::uint16_t b) noexcept {
+        Half h;
+        h.bits = b;
+        return h;
+    }
+
+    explicit operator float() const noexcept { return fp16_to_fp32(bits); }
+    float to_float() const noexcept { return fp16_to_fp32(bits); }
+
+    // Bitwise identity (distinguishes -0 from +0 and NaN payloads).
+    constexpr bool same_bits(Half o) const noexcept { return bits == o.bits; }
+};
+
+static_assert(sizeof(Half) == 2, "Half must be exactly 16 bits");
+
+} // namespace core
+} // namespace inference_engine
+#endif // INFERENCE_ENGINE_CORE_HALF_H_
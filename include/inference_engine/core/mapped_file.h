@@ -0,0 +1,71 @@
+#ifndef INFERENCE_ENGINE_CORE_MAPPED_FILE_H_
+#define INFERENCE_ENGINE_CORE_MAPPED_FILE_H_
+
+/*
+ * Read-only memory mapping of a whole file.
+ * The mapping is shared: every process that maps the same file is served from the
+ * same page-cache pages, and pages are only faulted in when first touched. Writing
+ * through data() is undefined (the pages are mapped read-only).
+ *
+ * With page options, the file can instead be pre-faulted, or copied once into
+ * private anonymous pages (huge pages, bound to a NUMA node) that are then served
+ * as the mapping.
+ */
+
+#include <cstddef>
+#include <string>
+
+#include "inference_engine/memory/pages.h"
+
+namespace inference_engine {
+namespace core {
+
+class MappedFile {
+public:
+    MappedFile() noexcept = default;
+
+    // Maps `path` read-only. Throws std::runtime_error if the file cannot be opened
+    // or mapped (including empty files).
+    explicit MappedFile(const std::string& path);
+    // Maps `path` as above, then applies `pages`: prefault only touches the shared
+    // mapping; huge pages or a NUMA node copy the file into private pages (shared
+    // page-cache pages cannot be placed). Throws std::runtime_error on failure.
+    MappedFile(const std::string& path, const memory::PageOptions& pages);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    ~MappedFile() noexcept;
+
+    const void* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    const std::string& path() const noexcept { return path_; }
+    bool is_open() const noexcept { return data_ != nullptr; }
+    // True when data() is a private copy in anonymous pages.
+    bool is_private_copy() const noexcept { return copy_.data != nullptr; }
+    const memory::PageRegion& private_pages() const noexcept { return copy_; }
+
+    // True when [p, p + bytes) lies inside the mapping.
+    bool contains(const void* p, std::size_t bytes = 0) const noexcept;
+
+    void close() noexcept;
+
+private:
+    bool release_copy() noexcept;
+
+    const void* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::string path_{};
+    memory::PageRegion copy_{};
+#if defined(_WIN32) || defined(_WIN64)
+    void* mapping_handle_ = nullptr;
+#endif
+};
+
+} // namespace core
+} // namespace inference_engine
+
+#endif // INFERENCE_ENGINE_CORE_MAPPED_FILE_H_
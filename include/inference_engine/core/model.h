@@ -1,23 +1,175 @@
 #pragma once
 
+#include "inference_engine/core/mapped_file.h"
+#include "inference_engine/core/model_format.h"
 #include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/plan_cache.h"
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace infer {
 
+class ExecutionContext;
+class ExecutionPlan;
 class Graph;
+class LatencyHistogram;
+class MetricsRegistry;
+class PackedWeightCache;
+class ThreadPool;
+class WeightStore;
 
 class Model {
 public:
     Model();
     ~Model();
     
+    // Maps a model file written by save()/saveModel() and rebuilds its graph. Weight
+    // tensors are views into the read-only mapping, so loading copies no weight data
+    // and processes that load the same file share its pages through the page cache.
+    // Replaces any previously loaded graph. Throws std::runtime_error on failure.
     void load(const std::string& path);
+    // Same, placing the weights per `weight_pages` (see MappedFile): e.g. pre-faulted,
+    // or copied once into huge pages on the NUMA node that will run the model.
+    void load(const std::string& path, const inference_engine::memory::PageOptions& weight_pages);
+    void save(const std::string& path) const;
+
+    // Directory of the packed-weight cache (see PackedWeightCache) for models loaded
+    // from now on; empty (the default) disables it. Compiling packs the weights for
+    // the host's kernels once and writes them there, keyed by a hash of the model
+    // file and the ISA, so a later load of the same file maps them instead of packing.
+    void setWeightCacheDirectory(std::string directory);
+    // Cache of the loaded model, or null.
+    [[nodiscard]] PackedWeightCache* weightCache() noexcept { return weight_cache_.get(); }
+
+    // Content-addressed store (e.g. &WeightStore::global()) for the weights of models
+    // loaded from now on; null (the default) keeps them in the mapped file. Loading
+    // then interns every weight tensor in the store and releases the mapping, and
+    // compiling interns the prepacked weights unless a weight cache serves them, so
+    // models and versions of a model loaded into one store share identical tensors:
+    // swapping in a new version costs only the memory of the tensors that changed.
+    // The store must outlive the model.
+    void setWeightStore(WeightStore* store) noexcept { weight_store_ = store; }
+    [[nodiscard]] WeightStore* weightStore() const noexcept { return weight_store_; }
+
+    // Runs a single-input graph. Thread-safe: the graph is compiled once and shared,
+    // and every calling thread runs it with its own ExecutionContext. The returned
+    // view stays valid until the same thread's next infer().
+    //
+    // An input whose shape differs from the graph's input Value (another batch size
+    // or sequence length) runs on a plan specialized for that shape, taken from
+    // planCache(). When the cache buckets the batch, the input is zero-padded to the
+    // bucket and the output rows beyond the input's batch are dropped, which assumes
+    // rows are independent. Each thread keeps a context per specialized plan it used,
+    // up to the cache capacity.
     inference_engine::core::Tensor infer(const inference_engine::core::Tensor& input);
+    // Same, with request state owned by the caller (e.g. a pool of contexts for a
+    // fixed set of workers). `ctx` must come from createContext() on this model.
+    inference_engine::core::Tensor infer(ExecutionContext& ctx, const inference_engine::core::Tensor& input);
+    [[nodiscard]] std::unique_ptr<ExecutionContext> createContext();
+
+    // Runs infer() as a task on `pool` so the caller never waits for compute. The
+    // input must stay valid until the result is delivered; the result owns its data.
+    // The callback runs on a pool thread and receives either the result or the
+    // exception infer() threw. See InferencePipeline for staged pre/postprocessing.
+    using InferCallback = std::function<void(inference_engine::core::Tensor, std::exception_ptr)>;
+    std::future<inference_engine::core::Tensor> inferAsync(ThreadPool& pool, const inference_engine::core::Tensor& input);
+    void inferAsync(ThreadPool& pool, const inference_engine::core::Tensor& input, InferCallback done);
+
+    // Compiled plan shared by all requests; recompiled after the graph is edited.
+    // Editing the graph or calling load() while other threads infer is not supported.
+    [[nodiscard]] const ExecutionPlan& plan();
+
+    // Writes the schedule and memory layout of plan() (see plan_format.h), typically
+    // next to the model file, so that later processes skip compiling the graph.
+    void savePlan(const std::string& path);
+    // Installs the plan saved at `path` for the loaded graph: one mapping and a
+    // compatibility check instead of sorting and planning. Returns false, leaving
+    // plan() to compile on first use, when the file is missing or was written for
+    // another graph, ISA or format version, with `*reason` (when given) saying which.
+    // The plan holds no graph: one saved after rewriting passes only matches once
+    // the same passes ran on the loaded graph (see plan_format.h). Throws
+    // std::runtime_error for a corrupt file. Call after load().
+    bool loadPlan(const std::string& path, std::string* reason = nullptr);
+
+    // Plans for input shapes other than the graph's own. Options apply to the cache
+    // created on first use; setting them drops previously specialized plans.
+    void setPlanCacheOptions(const PlanCacheOptions& options);
+    [[nodiscard]] PlanCache& planCache();
+
+    // Records the latency of every infer() in `metrics` under `name`, the latency of
+    // its steps per operator type, and arenaStats() (see MetricsRegistry). Null stops
+    // recording. `metrics` must outlive the model or be replaced first; not to be
+    // called while other threads infer.
+    void setMetrics(MetricsRegistry* metrics, const std::string& name = "model");
+    [[nodiscard]] MetricsRegistry* metrics() const noexcept { return metrics_; }
+
+    // Activation arenas of the contexts the model keeps per thread (not those from
+    // createContext()). Their size is fixed by the plan, so `bytes` is also what the
+    // running requests can touch at most.
+    struct ArenaStats {
+        std::size_t contexts = 0;
+        std::size_t bytes = 0;
+        std::size_t peak_bytes = 0; // high-water mark of `bytes`
+    };
+    [[nodiscard]] ArenaStats arenaStats() const;
+
+    // Page options of the activation arenas of contexts created from now on (the
+    // compiled and the specialized plans). Drops the current plans and contexts.
+    void setArenaPages(const inference_engine::memory::PageOptions& pages);
+
+    [[nodiscard]] Graph& graph() noexcept { return *graph_; }
+    [[nodiscard]] const Graph& graph() const noexcept { return *graph_; }
+
+    // Named weight tensors of the loaded file (empty for graphs built in memory).
+    [[nodiscard]] const ModelWeights& weights() const noexcept { return weights_; }
+    [[nodiscard]] const inference_engine::core::Tensor* findWeight(const std::string& name) const;
+    // The loaded file; empty when the weights were interned in a WeightStore.
+    [[nodiscard]] const inference_engine::core::MappedFile& mapping() const noexcept { return mapping_; }
 
 private:
+    // Declared first so it outlives the graph and weight views that point into it.
+    inference_engine::core::MappedFile mapping_{};
+    ModelWeights weights_{};
+    // Outlives the graph too: prepacked operators view its blobs.
+    std::string weight_cache_dir_{};
+    std::unique_ptr<PackedWeightCache> weight_cache_{};
+    WeightStore* weight_store_ = nullptr;
     std::unique_ptr<Graph> graph_;
+
+    // Options of the shared plan. Caller holds mu_.
+    [[nodiscard]] CompileOptions planOptions() const;
+    // Sums the per-thread context arenas. Caller holds mu_.
+    [[nodiscard]] ArenaStats arenaStatsLocked() const;
+    // Updates the arena high-water mark after a context was added. Caller holds mu_.
+    void noteArenaUsage();
+
+    MetricsRegistry* metrics_ = nullptr;
+    LatencyHistogram* latency_ = nullptr;
+
+    mutable std::mutex mu_;
+    std::size_t arena_peak_bytes_ = 0;
+    std::unique_ptr<ExecutionPlan> plan_;
+    std::uint64_t plan_revision_ = 0;
+    std::unordered_map<std::thread::id, std::unique_ptr<ExecutionContext>> thread_contexts_;
+
+    // Specialized plans, and each thread's contexts for them (most recent first).
+    struct DynamicContext {
+        std::shared_ptr<const SpecializedPlan> plan;
+        std::unique_ptr<ExecutionContext> ctx;
+    };
+    inference_engine::core::Tensor inferDynamic(const inference_engine::core::Tensor& input);
+    PlanCacheOptions plan_cache_options_{};
+    inference_engine::memory::PageOptions arena_pages_{};
+    std::unique_ptr<PlanCache> plan_cache_;
+    std::unordered_map<std::thread::id, std::vector<DynamicContext>> dynamic_contexts_;
 };
 
 } // namespace infer
@@ -0,0 +1,78 @@
+#pragma once
+
+// Binary model format, version 2 (version 1 Values had no group quantization
+// fields; those files are rejected and need saving again).
+//
+//   [FileHeader, 64 bytes][metadata][padding][weight data]
+//
+// All integers are little-endian. The metadata section describes the graph: named
+// weight tensors (dtype, dims, byte range in the data section), the Values with
+// their quantization, the nodes (op type, activation, weight tensors, input and
+// output Values by index) and the graph inputs/outputs. The data section starts on
+// a kDataAlignment boundary and every tensor inside it on a kTensorAlignment
+// boundary, so once the file is mapped the weights are used in place with no copy
+// and no alignment fix-up.
+//
+// Supported operators: MatMulBias (FP32 weights and bias), MatMulBiasFp16 (FP16
+// weights, FP32 bias), MatMulBiasBlockQ (packed INT4/INT8 weights as UINT8, FP16
+// group scales, FP32 bias), MatMulBiasSparse (packed FP32 values with UINT8 N:M
+// indices or UINT32 block-CSR row pointers and columns, FP32 bias), ReLU and
+// Softmax.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "inference_engine/core/tensor.h"
+
+namespace inference_engine {
+namespace core {
+class MappedFile;
+} // namespace core
+} // namespace inference_engine
+
+namespace infer {
+
+class Graph;
+class WeightStore;
+
+namespace model_format {
+
+inline constexpr char kMagic[8] = {'I', 'E', 'M', 'O', 'D', 'E', 'L', '\0'};
+inline constexpr std::uint32_t kVersion = 2;
+// Page-sized so the weight section starts on its own page.
+inline constexpr std::size_t kDataAlignment = 4096;
+inline constexpr std::size_t kTensorAlignment = 64;
+
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t header_bytes;   // sizeof(FileHeader)
+    std::uint64_t metadata_offset;
+    std::uint64_t metadata_bytes;
+    std::uint64_t data_offset;    // multiple of kDataAlignment
+    std::uint64_t data_bytes;
+    std::uint64_t file_bytes;
+    std::uint64_t reserved;
+};
+static_assert(sizeof(FileHeader) == 64, "FileHeader layout is part of the file format");
+
+} // namespace model_format
+
+// Weight tensors of a loaded model by name. They are non-owning views into the
+// mapped file and stay valid while the mapping is alive, or own WeightStore blobs.
+using ModelWeights = std::unordered_map<std::string, inference_engine::core::Tensor>;
+
+// Serializes `graph` to `path`. Throws std::invalid_argument for operators the
+// format cannot represent and std::runtime_error on I/O failure.
+void saveModel(const Graph& graph, const std::string& path);
+
+// Rebuilds the graph stored in `file` into the empty `graph`, creating operators
+// whose weights point into the mapping. With a `store`, every weight tensor is
+// interned there instead, so the graph no longer needs the mapping once loaded.
+// Throws std::runtime_error for malformed or unsupported files.
+void readModel(const inference_engine::core::MappedFile& file, Graph& graph, ModelWeights& weights,
+               WeightStore* store = nullptr);
+
+} // namespace infer
@@ -5,6 +5,8 @@
  * Tensor shape representation and manipulation.
  * Provides shape operations including dimension access, broadcasting,
  * reshape validation, stride calculation, and utility functions.
+ * Dimensions are stored inline up to kMaxInlineRank, so shapes of typical rank
+ * are copied without heap allocation.
  */
 #include <vector>
 #include <stdexcept>
@@ -14,16 +16,23 @@
 #include <cstddef>
 #include <string>
 
+#include "inference_engine/core/small_vector.h"
+
 namespace inference_engine
 {
     namespace core
     {
+        // Ranks up to this are held without heap allocation.
+        constexpr std::size_t kMaxInlineRank = 8;
+        using DimVector = SmallVector<int64_t, kMaxInlineRank>;
+
         class Shape
         {
         public:
             Shape() = default;
-            explicit Shape(const std::vector<int64_t> &dims) : dimensions_(dims) {}
-            explicit Shape(std::vector<int64_t> &&dims) : dimensions_(std::move(dims)) {}
+            explicit Shape(const std::vector<int64_t> &dims) : dimensions_(dims.begin(), dims.end()) {}
+            explicit Shape(const DimVector &dims) : dimensions_(dims) {}
+            explicit Shape(DimVector &&dims) noexcept : dimensions_(std::move(dims)) {}
             Shape(std::initializer_list<int64_t> init) : dimensions_(init) {}
 
             template <typename Iter>
@@ -73,12 +82,12 @@ namespace inference_engine
                 return dimensions_.size();
             }
 
-            inline const std::vector<int64_t> &dims() const noexcept
+            inline const DimVector &dims() const noexcept
             {
                 return dimensions_;
             }
 
-            inline std::vector<int64_t> &dims_mut() noexcept
+            inline DimVector &dims_mut() noexcept
             {
                 return dimensions_;
             }
@@ -102,7 +111,7 @@ namespace inference_engine
              */
             Shape squeeze(int axis = -1) const
             {
-                std::vector<int64_t> result;
+                DimVector result;
 
                 if (axis == -1)
                 {
@@ -138,7 +147,7 @@ namespace inference_engine
                         }
                     }
                 }
-                return Shape(result);
+                return Shape(std::move(result));
             }
             /*
              * Unsqueeze: Add a dimension of size 1 at specified axis
@@ -146,7 +155,7 @@ namespace inference_engine
              */
             Shape unsqueeze(int axis) const
             {
-                std::vector<int64_t> result = dimensions_;
+                DimVector result = dimensions_;
 
                 if (axis < 0)
                 {
@@ -158,7 +167,7 @@ namespace inference_engine
                 }
 
                 result.insert(result.begin() + axis, 1);
-                return Shape(result);
+                return Shape(std::move(result));
             }
 
             /*
@@ -183,14 +192,14 @@ namespace inference_engine
              */
             static Shape broadcast(const Shape &shape1, const Shape &shape2)
             {
-                const std::vector<int64_t> &dims1 = shape1.dims();
-                const std::vector<int64_t> &dims2 = shape2.dims();
+                const DimVector &dims1 = shape1.dims();
+                const DimVector &dims2 = shape2.dims();
 
                 std::size_t rank1 = dims1.size();
                 std::size_t rank2 = dims2.size();
                 std::size_t result_rank = std::max(rank1, rank2);
 
-                std::vector<int64_t> result(result_rank);
+                DimVector result(result_rank);
 
                 // Align dimensions from the right
                 int offset1 = result_rank - rank1;
@@ -209,7 +218,7 @@ namespace inference_engine
                     result[i] = std::max(dim1, dim2);
                 }
 
-                return Shape(result);
+                return Shape(std::move(result));
             }
 
             Shape broadcast_with(const Shape &other) const
@@ -221,14 +230,14 @@ namespace inference_engine
              * For a shape [2, 3, 4], strides are [12, 4, 1]
              * Strides[i] = product of all dimensions after dimension i
              */
-            std::vector<int64_t> strides() const noexcept
+            DimVector strides() const
             {
                 if (dimensions_.empty())
                 {
                     return {};
                 }
 
-                std::vector<int64_t> result(dimensions_.size());
+                DimVector result(dimensions_.size());
                 int64_t stride = 1;
 
                 // Calculate strides from right to left (C-order)
@@ -263,7 +272,7 @@ namespace inference_engine
             }
 
         private:
-            std::vector<int64_t> dimensions_;
+            DimVector dimensions_;
         };
 
         // Helper utilities (implemented in shape.cpp)
@@ -0,0 +1,234 @@
+#ifndef INFERENCE_ENGINE_CORE_SMALL_VECTOR_H_
+#define INFERENCE_ENGINE_CORE_SMALL_VECTOR_H_
+
+/*
+ * Vector with inline storage for up to N elements.
+ * Holds trivially copyable values (dimensions, strides) in the object itself and
+ * only spills to the heap past N elements, so copying a small one never allocates.
+ * Supports the subset of the std::vector interface the engine uses.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace inference_engine {
+namespace core {
+
+    template <typename T, std::size_t N>
+    class SmallVector {
+        static_assert(std::is_trivially_copyable<T>::value, "SmallVector holds trivially copyable values");
+        static_assert(N > 0, "SmallVector needs inline capacity");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        static constexpr size_type inline_capacity = N;
+
+        // ==================== Construction ====================
+
+        SmallVector() noexcept = default;
+
+        explicit SmallVector(size_type count, const T& value = T()) { assign(count, value); }
+
+        SmallVector(std::initializer_list<T> init) { assign(init.begin(), init.end()); }
+
+        template <typename Iter,
+                  typename = typename std::iterator_traits<Iter>::iterator_category>
+        SmallVector(Iter first, Iter last) {
+            assign(first, last);
+        }
+
+        explicit SmallVector(const std::vector<T>& values) { assign(values.begin(), values.end()); }
+
+        SmallVector(const SmallVector& other) { assign(other.begin(), other.end()); }
+
+        SmallVector(SmallVector&& other) noexcept { steal(other); }
+
+        SmallVector& operator=(const SmallVector& other) {
+            if (this != &other) {
+                assign(other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        SmallVector& operator=(SmallVector&& other) noexcept {
+            if (this != &other) {
+                release();
+                steal(other);
+            }
+            return *this;
+        }
+
+        SmallVector& operator=(std::initializer_list<T> init) {
+            assign(init.begin(), init.end());
+            return *this;
+        }
+
+        ~SmallVector() noexcept { release(); }
+
+        // ==================== Element access ====================
+
+        T* data() noexcept { return heap_ ? heap_ : inline_; }
+        const T* data() const noexcept { return heap_ ? heap_ : inline_; }
+
+        T& operator[](size_type index) noexcept { return data()[index]; }
+        const T& operator[](size_type index) const noexcept { return data()[index]; }
+
+        const T& at(size_type index) const {
+            if (index >= size_) {
+                throw std::out_of_range("SmallVector index out of range");
+            }
+            return data()[index];
+        }
+
+        T& front() noexcept { return data()[0]; }
+        const T& front() const noexcept { return data()[0]; }
+        T& back() noexcept { return data()[size_ - 1]; }
+        const T& back() const noexcept { return data()[size_ - 1]; }
+
+        iterator begin() noexcept { return data(); }
+        const_iterator begin() const noexcept { return data(); }
+        iterator end() noexcept { return data() + size_; }
+        const_iterator end() const noexcept { return data() + size_; }
+
+        // ==================== Capacity ====================
+
+        size_type size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        size_type capacity() const noexcept { return capacity_; }
+        // True while the elements live in the object (no heap storage).
+        bool is_inline() const noexcept { return heap_ == nullptr; }
+
+        void reserve(size_type count) {
+            if (count > capacity_) {
+                grow_to(count);
+            }
+        }
+
+        // ==================== Modifiers ====================
+
+        void clear() noexcept { size_ = 0; }
+
+        void assign(size_type count, const T& value) {
+            size_ = 0;
+            reserve(count);
+            std::fill_n(data(), count, value);
+            size_ = count;
+        }
+
+        template <typename Iter,
+                  typename = typename std::iterator_traits<Iter>::iterator_category>
+        void assign(Iter first, Iter last) {
+            size_ = 0;
+            reserve(static_cast<size_type>(std::distance(first, last)));
+            for (; first != last; ++first) {
+                data()[size_++] = *first;
+            }
+        }
+
+        void push_back(const T& value) {
+            if (size_ == capacity_) {
+                const T copy = value; // `value` may live in this vector
+                grow_to(capacity_ * 2);
+                data()[size_++] = copy;
+                return;
+            }
+            data()[size_++] = value;
+        }
+
+        void pop_back() noexcept { --size_; }
+
+        void resize(size_type count, const T& value = T()) {
+            reserve(count);
+            if (count > size_) {
+                std::fill(data() + size_, data() + count, value);
+            }
+            size_ = count;
+        }
+
+        iterator insert(const_iterator pos, const T& value) {
+            const size_type index = static_cast<size_type>(pos - begin());
+            const T copy = value;
+            reserve(size_ + 1);
+            T* p = data();
+            std::memmove(p + index + 1, p + index, (size_ - index) * sizeof(T));
+            p[index] = copy;
+            ++size_;
+            return p + index;
+        }
+
+        iterator erase(const_iterator pos) noexcept { return erase(pos, pos + 1); }
+
+        iterator erase(const_iterator first, const_iterator last) noexcept {
+            T* p = data();
+            const size_type index = static_cast<size_type>(first - p);
+            const size_type count = static_cast<size_type>(last - first);
+            std::memmove(p + index, p + index + count, (size_ - index - count) * sizeof(T));
+            size_ -= count;
+            return p + index;
+        }
+
+        std::vector<T> to_vector() const { return std::vector<T>(begin(), end()); }
+
+        // ==================== Comparison ====================
+
+        friend bool operator==(const SmallVector& a, const SmallVector& b) noexcept {
+            return a.size_ == b.size_ && std::equal(a.begin(), a.end(), b.begin());
+        }
+
+        friend bool operator!=(const SmallVector& a, const SmallVector& b) noexcept { return !(a == b); }
+
+    private:
+        void grow_to(size_type count) {
+            const size_type capacity = std::max(count, capacity_ * 2);
+            T* storage = new T[capacity];
+            std::copy(begin(), end(), storage);
+            delete[] heap_;
+            heap_ = storage;
+            capacity_ = capacity;
+        }
+
+        void release() noexcept {
+            delete[] heap_;
+            heap_ = nullptr;
+            capacity_ = N;
+            size_ = 0;
+        }
+
+        // Requires this vector to be released.
+        void steal(SmallVector& other) noexcept {
+            size_ = other.size_;
+            if (other.heap_) {
+                heap_ = other.heap_;
+                capacity_ = other.capacity_;
+                other.heap_ = nullptr;
+                other.capacity_ = N;
+            } else {
+                std::copy(other.inline_, other.inline_ + other.size_, inline_);
+            }
+            other.size_ = 0;
+        }
+
+        T* heap_ = nullptr;
+        size_type size_ = 0;
+        size_type capacity_ = N;
+        T inline_[N];
+    };
+
+} // namespace core
+} // namespace inference_engine
+
+#endif // INFERENCE_ENGINE_CORE_SMALL_VECTOR_H_
@@ -0,0 +1,70 @@
+#ifndef INFERENCE_ENGINE_CORE_STORAGE_H_
+#define INFERENCE_ENGINE_CORE_STORAGE_H_
+
+/*
+ * Reference-counted backing memory for tensors.
+ * A Storage owns one block (pointer + size) and knows how to release it; tensors
+ * share it through std::shared_ptr, so the block lives exactly as long as some
+ * tensor or view still refers to it.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace inference_engine {
+namespace core {
+
+    class Allocator;  // Forward declaration
+
+    class Storage {
+    public:
+        /*
+         * Allocate `size_bytes` from `allocator` (operator new[] when null).
+         * The allocator must outlive the storage. Throws std::bad_alloc.
+         */
+        static std::shared_ptr<Storage> allocate(std::size_t size_bytes, Allocator* allocator = nullptr);
+
+        /*
+         * Take ownership of an existing block, released through `allocator`
+         * (delete[] of uint8_t when null).
+         */
+        static std::shared_ptr<Storage> adopt(void* data, std::size_t size_bytes, Allocator* allocator = nullptr);
+
+        /*
+         * Take ownership of an allocator together with a block it handed out; both are
+         * released with the storage. Used for plan arenas whose tensors outlive a run.
+         */
+        static std::shared_ptr<Storage> adopt(std::unique_ptr<Allocator> owner, void* data, std::size_t size_bytes);
+
+        ~Storage() noexcept;
+
+        Storage(const Storage&) = delete;
+        Storage& operator=(const Storage&) = delete;
+
+        void* data() const noexcept { return data_; }
+        std::size_t size() const noexcept { return size_; }
+        Allocator* allocator() const noexcept { return allocator_; }
+
+        /*
+         * Check whether [ptr, ptr + size_bytes) lies inside this block.
+         */
+        bool contains(const void* ptr, std::size_t size_bytes = 0) const noexcept {
+            const auto p = reinterpret_cast<std::uintptr_t>(ptr);
+            const auto base = reinterpret_cast<std::uintptr_t>(data_);
+            return data_ != nullptr && p >= base && p - base <= size_ && size_bytes <= size_ - (p - base);
+        }
+
+    private:
+        Storage(void* data, std::size_t size_bytes, Allocator* allocator) noexcept;
+
+        void* data_ = nullptr;
+        std::size_t size_ = 0;
+        Allocator* allocator_ = nullptr;         // Releases data_ (nullptr: delete[])
+        std::unique_ptr<Allocator> owner_;       // Set when the storage owns allocator_
+    };
+
+} // namespace core
+} // namespace inference_engine
+
+#endif // INFERENCE_ENGINE_CORE_STORAGE_H_
@@ -18,6 +18,7 @@
 #include "inference_engine/core/shape.h"
 #include "inference_engine/core/dtype.h"
 #include "inference_engine/core/common.h"
+#include "inference_engine/core/storage.h"
 
 namespace inference_engine {
 namespace core {
@@ -46,7 +47,7 @@ namespace core {
      * Supports:
      * - Metadata (shape, dtype, strides)
      * - Typed and void pointer access to data
-     * - Memory ownership tracking
+     * - Shared, reference-counted ownership of the backing Storage
      * - Quantization parameters for INT8/UINT8
      * - View creation (slicing, reshaping without copy)
      * - Contiguity checks
@@ -66,105 +67,101 @@ namespace core {
          * Does not allocate memory - useful for specifying tensor metadata.
          */
         Tensor(const Shape& shape, DataType dtype) noexcept
-            : shape_(shape), dtype_(dtype), data_(nullptr), owns_data_(false) {
+            : shape_(shape), dtype_(dtype), data_(nullptr) {
             compute_strides();
         }
 
         Tensor(Shape&& shape, DataType dtype) noexcept
-            : shape_(std::move(shape)), dtype_(dtype), data_(nullptr), owns_data_(false) {
+            : shape_(std::move(shape)), dtype_(dtype), data_(nullptr) {
             compute_strides();
         }
 
         /*
          * Create a tensor with allocated data from the provided allocator.
-         * Takes ownership of the allocated memory.
+         * The memory is held in a new Storage and returned to the allocator once the
+         * last tensor sharing it is gone, so the allocator must outlive them.
          */
         Tensor(const Shape& shape, DataType dtype, Allocator* allocator);
         Tensor(Shape&& shape, DataType dtype, Allocator* allocator);
 
         /*
          * Create a tensor that wraps externally-managed memory.
-         * does not take ownership - caller manages lifetime.
+         * Does not take ownership unless `owns_data` is set, in which case the
+         * buffer (allocated with new[]) is adopted into a Storage.
          */
-        Tensor(const Shape& shape, DataType dtype, void* data, bool owns_data = false) noexcept
-            : shape_(shape), dtype_(dtype), data_(data), owns_data_(owns_data) {
+        Tensor(const Shape& shape, DataType dtype, void* data, bool owns_data = false)
+            : shape_(shape), dtype_(dtype), data_(data) {
             compute_strides();
+            adopt_data(owns_data);
         }
 
-        Tensor(Shape&& shape, DataType dtype, void* data, bool owns_data = false) noexcept
-            : shape_(std::move(shape)), dtype_(dtype), data_(data), owns_data_(owns_data) {
+        Tensor(Shape&& shape, DataType dtype, void* data, bool owns_data = false)
+            : shape_(std::move(shape)), dtype_(dtype), data_(data) {
             compute_strides();
+            adopt_data(owns_data);
         }
 
         /*
          * Create a tensor with quantization parameters (for INT8/UINT8).
          */
         Tensor(const Shape& shape, DataType dtype, void* data, 
-               const QuantParams& quant_params, bool owns_data = false) noexcept
-            : shape_(shape), dtype_(dtype), data_(data), owns_data_(owns_data),
-              quant_params_(quant_params) {
+               const QuantParams& quant_params, bool owns_data = false)
+            : shape_(shape), dtype_(dtype), data_(data), quant_params_(quant_params) {
             compute_strides();
+            adopt_data(owns_data);
         }
 
         Tensor(Shape&& shape, DataType dtype, void* data,
-               const QuantParams& quant_params, bool owns_data = false) noexcept
-            : shape_(std::move(shape)), dtype_(dtype), data_(data), owns_data_(owns_data),
-              quant_params_(quant_params) {
+               const QuantParams& quant_params, bool owns_data = false)
+            : shape_(std::move(shape)), dtype_(dtype), data_(data), quant_params_(quant_params) {
+            compute_strides();
+            adopt_data(owns_data);
+        }
+
+        /*
+         * Create a contiguous view `byte_offset` bytes into a shared Storage.
+         * The tensor keeps the storage alive for as long as it (or any copy or view
+         * of it) exists.
+         */
+        Tensor(const Shape& shape, DataType dtype, std::shared_ptr<Storage> storage,
+               std::size_t byte_offset = 0) noexcept
+            : shape_(shape), dtype_(dtype),
+              data_(storage ? static_cast<uint8_t*>(storage->data()) + byte_offset : nullptr),
+              storage_(std::move(storage)) {
             compute_strides();
         }
 
         // ==================== Destructor ====================
-        ~Tensor() noexcept;
+        ~Tensor() noexcept = default;
 
         // ==================== Copy semantics ====================
         
         /*
-         * Shallow copy: shares data pointer, does not take ownership.
-         * The copied tensor does not own the data.
+         * Shallow copy: shares the data pointer and, for owned data, the Storage.
+         * Copying an owning tensor only bumps the storage reference count.
          */
-        Tensor(const Tensor& other) noexcept
-            : shape_(other.shape_), dtype_(other.dtype_), data_(other.data_),
-              owns_data_(false), strides_(other.strides_), quant_params_(other.quant_params_) {}
-
-        Tensor& operator=(const Tensor& other) noexcept {
-            if (this != &other) {
-                if (owns_data_ && data_) {
-                    deallocate();
-                }
-                shape_ = other.shape_;
-                dtype_ = other.dtype_;
-                data_ = other.data_;
-                owns_data_ = false;
-                strides_ = other.strides_;
-                quant_params_ = other.quant_params_;
-            }
-            return *this;
-        }
+        Tensor(const Tensor& other) = default;
+        Tensor& operator=(const Tensor& other) = default;
 
         // ==================== Move semantics ====================
         
         Tensor(Tensor&& other) noexcept
-            : shape_(std::move(other.shape_)), dtype_(other.dtype_), 
-              data_(other.data_), owns_data_(other.owns_data_), 
-              strides_(std::move(other.strides_)), quant_params_(other.quant_params_) {
+            : shape_(std::move(other.shape_)), dtype_(other.dtype_), data_(other.data_),
+              storage_(std::move(other.storage_)), strides_(std::move(other.strides_)),
+              quant_params_(other.quant_params_) {
             other.data_ = nullptr;
-            other.owns_data_ = false;
         }
 
         Tensor& operator=(Tensor&& other) noexcept {
             if (this != &other) {
-                if (owns_data_ && data_) {
-                    deallocate();
-                }
                 shape_ = std::move(other.shape_);
                 dtype_ = other.dtype_;
                 data_ = other.data_;
-                owns_data_ = other.owns_data_;
+                storage_ = std::move(other.storage_);
                 strides_ = std::move(other.strides_);
                 quant_params_ = other.quant_params_;
                 
                 other.data_ = nullptr;
-                other.owns_data_ = false;
             }
             return *this;
         }
@@ -176,7 +173,7 @@ namespace core {
         
         int64_t dim(std::size_t index) const noexcept { return shape_.dim(index); }
         std::size_t rank() const noexcept { return shape_.rank(); }
-        const std::vector<int64_t>& dims() const noexcept { return shape_.dims(); }
+        const DimVector& dims() const noexcept { return shape_.dims(); }
 
         // ==================== Data type accessors ====================
         
@@ -223,10 +220,10 @@ namespace core {
         }
 
         /*
-         * Set the data pointer and optionally take ownership.
-         * Deallocates previous data if owned.
+         * Set the data pointer and optionally take ownership (of a new[] buffer).
+         * Drops this tensor's reference to its previous Storage.
          */
-        void set_data(void* new_data, bool take_ownership = false) noexcept;
+        void set_data(void* new_data, bool take_ownership = false);
 
         // ==================== Size calculations ====================
         
@@ -250,9 +247,22 @@ namespace core {
         // ==================== Memory properties ====================
         
         /*
-         * Check if this tensor owns its data.
+         * Check if this tensor holds a reference to the Storage behind its data
+         * (owning tensors and their copies and views do).
+         */
+        bool owns_data() const noexcept { return storage_ != nullptr; }
+
+        /*
+         * Shared Storage behind the data, or nullptr for borrowed memory.
          */
-        bool owns_data() const noexcept { return owns_data_; }
+        const std::shared_ptr<Storage>& storage() const noexcept { return storage_; }
+
+        /*
+         * Make this tensor (a view whose bytes lie inside `storage`) share that
+         * Storage, so it stays valid for as long as the tensor is held.
+         * Throws std::invalid_argument if the data is outside the storage.
+         */
+        void share_storage(std::shared_ptr<Storage> storage);
 
         /*
          * Check if tensor data is contiguous in memory.
@@ -262,7 +272,7 @@ namespace core {
         /*
          * Get stride (offset in bytes) for each dimension.
          */
-        const std::vector<int64_t>& strides() const noexcept { return strides_; }
+        const DimVector& strides() const noexcept { return strides_; }
         int64_t stride(std::size_t axis) const noexcept { 
             return axis < strides_.size() ? strides_[axis] : 0; 
         }
@@ -298,15 +308,14 @@ namespace core {
         /*
          * Create a slice view of this tensor without copying data.
          * Returns a new Tensor with modified shape and strides pointing to the same data.
-         * Does NOT take ownership of the data.
+         * Views share the Storage of owning tensors and so keep it alive.
          */
         Tensor slice(const std::vector<std::pair<int64_t, int64_t>>& ranges) const;
 
         /*
          * Reshape without copying data (view operation).
          * Only valid if the tensor is contiguous and the new shape has the same num_elements.
-         * Returns a new Tensor with the new shape but same data pointer.
-         * Does NOT take ownership.
+         * Returns a new Tensor with the new shape but same data pointer and Storage.
          */
         Tensor reshape(const Shape& new_shape) const;
 
@@ -317,10 +326,34 @@ namespace core {
          */
         Tensor transpose(const std::vector<int>& axes) const;
 
+        /*
+         * Deep copy into a new owning, contiguous tensor (same shape, dtype and
+         * quantization parameters). Only valid for contiguous tensors.
+         */
+        Tensor clone() const;
+
+        /*
+         * Copy the elements into `dst`, which must have the same shape and dtype;
+         * either side may be a strided view. Runs on the strided-copy engine
+         * (kernels/strided_copy.h): mergeable dimensions collapse, contiguous runs
+         * become memcpy and permutations use blocked transpose kernels; large copies
+         * are split across ThreadPool::current(). Throws std::invalid_argument on a
+         * shape/dtype mismatch and std::runtime_error if either side has no data.
+         */
+        void copy_into(Tensor& dst) const;
+
+        /*
+         * This tensor when it is already contiguous (a shallow copy), otherwise a new
+         * owning, contiguous copy of the view (e.g. to materialize a transpose).
+         */
+        Tensor contiguous() const;
+
         // ==================== Memory management ====================
         
         /*
-         * Deallocate owned data. Does nothing if data is not owned.
+         * Drop this tensor's reference to its Storage and clear the data pointer.
+         * The memory is freed once no other tensor shares it. Does nothing if data
+         * is not owned.
          */
         void deallocate() noexcept;
 
@@ -352,16 +385,15 @@ namespace core {
     private:
         Shape shape_;                          // Multi-dimensional shape
         DataType dtype_ = DataType::UNKNOWN;   // Data type
-        void* data_ = nullptr;                 // Pointer to data buffer
-        bool owns_data_ = false;               // Whether we manage this memory
-        std::vector<int64_t> strides_;         // Strides for each dimension (in bytes)
+        void* data_ = nullptr;                 // Pointer to data buffer (may be inside storage_)
+        std::shared_ptr<Storage> storage_;     // Shared owner of data_, nullptr when borrowed
+        DimVector strides_;                    // Strides for each dimension (in bytes)
         QuantParams quant_params_;             // Quantization parameters for INT8/UINT8
 
         /*
-         * Deallocate data using the original allocator (if available).
-         * Falls back to delete[] if allocator is not available.
+         * Adopt data_ (a new[] buffer of byte_size() bytes) into a Storage when `owns`.
          */
-        void deallocate_internal() noexcept;
+        void adopt_data(bool owns);
     };
 
     // ==================== Helper functions ====================
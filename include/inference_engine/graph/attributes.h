@@ -5,14 +5,43 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <utility>
 #include <variant>
 #include <vector>
 
 namespace infer {
 
+// Interned attribute name: a process-wide integer symbol standing for a string, so
+// attribute lookups compare integers instead of hashing strings. Constructing one
+// from a string interns it (thread-safe; the same name always yields the same id),
+// which is why string keys keep working everywhere an AttrKey is expected. Code on
+// a hot path uses the predefined attr_names keys, or interns once into a static.
+class AttrKey {
+public:
+	AttrKey(std::string_view name);
+	AttrKey(const char* name) : AttrKey(std::string_view(name == nullptr ? "" : name)) {}
+	AttrKey(const std::string& name) : AttrKey(std::string_view(name)) {}
+
+	// The key with a given id; only ids handed out by the interner are meaningful.
+	[[nodiscard]] static constexpr AttrKey fromId(std::uint32_t id) noexcept { return AttrKey(id, 0); }
+
+	[[nodiscard]] constexpr std::uint32_t id() const noexcept { return id_; }
+	[[nodiscard]] const std::string& name() const;
+
+	friend constexpr bool operator==(AttrKey a, AttrKey b) noexcept { return a.id_ == b.id_; }
+	friend constexpr bool operator!=(AttrKey a, AttrKey b) noexcept { return a.id_ != b.id_; }
+
+private:
+	constexpr AttrKey(std::uint32_t id, int) noexcept : id_(id) {}
+
+	std::uint32_t id_;
+};
+
 // Operation attribute storage (compile-time parameters).
-// Supported types: int, float, string and arrays of these.
+// Supported types: int, float, string and arrays of these. Entries are kept in
+// insertion order in a flat array keyed by AttrKey: maps hold a handful of entries,
+// so a linear scan over integer ids beats any hashing.
 class AttributeMap {
 public:
 	using Int = std::int64_t;
@@ -23,67 +52,68 @@ public:
 	using Strings = std::vector<String>;
 
 	using Attribute = std::variant<Int, Float, String, Ints, Floats, Strings>;
+	using Entry = std::pair<AttrKey, Attribute>;
 
 	AttributeMap() = default;
 	~AttributeMap() = default;
 
-	[[nodiscard]] bool has(const std::string& key) const noexcept;
-	void erase(const std::string& key);
+	[[nodiscard]] bool has(AttrKey key) const noexcept;
+	void erase(AttrKey key);
 	void clear() noexcept;
 	[[nodiscard]] std::size_t size() const noexcept;
 	[[nodiscard]] bool empty() const noexcept;
 
-	// Raw access for advanced use-cases (debugging/inspection).
-	[[nodiscard]] const std::unordered_map<std::string, Attribute>& raw() const noexcept;
+	// Raw access for advanced use-cases (debugging/inspection), in insertion order.
+	[[nodiscard]] const std::vector<Entry>& raw() const noexcept;
 
 	// Type-safe setters.
-	void set(const std::string& key, Int value);
-	void set(const std::string& key, Float value);
-	void set(const std::string& key, const String& value);
-	void set(const std::string& key, String&& value);
-	void set(const std::string& key, const char* value);
-	void set(const std::string& key, const Ints& value);
-	void set(const std::string& key, Ints&& value);
-	void set(const std::string& key, const Floats& value);
-	void set(const std::string& key, Floats&& value);
-	void set(const std::string& key, const Strings& value);
-	void set(const std::string& key, Strings&& value);
+	void set(AttrKey key, Int value);
+	void set(AttrKey key, Float value);
+	void set(AttrKey key, const String& value);
+	void set(AttrKey key, String&& value);
+	void set(AttrKey key, const char* value);
+	void set(AttrKey key, const Ints& value);
+	void set(AttrKey key, Ints&& value);
+	void set(AttrKey key, const Floats& value);
+	void set(AttrKey key, Floats&& value);
+	void set(AttrKey key, const Strings& value);
+	void set(AttrKey key, Strings&& value);
 
 	// Convenience overloads to avoid ambiguity with numeric literals.
 	template <typename T,
 			  typename std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool> &&
 											!std::is_same_v<T, Int>,
 										int> = 0>
-	void set(const std::string& key, T value) {
+	void set(AttrKey key, T value) {
 		set(key, static_cast<Int>(value));
 	}
 
 	template <typename T,
 			  typename std::enable_if_t<std::is_floating_point_v<T> && !std::is_same_v<T, Float>, int> = 0>
-	void set(const std::string& key, T value) {
+	void set(AttrKey key, T value) {
 		set(key, static_cast<Float>(value));
 	}
 
 	// Convenience setter: integral -> Int, floating-point -> Float.
 	template <typename T>
-	void setNumeric(const std::string& key, T value);
+	void setNumeric(AttrKey key, T value);
 
 	// Type-safe getters (throws on missing key or type mismatch).
 	template <typename T>
-	[[nodiscard]] const T& get(const std::string& key) const;
+	[[nodiscard]] const T& get(AttrKey key) const;
 
 	template <typename T>
-	[[nodiscard]] T& get(const std::string& key);
+	[[nodiscard]] T& get(AttrKey key);
 
 	// Non-throwing typed lookup.
 	template <typename T>
-	[[nodiscard]] const T* tryGetPtr(const std::string& key) const noexcept;
+	[[nodiscard]] const T* tryGetPtr(AttrKey key) const noexcept;
 
 	template <typename T>
-	[[nodiscard]] T* tryGetPtr(const std::string& key) noexcept;
+	[[nodiscard]] T* tryGetPtr(AttrKey key) noexcept;
 
 	template <typename T>
-	[[nodiscard]] std::optional<T> tryGetCopy(const std::string& key) const;
+	[[nodiscard]] std::optional<T> tryGetCopy(AttrKey key) const;
 
 	// Serialization helpers for debugging.
 	[[nodiscard]] std::string toString() const;
@@ -91,26 +121,35 @@ public:
 	[[nodiscard]] static const char* attributeTypeName(const Attribute& attr) noexcept;
 
 private:
-	std::unordered_map<std::string, Attribute> attrs_;
+	[[nodiscard]] const Attribute* find(AttrKey key) const noexcept;
+	[[nodiscard]] Attribute* find(AttrKey key) noexcept;
+	[[nodiscard]] Attribute& slot(AttrKey key);
+
+	std::vector<Entry> attrs_;
 };
 
-// Common attribute names.
+// Common attribute names. The interner is seeded with kPredefined in this order,
+// so these keys are compile-time constants: kPredefined[i] has id i.
 namespace attr_names {
-inline constexpr const char* kAxis = "axis";
-inline constexpr const char* kAxes = "axes";
-inline constexpr const char* kAlpha = "alpha";
-inline constexpr const char* kBeta = "beta";
-inline constexpr const char* kGamma = "gamma";
-inline constexpr const char* kEpsilon = "epsilon";
-inline constexpr const char* kKeepDims = "keepdims";
-inline constexpr const char* kPerm = "perm";
-inline constexpr const char* kTransA = "transA";
-inline constexpr const char* kTransB = "transB";
-inline constexpr const char* kStrides = "strides";
-inline constexpr const char* kPads = "pads";
-inline constexpr const char* kDilations = "dilations";
-inline constexpr const char* kKernelShape = "kernel_shape";
-inline constexpr const char* kGroup = "group";
+inline constexpr const char* kPredefined[] = {
+	"axis", "axes", "alpha", "beta", "gamma", "epsilon", "keepdims", "perm",
+	"transA", "transB", "strides", "pads", "dilations", "kernel_shape", "group",
+};
+inline constexpr AttrKey kAxis = AttrKey::fromId(0);
+inline constexpr AttrKey kAxes = AttrKey::fromId(1);
+inline constexpr AttrKey kAlpha = AttrKey::fromId(2);
+inline constexpr AttrKey kBeta = AttrKey::fromId(3);
+inline constexpr AttrKey kGamma = AttrKey::fromId(4);
+inline constexpr AttrKey kEpsilon = AttrKey::fromId(5);
+inline constexpr AttrKey kKeepDims = AttrKey::fromId(6);
+inline constexpr AttrKey kPerm = AttrKey::fromId(7);
+inline constexpr AttrKey kTransA = AttrKey::fromId(8);
+inline constexpr AttrKey kTransB = AttrKey::fromId(9);
+inline constexpr AttrKey kStrides = AttrKey::fromId(10);
+inline constexpr AttrKey kPads = AttrKey::fromId(11);
+inline constexpr AttrKey kDilations = AttrKey::fromId(12);
+inline constexpr AttrKey kKernelShape = AttrKey::fromId(13);
+inline constexpr AttrKey kGroup = AttrKey::fromId(14);
 } // namespace attr_names
 
 /* -------------------- Template implementations -------------------- */
@@ -134,7 +173,7 @@ struct is_supported_attribute_type<AttributeMap::Strings> : std::true_type {};
 } // namespace detail
 
 template <typename T>
-void AttributeMap::setNumeric(const std::string& key, T value) {
+void AttributeMap::setNumeric(AttrKey key, T value) {
 	if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
 		set(key, static_cast<Int>(value));
 	} else if constexpr (std::is_floating_point_v<T>) {
@@ -145,63 +184,57 @@ void AttributeMap::setNumeric(const std::string& key, T value) {
 }
 
 template <typename T>
-const T& AttributeMap::get(const std::string& key) const {
+const T& AttributeMap::get(AttrKey key) const {
 	static_assert(detail::is_supported_attribute_type<T>::value,
 				  "Unsupported AttributeMap::get<T> type");
-	const auto it = attrs_.find(key);
-	if (it == attrs_.end()) {
-		throw std::out_of_range("AttributeMap::get: missing key '" + key + "'");
+	const Attribute* attr = find(key);
+	if (attr == nullptr) {
+		throw std::out_of_range("AttributeMap::get: missing key '" + key.name() + "'");
 	}
-	const T* ptr = std::get_if<T>(&it->second);
+	const T* ptr = std::get_if<T>(attr);
 	if (ptr == nullptr) {
 		throw std::invalid_argument(
-			"AttributeMap::get: type mismatch for key '" + key + "' (stored=" +
-			std::string(attributeTypeName(it->second)) + ")");
+			"AttributeMap::get: type mismatch for key '" + key.name() + "' (stored=" +
+			std::string(attributeTypeName(*attr)) + ")");
 	}
 	return *ptr;
 }
 
 template <typename T>
-T& AttributeMap::get(const std::string& key) {
+T& AttributeMap::get(AttrKey key) {
 	static_assert(detail::is_supported_attribute_type<T>::value,
 				  "Unsupported AttributeMap::get<T> type");
-	auto it = attrs_.find(key);
-	if (it == attrs_.end()) {
-		throw std::out_of_range("AttributeMap::get: missing key '" + key + "'");
+	Attribute* attr = find(key);
+	if (attr == nullptr) {
+		throw std::out_of_range("AttributeMap::get: missing key '" + key.name() + "'");
 	}
-	T* ptr = std::get_if<T>(&it->second);
+	T* ptr = std::get_if<T>(attr);
 	if (ptr == nullptr) {
 		throw std::invalid_argument(
-			"AttributeMap::get: type mismatch for key '" + key + "' (stored=" +
-			std::string(attributeTypeName(it->second)) + ")");
+			"AttributeMap::get: type mismatch for key '" + key.name() + "' (stored=" +
+			std::string(attributeTypeName(*attr)) + ")");
 	}
 	return *ptr;
 }
 
 template <typename T>
-const T* AttributeMap::tryGetPtr(const std::string& key) const noexcept {
+const T* AttributeMap::tryGetPtr(AttrKey key) const noexcept {
 	static_assert(detail::is_supported_attribute_type<T>::value,
 				  "Unsupported AttributeMap::tryGetPtr<T> type");
-	const auto it = attrs_.find(key);
-	if (it == attrs_.end()) {
-		return nullptr;
-	}
-	return std::get_if<T>(&it->second);
+	const Attribute* attr = find(key);
+	return attr != nullptr ? std::get_if<T>(attr) : nullptr;
 }
 
 template <typename T>
-T* AttributeMap::tryGetPtr(const std::string& key) noexcept {
+T* AttributeMap::tryGetPtr(AttrKey key) noexcept {
 	static_assert(detail::is_supported_attribute_type<T>::value,
 				  "Unsupported AttributeMap::tryGetPtr<T> type");
-	auto it = attrs_.find(key);
-	if (it == attrs_.end()) {
-		return nullptr;
-	}
-	return std::get_if<T>(&it->second);
+	Attribute* attr = find(key);
+	return attr != nullptr ? std::get_if<T>(attr) : nullptr;
 }
 
 template <typename T>
-std::optional<T> AttributeMap::tryGetCopy(const std::string& key) const {
+std::optional<T> AttributeMap::tryGetCopy(AttrKey key) const {
 	static_assert(detail::is_supported_attribute_type<T>::value,
 				  "Unsupported AttributeMap::tryGetCopy<T> type");
 	const T* ptr = tryGetPtr<T>(key);
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "inference_engine/core/dtype.h"
+#include "inference_engine/core/shape.h"
+#include "inference_engine/core/tensor.h"
+
+namespace infer {
+
+class Graph;
+class Value;
+
+// Post-training calibration of activation quantization.
+//
+//   CalibrationOptions options;
+//   options.method = CalibrationMethod::Entropy;
+//   const CalibrationReport report = calibrate(graph, samples, options);
+//   saveModel(graph, "model.calibrated.iem");   // Value quantization is serialized
+//
+// calibrate() runs the graph over every sample on the ThreadPool, observes each FP32
+// activation (graph inputs and every step output; not initializers), merges the
+// per-task observers and writes the derived QuantizationParams back with
+// Value::setQuantization. Histogram methods take a second pass over the samples with
+// the ranges of the first fixed, so per-task histograms merge exactly and the
+// result does not depend on the thread count or scheduling.
+
+enum class CalibrationMethod : std::uint8_t {
+    MinMax,     // observed min and max
+    Entropy,    // |x| clipped where the KL divergence of the quantized histogram is smallest
+    Percentile, // the given percentile of each tail
+};
+
+// Running min/max of a Value, per channel along `axis` (one channel when axis < 0).
+class MinMaxObserver {
+public:
+    MinMaxObserver() = default;
+    explicit MinMaxObserver(std::size_t channels);
+
+    // `data` is a dense row-major tensor of `shape`; its dim(axis) must equal channels().
+    void observe(const float* data, const inference_engine::core::Shape& shape, int axis);
+    // Folds in another observer of the same Value.
+    void merge(const MinMaxObserver& other);
+
+    [[nodiscard]] std::size_t channels() const noexcept { return min_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    [[nodiscard]] const std::vector<float>& min() const noexcept { return min_; }
+    [[nodiscard]] const std::vector<float>& max() const noexcept { return max_; }
+
+private:
+    std::vector<float> min_{};
+    std::vector<float> max_{};
+    std::uint64_t count_ = 0;
+};
+
+// Per-channel histograms over the fixed symmetric range [-limit[c], limit[c]] with an
+// even number of bins; values beyond the range land in the outermost bins.
+class HistogramObserver {
+public:
+    HistogramObserver() = default;
+    HistogramObserver(std::vector<float> limits, std::size_t bins);
+
+    void observe(const float* data, const inference_engine::core::Shape& shape, int axis);
+    // Adds the counts of an observer built with the same limits and bins.
+    void merge(const HistogramObserver& other);
+
+    [[nodiscard]] std::size_t channels() const noexcept { return limits_.size(); }
+    [[nodiscard]] std::size_t bins() const noexcept { return bins_; }
+    [[nodiscard]] const std::uint64_t* counts(std::size_t channel) const noexcept {
+        return counts_.data() + channel * bins_;
+    }
+
+    // Threshold t on |x| of channel c minimizing KL(P || Q), where P is the |x|
+    // histogram with everything beyond t folded into its last bin and Q is P
+    // requantized to `levels` bins (128 for 8-bit symmetric).
+    [[nodiscard]] float entropyThreshold(std::size_t channel, std::size_t levels) const;
+    // [lo, hi] holding all but (100 - percentile)% of channel c's values in each tail.
+    [[nodiscard]] std::pair<float, float> percentileRange(std::size_t channel, double percentile) const;
+
+private:
+    std::vector<float> limits_{};
+    std::size_t bins_ = 0;
+    std::vector<std::uint64_t> counts_{};
+};
+
+struct CalibrationOptions {
+    CalibrationMethod method = CalibrationMethod::MinMax;
+    // Quantize each activation per channel along `axis` (skipped for Values of lower
+    // rank), or per tensor.
+    bool per_channel = false;
+    int axis = 1;
+    inference_engine::core::DataType dtype = inference_engine::core::DataType::INT8;
+    // Asymmetric ranges need UINT8.
+    bool symmetric = true;
+    std::size_t bins = 2048;       // Entropy and Percentile histograms, per channel
+    std::size_t kl_levels = 128;   // Entropy
+    double percentile = 99.99;     // Percentile
+    // Workers of the ThreadPool created for the run; 0 runs on ThreadPool::current()
+    // (inline when there is none).
+    std::size_t threads = 0;
+};
+
+struct CalibrationReport {
+    struct Entry {
+        Value* value = nullptr;
+        // Observed range and the clipped range the parameters were derived from,
+        // one per channel.
+        std::vector<float> observed_min;
+        std::vector<float> observed_max;
+        std::vector<float> min;
+        std::vector<float> max;
+    };
+    std::vector<Entry> values;
+    std::size_t samples = 0;
+};
+
+// Each sample holds one tensor per graph input, matching its shape and dtype. The
+// graph is compiled for the run with CompileOptions::bind_memory off (prepacking its
+// weights as Model does), which releases the graph's own memory binding: plans that
+// run without an ExecutionContext must be recompiled afterwards. Throws
+// std::invalid_argument for an empty dataset, mismatched samples or inconsistent
+// options.
+CalibrationReport calibrate(Graph& graph, const std::vector<std::vector<inference_engine::core::Tensor>>& samples,
+                            const CalibrationOptions& options = {});
+
+// Parses "minmax", "entropy" (or "kl") and "percentile"; throws std::invalid_argument.
+[[nodiscard]] CalibrationMethod parseCalibrationMethod(const std::string& name);
+
+} // namespace infer
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/memory/pages.h"
+
+namespace inference_engine {
+namespace core {
+class ArenaAllocator;
+} // namespace core
+} // namespace inference_engine
+
+namespace infer {
+
+class ExecutionPlan;
+
+// Mutable state of one inference request against a compiled ExecutionPlan: its own
+// arena for the planned intermediates, the tensors bound to graph inputs, step
+// outputs and views, and operator scratch. The Graph, its weights and the plan stay
+// shared and read-only, so one compiled model serves N concurrent requests with N
+// contexts (each used by one run at a time).
+//
+// Operators keep reading Value::tensor(): while a Scope is active on a thread, the
+// Values the context tracks (graph inputs and everything a step produces) resolve
+// to this context. Initializers are shared and resolve to the graph as usual. The
+// Scope is per thread, so operators resolve their tensors before fanning work out
+// through parallelFor.
+class ExecutionContext {
+public:
+    // Allocates the arena sized by plan.memoryPlan(), mapped per its arena_pages (or
+    // `pages`). Throws std::bad_alloc.
+    explicit ExecutionContext(const ExecutionPlan& plan);
+    ExecutionContext(const ExecutionPlan& plan, const inference_engine::memory::PageOptions& pages);
+    ~ExecutionContext();
+
+    ExecutionContext(const ExecutionContext&) = delete;
+    ExecutionContext& operator=(const ExecutionContext&) = delete;
+
+    [[nodiscard]] const ExecutionPlan& plan() const noexcept { return plan_; }
+    [[nodiscard]] std::size_t arenaBytes() const noexcept { return arena_bytes_; }
+
+    [[nodiscard]] bool tracks(const Value* v) const noexcept {
+        const std::uint32_t slot = v->planSlot();
+        return slot < values_.size() && values_[slot] == v && tracked_[slot];
+    }
+    // Tensor currently bound to a tracked Value in this context (may be nullptr).
+    [[nodiscard]] inference_engine::core::Tensor* binding(const Value* v) const noexcept {
+        return bound_[v->planSlot()];
+    }
+    void bind(const Value* v, inference_engine::core::Tensor* t) noexcept { bound_[v->planSlot()] = t; }
+
+    // Per-request stand-in for an operator's private fallback buffer behind the
+    // tracked Value `out` (see ops_detail::bindOutputTensor). One slot per Value is
+    // allocated up front: each Value has one producing step, so the steps
+    // ParallelExecutor runs at once touch disjoint slots and nothing is inserted.
+    struct Scratch {
+        std::vector<float> buf;
+        inference_engine::core::Tensor tensor;
+    };
+    [[nodiscard]] Scratch& scratch(const Value* out) noexcept { return scratch_[out->planSlot()]; }
+
+    // Context installed on the calling thread, or nullptr.
+    [[nodiscard]] static ExecutionContext* current() noexcept;
+
+    // Installs `ctx` as ExecutionContext::current() for the calling thread.
+    class Scope {
+    public:
+        explicit Scope(ExecutionContext* ctx) noexcept;
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ExecutionContext* previous_;
+    };
+
+private:
+    friend class ExecutionPlan;
+
+    const ExecutionPlan& plan_;
+    std::size_t arena_bytes_ = 0;
+    std::unique_ptr<inference_engine::core::ArenaAllocator> arena_;
+
+    // Indexed by Value::planSlot().
+    const std::vector<Value*>& values_;
+    std::vector<bool> tracked_;
+    std::vector<inference_engine::core::Tensor> tensors_;
+    std::vector<inference_engine::core::Tensor*> bound_;
+    std::vector<Scratch> scratch_;
+};
+
+} // namespace infer
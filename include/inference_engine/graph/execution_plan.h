@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/graph.h"
+
+namespace infer {
+
+class ExecutionContext;
+class Node;
+class Operator;
+class Value;
+
+// Compiled, immutable schedule produced by Graph::compile().
+//
+// Validation, topological sorting and memory planning happen once at compile time;
+// run() only rebinds graph-input data pointers and calls each operator in order, so
+// the hot path performs no hashing, sorting or heap allocation.
+//
+// run(inputs, outputs) borrows the Graph's bound memory: the plan is invalidated by
+// any structural edit of the graph and by Graph::bindMemory()/releaseMemory(). The
+// ExecutionContext overloads keep all per-request state in the context instead, so
+// any number of threads may run one plan at once, each with its own context.
+class ExecutionPlan {
+public:
+    struct Step {
+        Node* node = nullptr;
+        Operator* op = nullptr;
+        // Steps consuming this step's outputs, and the number of steps this one waits on.
+        std::vector<std::uint32_t> successors{};
+        std::uint32_t num_predecessors = 0;
+    };
+
+    ~ExecutionPlan();
+
+    ExecutionPlan(const ExecutionPlan&) = delete;
+    ExecutionPlan& operator=(const ExecutionPlan&) = delete;
+    ExecutionPlan(ExecutionPlan&&) noexcept = delete;
+    ExecutionPlan& operator=(ExecutionPlan&&) noexcept = delete;
+
+    [[nodiscard]] const std::vector<Step>& steps() const noexcept { return steps_; }
+    [[nodiscard]] const MemoryPlan& memoryPlan() const noexcept { return memory_; }
+    [[nodiscard]] const std::vector<Value*>& inputs() const noexcept { return inputs_; }
+    [[nodiscard]] const std::vector<Value*>& outputs() const noexcept { return outputs_; }
+    // Every graph Value, indexed by Value::planSlot().
+    [[nodiscard]] const std::vector<Value*>& values() const noexcept { return values_; }
+
+    // Execute the plan. `inputs` must match the graph inputs in count, shape and dtype.
+    // `outputs` is resized to the number of graph outputs and filled with non-owning
+    // views of the output tensors (valid until the next run); reusing the same vector
+    // across calls avoids any allocation.
+    void run(const std::vector<inference_engine::core::Tensor>& inputs,
+             std::vector<inference_engine::core::Tensor>& outputs);
+
+    // The two halves of run() around step execution, for alternative executors.
+    void bindInputs(const std::vector<inference_engine::core::Tensor>& inputs);
+    void collectOutputs(std::vector<inference_engine::core::Tensor>& outputs) const;
+
+    // Thread-safe variants: all tensors live in `ctx`, which must have been created
+    // for this plan. Output views stay valid until the next run on `ctx`.
+    [[nodiscard]] std::unique_ptr<ExecutionContext> createContext() const;
+    // Same, with the context's arena mapped per `pages` instead of the plan's
+    // CompileOptions::arena_pages (e.g. bound to a worker pool's NUMA node).
+    [[nodiscard]] std::unique_ptr<ExecutionContext> createContext(
+        const inference_engine::memory::PageOptions& pages) const;
+    void run(ExecutionContext& ctx, const std::vector<inference_engine::core::Tensor>& inputs,
+             std::vector<inference_engine::core::Tensor>& outputs) const;
+    void bindInputs(ExecutionContext& ctx, const std::vector<inference_engine::core::Tensor>& inputs) const;
+    void collectOutputs(const ExecutionContext& ctx, std::vector<inference_engine::core::Tensor>& outputs) const;
+
+private:
+    friend class Graph;
+    ExecutionPlan(std::vector<Step> steps, MemoryPlan memory, std::vector<Value*> inputs,
+                  std::vector<Value*> outputs, std::vector<Value*> values);
+
+    void checkInputs(const std::vector<inference_engine::core::Tensor>& inputs) const;
+    // Executes every step in order, through Profiler::current() when one is installed.
+    void runSteps() const;
+
+    std::vector<Step> steps_;
+    MemoryPlan memory_;
+    std::vector<Value*> inputs_;
+    std::vector<Value*> outputs_;
+    std::vector<Value*> values_;
+
+    // Stable tensors handed to the graph input Values; run() swaps their data pointer.
+    std::vector<inference_engine::core::Tensor> input_slots_;
+};
+
+} // namespace infer
@@ -2,31 +2,93 @@
 
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "inference_engine/core/common.h"
 #include "inference_engine/core/tensor.h"
 #include "inference_engine/graph/attributes.h"
 #include "inference_engine/graph/value.h"
+#include "inference_engine/memory/pages.h"
 
 namespace infer {
 
+class ExecutionPlan;
 class Node;
 class Operator;
+class PackedWeightCache;
+class WeightStore;
 
 struct ValueLifetime {
     std::size_t first_index = 0;
     std::size_t last_index = 0;
     std::size_t bytes = 0;
+    // Byte offset inside the planned arena. Only meaningful when `planned` is set:
+    // graph inputs and values without a producer are bound externally.
+    std::size_t offset = 0;
+    bool planned = false;
+    // Non-zero when the value reuses the bytes of Value `alias_of` (an in-place or
+    // view output, see Operator::outputAlias); it then shares that value's offset.
+    Value::Id alias_of = 0;
 };
 
 struct MemoryPlan {
+    // Maximum number of simultaneously live bytes (lower bound for any packing).
     std::size_t peak_bytes = 0;
+    // Size of the single arena block required by the assigned offsets.
+    std::size_t arena_bytes = 0;
+    // Alignment applied to every offset and to the arena base.
+    std::size_t alignment = inference_engine::core::INF_ENGINE_DEFAULT_ALIGNMENT;
+    // True when offsets stay valid for any execution order consistent with the graph's
+    // dependencies (required by ParallelExecutor), not just the topological order.
+    bool concurrent = false;
+    // Page options for every arena backing this plan (CompileOptions::arena_pages).
+    inference_engine::memory::PageOptions arena_pages{};
     std::unordered_map<Value::Id, ValueLifetime> lifetimes;
 };
 
+struct MemoryPlanOptions {
+    // Only let two values share bytes when one is provably dead (all of its
+    // consumers are ancestors of the other's producer) before the other is written.
+    bool concurrent = false;
+    std::size_t alignment = inference_engine::core::INF_ENGINE_DEFAULT_ALIGNMENT;
+    // Let in-place and view operators write into (or alias) their input's slot when
+    // the input has no later readers.
+    bool in_place = true;
+};
+
+struct CompileOptions {
+    // Plan memory so independent branches may run at the same time.
+    bool parallel = false;
+    // Back the plan with the graph's own arena for ExecutionPlan::run(inputs, outputs).
+    // Plans that only ever run through ExecutionContexts can skip that allocation.
+    bool bind_memory = true;
+    // Huge pages, NUMA node and pre-faulting of the graph's arena and of every
+    // ExecutionContext arena created for the plan. With kLocalNumaNode, each context
+    // lands on the node of the thread that creates it.
+    inference_engine::memory::PageOptions arena_pages{};
+    // Let operators re-lay out constant weights for this host's kernels
+    // (Operator::prepackWeights), reusing blobs from `weight_cache` when set. The
+    // cache must outlive every plan compiled with it. Without a cache, packed
+    // weights are interned in `weight_store` when set (see WeightStore).
+    bool prepack_weights = true;
+    PackedWeightCache* weight_cache = nullptr;
+    WeightStore* weight_store = nullptr;
+};
+
+// Schedule and memory layout of a compiled plan, in the form savePlan() stores
+// (see plan_format.h): enough to rebuild the plan without sorting or planning.
+struct PlanSchedule {
+    // Node::graphIndex() of each step, in execution order.
+    std::vector<std::uint32_t> order{};
+    // Steps consuming each step's outputs (ExecutionPlan::Step::successors).
+    std::vector<std::vector<std::uint32_t>> successors{};
+    MemoryPlan memory{};
+};
+
 class GraphPass {
 public:
     virtual ~GraphPass() = default;
@@ -68,6 +130,21 @@ public:
     // Create and register nodes
     Node* addNode(std::unique_ptr<Operator> op, std::string name = "");
     bool removeNode(Node* node);
+    // Deletes a Value that no node produces or consumes and that is not a graph input
+    // or output (e.g. an intermediate left over by a rewrite). Returns false and keeps
+    // the Value otherwise.
+    bool removeValue(Value* value);
+
+    // Constant data (folded results, weights fed as inputs) attached to a Value that
+    // no node produces. The graph keeps its own contiguous copy of `data` and points
+    // value->tensor() at it; initializers are never planned into the arena. Throws
+    // std::invalid_argument if the Value is not owned by the graph, has a producer,
+    // is a graph input, or `data` does not match its shape and dtype.
+    void setInitializer(Value* value, const inference_engine::core::Tensor& data);
+    [[nodiscard]] bool isInitializer(const Value* value) const noexcept;
+    // nullptr when `value` has no initializer.
+    [[nodiscard]] const inference_engine::core::Tensor* initializer(const Value* value) const noexcept;
+    [[nodiscard]] std::size_t initializerCount() const noexcept { return initializers_.size(); }
 
     // Graph inputs/outputs
     [[nodiscard]] const std::vector<Value*>& inputs() const noexcept { return inputs_; }
@@ -77,26 +154,89 @@ public:
     void addInput(Value* v);
     void addOutput(Value* v);
 
-    // Topological sort & validation
+    // Topological sort & validation. The order is computed once over the graph's
+    // dense node indices (Node::graphIndex) and cached until the next edit; nodes
+    // without dependencies between them keep their insertion order. On a cycle the
+    // result is shorter than nodes().
     [[nodiscard]] std::vector<Node*> topologicalSort();
     void validate() const;
 
-    // Memory planning (analyze lifetimes)
+    // Memory planning: analyze lifetimes and assign arena offsets (greedy by size,
+    // best-fit into gaps between overlapping live ranges).
     [[nodiscard]] MemoryPlan planMemory();
+    [[nodiscard]] MemoryPlan planMemory(const MemoryPlanOptions& options);
+
+    // Back every planned Value with a view into one arena block sized to `plan`.
+    // Rebinding releases the graph's reference to the previous arena (tensors returned
+    // by execute() keep theirs). Throws std::bad_alloc if the block cannot be allocated.
+    void bindMemory(const MemoryPlan& plan);
+    void releaseMemory() noexcept;
+    [[nodiscard]] bool hasBoundMemory() const noexcept { return arena_ != nullptr; }
 
     // Optimization pass application
     void applyPass(GraphPass& pass);
 
+    // Copy of the structure: Values (shape, dtype, quantization, name), Nodes with
+    // cloned operators, inputs, outputs and graph attributes. Initializers and other
+    // externally bound constants are not copied; the clone's Values view this graph's
+    // tensors, so this graph must outlive the clone. Used to specialize a graph for
+    // other input shapes without touching the original (see PlanCache).
+    [[nodiscard]] std::unique_ptr<Graph> clone() const;
+
+    // Validate, sort, plan and bind memory once, producing a plan whose run() is the
+    // allocation-free hot path. The plan stays valid until the graph is edited or its
+    // memory is rebound/released. Operators first decode their attribute maps
+    // (Operator::decodeAttributes); each step then prepacks its weights when
+    // options.prepack_weights is set and runs Operator::prepare() last.
+    [[nodiscard]] std::unique_ptr<ExecutionPlan> compile(const CompileOptions& options = {});
+    // Same, from the schedule of an earlier compile() of this graph (or of one built
+    // identically, e.g. loaded from the same model file): no validation, topological
+    // sort or memory planning. Operators still decode attributes, prepack and
+    // prepare. Throws std::invalid_argument when the schedule does not fit the graph.
+    [[nodiscard]] std::unique_ptr<ExecutionPlan> compile(const PlanSchedule& schedule,
+                                                         const CompileOptions& options = {});
+
+    // Drop the plan cached by execute() and the cached topology. Called automatically
+    // by every structural edit (including Node rewiring); call it manually after
+    // changing Value shapes.
+    void invalidate() noexcept;
+    // Incremented by invalidate(): lets holders of their own compiled plans notice edits.
+    [[nodiscard]] std::uint64_t revision() const noexcept { return revision_; }
+
     // Backwards-compatible placeholders
     void addNode(const std::string& name);
     void addEdge(const std::string& from, const std::string& to);
 
-    // Simple execution driver (placeholder): sets graph input tensor (if single input)
-    // and runs operators in topological order.
+    // Convenience driver for single-input graphs: compiles on first use (and after any
+    // edit), then runs the cached plan. Returns the first output without copying: a
+    // view sharing the arena's Storage, valid for as long as it is held. While such a
+    // result is alive the next run writes into another arena; arenas whose results
+    // were all released are reused, so callers that drop (or overwrite) the result
+    // before the next call keep running in a single arena. Outputs not planned into
+    // the arena are returned as an owning copy.
     inference_engine::core::Tensor execute(const inference_engine::core::Tensor& input);
 
 private:
+    // Dependency structure over Node::graphIndex(), built on first use after an edit.
+    // Edges are producer -> consumer, deduplicated, in CSR form: the successors of
+    // node i are succ[succ_begin[i] .. succ_begin[i + 1]).
+    struct Topology {
+        bool built = false;
+        bool acyclic = false;
+        std::vector<Node*> order;
+        std::vector<std::uint32_t> position; // graph index -> position in `order`
+        std::vector<std::uint32_t> succ_begin;
+        std::vector<std::uint32_t> succ;
+    };
+    const Topology& topology();
+    // The common tail of both compile() overloads: binds the schedule's memory,
+    // prepacks and prepares every step's operator and builds the plan.
+    std::unique_ptr<ExecutionPlan> buildPlan(PlanSchedule schedule, const CompileOptions& options);
+
     [[nodiscard]] bool ownsValuePtr(const Value* v) const noexcept;
+    [[nodiscard]] bool ownsNodePtr(const Node* n) const noexcept;
+    // Points every bound tensor at the same offsets inside `arena`.
+    void rebindArena(std::shared_ptr<inference_engine::core::Storage> arena) noexcept;
 
     std::string model_name_{};
     std::string model_version_{};
@@ -107,6 +247,30 @@ private:
 
     std::vector<Value*> inputs_{};
     std::vector<Value*> outputs_{};
+
+    // Storage behind setInitializer(). Map nodes keep the tensors' addresses stable.
+    struct Initializer {
+        std::vector<std::uint64_t> storage; // 8-byte aligned for every dtype
+        inference_engine::core::Tensor tensor;
+    };
+    std::unordered_map<const Value*, Initializer> initializers_{};
+
+    // Planned intermediate storage (see bindMemory). bound_tensors_ borrow the arena,
+    // so any further reference to arena_ is a result still held by a caller.
+    std::shared_ptr<inference_engine::core::Storage> arena_{};
+    std::size_t arena_alignment_ = 0;
+    inference_engine::memory::PageOptions arena_pages_{};
+    std::vector<inference_engine::core::Tensor> bound_tensors_{};
+    std::vector<Value*> bound_values_{};
+    // Arenas swapped out by execute() while their results were held; reused once free.
+    std::vector<std::shared_ptr<inference_engine::core::Storage>> spare_arenas_{};
+
+    // Plan cached by execute() and topology; both reset by invalidate().
+    std::unique_ptr<ExecutionPlan> compiled_{};
+    Topology topology_{};
+    std::uint64_t revision_ = 0;
+    std::vector<inference_engine::core::Tensor> exec_inputs_{};
+    std::vector<inference_engine::core::Tensor> exec_outputs_{};
 };
 
 } // namespace infer
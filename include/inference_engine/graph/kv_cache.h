@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "inference_engine/memory/arena.h"
+#include "inference_engine/memory/pages.h"
+
+namespace infer {
+
+struct KVCacheConfig {
+    std::size_t layers = 0;
+    std::size_t kv_heads = 0;
+    std::size_t head_dim = 0;
+    // Tokens per block, at most kMaxAttentionBlockTokens (kernels/attention.h).
+    std::size_t block_tokens = 16;
+    // Blocks in the pool, shared by every sequence.
+    std::size_t blocks = 0;
+    // Huge pages, NUMA node and pre-faulting of the pool.
+    inference_engine::memory::PageOptions pages{};
+};
+
+// Keys and values of past tokens, kept across inference calls so an autoregressive
+// decoder attends to its history instead of recomputing it (see PagedAttentionOp).
+//
+// Memory is one dedicated arena carved at construction into equal blocks of
+// block_tokens positions for every layer and KV head. A sequence owns a block table
+// and takes a free block whenever it crosses a block boundary, so sequences of any
+// length share the pool without fragmentation; removing a sequence returns its
+// blocks. Within a block, layer l and head h hold block_tokens rows of head_dim
+// floats for the keys, then the same for the values:
+//
+//   block b: [layer 0: K head 0..H-1, V head 0..H-1] [layer 1: ...] ...
+//
+// A decoding step declares up front which sequence each batch row belongs to and
+// how many tokens every row appends (beginStep); the attention operators of all
+// layers then write and read those positions. Not thread-safe: one step at a time.
+class KVCache {
+public:
+    using SequenceId = std::uint32_t;
+
+    // The rows of the current step.
+    struct Step {
+        std::vector<SequenceId> rows{};
+        // Position of each row's first new token (its length before the step).
+        std::vector<std::size_t> positions{};
+        std::size_t tokens = 0; // new tokens per row
+    };
+
+    // Throws std::invalid_argument for an empty or oversized configuration and
+    // std::bad_alloc when the pool cannot be mapped.
+    explicit KVCache(const KVCacheConfig& config);
+
+    KVCache(const KVCache&) = delete;
+    KVCache& operator=(const KVCache&) = delete;
+
+    [[nodiscard]] const KVCacheConfig& config() const noexcept { return config_; }
+
+    // Starts an empty sequence; ids of removed sequences are reused.
+    SequenceId addSequence();
+    // Returns the sequence's blocks to the pool. Throws std::invalid_argument for an
+    // unknown id.
+    void removeSequence(SequenceId id);
+
+    // Reserves `tokens` new positions for each of `rows` (distinct, live sequences)
+    // and makes them the current step. Throws std::invalid_argument for bad rows and
+    // std::length_error when the pool has too few free blocks, changing nothing.
+    void beginStep(std::vector<SequenceId> rows, std::size_t tokens = 1);
+    [[nodiscard]] const Step& step() const noexcept { return step_; }
+
+    // Positions held, including those reserved by the current step.
+    [[nodiscard]] std::size_t length(SequenceId id) const;
+    [[nodiscard]] const std::vector<std::uint32_t>& blockTable(SequenceId id) const;
+
+    // Rows of layer `layer`, head `head` in block `block`.
+    [[nodiscard]] float* keys(std::uint32_t block, std::size_t layer, std::size_t head) noexcept {
+        return base_ + block * block_floats_ + (layer * 2 * config_.kv_heads + head) * head_floats_;
+    }
+    [[nodiscard]] float* values(std::uint32_t block, std::size_t layer, std::size_t head) noexcept {
+        return keys(block, layer, head) + config_.kv_heads * head_floats_;
+    }
+    // Floats between the same rows of consecutive blocks.
+    [[nodiscard]] std::size_t blockStride() const noexcept { return block_floats_; }
+
+    [[nodiscard]] std::size_t freeBlocks() const noexcept { return free_.size(); }
+    [[nodiscard]] std::size_t sequences() const noexcept { return live_; }
+
+private:
+    struct Sequence {
+        std::vector<std::uint32_t> blocks{};
+        std::size_t length = 0;
+        bool live = false;
+    };
+
+    Sequence& sequence(SequenceId id);
+    const Sequence& sequence(SequenceId id) const;
+
+    KVCacheConfig config_;
+    std::size_t head_floats_ = 0;  // block_tokens * head_dim
+    std::size_t block_floats_ = 0; // every layer's keys and values
+    inference_engine::memory::Arena arena_;
+    float* base_ = nullptr;
+    std::vector<std::uint32_t> free_{}; // stack of free block indices
+    std::vector<Sequence> sequences_{};
+    std::vector<SequenceId> free_ids_{};
+    std::size_t live_ = 0;
+    Step step_{};
+};
+
+} // namespace infer
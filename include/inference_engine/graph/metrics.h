@@ -0,0 +1,188 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "inference_engine/graph/execution_plan.h"
+
+namespace inference_engine {
+namespace core {
+class Allocator;
+} // namespace core
+} // namespace inference_engine
+
+namespace infer {
+
+class DynamicBatcher;
+class Model;
+class Profiler;
+class ThreadPool;
+
+// Latency histogram with fixed power-of-two buckets from 1us to ~8.4s. record() is
+// two relaxed atomic adds, so any number of threads record without locking.
+class LatencyHistogram {
+public:
+    // Bucket i counts latencies in (bound(i - 1), bound(i)]; the last one is +Inf.
+    static constexpr std::size_t kBuckets = 25;
+
+    struct Snapshot {
+        std::array<std::uint64_t, kBuckets> counts{};
+        std::uint64_t count = 0;
+        std::uint64_t sum_ns = 0;
+
+        // Upper bound of the bucket holding quantile `q` in [0, 1], in nanoseconds;
+        // 0 for an empty histogram and the last finite bound for the +Inf bucket.
+        [[nodiscard]] std::uint64_t quantileNs(double q) const noexcept;
+    };
+
+    // Upper bound of bucket i in nanoseconds (1000 << i); UINT64_MAX for the last.
+    [[nodiscard]] static std::uint64_t boundNs(std::size_t bucket) noexcept;
+
+    void record(std::uint64_t ns) noexcept;
+    // Counts may be mid-update with respect to each other, never torn.
+    [[nodiscard]] Snapshot snapshot() const noexcept;
+
+private:
+    std::array<std::atomic<std::uint64_t>, kBuckets> counts_{};
+    std::atomic<std::uint64_t> sum_ns_{0};
+};
+
+// Point-in-time copy of every metric of a MetricsRegistry, sorted by name.
+struct MetricsSnapshot {
+    struct Latency {
+        std::string name; // model name or Operator::type()
+        LatencyHistogram::Snapshot histogram;
+    };
+    struct Allocator {
+        std::string name;
+        std::uint64_t live_bytes = 0;
+        std::uint64_t peak_live_bytes = 0;
+        std::uint64_t live_allocations = 0;
+    };
+    struct Arena {
+        std::string name; // model
+        std::uint64_t contexts = 0;
+        std::uint64_t bytes = 0;
+        std::uint64_t peak_bytes = 0;
+    };
+    struct Pool {
+        std::string name;
+        std::uint64_t threads = 0;
+        std::uint64_t queued = 0;
+        std::uint64_t executed = 0;
+        std::uint64_t steals = 0;
+        std::uint64_t busy_ns = 0;
+    };
+    struct Batcher {
+        std::string name;
+        std::uint64_t queue_depth = 0;
+        std::uint64_t max_queue_depth = 0;
+        std::uint64_t requests = 0;
+        std::uint64_t batches = 0;
+        std::uint64_t padded_rows = 0;
+        LatencyHistogram::Snapshot wait;
+    };
+
+    std::vector<Latency> models;
+    std::vector<Latency> ops;
+    std::vector<Allocator> allocators;
+    std::vector<Arena> arenas;
+    std::vector<Pool> pools;
+    std::vector<Batcher> batchers;
+};
+
+// Runtime metrics for production tuning (batch timeouts, thread counts):
+//
+//   MetricsRegistry metrics;
+//   model.setMetrics(&metrics, "ranker");   // infer() and per-op latency, arenas
+//   metrics.track("workers", pool);         // utilization, steals, queue depth
+//   metrics.track("ranker", batcher);       // queue depth and wait time
+//   metrics.track("weights", allocator);    // live and peak bytes (tracking on)
+//   ...
+//   metrics.writePrometheus(response);      // or snapshot() for the pull API
+//
+// Latencies go to LatencyHistograms, recorded lock-free on the inference threads;
+// everything else is read from the tracked objects' stats() when pulled. Op
+// latencies are recorded for steps run while the registry is installed with a
+// Scope (Model::infer installs it), through ExecutionPlan::run, ParallelExecutor
+// and PipelineExecutor, like Profiler. Tracked objects must be untracked (or the
+// registry destroyed) before they are destroyed; a Model untracks itself.
+class MetricsRegistry {
+public:
+    MetricsRegistry();
+    ~MetricsRegistry();
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    // Histograms, created on first use and kept for the registry's lifetime.
+    // opLatency() is lock-free for an op type seen before.
+    [[nodiscard]] LatencyHistogram& modelLatency(const std::string& model);
+    [[nodiscard]] LatencyHistogram& opLatency(const std::string& op_type);
+
+    // Runs `step` and records its latency under its operator type.
+    void execute(const ExecutionPlan::Step& step);
+
+    void track(const std::string& name, const ThreadPool& pool);
+    void track(const std::string& name, const DynamicBatcher& batcher);
+    // Reports stats() of the allocator, which are zero unless tracking is enabled.
+    void track(const std::string& name, const inference_engine::core::Allocator& allocator);
+    // Reports Model::arenaStats(); see Model::setMetrics for latencies.
+    void track(const std::string& name, const Model& model);
+    void untrack(const void* object);
+
+    [[nodiscard]] MetricsSnapshot snapshot() const;
+
+    // Prometheus text exposition format 0.0.4, metric names prefixed "ie_".
+    void writePrometheus(std::ostream& os) const;
+
+    // Registry installed on the calling thread, or nullptr.
+    [[nodiscard]] static MetricsRegistry* current() noexcept;
+
+    // Installs `metrics` as MetricsRegistry::current() for the calling thread.
+    class Scope {
+    public:
+        explicit Scope(MetricsRegistry* metrics) noexcept;
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        MetricsRegistry* previous_;
+    };
+
+private:
+    enum class Kind : std::uint8_t { Pool, Batcher, Allocator, Model };
+    struct Source {
+        std::string name;
+        Kind kind;
+        const void* object;
+    };
+    // Immutable once published; replaced (copy on write) when an op type is added.
+    using OpTable = std::map<std::string, LatencyHistogram*, std::less<>>;
+
+    void track(const std::string& name, Kind kind, const void* object);
+
+    mutable std::mutex mu_;
+    std::deque<LatencyHistogram> histograms_; // stable addresses
+    std::map<std::string, LatencyHistogram*> models_;
+    std::atomic<const OpTable*> ops_;
+    std::vector<std::unique_ptr<const OpTable>> op_tables_; // every published table
+    std::vector<Source> sources_;
+};
+
+// Runs `step` through `profiler` and records it in `metrics`; either may be null.
+// Executors call it only when one is installed and call the operator directly
+// otherwise.
+void executeStep(const ExecutionPlan::Step& step, Profiler* profiler, MetricsRegistry* metrics);
+
+} // namespace infer
@@ -45,6 +45,12 @@ public:
 	void addInput(Value* v);
 	void addOutput(Value* v);
 
+	// Position in Graph::nodes(), maintained by the owning graph (kNoIndex for a
+	// node outside any graph).
+	static constexpr std::uint32_t kNoIndex = ~std::uint32_t{0};
+	[[nodiscard]] std::uint32_t graphIndex() const noexcept { return graph_index_; }
+	void setGraphIndex(std::uint32_t index) noexcept { graph_index_ = index; }
+
 	// Topological order index (set during sort)
 	[[nodiscard]] std::optional<std::size_t> topoIndex() const noexcept { return topo_index_; }
 	void setTopoIndex(std::optional<std::size_t> index) noexcept { topo_index_ = index; }
@@ -69,6 +75,8 @@ private:
 	void detachFromValues();
 	void attachInputsToValues();
 	void attachOutputsToValues();
+	// Mirror node IO onto the operator so Operator::validate() sees the wiring.
+	void syncOperatorIO();
 
 	Id id_{0};
 	std::string name_{};
@@ -78,6 +86,7 @@ private:
 	std::vector<Value*> inputs_{};
 	std::vector<Value*> outputs_{};
 
+	std::uint32_t graph_index_{kNoIndex};
 	std::optional<std::size_t> topo_index_{};
 
 	bool ready_{false};
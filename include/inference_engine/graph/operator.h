@@ -2,6 +2,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -10,6 +11,16 @@ namespace infer {
 
 class Value;
 class AttributeMap;
+class PackedWeightCache;
+class WeightStore;
+
+// How output 0 of an operator may share storage with input 0. Graph::planMemory
+// uses this to put both Values in one arena slot.
+enum class BufferAlias : std::uint8_t {
+	None,    // the output needs its own buffer
+	InPlace, // the output may overwrite input 0 (same byte size; every element is read before it is written)
+	View,    // the output is input 0's bytes under another shape; the operator writes nothing
+};
 
 // Base class for all operations.
 class Operator {
@@ -37,15 +48,52 @@ public:
 	[[nodiscard]] AttributeMap* attributes() noexcept { return attrs_; }
 	void setAttributes(AttributeMap* attrs) noexcept { attrs_ = attrs; }
 
+	// Decode the attribute map into the operator's own typed, plain-data parameters.
+	// Graph::compile() calls this before validate() for every operator with an
+	// attribute map, so neither prepare() nor execute() ever looks an attribute up.
+	// Keys the map does not hold leave the constructor's values in place; malformed
+	// ones throw std::invalid_argument. Default: no attributes are read.
+	virtual void decodeAttributes(const AttributeMap& attrs);
+
 	// Validate operator configuration (shapes/dtypes, number of inputs/outputs).
 	// Default implementation checks for null inputs/outputs pointers.
 	virtual void validate() const;
 
+	// Recompute the output Values' shapes from the current input shapes, for graphs
+	// specialized to new input shapes (see ShapeInferencePass). Throws
+	// std::invalid_argument when the inputs cannot be accepted; the default supports
+	// no shape changes at all and always throws.
+	virtual void inferShapes();
+
+	// Storage relationship between output 0 and input 0 (default: None). InPlace is
+	// only applied when the planner proves input 0 has no later readers.
+	[[nodiscard]] virtual BufferAlias outputAlias() const noexcept;
+
 	// Memory requirement estimation for execution (default: 0).
 	[[nodiscard]] virtual std::size_t estimateMemoryBytes() const noexcept;
 
+	// Arithmetic operations of one execute() at the current Value shapes, for
+	// profiling (default: 0).
+	[[nodiscard]] virtual std::uint64_t estimateFlops() const noexcept;
+
+	// Re-lay out constant weights for the kernels selected on this host, run by
+	// Graph::compile() before prepare() when CompileOptions::prepack_weights is set.
+	// With a cache, packed blobs are looked up under names starting with `key`
+	// (unique to the node within its graph) before packing, and inserted after.
+	// Otherwise, with a store, freshly packed data is interned there so operators
+	// holding identical weights share one packed copy. An owned original may be
+	// freed once packed; clones share the packed data. Default: nothing is packed.
+	virtual void prepackWeights(PackedWeightCache* cache, WeightStore* store, const std::string& key);
+
+	// One-time setup run by Graph::compile() after validate(), single-threaded. Anything
+	// execute() would otherwise derive and cache lazily belongs here: once compiled, a
+	// plan may execute the same operator from several threads at once (one
+	// ExecutionContext each), so execute() must not modify the operator.
+	virtual void prepare();
+
 	// Execute the operation. Derived ops typically read input tensors from Value::tensor()
-	// and write output tensors.
+	// and write output tensors. This is the hot path: Graph::compile() has already run
+	// validate(), so implementations should not re-validate here.
 	virtual void execute() = 0;
 
 	// Clone/copy for graph optimization.
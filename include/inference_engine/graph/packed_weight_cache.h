@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "inference_engine/core/mapped_file.h"
+#include "inference_engine/kernels/cpu_features.h"
+
+namespace infer {
+
+// Weights re-laid out for the host's kernels (see Operator::prepackWeights), kept
+// across process starts. One file per model and ISA,
+//   <directory>/<model hash, 16 hex digits>-<isa>.iepack
+// holds named blobs on 64-byte boundaries. Opening the cache maps that file, and
+// blobs found there are used in place, so a restart neither repacks nor copies.
+// Blobs packed in this process are held in memory until flush() writes a new file.
+//
+// File layout (little-endian): [Header][entries][padding][blobs], each entry a
+// u32 name length, the name, u64 offset and u64 byte count (offsets from the
+// start of the file). A file whose header does not match the model hash and ISA
+// is ignored and replaced by the next flush().
+//
+// Thread-safe. Blobs stay valid, at the same address, for the cache's lifetime.
+class PackedWeightCache {
+public:
+    struct Blob {
+        const void* data = nullptr;
+        std::size_t bytes = 0;
+    };
+
+    // Opens the cache of model `model_hash` for the host's ISA (max_isa()) in
+    // `directory`, which must exist. A missing or unreadable file is an empty cache.
+    PackedWeightCache(std::string directory, std::uint64_t model_hash);
+    PackedWeightCache(std::string directory, std::uint64_t model_hash, Isa isa);
+    ~PackedWeightCache();
+
+    PackedWeightCache(const PackedWeightCache&) = delete;
+    PackedWeightCache& operator=(const PackedWeightCache&) = delete;
+
+    // Blob stored under `key` with exactly `bytes` bytes; data is null otherwise.
+    [[nodiscard]] Blob find(const std::string& key, std::size_t bytes) const;
+    // Copies `bytes` bytes under `key`, replacing any previous blob, and returns the
+    // cache's copy. Marks the cache dirty.
+    Blob insert(const std::string& key, const void* data, std::size_t bytes);
+
+    // Writes every blob to path() (through a temporary file and a rename) when
+    // blobs were inserted since the last flush. Returns false, leaving the cache
+    // usable in memory, when the file cannot be written.
+    bool flush();
+
+    [[nodiscard]] const std::string& path() const noexcept { return path_; }
+    [[nodiscard]] std::uint64_t modelHash() const noexcept { return model_hash_; }
+    [[nodiscard]] Isa isa() const noexcept { return isa_; }
+    // Blobs served from the mapped file rather than packed in this process.
+    [[nodiscard]] std::size_t mappedBlobs() const;
+    [[nodiscard]] std::size_t size() const;
+
+    // 64-bit content hash (word-wise multiply-xor) for cache keys; not cryptographic.
+    [[nodiscard]] static std::uint64_t hashBytes(const void* data, std::size_t bytes) noexcept;
+
+private:
+    void openFile();
+
+    std::string path_;
+    std::uint64_t model_hash_;
+    Isa isa_;
+
+    mutable std::mutex mu_;
+    inference_engine::core::MappedFile file_{};
+    std::map<std::string, Blob> blobs_{};
+    // Storage of blobs inserted in this process, in cache lines.
+    struct alignas(64) Line {
+        unsigned char bytes[64];
+    };
+    std::vector<std::unique_ptr<Line[]>> owned_{};
+    std::size_t mapped_blobs_ = 0;
+    bool dirty_ = false;
+};
+
+} // namespace infer
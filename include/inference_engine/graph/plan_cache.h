@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "inference_engine/core/shape.h"
+#include "inference_engine/graph/graph.h"
+
+namespace infer {
+
+class ExecutionPlan;
+
+enum class BatchBucketing : std::uint8_t {
+    None,       // one plan per distinct input shape
+    PowerOfTwo, // round dim 0 of every input up to a power of two
+};
+
+struct PlanCacheOptions {
+    // Specialized plans kept at once; the least recently used one is evicted once a
+    // new plan is compiled, so compiles still in flight may briefly exceed it.
+    std::size_t capacity = 8;
+    BatchBucketing batch_bucketing = BatchBucketing::None;
+    // Specialized plans normally run through ExecutionContexts only.
+    CompileOptions compile = [] {
+        CompileOptions options;
+        options.bind_memory = false;
+        return options;
+    }();
+};
+
+// A graph specialized for one input shape signature and its compiled plan. Immutable
+// once built; holders keep it alive after it is evicted from the cache.
+class SpecializedPlan {
+public:
+    SpecializedPlan(std::unique_ptr<Graph> graph, std::unique_ptr<ExecutionPlan> plan,
+                    std::vector<inference_engine::core::Shape> input_shapes);
+    ~SpecializedPlan();
+
+    SpecializedPlan(const SpecializedPlan&) = delete;
+    SpecializedPlan& operator=(const SpecializedPlan&) = delete;
+
+    [[nodiscard]] const ExecutionPlan& plan() const noexcept { return *plan_; }
+    [[nodiscard]] const Graph& graph() const noexcept { return *graph_; }
+    // Shapes the plan was compiled for (after bucketing).
+    [[nodiscard]] const std::vector<inference_engine::core::Shape>& inputShapes() const noexcept {
+        return input_shapes_;
+    }
+
+private:
+    // Declared first so the plan, which points into its Values, is destroyed first.
+    std::unique_ptr<Graph> graph_;
+    std::unique_ptr<ExecutionPlan> plan_;
+    std::vector<inference_engine::core::Shape> input_shapes_;
+};
+
+// Bounded LRU cache of ExecutionPlans keyed by the input shape signature. A miss
+// clones the source graph, runs ShapeInferencePass for the (bucketed) shapes and
+// compiles it, including its memory plan; a hit returns the cached plan without
+// any planning. Edits to the source graph (Graph::revision()) drop every entry.
+// Compiles run outside the cache lock: callers of a shape that is still being
+// compiled wait for that one compile, while hits on other shapes go on unblocked.
+//
+// The source graph must outlive the cache and every SpecializedPlan it handed out,
+// because specialized graphs share its weights and initializers. Thread-safe.
+class PlanCache {
+public:
+    struct Stats {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t evictions = 0;
+    };
+
+    explicit PlanCache(Graph& source, PlanCacheOptions options = {});
+    ~PlanCache();
+
+    PlanCache(const PlanCache&) = delete;
+    PlanCache& operator=(const PlanCache&) = delete;
+
+    // Plan for the bucketed form of `input_shapes`. Throws std::invalid_argument
+    // when the shapes do not fit the graph (wrong count or rank, or an operator
+    // that rejects them in shape inference).
+    [[nodiscard]] std::shared_ptr<const SpecializedPlan> acquire(
+        const std::vector<inference_engine::core::Shape>& input_shapes);
+
+    // Shapes a request is actually run at under the bucketing policy.
+    [[nodiscard]] std::vector<inference_engine::core::Shape> bucketed(
+        const std::vector<inference_engine::core::Shape>& input_shapes) const;
+
+    [[nodiscard]] const PlanCacheOptions& options() const noexcept { return options_; }
+    [[nodiscard]] std::size_t size() const;
+    [[nodiscard]] Stats stats() const;
+    void clear();
+
+private:
+    struct KeyHash {
+        std::size_t operator()(const std::vector<std::int64_t>& key) const noexcept;
+    };
+    // A plan that is cached or still being compiled by the first caller of its key.
+    struct Entry {
+        std::vector<std::int64_t> key;
+        std::shared_future<std::shared_ptr<const SpecializedPlan>> plan;
+        std::uint64_t build = 0; // tells a failed compile's entry from a later retry
+    };
+    using Lru = std::list<Entry>;
+
+    [[nodiscard]] std::shared_ptr<const SpecializedPlan> build(
+        const std::vector<inference_engine::core::Shape>& shapes) const;
+
+    Graph& source_;
+    PlanCacheOptions options_;
+
+    mutable std::mutex mu_;
+    std::uint64_t source_revision_ = 0;
+    Lru lru_; // most recently used first
+    std::unordered_map<std::vector<std::int64_t>, Lru::iterator, KeyHash> index_;
+    Stats stats_{};
+    std::uint64_t builds_ = 0;
+};
+
+} // namespace infer
@@ -0,0 +1,104 @@
+#pragma once
+
+// Binary compiled-plan format, version 2: the schedule and memory layout of an
+// ExecutionPlan, stored next to the model file so a process start maps it instead
+// of sorting and planning the graph again.
+//
+//   [PlanHeader, 96 bytes][u32 order[steps]][u32 succ_begin[steps + 1]]
+//   [u32 succ[edges]][padding to 8][ValueRecord values[values]]
+//
+// Little-endian, every array at its natural alignment, so a mapped file is read in
+// place. The header records what the plan depends on: the graph's structure (a
+// fingerprint of every Value's dtype, shape and quantization and every Node's
+// operator type, attributes and wiring) and the host ISA, which fixes the kernels
+// the registry resolves and the weight layouts they prepack. A plan whose version,
+// ISA or fingerprint differs from the current process and graph is not used.
+//
+// The graph itself is not stored: no Values, Nodes, weights or per-step kernel
+// choices (kernels are resolved again on load).
+// The caller supplies the graph, which must be built exactly as when the plan was
+// saved, including any rewriting passes (fusion, constant folding, sparsity) run
+// before compile(). A plan saved after such passes therefore does not match the
+// graph of the unoptimized model file until the same passes run on it again; the
+// fingerprint check turns that into a stale plan rather than a wrong one.
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "inference_engine/graph/graph.h"
+
+namespace inference_engine {
+namespace core {
+class MappedFile;
+} // namespace core
+} // namespace inference_engine
+
+namespace infer {
+
+class ExecutionPlan;
+
+namespace plan_format {
+
+inline constexpr char kMagic[8] = {'I', 'E', 'P', 'L', 'A', 'N', '\0', '\0'};
+inline constexpr std::uint32_t kVersion = 2;
+
+struct PlanHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t header_bytes; // sizeof(PlanHeader)
+    std::uint64_t graph_hash;   // graphFingerprint()
+    std::uint32_t isa;          // max_isa() of the compiling host
+    std::uint32_t flags;        // kConcurrent
+    std::uint32_t steps;
+    std::uint32_t edges;
+    std::uint32_t values;       // Graph::values().size()
+    std::uint32_t alignment;    // MemoryPlan::alignment
+    std::uint64_t arena_bytes;
+    std::uint64_t peak_bytes;
+    std::uint64_t values_offset; // byte offset of the ValueRecord array
+    std::uint64_t file_bytes;
+    std::uint64_t reserved[2];
+};
+static_assert(sizeof(PlanHeader) == 96, "PlanHeader layout is part of the file format");
+
+inline constexpr std::uint32_t kConcurrent = 1;
+
+// MemoryPlan lifetime of the Value in the same slot (Value::planSlot()).
+struct ValueRecord {
+    std::uint64_t first_index;
+    std::uint64_t last_index;
+    std::uint64_t bytes;
+    std::uint64_t offset;
+    std::uint32_t alias_of; // slot of the aliased Value, kNoAlias for none
+    std::uint32_t flags;    // kHasLifetime | kPlanned
+};
+static_assert(sizeof(ValueRecord) == 40, "ValueRecord layout is part of the file format");
+
+inline constexpr std::uint32_t kNoAlias = ~std::uint32_t{0};
+inline constexpr std::uint32_t kHasLifetime = 1;
+inline constexpr std::uint32_t kPlanned = 2;
+
+} // namespace plan_format
+
+// Structural hash of `graph`: Values (dtype, shape, quantization, graph input or
+// output) and Nodes (operator type, attributes, input and output Values) in index
+// order. Names and weights are not included.
+[[nodiscard]] std::uint64_t graphFingerprint(const Graph& graph);
+
+// Writes the schedule of `plan`, compiled from `graph`, to `path`. Throws
+// std::invalid_argument if `plan` belongs to another graph and std::runtime_error
+// on I/O failure.
+void savePlan(const Graph& graph, const ExecutionPlan& plan, const std::string& path);
+
+// Rebuilds the plan stored in `file` for `graph` through Graph::compile(schedule,
+// options). Returns null when the file was written by another format version, for
+// another ISA or graph, or without the concurrent memory plan options.parallel
+// needs, and then sets `*reason` (when given) to say which; the caller compiles as
+// usual. Throws std::runtime_error for a malformed file.
+[[nodiscard]] std::unique_ptr<ExecutionPlan> loadPlan(const inference_engine::core::MappedFile& file, Graph& graph,
+                                                      const CompileOptions& options = {},
+                                                      std::string* reason = nullptr);
+
+} // namespace infer
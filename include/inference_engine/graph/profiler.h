@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "inference_engine/graph/execution_plan.h"
+
+namespace infer {
+
+// Per-step instrumentation for ExecutionPlan::run(), ParallelExecutor and everything
+// built on them (Graph::execute, Model::infer). A Profiler records nothing until it
+// is installed on the running thread with a Scope; with none installed, the
+// executors check one thread-local pointer per run and call operators directly.
+//
+//   Profiler profiler;
+//   {
+//       Profiler::Scope scope(&profiler);
+//       plan->run(inputs, outputs);
+//   }
+//   profiler.writeChromeTrace(file);   // chrome://tracing or ui.perfetto.dev
+//   profiler.printSummary(std::cout);  // aggregated per operator type
+//
+// Byte counts come from Value shapes plus Operator::estimateMemoryBytes() (weights),
+// FLOPs from Operator::estimateFlops(). Recording is thread-safe.
+class Profiler {
+public:
+    struct Event {
+        std::string node;    // Node name
+        std::string op_type; // Operator::type()
+        std::uint64_t start_ns = 0; // since the profiler's epoch (construction or clear())
+        std::uint64_t duration_ns = 0;
+        std::uint64_t bytes_read = 0;    // inputs plus operator weights
+        std::uint64_t bytes_written = 0; // outputs
+        std::uint64_t flops = 0;
+        std::uint32_t thread = 0; // small per-profiler index of the executing thread
+    };
+
+    struct OpTypeSummary {
+        std::string op_type;
+        std::uint64_t calls = 0;
+        std::uint64_t total_ns = 0;
+        std::uint64_t bytes = 0; // read + written
+        std::uint64_t flops = 0;
+    };
+
+    Profiler();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // Runs `step` and records it.
+    void execute(const ExecutionPlan::Step& step);
+
+    [[nodiscard]] std::vector<Event> events() const;
+    // Totals per operator type, most expensive first.
+    [[nodiscard]] std::vector<OpTypeSummary> summarize() const;
+    // Drops all events and restarts the epoch.
+    void clear();
+
+    // Chrome trace_event JSON ("X" complete events, timestamps in microseconds).
+    void writeChromeTrace(std::ostream& os) const;
+    // Table of summarize() with share of time, GFLOP/s and GB/s.
+    void printSummary(std::ostream& os) const;
+
+    // Profiler installed on the calling thread, or nullptr.
+    [[nodiscard]] static Profiler* current() noexcept;
+
+    // Installs `profiler` as Profiler::current() for the calling thread.
+    class Scope {
+    public:
+        explicit Scope(Profiler* profiler) noexcept;
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Profiler* previous_;
+    };
+
+private:
+    std::uint32_t threadIndex(std::thread::id id); // requires mu_
+
+    mutable std::mutex mu_;
+    std::chrono::steady_clock::time_point epoch_;
+    std::vector<Event> events_;
+    std::vector<std::thread::id> threads_;
+};
+
+} // namespace infer
@@ -65,11 +65,19 @@ public:
 	void removeConsumer(Node* consumer);
 	[[nodiscard]] bool hasConsumer(Node* consumer) const noexcept;
 
-	// Runtime tensor pointer (non-owning).
-	[[nodiscard]] inference_engine::core::Tensor* tensor() noexcept { return tensor_; }
-	[[nodiscard]] const inference_engine::core::Tensor* tensor() const noexcept { return tensor_; }
-	void setTensor(inference_engine::core::Tensor* tensor) noexcept { tensor_ = tensor; }
-	void clearTensor() noexcept { tensor_ = nullptr; }
+	// Runtime tensor pointer (non-owning). While an ExecutionContext is active on the
+	// calling thread (ExecutionContext::Scope), Values it tracks resolve to and bind
+	// the context's per-request tensors instead; everything else uses the Value's own.
+	[[nodiscard]] inference_engine::core::Tensor* tensor() noexcept;
+	[[nodiscard]] const inference_engine::core::Tensor* tensor() const noexcept;
+	void setTensor(inference_engine::core::Tensor* tensor) noexcept;
+	void clearTensor() noexcept { setTensor(nullptr); }
+
+	// Position in the owning Graph::values(), maintained by the graph; keys the
+	// per-request tables of an ExecutionContext.
+	static constexpr std::uint32_t kNoSlot = ~std::uint32_t{0};
+	[[nodiscard]] std::uint32_t planSlot() const noexcept { return plan_slot_; }
+	void setPlanSlot(std::uint32_t slot) noexcept { plan_slot_ = slot; }
 
 private:
 	static Id nextId();
@@ -83,6 +91,7 @@ private:
 	std::vector<Node*> consumers_{};
 
 	inference_engine::core::Tensor* tensor_{nullptr};
+	std::uint32_t plan_slot_{kNoSlot};
 	std::optional<inference_engine::core::QuantizationParams> qparams_{};
 };
 
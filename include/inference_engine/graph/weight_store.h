@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "inference_engine/core/storage.h"
+
+namespace infer {
+
+// Content-addressed store of immutable weights, so models, model versions and
+// their clones that hold identical tensors keep one copy of them (see
+// Model::setWeightStore and CompileOptions::weight_store).
+//
+// intern() hashes the bytes it is given and returns the blob of a live tensor with
+// the same contents, or copies them into a new 64-byte-aligned blob. Blobs are
+// refcounted Storage owned by their users, not by the store: the last tensor or
+// operator releasing one frees it, and the store only remembers it weakly. Blobs
+// must never be written to. global() is the process-wide instance; separate stores
+// never share blobs.
+//
+// Thread-safe.
+class WeightStore {
+public:
+    struct Stats {
+        std::size_t blobs = 0; // live blobs
+        std::size_t bytes = 0; // their total size
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+    };
+
+    WeightStore() = default;
+    WeightStore(const WeightStore&) = delete;
+    WeightStore& operator=(const WeightStore&) = delete;
+
+    [[nodiscard]] static WeightStore& global();
+
+    // Blob holding the `bytes` bytes at `data`. Throws std::bad_alloc.
+    [[nodiscard]] std::shared_ptr<const inference_engine::core::Storage> intern(const void* data, std::size_t bytes);
+
+    [[nodiscard]] Stats stats() const;
+
+private:
+    struct Entry {
+        std::weak_ptr<const inference_engine::core::Storage> blob;
+        std::size_t bytes = 0;
+    };
+
+    // Drops entries whose blob has been freed. Caller holds mu_.
+    void prune() const;
+
+    mutable std::mutex mu_;
+    mutable std::unordered_multimap<std::uint64_t, Entry> entries_{}; // by content hash
+    mutable std::size_t prune_at_ = 64;
+    std::uint64_t hits_ = 0;
+    std::uint64_t misses_ = 0;
+};
+
+} // namespace infer
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace infer {
+
+// Upper bounds of the "paged_attention" kernels, which keep one block of scores and
+// the softmax state of every query head of a group on the stack.
+constexpr std::size_t kMaxAttentionBlockTokens = 256;
+constexpr std::size_t kMaxAttentionGroup = 16;
+
+// Scaled dot-product attention of one query token against the keys and values of
+// one KV head, stored in fixed-size pages (see KVCache). Page j of the sequence
+// holds positions [j * block_tokens, (j + 1) * block_tokens) and lives at
+// keys + blocks[j] * block_stride (values likewise), as block_tokens rows of
+// head_dim floats.
+//
+//   out[g] = softmax(scale * q[g] . K[0..tokens)) * V[0..tokens)   for g < group
+//
+// `group` query heads share the KV head (grouped-query attention); the kernel walks
+// the pages once for all of them. Scores are never materialized beyond one page:
+// the softmax runs online, rescaling the running output when the maximum grows.
+struct PagedAttentionArgs {
+    const float* q = nullptr; // group rows of head_dim, ldq floats apart
+    std::size_t ldq = 0;
+    float* out = nullptr;     // group rows of head_dim, ldo floats apart
+    std::size_t ldo = 0;
+    std::size_t group = 1;    // 1..kMaxAttentionGroup
+    const float* keys = nullptr;
+    const float* values = nullptr;
+    const std::uint32_t* blocks = nullptr; // at least ceil(tokens / block_tokens) entries
+    std::size_t block_stride = 0;          // floats between consecutive blocks
+    std::size_t block_tokens = 0;          // 1..kMaxAttentionBlockTokens
+    std::size_t tokens = 0;                // attend to positions [0, tokens); 0 writes zeros
+    std::size_t head_dim = 0;
+    float scale = 1.0f;
+};
+
+// Registered as "paged_attention" / DataType::FP32. SIMD variants use the
+// polynomial exp of kernels/reduce.h and sum in a different order, so they match
+// the scalar kernel to a few ulp rather than bit for bit.
+using PagedAttentionFn = void(const PagedAttentionArgs& args);
+
+void paged_attention_scalar(const PagedAttentionArgs& args);
+
+// Runs the best registered kernel for this host (resolved once).
+void paged_attention(const PagedAttentionArgs& args);
+
+} // namespace infer
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "inference_engine/kernels/linear.h"
+
+namespace infer {
+
+// Geometry of a 2-D convolution
+//   x[batch, in_channels, in_h, in_w] * w[out_channels, in_channels / groups, kernel_h, kernel_w]
+//     -> y[batch, out_channels, out_h(), out_w()]
+// with zero padding on each border. Weights are in ONNX (OIHW) order.
+struct Conv2dShape {
+    std::size_t batch = 1;
+    std::size_t in_channels = 0;
+    std::size_t in_h = 0;
+    std::size_t in_w = 0;
+    std::size_t out_channels = 0;
+    std::size_t kernel_h = 0;
+    std::size_t kernel_w = 0;
+    std::size_t stride_h = 1;
+    std::size_t stride_w = 1;
+    std::size_t pad_top = 0;
+    std::size_t pad_left = 0;
+    std::size_t pad_bottom = 0;
+    std::size_t pad_right = 0;
+    std::size_t dilation_h = 1;
+    std::size_t dilation_w = 1;
+    std::size_t groups = 1;
+
+    // Output extent; 0 when the dilated kernel does not fit the padded input.
+    [[nodiscard]] std::size_t out_h() const noexcept {
+        return outExtent(in_h + pad_top + pad_bottom, kernel_h, stride_h, dilation_h);
+    }
+    [[nodiscard]] std::size_t out_w() const noexcept {
+        return outExtent(in_w + pad_left + pad_right, kernel_w, stride_w, dilation_w);
+    }
+    // One input and one output channel per group.
+    [[nodiscard]] bool depthwise() const noexcept {
+        return groups > 1 && groups == in_channels && groups == out_channels;
+    }
+
+private:
+    static std::size_t outExtent(std::size_t padded, std::size_t k, std::size_t s, std::size_t d) noexcept {
+        const std::size_t span = (k - 1) * d + 1;
+        return k == 0 || s == 0 || padded < span ? 0 : (padded - span) / s + 1;
+    }
+};
+
+// How conv2d() computes a convolution. Every algorithm gives the same result up to
+// rounding (Winograd trades a few ulp, F(4,3) more than F(2,3), for fewer multiplies).
+enum class ConvAlgorithm : std::uint8_t {
+    Auto,         // resolved by select_conv_algorithm()
+    Im2colGemm,   // unfold input patches and run the "linear" SGEMM; any geometry
+    DirectNchwc,  // register-blocked direct convolution over NCHW{block}c tensors; groups == 1
+    WinogradF2x3, // F(2x2, 3x3) tiles as batched SGEMMs; 3x3, stride 1, dilation 1, groups == 1
+    WinogradF4x3, // F(4x4, 3x3) tiles; same constraints
+    Depthwise,    // per-channel kernel; Conv2dShape::depthwise()
+};
+
+[[nodiscard]] const char* conv_algorithm_name(ConvAlgorithm algorithm) noexcept;
+// False for Auto and for algorithms that cannot compute `shape`.
+[[nodiscard]] bool conv_algorithm_supports(ConvAlgorithm algorithm, const Conv2dShape& shape) noexcept;
+
+// Shape heuristics: depthwise kernels for depthwise convolutions, SGEMM for grouped
+// and pointwise ones, Winograd for 3x3 stride-1 layers with enough channels and
+// output, DirectNchwc (only when `allow_blocked`, since it needs the blocked layout)
+// for layers with at least one full output-channel block, im2col + SGEMM otherwise.
+[[nodiscard]] ConvAlgorithm select_conv_algorithm(const Conv2dShape& shape, bool allow_blocked);
+// Times every supported algorithm once on synthetic data and returns the fastest
+// (DirectNchwc without its layout conversions). Results are cached per shape and
+// `allow_blocked` for the life of the process, so each geometry is measured once.
+[[nodiscard]] ConvAlgorithm autotune_conv_algorithm(const Conv2dShape& shape, bool allow_blocked);
+
+// Channel block of the NCHW{block}c layout: the lane count of the host's
+// "conv2d_nchwc" kernel (16 for AVX-512, 8 for AVX2 and scalar).
+[[nodiscard]] std::size_t conv_channel_block();
+
+// Floats pack_conv_weights() writes for `algorithm`; 0 when the algorithm reads the
+// OIHW weights as stored (Im2colGemm, Depthwise).
+//   DirectNchwc:  [out blocks][in blocks][kernel_h][kernel_w][in lane][out lane], zero-padded
+//   Winograd:     [alpha * alpha][out_channels][in_channels], alpha = tile + 2
+[[nodiscard]] std::size_t packed_conv_weights_size(ConvAlgorithm algorithm, const Conv2dShape& shape);
+void pack_conv_weights(ConvAlgorithm algorithm, const Conv2dShape& shape, const float* w, float* dst);
+
+// One convolution with fused bias (per output channel, may be null) and activation.
+// `w` is the output of pack_conv_weights() for algorithms that pack, the OIHW
+// weights otherwise. DirectNchwc reads and writes NCHW{conv_channel_block()}c
+// tensors (see nchw_to_nchwc); every other algorithm plain NCHW. Work is split
+// across ThreadPool::current() through parallelFor. Throws std::invalid_argument
+// when the algorithm cannot compute the shape.
+struct Conv2dArgs {
+    const float* x = nullptr;
+    const float* w = nullptr;
+    const float* bias = nullptr;
+    float* y = nullptr;
+    Conv2dShape shape{};
+    ConvAlgorithm algorithm = ConvAlgorithm::Im2colGemm;
+    Activation activation = Activation::None;
+};
+void conv2d(const Conv2dArgs& args);
+
+// Layout conversion between x[batch, channels, spatial] and the channel-blocked
+// y[batch, ceil(channels / block), spatial, block]. Blocked lanes past `channels`
+// are written as zero and ignored on the way back.
+void nchw_to_nchwc(const float* x, float* y, std::size_t batch, std::size_t channels, std::size_t spatial,
+                   std::size_t block);
+void nchwc_to_nchw(const float* x, float* y, std::size_t batch, std::size_t channels, std::size_t spatial,
+                   std::size_t block);
+
+// Row kernels behind conv2d(), registered per ISA under DataType::FP32:
+//   "conv2d_nchwc"         ConvNchwcRowFn     one output row of one output-channel block
+//   "conv2d_nchwc_block"   ConvBlockFn        its channel block
+//   "conv2d_depthwise_row" ConvDepthwiseRowFn one output row of one channel
+struct ConvNchwcRowArgs {
+    const float* x = nullptr;    // one image: [in_blocks][in_h][in_w][block]
+    const float* w = nullptr;    // one output block: [in_blocks][kernel_h][kernel_w][block][block]
+    const float* bias = nullptr; // bias_count values (the rest of the block is 0), may be null
+    std::size_t bias_count = 0;
+    float* y = nullptr; // output row: [out_w][block]
+    std::size_t in_blocks = 0;
+    std::size_t in_h = 0;
+    std::size_t in_w = 0;
+    std::size_t kernel_h = 0;
+    std::size_t kernel_w = 0;
+    std::size_t stride_h = 1;
+    std::size_t stride_w = 1;
+    std::size_t dilation_h = 1;
+    std::size_t dilation_w = 1;
+    std::size_t pad_top = 0;
+    std::size_t pad_left = 0;
+    std::size_t oh = 0; // output row index
+    std::size_t out_w = 0;
+    Activation activation = Activation::None;
+};
+
+struct ConvDepthwiseRowArgs {
+    const float* x = nullptr; // one channel: [in_h][in_w]
+    const float* w = nullptr; // [kernel_h][kernel_w]
+    float bias = 0.0f;
+    float* y = nullptr; // output row: [out_w]
+    std::size_t in_h = 0;
+    std::size_t in_w = 0;
+    std::size_t kernel_h = 0;
+    std::size_t kernel_w = 0;
+    std::size_t stride_h = 1;
+    std::size_t stride_w = 1;
+    std::size_t dilation_h = 1;
+    std::size_t dilation_w = 1;
+    std::size_t pad_top = 0;
+    std::size_t pad_left = 0;
+    std::size_t oh = 0;
+    std::size_t out_w = 0;
+    Activation activation = Activation::None;
+};
+
+using ConvNchwcRowFn = void(const ConvNchwcRowArgs& args);
+using ConvBlockFn = std::size_t();
+using ConvDepthwiseRowFn = void(const ConvDepthwiseRowArgs& args);
+
+} // namespace infer
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace infer {
+
+// Signatures of the FP32 <-> FP16 buffer conversion kernels registered under
+// "fp32_to_fp16" and "fp16_to_fp32", keyed by DataType::FP16. Halves are passed as
+// their raw binary16 bits (core::Half is layout-compatible). Every variant rounds
+// to nearest even and matches the scalar conversions in core/half.h bit for bit,
+// including subnormals and NaN payloads.
+using ConvertFp32ToFp16Fn = void(const float* input, std::uint16_t* output, std::size_t count);
+using ConvertFp16ToFp32Fn = void(const std::uint16_t* input, float* output, std::size_t count);
+
+} // namespace infer
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+
+namespace infer {
+
+// Instruction-set families a kernel can be built for, in increasing order of
+// preference within a family.
+enum class Isa : std::uint8_t {
+    Scalar = 0,
+    AVX2 = 1,         // AVX2 + FMA + F16C
+    AVX512 = 2,       // AVX-512 F/BW/DQ/VL
+    NEON = 3,         // AArch64 Advanced SIMD
+    AVX512_VNNI = 4,  // AVX512 + VNNI (vpdpbusd)
+    NEON_DOTPROD = 5, // NEON + dot product (sdot)
+};
+
+[[nodiscard]] const char* isa_to_string(Isa isa) noexcept;
+
+// Preference rank used when several kernels are runnable: higher wins.
+[[nodiscard]] constexpr int isa_rank(Isa isa) noexcept {
+    switch (isa) {
+    case Isa::AVX2: return 1;
+    case Isa::NEON: return 1;
+    case Isa::AVX512: return 2;
+    case Isa::NEON_DOTPROD: return 2;
+    case Isa::AVX512_VNNI: return 3;
+    default: return 0;
+    }
+}
+
+// Features of the host CPU (and OS register-state support), detected once via
+// cpuid/xgetbv on x86 and hwcaps on ARM.
+struct CpuFeatures {
+    bool avx2 = false;
+    bool fma = false;
+    bool f16c = false;
+    bool avx512f = false;
+    bool avx512bw = false;
+    bool avx512dq = false;
+    bool avx512vl = false;
+    bool avx512_vnni = false;
+    bool avx_vnni = false;
+    bool neon = false;
+    bool neon_dotprod = false;
+    bool neon_fp16 = false;
+};
+
+[[nodiscard]] const CpuFeatures& cpu_features() noexcept;
+
+// Whether the host can execute kernels built for `isa`.
+[[nodiscard]] bool isa_supported(Isa isa) noexcept;
+
+// Highest ISA the dispatcher may pick: the best the host supports, optionally
+// capped by the INFER_ENGINE_MAX_ISA environment variable ("scalar", "avx2",
+// "avx512", "avx512_vnni", "neon", "neon_dotprod"), read once at startup.
+[[nodiscard]] Isa max_isa() noexcept;
+
+} // namespace infer
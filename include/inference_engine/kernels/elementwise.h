@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "inference_engine/core/shape.h"
+
+namespace infer {
+
+// Unary FP32 functions of the elementwise engine (and FusedElementwiseOp steps).
+enum class ElementwiseKind : std::uint8_t {
+    ReLU,
+    Sigmoid,
+    Tanh,
+    GELU, // exact form: 0.5 * x * (1 + erf(x / sqrt(2)))
+};
+
+// Binary FP32 functions. Max/Min follow the SIMD max/min instructions:
+// a > b ? a : b and a < b ? a : b, so a NaN in either operand yields b.
+enum class BinaryKind : std::uint8_t {
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Max,
+    Min,
+};
+
+// How the operands of a binary inner loop advance: both by one element, or one of
+// them pinned to its first element (a scalar broadcast along the loop).
+enum class BinaryOperands : std::uint8_t {
+    VectorVector,
+    VectorScalar, // b[0] for every i
+    ScalarVector, // a[0] for every i
+};
+
+// Signatures of the inner loops registered under "elementwise_unary" and
+// "elementwise_binary", keyed by DataType::FP32. y may alias x (or a/b when they
+// advance); n elements are written. SIMD variants agree with the scalar kernel
+// exactly for ReLU and every binary kind; Sigmoid and Tanh use polynomial
+// approximations within 4 ulp, GELU one within 2.5e-7 * max(1, |x|) absolute.
+using ElementwiseUnaryFn = void(ElementwiseKind kind, const float* x, float* y, std::size_t n);
+using ElementwiseBinaryFn = void(BinaryKind kind, BinaryOperands operands, const float* a, const float* b, float* y,
+                                 std::size_t n);
+
+// y = steps[k-1](...steps[0](x)) over n dense elements. Each L1-sized block goes
+// through the whole chain before the next one is read, and inputs of at least
+// 64K elements are split across ThreadPool::current(). y may equal x.
+void elementwise_unary(const ElementwiseKind* steps, std::size_t num_steps, const float* x, float* y,
+                       std::size_t n);
+
+// y = post(a op b) with NumPy broadcasting: a and b are dense row-major arrays of
+// shapes that broadcast to y_shape (throws std::invalid_argument otherwise), and
+// the optional `post` chain is applied to each block while it is still in L1.
+// Broadcast dimensions get stride 0, size-1 dimensions are dropped and dimensions
+// contiguous in all three arrays are merged, so the work reduces to inner loops
+// over vector-vector, vector-scalar (a scalar multiplier, a bias column) or
+// scalar-vector runs, repeated per outer index ("add a bias row" becomes a
+// vector-vector loop over each row). Large outputs are split across the pool.
+// y must not partially overlap a or b.
+void elementwise_binary(BinaryKind kind, const float* a, const inference_engine::core::Shape& a_shape,
+                        const float* b, const inference_engine::core::Shape& b_shape, float* y,
+                        const inference_engine::core::Shape& y_shape, const ElementwiseKind* post = nullptr,
+                        std::size_t num_post = 0);
+
+} // namespace infer
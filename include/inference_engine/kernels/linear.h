@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace infer {
+
+// Activation applied in the epilogue of a dense kernel, after the bias add.
+enum class Activation : std::uint8_t {
+    None,
+    ReLU,
+};
+
+// Arguments of a row-major dense product with fused epilogue:
+//   y[m, n] = act(x[m, k] * w[k, n] + bias[n])
+// Leading dimensions are in elements, so callers can address a sub-block of larger
+// matrices (e.g. one column panel per thread). `bias` may be null.
+struct LinearArgs {
+    const float* x = nullptr;
+    std::size_t ldx = 0;
+    const float* w = nullptr;
+    std::size_t ldw = 0;
+    const float* bias = nullptr;
+    float* y = nullptr;
+    std::size_t ldy = 0;
+    std::size_t m = 0;
+    std::size_t k = 0;
+    std::size_t n = 0;
+    Activation activation = Activation::None;
+};
+
+// Same product with FP16 weights: `w` holds binary16 bits (core::Half is
+// layout-compatible). Weights are widened to FP32 as they are loaded and all
+// products and sums stay in FP32, so a weight-bound layer moves half the bytes of
+// the FP32 path at close to FP32 accuracy.
+struct LinearFp16Args {
+    const float* x = nullptr;
+    std::size_t ldx = 0;
+    const std::uint16_t* w = nullptr;
+    std::size_t ldw = 0;
+    const float* bias = nullptr;
+    float* y = nullptr;
+    std::size_t ldy = 0;
+    std::size_t m = 0;
+    std::size_t k = 0;
+    std::size_t n = 0;
+    Activation activation = Activation::None;
+};
+
+// Same product with weights prepacked once by pack_linear_weights() for the host's
+// "linear_packed" kernel, so no call packs B and few-row products stream each
+// panel contiguously. `w` points at the panel holding this call's first column:
+// for a column range starting at col0 (a multiple of `panel`), w = packed + col0 * k.
+struct LinearPackedArgs {
+    const float* x = nullptr;
+    std::size_t ldx = 0;
+    const float* w = nullptr;
+    std::size_t panel = 0; // columns per panel; must equal linear_packed_panel()
+    const float* bias = nullptr;
+    float* y = nullptr;
+    std::size_t ldy = 0;
+    std::size_t m = 0;
+    std::size_t k = 0;
+    std::size_t n = 0;
+    Activation activation = Activation::None;
+};
+
+// Panel width of the "linear_packed"/FP32 kernel selected for the host: its
+// register-block width (32 for AVX-512, 16 for AVX2 and scalar, 12 for NEON).
+[[nodiscard]] std::size_t linear_packed_panel();
+
+// Floats pack_linear_weights() writes for w[k, n]: k * ceil(n / panel) * panel.
+[[nodiscard]] std::size_t packed_linear_size(std::size_t k, std::size_t n, std::size_t panel) noexcept;
+
+// Re-lays out row-major w[k, n] (leading dimension ldw) into panels of `panel`
+// columns, each holding all k rows contiguously:
+//   dst[(j / panel * k + p) * panel + j % panel] = w[p * ldw + j]
+// Columns past n are zero, so every panel is full.
+void pack_linear_weights(const float* w, std::size_t ldw, std::size_t k, std::size_t n, std::size_t panel,
+                         float* dst);
+
+// Runs the "linear"/FP32 kernel the KernelRegistry selects for the host CPU (resolved
+// on first call). Single-threaded; callers partition the work.
+void linear(const LinearArgs& args);
+
+// Runs the "linear"/FP16 (FP16-weight) kernel selected for the host; same contract.
+void linear_fp16(const LinearFp16Args& args);
+
+// Runs the "linear_packed"/FP32 kernel selected for the host; same contract.
+// Throws std::invalid_argument when args.panel is not linear_packed_panel().
+void linear_packed(const LinearPackedArgs& args);
+
+} // namespace infer
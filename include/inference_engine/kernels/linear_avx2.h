@@ -0,0 +1,25 @@
+#pragma once
+
+#include "inference_engine/kernels/linear.h"
+
+namespace infer {
+
+// Cache-blocked SGEMM: MC x KC panels of x and KC x NC panels of w are packed into
+// contiguous micro-panels and multiplied by a 6x16 register-blocked FMA micro-kernel.
+// Bias is loaded into the accumulators and the activation is applied before the
+// final store, so the output is written once.
+//
+// Only compiled into x86 builds with ENABLE_SIMD, and only safe to call on hosts
+// with AVX2, FMA and F16C; linear() reaches it through the KernelRegistry.
+void linear_avx2(const LinearArgs& args);
+
+// FP16-weight variant with the same blocking; weights are widened while packing
+// (or, on the few-row path, as they stream in).
+void linear_fp16_avx2(const LinearFp16Args& args);
+
+// linear_packed() variant: the same micro-kernel reading prepacked panels of its
+// register-block width (linear_packed_panel_avx2()) instead of packing B per call.
+void linear_packed_avx2(const LinearPackedArgs& args);
+std::size_t linear_packed_panel_avx2();
+
+} // namespace infer
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "inference_engine/kernels/linear.h"
+
+namespace infer {
+
+// AVX-512 variant of linear_avx2(): same blocking scheme with a 12x32 micro-kernel
+// (24 zmm accumulators) and masked loads/stores for the few-row path.
+//
+// Only compiled into x86 builds with ENABLE_SIMD, and only safe to call on hosts
+// with AVX-512 F/BW/DQ/VL; linear() reaches it through the KernelRegistry.
+void linear_avx512(const LinearArgs& args);
+
+// FP16-weight variant with the same blocking; weights are widened while packing
+// (or, on the few-row path, as they stream in).
+void linear_fp16_avx512(const LinearFp16Args& args);
+
+// linear_packed() variant: the same micro-kernel reading prepacked panels of its
+// register-block width (linear_packed_panel_avx512()) instead of packing B per call.
+void linear_packed_avx512(const LinearPackedArgs& args);
+std::size_t linear_packed_panel_avx512();
+
+} // namespace infer
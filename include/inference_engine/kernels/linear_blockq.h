@@ -0,0 +1,66 @@
+#pragma once
+
+#include "inference_engine/core/half.h"
+#include "inference_engine/kernels/linear.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace infer {
+
+// Weight-only block quantization: weights w[k, n] are stored as signed 4- or 8-bit
+// integers, with one FP16 scale per run of `group` consecutive k values of a column
+// (w[p, j] ~= q[p, j] * scale[p / group, j]). Activations, bias and accumulation
+// stay FP32; the kernels widen and scale the weights in registers, so a
+// weight-bound layer streams a quarter (INT8) or an eighth (INT4) of the FP32
+// bytes.
+//
+// Packed layout, in panels of kBlockQPanel output columns (columns past n are zero):
+//   weights: [panels][k][kBlockQPanel * bits / 8] bytes. INT8 is one signed byte per
+//            column; INT4 is offset binary (q + 8), byte c holding column c in its
+//            low nibble and column c + 8 in its high nibble.
+//   scales:  [panels][k / group][kBlockQPanel] binary16 values.
+constexpr std::size_t kBlockQPanel = 16;
+
+// Bytes of packed weights / number of scales for w[k, n]. k must be a multiple of group.
+[[nodiscard]] std::size_t blockq_weight_bytes(std::size_t k, std::size_t n, int bits) noexcept;
+[[nodiscard]] std::size_t blockq_scale_count(std::size_t k, std::size_t n, std::size_t group) noexcept;
+
+// Packs row-major q[k, n] (values in +-(2^(bits-1) - 1)) and scales[k / group, n]
+// into the layout above. Throws std::invalid_argument for bits other than 4 or 8,
+// a group that does not divide k, or a value out of range.
+void pack_blockq_weights(const std::int8_t* q, const inference_engine::core::Half* scales, std::size_t k,
+                         std::size_t n, int bits, std::size_t group, std::uint8_t* weights_dst,
+                         inference_engine::core::Half* scales_dst);
+
+// y[m, n] = act(x[m, k] * dequant(w)[k, n] + bias[n]). `w` and `scales` point at the
+// panel holding this call's first column: for a column range starting at col0 (a
+// multiple of kBlockQPanel), w = packed + col0 / kBlockQPanel * blockq_weight_bytes(k,
+// kBlockQPanel, bits) and scales = packed_scales + col0 * (k / group). `bias` may be null.
+struct LinearBlockQArgs {
+    const float* x = nullptr;
+    std::size_t ldx = 0;
+    const std::uint8_t* w = nullptr;
+    const std::uint16_t* scales = nullptr; // binary16 bits
+    int bits = 4;
+    std::size_t group = 32;
+    const float* bias = nullptr;
+    float* y = nullptr;
+    std::size_t ldy = 0;
+    std::size_t m = 0;
+    std::size_t k = 0;
+    std::size_t n = 0;
+    Activation activation = Activation::None;
+};
+
+using LinearBlockQFn = void(const LinearBlockQArgs& args);
+
+// Runs the "linear_blockq"/FP32 kernel selected for the host. Single-threaded;
+// callers partition the work. Throws std::invalid_argument on unsupported bits or
+// a group that does not divide k.
+void linear_blockq(const LinearBlockQArgs& args);
+
+// Portable reference; the SIMD variants only reassociate its FP32 sums.
+void linear_blockq_scalar(const LinearBlockQArgs& args);
+
+} // namespace infer
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "inference_engine/core/dtype.h"
+#include "inference_engine/kernels/linear.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace infer {
+
+// INT8 weights [k, n] (row-major, symmetric, values in [-127, 127]) repacked once
+// into the layout every INT8 kernel consumes: panels of 16 output columns, each
+// panel a sequence of k/4 groups of 16 columns x 4 consecutive k values
+// (64 bytes), i.e. data[((panel * k_groups + g) * 16 + col) * 4 + kk]. This is the
+// operand order of vpdpbusd/pmaddubsw (4 k per int32 lane) and of NEON sdot.
+// Padding (k beyond k, columns beyond n) is zero.
+struct PackedInt8Weights {
+    static constexpr std::size_t kPanel = 16;
+
+    std::size_t k = 0;
+    std::size_t n = 0;
+    std::size_t k_groups = 0; // ceil(k / 4)
+    std::size_t panels = 0;   // ceil(n / 16)
+    std::vector<std::int8_t> data{};
+    // Column sums of the weights, for the activation zero-point correction.
+    std::vector<std::int32_t> col_sums{};
+
+    [[nodiscard]] const std::int8_t* panel(std::size_t p) const noexcept {
+        return data.data() + p * k_groups * kPanel * 4;
+    }
+};
+
+// Packs row-major weights w[k, n]. Throws std::invalid_argument if a weight is -128
+// (the AVX2 kernel's sign trick needs symmetric [-127, 127] weights).
+[[nodiscard]] PackedInt8Weights pack_int8_weights(const std::int8_t* w, std::size_t k, std::size_t n);
+
+// y[m, n] = epilogue(sum_k (x[m, k] - x_zero_point) * w[k, n] + bias[n])
+//
+// Activations are INT8 or UINT8 (x_dtype) with a per-tensor zero point. The INT32
+// accumulator is requantized in the epilogue:
+//   INT8/UINT8 output: clamp(nearbyint(acc * scales[n]) + y_zero_point), with
+//                      scales = x_scale * w_scale[n] / y_scale;
+//   FP32 output:       acc * scales[n], with scales = x_scale * w_scale[n].
+// ReLU clamps at y_zero_point (zero for FP32). Columns [col_begin, col_begin + n)
+// of the packed weights are computed; col_begin must be a multiple of 16 and y,
+// bias and scales point at column col_begin (as LinearArgs does for a column tile).
+struct LinearInt8Args {
+    const void* x = nullptr;
+    std::size_t ldx = 0;
+    inference_engine::core::DataType x_dtype = inference_engine::core::DataType::UINT8;
+    std::int32_t x_zero_point = 0;
+
+    const PackedInt8Weights* w = nullptr;
+    std::size_t col_begin = 0;
+    const std::int32_t* bias = nullptr; // may be null
+    const float* scales = nullptr;      // one per output column
+
+    void* y = nullptr; // y_dtype elements
+    std::size_t ldy = 0;
+    inference_engine::core::DataType y_dtype = inference_engine::core::DataType::UINT8;
+    std::int32_t y_zero_point = 0;
+
+    std::size_t m = 0;
+    std::size_t n = 0;
+    Activation activation = Activation::None;
+};
+
+using LinearInt8Fn = void(const LinearInt8Args& args);
+
+// Runs the "linear" kernel registered for DataType::INT8 that suits the host
+// (AVX-512 VNNI, AVX2, NEON dot product or scalar). Single-threaded. Throws
+// std::invalid_argument on unsupported dtypes or a misaligned column range.
+void linear_int8(const LinearInt8Args& args);
+
+// Portable reference; results of every SIMD variant match it exactly.
+void linear_int8_scalar(const LinearInt8Args& args);
+
+} // namespace infer
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "inference_engine/kernels/linear.h"
+
+namespace infer {
+
+// AArch64 Advanced SIMD variant of linear_avx2(): same blocking scheme with an 8x12
+// micro-kernel built on lane-indexed FMLA.
+//
+// Only compiled into AArch64 builds with ENABLE_SIMD; linear() reaches it through
+// the KernelRegistry.
+void linear_neon(const LinearArgs& args);
+
+// FP16-weight variant with the same blocking; weights are widened while packing
+// (or, on the few-row path, as they stream in).
+void linear_fp16_neon(const LinearFp16Args& args);
+
+// linear_packed() variant: the same micro-kernel reading prepacked panels of its
+// register-block width (linear_packed_panel_neon()) instead of packing B per call.
+void linear_packed_neon(const LinearPackedArgs& args);
+std::size_t linear_packed_panel_neon();
+
+} // namespace infer
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "inference_engine/kernels/linear.h"
+
+namespace infer {
+
+// Reference single-row dense layer: output[j] = bias[j] + sum_i input[i] * weights[i, j],
+// with `weights` row-major [input_size, output_size]. `bias` may be null.
+void linear_scalar(const float* input, const float* weights, const float* bias, float* output,
+                   int input_size, int output_size);
+
+// Portable reference implementation of linear(); also the correctness oracle for the
+// SIMD kernels.
+void linear_scalar(const LinearArgs& args);
+
+// Portable reference of linear_fp16(): widens each weight with core::fp16_to_fp32.
+void linear_fp16_scalar(const LinearFp16Args& args);
+
+// Portable linear_packed() kernel over 16-column panels; the reference for the
+// SIMD packed kernels. linear_packed_panel_scalar() returns its panel width.
+void linear_packed_scalar(const LinearPackedArgs& args);
+std::size_t linear_packed_panel_scalar();
+
+} // namespace infer
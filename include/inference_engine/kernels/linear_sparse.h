@@ -0,0 +1,113 @@
+#pragma once
+
+#include "inference_engine/kernels/linear.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace infer {
+
+// Sparse FP32 weights for pruned dense layers, y[m, n] = act(x[m, k] * W[k, n] + bias).
+// The kernels multiply only the weights a pattern keeps, so a layer pruned to 25%
+// streams and multiplies roughly a quarter of the dense work. Two formats:
+//
+// N:M structured (SparseFormat::NM, e.g. 2:4): each column keeps at most n weights in
+// every run of m consecutive input rows. Packed in panels of kSparsePanel columns:
+//   values:  [panels][k / m][n][kSparsePanel] floats; unused slots and columns past
+//            the last hold zero
+//   indices: same shape, bytes; the row of each slot within its run (0 .. m - 1)
+// The kernels pick x[run * m + index] per column with one register permute, so m is
+// 4 or 8 and k a multiple of m.
+//
+// Block CSR (SparseFormat::BlockCsr): W cut into blocks of block_out output columns
+// by block_in input rows ("8x1" and "4x4" in the usual [out_dim, in_dim] view, the
+// two supported shapes); the all-zero blocks are dropped. A block row is block_out
+// columns (the last padded with zeros); k must be a multiple of block_in.
+//   row_ptr: [n / block_out + 1], the first block of each block row, then the total
+//   col_idx: [blocks], the input block (rows col_idx * block_in ...) of each block
+//   values:  [blocks][block_in][block_out] floats
+enum class SparseFormat : std::uint8_t { NM, BlockCsr };
+
+struct SparsePattern {
+    SparseFormat format = SparseFormat::NM;
+    std::size_t n = 2; // NM: at most n kept weights in every run of m input rows
+    std::size_t m = 4;
+    std::size_t block_out = 8; // BlockCsr block shape
+    std::size_t block_in = 1;
+
+    [[nodiscard]] static SparsePattern nm(std::size_t n, std::size_t m) noexcept {
+        return {SparseFormat::NM, n, m, 8, 1};
+    }
+    [[nodiscard]] static SparsePattern blockCsr(std::size_t block_out, std::size_t block_in) noexcept {
+        return {SparseFormat::BlockCsr, 2, 4, block_out, block_in};
+    }
+};
+
+constexpr std::size_t kSparsePanel = 16;
+
+// "2:4", "bcsr8x1", ...
+[[nodiscard]] std::string sparse_pattern_name(const SparsePattern& pattern);
+// False for pattern parameters the kernels do not implement or that do not tile k.
+[[nodiscard]] bool sparse_pattern_supported(const SparsePattern& pattern, std::size_t k) noexcept;
+// Whether w[k, n] keeps at most n of every m weights (always true for BlockCsr when supported).
+[[nodiscard]] bool fits_sparse_pattern(const float* w, std::size_t k, std::size_t n, const SparsePattern& pattern);
+// Weights the kernel multiplies for w[k, n] in `pattern` (kept slots or block area, padding excluded).
+[[nodiscard]] std::size_t sparse_stored_weights(const float* w, std::size_t k, std::size_t n,
+                                                const SparsePattern& pattern);
+
+// Size of the N:M values (and indices) arrays and the number of block rows.
+[[nodiscard]] std::size_t sparse_nm_value_count(std::size_t k, std::size_t n, const SparsePattern& pattern) noexcept;
+[[nodiscard]] std::size_t sparse_block_rows(std::size_t n, const SparsePattern& pattern) noexcept;
+
+struct SparseWeights {
+    SparsePattern pattern{};
+    std::vector<float> values;
+    std::vector<std::uint8_t> indices;  // NM
+    std::vector<std::uint32_t> row_ptr; // BlockCsr
+    std::vector<std::uint32_t> col_idx; // BlockCsr
+};
+
+// Packs row-major w[k, n] into `pattern`. Throws std::invalid_argument for an
+// unsupported pattern or N:M weights with more than n non-zeros in a run.
+[[nodiscard]] SparseWeights pack_sparse_weights(const float* w, std::size_t k, std::size_t n,
+                                                const SparsePattern& pattern);
+// Row-major w[k, n] back from the packed arrays (null for the ones the format lacks).
+[[nodiscard]] std::vector<float> unpack_sparse_weights(const SparsePattern& pattern, std::size_t k, std::size_t n,
+                                                       const float* values, const std::uint8_t* indices,
+                                                       const std::uint32_t* row_ptr, const std::uint32_t* col_idx);
+
+// y[m, n] = act(x[m, k] * W[k, n] + bias[n]) over packed sparse weights. For a column
+// window starting at col0 (a multiple of kSparsePanel): NM values and indices point at
+// its panel (+ col0 / kSparsePanel * sparse_nm_value_count(k, kSparsePanel, pattern));
+// BlockCsr row_ptr at its block row (+ col0 / block_out) while col_idx and values
+// stay at the start, row_ptr entries being absolute. `bias` may be null.
+struct LinearSparseArgs {
+    const float* x = nullptr;
+    std::size_t ldx = 0;
+    SparsePattern pattern{};
+    const float* values = nullptr;
+    const std::uint8_t* indices = nullptr;
+    const std::uint32_t* row_ptr = nullptr;
+    const std::uint32_t* col_idx = nullptr;
+    const float* bias = nullptr;
+    float* y = nullptr;
+    std::size_t ldy = 0;
+    std::size_t m = 0;
+    std::size_t k = 0;
+    std::size_t n = 0;
+    Activation activation = Activation::None;
+};
+
+using LinearSparseFn = void(const LinearSparseArgs& args);
+
+// Runs the "linear_sparse"/FP32 kernel selected for the host. Single-threaded;
+// callers partition the work. Throws std::invalid_argument for an unsupported
+// pattern.
+void linear_sparse(const LinearSparseArgs& args);
+
+// Portable reference; the SIMD variants only reassociate its FP32 sums.
+void linear_sparse_scalar(const LinearSparseArgs& args);
+
+} // namespace infer
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace infer {
+
+// Signatures of the bulk (de)quantization kernels registered under "quantize",
+// "quantize_channels", "dequantize" and "dequantize_channels", keyed by the
+// quantized DataType (INT8 or UINT8).
+//
+// Quantization computes clamp(round_half_away(x * inv_scale + zero_point)), i.e. the
+// exact result of the scalar helpers in core/dtype.h, NaN mapping to the lower bound.
+// "_channels" variants take one inv_scale/zero_point per element (callers pass the
+// per-channel arrays for contiguous channel runs). Kernels do not validate; the
+// core/dtype.h buffer APIs check scales once per call.
+using QuantizeS8Fn = void(const float* input, std::int8_t* output, std::size_t count, float inv_scale,
+                          float zero_point);
+using QuantizeU8Fn = void(const float* input, std::uint8_t* output, std::size_t count, float inv_scale,
+                          float zero_point);
+using QuantizeS8ChannelsFn = void(const float* input, std::int8_t* output, std::size_t count,
+                                  const float* inv_scales, const float* zero_points);
+using QuantizeU8ChannelsFn = void(const float* input, std::uint8_t* output, std::size_t count,
+                                  const float* inv_scales, const float* zero_points);
+
+// Dequantization computes (q - zero_point) * scale.
+using DequantizeS8Fn = void(const std::int8_t* input, float* output, std::size_t count, float scale,
+                            std::int32_t zero_point);
+using DequantizeU8Fn = void(const std::uint8_t* input, float* output, std::size_t count, float scale,
+                            std::int32_t zero_point);
+using DequantizeS8ChannelsFn = void(const std::int8_t* input, float* output, std::size_t count,
+                                    const float* scales, const std::int32_t* zero_points);
+using DequantizeU8ChannelsFn = void(const std::uint8_t* input, float* output, std::size_t count,
+                                    const float* scales, const std::int32_t* zero_points);
+
+} // namespace infer
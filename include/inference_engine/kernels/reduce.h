@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace infer {
+
+// Signatures of the FP32 row kernels registered under the names below, keyed by
+// DataType::FP32. Every kernel works on one contiguous row of n elements; y may
+// equal x. SIMD variants keep several partial accumulators, so sums differ from
+// the scalar kernel in the last bits, and they use a polynomial exp (within 4 ulp).
+//
+//   "reduce_sum"      ReduceFn      sum of x (0 for an empty row)
+//   "reduce_max"      ReduceFn      max of x (-inf for an empty row)
+//   "reduce_moments"  MomentsFn     mean and population variance, two passes
+//   "softmax_row"     SoftmaxRowFn  y = exp(x - max) / sum
+//   "log_softmax_row" SoftmaxRowFn  y = x - max - log(sum exp(x - max))
+//   "layer_norm_row"  NormRowFn     y = (x - mean) / sqrt(var + eps) * gamma + beta
+//   "rms_norm_row"    NormRowFn     y = x / sqrt(mean(x^2) + eps) * gamma + beta
+//
+// gamma and beta hold n elements each; either may be null (1 and 0).
+using ReduceFn = float(const float* x, std::size_t n);
+using MomentsFn = void(const float* x, std::size_t n, float* mean, float* variance);
+using SoftmaxRowFn = void(const float* x, float* y, std::size_t n);
+using NormRowFn = void(const float* x, float* y, std::size_t n, const float* gamma, const float* beta,
+                       float epsilon);
+
+// Row drivers over `rows` rows of `n` contiguous elements. Row r of x starts at
+// x + r * x_row_stride and row r of y at y + r * y_row_stride (strides in elements,
+// as Tensor::strides() / element size gives them for the second-to-last axis).
+// The best registered kernel is resolved once; rows are split across
+// ThreadPool::current() through parallelFor when there are enough of them.
+void softmax_rows(const float* x, std::int64_t x_row_stride, float* y, std::int64_t y_row_stride, std::size_t rows,
+                  std::size_t n);
+void log_softmax_rows(const float* x, std::int64_t x_row_stride, float* y, std::int64_t y_row_stride,
+                      std::size_t rows, std::size_t n);
+void layer_norm_rows(const float* x, std::int64_t x_row_stride, float* y, std::int64_t y_row_stride,
+                     std::size_t rows, std::size_t n, const float* gamma, const float* beta, float epsilon);
+void rms_norm_rows(const float* x, std::int64_t x_row_stride, float* y, std::int64_t y_row_stride, std::size_t rows,
+                   std::size_t n, const float* gamma, const float* beta, float epsilon);
+
+} // namespace infer
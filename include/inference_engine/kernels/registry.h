@@ -0,0 +1,67 @@
+#pragma once
+
+#include "inference_engine/core/dtype.h"
+#include "inference_engine/kernels/cpu_features.h"
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace infer {
+
+// Type-erased kernel entry point; KernelRegistry::lookup() casts it back.
+using KernelFn = void (*)();
+
+struct KernelEntry {
+    std::string op;
+    inference_engine::core::DataType dtype = inference_engine::core::DataType::UNKNOWN;
+    Isa isa = Isa::Scalar;
+    KernelFn fn = nullptr;
+};
+
+// Kernel implementations keyed by (operator, data type, ISA). The built-in kernels
+// are registered when the registry is first used; only the ISAs compiled into this
+// build are present. Selection picks the highest-ranked ISA the host can run (see
+// max_isa()), so one binary uses AVX-512 where available and scalar code elsewhere.
+//
+// Callers resolve once and cache the function pointer: lookups take a lock.
+class KernelRegistry {
+public:
+    static KernelRegistry& instance();
+
+    void add(std::string op, inference_engine::core::DataType dtype, Isa isa, KernelFn fn);
+
+    template <typename Fn>
+    void add(std::string op, inference_engine::core::DataType dtype, Isa isa, Fn* fn) {
+        add(std::move(op), dtype, isa, reinterpret_cast<KernelFn>(fn));
+    }
+
+    // Best runnable kernel with ISA rank <= rank(max); nullptr when none matches.
+    [[nodiscard]] const KernelEntry* select(std::string_view op, inference_engine::core::DataType dtype,
+                                            Isa max) const;
+    [[nodiscard]] const KernelEntry* select(std::string_view op, inference_engine::core::DataType dtype) const {
+        return select(op, dtype, max_isa());
+    }
+
+    // Every registered kernel for (op, dtype) the host can execute.
+    [[nodiscard]] std::vector<const KernelEntry*> candidates(std::string_view op,
+                                                             inference_engine::core::DataType dtype) const;
+
+    // select() cast to the kernel's signature. Throws std::runtime_error when no
+    // kernel is registered for (op, dtype).
+    template <typename Fn>
+    [[nodiscard]] Fn* lookup(std::string_view op, inference_engine::core::DataType dtype) const {
+        return reinterpret_cast<Fn*>(requireEntry(op, dtype).fn);
+    }
+
+private:
+    KernelRegistry();
+    const KernelEntry& requireEntry(std::string_view op, inference_engine::core::DataType dtype) const;
+
+    mutable std::mutex mu_;
+    std::deque<KernelEntry> entries_;
+};
+
+} // namespace infer
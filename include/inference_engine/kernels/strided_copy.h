@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace infer {
+
+// Signature of the 2-D transpose micro-kernels registered under "transpose2d", keyed
+// by DataType::FP32 and used for every 4-byte element type (bits are moved, never
+// converted). Writes dst[c * ld_dst + r] = src[r * ld_src + c] for r < rows and
+// c < cols; leading dimensions are in elements.
+using Transpose2dFn = void(const void* src, std::size_t ld_src, void* dst, std::size_t ld_dst, std::size_t rows,
+                           std::size_t cols);
+
+// Copies the `rank`-dimensional array `dims` of `elem_size`-byte elements from `src`
+// to `dst`; strides are in bytes and either side may be any strided view (slice,
+// transpose, broadcast source). Size-1 dimensions are dropped and dimensions that
+// are contiguous in both layouts are merged first. The collapsed copy then runs as
+// memcpy of contiguous inner runs, as cache-blocked 2-D transposes when the source
+// and destination innermost dimensions differ (the registered "transpose2d" kernel
+// for 4-byte elements), or as a strided element gather otherwise. Copies of at
+// least 1 MiB are split across ThreadPool::current() through parallelFor.
+// The destination must not overlap the source.
+void strided_copy(const void* src, const std::int64_t* src_strides, void* dst, const std::int64_t* dst_strides,
+                  const std::int64_t* dims, std::size_t rank, std::size_t elem_size);
+
+} // namespace infer
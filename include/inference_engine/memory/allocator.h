@@ -8,6 +8,7 @@
  * - Keep a minimal virtual interface (`allocate`/`deallocate`) used throughout the codebase.
  * - Allow different backends (system malloc/free, Arena, etc.).
  * - Provide alignment controls and optional allocation tracking for debugging.
+ * - Control page size and NUMA placement of large buffers (PageAllocator).
  */
 
 #include <cstddef>
@@ -32,6 +33,9 @@ namespace core {
     struct AllocatorConfig {
         std::size_t alignment = alignof(std::max_align_t);
         bool track_allocations = false;
+        // Huge pages, NUMA node and pre-faulting of the backing memory. Honoured by
+        // PageAllocator and by the arena of ArenaAllocator; ignored by the others.
+        memory::PageOptions pages{};
     };
 
     /*
@@ -120,6 +124,9 @@ namespace core {
         explicit ArenaAllocator(std::size_t arena_capacity_bytes,
                                std::size_t arena_base_alignment = alignof(std::max_align_t),
                                AllocatorConfig config = {}) noexcept;
+        // Arena with explicit options, e.g. growable for workloads of unknown size.
+        explicit ArenaAllocator(const memory::Arena::Options& arena_options,
+                               AllocatorConfig config = {}) noexcept;
         ~ArenaAllocator() noexcept override;
 
         void* allocate(int64_t size_bytes) override;
@@ -146,12 +153,49 @@ namespace core {
         std::unique_ptr<TrackingState> tracking_;
     };
 
+    // Backed directly by page mappings (memory/pages.h): every allocation is its own
+    // mapping, so huge pages, NUMA binding and pre-faulting from the config apply per
+    // buffer. Meant for large, long-lived buffers such as weights and plan arenas;
+    // small requests still take at least one page. Thread-safe.
+    class PageAllocator final : public Allocator {
+    public:
+        explicit PageAllocator(AllocatorConfig config = {});
+        ~PageAllocator() noexcept override;
+
+        void* allocate(int64_t size_bytes) override;
+        void deallocate(void* ptr) noexcept override;
+        void* reallocate(void* ptr, int64_t new_size_bytes) override;
+
+        // Page size (huge page size with huge pages requested).
+        std::size_t alignment() const noexcept override { return alignment_; }
+        // Returns nullptr for alignments above alignment().
+        void* allocate_aligned(std::size_t size_bytes, std::size_t alignment_bytes) override;
+        bool owns(const void* ptr) const noexcept override;
+
+        // Mapping that backs a live allocation, or a region with data == nullptr.
+        memory::PageRegion region(const void* ptr) const noexcept;
+        const memory::PageOptions& pages() const noexcept { return pages_; }
+
+        bool tracking_enabled() const noexcept override { return track_allocations_; }
+        AllocationStats stats() const noexcept override;
+        void reset_stats() noexcept override;
+
+    private:
+        memory::PageOptions pages_{};
+        std::size_t alignment_ = 0;
+        bool track_allocations_ = false;
+
+        struct State;
+        std::unique_ptr<State> state_;
+    };
+
     // ==================== Factory helpers ====================
 
     std::unique_ptr<Allocator> make_system_allocator(AllocatorConfig config = {});
     std::unique_ptr<Allocator> make_arena_allocator(std::size_t arena_capacity_bytes,
                                                     std::size_t arena_base_alignment = alignof(std::max_align_t),
                                                     AllocatorConfig config = {});
+    std::unique_ptr<Allocator> make_page_allocator(AllocatorConfig config = {});
 
 } // namespace core
 } // namespace inference_engine
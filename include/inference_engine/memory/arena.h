@@ -5,27 +5,76 @@
  * Fast bump allocator (arena) for inference workloads.
  *
  * - Allocations are linear and extremely fast (bump pointer).
- * - Individual frees are not supported; call reset() to reuse the whole arena.
+ * - Individual frees are not supported; call reset() to reuse the whole arena, or
+ *   rewind to a Marker (ScratchScope) to release the most recent allocations.
+ * - A growable arena chains further chunks when the current one is full instead
+ *   of returning nullptr; a fixed arena (the default) never grows.
  * - Not thread-safe: use one Arena per thread (thread-local) or guard externally.
  */
 
 #include <cstddef>
+#include <vector>
+
+#include "inference_engine/memory/pages.h"
 
 namespace inference_engine {
 namespace memory {
 
 class Arena {
 public:
+    struct ChunkStats {
+        std::size_t capacity_bytes = 0;
+        std::size_t used_bytes = 0;
+        std::size_t peak_used_bytes = 0; // since the last reset()
+        std::size_t allocations = 0;     // since the last reset()
+        bool huge_pages = false;         // see PageRegion
+        int numa_node = kAnyNumaNode;
+    };
+
     struct Stats {
         std::size_t allocations = 0;
+        // High-water mark of used(), summed over chunks.
         std::size_t peak_used_bytes = 0;
+        // Chunks added since construction because the arena was full.
+        std::size_t growths = 0;
+        std::vector<ChunkStats> chunks{};
+    };
+
+    struct Options {
+        // Size of the first chunk, allocated up front (none when 0).
+        std::size_t initial_bytes = 0;
+        // Alignment of every chunk's backing allocation.
+        std::size_t base_alignment = alignof(std::max_align_t);
+        // Chain a new chunk when an allocation does not fit.
+        bool growable = false;
+        // Each new chunk is the previous one times this factor (at least the
+        // request that triggered it), capped at max_chunk_bytes when non-zero.
+        std::size_t growth_factor = 2;
+        std::size_t max_chunk_bytes = 0;
+        // Upper bound on the sum of all chunk capacities; 0 means unbounded.
+        std::size_t max_total_bytes = 0;
+        // Huge pages, NUMA node and pre-faulting for every chunk. Non-default
+        // options map chunks with map_pages() instead of the aligned heap.
+        PageOptions pages{};
     };
 
-    // Creates an arena with a pre-allocated buffer of `capacity_bytes`.
+    // Position of the bump pointer, for rewind().
+    struct Marker {
+        std::size_t chunk = 0;
+        std::size_t offset = 0;
+    };
+
+    // Creates a fixed arena with a pre-allocated buffer of `capacity_bytes`.
     // `base_alignment` controls the alignment of the backing allocation.
     explicit Arena(std::size_t capacity_bytes,
                   std::size_t base_alignment = alignof(std::max_align_t)) noexcept;
 
+    explicit Arena(const Options& options) noexcept;
+
+    // Growable arena whose first chunk holds `initial_bytes`.
+    static Arena growable(std::size_t initial_bytes,
+                          std::size_t base_alignment = alignof(std::max_align_t)) noexcept;
+
     Arena(const Arena&) = delete;
     Arena& operator=(const Arena&) = delete;
 
@@ -39,32 +88,79 @@ public:
     void* allocate(std::size_t size_bytes,
                    std::size_t alignment = alignof(std::max_align_t)) noexcept;
 
-    // Resets the bump pointer without freeing backing memory.
+    // Resets the bump pointer without freeing backing memory; chunks added by
+    // growth are kept and reused, in order, by the next cycle.
     // Also resets per-cycle stats (allocations, peak usage).
     void reset() noexcept;
 
-    // Capacity and usage
+    // Saves the bump pointer.
+    Marker mark() const noexcept { return Marker{current_, chunks_.empty() ? 0 : chunks_[current_].used}; }
+    // Releases everything allocated after `marker` was taken. Markers must
+    // be rewound in LIFO order; a marker taken before the last reset() is invalid.
+    void rewind(const Marker& marker) noexcept;
+
+    // Rewinds the arena to its state at construction when it goes out of scope, so
+    // kernels can take temporary scratch space (packing, im2col) without leaking it
+    // into the rest of the cycle. Scopes nest.
+    class ScratchScope {
+    public:
+        explicit ScratchScope(Arena& arena) noexcept : arena_(arena), marker_(arena.mark()) {}
+        ~ScratchScope() { arena_.rewind(marker_); }
+        ScratchScope(const ScratchScope&) = delete;
+        ScratchScope& operator=(const ScratchScope&) = delete;
+
+    private:
+        Arena& arena_;
+        Marker marker_;
+    };
+
+    // Capacity and usage, summed over all chunks. remaining() is what can be
+    // allocated without growing (ignoring alignment padding).
     std::size_t capacity() const noexcept { return capacity_bytes_; }
     std::size_t used() const noexcept { return used_bytes_; }
-    std::size_t remaining() const noexcept { return capacity_bytes_ - used_bytes_; }
+    std::size_t remaining() const noexcept;
+    std::size_t chunk_count() const noexcept { return chunks_.size(); }
+    bool is_growable() const noexcept { return options_.growable; }
 
-    Stats stats() const noexcept { return stats_; }
+    Stats stats() const;
 
-    // Returns true if `ptr` lies within the backing arena buffer.
+    // Returns true if `ptr` lies within one of the backing chunks.
     // Note: this does not guarantee `ptr` refers to the start of a live allocation.
     bool owns(const void* ptr) const noexcept;
 
 private:
+    struct Chunk {
+        void* base = nullptr;
+        PageRegion region{}; // set when the chunk came from map_pages()
+        std::size_t capacity = 0;
+        std::size_t used = 0;
+        std::size_t peak_used = 0;
+        std::size_t allocations = 0;
+    };
+
     static bool is_power_of_two(std::size_t x) noexcept;
     static std::size_t align_up(std::size_t value, std::size_t alignment) noexcept;
 
-    void* base_ = nullptr;
-    std::size_t capacity_bytes_ = 0;
+    void* try_allocate(Chunk& chunk, std::size_t size_bytes, std::size_t alignment) noexcept;
+    bool grow(std::size_t size_bytes, std::size_t alignment) noexcept;
+    bool add_chunk(std::size_t bytes) noexcept;
+    void release() noexcept;
+    static void release_chunk(const Chunk& chunk) noexcept;
+
+    Options options_{};
+    std::vector<Chunk> chunks_{};
+    std::size_t current_ = 0; // chunk holding the bump pointer
     std::size_t used_bytes_ = 0;
-    std::size_t base_alignment_ = alignof(std::max_align_t);
-    Stats stats_{};
+    std::size_t capacity_bytes_ = 0;
+    std::size_t allocations_ = 0;
+    std::size_t peak_used_bytes_ = 0;
+    std::size_t growths_ = 0;
 };
 
+// Per-thread growable scratch arena for kernel temporaries. Take space inside an
+// Arena::ScratchScope so it is released when the kernel returns.
+Arena& thread_scratch_arena() noexcept;
+
 } // namespace memory
 } // namespace inference_engine
 
@@ -0,0 +1,81 @@
+#ifndef INFERENCE_ENGINE_MEMORY_PAGES_H_
+#define INFERENCE_ENGINE_MEMORY_PAGES_H_
+
+/*
+ * Page-level memory mapping with huge-page, NUMA-placement and pre-fault control,
+ * for large long-lived buffers (weights, activation arenas).
+ *
+ * - HugePages::Transparent maps a huge-page-aligned region and asks the kernel to
+ *   back it with transparent huge pages (madvise(MADV_HUGEPAGE)).
+ * - HugePages::Explicit maps from the reserved hugetlbfs pool (MAP_HUGETLB) and
+ *   falls back to Transparent when no huge pages are reserved.
+ * - A NUMA node binds the pages to that node (mbind(MPOL_BIND)); kLocalNumaNode
+ *   picks the node of the CPU the calling thread runs on.
+ * - Pre-faulting touches every page up front (after binding), so the first
+ *   inference does not pay for page faults.
+ *
+ * Without mmap (non-Linux builds) the options are ignored and regions come from the
+ * aligned system allocator.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace inference_engine {
+namespace memory {
+
+enum class HugePages : std::uint8_t {
+    None,
+    Transparent,
+    Explicit,
+};
+
+constexpr int kAnyNumaNode = -1;   // no binding: first-touch placement
+constexpr int kLocalNumaNode = -2; // node of the calling thread's CPU
+
+struct PageOptions {
+    HugePages huge_pages = HugePages::None;
+    int numa_node = kAnyNumaNode;
+    bool prefault = false;
+
+    // True when none of the options is set, i.e. plain heap memory will do.
+    bool is_default() const noexcept {
+        return huge_pages == HugePages::None && numa_node == kAnyNumaNode && !prefault;
+    }
+};
+
+// A mapped region. `bytes` is the mapped size (the request rounded up to pages).
+struct PageRegion {
+    void* data = nullptr;
+    std::size_t bytes = 0;
+    bool huge_pages = false; // backed by explicit huge pages, or THP requested
+    int numa_node = kAnyNumaNode; // node the pages were bound to, if any
+    bool mapped = false;          // from mmap (false: aligned heap fallback)
+};
+
+// Maps at least `bytes` zero-initialized bytes aligned to at least the page size.
+// Returns a region with data == nullptr on failure. A binding the kernel rejects
+// (no NUMA support, node out of range) leaves the region unbound rather than failing.
+PageRegion map_pages(std::size_t bytes, const PageOptions& options) noexcept;
+void unmap_pages(const PageRegion& region) noexcept;
+
+// Touches every page of [data, data + bytes) so it is resident. `writable` chooses a
+// write fault (allocates, e.g. anonymous memory) over a read fault (file mappings).
+void prefault_pages(const void* data, std::size_t bytes, bool writable) noexcept;
+
+std::size_t page_size() noexcept;
+// Default huge page size (Hugepagesize in /proc/meminfo), 2 MiB when unknown.
+std::size_t huge_page_size() noexcept;
+
+// Number of NUMA nodes (1 on hosts without NUMA information).
+int numa_node_count() noexcept;
+// Node of the CPU the calling thread currently runs on (0 when unknown).
+int current_numa_node() noexcept;
+// CPUs of `node`, empty when unknown.
+std::vector<int> numa_node_cpus(int node);
+
+} // namespace memory
+} // namespace inference_engine
+
+#endif // INFERENCE_ENGINE_MEMORY_PAGES_H_
@@ -0,0 +1,93 @@
+#ifndef INFERENCE_ENGINE_MEMORY_POOL_ALLOCATOR_H_
+#define INFERENCE_ENGINE_MEMORY_POOL_ALLOCATOR_H_
+
+/*
+ * Size-class pool allocator for tensor buffers of dynamic-shape workloads.
+ *
+ * - Requests are rounded up to 64-byte-aligned size classes (64 B steps up to
+ *   1 KiB, then four classes per power of two up to `max_pooled_bytes`).
+ * - Each thread keeps a free list per class; allocate/deallocate touch no lock
+ *   while the list has blocks and stays under its limit.
+ * - Lists refill from, and spill to, a central depot in batches; the depot carves
+ *   new blocks out of slabs obtained from the system.
+ * - Larger requests (and alignments above 64) go straight to the system.
+ * - Pooled memory is returned to the system when the allocator is destroyed.
+ *
+ * Thread-safe. A block may be freed on a different thread than it was allocated on.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "inference_engine/memory/allocator.h"
+
+namespace inference_engine {
+namespace core {
+
+    struct PoolConfig {
+        // Largest pooled request; bigger ones are system allocations.
+        std::size_t max_pooled_bytes = std::size_t{4} << 20;
+        // Minimum size of a slab the depot carves blocks from.
+        std::size_t slab_bytes = std::size_t{256} << 10;
+        // Bytes moved between a thread cache and the depot in one transfer (at
+        // least two blocks, at most 32). A thread caches up to two transfers per class.
+        std::size_t transfer_bytes = std::size_t{64} << 10;
+    };
+
+    struct PoolStats {
+        std::size_t depot_fetches = 0;     // batches moved depot -> thread cache
+        std::size_t depot_returns = 0;     // batches moved thread cache -> depot
+        std::size_t slabs = 0;
+        std::size_t slab_bytes = 0;        // bytes obtained from the system for slabs
+        std::size_t direct_allocations = 0; // requests served by the system directly
+    };
+
+    class PoolAllocator final : public Allocator {
+    public:
+        // Every block is aligned to kAlignment.
+        static constexpr std::size_t kAlignment = 64;
+
+        explicit PoolAllocator(PoolConfig pool = {}, AllocatorConfig config = {});
+        ~PoolAllocator() noexcept override;
+
+        PoolAllocator(const PoolAllocator&) = delete;
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+        void* allocate(int64_t size_bytes) override;
+        void deallocate(void* ptr) noexcept override;
+        // Keeps the block when the new size fits its size class.
+        void* reallocate(void* ptr, int64_t new_size_bytes) override;
+
+        std::size_t alignment() const noexcept override { return kAlignment; }
+        void* allocate_aligned(std::size_t size_bytes, std::size_t alignment_bytes) override;
+        // True for live blocks when tracking, else for any address inside the pool's
+        // slabs or one of its direct allocations.
+        bool owns(const void* ptr) const noexcept override;
+
+        bool tracking_enabled() const noexcept override { return track_allocations_; }
+        AllocationStats stats() const noexcept override;
+        void reset_stats() noexcept override;
+
+        PoolStats pool_stats() const noexcept;
+
+        // Usable bytes of the block returned for a request of `size_bytes`.
+        std::size_t block_size(std::size_t size_bytes) const noexcept;
+
+        // Internal state shared with the per-thread caches.
+        struct Depot;
+
+    private:
+        std::shared_ptr<Depot> depot_;
+        bool track_allocations_ = false;
+
+        struct TrackingState;
+        std::unique_ptr<TrackingState> tracking_;
+    };
+
+    std::unique_ptr<Allocator> make_pool_allocator(PoolConfig pool = {}, AllocatorConfig config = {});
+
+} // namespace core
+} // namespace inference_engine
+
+#endif // INFERENCE_ENGINE_MEMORY_POOL_ALLOCATOR_H_
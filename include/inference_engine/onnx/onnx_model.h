@@ -0,0 +1,151 @@
+#pragma once
+
+// ONNX importer. OnnxModel maps a .onnx file and walks its protobuf in place: the
+// graph structure (nodes, attributes, value infos, initializer metadata) is decoded
+// up front, but initializer payloads are only recorded as byte ranges. They are
+// read the first time initializerData() asks for them, and ONNX external-data files
+// are mapped only at that point. Inspecting a model, building a structure-only graph
+// and planning its memory therefore never touch weight bytes.
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "inference_engine/core/dtype.h"
+#include "inference_engine/core/mapped_file.h"
+#include "inference_engine/core/shape.h"
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/attributes.h"
+
+namespace infer {
+
+class Graph;
+
+struct OnnxOpset {
+    std::string domain; // empty for the default ai.onnx domain
+    std::int64_t version = 0;
+};
+
+// Declared type of a graph input/output or intermediate. Symbolic dims are -1 in
+// `dims` with their names in `dim_params`.
+struct OnnxValueInfo {
+    std::string name;
+    inference_engine::core::DataType dtype = inference_engine::core::DataType::UNKNOWN;
+    std::vector<std::int64_t> dims;
+    std::vector<std::string> dim_params;
+    bool has_shape = false;
+};
+
+struct OnnxInitializer {
+    enum class Storage : std::uint8_t {
+        Raw,      // raw_data or packed float_data: bytes usable as stored
+        Typed,    // int32_data/int64_data/... fields: decoded on first access
+        External, // ONNX external data file
+    };
+
+    std::string name;
+    inference_engine::core::DataType dtype = inference_engine::core::DataType::UNKNOWN;
+    std::vector<std::int64_t> dims;
+    Storage storage = Storage::Raw;
+    std::size_t offset = 0; // into the model file, or into `location` for External
+    std::size_t length = 0; // stored bytes (Raw/External) or the whole TensorProto (Typed)
+
+    // External data only: path relative to the model file's directory.
+    std::string location;
+
+    [[nodiscard]] std::int64_t numElements() const noexcept;
+    [[nodiscard]] std::size_t byteSize() const noexcept;
+};
+
+struct OnnxNode {
+    std::string name;
+    std::string op_type;
+    std::string domain;
+    std::vector<std::string> inputs;  // empty string = omitted optional input
+    std::vector<std::string> outputs;
+    AttributeMap attributes;
+};
+
+struct OnnxImportOptions {
+    // Build executable operators (reads the weights they use). When false every node
+    // becomes an OnnxNodeOp placeholder that carries its ONNX type and attributes,
+    // which is enough for inspection and planMemory().
+    bool load_weights = true;
+    // Value substituted for symbolic dimensions such as a dynamic batch.
+    std::int64_t symbolic_dim_value = 1;
+};
+
+class OnnxModel {
+public:
+    // Maps and parses `path`. Throws std::runtime_error on I/O or format errors.
+    explicit OnnxModel(const std::string& path);
+
+    OnnxModel(const OnnxModel&) = delete;
+    OnnxModel& operator=(const OnnxModel&) = delete;
+
+    [[nodiscard]] std::int64_t irVersion() const noexcept { return ir_version_; }
+    [[nodiscard]] const std::string& producerName() const noexcept { return producer_name_; }
+    [[nodiscard]] const std::string& producerVersion() const noexcept { return producer_version_; }
+    [[nodiscard]] const std::string& graphName() const noexcept { return graph_name_; }
+    [[nodiscard]] const std::vector<OnnxOpset>& opsets() const noexcept { return opsets_; }
+
+    [[nodiscard]] const std::vector<OnnxNode>& nodes() const noexcept { return nodes_; }
+    // Graph inputs exclude initializers (older exporters list them as inputs too).
+    [[nodiscard]] const std::vector<OnnxValueInfo>& inputs() const noexcept { return inputs_; }
+    [[nodiscard]] const std::vector<OnnxValueInfo>& outputs() const noexcept { return outputs_; }
+    [[nodiscard]] const std::vector<OnnxValueInfo>& valueInfos() const noexcept { return value_infos_; }
+    // Includes the tensors of Constant nodes, which the importer folds into weights.
+    [[nodiscard]] const std::vector<OnnxInitializer>& initializers() const noexcept { return initializers_; }
+
+    [[nodiscard]] const OnnxInitializer* findInitializer(const std::string& name) const noexcept;
+
+    // Total bytes of all initializers, from metadata only.
+    [[nodiscard]] std::size_t weightBytes() const noexcept;
+    // Bytes of weight data read or mapped so far (0 until initializerData() is used).
+    [[nodiscard]] std::size_t loadedWeightBytes() const;
+
+    // Non-owning view of an initializer's contents, loaded on first use. Views stay
+    // valid for the lifetime of the OnnxModel. Thread-safe.
+    [[nodiscard]] inference_engine::core::Tensor initializerData(const OnnxInitializer& init) const;
+
+    // Adds the model's Values, Nodes, inputs and outputs to the empty `graph`.
+    // Operators keep pointers to this model's attributes and weights, so the model
+    // must outlive the graph. Throws std::invalid_argument for operators that cannot
+    // be executed when options.load_weights is set.
+    void buildGraph(Graph& graph, const OnnxImportOptions& options = {});
+
+private:
+    void parseModel(const std::uint8_t* data, std::size_t size);
+    void parseGraph(const std::uint8_t* data, std::size_t size);
+
+    inference_engine::core::MappedFile file_;
+    std::string directory_;
+
+    std::int64_t ir_version_ = 0;
+    std::string producer_name_;
+    std::string producer_version_;
+    std::string graph_name_;
+    std::vector<OnnxOpset> opsets_;
+
+    std::vector<OnnxNode> nodes_;
+    std::vector<OnnxValueInfo> inputs_;
+    std::vector<OnnxValueInfo> outputs_;
+    std::vector<OnnxValueInfo> value_infos_;
+    std::vector<OnnxInitializer> initializers_;
+
+    // Lazily loaded weight storage, guarded by mutex_.
+    struct ExternalFile {
+        std::string location;
+        std::unique_ptr<inference_engine::core::MappedFile> file;
+    };
+    mutable std::mutex mutex_;
+    mutable std::vector<ExternalFile> external_files_;
+    mutable std::vector<std::unique_ptr<std::vector<std::uint8_t>>> decoded_;
+    mutable std::vector<const void*> loaded_; // per initializer, nullptr until loaded
+    mutable std::size_t loaded_bytes_ = 0;
+};
+
+} // namespace infer
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "inference_engine/graph/operator.h"
+
+namespace infer {
+
+// Structure-only stand-in for an ONNX node, produced when a model is imported with
+// OnnxImportOptions::load_weights = false. type() is the ONNX op type and the
+// attributes are the node's; estimateMemoryBytes() reports the node's initializer
+// bytes from metadata. Graphs of these support validation, sorting and memory
+// planning, but execute() throws.
+class OnnxNodeOp final : public Operator {
+public:
+    OnnxNodeOp(std::string op_type, std::string domain, std::size_t weight_bytes);
+
+    [[nodiscard]] std::size_t estimateMemoryBytes() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+    [[nodiscard]] const std::string& domain() const noexcept { return domain_; }
+
+private:
+    std::string domain_;
+    std::size_t weight_bytes_;
+};
+
+} // namespace infer
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+
+namespace infer {
+
+// Elementwise max(0, x).
+class ReluOp final : public Operator {
+public:
+    ReluOp();
+
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] BufferAlias outputAlias() const noexcept override { return BufferAlias::InPlace; }
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+private:
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+// Elementwise 1 / (1 + exp(-x)).
+class SigmoidOp final : public Operator {
+public:
+    SigmoidOp();
+
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] BufferAlias outputAlias() const noexcept override { return BufferAlias::InPlace; }
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+private:
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+// Elementwise tanh(x).
+class TanhOp final : public Operator {
+public:
+    TanhOp();
+
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] BufferAlias outputAlias() const noexcept override { return BufferAlias::InPlace; }
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+private:
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+// Elementwise 0.5 * x * (1 + erf(x / sqrt(2))) (exact, not the tanh approximation).
+class GeluOp final : public Operator {
+public:
+    GeluOp();
+
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] BufferAlias outputAlias() const noexcept override { return BufferAlias::InPlace; }
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+private:
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/kernels/elementwise.h"
+
+namespace infer {
+
+[[nodiscard]] const char* binaryKindName(BinaryKind kind) noexcept;
+
+// y = a op b over FP32 inputs with NumPy broadcasting (ONNX Add, Sub, Mul, Div,
+// Max, Min); the operator type is the kind's name. An optional epilogue of unary
+// steps runs on each block of the result while it is still in L1, so e.g.
+// Add + ReLU costs one pass over memory (see FuseElementwiseChainPass).
+class BinaryElementwiseOp final : public Operator {
+public:
+    explicit BinaryElementwiseOp(BinaryKind kind, std::vector<ElementwiseKind> epilogue = {});
+
+    [[nodiscard]] BinaryKind kind() const noexcept { return kind_; }
+    [[nodiscard]] const std::vector<ElementwiseKind>& epilogue() const noexcept { return epilogue_; }
+    void setEpilogue(std::vector<ElementwiseKind> steps) { epilogue_ = std::move(steps); }
+
+    void validate() const override;
+    void inferShapes() override;
+    // Only taken by the planner when input 0 already has the output's size.
+    [[nodiscard]] BufferAlias outputAlias() const noexcept override { return BufferAlias::InPlace; }
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+private:
+    BinaryKind kind_;
+    std::vector<ElementwiseKind> epilogue_;
+
+    // Used only when the graph has not bound planned memory to the output.
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
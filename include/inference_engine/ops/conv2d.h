@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/kernels/conv.h"
+#include "inference_engine/ops/weight_buffer.h"
+
+namespace infer {
+
+// Static geometry of a Conv2dOp; the batch and spatial extents come from the input.
+struct Conv2dParams {
+    std::int64_t in_channels = 0;
+    std::int64_t out_channels = 0;
+    std::int64_t kernel_h = 0;
+    std::int64_t kernel_w = 0;
+    std::int64_t stride_h = 1;
+    std::int64_t stride_w = 1;
+    std::int64_t pad_top = 0;
+    std::int64_t pad_left = 0;
+    std::int64_t pad_bottom = 0;
+    std::int64_t pad_right = 0;
+    std::int64_t dilation_h = 1;
+    std::int64_t dilation_w = 1;
+    std::int64_t groups = 1;
+};
+
+// 2-D convolution (ONNX Conv without auto_pad):
+//   y[N, out_channels, OH, OW] = act(conv(x[N, in_channels, H, W], W) + b)
+// with OIHW weights [out_channels, in_channels / groups, kernel_h, kernel_w] and an
+// optional bias. "strides", "pads" (top, left, bottom, right), "dilations",
+// "group" and "kernel_shape" attributes, decoded at compile time, replace the
+// constructor's values.
+//
+// The algorithm (see ConvAlgorithm) is fixed by prepare(): Auto takes
+// select_conv_algorithm() for the plain layout. With a channel block set
+// (ConvLayoutPass does this) input and output are NCHW{block}c tensors
+// [N, ceil(C / block), H, W, block] and the algorithm is DirectNchwc. Weights the
+// algorithm re-lays out are packed at compile time (prepackWeights / prepare).
+class Conv2dOp final : public Operator {
+public:
+    Conv2dOp(Conv2dParams params, WeightBuffer<float> weights, WeightBuffer<float> bias = {},
+             Activation activation = Activation::None);
+
+    void decodeAttributes(const AttributeMap& attrs) override;
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] std::size_t estimateMemoryBytes() const noexcept override;
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void prepackWeights(PackedWeightCache* cache, WeightStore* store, const std::string& key) override;
+    void prepare() override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+    [[nodiscard]] const Conv2dParams& params() const noexcept { return params_; }
+    [[nodiscard]] const WeightBuffer<float>& weights() const noexcept { return weights_; }
+    [[nodiscard]] const WeightBuffer<float>& bias() const noexcept { return bias_; }
+    [[nodiscard]] Activation activation() const noexcept { return activation_; }
+    void setActivation(Activation activation) noexcept { activation_ = activation; }
+
+    // Requested algorithm (default Auto) and the one prepare() resolved it to.
+    [[nodiscard]] ConvAlgorithm algorithm() const noexcept { return algorithm_; }
+    void setAlgorithm(ConvAlgorithm algorithm) noexcept { algorithm_ = algorithm; }
+    [[nodiscard]] ConvAlgorithm resolvedAlgorithm() const noexcept { return resolved_; }
+    // Channel block of the input and output layout; 0 for plain NCHW.
+    [[nodiscard]] std::size_t channelBlock() const noexcept { return channel_block_; }
+    void setChannelBlock(std::size_t block) noexcept { channel_block_ = block; }
+
+    // Kernel geometry for an input of `batch` images of in_h x in_w pixels.
+    [[nodiscard]] Conv2dShape convShape(std::size_t batch, std::size_t in_h, std::size_t in_w) const noexcept;
+
+private:
+    // Batch, height and width of the input Value, plain or blocked.
+    [[nodiscard]] Conv2dShape inputConvShape() const;
+    [[nodiscard]] ConvAlgorithm resolveAlgorithm() const;
+    // Fills packed_ for `algorithm`, through the cache when there is one.
+    void pack(ConvAlgorithm algorithm, PackedWeightCache* cache, WeightStore* store, const std::string& key);
+    [[nodiscard]] inference_engine::core::Shape outputShape(const Conv2dShape& s) const;
+
+    Conv2dParams params_;
+    WeightBuffer<float> weights_;
+    WeightBuffer<float> bias_;
+    Activation activation_;
+    ConvAlgorithm algorithm_ = ConvAlgorithm::Auto;
+    std::size_t channel_block_ = 0;
+    ConvAlgorithm resolved_ = ConvAlgorithm::Auto;
+    // pack_conv_weights() output for packed_algorithm_ (empty when it needs none).
+    WeightBuffer<float> packed_{};
+    ConvAlgorithm packed_algorithm_ = ConvAlgorithm::Auto;
+
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
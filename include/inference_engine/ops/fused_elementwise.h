@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/kernels/elementwise.h"
+
+namespace infer {
+
+[[nodiscard]] const char* elementwiseKindName(ElementwiseKind kind) noexcept;
+
+// y[i] = f(x[i]) for i < n through the elementwise engine; x may equal y.
+void applyElementwise(ElementwiseKind kind, const float* x, float* y, std::size_t n);
+
+// The unary elementwise steps `op` performs, in order: one for ReLU/Sigmoid/Tanh/GELU,
+// the whole chain for FusedElementwiseOp, nullopt for any other operator.
+[[nodiscard]] std::optional<std::vector<ElementwiseKind>> elementwiseSteps(const Operator& op);
+
+// A chain of unary FP32 elementwise functions applied in one pass: each block of
+// the input goes through every step while it is still in L1, so the intermediates
+// of the chain are never written to memory.
+class FusedElementwiseOp final : public Operator {
+public:
+    explicit FusedElementwiseOp(std::vector<ElementwiseKind> steps);
+
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] BufferAlias outputAlias() const noexcept override { return BufferAlias::InPlace; }
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+    [[nodiscard]] const std::vector<ElementwiseKind>& steps() const noexcept { return steps_; }
+
+private:
+    std::vector<ElementwiseKind> steps_;
+
+    // Used only when the graph has not bound planned memory to the output.
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
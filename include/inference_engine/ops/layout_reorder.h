@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+
+namespace infer {
+
+// Converts an FP32 activation between plain NCHW [N, C, H, W] and the channel-blocked
+// NCHW{block}c layout [N, ceil(C / block), H, W, block] read by blocked convolutions
+// (nchw_to_nchwc / nchwc_to_nchw). Lanes past `channels` are zero in the blocked
+// form. Inserted and cancelled by ConvLayoutPass.
+class LayoutReorderOp final : public Operator {
+public:
+    enum class Direction : std::uint8_t { ToBlocked, ToPlain };
+
+    LayoutReorderOp(Direction direction, std::size_t block, std::int64_t channels);
+
+    [[nodiscard]] Direction direction() const noexcept { return direction_; }
+    [[nodiscard]] std::size_t block() const noexcept { return block_; }
+    [[nodiscard]] std::int64_t channels() const noexcept { return channels_; }
+
+    void validate() const override;
+    void inferShapes() override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+private:
+    [[nodiscard]] inference_engine::core::Shape outputShape(const inference_engine::core::Shape& in) const;
+
+    Direction direction_;
+    std::size_t block_;
+    std::int64_t channels_;
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
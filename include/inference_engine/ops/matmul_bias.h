@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/kernels/linear.h"
+#include "inference_engine/ops/weight_buffer.h"
+
+namespace infer {
+
+// Dense layer: y[batch, out_dim] = act(x[batch, in_dim] * W[in_dim, out_dim] + b[out_dim]).
+// Weights are stored row-major with shape [in_dim, out_dim]; the activation runs in
+// the GEMM epilogue. Weights and bias may be views into a mapped model file.
+// Compiling prepacks the weights into the panels of the host's "linear_packed"
+// kernel (prepackWeights); owned row-major weights are then released, so weights()
+// is empty and rowMajorWeights() rebuilds them.
+class MatMulBiasOp final : public Operator {
+public:
+    MatMulBiasOp(std::int64_t in_dim, std::int64_t out_dim, WeightBuffer<float> weights, WeightBuffer<float> bias,
+                 Activation activation = Activation::None);
+
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] std::size_t estimateMemoryBytes() const noexcept override;
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void prepackWeights(PackedWeightCache* cache, WeightStore* store, const std::string& key) override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+    [[nodiscard]] std::int64_t inDim() const noexcept { return in_dim_; }
+    [[nodiscard]] std::int64_t outDim() const noexcept { return out_dim_; }
+    [[nodiscard]] const WeightBuffer<float>& weights() const noexcept { return weights_; }
+    [[nodiscard]] const WeightBuffer<float>& bias() const noexcept { return bias_; }
+    // Prepacked weights (empty until prepackWeights()) and their panel width.
+    [[nodiscard]] const WeightBuffer<float>& packedWeights() const noexcept { return packed_; }
+    [[nodiscard]] std::size_t packedPanel() const noexcept { return packed_panel_; }
+    // Row-major [in_dim, out_dim] weights, unpacked when only the packed copy is left.
+    [[nodiscard]] std::vector<float> rowMajorWeights() const;
+    [[nodiscard]] Activation activation() const noexcept { return activation_; }
+    void setActivation(Activation activation) noexcept { activation_ = activation; }
+
+private:
+    std::int64_t in_dim_;
+    std::int64_t out_dim_;
+    WeightBuffer<float> weights_;
+    WeightBuffer<float> bias_;
+    Activation activation_;
+    WeightBuffer<float> packed_{};
+    std::size_t packed_panel_ = 0;
+
+    // Used only when the graph has not bound planned memory to the output.
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "inference_engine/core/dtype.h"
+#include "inference_engine/core/half.h"
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/kernels/linear_blockq.h"
+#include "inference_engine/ops/weight_buffer.h"
+
+namespace infer {
+
+// MatMulBiasOp with block-quantized weights: y[batch, out_dim] = act(x * W + b) with
+// W held as INT4 or INT8 in groups of `group_size` input rows, one FP16 scale per
+// group and output column. Activations, bias and accumulation are FP32 and the
+// weights are dequantized in registers by the "linear_blockq" kernels, so batch-1
+// inference of a large layer streams 1/8 (INT4) or 1/4 (INT8) of the FP32 bytes.
+// Weights and scales arrive already packed (see linear_blockq.h); in_dim must be a
+// multiple of group_size.
+class MatMulBiasBlockQOp final : public Operator {
+public:
+    MatMulBiasBlockQOp(std::int64_t in_dim, std::int64_t out_dim, int bits, std::int64_t group_size,
+                       WeightBuffer<std::uint8_t> packed_weights,
+                       WeightBuffer<inference_engine::core::Half> packed_scales, WeightBuffer<float> bias,
+                       Activation activation = Activation::None);
+
+    // Quantizes FP32 weights [in_dim, out_dim] symmetrically per group of input rows
+    // and column, then packs them.
+    [[nodiscard]] static std::unique_ptr<MatMulBiasBlockQOp> fromFloat(std::int64_t in_dim, std::int64_t out_dim,
+                                                                       const std::vector<float>& weights,
+                                                                       std::vector<float> bias, int bits,
+                                                                       std::int64_t group_size,
+                                                                       Activation activation = Activation::None);
+
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] std::size_t estimateMemoryBytes() const noexcept override;
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+    [[nodiscard]] std::int64_t inDim() const noexcept { return in_dim_; }
+    [[nodiscard]] std::int64_t outDim() const noexcept { return out_dim_; }
+    [[nodiscard]] int bits() const noexcept { return bits_; }
+    [[nodiscard]] std::int64_t groupSize() const noexcept { return group_size_; }
+    [[nodiscard]] const WeightBuffer<std::uint8_t>& packedWeights() const noexcept { return weights_; }
+    [[nodiscard]] const WeightBuffer<inference_engine::core::Half>& packedScales() const noexcept { return scales_; }
+    [[nodiscard]] const WeightBuffer<float>& bias() const noexcept { return bias_; }
+    [[nodiscard]] Activation activation() const noexcept { return activation_; }
+    void setActivation(Activation activation) noexcept { activation_ = activation; }
+
+    // The weights' grouped quantization in QuantizationParams form (axis 0, scales
+    // [in_dim / group_size, out_dim]), unpacked from the panels.
+    [[nodiscard]] inference_engine::core::QuantizationParams weightQuantization() const;
+
+private:
+    std::int64_t in_dim_;
+    std::int64_t out_dim_;
+    int bits_;
+    std::int64_t group_size_;
+    WeightBuffer<std::uint8_t> weights_;
+    WeightBuffer<inference_engine::core::Half> scales_;
+    WeightBuffer<float> bias_;
+    Activation activation_;
+
+    // Used only when the graph has not bound planned memory to the output.
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
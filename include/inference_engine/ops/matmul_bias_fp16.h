@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "inference_engine/core/half.h"
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/kernels/linear.h"
+#include "inference_engine/ops/weight_buffer.h"
+
+namespace infer {
+
+// MatMulBiasOp with weights held in FP16: y[batch, out_dim] = act(x * W + b) with FP32
+// activations, bias and accumulation. Halves the resident size and the per-token
+// weight traffic of large layers, which dominates batch-1 inference.
+class MatMulBiasFp16Op final : public Operator {
+public:
+    MatMulBiasFp16Op(std::int64_t in_dim, std::int64_t out_dim, WeightBuffer<inference_engine::core::Half> weights,
+                     WeightBuffer<float> bias, Activation activation = Activation::None);
+
+    // Rounds FP32 weights [in_dim, out_dim] to FP16 (nearest even).
+    [[nodiscard]] static std::unique_ptr<MatMulBiasFp16Op> fromFloat(std::int64_t in_dim, std::int64_t out_dim,
+                                                                     const std::vector<float>& weights,
+                                                                     std::vector<float> bias,
+                                                                     Activation activation = Activation::None);
+
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] std::size_t estimateMemoryBytes() const noexcept override;
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+    [[nodiscard]] std::int64_t inDim() const noexcept { return in_dim_; }
+    [[nodiscard]] std::int64_t outDim() const noexcept { return out_dim_; }
+    [[nodiscard]] const WeightBuffer<inference_engine::core::Half>& weights() const noexcept { return weights_; }
+    [[nodiscard]] const WeightBuffer<float>& bias() const noexcept { return bias_; }
+    [[nodiscard]] Activation activation() const noexcept { return activation_; }
+    void setActivation(Activation activation) noexcept { activation_ = activation; }
+
+private:
+    std::int64_t in_dim_;
+    std::int64_t out_dim_;
+    WeightBuffer<inference_engine::core::Half> weights_;
+    WeightBuffer<float> bias_;
+    Activation activation_;
+
+    // Used only when the graph has not bound planned memory to the output.
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
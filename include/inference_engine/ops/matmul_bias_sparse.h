@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/kernels/linear_sparse.h"
+#include "inference_engine/ops/weight_buffer.h"
+
+namespace infer {
+
+// MatMulBiasOp over pruned weights: y[batch, out_dim] = act(x * W + b) with W held
+// in an N:M structured or block-CSR pattern (see linear_sparse.h) and run by the
+// "linear_sparse" kernels, which skip the dropped weights instead of multiplying
+// zeros. SparseLinearPass switches dense layers to it when that is faster. The
+// arrays arrive already packed; the index arrays are checked on construction, so
+// a corrupt file cannot make the kernels read outside the input.
+class MatMulBiasSparseOp final : public Operator {
+public:
+    // `indices` for N:M, `row_ptr` and `col_idx` for block CSR; the others empty.
+    MatMulBiasSparseOp(std::int64_t in_dim, std::int64_t out_dim, SparsePattern pattern, WeightBuffer<float> values,
+                       WeightBuffer<std::uint8_t> indices, WeightBuffer<std::uint32_t> row_ptr,
+                       WeightBuffer<std::uint32_t> col_idx, WeightBuffer<float> bias,
+                       Activation activation = Activation::None);
+
+    // Packs FP32 weights [in_dim, out_dim]; throws std::invalid_argument when they do
+    // not fit `pattern`.
+    [[nodiscard]] static std::unique_ptr<MatMulBiasSparseOp> fromFloat(std::int64_t in_dim, std::int64_t out_dim,
+                                                                       const float* weights, WeightBuffer<float> bias,
+                                                                       const SparsePattern& pattern,
+                                                                       Activation activation = Activation::None);
+
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] std::size_t estimateMemoryBytes() const noexcept override;
+    // Counts only the weights the kernel multiplies.
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+    [[nodiscard]] std::int64_t inDim() const noexcept { return in_dim_; }
+    [[nodiscard]] std::int64_t outDim() const noexcept { return out_dim_; }
+    [[nodiscard]] const SparsePattern& pattern() const noexcept { return pattern_; }
+    [[nodiscard]] const WeightBuffer<float>& values() const noexcept { return values_; }
+    [[nodiscard]] const WeightBuffer<std::uint8_t>& indices() const noexcept { return indices_; }
+    [[nodiscard]] const WeightBuffer<std::uint32_t>& rowPtr() const noexcept { return row_ptr_; }
+    [[nodiscard]] const WeightBuffer<std::uint32_t>& colIdx() const noexcept { return col_idx_; }
+    [[nodiscard]] const WeightBuffer<float>& bias() const noexcept { return bias_; }
+    // Weights multiplied per input row, padding excluded (see sparse_stored_weights).
+    [[nodiscard]] std::size_t storedWeights() const noexcept;
+    // Row-major [in_dim, out_dim] weights, zeros restored.
+    [[nodiscard]] std::vector<float> rowMajorWeights() const;
+    [[nodiscard]] Activation activation() const noexcept { return activation_; }
+    void setActivation(Activation activation) noexcept { activation_ = activation; }
+
+private:
+    std::int64_t in_dim_;
+    std::int64_t out_dim_;
+    SparsePattern pattern_;
+    WeightBuffer<float> values_;
+    WeightBuffer<std::uint8_t> indices_;
+    WeightBuffer<std::uint32_t> row_ptr_;
+    WeightBuffer<std::uint32_t> col_idx_;
+    WeightBuffer<float> bias_;
+    Activation activation_;
+
+    // Used only when the graph has not bound planned memory to the output.
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/ops/weight_buffer.h"
+
+namespace infer {
+
+// y = (x - mean) / sqrt(var + epsilon) * gamma + beta over the last dimension of an
+// input of any rank >= 1. gamma and beta hold one value per element of that
+// dimension; either may be empty (scale 1, shift 0). They may be views into a
+// mapped model file. The "epsilon" and "axis" attributes are decoded at compile
+// time; axis must name the last dimension.
+class LayerNormOp final : public Operator {
+public:
+    LayerNormOp(WeightBuffer<float> gamma, WeightBuffer<float> beta, float epsilon = 1e-5f);
+
+    void decodeAttributes(const AttributeMap& attrs) override;
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] BufferAlias outputAlias() const noexcept override { return BufferAlias::InPlace; }
+    [[nodiscard]] std::size_t estimateMemoryBytes() const noexcept override;
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+    [[nodiscard]] const WeightBuffer<float>& gamma() const noexcept { return gamma_; }
+    [[nodiscard]] const WeightBuffer<float>& beta() const noexcept { return beta_; }
+    [[nodiscard]] float epsilon() const noexcept { return epsilon_; }
+
+private:
+    WeightBuffer<float> gamma_;
+    WeightBuffer<float> beta_;
+    float epsilon_;
+    std::int64_t axis_ = -1;
+
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+// y = x / sqrt(mean(x^2) + epsilon) * gamma + beta over the last dimension (RMSNorm:
+// no mean subtraction). Same parameter rules as LayerNormOp.
+class RmsNormOp final : public Operator {
+public:
+    RmsNormOp(WeightBuffer<float> gamma, WeightBuffer<float> beta = {}, float epsilon = 1e-5f);
+
+    void decodeAttributes(const AttributeMap& attrs) override;
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] BufferAlias outputAlias() const noexcept override { return BufferAlias::InPlace; }
+    [[nodiscard]] std::size_t estimateMemoryBytes() const noexcept override;
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+    [[nodiscard]] const WeightBuffer<float>& gamma() const noexcept { return gamma_; }
+    [[nodiscard]] const WeightBuffer<float>& beta() const noexcept { return beta_; }
+    [[nodiscard]] float epsilon() const noexcept { return epsilon_; }
+
+private:
+    WeightBuffer<float> gamma_;
+    WeightBuffer<float> beta_;
+    float epsilon_;
+    std::int64_t axis_ = -1;
+
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+
+namespace infer {
+
+class KVCache;
+
+// Causal multi-head attention of one decoder layer over a KVCache.
+//
+// Inputs are the projections of the current step's new tokens, one row per token,
+// batch rows sequence-major (row r * tokens + t is token t of step row r):
+//   q [rows * tokens, heads * head_dim]
+//   k [rows * tokens, kv_heads * head_dim]
+//   v [rows * tokens, kv_heads * head_dim]
+// execute() appends k and v at the positions KVCache::beginStep reserved, then runs
+// the "paged_attention" kernel for every token and KV head straight from the pages:
+// token t of a row attends to its history plus new tokens 0..t. The output has q's
+// shape. heads must be a multiple of kv_heads (grouped-query attention), at most
+// kMaxAttentionGroup query heads per KV head. scale 0 selects 1 / sqrt(head_dim).
+//
+// The cache is runtime state, not part of the model: it is bound with bindCache()
+// and must outlive every execution; clones share it.
+class PagedAttentionOp final : public Operator {
+public:
+    PagedAttentionOp(std::int64_t layer, std::int64_t heads, std::int64_t kv_heads, std::int64_t head_dim,
+                     float scale = 0.0f);
+
+    void bindCache(KVCache* cache) noexcept { cache_ = cache; }
+    [[nodiscard]] KVCache* cache() const noexcept { return cache_; }
+
+    [[nodiscard]] std::int64_t layer() const noexcept { return layer_; }
+    [[nodiscard]] std::int64_t heads() const noexcept { return heads_; }
+    [[nodiscard]] std::int64_t kvHeads() const noexcept { return kv_heads_; }
+    [[nodiscard]] std::int64_t headDim() const noexcept { return head_dim_; }
+    [[nodiscard]] float scale() const noexcept { return scale_; }
+
+    void validate() const override;
+    void inferShapes() override;
+    // Multiply-adds over every cached position of the current step.
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+private:
+    std::int64_t layer_;
+    std::int64_t heads_;
+    std::int64_t kv_heads_;
+    std::int64_t head_dim_;
+    float scale_;
+    KVCache* cache_ = nullptr;
+
+    // Used only when the graph has not bound planned memory to the output.
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "inference_engine/core/dtype.h"
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/kernels/linear_int8.h"
+
+namespace infer {
+
+// Quantized dense layer: y[batch, out_dim] = act(x[batch, in_dim] * W[in_dim, out_dim] + b[out_dim])
+// on the INT8 GEMM kernels. The input Value is INT8 or UINT8 with per-tensor
+// quantization; the output Value is INT8/UINT8 with per-tensor quantization
+// (requantized in the GEMM epilogue) or FP32 (dequantized there). Weights are
+// symmetric INT8 in [-127, 127], per output channel (axis 1) or per tensor, and are
+// packed once at construction. The bias stays in float and is quantized to INT32
+// against the input scale the first time the layer runs.
+class QuantizedLinearOp final : public Operator {
+public:
+    QuantizedLinearOp(std::int64_t in_dim, std::int64_t out_dim, std::vector<std::int8_t> weights,
+                      inference_engine::core::QuantizationParams weight_qparams, std::vector<float> bias,
+                      Activation activation = Activation::None);
+
+    // Quantizes FP32 weights [in_dim, out_dim] symmetrically per output channel.
+    [[nodiscard]] static std::unique_ptr<QuantizedLinearOp> fromFloat(std::int64_t in_dim, std::int64_t out_dim,
+                                                                      const std::vector<float>& weights,
+                                                                      std::vector<float> bias,
+                                                                      Activation activation = Activation::None);
+
+    void validate() const override;
+    void inferShapes() override;
+    // Derives the INT32 bias and epilogue multipliers from the wired Values' scales.
+    void prepare() override;
+    [[nodiscard]] std::size_t estimateMemoryBytes() const noexcept override;
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+    [[nodiscard]] std::int64_t inDim() const noexcept { return in_dim_; }
+    [[nodiscard]] std::int64_t outDim() const noexcept { return out_dim_; }
+    [[nodiscard]] const std::vector<float>& weightScales() const noexcept { return weight_scales_; }
+    [[nodiscard]] const std::vector<float>& bias() const noexcept { return bias_; }
+    [[nodiscard]] Activation activation() const noexcept { return activation_; }
+    void setActivation(Activation activation) noexcept { activation_ = activation; }
+
+private:
+    void prepareEpilogue(float x_scale, float y_scale, bool quantized_output);
+
+    std::int64_t in_dim_;
+    std::int64_t out_dim_;
+    std::shared_ptr<const PackedInt8Weights> weights_; // shared by clones
+    std::vector<float> weight_scales_; // one per output column
+    std::vector<float> bias_;
+    Activation activation_;
+
+    // INT32 bias and epilogue multipliers for the scales they were derived from.
+    std::vector<std::int32_t> bias_q_{};
+    std::vector<float> multipliers_{};
+    float cached_x_scale_ = 0.0f;
+    float cached_y_scale_ = 0.0f;
+
+    // Used only when the graph has not bound planned memory to the output.
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+
+namespace infer {
+
+// Reinterprets a contiguous input under the output Value's shape (Reshape, Flatten,
+// Squeeze, ...). A view op: the planner gives the output the input's arena slot,
+// and otherwise execute() points the output at the input's bytes. Never copies.
+class ReshapeOp final : public Operator {
+public:
+    ReshapeOp();
+
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] BufferAlias outputAlias() const noexcept override { return BufferAlias::View; }
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+private:
+    inference_engine::core::Tensor view_{};
+};
+
+} // namespace infer
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+
+namespace infer {
+
+// Row-wise softmax over the last dimension of an input of any rank >= 1; every
+// other dimension is a batch dimension. Rows run through the "softmax_row" kernel
+// (kernels/reduce.h), split across the thread pool for large batches. The "axis"
+// attribute is decoded at compile time and must name the last dimension.
+class SoftmaxOp final : public Operator {
+public:
+    SoftmaxOp();
+
+    [[nodiscard]] std::int64_t axis() const noexcept { return axis_; }
+
+    void decodeAttributes(const AttributeMap& attrs) override;
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] BufferAlias outputAlias() const noexcept override { return BufferAlias::InPlace; }
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+private:
+    std::int64_t axis_ = -1;
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+// Row-wise log(softmax(x)) = x - max - log(sum(exp(x - max))) over the last
+// dimension, without forming the probabilities. Same "axis" rule as SoftmaxOp.
+class LogSoftmaxOp final : public Operator {
+public:
+    LogSoftmaxOp();
+
+    [[nodiscard]] std::int64_t axis() const noexcept { return axis_; }
+
+    void decodeAttributes(const AttributeMap& attrs) override;
+    void validate() const override;
+    void inferShapes() override;
+    [[nodiscard]] BufferAlias outputAlias() const noexcept override { return BufferAlias::InPlace; }
+    [[nodiscard]] std::uint64_t estimateFlops() const noexcept override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+private:
+    std::int64_t axis_ = -1;
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
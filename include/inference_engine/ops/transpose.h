@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/operator.h"
+
+namespace infer {
+
+// Permutes the input's dimensions: output dim i is input dim perm[i] (ONNX
+// Transpose; e.g. {0, 2, 3, 1} turns NCHW into NHWC). An empty perm reverses the
+// dimensions. Any dtype; the dense output is written by the strided-copy engine.
+// A "perm" attribute, decoded at compile time, replaces the constructor's perm.
+class TransposeOp final : public Operator {
+public:
+    explicit TransposeOp(std::vector<int> perm = {});
+
+    [[nodiscard]] const std::vector<int>& perm() const noexcept { return perm_; }
+
+    void decodeAttributes(const AttributeMap& attrs) override;
+    void validate() const override;
+    void inferShapes() override;
+    void prepare() override;
+    void execute() override;
+    [[nodiscard]] std::unique_ptr<Operator> clone() const override;
+
+private:
+    // perm_, or the reversal for an empty perm, at the input's rank.
+    [[nodiscard]] std::vector<int> axes(std::size_t rank) const;
+
+    std::vector<int> perm_;
+    std::vector<int> resolved_{}; // axes(input rank), set by prepare()
+    std::vector<float> output_buf_{};
+    inference_engine::core::Tensor output_tensor_{};
+};
+
+} // namespace infer
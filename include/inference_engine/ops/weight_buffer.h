@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "inference_engine/core/storage.h"
+
+namespace infer {
+
+// Read-only operator parameters (weights, biases). Either owns its elements, shares
+// a refcounted Storage (e.g. a WeightStore blob), or is a non-owning view of memory
+// that outlives every operator using it, such as the weight section of a
+// memory-mapped model file. Copies share the owned elements or storage and copies of
+// a view stay views, so cloning an operator never duplicates weights.
+template <typename T>
+class WeightBuffer {
+public:
+    WeightBuffer() = default;
+    WeightBuffer(std::vector<T> owned) {
+        auto elements = std::make_shared<const std::vector<T>>(std::move(owned));
+        data_ = elements->data();
+        size_ = elements->size();
+        owner_ = std::move(elements);
+    }
+
+    [[nodiscard]] static WeightBuffer view(const T* data, std::size_t size) noexcept {
+        WeightBuffer b;
+        b.data_ = data;
+        b.size_ = size;
+        return b;
+    }
+
+    // The elements of `storage`, kept alive by every copy.
+    [[nodiscard]] static WeightBuffer shared(std::shared_ptr<const inference_engine::core::Storage> storage) noexcept {
+        WeightBuffer b;
+        if (storage) {
+            b.data_ = static_cast<const T*>(storage->data());
+            b.size_ = storage->size() / sizeof(T);
+            b.owner_ = std::move(storage);
+        }
+        return b;
+    }
+
+    [[nodiscard]] const T* data() const noexcept { return data_; }
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] bool isView() const noexcept { return data_ != nullptr && owner_ == nullptr; }
+
+    [[nodiscard]] const T& operator[](std::size_t i) const noexcept { return data()[i]; }
+    [[nodiscard]] const T* begin() const noexcept { return data(); }
+    [[nodiscard]] const T* end() const noexcept { return data() + size_; }
+
+private:
+    std::shared_ptr<const void> owner_{}; // null for views
+    const T* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+} // namespace infer
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+
+#include "inference_engine/graph/graph.h"
+
+namespace infer {
+
+// Evaluates every node whose inputs are all graph initializers, once, at compile
+// time. Its outputs become initializers holding the computed data and the node is
+// removed; folding repeats down the graph in topological order, so whole
+// constant-only subgraphs collapse. Initializers left without consumers are
+// deleted. Nodes without inputs and operators that cannot execute (placeholders,
+// UNKNOWN-typed outputs) are left in place.
+class ConstantFoldingPass final : public GraphPass {
+public:
+    void run(Graph& g) override;
+    // Nodes folded by the last run().
+    [[nodiscard]] std::size_t foldedCount() const noexcept { return folded_; }
+
+private:
+    std::size_t folded_ = 0;
+};
+
+} // namespace infer
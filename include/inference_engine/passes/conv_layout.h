@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+
+#include "inference_engine/graph/graph.h"
+
+namespace infer {
+
+// Picks the algorithm of every Conv2dOp left on Auto, over all algorithms including
+// the blocked DirectNchwc (select_conv_algorithm, or autotune_conv_algorithm when
+// Options::autotune is set). A convolution going DirectNchwc is switched to the
+// NCHW{block}c layout with LayoutReorderOps around it:
+//   x -> ToBlocked -> Conv2d -> ToPlain -> y
+// A plain input feeding several blocked convolutions is converted once, and every
+// ToPlain -> ToBlocked pair is cancelled afterwards so chains of blocked
+// convolutions stay blocked between the first and the last.
+class ConvLayoutPass final : public GraphPass {
+public:
+    struct Options {
+        bool autotune = false;
+    };
+
+    ConvLayoutPass() = default;
+    explicit ConvLayoutPass(Options options) : options_(options) {}
+
+    void run(Graph& g) override;
+    // Convolutions switched to the blocked layout by the last run().
+    [[nodiscard]] std::size_t blockedConvs() const noexcept { return blocked_; }
+    // LayoutReorderOps left in the graph by the last run().
+    [[nodiscard]] std::size_t reorders() const noexcept { return reorders_; }
+    // ToPlain -> ToBlocked pairs removed by the last run().
+    [[nodiscard]] std::size_t cancelledPairs() const noexcept { return cancelled_; }
+
+private:
+    Options options_{};
+    std::size_t blocked_ = 0;
+    std::size_t reorders_ = 0;
+    std::size_t cancelled_ = 0;
+};
+
+} // namespace infer
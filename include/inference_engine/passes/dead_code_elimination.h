@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+
+#include "inference_engine/graph/graph.h"
+
+namespace infer {
+
+// Walks back from Graph::outputs() through Value producers and deletes every Node
+// and Value that cannot reach an output. Graph inputs are always kept.
+class DeadCodeEliminationPass final : public GraphPass {
+public:
+    void run(Graph& g) override;
+    [[nodiscard]] std::size_t removedNodes() const noexcept { return removed_nodes_; }
+    [[nodiscard]] std::size_t removedValues() const noexcept { return removed_values_; }
+
+private:
+    std::size_t removed_nodes_ = 0;
+    std::size_t removed_values_ = 0;
+};
+
+} // namespace infer
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+
+#include "inference_engine/graph/graph.h"
+
+namespace infer {
+
+// Folds a ReLU into the GEMM epilogue of the dense layer feeding it (MatMulBias,
+// MatMulBiasFp16, MatMulBiasBlockQ, MatMulBiasSparse, QuantizedLinear with FP32
+// output, Conv2d) when the ReLU is the only consumer of the layer's output. The
+// leading ReLU of a FusedElementwiseOp is absorbed the same way. The ReLU node and
+// the intermediate Value are deleted.
+class FuseLinearActivationPass final : public GraphPass {
+public:
+    void run(Graph& g) override;
+    [[nodiscard]] std::size_t fusedCount() const noexcept { return fused_; }
+
+private:
+    std::size_t fused_ = 0;
+};
+
+// Collapses producer -> consumer chains of unary elementwise operators (ReLU,
+// Sigmoid, Tanh, GELU, FusedElementwise) into a single FusedElementwiseOp, and
+// chains following a BinaryElementwiseOp into its epilogue, deleting the
+// intermediate Values. Links are only followed through Values with exactly
+// one consumer that are not graph outputs.
+class FuseElementwiseChainPass final : public GraphPass {
+public:
+    void run(Graph& g) override;
+    [[nodiscard]] std::size_t fusedCount() const noexcept { return fused_; }
+
+private:
+    std::size_t fused_ = 0;
+};
+
+// The standard fusion pipeline: elementwise chains first, so a chain that starts
+// with ReLU can then be pulled into the preceding layer's epilogue.
+class FusionPass final : public GraphPass {
+public:
+    void run(Graph& g) override;
+    // Operators folded into a neighbour by the last run().
+    [[nodiscard]] std::size_t fusedCount() const noexcept { return fused_; }
+
+private:
+    std::size_t fused_ = 0;
+};
+
+} // namespace infer
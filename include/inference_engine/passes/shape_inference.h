@@ -0,0 +1,27 @@
+#pragma once
+
+#include <vector>
+
+#include "inference_engine/core/shape.h"
+#include "inference_engine/graph/graph.h"
+
+namespace infer {
+
+// Specializes a graph to new input shapes: assigns `input_shapes` to
+// Graph::inputs() and recomputes every other Value's shape in topological order
+// through Operator::inferShapes(), then invalidates cached plans. Dimensions that
+// vary between requests (batch, sequence length) are whatever the inputs carry;
+// operators derive dependent dimensions from them. Initializers keep their shapes.
+// Throws std::invalid_argument if the shape count differs from the graph's inputs
+// or an operator cannot accept the shapes it receives.
+class ShapeInferencePass final : public GraphPass {
+public:
+    explicit ShapeInferencePass(std::vector<inference_engine::core::Shape> input_shapes);
+
+    void run(Graph& g) override;
+
+private:
+    std::vector<inference_engine::core::Shape> input_shapes_;
+};
+
+} // namespace infer
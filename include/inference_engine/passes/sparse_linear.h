@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+
+#include "inference_engine/graph/graph.h"
+
+namespace infer {
+
+// Switches pruned dense layers to MatMulBiasSparseOp. For every MatMulBiasOp whose
+// FP32 weights are at most Options::max_density non-zero, each sparse pattern the
+// weights fit (N:M 1:4, 2:4, 1:8, 2:8, 4:8 and block CSR 8x1, 4x4) is costed from
+// the weights its kernel still multiplies at the layer's batch size, and the
+// cheapest replaces the operator when it clearly beats the dense kernel. With
+// Options::autotune the candidates are timed instead. Run before compile(); the
+// activation epilogue carries over, and FuseLinearActivationPass folds ReLUs into
+// sparse layers as well.
+class SparseLinearPass final : public GraphPass {
+public:
+    struct Options {
+        // Denser layers stay dense without being costed.
+        double max_density = 0.6;
+        bool autotune = false;
+    };
+
+    SparseLinearPass() = default;
+    explicit SparseLinearPass(Options options) : options_(options) {}
+
+    void run(Graph& g) override;
+    // Dense layers switched to a sparse pattern by the last run().
+    [[nodiscard]] std::size_t sparseLayers() const noexcept { return sparse_; }
+
+private:
+    Options options_{};
+    std::size_t sparse_ = 0;
+};
+
+} // namespace infer
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/metrics.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace infer {
+
+class ExecutionContext;
+class Model;
+
+struct BatcherOptions {
+    // Requests merged into one inference; 0 selects the batch dimension the model was
+    // compiled for, which is also the upper bound.
+    std::size_t max_batch_size = 0;
+    // How long the oldest queued request may wait for others to join its batch.
+    std::chrono::microseconds max_wait{1000};
+};
+
+// Dynamic batching front-end for a single-input, single-output Model whose rows are
+// independent (a [batch, ...] input where output row i depends only on input row i,
+// such as an MLP). Callers submit one sample at a time; a dispatcher thread merges
+// queued samples along dim 0 until max_batch_size are waiting or the oldest has
+// waited max_wait, runs one Model::infer() and scatters the rows back through the
+// returned futures. Unused rows of the compiled batch are zero-filled.
+//
+// Thread-safe. Destruction (or shutdown()) finishes every request already queued.
+class DynamicBatcher {
+public:
+    struct Stats {
+        std::uint64_t requests = 0;
+        std::uint64_t batches = 0;
+        std::uint64_t padded_rows = 0; // compiled rows that carried no request
+        std::uint64_t queue_depth = 0;     // requests waiting for a batch
+        std::uint64_t max_queue_depth = 0; // since construction
+        // Time from submit() until the request's batch was dispatched.
+        LatencyHistogram::Snapshot wait{};
+    };
+
+    // Compiles the model. Throws std::invalid_argument if the model is not a
+    // single-input/single-output graph with a leading batch dimension, or if
+    // options.max_batch_size exceeds the compiled batch.
+    explicit DynamicBatcher(Model& model, BatcherOptions options = {});
+    ~DynamicBatcher();
+
+    DynamicBatcher(const DynamicBatcher&) = delete;
+    DynamicBatcher& operator=(const DynamicBatcher&) = delete;
+
+    // Queues one sample, shaped like a single input row ([1, ...] or without the batch
+    // dimension); its data is copied before submit() returns. The future yields an
+    // owning [1, ...] output row, or the exception the batched inference threw.
+    // Throws std::invalid_argument for a mismatched sample and std::runtime_error
+    // after shutdown().
+    std::future<inference_engine::core::Tensor> submit(const inference_engine::core::Tensor& sample);
+
+    // Stops accepting requests, drains the queue and joins the dispatcher.
+    void shutdown();
+
+    [[nodiscard]] std::size_t maxBatchSize() const noexcept { return max_batch_; }
+    [[nodiscard]] Stats stats() const;
+
+private:
+    struct Request {
+        std::vector<std::uint8_t> input;
+        std::promise<inference_engine::core::Tensor> result;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+
+    void dispatchLoop();
+    void runBatch(std::vector<Request>& batch);
+
+    Model& model_;
+    BatcherOptions options_;
+    std::size_t max_batch_ = 0;
+    std::size_t compiled_batch_ = 0;
+    std::size_t row_bytes_in_ = 0;
+    std::size_t row_bytes_out_ = 0;
+    inference_engine::core::Shape input_shape_;
+    inference_engine::core::Shape output_row_shape_;
+    inference_engine::core::DataType input_dtype_ = inference_engine::core::DataType::UNKNOWN;
+    inference_engine::core::DataType output_dtype_ = inference_engine::core::DataType::UNKNOWN;
+
+    // Dispatcher-only state: the batched input and the request context.
+    std::vector<std::uint64_t> batch_buf_;
+    std::unique_ptr<ExecutionContext> ctx_;
+
+    mutable std::mutex mu_;
+    std::condition_variable cv_;
+    std::deque<Request> queue_;
+    bool stopping_ = false;
+    Stats stats_{};
+    LatencyHistogram wait_;
+    std::thread dispatcher_;
+};
+
+} // namespace infer
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/execution_context.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace infer {
+
+class MetricsRegistry;
+class Profiler;
+
+// Runs an ExecutionPlan as a DAG on a ThreadPool: a step is submitted as soon as all
+// of its predecessors have finished, so independent branches execute concurrently.
+// The plan must come from Graph::compile() with CompileOptions::parallel set, so
+// that no two values that may be live at the same time share arena bytes.
+//
+// One executor drives one run at a time; run() blocks until every step finished and
+// rethrows the first operator exception (remaining steps are skipped, not executed).
+// Concurrent requests on one plan each use their own executor and ExecutionContext.
+// A Profiler or MetricsRegistry installed on the calling thread records the steps
+// of every worker.
+class ParallelExecutor {
+public:
+    ParallelExecutor(ExecutionPlan& plan, ThreadPool& pool);
+
+    ParallelExecutor(const ParallelExecutor&) = delete;
+    ParallelExecutor& operator=(const ParallelExecutor&) = delete;
+
+    void run(const std::vector<inference_engine::core::Tensor>& inputs,
+             std::vector<inference_engine::core::Tensor>& outputs);
+    // Runs with all tensors in `ctx` (installed on every worker executing a step).
+    // Leaves the Nodes' execution flags untouched, since they are shared.
+    void run(ExecutionContext& ctx, const std::vector<inference_engine::core::Tensor>& inputs,
+             std::vector<inference_engine::core::Tensor>& outputs);
+
+private:
+    void runSteps();
+    void submit(std::uint32_t step);
+    void runStep(std::uint32_t step);
+
+    ExecutionPlan& plan_;
+    ThreadPool& pool_;
+    ExecutionContext* ctx_ = nullptr; // set for the duration of run(ctx, ...)
+    Profiler* profiler_ = nullptr;    // Profiler::current() of the thread calling run()
+    MetricsRegistry* metrics_ = nullptr; // MetricsRegistry::current() of that thread
+    std::vector<std::uint32_t> roots_;
+
+    std::unique_ptr<std::atomic<std::uint32_t>[]> remaining_;
+    std::atomic<std::size_t> outstanding_{0};
+    std::atomic<bool> failed_{false};
+    std::exception_ptr error_{};
+    std::mutex mu_;
+    std::condition_variable done_cv_;
+    bool done_ = false; // guarded by mu_; set by the step that completes the run
+};
+
+} // namespace infer
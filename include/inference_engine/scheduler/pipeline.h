@@ -0,0 +1,109 @@
+#pragma once
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace infer {
+
+class ExecutionContext;
+class Model;
+
+struct PipelineOptions {
+    // Requests in flight at once, each with its own ExecutionContext and staging
+    // input. 3 lets preprocessing, compute and postprocessing of consecutive
+    // requests overlap; further requests queue without blocking the submitter.
+    std::size_t depth = 3;
+};
+
+// Asynchronous front-end for a single-input Model that runs every request as three
+// stages on a ThreadPool:
+//
+//   preprocess(request, input)  copy/quantize the request into a staging tensor
+//                               shaped like the model input
+//   compute                     Model::infer() on the request's own context
+//   postprocess(output)         turn the output view into the delivered result
+//                               (e.g. dequantize); it must not keep the view
+//
+// Compute is serialized in submission order (it already parallelizes internally
+// through the pool) while pre- and postprocessing of other requests run alongside
+// it, so request N+1 is staged and request N-1 finished while request N computes.
+// The defaults copy the request into place and return an owning copy of the output.
+//
+// The request's data must stay valid until its result is delivered. Callbacks run
+// on a pool thread and must not throw. With a pool without workers (builds without
+// ENABLE_MT) every stage runs inline in submit().
+class InferencePipeline {
+public:
+    using Tensor = inference_engine::core::Tensor;
+    using Preprocess = std::function<void(const Tensor& request, Tensor& input)>;
+    using Postprocess = std::function<Tensor(const Tensor& output)>;
+    // Receives the result, or a null tensor and the exception a stage threw.
+    using Callback = std::function<void(Tensor result, std::exception_ptr error)>;
+
+    // Compiles the model. Throws std::invalid_argument for models that do not take
+    // exactly one input or for depth == 0.
+    InferencePipeline(Model& model, ThreadPool& pool, PipelineOptions options = {}, Preprocess preprocess = {},
+                      Postprocess postprocess = {});
+    // Waits for every submitted request.
+    ~InferencePipeline();
+
+    InferencePipeline(const InferencePipeline&) = delete;
+    InferencePipeline& operator=(const InferencePipeline&) = delete;
+
+    std::future<Tensor> submit(const Tensor& request);
+    void submit(const Tensor& request, Callback done);
+
+    // Blocks until every request submitted so far has been delivered.
+    void drain();
+
+    [[nodiscard]] std::size_t inFlight() const;
+
+private:
+    struct Slot {
+        std::unique_ptr<ExecutionContext> ctx;
+        std::vector<std::uint64_t> staging;
+        Tensor input;  // model-shaped view of `staging`
+        Tensor request;
+        Tensor output; // view into ctx, valid until the slot is reused
+        Callback done;
+        std::exception_ptr error;
+    };
+    struct Pending {
+        Tensor request;
+        Callback done;
+    };
+
+    void dispatch(std::function<void()> task);
+    void start(Slot* slot);
+    void runPreprocess(Slot* slot);
+    void runCompute();
+    void runPostprocess(Slot* slot);
+    void finish(Slot* slot, Tensor result);
+
+    Model& model_;
+    ThreadPool& pool_;
+    Preprocess preprocess_;
+    Postprocess postprocess_;
+    std::vector<std::unique_ptr<Slot>> slots_;
+
+    mutable std::mutex mu_;
+    std::condition_variable idle_cv_;
+    std::vector<Slot*> free_;
+    std::deque<Pending> pending_;
+    std::deque<Slot*> ready_; // preprocessed, waiting for compute
+    bool computing_ = false;
+    std::size_t in_flight_ = 0;
+};
+
+} // namespace infer
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/scheduler/spsc_queue.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace infer {
+
+class ExecutionContext;
+class MetricsRegistry;
+class Profiler;
+
+// A contiguous range [begin, end) of ExecutionPlan::steps() and the cores running it.
+struct PipelineStage {
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    std::uint64_t cost = 0; // sum of stepCost() over the range
+    std::vector<int> cpus{};
+};
+
+// Estimated cost of one step: Operator::estimateFlops() plus estimateMemoryBytes(),
+// so bandwidth-bound steps weigh in alongside compute-bound ones; at least 1.
+[[nodiscard]] std::uint64_t stepCost(const ExecutionPlan::Step& step) noexcept;
+
+// Splits the plan's steps, in order, into min(stages, steps) non-empty contiguous
+// ranges minimizing the largest range cost. Cores are left unassigned.
+[[nodiscard]] std::vector<PipelineStage> partitionStages(const ExecutionPlan& plan, std::size_t stages);
+
+struct PipelineExecutorOptions {
+    // Pipeline stages; 0 selects one per `cores_per_stage` available CPUs. Capped by
+    // the number of steps.
+    std::size_t stages = 0;
+    // Cores of each stage: one runs the stage's driver thread, the others form the
+    // stage's ThreadPool for intra-op parallelFor. Stages take consecutive groups of
+    // availableCpus(), wrapping around when there are more stages than groups.
+    std::size_t cores_per_stage = 1;
+    // Micro-batches in flight, each with its own ExecutionContext; 0 selects
+    // 2 * stages, so every stage has one to run while the next is queued. submit()
+    // blocks while all are in use.
+    std::size_t micro_batches = 0;
+    // Pin drivers and workers to their core group (best effort).
+    bool pin = true;
+};
+
+// Pipeline-parallel execution of one plan over a stream of micro-batches.
+//
+// The topologically ordered steps are split into balanced stages (partitionStages)
+// and each stage runs on its own core group, so a stage's weights and activations
+// stay in those cores' caches while consecutive micro-batches stream through.
+// Micro-batch N+1 runs stage 0 while micro-batch N runs stage 1, and so on; stages
+// hand micro-batches on through bounded lock-free SPSC queues and park only when
+// idle. This raises throughput under streaming load at small batch sizes, where
+// intra-op parallelism alone stops scaling; the latency of a single micro-batch is
+// not reduced.
+//
+// Any plan from Graph::compile() works: a micro-batch runs its stages one after the
+// other in its own context. Inputs must match the plan like ExecutionPlan::run and
+// stay valid until the micro-batch is delivered; outputs are delivered as owning
+// copies. Callbacks run on the last stage's driver and must not throw. A Profiler or
+// MetricsRegistry installed on the submitting thread records that micro-batch's steps.
+class PipelineExecutor {
+public:
+    using Tensor = inference_engine::core::Tensor;
+    // Receives the outputs, or no tensors and the exception a step threw.
+    using Callback = std::function<void(std::vector<Tensor> outputs, std::exception_ptr error)>;
+
+    // Throws std::invalid_argument for a plan without steps or cores_per_stage == 0.
+    explicit PipelineExecutor(ExecutionPlan& plan, PipelineExecutorOptions options = {});
+    // Waits for every submitted micro-batch, then stops the stage threads.
+    ~PipelineExecutor();
+
+    PipelineExecutor(const PipelineExecutor&) = delete;
+    PipelineExecutor& operator=(const PipelineExecutor&) = delete;
+
+    // Thread-safe. Throws std::invalid_argument (before queuing) for inputs that do
+    // not match the plan.
+    std::future<std::vector<Tensor>> submit(const std::vector<Tensor>& inputs);
+    void submit(const std::vector<Tensor>& inputs, Callback done);
+
+    // Blocks until every micro-batch submitted so far has been delivered.
+    void drain();
+
+    [[nodiscard]] const std::vector<PipelineStage>& stages() const noexcept { return stages_; }
+    [[nodiscard]] std::size_t microBatches() const noexcept { return slots_.size(); }
+
+private:
+    struct Slot {
+        std::unique_ptr<ExecutionContext> ctx;
+        Callback done;
+        Profiler* profiler = nullptr;
+        MetricsRegistry* metrics = nullptr;
+        std::exception_ptr error;
+    };
+
+    // Wakes a parked consumer of a queue; the consumer spins briefly before parking.
+    struct Signal {
+        std::mutex mu;
+        std::condition_variable cv;
+        std::atomic<bool> parked{false};
+        template <typename Ready>
+        void wait(Ready ready);
+        void notify();
+    };
+
+    struct Stage {
+        PipelineStage range;
+        std::unique_ptr<ThreadPool> pool; // null for single-core stages
+        std::unique_ptr<SpscQueue<Slot*>> in;
+        Signal signal;
+        std::thread driver;
+    };
+
+    void stageLoop(std::size_t index);
+    void runStage(const Stage& stage, Slot& slot);
+    void deliver(Slot& slot);
+
+    ExecutionPlan& plan_;
+    std::vector<PipelineStage> stages_;
+    std::vector<std::unique_ptr<Stage>> stage_state_;
+    std::vector<std::unique_ptr<Slot>> slots_;
+
+    // Free slots: pushed by the last stage, popped by submit() under submit_mu_.
+    std::mutex submit_mu_;
+    std::unique_ptr<SpscQueue<Slot*>> free_;
+    Signal free_signal_;
+    Slot* spare_ = nullptr; // popped by a submit() whose inputs were rejected
+
+    std::atomic<bool> stop_{false};
+    std::atomic<std::size_t> in_flight_{0};
+    std::mutex idle_mu_;
+    std::condition_variable idle_cv_;
+};
+
+} // namespace infer
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace infer {
+
+// Bounded lock-free single-producer/single-consumer ring.
+//
+// Exactly one thread may call tryPush() and exactly one (possibly other) thread
+// tryPop(); neither ever blocks or allocates. The capacity is rounded up to a power
+// of two. Head and tail live on separate cache lines, and each side caches the
+// other's index so an uncontended push or pop touches the shared line only when
+// the cached view says the ring is full or empty.
+template <typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(std::size_t capacity) {
+        if (capacity == 0) {
+            throw std::invalid_argument("SpscQueue: capacity must be at least 1");
+        }
+        std::size_t size = 1;
+        while (size < capacity) size <<= 1;
+        mask_ = size - 1;
+        slots_ = std::make_unique<T[]>(size);
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return mask_ + 1; }
+
+    // Producer side. Returns false (leaving `value` untouched) when the ring is full.
+    bool tryPush(T&& value) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_cache_ > mask_) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail - head_cache_ > mask_) return false;
+        }
+        slots_[tail & mask_] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+    bool tryPush(const T& value) {
+        T copy(value);
+        return tryPush(std::move(copy));
+    }
+
+    // Consumer side. Returns false when the ring is empty.
+    bool tryPop(T& out) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_) return false;
+        }
+        out = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate when called concurrently with the other side.
+    [[nodiscard]] bool empty() const noexcept {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr std::size_t kLine = 64;
+
+    std::unique_ptr<T[]> slots_;
+    std::size_t mask_ = 0;
+    alignas(kLine) std::atomic<std::size_t> head_{0}; // written by the consumer
+    std::size_t tail_cache_ = 0;                     // consumer's view of tail_
+    alignas(kLine) std::atomic<std::size_t> tail_{0}; // written by the producer
+    std::size_t head_cache_ = 0;                     // producer's view of head_
+};
+
+} // namespace infer
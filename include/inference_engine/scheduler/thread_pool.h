@@ -0,0 +1,143 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "inference_engine/memory/pages.h"
+
+namespace infer {
+
+// Work-stealing thread pool.
+//
+// Every worker owns a deque: it pushes and pops its own work LIFO (cache-warm) and,
+// when empty, steals FIFO from the other workers. Tasks enqueued from outside the
+// pool are distributed round-robin. Threads that block in wait()/parallelFor() help
+// execute queued work, so nesting (a task that itself waits) cannot deadlock and a
+// pool with zero workers still makes progress on the calling thread.
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+
+    struct Stats {
+        std::uint64_t executed = 0;
+        std::uint64_t steals = 0;
+        // Time spent running tasks, summed over workers and helping callers; its rate
+        // divided by size() is the pool's utilization.
+        std::uint64_t busy_ns = 0;
+        std::uint64_t queued = 0; // tasks waiting for a thread
+    };
+
+    // `num_threads == 0` selects std::thread::hardware_concurrency(). Builds without
+    // ENABLE_MT never spawn workers; all work runs on the waiting thread.
+    explicit ThreadPool(std::size_t num_threads = 0);
+    // Workers restricted to the CPUs of NUMA node `numa_node`; `num_threads == 0`
+    // selects one worker per CPU of the node. Arenas created for this pool (see
+    // pageOptions()) are bound to the same node, so requests run on local memory.
+    ThreadPool(std::size_t num_threads, int numa_node);
+    // Workers restricted to `cpus` (e.g. one core group of a PipelineExecutor stage);
+    // `num_threads == 0` selects one worker per listed CPU.
+    ThreadPool(std::size_t num_threads, std::vector<int> cpus);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    [[nodiscard]] std::size_t size() const noexcept { return workers_.size(); }
+    // NUMA node the workers are bound to, or memory::kAnyNumaNode.
+    [[nodiscard]] int numaNode() const noexcept { return numa_node_; }
+    // Page options for arenas used by this pool's workers: bound to numaNode().
+    [[nodiscard]] inference_engine::memory::PageOptions pageOptions() const noexcept;
+
+    // Queue a task. From a worker thread the task goes onto that worker's own deque.
+    void enqueue(Task task);
+
+    // Block until every task enqueued so far (and any they spawn) has finished, then
+    // rethrow the first exception a task raised. Not for use inside a pool task; use
+    // parallelFor() or a private completion counter there.
+    void wait();
+
+    // Split [begin, end) into chunks of at least `grain` iterations and run
+    // fn(chunk_begin, chunk_end) across the pool; the caller participates and the
+    // call returns once all chunks are done. Safe to call from inside a task.
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+                     const std::function<void(std::size_t, std::size_t)>& fn);
+
+    // Run one queued task on the calling thread if any is available.
+    bool tryRunOne();
+
+    [[nodiscard]] Stats stats() const noexcept;
+
+    // Pool associated with the calling thread: the owning pool for workers, or the
+    // pool installed by a Scope. nullptr otherwise (callers then run inline).
+    [[nodiscard]] static ThreadPool* current() noexcept;
+
+    // Installs `pool` as ThreadPool::current() for the calling thread.
+    class Scope {
+    public:
+        explicit Scope(ThreadPool* pool) noexcept;
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ThreadPool* previous_;
+    };
+
+private:
+    struct WorkerQueue {
+        std::mutex mu;
+        std::deque<Task> tasks;
+    };
+
+    void start(std::size_t num_threads);
+    void workerLoop(std::size_t index);
+    bool popLocal(std::size_t index, Task& out);
+    bool steal(std::size_t thief, Task& out);
+    void runTask(Task& task);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> workers_;
+    int numa_node_ = inference_engine::memory::kAnyNumaNode;
+    std::vector<int> cpus_; // affinity of every worker; empty: unrestricted
+
+    std::atomic<std::size_t> next_queue_{0};
+    std::atomic<std::size_t> queued_{0};
+    std::atomic<std::size_t> pending_{0};
+    std::atomic<bool> stop_{false};
+
+    std::mutex sleep_mu_;
+    std::condition_variable sleep_cv_;
+    std::mutex done_mu_;
+    std::condition_variable done_cv_;
+
+    // First exception thrown by a fire-and-forget task; rethrown by wait().
+    std::mutex error_mu_;
+    std::exception_ptr first_error_{};
+
+    std::atomic<std::uint64_t> executed_{0};
+    std::atomic<std::uint64_t> steals_{0};
+    std::atomic<std::uint64_t> busy_ns_{0};
+};
+
+// CPUs the process may run on, in ascending order; empty where affinity is unknown.
+[[nodiscard]] std::vector<int> availableCpus();
+
+// Restricts the calling thread to `cpus`. Best effort: returns false when affinity is
+// unsupported or refused (e.g. by a restricted cpuset) and the thread stays unpinned.
+bool pinCurrentThread(const std::vector<int>& cpus) noexcept;
+
+// Convenience wrapper: parallelFor on ThreadPool::current(), or inline when the
+// calling thread has no pool.
+void parallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+                 const std::function<void(std::size_t, std::size_t)>& fn);
+
+} // namespace infer
@@ -1,4 +1,7 @@
 #include "inference_engine/core/dtype.h"
+#include "inference_engine/kernels/convert.h"
+#include "inference_engine/kernels/quantize.h"
+#include "inference_engine/kernels/registry.h"
 #include <cmath>
 #include <stdexcept>
 #include <algorithm>
@@ -24,6 +27,114 @@ inline T clamp(T value, T min_val, T max_val) {
     return std::max(min_val, std::min(value, max_val));
 }
 
+// Bulk (de)quantization kernels, resolved once for the host CPU.
+struct QuantKernels {
+    infer::QuantizeS8Fn* quantize_s8;
+    infer::QuantizeU8Fn* quantize_u8;
+    infer::QuantizeS8ChannelsFn* quantize_s8_channels;
+    infer::QuantizeU8ChannelsFn* quantize_u8_channels;
+    infer::DequantizeS8Fn* dequantize_s8;
+    infer::DequantizeU8Fn* dequantize_u8;
+    infer::DequantizeS8ChannelsFn* dequantize_s8_channels;
+    infer::DequantizeU8ChannelsFn* dequantize_u8_channels;
+};
+
+const QuantKernels& quant_kernels() {
+    static const QuantKernels kernels = [] {
+        const auto& r = infer::KernelRegistry::instance();
+        QuantKernels k;
+        k.quantize_s8 = r.lookup<infer::QuantizeS8Fn>("quantize", DataType::INT8);
+        k.quantize_u8 = r.lookup<infer::QuantizeU8Fn>("quantize", DataType::UINT8);
+        k.quantize_s8_channels = r.lookup<infer::QuantizeS8ChannelsFn>("quantize_channels", DataType::INT8);
+        k.quantize_u8_channels = r.lookup<infer::QuantizeU8ChannelsFn>("quantize_channels", DataType::UINT8);
+        k.dequantize_s8 = r.lookup<infer::DequantizeS8Fn>("dequantize", DataType::INT8);
+        k.dequantize_u8 = r.lookup<infer::DequantizeU8Fn>("dequantize", DataType::UINT8);
+        k.dequantize_s8_channels = r.lookup<infer::DequantizeS8ChannelsFn>("dequantize_channels", DataType::INT8);
+        k.dequantize_u8_channels = r.lookup<infer::DequantizeU8ChannelsFn>("dequantize_channels", DataType::UINT8);
+        return k;
+    }();
+    return kernels;
+}
+
+struct ConvertKernels {
+    infer::ConvertFp32ToFp16Fn* to_fp16;
+    infer::ConvertFp16ToFp32Fn* to_fp32;
+};
+
+const ConvertKernels& convert_kernels() {
+    static const ConvertKernels kernels = [] {
+        const auto& r = infer::KernelRegistry::instance();
+        ConvertKernels k;
+        k.to_fp16 = r.lookup<infer::ConvertFp32ToFp16Fn>("fp32_to_fp16", DataType::FP16);
+        k.to_fp32 = r.lookup<infer::ConvertFp16ToFp32Fn>("fp16_to_fp32", DataType::FP16);
+        return k;
+    }();
+    return kernels;
+}
+
+// Validated per-channel layout: the tensor viewed as [outer, channels, inner].
+struct ChannelLayout {
+    std::size_t outer = 1;
+    std::size_t channels = 0;
+    std::size_t inner = 1;
+    std::vector<float> scales;
+    std::vector<int32_t> zero_points;
+};
+
+ChannelLayout make_channel_layout(const std::vector<int64_t>& dims, const QuantizationParams& params) {
+    if (!params.is_per_channel()) {
+        throw std::invalid_argument("Per-channel quantization requires per_channel_scales");
+    }
+    const int rank = static_cast<int>(dims.size());
+    const int axis = params.axis < 0 ? params.axis + rank : params.axis;
+    if (axis < 0 || axis >= rank) {
+        throw std::invalid_argument("Per-channel quantization axis out of range");
+    }
+    ChannelLayout layout;
+    layout.channels = params.per_channel_scales.size();
+    if (dims[static_cast<std::size_t>(axis)] != static_cast<int64_t>(layout.channels)) {
+        throw std::invalid_argument("per_channel_scales size must match the channel dimension");
+    }
+    if (!params.per_channel_zero_points.empty() && params.per_channel_zero_points.size() != layout.channels) {
+        throw std::invalid_argument("per_channel_zero_points size must match per_channel_scales");
+    }
+    for (int d = 0; d < rank; ++d) {
+        if (dims[static_cast<std::size_t>(d)] < 0) {
+            throw std::invalid_argument("Per-channel quantization requires static dimensions");
+        }
+        const std::size_t extent = static_cast<std::size_t>(dims[static_cast<std::size_t>(d)]);
+        if (d < axis) layout.outer *= extent;
+        if (d > axis) layout.inner *= extent;
+    }
+    for (float scale : params.per_channel_scales) {
+        if (!(scale > 0.0f)) {
+            throw std::invalid_argument("Scale must be positive");
+        }
+    }
+    layout.scales = params.per_channel_scales;
+    layout.zero_points = params.per_channel_zero_points.empty()
+                             ? std::vector<int32_t>(layout.channels, params.zero_point)
+                             : params.per_channel_zero_points;
+    return layout;
+}
+
+// Runs `uniform(offset, count, channel)` over contiguous channel runs, or
+// `per_element(offset, count)` over whole rows when the channel axis is innermost.
+template <typename Uniform, typename PerElement>
+void for_each_channel_run(const ChannelLayout& layout, Uniform uniform, PerElement per_element) {
+    if (layout.inner == 1) {
+        for (std::size_t o = 0; o < layout.outer; ++o) {
+            per_element(o * layout.channels, layout.channels);
+        }
+        return;
+    }
+    for (std::size_t o = 0; o < layout.outer; ++o) {
+        for (std::size_t c = 0; c < layout.channels; ++c) {
+            uniform((o * layout.channels + c) * layout.inner, layout.inner, c);
+        }
+    }
+}
+
 } // anonymous namespace
 
 // Quantize float to int8 using symmetric quantization (zero_point = 0)
@@ -188,12 +299,7 @@ void quantize_buffer_symmetric_int8(
         throw std::invalid_argument("Scale must be positive");
     }
     
-    float inv_scale = 1.0f / scale;
-    
-    for (size_t i = 0; i < count; ++i) {
-        float scaled = std::round(input[i] * inv_scale);
-        output[i] = static_cast<int8_t>(clamp(scaled, -128.0f, 127.0f));
-    }
+    quant_kernels().quantize_s8(input, output, count, 1.0f / scale, 0.0f);
 }
 
 void quantize_buffer_asymmetric_uint8(
@@ -207,13 +313,7 @@ void quantize_buffer_asymmetric_uint8(
         throw std::invalid_argument("Scale must be positive");
     }
     
-    float inv_scale = 1.0f / scale;
-    float zp_float = static_cast<float>(zero_point);
-    
-    for (size_t i = 0; i < count; ++i) {
-        float scaled = std::round(input[i] * inv_scale + zp_float);
-        output[i] = static_cast<uint8_t>(clamp(scaled, 0.0f, 255.0f));
-    }
+    quant_kernels().quantize_u8(input, output, count, 1.0f / scale, static_cast<float>(zero_point));
 }
 
 void dequantize_buffer_symmetric_int8(
@@ -222,9 +322,7 @@ void dequantize_buffer_symmetric_int8(
     size_t count,
     float scale) {
     
-    for (size_t i = 0; i < count; ++i) {
-        output[i] = static_cast<float>(input[i]) * scale;
-    }
+    quant_kernels().dequantize_s8(input, output, count, scale, 0);
 }
 
 void dequantize_buffer_asymmetric_uint8(
@@ -234,11 +332,231 @@ void dequantize_buffer_asymmetric_uint8(
     float scale,
     int32_t zero_point) {
     
-    float zp_float = static_cast<float>(zero_point);
+    quant_kernels().dequantize_u8(input, output, count, scale, zero_point);
+}
+
+namespace {
+
+template <typename Q, typename UniformFn, typename ChannelsFn>
+void quantize_per_channel(const float* input, Q* output, const std::vector<int64_t>& dims,
+                          const QuantizationParams& params, UniformFn* uniform, ChannelsFn* channels) {
+    const ChannelLayout layout = make_channel_layout(dims, params);
+    std::vector<float> inv_scales(layout.channels);
+    std::vector<float> zero_points(layout.channels);
+    for (std::size_t c = 0; c < layout.channels; ++c) {
+        inv_scales[c] = 1.0f / layout.scales[c];
+        zero_points[c] = static_cast<float>(layout.zero_points[c]);
+    }
+    for_each_channel_run(
+        layout,
+        [&](std::size_t offset, std::size_t count, std::size_t c) {
+            uniform(input + offset, output + offset, count, inv_scales[c], zero_points[c]);
+        },
+        [&](std::size_t offset, std::size_t count) {
+            channels(input + offset, output + offset, count, inv_scales.data(), zero_points.data());
+        });
+}
+
+template <typename Q, typename UniformFn, typename ChannelsFn>
+void dequantize_per_channel(const Q* input, float* output, const std::vector<int64_t>& dims,
+                            const QuantizationParams& params, UniformFn* uniform, ChannelsFn* channels) {
+    const ChannelLayout layout = make_channel_layout(dims, params);
+    for_each_channel_run(
+        layout,
+        [&](std::size_t offset, std::size_t count, std::size_t c) {
+            uniform(input + offset, output + offset, count, layout.scales[c], layout.zero_points[c]);
+        },
+        [&](std::size_t offset, std::size_t count) {
+            channels(input + offset, output + offset, count, layout.scales.data(), layout.zero_points.data());
+        });
+}
+
+} // anonymous namespace
+
+void quantize_buffer_per_channel_int8(
+    const float* input,
+    int8_t* output,
+    const std::vector<int64_t>& dims,
+    const QuantizationParams& params) {
+    
+    const auto& k = quant_kernels();
+    quantize_per_channel(input, output, dims, params, k.quantize_s8, k.quantize_s8_channels);
+}
+
+void quantize_buffer_per_channel_uint8(
+    const float* input,
+    uint8_t* output,
+    const std::vector<int64_t>& dims,
+    const QuantizationParams& params) {
+    
+    const auto& k = quant_kernels();
+    quantize_per_channel(input, output, dims, params, k.quantize_u8, k.quantize_u8_channels);
+}
+
+void dequantize_buffer_per_channel_int8(
+    const int8_t* input,
+    float* output,
+    const std::vector<int64_t>& dims,
+    const QuantizationParams& params) {
+    
+    const auto& k = quant_kernels();
+    dequantize_per_channel(input, output, dims, params, k.dequantize_s8, k.dequantize_s8_channels);
+}
+
+void dequantize_buffer_per_channel_uint8(
+    const uint8_t* input,
+    float* output,
+    const std::vector<int64_t>& dims,
+    const QuantizationParams& params) {
     
-    for (size_t i = 0; i < count; ++i) {
-        output[i] = (static_cast<float>(input[i]) - zp_float) * scale;
+    const auto& k = quant_kernels();
+    dequantize_per_channel(input, output, dims, params, k.dequantize_u8, k.dequantize_u8_channels);
+}
+
+// ==============================================================================
+// Block-wise (Grouped) Quantization
+// ==============================================================================
+
+namespace {
+
+// The tensor viewed as [outer, extent, inner] with `extent` along the group axis,
+// split into `groups` runs of group_size.
+struct GroupLayout {
+    std::size_t outer = 1;
+    std::size_t extent = 0;
+    std::size_t inner = 1;
+    std::size_t group_size = 0;
+    std::size_t groups = 0;
+
+    std::size_t scale_count() const noexcept { return outer * groups * inner; }
+    // Scale of element (o, a, i).
+    std::size_t scale_index(std::size_t o, std::size_t a, std::size_t i) const noexcept {
+        return (o * groups + a / group_size) * inner + i;
+    }
+};
+
+GroupLayout make_group_layout(const std::vector<int64_t>& dims, int axis, int32_t group_size, int32_t bits) {
+    if (bits != 4 && bits != 8) {
+        throw std::invalid_argument("Grouped quantization supports 4 or 8 bits");
+    }
+    if (group_size <= 0) {
+        throw std::invalid_argument("Grouped quantization requires a positive group_size");
+    }
+    const int rank = static_cast<int>(dims.size());
+    if (axis < 0) axis += rank;
+    if (axis < 0 || axis >= rank) {
+        throw std::invalid_argument("Grouped quantization axis out of range");
+    }
+    GroupLayout layout;
+    for (int d = 0; d < rank; ++d) {
+        if (dims[static_cast<std::size_t>(d)] < 0) {
+            throw std::invalid_argument("Grouped quantization requires static dimensions");
+        }
+        const std::size_t extent = static_cast<std::size_t>(dims[static_cast<std::size_t>(d)]);
+        if (d < axis) layout.outer *= extent;
+        if (d == axis) layout.extent = extent;
+        if (d > axis) layout.inner *= extent;
     }
+    layout.group_size = static_cast<std::size_t>(group_size);
+    layout.groups = (layout.extent + layout.group_size - 1) / layout.group_size;
+    return layout;
+}
+
+GroupLayout make_group_layout(const std::vector<int64_t>& dims, const QuantizationParams& params) {
+    const GroupLayout layout = make_group_layout(dims, params.axis, params.group_size, params.bits);
+    if (params.group_scales.size() != layout.scale_count()) {
+        throw std::invalid_argument("group_scales size must match the grouped dimensions");
+    }
+    return layout;
+}
+
+float group_qmax(int32_t bits) noexcept {
+    return static_cast<float>((1 << (bits - 1)) - 1);
+}
+
+// Visits every element as fn(offset, scale index).
+template <typename Fn>
+void for_each_grouped(const GroupLayout& layout, Fn fn) {
+    std::size_t offset = 0;
+    for (std::size_t o = 0; o < layout.outer; ++o) {
+        for (std::size_t a = 0; a < layout.extent; ++a) {
+            for (std::size_t i = 0; i < layout.inner; ++i, ++offset) fn(offset, layout.scale_index(o, a, i));
+        }
+    }
+}
+
+} // anonymous namespace
+
+QuantizationParams calculate_group_quant_params(
+    const float* input,
+    const std::vector<int64_t>& dims,
+    int axis,
+    int32_t group_size,
+    int32_t bits) {
+
+    const GroupLayout layout = make_group_layout(dims, axis, group_size, bits);
+    std::vector<float> abs_max(layout.scale_count(), 0.0f);
+    for_each_grouped(layout, [&](std::size_t offset, std::size_t g) {
+        abs_max[g] = std::max(abs_max[g], std::abs(input[offset]));
+    });
+
+    QuantizationParams params;
+    params.axis = axis;
+    params.symmetric = true;
+    params.group_size = group_size;
+    params.bits = bits;
+    params.group_scales.reserve(abs_max.size());
+    for (float m : abs_max) {
+        const float scale = m / group_qmax(bits);
+        if (!(scale <= 65504.0f)) {
+            throw std::invalid_argument("Grouped quantization scale does not fit FP16");
+        }
+        params.group_scales.emplace_back(scale);
+    }
+    return params;
+}
+
+void quantize_buffer_grouped(
+    const float* input,
+    int8_t* output,
+    const std::vector<int64_t>& dims,
+    const QuantizationParams& params) {
+
+    const GroupLayout layout = make_group_layout(dims, params);
+    const float qmax = group_qmax(params.bits);
+    // Quantize against the FP16-rounded scale the kernels will multiply by.
+    std::vector<float> inv_scales(params.group_scales.size());
+    for (std::size_t g = 0; g < inv_scales.size(); ++g) {
+        const float scale = params.group_scales[g].to_float();
+        inv_scales[g] = scale > 0.0f ? 1.0f / scale : 0.0f;
+    }
+    for_each_grouped(layout, [&](std::size_t offset, std::size_t g) {
+        output[offset] = static_cast<int8_t>(clamp(std::round(input[offset] * inv_scales[g]), -qmax, qmax));
+    });
+}
+
+void dequantize_buffer_grouped(
+    const int8_t* input,
+    float* output,
+    const std::vector<int64_t>& dims,
+    const QuantizationParams& params) {
+
+    const GroupLayout layout = make_group_layout(dims, params);
+    for_each_grouped(layout, [&](std::size_t offset, std::size_t g) {
+        output[offset] = static_cast<float>(input[offset]) * params.group_scales[g].to_float();
+    });
+}
+
+// ==============================================================================
+// FP16 Conversion
+// ==============================================================================
+
+void convert_fp32_to_fp16(const float* input, Half* output, size_t count) {
+    convert_kernels().to_fp16(input, reinterpret_cast<uint16_t*>(output), count);
+}
+
+void convert_fp16_to_fp32(const Half* input, float* output, size_t count) {
+    convert_kernels().to_fp32(reinterpret_cast<const uint16_t*>(input), output, count);
 }
 
 // ==============================================================================
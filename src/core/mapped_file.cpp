@@ -0,0 +1,171 @@
+#include "inference_engine/core/mapped_file.h"
+
+#include "inference_engine/core/common.h"
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#if IE_PLATFORM_WINDOWS
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#  include <cerrno>
+#  include <cstring>
+#endif
+
+namespace inference_engine {
+namespace core {
+
+#if IE_PLATFORM_WINDOWS
+
+MappedFile::MappedFile(const std::string& path) : path_(path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("MappedFile: cannot open " + path);
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        throw std::runtime_error("MappedFile: cannot map empty or unreadable file " + path);
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file); // the mapping keeps the file open
+    if (mapping == nullptr) {
+        throw std::runtime_error("MappedFile: CreateFileMapping failed for " + path);
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        throw std::runtime_error("MappedFile: MapViewOfFile failed for " + path);
+    }
+    data_ = view;
+    size_ = static_cast<std::size_t>(size.QuadPart);
+    mapping_handle_ = mapping;
+}
+
+void MappedFile::close() noexcept {
+    if (release_copy()) {
+        return;
+    }
+    if (data_ != nullptr) {
+        UnmapViewOfFile(data_);
+        CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    }
+    data_ = nullptr;
+    size_ = 0;
+    mapping_handle_ = nullptr;
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path) : path_(path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("MappedFile: cannot open " + path + ": " + std::strerror(errno));
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        throw std::runtime_error("MappedFile: cannot map empty or unreadable file " + path);
+    }
+    const std::size_t size = static_cast<std::size_t>(st.st_size);
+    void* p = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    const int map_errno = errno;
+    ::close(fd); // the mapping keeps its own reference to the file
+    if (p == MAP_FAILED) {
+        throw std::runtime_error("MappedFile: mmap failed for " + path + ": " + std::strerror(map_errno));
+    }
+    data_ = p;
+    size_ = size;
+}
+
+void MappedFile::close() noexcept {
+    if (release_copy()) {
+        return;
+    }
+    if (data_ != nullptr) {
+        ::munmap(const_cast<void*>(data_), size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+}
+
+#endif
+
+MappedFile::MappedFile(const std::string& path, const memory::PageOptions& pages) : MappedFile(path) {
+    if (pages.huge_pages == memory::HugePages::None && pages.numa_node == memory::kAnyNumaNode) {
+        if (pages.prefault) {
+            memory::prefault_pages(data_, size_, false);
+        }
+        return;
+    }
+    const memory::PageRegion region = memory::map_pages(size_, pages);
+    if (region.data == nullptr) {
+        throw std::runtime_error("MappedFile: cannot allocate pages for a copy of " + path);
+    }
+    const std::size_t size = size_;
+    std::memcpy(region.data, data_, size);
+    close();
+    data_ = region.data;
+    size_ = size;
+    copy_ = region;
+}
+
+bool MappedFile::release_copy() noexcept {
+    if (copy_.data == nullptr) {
+        return false;
+    }
+    memory::unmap_pages(copy_);
+    copy_ = {};
+    data_ = nullptr;
+    size_ = 0;
+    return true;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      path_(std::move(other.path_)),
+      copy_(std::exchange(other.copy_, memory::PageRegion{}))
+#if IE_PLATFORM_WINDOWS
+      , mapping_handle_(std::exchange(other.mapping_handle_, nullptr))
+#endif
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        path_ = std::move(other.path_);
+        copy_ = std::exchange(other.copy_, memory::PageRegion{});
+#if IE_PLATFORM_WINDOWS
+        mapping_handle_ = std::exchange(other.mapping_handle_, nullptr);
+#endif
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() noexcept {
+    close();
+}
+
+bool MappedFile::contains(const void* p, std::size_t bytes) const noexcept {
+    if (data_ == nullptr || p == nullptr) return false;
+    const auto base = reinterpret_cast<std::uintptr_t>(data_);
+    const auto addr = reinterpret_cast<std::uintptr_t>(p);
+    return addr >= base && addr - base <= size_ && bytes <= size_ - (addr - base);
+}
+
+} // namespace core
+} // namespace inference_engine
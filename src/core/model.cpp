@@ -1,19 +1,317 @@
 #include "inference_engine/core/model.h"
+#include "inference_engine/graph/execution_context.h"
+#include "inference_engine/graph/execution_plan.h"
 #include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/metrics.h"
+#include "inference_engine/graph/packed_weight_cache.h"
+#include "inference_engine/graph/plan_format.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace infer {
 
 Model::Model() : graph_(std::make_unique<Graph>()) {
 }
 
-Model::~Model() = default;
+Model::~Model() {
+    if (metrics_ != nullptr) metrics_->untrack(this);
+    // Contexts and plans reference the graph's Values.
+    dynamic_contexts_.clear();
+    plan_cache_.reset();
+    thread_contexts_.clear();
+    plan_.reset();
+}
 
 void Model::load(const std::string& path) {
-    // TODO: Load model from path
+    load(path, inference_engine::memory::PageOptions{});
+}
+
+void Model::load(const std::string& path, const inference_engine::memory::PageOptions& weight_pages) {
+    inference_engine::core::MappedFile mapping(path, weight_pages);
+    auto graph = std::make_unique<Graph>();
+    ModelWeights weights;
+    readModel(mapping, *graph, weights, weight_store_);
+    std::uint64_t hash = 0;
+    if (!weight_cache_dir_.empty()) hash = PackedWeightCache::hashBytes(mapping.data(), mapping.size());
+    // Interned weights own their blobs; nothing points into the file any more.
+    if (weight_store_ != nullptr) mapping = inference_engine::core::MappedFile{};
+
+    // The old graph goes first: its operators may still view the old mapping.
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        dynamic_contexts_.clear();
+        plan_cache_.reset();
+        thread_contexts_.clear();
+        plan_.reset();
+    }
+    graph_ = std::move(graph);
+    weights_ = std::move(weights);
+    mapping_ = std::move(mapping);
+    weight_cache_.reset();
+    if (!weight_cache_dir_.empty()) {
+        weight_cache_ = std::make_unique<PackedWeightCache>(weight_cache_dir_, hash);
+    }
+}
+
+void Model::setWeightCacheDirectory(std::string directory) {
+    weight_cache_dir_ = std::move(directory);
+}
+
+void Model::save(const std::string& path) const {
+    saveModel(*graph_, path);
+}
+
+CompileOptions Model::planOptions() const {
+    CompileOptions options;
+    options.bind_memory = false; // every request brings its own arena
+    options.arena_pages = arena_pages_;
+    options.weight_cache = weight_cache_.get();
+    options.weight_store = weight_store_;
+    return options;
+}
+
+const ExecutionPlan& Model::plan() {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (!plan_ || plan_revision_ != graph_->revision()) {
+        thread_contexts_.clear();
+        plan_.reset();
+        plan_ = graph_->compile(planOptions());
+        plan_revision_ = graph_->revision();
+        // Best effort: a read-only cache directory only costs the next load a repack.
+        if (weight_cache_) (void)weight_cache_->flush();
+    }
+    return *plan_;
+}
+
+void Model::savePlan(const std::string& path) {
+    const ExecutionPlan& compiled = plan();
+    infer::savePlan(*graph_, compiled, path);
+}
+
+bool Model::loadPlan(const std::string& path, std::string* reason) {
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(path, ec)) {
+        if (reason != nullptr) *reason = "loadPlan: no plan file at " + path;
+        return false;
+    }
+    const inference_engine::core::MappedFile file(path);
+    std::lock_guard<std::mutex> lock(mu_);
+    thread_contexts_.clear();
+    plan_.reset();
+    plan_ = infer::loadPlan(file, *graph_, planOptions(), reason);
+    if (!plan_) return false;
+    plan_revision_ = graph_->revision();
+    if (weight_cache_) (void)weight_cache_->flush();
+    return true;
+}
+
+void Model::setPlanCacheOptions(const PlanCacheOptions& options) {
+    std::lock_guard<std::mutex> lock(mu_);
+    dynamic_contexts_.clear();
+    plan_cache_.reset();
+    plan_cache_options_ = options;
+}
+
+void Model::setArenaPages(const inference_engine::memory::PageOptions& pages) {
+    std::lock_guard<std::mutex> lock(mu_);
+    dynamic_contexts_.clear();
+    plan_cache_.reset();
+    thread_contexts_.clear();
+    plan_.reset();
+    arena_pages_ = pages;
+}
+
+void Model::setMetrics(MetricsRegistry* metrics, const std::string& name) {
+    if (metrics_ != nullptr) metrics_->untrack(this);
+    metrics_ = metrics;
+    latency_ = nullptr;
+    if (metrics_ != nullptr) {
+        latency_ = &metrics_->modelLatency(name);
+        metrics_->track(name, *this);
+    }
+}
+
+Model::ArenaStats Model::arenaStats() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return arenaStatsLocked();
+}
+
+Model::ArenaStats Model::arenaStatsLocked() const {
+    ArenaStats stats;
+    for (const auto& [thread, ctx] : thread_contexts_) {
+        ++stats.contexts;
+        stats.bytes += ctx->arenaBytes();
+    }
+    for (const auto& [thread, list] : dynamic_contexts_) {
+        for (const DynamicContext& d : list) {
+            ++stats.contexts;
+            stats.bytes += d.ctx->arenaBytes();
+        }
+    }
+    stats.peak_bytes = std::max(arena_peak_bytes_, stats.bytes);
+    return stats;
+}
+
+void Model::noteArenaUsage() {
+    arena_peak_bytes_ = arenaStatsLocked().peak_bytes;
+}
+
+PlanCache& Model::planCache() {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (!plan_cache_) {
+        PlanCacheOptions options = plan_cache_options_;
+        if (!arena_pages_.is_default()) {
+            options.compile.arena_pages = arena_pages_;
+        }
+        options.compile.weight_cache = weight_cache_.get();
+        options.compile.weight_store = weight_store_;
+        plan_cache_ = std::make_unique<PlanCache>(*graph_, options);
+    }
+    return *plan_cache_;
+}
+
+std::unique_ptr<ExecutionContext> Model::createContext() {
+    return plan().createContext();
 }
 
 inference_engine::core::Tensor Model::infer(const inference_engine::core::Tensor& input) {
-    return graph_->execute(input);
+    const ExecutionPlan& compiled = plan();
+    if (compiled.inputs().size() == 1 && input.shape() != compiled.inputs()[0]->shape()) {
+        return inferDynamic(input);
+    }
+    ExecutionContext* ctx = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto& slot = thread_contexts_[std::this_thread::get_id()];
+        if (!slot) {
+            slot = compiled.createContext();
+            noteArenaUsage();
+        }
+        ctx = slot.get();
+    }
+    return infer(*ctx, input);
+}
+
+inference_engine::core::Tensor Model::inferDynamic(const inference_engine::core::Tensor& input) {
+    using inference_engine::core::Shape;
+    using inference_engine::core::Tensor;
+
+    std::shared_ptr<const SpecializedPlan> specialized = planCache().acquire({input.shape()});
+    ExecutionContext* ctx = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto& list = dynamic_contexts_[std::this_thread::get_id()];
+        auto it = std::find_if(list.begin(), list.end(),
+                               [&](const DynamicContext& d) { return d.plan == specialized; });
+        if (it == list.end()) {
+            list.insert(list.begin(), DynamicContext{specialized, specialized->plan().createContext()});
+            if (list.size() > plan_cache_options_.capacity) list.pop_back();
+            noteArenaUsage();
+        } else if (it != list.begin()) {
+            std::rotate(list.begin(), it, it + 1);
+        }
+        ctx = list.front().ctx.get();
+    }
+
+    const Shape& run_shape = specialized->inputShapes()[0];
+    if (run_shape == input.shape()) {
+        return infer(*ctx, input);
+    }
+    if (!input.is_contiguous() || input.data() == nullptr) {
+        throw std::invalid_argument("Model::infer: input must be contiguous");
+    }
+    // Bucketed batch: zero-pad the input rows, run, and keep the caller's rows.
+    thread_local std::vector<std::uint64_t> staging;
+    const std::size_t in_bytes = static_cast<std::size_t>(input.byte_size());
+    const std::size_t run_bytes =
+        static_cast<std::size_t>(run_shape.num_elements()) * inference_engine::core::bytes_per_element(input.dtype());
+    staging.assign((run_bytes + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t), 0);
+    std::memcpy(staging.data(), input.data(), in_bytes);
+    Tensor padded(run_shape, input.dtype(), staging.data(), false);
+    padded.set_quant_params(input.quant_params());
+
+    Tensor out = infer(*ctx, padded);
+    if (out.rank() == 0 || out.shape().dim(0) != run_shape.dim(0) || !out.is_contiguous()) {
+        return out;
+    }
+    inference_engine::core::DimVector dims = out.shape().dims();
+    dims[0] = input.shape().dim(0);
+    Tensor rows(Shape(std::move(dims)), out.dtype(), out.data(), false);
+    rows.set_quant_params(out.quant_params());
+    return rows;
+}
+
+inference_engine::core::Tensor Model::infer(ExecutionContext& ctx, const inference_engine::core::Tensor& input) {
+    const ExecutionPlan& compiled = ctx.plan();
+    if (compiled.steps().empty()) {
+        return input;
+    }
+    if (compiled.inputs().size() != 1) {
+        throw std::invalid_argument("Model::infer: expected a single-input graph");
+    }
+    // Reused per thread so the steady state allocates nothing.
+    thread_local std::vector<inference_engine::core::Tensor> inputs(1);
+    thread_local std::vector<inference_engine::core::Tensor> outputs;
+    inputs[0] = input;
+    if (metrics_ == nullptr) {
+        compiled.run(ctx, inputs, outputs);
+    } else {
+        MetricsRegistry::Scope scope(metrics_);
+        const auto t0 = std::chrono::steady_clock::now();
+        compiled.run(ctx, inputs, outputs);
+        const auto elapsed = std::chrono::steady_clock::now() - t0;
+        latency_->record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+    if (outputs.size() == 1 && outputs[0].data() != nullptr) {
+        return outputs[0];
+    }
+    return input;
+}
+
+std::future<inference_engine::core::Tensor> Model::inferAsync(ThreadPool& pool,
+                                                           const inference_engine::core::Tensor& input) {
+    auto promise = std::make_shared<std::promise<inference_engine::core::Tensor>>();
+    std::future<inference_engine::core::Tensor> result = promise->get_future();
+    inferAsync(pool, input, [promise](inference_engine::core::Tensor value, std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value(std::move(value));
+        }
+    });
+    return result;
+}
+
+void Model::inferAsync(ThreadPool& pool, const inference_engine::core::Tensor& input, InferCallback done) {
+    auto task = [this, input, done = std::move(done)]() {
+        inference_engine::core::Tensor result;
+        std::exception_ptr error;
+        try {
+            // The thread's context is reused by its next request, so hand out a copy.
+            result = infer(input).clone();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        done(std::move(result), error);
+    };
+    if (pool.size() == 0) {
+        task(); // no workers to hand the request to
+    } else {
+        pool.enqueue(std::move(task));
+    }
+}
+
+const inference_engine::core::Tensor* Model::findWeight(const std::string& name) const {
+    const auto it = weights_.find(name);
+    return it == weights_.end() ? nullptr : &it->second;
 }
 
 } // namespace infer
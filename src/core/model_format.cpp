@@ -0,0 +1,546 @@
+#include "inference_engine/core/model_format.h"
+
+#include "inference_engine/core/mapped_file.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/graph/weight_store.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/matmul_bias_blockq.h"
+#include "inference_engine/ops/matmul_bias_fp16.h"
+#include "inference_engine/ops/matmul_bias_sparse.h"
+#include "inference_engine/ops/softmax.h"
+
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+using inference_engine::core::Half;
+using inference_engine::core::MappedFile;
+using inference_engine::core::QuantizationParams;
+using inference_engine::core::Shape;
+using inference_engine::core::Storage;
+using inference_engine::core::Tensor;
+
+namespace {
+
+constexpr std::uint32_t kMaxRank = 8;
+
+bool hostIsLittleEndian() {
+    const std::uint16_t probe = 1;
+    std::uint8_t first = 0;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+std::size_t alignUp(std::size_t v, std::size_t a) {
+    return (v + a - 1) / a * a;
+}
+
+// Appends fixed-width little-endian fields (the host byte order, checked by callers).
+class ByteWriter {
+public:
+    template <typename T>
+    void put(T v) {
+        const auto* p = reinterpret_cast<const char*>(&v);
+        bytes_.insert(bytes_.end(), p, p + sizeof(T));
+    }
+    void putString(const std::string& s) {
+        put(static_cast<std::uint32_t>(s.size()));
+        bytes_.insert(bytes_.end(), s.begin(), s.end());
+    }
+    void putShape(const Shape& s) {
+        put(static_cast<std::uint32_t>(s.rank()));
+        for (std::int64_t d : s.dims()) put(d);
+    }
+    [[nodiscard]] const std::vector<char>& bytes() const noexcept { return bytes_; }
+
+private:
+    std::vector<char> bytes_{};
+};
+
+// Bounds-checked cursor over the metadata section.
+class ByteReader {
+public:
+    ByteReader(const char* data, std::size_t size) : p_(data), end_(data + size) {}
+
+    template <typename T>
+    T get() {
+        require(sizeof(T));
+        T v;
+        std::memcpy(&v, p_, sizeof(T));
+        p_ += sizeof(T);
+        return v;
+    }
+    std::string getString() {
+        const auto n = get<std::uint32_t>();
+        require(n);
+        std::string s(p_, n);
+        p_ += n;
+        return s;
+    }
+    Shape getShape() {
+        const auto rank = get<std::uint32_t>();
+        if (rank > kMaxRank) throw std::runtime_error("Model::load: tensor rank too large");
+        std::vector<std::int64_t> dims(rank);
+        std::int64_t elements = 1;
+        for (auto& d : dims) {
+            d = get<std::int64_t>();
+            if (d < 0) throw std::runtime_error("Model::load: negative dimension");
+            // Element counts (and the byte sizes derived from them) must not wrap.
+            if (d != 0 && elements > std::numeric_limits<std::int64_t>::max() / d) {
+                throw std::runtime_error("Model::load: tensor dimensions overflow");
+            }
+            elements *= d;
+        }
+        return Shape(std::move(dims));
+    }
+    // Element count, bounded by the remaining bytes so corrupt counts fail before
+    // anything is allocated for them.
+    std::uint32_t getCount(std::size_t min_bytes_per_item) {
+        const auto n = get<std::uint32_t>();
+        if (min_bytes_per_item != 0 && n > static_cast<std::size_t>(end_ - p_) / min_bytes_per_item) {
+            throw std::runtime_error("Model::load: truncated metadata");
+        }
+        return n;
+    }
+
+private:
+    void require(std::size_t n) const {
+        if (n > static_cast<std::size_t>(end_ - p_)) throw std::runtime_error("Model::load: truncated metadata");
+    }
+
+    const char* p_;
+    const char* end_;
+};
+
+void putQuantization(ByteWriter& w, const Value& v) {
+    w.put<std::uint8_t>(v.hasQuantization() ? 1 : 0);
+    if (!v.hasQuantization()) return;
+    const QuantizationParams& qp = *v.quantization();
+    w.put(qp.scale);
+    w.put(qp.zero_point);
+    w.put(static_cast<std::int32_t>(qp.axis));
+    w.put<std::uint8_t>(qp.symmetric ? 1 : 0);
+    w.put(static_cast<std::uint32_t>(qp.per_channel_scales.size()));
+    for (float s : qp.per_channel_scales) w.put(s);
+    w.put(static_cast<std::uint32_t>(qp.per_channel_zero_points.size()));
+    for (std::int32_t zp : qp.per_channel_zero_points) w.put(zp);
+    w.put(qp.group_size);
+    w.put(qp.bits);
+    w.put(static_cast<std::uint32_t>(qp.group_scales.size()));
+    for (Half s : qp.group_scales) w.put(s.bits);
+}
+
+QuantizationParams getQuantization(ByteReader& r) {
+    QuantizationParams qp;
+    qp.scale = r.get<float>();
+    qp.zero_point = r.get<std::int32_t>();
+    qp.axis = r.get<std::int32_t>();
+    qp.symmetric = r.get<std::uint8_t>() != 0;
+    qp.per_channel_scales.resize(r.getCount(sizeof(float)));
+    for (auto& s : qp.per_channel_scales) s = r.get<float>();
+    qp.per_channel_zero_points.resize(r.getCount(sizeof(std::int32_t)));
+    for (auto& zp : qp.per_channel_zero_points) zp = r.get<std::int32_t>();
+    qp.group_size = r.get<std::int32_t>();
+    qp.bits = r.get<std::int32_t>();
+    if (qp.group_size < 0 || (qp.is_grouped() && qp.bits != 4 && qp.bits != 8)) {
+        throw std::runtime_error("Model::load: invalid group quantization");
+    }
+    qp.group_scales.resize(r.getCount(sizeof(std::uint16_t)));
+    for (auto& s : qp.group_scales) s = Half::from_bits(r.get<std::uint16_t>());
+    return qp;
+}
+
+struct TensorRecord {
+    std::string name;
+    DataType dtype;
+    Shape shape;
+    const void* data;
+    std::size_t bytes;
+};
+
+struct NodeRecord {
+    const Node* node = nullptr;
+    Activation activation = Activation::None;
+    std::vector<std::uint32_t> tensors;
+};
+
+// Registers one operator parameter blob and returns its tensor index.
+std::uint32_t addTensor(std::vector<TensorRecord>& tensors, std::string name, DataType dtype, Shape shape,
+                        const void* data, std::size_t bytes) {
+    tensors.push_back({std::move(name), dtype, std::move(shape), data, bytes});
+    return static_cast<std::uint32_t>(tensors.size() - 1);
+}
+
+std::vector<std::uint32_t> valueIndices(const std::vector<Value*>& vs,
+                                        const std::unordered_map<const Value*, std::uint32_t>& index) {
+    std::vector<std::uint32_t> out;
+    out.reserve(vs.size());
+    for (const Value* v : vs) {
+        const auto it = index.find(v);
+        if (it == index.end()) throw std::invalid_argument("saveModel: node references a foreign Value");
+        out.push_back(it->second);
+    }
+    return out;
+}
+
+void putIndices(ByteWriter& w, const std::vector<std::uint32_t>& ids) {
+    w.put(static_cast<std::uint32_t>(ids.size()));
+    for (std::uint32_t id : ids) w.put(id);
+}
+
+std::vector<Value*> getValues(ByteReader& r, const std::vector<Value*>& values) {
+    std::vector<Value*> out(r.getCount(sizeof(std::uint32_t)));
+    for (auto& v : out) {
+        const auto id = r.get<std::uint32_t>();
+        if (id >= values.size()) throw std::runtime_error("Model::load: value index out of range");
+        v = values[id];
+    }
+    return out;
+}
+
+template <typename T>
+WeightBuffer<T> weightView(const Tensor& t, DataType dtype, const Shape& shape, const std::string& node) {
+    if (t.dtype() != dtype || t.shape() != shape) {
+        throw std::runtime_error("Model::load: unexpected weight tensor layout in node '" + node + "'");
+    }
+    if (t.owns_data()) return WeightBuffer<T>::shared(t.storage());
+    return WeightBuffer<T>::view(t.data_as<T>(), static_cast<std::size_t>(t.num_elements()));
+}
+
+std::unique_ptr<Operator> makeOperator(const std::string& type, const std::string& node, Activation activation,
+                                       const std::vector<const Tensor*>& tensors, const std::vector<Value*>& inputs) {
+    if (type == "MatMulBias" || type == "MatMulBiasFp16") {
+        if (tensors.size() != 2 || tensors[0]->rank() != 2) {
+            throw std::runtime_error("Model::load: node '" + node + "' needs [in, out] weights and a bias");
+        }
+        const std::int64_t in_dim = tensors[0]->dim(0);
+        const std::int64_t out_dim = tensors[0]->dim(1);
+        const Shape w_shape({in_dim, out_dim});
+        auto bias = weightView<float>(*tensors[1], DataType::FP32, Shape({out_dim}), node);
+        if (type == "MatMulBias") {
+            return std::make_unique<MatMulBiasOp>(in_dim, out_dim,
+                                                  weightView<float>(*tensors[0], DataType::FP32, w_shape, node),
+                                                  std::move(bias), activation);
+        }
+        return std::make_unique<MatMulBiasFp16Op>(in_dim, out_dim,
+                                                  weightView<Half>(*tensors[0], DataType::FP16, w_shape, node),
+                                                  std::move(bias), activation);
+    }
+    if (type == "MatMulBiasBlockQ") {
+        // Packed weights [panels, in, panel * bits / 8], scales [panels, in / group, panel], bias [out].
+        if (tensors.size() != 3 || tensors[0]->rank() != 3 || tensors[1]->rank() != 3 || tensors[2]->rank() != 1 ||
+            tensors[1]->dim(1) <= 0) {
+            throw std::runtime_error("Model::load: node '" + node + "' needs packed weights, scales and a bias");
+        }
+        const auto panel = static_cast<std::int64_t>(kBlockQPanel);
+        const std::int64_t panels = tensors[0]->dim(0);
+        const std::int64_t in_dim = tensors[0]->dim(1);
+        const std::int64_t out_dim = tensors[2]->dim(0);
+        const auto bits = static_cast<int>(tensors[0]->dim(2) * 8 / panel);
+        const std::int64_t groups = tensors[1]->dim(1);
+        if (panels != (out_dim + panel - 1) / panel || in_dim % groups != 0) {
+            throw std::runtime_error("Model::load: inconsistent block-quantized weights in node '" + node + "'");
+        }
+        return std::make_unique<MatMulBiasBlockQOp>(
+            in_dim, out_dim, bits, in_dim / groups,
+            weightView<std::uint8_t>(*tensors[0], DataType::UINT8, tensors[0]->shape(), node),
+            weightView<Half>(*tensors[1], DataType::FP16, Shape({panels, groups, panel}), node),
+            weightView<float>(*tensors[2], DataType::FP32, Shape({out_dim}), node), activation);
+    }
+    if (type == "MatMulBiasSparse") {
+        // N:M: values and indices [panels, in / m, n, panel]. Block CSR: values [blocks,
+        // block_in, block_out], row_ptr [block rows + 1], col_idx [blocks]. Then the bias
+        // [out]; in_dim is the input Value's.
+        const bool nm = tensors.size() == 3;
+        if ((tensors.size() != 3 && tensors.size() != 4) || tensors[0]->rank() != (nm ? 4 : 3) ||
+            tensors.back()->rank() != 1 || inputs.size() != 1 || inputs[0] == nullptr ||
+            inputs[0]->shape().rank() != 2) {
+            throw std::runtime_error("Model::load: node '" + node + "' needs packed sparse weights and a bias");
+        }
+        const std::int64_t in_dim = inputs[0]->shape().dim(1);
+        const std::int64_t out_dim = tensors.back()->dim(0);
+        const Shape& vs = tensors[0]->shape();
+        SparsePattern pattern;
+        WeightBuffer<std::uint8_t> indices;
+        WeightBuffer<std::uint32_t> row_ptr;
+        WeightBuffer<std::uint32_t> col_idx;
+        if (nm) {
+            if (vs.dim(1) <= 0 || in_dim % vs.dim(1) != 0) {
+                throw std::runtime_error("Model::load: inconsistent N:M weights in node '" + node + "'");
+            }
+            pattern = SparsePattern::nm(static_cast<std::size_t>(vs.dim(2)),
+                                        static_cast<std::size_t>(in_dim / vs.dim(1)));
+            indices = weightView<std::uint8_t>(*tensors[1], DataType::UINT8, vs, node);
+        } else {
+            pattern = SparsePattern::blockCsr(static_cast<std::size_t>(vs.dim(2)), static_cast<std::size_t>(vs.dim(1)));
+            row_ptr = weightView<std::uint32_t>(*tensors[1], DataType::UINT32, tensors[1]->shape(), node);
+            col_idx = weightView<std::uint32_t>(*tensors[2], DataType::UINT32, Shape({vs.dim(0)}), node);
+        }
+        try {
+            return std::make_unique<MatMulBiasSparseOp>(
+                in_dim, out_dim, pattern, weightView<float>(*tensors[0], DataType::FP32, vs, node), std::move(indices),
+                std::move(row_ptr), std::move(col_idx),
+                weightView<float>(*tensors.back(), DataType::FP32, Shape({out_dim}), node), activation);
+        } catch (const std::invalid_argument& e) {
+            throw std::runtime_error("Model::load: node '" + node + "': " + e.what());
+        }
+    }
+    if (!tensors.empty()) {
+        throw std::runtime_error("Model::load: node '" + node + "' does not take weights");
+    }
+    if (type == "ReLU") return std::make_unique<ReluOp>();
+    if (type == "Softmax") return std::make_unique<SoftmaxOp>();
+    throw std::runtime_error("Model::load: unsupported operator '" + type + "'");
+}
+
+} // namespace
+
+void saveModel(const Graph& graph, const std::string& path) {
+    if (!hostIsLittleEndian()) throw std::runtime_error("saveModel: big-endian hosts are not supported");
+
+    std::unordered_map<const Value*, std::uint32_t> value_index;
+    for (const auto& v : graph.values()) {
+        value_index.emplace(v.get(), static_cast<std::uint32_t>(value_index.size()));
+    }
+
+    std::vector<TensorRecord> tensors;
+    std::vector<NodeRecord> nodes;
+    // Weights rebuilt from a prepacked copy, kept alive until the file is written.
+    std::deque<std::vector<float>> unpacked;
+    for (std::size_t i = 0; i < graph.nodes().size(); ++i) {
+        const Node* node = graph.nodes()[i].get();
+        const Operator* op = node->op();
+        const std::string prefix = node->name().empty() ? "node" + std::to_string(i) : node->name();
+        NodeRecord rec{};
+        rec.node = node;
+        if (const auto* fc = dynamic_cast<const MatMulBiasOp*>(op)) {
+            rec.activation = fc->activation();
+            const float* w = fc->weights().data();
+            if (fc->weights().empty()) w = unpacked.emplace_back(fc->rowMajorWeights()).data();
+            rec.tensors.push_back(addTensor(tensors, prefix + ".weight", DataType::FP32,
+                                            Shape({fc->inDim(), fc->outDim()}), w,
+                                            static_cast<std::size_t>(fc->inDim() * fc->outDim()) * sizeof(float)));
+            rec.tensors.push_back(addTensor(tensors, prefix + ".bias", DataType::FP32, Shape({fc->outDim()}),
+                                            fc->bias().data(), fc->bias().size() * sizeof(float)));
+        } else if (const auto* fc16 = dynamic_cast<const MatMulBiasFp16Op*>(op)) {
+            rec.activation = fc16->activation();
+            rec.tensors.push_back(addTensor(tensors, prefix + ".weight", DataType::FP16,
+                                            Shape({fc16->inDim(), fc16->outDim()}), fc16->weights().data(),
+                                            fc16->weights().size() * sizeof(Half)));
+            rec.tensors.push_back(addTensor(tensors, prefix + ".bias", DataType::FP32, Shape({fc16->outDim()}),
+                                            fc16->bias().data(), fc16->bias().size() * sizeof(float)));
+        } else if (const auto* fcq = dynamic_cast<const MatMulBiasBlockQOp*>(op)) {
+            const auto panel = static_cast<std::int64_t>(kBlockQPanel);
+            const std::int64_t panels = (fcq->outDim() + panel - 1) / panel;
+            rec.activation = fcq->activation();
+            rec.tensors.push_back(addTensor(tensors, prefix + ".qweight", DataType::UINT8,
+                                            Shape({panels, fcq->inDim(), panel * fcq->bits() / 8}),
+                                            fcq->packedWeights().data(), fcq->packedWeights().size()));
+            rec.tensors.push_back(addTensor(tensors, prefix + ".scales", DataType::FP16,
+                                            Shape({panels, fcq->inDim() / fcq->groupSize(), panel}),
+                                            fcq->packedScales().data(), fcq->packedScales().size() * sizeof(Half)));
+            rec.tensors.push_back(addTensor(tensors, prefix + ".bias", DataType::FP32, Shape({fcq->outDim()}),
+                                            fcq->bias().data(), fcq->bias().size() * sizeof(float)));
+        } else if (const auto* fcs = dynamic_cast<const MatMulBiasSparseOp*>(op)) {
+            const SparsePattern& p = fcs->pattern();
+            rec.activation = fcs->activation();
+            const auto values_bytes = fcs->values().size() * sizeof(float);
+            if (p.format == SparseFormat::NM) {
+                const auto panel = static_cast<std::int64_t>(kSparsePanel);
+                const Shape shape({(fcs->outDim() + panel - 1) / panel, fcs->inDim() / static_cast<std::int64_t>(p.m),
+                                   static_cast<std::int64_t>(p.n), panel});
+                rec.tensors.push_back(
+                    addTensor(tensors, prefix + ".values", DataType::FP32, shape, fcs->values().data(), values_bytes));
+                rec.tensors.push_back(addTensor(tensors, prefix + ".indices", DataType::UINT8, shape,
+                                                fcs->indices().data(), fcs->indices().size()));
+            } else {
+                const auto blocks = static_cast<std::int64_t>(fcs->colIdx().size());
+                rec.tensors.push_back(addTensor(
+                    tensors, prefix + ".values", DataType::FP32,
+                    Shape({blocks, static_cast<std::int64_t>(p.block_in), static_cast<std::int64_t>(p.block_out)}),
+                    fcs->values().data(), values_bytes));
+                rec.tensors.push_back(addTensor(tensors, prefix + ".row_ptr", DataType::UINT32,
+                                                Shape({static_cast<std::int64_t>(fcs->rowPtr().size())}),
+                                                fcs->rowPtr().data(), fcs->rowPtr().size() * sizeof(std::uint32_t)));
+                rec.tensors.push_back(addTensor(tensors, prefix + ".col_idx", DataType::UINT32, Shape({blocks}),
+                                                fcs->colIdx().data(), fcs->colIdx().size() * sizeof(std::uint32_t)));
+            }
+            rec.tensors.push_back(addTensor(tensors, prefix + ".bias", DataType::FP32, Shape({fcs->outDim()}),
+                                            fcs->bias().data(), fcs->bias().size() * sizeof(float)));
+        } else if (op == nullptr || (op->type() != "ReLU" && op->type() != "Softmax")) {
+            throw std::invalid_argument("saveModel: operator '" + (op ? op->type() : std::string("<null>")) +
+                                        "' cannot be serialized");
+        }
+        nodes.push_back(std::move(rec));
+    }
+
+    ByteWriter meta;
+    meta.putString(graph.modelName());
+    meta.putString(graph.modelVersion());
+
+    std::size_t data_bytes = 0;
+    meta.put(static_cast<std::uint32_t>(tensors.size()));
+    std::vector<std::size_t> offsets;
+    for (const auto& t : tensors) {
+        data_bytes = alignUp(data_bytes, model_format::kTensorAlignment);
+        offsets.push_back(data_bytes);
+        meta.putString(t.name);
+        meta.put(static_cast<std::uint32_t>(t.dtype));
+        meta.putShape(t.shape);
+        meta.put(static_cast<std::uint64_t>(data_bytes));
+        meta.put(static_cast<std::uint64_t>(t.bytes));
+        data_bytes += t.bytes;
+    }
+
+    meta.put(static_cast<std::uint32_t>(graph.values().size()));
+    for (const auto& v : graph.values()) {
+        meta.putString(v->name());
+        meta.put(static_cast<std::uint32_t>(v->dtype()));
+        meta.putShape(v->shape());
+        putQuantization(meta, *v);
+    }
+
+    meta.put(static_cast<std::uint32_t>(nodes.size()));
+    for (const auto& rec : nodes) {
+        meta.putString(rec.node->name());
+        meta.putString(rec.node->op()->type());
+        meta.put(static_cast<std::uint32_t>(rec.activation));
+        putIndices(meta, rec.tensors);
+        putIndices(meta, valueIndices(rec.node->inputs(), value_index));
+        putIndices(meta, valueIndices(rec.node->outputs(), value_index));
+    }
+    putIndices(meta, valueIndices(graph.inputs(), value_index));
+    putIndices(meta, valueIndices(graph.outputs(), value_index));
+
+    model_format::FileHeader header{};
+    std::memcpy(header.magic, model_format::kMagic, sizeof(header.magic));
+    header.version = model_format::kVersion;
+    header.header_bytes = sizeof(header);
+    header.metadata_offset = sizeof(header);
+    header.metadata_bytes = meta.bytes().size();
+    header.data_offset = alignUp(sizeof(header) + meta.bytes().size(), model_format::kDataAlignment);
+    header.data_bytes = data_bytes;
+    header.file_bytes = header.data_offset + data_bytes;
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) throw std::runtime_error("saveModel: cannot open " + path);
+    const std::vector<char> zeros(model_format::kDataAlignment, 0);
+    auto pad_to = [&](std::uint64_t pos) {
+        const std::uint64_t cur = static_cast<std::uint64_t>(out.tellp());
+        out.write(zeros.data(), static_cast<std::streamsize>(pos - cur));
+    };
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(meta.bytes().data(), static_cast<std::streamsize>(meta.bytes().size()));
+    for (std::size_t i = 0; i < tensors.size(); ++i) {
+        pad_to(header.data_offset + offsets[i]);
+        out.write(static_cast<const char*>(tensors[i].data), static_cast<std::streamsize>(tensors[i].bytes));
+    }
+    pad_to(header.file_bytes);
+    if (!out) throw std::runtime_error("saveModel: write failed for " + path);
+}
+
+void readModel(const MappedFile& file, Graph& graph, ModelWeights& weights, WeightStore* store) {
+    if (!hostIsLittleEndian()) throw std::runtime_error("Model::load: big-endian hosts are not supported");
+
+    const auto* base = static_cast<const char*>(file.data());
+    model_format::FileHeader header{};
+    if (file.size() < sizeof(header)) throw std::runtime_error("Model::load: file too small");
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, model_format::kMagic, sizeof(header.magic)) != 0) {
+        throw std::runtime_error("Model::load: not a model file (bad magic)");
+    }
+    if (header.version != model_format::kVersion) {
+        throw std::runtime_error("Model::load: unsupported format version " + std::to_string(header.version));
+    }
+    if (header.header_bytes != sizeof(header) || header.file_bytes != file.size() ||
+        header.metadata_offset > file.size() || header.metadata_bytes > file.size() - header.metadata_offset ||
+        header.data_offset % model_format::kDataAlignment != 0 || header.data_offset > file.size() ||
+        header.data_bytes > file.size() - header.data_offset) {
+        throw std::runtime_error("Model::load: corrupt header");
+    }
+
+    ByteReader r(base + header.metadata_offset, static_cast<std::size_t>(header.metadata_bytes));
+    graph.setModelName(r.getString());
+    graph.setModelVersion(r.getString());
+
+    const char* data = base + header.data_offset;
+    std::vector<const Tensor*> tensors(r.getCount(3 * sizeof(std::uint32_t)));
+    for (auto& slot : tensors) {
+        std::string name = r.getString();
+        const auto dtype = static_cast<DataType>(r.get<std::uint32_t>());
+        Shape shape = r.getShape();
+        const auto offset = r.get<std::uint64_t>();
+        const auto bytes = r.get<std::uint64_t>();
+        const std::size_t elem = inference_engine::core::bytes_per_element(dtype);
+        if (elem == 0) throw std::runtime_error("Model::load: tensor '" + name + "' has an unknown dtype");
+        // Bounding the element count first keeps elements * elem from overflowing.
+        const auto elements = static_cast<std::uint64_t>(shape.num_elements());
+        if (elements > header.data_bytes / elem || bytes != elements * elem ||
+            offset % model_format::kTensorAlignment != 0 || offset > header.data_bytes ||
+            bytes > header.data_bytes - offset) {
+            throw std::runtime_error("Model::load: tensor '" + name + "' lies outside the data section");
+        }
+        Tensor tensor;
+        if (store != nullptr) {
+            // Blobs are immutable too; the const_cast only satisfies Tensor's interface.
+            auto blob = std::const_pointer_cast<Storage>(store->intern(data + offset, static_cast<std::size_t>(bytes)));
+            tensor = Tensor(std::move(shape), dtype, std::move(blob));
+        } else {
+            // The mapping is read-only; the const_cast only satisfies Tensor's interface.
+            tensor = Tensor(std::move(shape), dtype, const_cast<char*>(data + offset), false);
+        }
+        const auto [it, inserted] = weights.emplace(name, std::move(tensor));
+        if (!inserted) throw std::runtime_error("Model::load: duplicate tensor '" + name + "'");
+        slot = &it->second;
+    }
+
+    std::vector<Value*> values(r.getCount(3 * sizeof(std::uint32_t)));
+    for (auto& v : values) {
+        std::string name = r.getString();
+        const auto dtype = static_cast<DataType>(r.get<std::uint32_t>());
+        Shape shape = r.getShape();
+        if (r.get<std::uint8_t>() != 0) {
+            v = graph.createValue(shape, dtype, getQuantization(r), std::move(name));
+        } else {
+            v = graph.createValue(shape, dtype, std::move(name));
+        }
+    }
+
+    const std::uint32_t node_count = r.getCount(4 * sizeof(std::uint32_t));
+    for (std::uint32_t i = 0; i < node_count; ++i) {
+        std::string name = r.getString();
+        const std::string type = r.getString();
+        const auto activation = r.get<std::uint32_t>();
+        if (activation > static_cast<std::uint32_t>(Activation::ReLU)) {
+            throw std::runtime_error("Model::load: unknown activation in node '" + name + "'");
+        }
+        std::vector<const Tensor*> params(r.getCount(sizeof(std::uint32_t)));
+        for (auto& t : params) {
+            const auto id = r.get<std::uint32_t>();
+            if (id >= tensors.size()) throw std::runtime_error("Model::load: tensor index out of range");
+            t = tensors[id];
+        }
+        std::vector<Value*> inputs = getValues(r, values);
+        std::vector<Value*> outputs = getValues(r, values);
+        auto op = makeOperator(type, name, static_cast<Activation>(activation), params, inputs);
+        Node* node = graph.addNode(std::move(op), std::move(name));
+        node->setInputs(std::move(inputs));
+        node->setOutputs(std::move(outputs));
+    }
+    graph.setInputs(getValues(r, values));
+    graph.setOutputs(getValues(r, values));
+}
+
+} // namespace infer
@@ -0,0 +1,71 @@
+#include "inference_engine/core/storage.h"
+#include "inference_engine/memory/allocator.h"
+
+#include <new>
+
+namespace inference_engine {
+namespace core {
+
+namespace {
+
+void release_block(void* data, Allocator* allocator) noexcept {
+    if (data == nullptr) {
+        return;
+    }
+    if (allocator != nullptr) {
+        allocator->deallocate(data);
+    } else {
+        delete[] static_cast<uint8_t*>(data);
+    }
+}
+
+} // namespace
+
+Storage::Storage(void* data, std::size_t size_bytes, Allocator* allocator) noexcept
+    : data_(data), size_(size_bytes), allocator_(allocator) {}
+
+std::shared_ptr<Storage> Storage::allocate(std::size_t size_bytes, Allocator* allocator) {
+    void* data = nullptr;
+    if (allocator != nullptr) {
+        data = allocator->allocate(static_cast<int64_t>(size_bytes));
+        if (data == nullptr && size_bytes > 0) {
+            throw std::bad_alloc();
+        }
+    } else {
+        data = new uint8_t[size_bytes];
+    }
+    return adopt(data, size_bytes, allocator);
+}
+
+std::shared_ptr<Storage> Storage::adopt(void* data, std::size_t size_bytes, Allocator* allocator) {
+    // The block is released even if the bookkeeping cannot be allocated.
+    std::unique_ptr<Storage> storage;
+    try {
+        storage.reset(new Storage(data, size_bytes, allocator));
+    } catch (...) {
+        release_block(data, allocator);
+        throw;
+    }
+    return std::shared_ptr<Storage>(std::move(storage));
+}
+
+std::shared_ptr<Storage> Storage::adopt(std::unique_ptr<Allocator> owner, void* data, std::size_t size_bytes) {
+    Allocator* allocator = owner.get();
+    std::unique_ptr<Storage> storage;
+    try {
+        storage.reset(new Storage(data, size_bytes, allocator));
+    } catch (...) {
+        release_block(data, allocator);
+        throw;
+    }
+    storage->owner_ = std::move(owner);
+    return std::shared_ptr<Storage>(std::move(storage));
+}
+
+Storage::~Storage() noexcept {
+    // The block goes back to its allocator before an owned allocator is destroyed.
+    release_block(data_, allocator_);
+}
+
+} // namespace core
+} // namespace inference_engine
@@ -1,4 +1,5 @@
 #include "inference_engine/core/tensor.h"
+#include "inference_engine/kernels/strided_copy.h"
 #include "inference_engine/memory/allocator.h"
 #include <algorithm>
 #include <cstring>
@@ -15,12 +16,8 @@ Tensor::Tensor(const Shape& shape, DataType dtype, Allocator* allocator)
     compute_strides();
     
     if (allocator && num_elements() > 0) {
-        int64_t size_bytes = byte_size();
-        data_ = allocator->allocate(size_bytes);
-        owns_data_ = (data_ != nullptr);
-    } else {
-        data_ = nullptr;
-        owns_data_ = false;
+        storage_ = Storage::allocate(static_cast<std::size_t>(byte_size()), allocator);
+        data_ = storage_->data();
     }
 }
 
@@ -29,31 +26,30 @@ Tensor::Tensor(Shape&& shape, DataType dtype, Allocator* allocator)
     compute_strides();
     
     if (allocator && num_elements() > 0) {
-        int64_t size_bytes = byte_size();
-        data_ = allocator->allocate(size_bytes);
-        owns_data_ = (data_ != nullptr);
-    } else {
-        data_ = nullptr;
-        owns_data_ = false;
+        storage_ = Storage::allocate(static_cast<std::size_t>(byte_size()), allocator);
+        data_ = storage_->data();
     }
 }
 
-// ==================== Destructor ====================
-
-Tensor::~Tensor() noexcept {
-    if (owns_data_ && data_) {
-        deallocate_internal();
+void Tensor::adopt_data(bool owns) {
+    if (owns && data_) {
+        storage_ = Storage::adopt(data_, static_cast<std::size_t>(byte_size()));
     }
 }
 
 // ==================== Data pointer management ====================
 
-void Tensor::set_data(void* new_data, bool take_ownership) noexcept {
-    if (owns_data_ && data_) {
-        deallocate_internal();
-    }
+void Tensor::set_data(void* new_data, bool take_ownership) {
+    storage_.reset();
     data_ = new_data;
-    owns_data_ = take_ownership;
+    adopt_data(take_ownership);
+}
+
+void Tensor::share_storage(std::shared_ptr<Storage> storage) {
+    if (!storage || !storage->contains(data_)) {
+        throw std::invalid_argument("Tensor::share_storage: data is not inside the storage");
+    }
+    storage_ = std::move(storage);
 }
 
 // ==================== Memory properties ====================
@@ -98,7 +94,7 @@ Tensor Tensor::slice(const std::vector<std::pair<int64_t, int64_t>>& ranges) con
     }
     
     // Validate ranges and calculate new shape
-    std::vector<int64_t> new_dims;
+    DimVector new_dims;
     int64_t offset = 0;
     
     for (std::size_t i = 0; i < rank(); ++i) {
@@ -122,11 +118,10 @@ Tensor Tensor::slice(const std::vector<std::pair<int64_t, int64_t>>& ranges) con
         offset += start * stride(i);
     }
     
-    Shape new_shape(new_dims);
-    
     // Create view tensor with offset data pointer
-    Tensor view(new_shape, dtype_, 
+    Tensor view(Shape(std::move(new_dims)), dtype_, 
                 static_cast<uint8_t*>(data_) + offset, false);
+    view.storage_ = storage_;
     view.strides_ = strides_;  // Keep original strides for sliced view
     view.quant_params_ = quant_params_;
     
@@ -144,6 +139,7 @@ Tensor Tensor::reshape(const Shape& new_shape) const {
     
     // Create a view with new shape
     Tensor view(new_shape, dtype_, data_, false);
+    view.storage_ = storage_;
     view.quant_params_ = quant_params_;
     return view;
 }
@@ -154,46 +150,79 @@ Tensor Tensor::transpose(const std::vector<int>& axes) const {
     }
     
     // Validate axes
-    std::vector<bool> seen(rank(), false);
+    DimVector seen(rank(), 0);
     for (int axis : axes) {
-        if (axis < 0 || axis >= static_cast<int>(rank()) || seen[axis]) {
+        if (axis < 0 || axis >= static_cast<int>(rank()) || seen[axis] != 0) {
             throw std::invalid_argument("Invalid transpose axes");
         }
-        seen[axis] = true;
+        seen[axis] = 1;
     }
     
     // Permute dimensions and strides
-    std::vector<int64_t> new_dims;
-    std::vector<int64_t> new_strides;
+    DimVector new_dims;
+    DimVector new_strides;
     
     for (int axis : axes) {
         new_dims.push_back(dim(axis));
         new_strides.push_back(stride(axis));
     }
     
-    Shape new_shape(new_dims);
-    Tensor transposed(new_shape, dtype_, data_, false);
-    transposed.strides_ = new_strides;
+    Tensor transposed(Shape(std::move(new_dims)), dtype_, data_, false);
+    transposed.storage_ = storage_;
+    transposed.strides_ = std::move(new_strides);
     transposed.quant_params_ = quant_params_;
     
     return transposed;
 }
 
-// ==================== Memory management ====================
+Tensor Tensor::clone() const {
+    if (!is_contiguous()) {
+        throw std::runtime_error("Clone: tensor must be contiguous");
+    }
 
-void Tensor::deallocate() noexcept {
-    if (owns_data_ && data_) {
-        deallocate_internal();
-        data_ = nullptr;
-        owns_data_ = false;
+    Tensor copy(shape_, dtype_);
+    copy.quant_params_ = quant_params_;
+    const int64_t size_bytes = byte_size();
+    if (data_ && size_bytes > 0) {
+        copy.storage_ = Storage::allocate(static_cast<std::size_t>(size_bytes));
+        copy.data_ = copy.storage_->data();
+        std::memcpy(copy.data_, data_, static_cast<std::size_t>(size_bytes));
     }
+    return copy;
 }
 
-void Tensor::deallocate_internal() noexcept {
-    // For now, use delete[] for simple deallocation
-    // In the future, this could use an allocator pool or other strategy
-    if (data_) {
-        delete[] static_cast<uint8_t*>(data_);
+void Tensor::copy_into(Tensor& dst) const {
+    if (dst.shape_ != shape_ || dst.dtype_ != dtype_) {
+        throw std::invalid_argument("copy_into: destination shape or dtype differs");
+    }
+    if (is_empty()) {
+        return;
+    }
+    if (data_ == nullptr || dst.data_ == nullptr) {
+        throw std::runtime_error("copy_into: tensor has no data");
+    }
+    infer::strided_copy(data_, strides_.data(), dst.data_, dst.strides_.data(), shape_.dims().data(), rank(),
+                        element_size());
+}
+
+Tensor Tensor::contiguous() const {
+    if (is_contiguous()) {
+        return *this;
+    }
+    Tensor dense(shape_, dtype_);
+    dense.quant_params_ = quant_params_;
+    dense.storage_ = Storage::allocate(static_cast<std::size_t>(byte_size()));
+    dense.data_ = dense.storage_->data();
+    copy_into(dense);
+    return dense;
+}
+
+// ==================== Memory management ====================
+
+void Tensor::deallocate() noexcept {
+    if (storage_) {
+        storage_.reset();
+        data_ = nullptr;
     }
 }
 
@@ -232,7 +261,7 @@ void Tensor::print_info(std::ostream& os) const {
     
     os << "Contiguous: " << (is_contiguous() ? "yes" : "no") << std::endl;
     os << "Data pointer: " << data_ << std::endl;
-    os << "Owns data: " << (owns_data_ ? "yes" : "no") << std::endl;
+    os << "Owns data: " << (owns_data() ? "yes" : "no") << std::endl;
     
     if (is_quantized()) {
         os << "Quantized: yes" << std::endl;
@@ -299,7 +328,7 @@ std::string Tensor::to_string() const {
     oss << "elements=" << num_elements() << ", ";
     oss << "bytes=" << byte_size() << ", ";
     oss << "contiguous=" << (is_contiguous() ? "true" : "false") << ", ";
-    oss << "owns_data=" << (owns_data_ ? "true" : "false");
+    oss << "owns_data=" << (owns_data() ? "true" : "false");
     
     if (is_quantized()) {
         oss << ", scale=" << quant_params_.scale;
@@ -1,17 +1,96 @@
 
 #include "inference_engine/graph/attributes.h"
 
+#include <algorithm>
+#include <deque>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
 
 namespace infer {
 
-bool AttributeMap::has(const std::string& key) const noexcept {
-	return attrs_.find(key) != attrs_.end();
+namespace {
+
+// Names live in a deque so references handed out by AttrKey::name() stay valid
+// while the table grows; the index maps views into those same strings.
+struct InternTable {
+	std::mutex mutex;
+	std::deque<std::string> names;
+	std::unordered_map<std::string_view, std::uint32_t> ids;
+
+	InternTable() {
+		for (const char* name : attr_names::kPredefined) {
+			intern(name);
+		}
+	}
+
+	std::uint32_t intern(std::string_view name) {
+		const auto it = ids.find(name);
+		if (it != ids.end()) {
+			return it->second;
+		}
+		const auto id = static_cast<std::uint32_t>(names.size());
+		names.emplace_back(name);
+		ids.emplace(names.back(), id);
+		return id;
+	}
+};
+
+InternTable& internTable() {
+	static InternTable table;
+	return table;
+}
+
+} // namespace
+
+AttrKey::AttrKey(std::string_view name) {
+	InternTable& table = internTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+	id_ = table.intern(name);
+}
+
+const std::string& AttrKey::name() const {
+	InternTable& table = internTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+	if (id_ >= table.names.size()) {
+		throw std::out_of_range("AttrKey::name: unknown id " + std::to_string(id_));
+	}
+	return table.names[id_];
+}
+
+const AttributeMap::Attribute* AttributeMap::find(AttrKey key) const noexcept {
+	for (const Entry& e : attrs_) {
+		if (e.first == key) {
+			return &e.second;
+		}
+	}
+	return nullptr;
+}
+
+AttributeMap::Attribute* AttributeMap::find(AttrKey key) noexcept {
+	for (Entry& e : attrs_) {
+		if (e.first == key) {
+			return &e.second;
+		}
+	}
+	return nullptr;
+}
+
+AttributeMap::Attribute& AttributeMap::slot(AttrKey key) {
+	if (Attribute* attr = find(key)) {
+		return *attr;
+	}
+	return attrs_.emplace_back(key, Int{0}).second;
+}
+
+bool AttributeMap::has(AttrKey key) const noexcept {
+	return find(key) != nullptr;
 }
 
-void AttributeMap::erase(const std::string& key) {
-	attrs_.erase(key);
+void AttributeMap::erase(AttrKey key) {
+	attrs_.erase(std::remove_if(attrs_.begin(), attrs_.end(), [key](const Entry& e) { return e.first == key; }),
+				 attrs_.end());
 }
 
 void AttributeMap::clear() noexcept {
@@ -26,52 +105,52 @@ bool AttributeMap::empty() const noexcept {
 	return attrs_.empty();
 }
 
-const std::unordered_map<std::string, AttributeMap::Attribute>& AttributeMap::raw() const noexcept {
+const std::vector<AttributeMap::Entry>& AttributeMap::raw() const noexcept {
 	return attrs_;
 }
 
-void AttributeMap::set(const std::string& key, Int value) {
-	attrs_[key] = value;
+void AttributeMap::set(AttrKey key, Int value) {
+	slot(key) = value;
 }
 
-void AttributeMap::set(const std::string& key, Float value) {
-	attrs_[key] = value;
+void AttributeMap::set(AttrKey key, Float value) {
+	slot(key) = value;
 }
 
-void AttributeMap::set(const std::string& key, const String& value) {
-	attrs_[key] = value;
+void AttributeMap::set(AttrKey key, const String& value) {
+	slot(key) = value;
 }
 
-void AttributeMap::set(const std::string& key, String&& value) {
-	attrs_[key] = std::move(value);
+void AttributeMap::set(AttrKey key, String&& value) {
+	slot(key) = std::move(value);
 }
 
-void AttributeMap::set(const std::string& key, const char* value) {
-	attrs_[key] = String(value == nullptr ? "" : value);
+void AttributeMap::set(AttrKey key, const char* value) {
+	slot(key) = String(value == nullptr ? "" : value);
 }
 
-void AttributeMap::set(const std::string& key, const Ints& value) {
-	attrs_[key] = value;
+void AttributeMap::set(AttrKey key, const Ints& value) {
+	slot(key) = value;
 }
 
-void AttributeMap::set(const std::string& key, Ints&& value) {
-	attrs_[key] = std::move(value);
+void AttributeMap::set(AttrKey key, Ints&& value) {
+	slot(key) = std::move(value);
 }
 
-void AttributeMap::set(const std::string& key, const Floats& value) {
-	attrs_[key] = value;
+void AttributeMap::set(AttrKey key, const Floats& value) {
+	slot(key) = value;
 }
 
-void AttributeMap::set(const std::string& key, Floats&& value) {
-	attrs_[key] = std::move(value);
+void AttributeMap::set(AttrKey key, Floats&& value) {
+	slot(key) = std::move(value);
 }
 
-void AttributeMap::set(const std::string& key, const Strings& value) {
-	attrs_[key] = value;
+void AttributeMap::set(AttrKey key, const Strings& value) {
+	slot(key) = value;
 }
 
-void AttributeMap::set(const std::string& key, Strings&& value) {
-	attrs_[key] = std::move(value);
+void AttributeMap::set(AttrKey key, Strings&& value) {
+	slot(key) = std::move(value);
 }
 
 static std::string escape_string(const std::string& s) {
@@ -141,7 +220,7 @@ std::string AttributeMap::toString() const {
 			oss << ", ";
 		}
 		first = false;
-		oss << '"' << escape_string(kv.first) << "\": " << attributeToString(kv.second);
+		oss << '"' << escape_string(kv.first.name()) << "\": " << attributeToString(kv.second);
 	}
 	oss << "}";
 	return oss.str();
@@ -0,0 +1,401 @@
+#include "inference_engine/graph/calibration.h"
+
+#include "inference_engine/graph/execution_context.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+using inference_engine::core::QuantizationParams;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+
+namespace {
+
+// The tensor viewed as [outer, channels, inner] around `axis`; axis < 0 is one channel.
+struct ChannelLayout {
+    std::size_t outer = 1;
+    std::size_t channels = 1;
+    std::size_t inner = 1;
+};
+
+ChannelLayout channelLayout(const Shape& shape, int axis, std::size_t expected_channels) {
+    ChannelLayout l;
+    const std::size_t rank = shape.rank();
+    for (std::size_t d = 0; d < rank; ++d) {
+        const auto extent = static_cast<std::size_t>(shape.dim(d));
+        if (axis < 0 || d > static_cast<std::size_t>(axis)) {
+            l.inner *= extent;
+        } else if (d < static_cast<std::size_t>(axis)) {
+            l.outer *= extent;
+        } else {
+            l.channels = extent;
+        }
+    }
+    if (l.channels != expected_channels) {
+        throw std::invalid_argument("calibration observer: channel count does not match the tensor");
+    }
+    return l;
+}
+
+// Calls fn(channel, values, count) for every contiguous run of one channel.
+template <typename Fn>
+void forEachChannelRun(const float* data, const ChannelLayout& l, Fn fn) {
+    for (std::size_t o = 0; o < l.outer; ++o) {
+        for (std::size_t c = 0; c < l.channels; ++c) {
+            fn(c, data + (o * l.channels + c) * l.inner, l.inner);
+        }
+    }
+}
+
+} // namespace
+
+MinMaxObserver::MinMaxObserver(std::size_t channels)
+    : min_(channels, std::numeric_limits<float>::infinity()), max_(channels, -std::numeric_limits<float>::infinity()) {}
+
+void MinMaxObserver::observe(const float* data, const Shape& shape, int axis) {
+    const ChannelLayout l = channelLayout(shape, axis, channels());
+    forEachChannelRun(data, l, [&](std::size_t c, const float* x, std::size_t n) {
+        float lo = min_[c];
+        float hi = max_[c];
+        for (std::size_t i = 0; i < n; ++i) {
+            if (std::isnan(x[i])) continue;
+            lo = std::min(lo, x[i]);
+            hi = std::max(hi, x[i]);
+        }
+        min_[c] = lo;
+        max_[c] = hi;
+    });
+    count_ += 1;
+}
+
+void MinMaxObserver::merge(const MinMaxObserver& other) {
+    if (other.channels() != channels()) {
+        throw std::invalid_argument("MinMaxObserver::merge: channel count mismatch");
+    }
+    for (std::size_t c = 0; c < channels(); ++c) {
+        min_[c] = std::min(min_[c], other.min_[c]);
+        max_[c] = std::max(max_[c], other.max_[c]);
+    }
+    count_ += other.count_;
+}
+
+HistogramObserver::HistogramObserver(std::vector<float> limits, std::size_t bins)
+    : limits_(std::move(limits)), bins_(bins) {
+    if (bins_ < 2 || bins_ % 2 != 0) {
+        throw std::invalid_argument("HistogramObserver: bins must be even and at least 2");
+    }
+    for (float& limit : limits_) {
+        if (!(limit > 0.0f) || !std::isfinite(limit)) limit = 1.0f;
+    }
+    counts_.assign(limits_.size() * bins_, 0);
+}
+
+void HistogramObserver::observe(const float* data, const Shape& shape, int axis) {
+    const ChannelLayout l = channelLayout(shape, axis, channels());
+    const auto last = static_cast<float>(bins_ - 1);
+    forEachChannelRun(data, l, [&](std::size_t c, const float* x, std::size_t n) {
+        const float limit = limits_[c];
+        const float scale = static_cast<float>(bins_) / (2.0f * limit);
+        std::uint64_t* counts = counts_.data() + c * bins_;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (std::isnan(x[i])) continue;
+            const float pos = std::min(last, std::max(0.0f, std::floor((x[i] + limit) * scale)));
+            counts[static_cast<std::size_t>(pos)] += 1;
+        }
+    });
+}
+
+void HistogramObserver::merge(const HistogramObserver& other) {
+    if (other.bins_ != bins_ || other.limits_ != limits_) {
+        throw std::invalid_argument("HistogramObserver::merge: histograms cover different ranges");
+    }
+    for (std::size_t i = 0; i < counts_.size(); ++i) counts_[i] += other.counts_[i];
+}
+
+float HistogramObserver::entropyThreshold(std::size_t channel, std::size_t levels) const {
+    // |x| histogram: bin j covers [j, j + 1) * width on either side of zero.
+    const std::size_t half = bins_ / 2;
+    const std::uint64_t* counts = this->counts(channel);
+    std::vector<double> hist(half);
+    for (std::size_t j = 0; j < half; ++j) {
+        hist[j] = static_cast<double>(counts[half + j] + counts[half - 1 - j]);
+    }
+    const float width = limits_[channel] / static_cast<float>(half);
+    if (levels == 0 || levels >= half) return limits_[channel];
+
+    std::vector<double> suffix(half + 1, 0.0);
+    for (std::size_t j = half; j-- > 0;) suffix[j] = suffix[j + 1] + hist[j];
+    if (suffix[0] == 0.0) return limits_[channel];
+
+    std::vector<double> q(half);
+    std::size_t best = half;
+    double best_kl = std::numeric_limits<double>::infinity();
+    for (std::size_t i = levels; i <= half; ++i) {
+        // Q: the first i bins merged into `levels` groups, each group's mass spread
+        // evenly over the bins P holds mass in.
+        const double outliers = suffix[i];
+        for (std::size_t g = 0; g < levels; ++g) {
+            const std::size_t begin = g * i / levels;
+            const std::size_t end = (g + 1) * i / levels;
+            double mass = 0.0;
+            std::size_t nonzero = 0;
+            for (std::size_t j = begin; j < end; ++j) {
+                const double p = hist[j] + (j == i - 1 ? outliers : 0.0);
+                mass += hist[j];
+                nonzero += p > 0.0 ? 1 : 0;
+            }
+            for (std::size_t j = begin; j < end; ++j) {
+                const double p = hist[j] + (j == i - 1 ? outliers : 0.0);
+                q[j] = p > 0.0 ? mass / static_cast<double>(nonzero) : 0.0;
+            }
+        }
+        // P sums to suffix[0], Q to suffix[0] - outliers.
+        const double p_total = suffix[0];
+        const double q_total = suffix[0] - outliers;
+        if (q_total <= 0.0) continue;
+        double kl = 0.0;
+        for (std::size_t j = 0; j < i; ++j) {
+            const double p = (hist[j] + (j == i - 1 ? outliers : 0.0)) / p_total;
+            if (p <= 0.0) continue;
+            const double qj = std::max(q[j] / q_total, 1e-12);
+            kl += p * std::log(p / qj);
+        }
+        if (kl < best_kl) {
+            best_kl = kl;
+            best = i;
+        }
+    }
+    return static_cast<float>(best) * width;
+}
+
+std::pair<float, float> HistogramObserver::percentileRange(std::size_t channel, double percentile) const {
+    const std::uint64_t* counts = this->counts(channel);
+    const float limit = limits_[channel];
+    const float width = 2.0f * limit / static_cast<float>(bins_);
+    std::uint64_t total = 0;
+    for (std::size_t j = 0; j < bins_; ++j) total += counts[j];
+    if (total == 0) return {0.0f, 0.0f};
+    const double tail = static_cast<double>(total) * std::max(0.0, 100.0 - percentile) / 100.0;
+
+    std::size_t lo = 0;
+    double seen = 0.0;
+    for (; lo + 1 < bins_; ++lo) {
+        seen += static_cast<double>(counts[lo]);
+        if (seen > tail) break;
+    }
+    std::size_t hi = bins_ - 1;
+    seen = 0.0;
+    for (; hi > 0; --hi) {
+        seen += static_cast<double>(counts[hi]);
+        if (seen > tail) break;
+    }
+    return {-limit + static_cast<float>(lo) * width, -limit + static_cast<float>(hi + 1) * width};
+}
+
+namespace {
+
+struct Target {
+    Value* value = nullptr;
+    int axis = -1; // channel axis used for this Value
+    std::size_t channels = 1;
+};
+
+std::vector<Target> collectTargets(const ExecutionPlan& plan, const CalibrationOptions& options) {
+    std::vector<Target> targets;
+    std::vector<bool> seen(plan.values().size(), false);
+    auto add = [&](Value* v) {
+        if (v == nullptr || v->dtype() != DataType::FP32 || seen[v->planSlot()]) return;
+        seen[v->planSlot()] = true;
+        Target t;
+        t.value = v;
+        const Shape& s = v->shape();
+        if (options.per_channel && options.axis >= 0 && static_cast<std::size_t>(options.axis) < s.rank()) {
+            t.axis = options.axis;
+            t.channels = static_cast<std::size_t>(s.dim(static_cast<std::size_t>(options.axis)));
+        }
+        targets.push_back(t);
+    };
+    for (Value* v : plan.inputs()) add(v);
+    for (const ExecutionPlan::Step& step : plan.steps()) {
+        for (Value* v : step.node->outputs()) add(v);
+    }
+    return targets;
+}
+
+// Runs every sample through the plan on the thread pool. Samples are split into
+// contiguous chunks, each observed into its own observer set by one task; the sets
+// are merged in chunk order.
+template <typename Observer, typename Make>
+std::vector<Observer> observePass(const ExecutionPlan& plan, const std::vector<std::vector<Tensor>>& samples,
+                                  const std::vector<Target>& targets, Make make) {
+    std::vector<int> target_of(plan.values().size(), -1);
+    for (std::size_t i = 0; i < targets.size(); ++i) target_of[targets[i].value->planSlot()] = static_cast<int>(i);
+
+    ThreadPool* pool = ThreadPool::current();
+    const std::size_t workers = pool != nullptr ? pool->size() + 1 : 1;
+    const std::size_t chunks = std::min(samples.size(), workers);
+    std::vector<std::vector<Observer>> partial(chunks);
+
+    parallelFor(0, chunks, 1, [&](std::size_t chunk_begin, std::size_t chunk_end) {
+        for (std::size_t chunk = chunk_begin; chunk < chunk_end; ++chunk) {
+            std::vector<Observer> observers;
+            observers.reserve(targets.size());
+            for (std::size_t i = 0; i < targets.size(); ++i) observers.push_back(make(i));
+            const std::unique_ptr<ExecutionContext> ctx = plan.createContext();
+            auto record = [&](const Value* v) {
+                const int t = target_of[v->planSlot()];
+                const Tensor* tensor = v->tensor();
+                // Strided views are left to the Values they alias.
+                if (t < 0 || tensor == nullptr || tensor->data() == nullptr || !tensor->is_contiguous()) return;
+                observers[static_cast<std::size_t>(t)].observe(tensor->data_as<float>(), v->shape(),
+                                                               targets[static_cast<std::size_t>(t)].axis);
+            };
+
+            const std::size_t first = chunk * samples.size() / chunks;
+            const std::size_t last = (chunk + 1) * samples.size() / chunks;
+            for (std::size_t s = first; s < last; ++s) {
+                plan.bindInputs(*ctx, samples[s]);
+                ExecutionContext::Scope scope(ctx.get());
+                for (const Value* v : plan.inputs()) record(v);
+                for (const ExecutionPlan::Step& step : plan.steps()) {
+                    step.op->execute();
+                    for (const Value* v : step.node->outputs()) record(v);
+                }
+            }
+            partial[chunk] = std::move(observers);
+        }
+    });
+
+    std::vector<Observer> merged = std::move(partial[0]);
+    for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+        for (std::size_t i = 0; i < merged.size(); ++i) merged[i].merge(partial[chunk][i]);
+    }
+    return merged;
+}
+
+void checkOptions(const CalibrationOptions& options) {
+    if (options.dtype != DataType::INT8 && options.dtype != DataType::UINT8) {
+        throw std::invalid_argument("calibrate: target dtype must be INT8 or UINT8");
+    }
+    if (!options.symmetric && options.dtype != DataType::UINT8) {
+        throw std::invalid_argument("calibrate: asymmetric quantization needs UINT8");
+    }
+    if (options.method != CalibrationMethod::MinMax && (options.bins < 2 || options.bins % 2 != 0)) {
+        throw std::invalid_argument("calibrate: bins must be even and at least 2");
+    }
+    if (options.method == CalibrationMethod::Percentile &&
+        !(options.percentile > 50.0 && options.percentile <= 100.0)) {
+        throw std::invalid_argument("calibrate: percentile must lie in (50, 100]");
+    }
+}
+
+QuantizationParams deriveParams(const CalibrationReport::Entry& e, int axis, const CalibrationOptions& options) {
+    std::vector<float> lo(e.min.size());
+    std::vector<float> hi(e.max.size());
+    for (std::size_t c = 0; c < lo.size(); ++c) {
+        // The quantized range always represents zero exactly.
+        lo[c] = std::min(e.min[c], 0.0f);
+        hi[c] = std::max(e.max[c], 0.0f);
+        if (!(hi[c] > lo[c])) hi[c] = lo[c] + 1.0f;
+    }
+    if (axis >= 0) {
+        return inference_engine::core::calculate_per_channel_quant_params(lo, hi, axis, options.symmetric,
+                                                                          options.dtype);
+    }
+    return options.symmetric ? inference_engine::core::calculate_symmetric_quant_params(lo[0], hi[0], options.dtype)
+                             : inference_engine::core::calculate_asymmetric_quant_params(lo[0], hi[0], options.dtype);
+}
+
+} // namespace
+
+CalibrationReport calibrate(Graph& graph, const std::vector<std::vector<Tensor>>& samples,
+                            const CalibrationOptions& options) {
+    checkOptions(options);
+    if (samples.empty()) {
+        throw std::invalid_argument("calibrate: the dataset is empty");
+    }
+
+    std::unique_ptr<ThreadPool> own_pool;
+    if (options.threads > 0) own_pool = std::make_unique<ThreadPool>(options.threads);
+    ThreadPool::Scope pool_scope(own_pool != nullptr ? own_pool.get() : ThreadPool::current());
+
+    CompileOptions compile;
+    compile.bind_memory = false;
+    const std::unique_ptr<ExecutionPlan> plan = graph.compile(compile);
+    const std::vector<Target> targets = collectTargets(*plan, options);
+
+    const std::vector<MinMaxObserver> ranges = observePass<MinMaxObserver>(
+        *plan, samples, targets, [&](std::size_t i) { return MinMaxObserver(targets[i].channels); });
+
+    CalibrationReport report;
+    report.samples = samples.size();
+    for (std::size_t i = 0; i < targets.size(); ++i) {
+        if (ranges[i].empty()) continue;
+        CalibrationReport::Entry e;
+        e.value = targets[i].value;
+        e.observed_min = ranges[i].min();
+        e.observed_max = ranges[i].max();
+        e.min = e.observed_min;
+        e.max = e.observed_max;
+        report.values.push_back(std::move(e));
+    }
+
+    if (options.method != CalibrationMethod::MinMax) {
+        std::vector<std::vector<float>> limits(targets.size());
+        for (std::size_t i = 0; i < targets.size(); ++i) {
+            limits[i].resize(targets[i].channels, 0.0f);
+            if (ranges[i].empty()) continue;
+            for (std::size_t c = 0; c < targets[i].channels; ++c) {
+                limits[i][c] = std::max(std::abs(ranges[i].min()[c]), std::abs(ranges[i].max()[c]));
+            }
+        }
+        const std::vector<HistogramObserver> histograms = observePass<HistogramObserver>(
+            *plan, samples, targets, [&](std::size_t i) { return HistogramObserver(limits[i], options.bins); });
+
+        std::size_t entry = 0;
+        for (std::size_t i = 0; i < targets.size(); ++i) {
+            if (ranges[i].empty()) continue;
+            CalibrationReport::Entry& e = report.values[entry++];
+            for (std::size_t c = 0; c < targets[i].channels; ++c) {
+                if (options.method == CalibrationMethod::Entropy) {
+                    const float t = histograms[i].entropyThreshold(c, options.kl_levels);
+                    e.min[c] = std::max(e.min[c], -t);
+                    e.max[c] = std::min(e.max[c], t);
+                } else {
+                    const auto [lo, hi] = histograms[i].percentileRange(c, options.percentile);
+                    e.min[c] = std::max(e.min[c], lo);
+                    e.max[c] = std::min(e.max[c], hi);
+                }
+            }
+        }
+    }
+
+    std::size_t entry = 0;
+    for (std::size_t i = 0; i < targets.size(); ++i) {
+        if (ranges[i].empty()) continue;
+        const CalibrationReport::Entry& e = report.values[entry++];
+        e.value->setQuantization(deriveParams(e, targets[i].axis, options));
+    }
+    return report;
+}
+
+CalibrationMethod parseCalibrationMethod(const std::string& name) {
+    if (name == "minmax") return CalibrationMethod::MinMax;
+    if (name == "entropy" || name == "kl") return CalibrationMethod::Entropy;
+    if (name == "percentile") return CalibrationMethod::Percentile;
+    throw std::invalid_argument("unknown calibration method '" + name + "'");
+}
+
+} // namespace infer
@@ -0,0 +1,73 @@
+#include "inference_engine/graph/execution_context.h"
+
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/memory/allocator.h"
+
+#include <algorithm>
+#include <new>
+
+namespace infer {
+
+using inference_engine::core::Tensor;
+
+namespace {
+thread_local ExecutionContext* t_current_context = nullptr;
+} // namespace
+
+ExecutionContext::ExecutionContext(const ExecutionPlan& plan)
+    : ExecutionContext(plan, plan.memoryPlan().arena_pages) {}
+
+ExecutionContext::ExecutionContext(const ExecutionPlan& plan, const inference_engine::memory::PageOptions& pages)
+    : plan_(plan), values_(plan.values()) {
+    const MemoryPlan& memory = plan.memoryPlan();
+    std::uint8_t* base = nullptr;
+    if (memory.arena_bytes != 0) {
+        inference_engine::core::AllocatorConfig config;
+        config.pages = pages;
+        arena_ = std::make_unique<inference_engine::core::ArenaAllocator>(memory.arena_bytes, memory.alignment,
+                                                                          config);
+        base = static_cast<std::uint8_t*>(arena_->allocate_aligned(memory.arena_bytes, memory.alignment));
+        if (base == nullptr) {
+            throw std::bad_alloc();
+        }
+        arena_bytes_ = memory.arena_bytes;
+    }
+
+    // Reserve up-front so the addresses in bound_ stay stable.
+    const std::size_t n = values_.size();
+    tracked_.assign(n, false);
+    bound_.assign(n, nullptr);
+    scratch_.resize(n);
+    tensors_.reserve(n);
+    const auto& inputs = plan.inputs();
+    for (std::size_t i = 0; i < n; ++i) {
+        Value* v = values_[i];
+        void* data = nullptr;
+        const auto it = memory.lifetimes.find(v->id());
+        if (base != nullptr && it != memory.lifetimes.end() && it->second.planned) {
+            data = base + it->second.offset;
+        }
+        tensors_.emplace_back(v->shape(), v->dtype(), data, false);
+        if (v->producer() != nullptr || std::find(inputs.begin(), inputs.end(), v) != inputs.end()) {
+            tracked_[i] = true;
+            bound_[i] = &tensors_.back();
+        }
+    }
+}
+
+ExecutionContext::~ExecutionContext() = default;
+
+ExecutionContext* ExecutionContext::current() noexcept {
+    return t_current_context;
+}
+
+ExecutionContext::Scope::Scope(ExecutionContext* ctx) noexcept : previous_(t_current_context) {
+    t_current_context = ctx;
+}
+
+ExecutionContext::Scope::~Scope() {
+    t_current_context = previous_;
+}
+
+} // namespace infer
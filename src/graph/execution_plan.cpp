@@ -0,0 +1,136 @@
+#include "inference_engine/graph/execution_plan.h"
+
+#include "inference_engine/graph/execution_context.h"
+#include "inference_engine/graph/metrics.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/profiler.h"
+#include "inference_engine/graph/value.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace infer {
+
+using inference_engine::core::Tensor;
+
+ExecutionPlan::ExecutionPlan(std::vector<Step> steps, MemoryPlan memory, std::vector<Value*> inputs,
+                             std::vector<Value*> outputs, std::vector<Value*> values)
+    : steps_(std::move(steps)),
+      memory_(std::move(memory)),
+      inputs_(std::move(inputs)),
+      outputs_(std::move(outputs)),
+      values_(std::move(values)) {
+    input_slots_.reserve(inputs_.size());
+    for (Value* v : inputs_) {
+        input_slots_.emplace_back(v->shape(), v->dtype());
+        v->setTensor(&input_slots_.back());
+    }
+}
+
+ExecutionPlan::~ExecutionPlan() {
+    for (std::size_t i = 0; i < inputs_.size(); ++i) {
+        if (inputs_[i]->tensor() == &input_slots_[i]) {
+            inputs_[i]->clearTensor();
+        }
+    }
+}
+
+void ExecutionPlan::run(const std::vector<Tensor>& inputs, std::vector<Tensor>& outputs) {
+    bindInputs(inputs);
+    runSteps();
+    collectOutputs(outputs);
+}
+
+void ExecutionPlan::checkInputs(const std::vector<Tensor>& inputs) const {
+    if (inputs.size() != inputs_.size()) {
+        throw std::invalid_argument("ExecutionPlan::run: expected " + std::to_string(inputs_.size()) +
+                                    " inputs, got " + std::to_string(inputs.size()));
+    }
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        const Tensor& in = inputs[i];
+        if (in.dtype() != inputs_[i]->dtype() || in.shape() != inputs_[i]->shape()) {
+            throw std::invalid_argument("ExecutionPlan::run: input " + std::to_string(i) +
+                                        " does not match the compiled shape/dtype");
+        }
+        if (!in.is_contiguous()) {
+            throw std::invalid_argument("ExecutionPlan::run: input " + std::to_string(i) + " must be contiguous");
+        }
+    }
+}
+
+void ExecutionPlan::bindInputs(const std::vector<Tensor>& inputs) {
+    checkInputs(inputs);
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        Tensor& slot = input_slots_[i];
+        slot.set_data(const_cast<void*>(inputs[i].data()), false);
+        // Re-assert the binding in case an operator or caller replaced it.
+        inputs_[i]->setTensor(&slot);
+    }
+}
+
+void ExecutionPlan::collectOutputs(std::vector<Tensor>& outputs) const {
+    outputs.resize(outputs_.size());
+    for (std::size_t i = 0; i < outputs_.size(); ++i) {
+        const Tensor* t = outputs_[i]->tensor();
+        if (t != nullptr) {
+            outputs[i] = *t;
+        } else {
+            outputs[i] = Tensor{};
+        }
+    }
+}
+
+std::unique_ptr<ExecutionContext> ExecutionPlan::createContext() const {
+    return std::make_unique<ExecutionContext>(*this);
+}
+
+std::unique_ptr<ExecutionContext> ExecutionPlan::createContext(const inference_engine::memory::PageOptions& pages) const {
+    return std::make_unique<ExecutionContext>(*this, pages);
+}
+
+void ExecutionPlan::run(ExecutionContext& ctx, const std::vector<Tensor>& inputs, std::vector<Tensor>& outputs) const {
+    bindInputs(ctx, inputs);
+    {
+        ExecutionContext::Scope scope(&ctx);
+        runSteps();
+    }
+    collectOutputs(ctx, outputs);
+}
+
+void ExecutionPlan::runSteps() const {
+    Profiler* profiler = Profiler::current();
+    MetricsRegistry* metrics = MetricsRegistry::current();
+    if (profiler == nullptr && metrics == nullptr) {
+        for (const Step& step : steps_) {
+            step.op->execute();
+        }
+        return;
+    }
+    for (const Step& step : steps_) {
+        executeStep(step, profiler, metrics);
+    }
+}
+
+void ExecutionPlan::bindInputs(ExecutionContext& ctx, const std::vector<Tensor>& inputs) const {
+    if (&ctx.plan() != this) {
+        throw std::invalid_argument("ExecutionPlan::run: context belongs to a different plan");
+    }
+    checkInputs(inputs);
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        Tensor& slot = ctx.tensors_[inputs_[i]->planSlot()];
+        slot.set_data(const_cast<void*>(inputs[i].data()), false);
+        ctx.bind(inputs_[i], &slot);
+    }
+}
+
+void ExecutionPlan::collectOutputs(const ExecutionContext& ctx, std::vector<Tensor>& outputs) const {
+    outputs.resize(outputs_.size());
+    for (std::size_t i = 0; i < outputs_.size(); ++i) {
+        const Value* v = outputs_[i];
+        const Tensor* t = ctx.tracks(v) ? ctx.binding(v) : v->tensor();
+        outputs[i] = t != nullptr ? *t : Tensor{};
+    }
+}
+
+} // namespace infer
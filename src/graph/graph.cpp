@@ -1,18 +1,107 @@
 
 #include "inference_engine/graph/graph.h"
 
+#include "inference_engine/graph/execution_plan.h"
 #include "inference_engine/graph/node.h"
 #include "inference_engine/graph/operator.h"
+#include "inference_engine/memory/allocator.h"
 
 #include <algorithm>
-#include <queue>
+#include <cstdint>
+#include <cstring>
+#include <new>
 #include <stdexcept>
-#include <unordered_map>
 
 namespace infer {
 
+namespace {
+
+std::shared_ptr<inference_engine::core::Storage> allocateArena(std::size_t bytes, std::size_t alignment,
+                                                               const inference_engine::memory::PageOptions& pages) {
+    inference_engine::core::AllocatorConfig config;
+    config.pages = pages;
+    auto arena = std::make_unique<inference_engine::core::ArenaAllocator>(bytes, alignment, config);
+    void* base = arena->allocate_aligned(bytes, alignment);
+    if (base == nullptr) {
+        throw std::bad_alloc();
+    }
+    return inference_engine::core::Storage::adopt(std::move(arena), base, bytes);
+}
+
+struct PlanItem {
+    ValueLifetime* life = nullptr;
+    const Value* value = nullptr;
+    // Every Value sharing the slot (owner first), or nullptr for a lone value.
+    const std::vector<const Value*>* members = nullptr;
+};
+
+// Greedy-by-size offset assignment. Values are placed largest first; each one goes
+// into the smallest gap (best fit) between already placed values it conflicts with,
+// or above all of them if no gap is large enough.
+template <typename Conflicts>
+std::size_t assignOffsets(std::vector<PlanItem>& planned, std::size_t alignment, Conflicts conflicts) {
+    std::sort(planned.begin(), planned.end(), [](const PlanItem& a, const PlanItem& b) {
+        if (a.life->bytes != b.life->bytes) return a.life->bytes > b.life->bytes;
+        return a.life->first_index < b.life->first_index;
+    });
+
+    std::vector<const PlanItem*> placed;
+    placed.reserve(planned.size());
+    std::vector<const ValueLifetime*> overlapping;
+    overlapping.reserve(planned.size());
+
+    std::size_t arena_bytes = 0;
+    for (PlanItem& item : planned) {
+        ValueLifetime* lf = item.life;
+        const std::size_t size = inference_engine::core::inf_engine_align_size(lf->bytes, alignment);
+
+        overlapping.clear();
+        for (const PlanItem* other : placed) {
+            if (conflicts(item, *other)) {
+                overlapping.push_back(other->life);
+            }
+        }
+        std::sort(overlapping.begin(), overlapping.end(),
+                  [](const ValueLifetime* a, const ValueLifetime* b) { return a->offset < b->offset; });
+
+        std::size_t best_offset = 0;
+        std::size_t best_gap = static_cast<std::size_t>(-1);
+        std::size_t cursor = 0;
+        bool found = false;
+        for (const ValueLifetime* other : overlapping) {
+            if (other->offset >= cursor) {
+                const std::size_t gap = other->offset - cursor;
+                if (gap >= size && gap < best_gap) {
+                    best_gap = gap;
+                    best_offset = cursor;
+                    found = true;
+                }
+            }
+            const std::size_t other_end =
+                other->offset + inference_engine::core::inf_engine_align_size(other->bytes, alignment);
+            cursor = std::max(cursor, other_end);
+        }
+        if (!found) {
+            best_offset = cursor;
+        }
+
+        lf->offset = best_offset;
+        lf->planned = true;
+        placed.push_back(&item);
+        arena_bytes = std::max(arena_bytes, best_offset + size);
+    }
+    return arena_bytes;
+}
+
+} // namespace
+
 Graph::Graph() = default;
-Graph::~Graph() = default;
+
+Graph::~Graph() {
+    // Nodes detach from their Values on destruction, so they must go first.
+    compiled_.reset();
+    nodes_.clear();
+}
 
 void Graph::setModelName(std::string n) {
     model_name_ = std::move(n);
@@ -25,7 +114,9 @@ void Graph::setModelVersion(std::string v) {
 Value* Graph::createValue(const inference_engine::core::Shape& shape,
                           inference_engine::core::DataType dtype,
                           std::string name) {
+    invalidate();
     values_.push_back(std::make_unique<Value>(shape, dtype, std::move(name)));
+    values_.back()->setPlanSlot(static_cast<std::uint32_t>(values_.size() - 1));
     return values_.back().get();
 }
 
@@ -33,122 +124,204 @@ Value* Graph::createValue(const inference_engine::core::Shape& shape,
                           inference_engine::core::DataType dtype,
                           const inference_engine::core::QuantizationParams& qparams,
                           std::string name) {
+    invalidate();
     values_.push_back(std::make_unique<Value>(shape, dtype, qparams, std::move(name)));
+    values_.back()->setPlanSlot(static_cast<std::uint32_t>(values_.size() - 1));
     return values_.back().get();
 }
 
 Node* Graph::addNode(std::unique_ptr<Operator> op, std::string name) {
+    invalidate();
     nodes_.push_back(std::make_unique<Node>(this, std::move(name), std::move(op)));
+    nodes_.back()->setGraphIndex(static_cast<std::uint32_t>(nodes_.size() - 1));
     return nodes_.back().get();
 }
 
 bool Graph::removeNode(Node* node) {
-    if (node == nullptr) {
-        return false;
-    }
-    auto it = std::find_if(nodes_.begin(), nodes_.end(),
-                           [node](const std::unique_ptr<Node>& n) { return n.get() == node; });
-    if (it == nodes_.end()) {
+    if (!ownsNodePtr(node)) {
         return false;
     }
+    invalidate();
 
     // Detach node from values explicitly before erasing.
     // (Node destructor also detaches; doing it here makes intent explicit.)
     // No direct API needed: setting empty inputs/outputs triggers detaches.
-    (*it)->setInputs({});
-    (*it)->setOutputs({});
+    node->setInputs({});
+    node->setOutputs({});
 
-    nodes_.erase(it);
+    const std::size_t index = node->graphIndex();
+    nodes_.erase(nodes_.begin() + static_cast<std::ptrdiff_t>(index));
+    for (std::size_t i = index; i < nodes_.size(); ++i) {
+        nodes_[i]->setGraphIndex(static_cast<std::uint32_t>(i));
+    }
     return true;
 }
 
+bool Graph::removeValue(Value* value) {
+    if (!ownsValuePtr(value) || value->producer() != nullptr || !value->consumers().empty() ||
+        std::find(inputs_.begin(), inputs_.end(), value) != inputs_.end() ||
+        std::find(outputs_.begin(), outputs_.end(), value) != outputs_.end()) {
+        return false;
+    }
+    // Bound tensors are tracked by Value; drop them rather than keep a dangling entry.
+    if (std::find(bound_values_.begin(), bound_values_.end(), value) != bound_values_.end()) {
+        releaseMemory();
+    }
+    invalidate();
+    initializers_.erase(value);
+    const std::size_t index = value->planSlot();
+    values_.erase(values_.begin() + static_cast<std::ptrdiff_t>(index));
+    for (std::size_t i = index; i < values_.size(); ++i) {
+        values_[i]->setPlanSlot(static_cast<std::uint32_t>(i));
+    }
+    return true;
+}
+
+void Graph::setInitializer(Value* value, const inference_engine::core::Tensor& data) {
+    if (!ownsValuePtr(value)) {
+        throw std::invalid_argument("Graph::setInitializer: Value not owned by graph");
+    }
+    if (value->producer() != nullptr ||
+        std::find(inputs_.begin(), inputs_.end(), value) != inputs_.end()) {
+        throw std::invalid_argument("Graph::setInitializer: '" + value->name() +
+                                    "' is produced by a node or fed as a graph input");
+    }
+    if (data.shape() != value->shape() || data.dtype() != value->dtype()) {
+        throw std::invalid_argument("Graph::setInitializer: data does not match shape/dtype of '" +
+                                    value->name() + "'");
+    }
+    if (data.data() == nullptr || !data.is_contiguous()) {
+        throw std::invalid_argument("Graph::setInitializer: data must be non-null and contiguous");
+    }
+    // A planned binding for this Value would be cleared again by releaseMemory().
+    if (std::find(bound_values_.begin(), bound_values_.end(), value) != bound_values_.end()) {
+        releaseMemory();
+    }
+    invalidate();
+
+    const auto bytes = static_cast<std::size_t>(data.byte_size());
+    Initializer& init = initializers_[value];
+    init.storage.assign((bytes + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t), 0);
+    std::memcpy(init.storage.data(), data.data(), bytes);
+    init.tensor = inference_engine::core::Tensor(value->shape(), value->dtype(),
+                                                 static_cast<void*>(init.storage.data()), false);
+    init.tensor.set_quant_params(data.quant_params());
+    value->setTensor(&init.tensor);
+}
+
+bool Graph::isInitializer(const Value* value) const noexcept {
+    return initializers_.count(value) != 0;
+}
+
+const inference_engine::core::Tensor* Graph::initializer(const Value* value) const noexcept {
+    const auto it = initializers_.find(value);
+    return it == initializers_.end() ? nullptr : &it->second.tensor;
+}
+
 void Graph::setInputs(std::vector<Value*> inputs) {
+    invalidate();
     inputs_ = std::move(inputs);
 }
 
 void Graph::setOutputs(std::vector<Value*> outputs) {
+    invalidate();
     outputs_ = std::move(outputs);
 }
 
 void Graph::addInput(Value* v) {
+    invalidate();
     inputs_.push_back(v);
 }
 
 void Graph::addOutput(Value* v) {
+    invalidate();
     outputs_.push_back(v);
 }
 
+void Graph::invalidate() noexcept {
+    ++revision_;
+    compiled_.reset();
+    topology_.built = false;
+}
+
 bool Graph::ownsValuePtr(const Value* v) const noexcept {
-    if (v == nullptr) {
-        return false;
-    }
-    return std::any_of(values_.begin(), values_.end(), [v](const std::unique_ptr<Value>& p) { return p.get() == v; });
+    return v != nullptr && v->planSlot() < values_.size() && values_[v->planSlot()].get() == v;
 }
 
-std::vector<Node*> Graph::topologicalSort() {
-    // Build in-degree based on Value producer relationships.
-    std::unordered_map<Node*, std::size_t> indegree;
-    indegree.reserve(nodes_.size());
-    for (const auto& n : nodes_) {
-        indegree[n.get()] = 0;
-    }
+bool Graph::ownsNodePtr(const Node* n) const noexcept {
+    return n != nullptr && n->graphIndex() < nodes_.size() && nodes_[n->graphIndex()].get() == n;
+}
 
-    for (const auto& n : nodes_) {
-        Node* node = n.get();
-        for (Value* in : node->inputs()) {
-            if (in == nullptr) continue;
-            Node* p = in->producer();
-            if (p != nullptr) {
-                auto it = indegree.find(node);
-                if (it != indegree.end()) {
-                    it->second += 1;
-                }
-            }
+const Graph::Topology& Graph::topology() {
+    if (topology_.built) {
+        return topology_;
+    }
+    Topology& t = topology_;
+    const std::size_t n = nodes_.size();
+
+    // fn(p) once per distinct producer p of node j's inputs; `seen` stamps dedupe.
+    std::vector<std::uint32_t> seen(n, Node::kNoIndex);
+    auto forEachPredecessor = [&](std::uint32_t j, auto&& fn) {
+        for (const Value* in : nodes_[j]->inputs()) {
+            const Node* p = in != nullptr ? in->producer() : nullptr;
+            if (!ownsNodePtr(p) || seen[p->graphIndex()] == j) continue;
+            seen[p->graphIndex()] = j;
+            fn(p->graphIndex());
         }
+    };
+
+    // Count, prefix-sum, then fill the successor lists.
+    std::vector<std::uint32_t> indegree(n, 0);
+    t.succ_begin.assign(n + 1, 0);
+    for (std::uint32_t j = 0; j < n; ++j) {
+        forEachPredecessor(j, [&](std::uint32_t p) {
+            ++t.succ_begin[p + 1];
+            ++indegree[j];
+        });
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        t.succ_begin[i + 1] += t.succ_begin[i];
+    }
+    t.succ.assign(t.succ_begin[n], 0);
+    std::vector<std::uint32_t> fill(t.succ_begin.begin(), t.succ_begin.end() - 1);
+    std::fill(seen.begin(), seen.end(), Node::kNoIndex);
+    for (std::uint32_t j = 0; j < n; ++j) {
+        forEachPredecessor(j, [&](std::uint32_t p) { t.succ[fill[p]++] = j; });
     }
 
-    std::queue<Node*> q;
-    for (auto& kv : indegree) {
-        if (kv.second == 0) {
-            q.push(kv.first);
+    // Kahn's algorithm; the ready list doubles as the FIFO queue.
+    std::vector<std::uint32_t> ready;
+    ready.reserve(n);
+    for (std::uint32_t j = 0; j < n; ++j) {
+        if (indegree[j] == 0) ready.push_back(j);
+    }
+    for (std::size_t head = 0; head < ready.size(); ++head) {
+        const std::uint32_t i = ready[head];
+        for (std::uint32_t k = t.succ_begin[i]; k < t.succ_begin[i + 1]; ++k) {
+            if (--indegree[t.succ[k]] == 0) ready.push_back(t.succ[k]);
         }
     }
 
-    std::vector<Node*> order;
-    order.reserve(nodes_.size());
-
-    while (!q.empty()) {
-        Node* n = q.front();
-        q.pop();
-        order.push_back(n);
-
-        // For each outgoing edge n -> consumer_of_each_output
-        for (Value* out : n->outputs()) {
-            if (out == nullptr) continue;
-            for (Node* consumer : out->consumers()) {
-                auto it = indegree.find(consumer);
-                if (it == indegree.end()) continue;
-                if (it->second == 0) continue;
-                it->second -= 1;
-                if (it->second == 0) {
-                    q.push(consumer);
-                }
-            }
-        }
+    t.order.clear();
+    t.order.reserve(ready.size());
+    t.position.assign(n, Node::kNoIndex);
+    for (std::size_t pos = 0; pos < ready.size(); ++pos) {
+        t.order.push_back(nodes_[ready[pos]].get());
+        t.position[ready[pos]] = static_cast<std::uint32_t>(pos);
     }
+    t.acyclic = t.order.size() == n;
 
     // Annotate topo indices when successful.
-    if (order.size() == nodes_.size()) {
-        for (std::size_t i = 0; i < order.size(); ++i) {
-            order[i]->setTopoIndex(i);
-        }
-    } else {
-        for (const auto& n : nodes_) {
-            n->setTopoIndex(std::nullopt);
-        }
+    for (const auto& node : nodes_) {
+        const std::uint32_t pos = t.position[node->graphIndex()];
+        node->setTopoIndex(t.acyclic ? std::optional<std::size_t>(pos) : std::nullopt);
     }
+    t.built = true;
+    return t;
+}
 
-    return order;
+std::vector<Node*> Graph::topologicalSort() {
+    return topology().order;
 }
 
 void Graph::validate() const {
@@ -199,49 +372,65 @@ void Graph::validate() const {
     }
 
     // Cycle check via topo sort
-    // (const_cast is fine here: topoIndex annotations are non-semantic)
+    // (const_cast is fine here: the cached order and topoIndex annotations are non-semantic)
     auto* self = const_cast<Graph*>(this);
-    const auto order = self->topologicalSort();
-    if (order.size() != nodes_.size()) {
+    if (!self->topology().acyclic) {
         throw std::runtime_error("Graph::validate: cycle detected or dangling dependency");
     }
 }
 
 MemoryPlan Graph::planMemory() {
+    return planMemory(MemoryPlanOptions{});
+}
+
+MemoryPlan Graph::planMemory(const MemoryPlanOptions& options) {
     MemoryPlan plan;
-    const auto order = topologicalSort();
-    if (order.size() != nodes_.size()) {
+    plan.alignment = options.alignment;
+    plan.concurrent = options.concurrent;
+    const Topology& topo = topology();
+    if (!topo.acyclic) {
         // No valid plan if graph has cycles.
         return plan;
     }
-
-    // Map node->index
-    std::unordered_map<const Node*, std::size_t> node_index;
-    node_index.reserve(order.size());
-    for (std::size_t i = 0; i < order.size(); ++i) {
-        node_index[order[i]] = i;
+    const std::vector<Node*>& order = topo.order;
+    const std::size_t n = order.size();
+    constexpr std::size_t kNone = static_cast<std::size_t>(-1);
+    // Position of `node` in the schedule, kNone for a node of another graph.
+    auto positionOf = [&](const Node* node) {
+        return ownsNodePtr(node) ? static_cast<std::size_t>(topo.position[node->graphIndex()]) : kNone;
+    };
+
+    // Everything below is indexed by Value::planSlot().
+    const std::size_t num_values = values_.size();
+    std::vector<char> is_input(num_values, 0), is_output(num_values, 0);
+    for (const Value* v : inputs_) {
+        if (ownsValuePtr(v)) is_input[v->planSlot()] = 1;
+    }
+    for (const Value* v : outputs_) {
+        if (ownsValuePtr(v)) is_output[v->planSlot()] = 1;
     }
+    auto isOutput = [&](const Value* v) { return is_output[v->planSlot()] != 0; };
+    // Graph inputs and producer-less values (initializers) are owned outside the arena.
+    auto plannable = [&](const Value* v) { return v->producer() != nullptr && is_input[v->planSlot()] == 0; };
 
-    const std::size_t n = order.size();
     // Compute lifetimes for produced values.
+    std::vector<ValueLifetime> lives(num_values);
     for (const auto& vptr : values_) {
         const Value* v = vptr.get();
-        ValueLifetime life;
+        ValueLifetime& life = lives[v->planSlot()];
 
         std::size_t first = 0;
         if (v->producer() != nullptr) {
-            auto it = node_index.find(v->producer());
-            first = (it == node_index.end()) ? 0 : it->second;
+            const std::size_t pos = positionOf(v->producer());
+            first = pos == kNone ? 0 : pos;
         }
         std::size_t last = first;
         for (const Node* c : v->consumers()) {
-            auto it = node_index.find(c);
-            if (it != node_index.end()) {
-                last = std::max(last, it->second);
-            }
+            const std::size_t pos = positionOf(c);
+            if (pos != kNone) last = std::max(last, pos);
         }
-        if (std::find(outputs_.begin(), outputs_.end(), const_cast<Value*>(v)) != outputs_.end()) {
-            if (n > 0) last = std::max(last, n - 1);
+        if (isOutput(v) && n > 0) {
+            last = std::max(last, n - 1);
         }
 
         // Estimate bytes based on metadata (may be 0 for UNKNOWN).
@@ -256,30 +445,265 @@ MemoryPlan Graph::planMemory() {
         life.first_index = first;
         life.last_index = last;
         life.bytes = bytes;
-        plan.lifetimes.emplace(v->id(), life);
     }
 
-    // Compute peak via sweep over node indices.
-    std::size_t peak = 0;
-    for (std::size_t i = 0; i < n; ++i) {
-        std::size_t live = 0;
-        for (const auto& kv : plan.lifetimes) {
-            const auto& lf = kv.second;
-            if (lf.bytes == 0) continue;
-            if (lf.first_index <= i && i <= lf.last_index) {
-                live += lf.bytes;
+    // Concurrent-safe planning needs descendant bitsets over topological indices.
+    const std::size_t words = (n + 63) / 64;
+    std::vector<std::uint64_t> reach;
+    if (options.concurrent) {
+        reach.assign(n * words, 0);
+        for (std::size_t i = n; i-- > 0;) {
+            std::uint64_t* row = &reach[i * words];
+            const std::uint32_t gi = order[i]->graphIndex();
+            for (std::uint32_t k = topo.succ_begin[gi]; k < topo.succ_begin[gi + 1]; ++k) {
+                const std::size_t j = topo.position[topo.succ[k]];
+                row[j / 64] |= (std::uint64_t{1} << (j % 64));
+                const std::uint64_t* child = &reach[j * words];
+                for (std::size_t w = 0; w < words; ++w) row[w] |= child[w];
+            }
+        }
+    }
+    auto reaches = [&](std::size_t from, std::size_t to) {
+        return from != to && (reach[from * words + to / 64] >> (to % 64)) & 1u;
+    };
+
+    // Alias groups: Values that share one slot because an operator declared its
+    // output in-place or a view of its input. groups[g][0] is the slot owner.
+    // Views of caller-owned buffers are bound by their operator at run time instead.
+    constexpr std::uint32_t kNoGroup = ~std::uint32_t{0};
+    std::vector<std::uint32_t> group_of(num_values, kNoGroup);
+    std::vector<std::vector<const Value*>> groups;
+    std::vector<char> external_view(num_values, 0);
+    // Node `i` may overwrite a group once nothing else will read any member: every
+    // other consumer runs earlier in the schedule (or, for concurrent plans, under
+    // every legal schedule), and no member is observable as a graph output.
+    auto canOverwrite = [&](const std::vector<const Value*>& members, const Node* writer, std::size_t i) {
+        for (const Value* m : members) {
+            if (isOutput(m)) return false;
+            for (const Node* c : m->consumers()) {
+                if (c == writer) continue;
+                const std::size_t pos = positionOf(c);
+                if (pos == kNone) return false;
+                if (options.concurrent ? !reaches(pos, i) : pos > i) return false;
+            }
+        }
+        return true;
+    };
+    if (options.in_place) {
+        for (std::size_t i = 0; i < n; ++i) {
+            const Node* node = order[i];
+            const Operator* op = node->op();
+            const BufferAlias alias = op != nullptr ? op->outputAlias() : BufferAlias::None;
+            if (alias == BufferAlias::None || node->inputs().empty() || node->outputs().empty()) continue;
+            const Value* in = node->inputs()[0];
+            const Value* out = node->outputs()[0];
+            if (!ownsValuePtr(in) || !ownsValuePtr(out)) continue;
+            ValueLifetime& out_life = lives[out->planSlot()];
+            if (out_life.bytes == 0 || lives[in->planSlot()].bytes != out_life.bytes) continue;
+
+            if (!plannable(in) || external_view[in->planSlot()] != 0) {
+                if (alias == BufferAlias::View) {
+                    external_view[out->planSlot()] = 1;
+                    out_life.alias_of = in->id();
+                }
+                continue;
             }
+            std::uint32_t& g = group_of[in->planSlot()];
+            if (g == kNoGroup) {
+                g = static_cast<std::uint32_t>(groups.size());
+                groups.push_back({in});
+            }
+            if (alias == BufferAlias::InPlace && !canOverwrite(groups[g], node, i)) continue;
+            groups[g].push_back(out);
+            group_of[out->planSlot()] = g;
+            out_life.alias_of = in->id();
         }
+    }
+
+    // One slot per group (spanning all of its members) and per ungrouped value.
+    std::vector<ValueLifetime> group_slots(groups.size());
+    for (std::size_t gi = 0; gi < groups.size(); ++gi) {
+        ValueLifetime& slot = group_slots[gi];
+        slot = lives[groups[gi][0]->planSlot()];
+        for (const Value* m : groups[gi]) {
+            const ValueLifetime& lm = lives[m->planSlot()];
+            slot.first_index = std::min(slot.first_index, lm.first_index);
+            slot.last_index = std::max(slot.last_index, lm.last_index);
+            slot.bytes = std::max(slot.bytes, lm.bytes);
+        }
+    }
+    auto slotOf = [&](const Value* v) -> ValueLifetime& {
+        const std::uint32_t g = group_of[v->planSlot()];
+        return g != kNoGroup ? group_slots[g] : lives[v->planSlot()];
+    };
+
+    // Peak via a linear event sweep: each slot adds its bytes at its first node and
+    // releases them after its last; aliases add no bytes of their own.
+    std::vector<std::size_t> allocated(n + 1, 0), released(n + 1, 0);
+    for (const auto& vptr : values_) {
+        const ValueLifetime& lf = lives[vptr->planSlot()];
+        if (lf.alias_of != 0 || lf.bytes == 0) continue;
+        const ValueLifetime& slot = slotOf(vptr.get());
+        allocated[std::min(slot.first_index, n)] += slot.bytes;
+        released[std::min(slot.last_index + 1, n)] += slot.bytes;
+    }
+    std::size_t peak = 0;
+    std::size_t live = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        live = live + allocated[i] - released[i];
         peak = std::max(peak, live);
     }
     plan.peak_bytes = peak;
+
+    // Assign arena offsets to values produced inside the graph.
+    std::vector<PlanItem> planned;
+    planned.reserve(num_values);
+    for (const auto& vptr : values_) {
+        const Value* v = vptr.get();
+        if (!plannable(v) || external_view[v->planSlot()] != 0) continue;
+        const ValueLifetime& lf = lives[v->planSlot()];
+        if (lf.bytes == 0 || lf.alias_of != 0) continue;
+        const std::uint32_t g = group_of[v->planSlot()];
+        planned.push_back({&slotOf(v), v, g != kNoGroup ? &groups[g] : nullptr});
+    }
+
+    if (!options.concurrent) {
+        plan.arena_bytes = assignOffsets(planned, plan.alignment, [](const PlanItem& a, const PlanItem& b) {
+            return a.life->first_index <= b.life->last_index && b.life->first_index <= a.life->last_index;
+        });
+    } else {
+        // `a` is dead before `b` is written when every node that last touches `a` happens
+        // before b's producer under every legal schedule.
+        auto deadBefore = [&](const Value* a, const Value* b) {
+            if (isOutput(a)) return false;
+            const std::size_t prod_b = positionOf(b->producer());
+            if (a->consumers().empty()) {
+                return reaches(positionOf(a->producer()), prod_b);
+            }
+            for (const Node* c : a->consumers()) {
+                const std::size_t pos = positionOf(c);
+                if (pos == kNone || !reaches(pos, prod_b)) return false;
+            }
+            return true;
+        };
+        // Later members of a group are written after its owner, so a slot is free for
+        // `b` once every member of `a` is dead before b's owner is produced.
+        auto slotDeadBefore = [&](const PlanItem& a, const PlanItem& b) {
+            if (a.members == nullptr) return deadBefore(a.value, b.value);
+            return std::all_of(a.members->begin(), a.members->end(),
+                               [&](const Value* m) { return deadBefore(m, b.value); });
+        };
+        plan.arena_bytes = assignOffsets(planned, plan.alignment, [&](const PlanItem& a, const PlanItem& b) {
+            return !slotDeadBefore(a, b) && !slotDeadBefore(b, a);
+        });
+    }
+
+    for (std::size_t gi = 0; gi < groups.size(); ++gi) {
+        for (const Value* m : groups[gi]) {
+            ValueLifetime& lm = lives[m->planSlot()];
+            lm.offset = group_slots[gi].offset;
+            lm.planned = group_slots[gi].planned;
+        }
+    }
+    plan.lifetimes.reserve(num_values);
+    for (const auto& vptr : values_) {
+        plan.lifetimes.emplace(vptr->id(), lives[vptr->planSlot()]);
+    }
     return plan;
 }
 
+void Graph::bindMemory(const MemoryPlan& plan) {
+    // Any outstanding plan refers to the old arena.
+    releaseMemory();
+    if (plan.arena_bytes == 0) {
+        return;
+    }
+
+    std::shared_ptr<inference_engine::core::Storage> arena =
+        allocateArena(plan.arena_bytes, plan.alignment, plan.arena_pages);
+    auto* base = static_cast<std::uint8_t*>(arena->data());
+
+    // Reserve up-front so tensor addresses handed to Values stay stable.
+    bound_tensors_.reserve(plan.lifetimes.size());
+    bound_values_.reserve(plan.lifetimes.size());
+    for (const auto& vptr : values_) {
+        Value* v = vptr.get();
+        const auto it = plan.lifetimes.find(v->id());
+        if (it == plan.lifetimes.end() || !it->second.planned) continue;
+        bound_tensors_.emplace_back(v->shape(), v->dtype(), static_cast<void*>(base + it->second.offset), false);
+        v->setTensor(&bound_tensors_.back());
+        bound_values_.push_back(v);
+    }
+    arena_ = std::move(arena);
+    arena_alignment_ = plan.alignment;
+    arena_pages_ = plan.arena_pages;
+}
+
+void Graph::rebindArena(std::shared_ptr<inference_engine::core::Storage> arena) noexcept {
+    const auto* old_base = static_cast<const std::uint8_t*>(arena_->data());
+    auto* base = static_cast<std::uint8_t*>(arena->data());
+    for (auto& t : bound_tensors_) {
+        t.set_data(base + (static_cast<const std::uint8_t*>(t.data()) - old_base), false);
+    }
+    arena_ = std::move(arena);
+}
+
+void Graph::releaseMemory() noexcept {
+    compiled_.reset();
+    for (Value* v : bound_values_) {
+        v->clearTensor();
+    }
+    bound_values_.clear();
+    bound_tensors_.clear();
+    arena_.reset();
+    spare_arenas_.clear();
+}
+
 void Graph::applyPass(GraphPass& pass) {
     pass.run(*this);
 }
 
+std::unique_ptr<Graph> Graph::clone() const {
+    auto copy = std::make_unique<Graph>();
+    copy->model_name_ = model_name_;
+    copy->model_version_ = model_version_;
+    copy->attrs_ = attrs_;
+
+    // Values are created in the same order, so the copy of v is copy->values_[v->planSlot()].
+    std::vector<char> is_input(values_.size(), 0);
+    for (const Value* v : inputs_) {
+        if (ownsValuePtr(v)) is_input[v->planSlot()] = 1;
+    }
+    for (const auto& v : values_) {
+        Value* c = v->hasQuantization() ? copy->createValue(v->shape(), v->dtype(), *v->quantization(), v->name())
+                                        : copy->createValue(v->shape(), v->dtype(), v->name());
+        if (v->producer() == nullptr && is_input[v->planSlot()] == 0) {
+            // Constants are only ever read; share this graph's tensor.
+            c->setTensor(const_cast<inference_engine::core::Tensor*>(static_cast<const Value&>(*v).tensor()));
+        }
+    }
+    auto mapped = [&](const std::vector<Value*>& vs) {
+        std::vector<Value*> out;
+        out.reserve(vs.size());
+        for (Value* v : vs) {
+            if (v != nullptr && !ownsValuePtr(v)) {
+                throw std::out_of_range("Graph::clone: Value not owned by graph");
+            }
+            out.push_back(v == nullptr ? nullptr : copy->values_[v->planSlot()].get());
+        }
+        return out;
+    };
+    for (const auto& n : nodes_) {
+        Node* c = copy->addNode(n->op() != nullptr ? n->op()->clone() : nullptr, n->name());
+        c->setInputs(mapped(n->inputs()));
+        c->setOutputs(mapped(n->outputs()));
+        c->setDebugInfo(n->debugInfo());
+    }
+    copy->setInputs(mapped(inputs_));
+    copy->setOutputs(mapped(outputs_));
+    return copy;
+}
+
 void Graph::addNode(const std::string& name) {
     // Legacy placeholder: add a node without an operator.
     (void)addNode(nullptr, name);
@@ -292,40 +716,157 @@ void Graph::addEdge(const std::string& from, const std::string& to) {
     (void)to;
 }
 
-inference_engine::core::Tensor Graph::execute(const inference_engine::core::Tensor& input) {
-    if (nodes_.empty()) {
-        return input;
+std::unique_ptr<ExecutionPlan> Graph::compile(const CompileOptions& options) {
+    for (const auto& n : nodes_) {
+        Operator* op = n->op();
+        if (op != nullptr && op->attributes() != nullptr) {
+            op->decodeAttributes(*op->attributes());
+        }
+    }
+    validate();
+    const Topology& topo = topology();
+    if (!topo.acyclic) {
+        throw std::runtime_error("Graph::compile: graph has cycles");
     }
 
-    // Placeholder execution: if single graph input, bind it to a runtime view.
-    inference_engine::core::Tensor runtime_input = input; // shallow copy, non-owning
-    if (inputs_.size() == 1 && inputs_[0] != nullptr) {
-        inputs_[0]->setTensor(&runtime_input);
+    MemoryPlanOptions mem_options;
+    mem_options.concurrent = options.parallel;
+    PlanSchedule schedule;
+    schedule.memory = planMemory(mem_options);
+
+    constexpr std::uint32_t kNoStep = ~std::uint32_t{0};
+    std::vector<std::uint32_t> step_of(nodes_.size(), kNoStep); // by Node::graphIndex()
+    for (Node* node : topo.order) {
+        if (node == nullptr || node->op() == nullptr) continue;
+        step_of[node->graphIndex()] = static_cast<std::uint32_t>(schedule.order.size());
+        schedule.order.push_back(node->graphIndex());
     }
 
-    validate();
-    const auto order = topologicalSort();
-    if (order.size() != nodes_.size()) {
-        throw std::runtime_error("Graph::execute: graph has cycles");
+    // Dependency edges between steps (producer -> consumer), already deduplicated.
+    schedule.successors.resize(schedule.order.size());
+    for (std::size_t s = 0; s < schedule.order.size(); ++s) {
+        const std::uint32_t gi = schedule.order[s];
+        for (std::uint32_t k = topo.succ_begin[gi]; k < topo.succ_begin[gi + 1]; ++k) {
+            const std::uint32_t succ = step_of[topo.succ[k]];
+            if (succ != kNoStep) schedule.successors[s].push_back(succ);
+        }
     }
+    return buildPlan(std::move(schedule), options);
+}
 
-    for (Node* node : order) {
-        if (node == nullptr) continue;
+std::unique_ptr<ExecutionPlan> Graph::compile(const PlanSchedule& schedule, const CompileOptions& options) {
+    const std::size_t n = schedule.order.size();
+    if (schedule.successors.size() != n) {
+        throw std::invalid_argument("Graph::compile: schedule has " + std::to_string(n) + " steps but " +
+                                    std::to_string(schedule.successors.size()) + " successor lists");
+    }
+    if (options.parallel && !schedule.memory.concurrent) {
+        throw std::invalid_argument("Graph::compile: a parallel plan needs a concurrent memory plan");
+    }
+    std::vector<char> scheduled(nodes_.size(), 0);
+    for (std::size_t s = 0; s < n; ++s) {
+        const std::uint32_t gi = schedule.order[s];
+        if (gi >= nodes_.size() || nodes_[gi]->op() == nullptr || scheduled[gi] != 0) {
+            throw std::invalid_argument("Graph::compile: schedule step " + std::to_string(s) +
+                                        " does not name a distinct operator node");
+        }
+        scheduled[gi] = 1;
+        for (std::uint32_t succ : schedule.successors[s]) {
+            // Successors run later, so any order of ready steps respects the edges.
+            if (succ <= s || succ >= n) {
+                throw std::invalid_argument("Graph::compile: schedule step " + std::to_string(s) +
+                                            " has an invalid successor");
+            }
+        }
+    }
+    for (const auto& [id, lifetime] : schedule.memory.lifetimes) {
+        if (lifetime.planned && (lifetime.offset > schedule.memory.arena_bytes ||
+                                 lifetime.bytes > schedule.memory.arena_bytes - lifetime.offset)) {
+            throw std::invalid_argument("Graph::compile: schedule places a value outside its arena");
+        }
+    }
+    for (const auto& node : nodes_) {
         Operator* op = node->op();
-        if (op == nullptr) {
-            continue;
+        if (op != nullptr && op->attributes() != nullptr) {
+            op->decodeAttributes(*op->attributes());
         }
-        // Keep operator IO in sync with node IO.
-        op->setInputs(node->inputs());
-        op->setOutputs(node->outputs());
-        op->execute();
     }
+    return buildPlan(schedule, options);
+}
 
-    if (outputs_.size() == 1 && outputs_[0] != nullptr && outputs_[0]->tensor() != nullptr) {
-        return *(outputs_[0]->tensor());
+std::unique_ptr<ExecutionPlan> Graph::buildPlan(PlanSchedule schedule, const CompileOptions& options) {
+    schedule.memory.arena_pages = options.arena_pages;
+    if (options.bind_memory) {
+        bindMemory(schedule.memory);
+    } else {
+        releaseMemory();
     }
 
-    return input;
+    std::vector<Value*> values;
+    values.reserve(values_.size());
+    for (const auto& v : values_) {
+        values.push_back(v.get());
+    }
+
+    std::vector<ExecutionPlan::Step> steps(schedule.order.size());
+    for (std::size_t s = 0; s < steps.size(); ++s) {
+        Node* node = nodes_[schedule.order[s]].get();
+        if (options.prepack_weights) {
+            node->op()->prepackWeights(options.weight_cache, options.weight_store,
+                                       std::to_string(node->graphIndex()) + ":" + node->name());
+        }
+        node->op()->prepare();
+        steps[s].node = node;
+        steps[s].op = node->op();
+        steps[s].successors = std::move(schedule.successors[s]);
+        for (std::uint32_t succ : steps[s].successors) steps[succ].num_predecessors += 1;
+    }
+    return std::unique_ptr<ExecutionPlan>(
+        new ExecutionPlan(std::move(steps), std::move(schedule.memory), inputs_, outputs_, std::move(values)));
+}
+
+inference_engine::core::Tensor Graph::execute(const inference_engine::core::Tensor& input) {
+    if (nodes_.empty()) {
+        return input;
+    }
+
+    if (!compiled_) {
+        compiled_ = compile();
+        exec_inputs_.assign(inputs_.size(), inference_engine::core::Tensor{});
+    }
+    if (exec_inputs_.size() != 1) {
+        throw std::invalid_argument("Graph::execute: expected a single-input graph (use compile())");
+    }
+    if (arena_ != nullptr && arena_.use_count() > 1) {
+        // A previous result still views the arena: run in a free spare (or a new one).
+        std::shared_ptr<inference_engine::core::Storage> next;
+        for (auto& spare : spare_arenas_) {
+            if (spare.use_count() == 1) {
+                next = std::move(spare);
+                spare = arena_;
+                break;
+            }
+        }
+        if (next == nullptr) {
+            next = allocateArena(arena_->size(), arena_alignment_, arena_pages_);
+            spare_arenas_.push_back(arena_);
+        }
+        rebindArena(std::move(next));
+    }
+    exec_inputs_[0] = input;
+    compiled_->run(exec_inputs_, exec_outputs_);
+
+    if (exec_outputs_.size() != 1 || exec_outputs_[0].data() == nullptr) {
+        return input;
+    }
+    inference_engine::core::Tensor result = std::move(exec_outputs_[0]);
+    if (arena_ != nullptr && arena_->contains(result.data())) {
+        result.share_storage(arena_);
+        return result;
+    }
+    // Operator-private or caller memory may change under a held result: copy it,
+    // materializing strided views.
+    return result.is_contiguous() ? result.clone() : result.contiguous();
 }
 
 } // namespace infer
@@ -0,0 +1,140 @@
+#include "inference_engine/graph/kv_cache.h"
+
+#include "inference_engine/kernels/attention.h"
+
+#include <algorithm>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace infer {
+
+namespace {
+
+constexpr std::size_t kBlockAlignment = 64;
+
+std::size_t blockFloats(const KVCacheConfig& c) {
+    if (c.layers == 0 || c.kv_heads == 0 || c.head_dim == 0 || c.blocks == 0) {
+        throw std::invalid_argument("KVCache: layers, kv_heads, head_dim and blocks must be non-zero");
+    }
+    if (c.block_tokens == 0 || c.block_tokens > kMaxAttentionBlockTokens) {
+        throw std::invalid_argument("KVCache: block_tokens must be in [1, " +
+                                    std::to_string(kMaxAttentionBlockTokens) + "]");
+    }
+    if (c.blocks > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("KVCache: too many blocks");
+    }
+    const std::size_t max = std::numeric_limits<std::size_t>::max() / sizeof(float);
+    std::size_t floats = c.block_tokens;
+    for (std::size_t f : {c.head_dim, c.kv_heads, std::size_t{2}, c.layers}) {
+        if (floats > max / f) throw std::invalid_argument("KVCache: block size overflows");
+        floats *= f;
+    }
+    // Blocks start on cache lines.
+    constexpr std::size_t kLineFloats = kBlockAlignment / sizeof(float);
+    floats = (floats + kLineFloats - 1) / kLineFloats * kLineFloats;
+    if (floats > max / c.blocks) throw std::invalid_argument("KVCache: pool size overflows");
+    return floats;
+}
+
+inference_engine::memory::Arena::Options arenaOptions(const KVCacheConfig& c, std::size_t block_floats) {
+    inference_engine::memory::Arena::Options options;
+    options.initial_bytes = c.blocks * block_floats * sizeof(float);
+    options.base_alignment = kBlockAlignment;
+    options.pages = c.pages;
+    return options;
+}
+
+} // namespace
+
+KVCache::KVCache(const KVCacheConfig& config)
+    : config_(config),
+      head_floats_(config.block_tokens * config.head_dim),
+      block_floats_(blockFloats(config)),
+      arena_(arenaOptions(config, block_floats_)) {
+    void* pool = arena_.allocate(config_.blocks * block_floats_ * sizeof(float), kBlockAlignment);
+    if (pool == nullptr) throw std::bad_alloc();
+    base_ = static_cast<float*>(pool);
+    free_.reserve(config_.blocks);
+    // Popped from the back: block 0 first, so short runs stay at the front of the pool.
+    for (std::size_t b = config_.blocks; b-- > 0;) free_.push_back(static_cast<std::uint32_t>(b));
+}
+
+KVCache::SequenceId KVCache::addSequence() {
+    SequenceId id;
+    if (!free_ids_.empty()) {
+        id = free_ids_.back();
+        free_ids_.pop_back();
+    } else {
+        id = static_cast<SequenceId>(sequences_.size());
+        sequences_.emplace_back();
+    }
+    sequences_[id].live = true;
+    ++live_;
+    return id;
+}
+
+void KVCache::removeSequence(SequenceId id) {
+    Sequence& s = sequence(id);
+    free_.insert(free_.end(), s.blocks.rbegin(), s.blocks.rend());
+    s.blocks.clear();
+    s.length = 0;
+    s.live = false;
+    free_ids_.push_back(id);
+    --live_;
+    // A removed sequence leaves the step it was part of.
+    const auto row = std::find(step_.rows.begin(), step_.rows.end(), id);
+    if (row != step_.rows.end()) step_ = Step{};
+}
+
+void KVCache::beginStep(std::vector<SequenceId> rows, std::size_t tokens) {
+    std::size_t needed = 0;
+    for (std::size_t r = 0; r < rows.size(); ++r) {
+        const Sequence& s = sequence(rows[r]);
+        if (std::find(rows.begin(), rows.begin() + static_cast<std::ptrdiff_t>(r), rows[r]) !=
+            rows.begin() + static_cast<std::ptrdiff_t>(r)) {
+            throw std::invalid_argument("KVCache::beginStep: sequence " + std::to_string(rows[r]) + " listed twice");
+        }
+        const std::size_t blocks = (s.length + tokens + config_.block_tokens - 1) / config_.block_tokens;
+        needed += blocks - s.blocks.size();
+    }
+    if (needed > free_.size()) {
+        throw std::length_error("KVCache::beginStep: needs " + std::to_string(needed) + " blocks, " +
+                                std::to_string(free_.size()) + " free");
+    }
+
+    step_.positions.clear();
+    for (SequenceId id : rows) {
+        Sequence& s = sequences_[id];
+        step_.positions.push_back(s.length);
+        s.length += tokens;
+        while (s.blocks.size() * config_.block_tokens < s.length) {
+            s.blocks.push_back(free_.back());
+            free_.pop_back();
+        }
+    }
+    step_.rows = std::move(rows);
+    step_.tokens = tokens;
+}
+
+std::size_t KVCache::length(SequenceId id) const {
+    return sequence(id).length;
+}
+
+const std::vector<std::uint32_t>& KVCache::blockTable(SequenceId id) const {
+    return sequence(id).blocks;
+}
+
+KVCache::Sequence& KVCache::sequence(SequenceId id) {
+    return const_cast<Sequence&>(static_cast<const KVCache*>(this)->sequence(id));
+}
+
+const KVCache::Sequence& KVCache::sequence(SequenceId id) const {
+    if (id >= sequences_.size() || !sequences_[id].live) {
+        throw std::invalid_argument("KVCache: unknown sequence " + std::to_string(id));
+    }
+    return sequences_[id];
+}
+
+} // namespace infer
@@ -0,0 +1,322 @@
+#include "inference_engine/graph/metrics.h"
+
+#include "inference_engine/core/model.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/profiler.h"
+#include "inference_engine/memory/allocator.h"
+#include "inference_engine/scheduler/batcher.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+
+namespace infer {
+
+namespace {
+
+thread_local MetricsRegistry* tl_current_metrics = nullptr;
+
+std::uint64_t elapsedNs(std::chrono::steady_clock::time_point since) {
+    const auto elapsed = std::chrono::steady_clock::now() - since;
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+template <typename Row>
+void sortByName(std::vector<Row>& rows) {
+    std::sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) { return a.name < b.name; });
+}
+
+// ==================== Prometheus text format ====================
+
+void writeHeader(std::ostream& os, const char* metric, const char* type, const char* help) {
+    os << "# HELP " << metric << ' ' << help << "\n# TYPE " << metric << ' ' << type << '\n';
+}
+
+void writeLabelValue(std::ostream& os, const std::string& value) {
+    os << '"';
+    for (const char c : value) {
+        if (c == '\\' || c == '"') {
+            os << '\\' << c;
+        } else if (c == '\n') {
+            os << "\\n";
+        } else {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+// One sample per row: metric{label="row.name"} value(row).
+template <typename Row, typename Value>
+void writeFamily(std::ostream& os, const char* metric, const char* type, const char* help, const char* label,
+                 const std::vector<Row>& rows, Value value) {
+    if (rows.empty()) return;
+    writeHeader(os, metric, type, help);
+    for (const Row& row : rows) {
+        os << metric << '{' << label << '=';
+        writeLabelValue(os, row.name);
+        os << "} " << value(row) << '\n';
+    }
+}
+
+template <typename Row, typename Histogram>
+void writeHistogram(std::ostream& os, const char* metric, const char* help, const char* label,
+                    const std::vector<Row>& rows, Histogram histogram) {
+    if (rows.empty()) return;
+    writeHeader(os, metric, "histogram", help);
+    for (const Row& row : rows) {
+        const LatencyHistogram::Snapshot& h = histogram(row);
+        std::uint64_t cumulative = 0;
+        for (std::size_t i = 0; i < LatencyHistogram::kBuckets; ++i) {
+            cumulative += h.counts[i];
+            os << metric << "_bucket{" << label << '=';
+            writeLabelValue(os, row.name);
+            os << ",le=\"";
+            if (i + 1 == LatencyHistogram::kBuckets) {
+                os << "+Inf";
+            } else {
+                os << static_cast<double>(LatencyHistogram::boundNs(i)) * 1e-9;
+            }
+            os << "\"} " << cumulative << '\n';
+        }
+        os << metric << "_sum{" << label << '=';
+        writeLabelValue(os, row.name);
+        os << "} " << static_cast<double>(h.sum_ns) * 1e-9 << '\n';
+        os << metric << "_count{" << label << '=';
+        writeLabelValue(os, row.name);
+        os << "} " << h.count << '\n';
+    }
+}
+
+} // namespace
+
+// ==================== LatencyHistogram ====================
+
+std::uint64_t LatencyHistogram::boundNs(std::size_t bucket) noexcept {
+    if (bucket + 1 >= kBuckets) return std::numeric_limits<std::uint64_t>::max();
+    return std::uint64_t{1000} << bucket;
+}
+
+void LatencyHistogram::record(std::uint64_t ns) noexcept {
+    // Bucket i > 0 holds (1000 << (i - 1), 1000 << i]: the bit width of (ns - 1) / 1000.
+    std::size_t bucket = 0;
+    for (std::uint64_t q = ns > 0 ? (ns - 1) / 1000 : 0; q != 0; q >>= 1) ++bucket;
+    counts_[std::min(bucket, kBuckets - 1)].fetch_add(1, std::memory_order_relaxed);
+    sum_ns_.fetch_add(ns, std::memory_order_relaxed);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const noexcept {
+    Snapshot s;
+    for (std::size_t i = 0; i < kBuckets; ++i) {
+        s.counts[i] = counts_[i].load(std::memory_order_relaxed);
+        s.count += s.counts[i];
+    }
+    s.sum_ns = sum_ns_.load(std::memory_order_relaxed);
+    return s;
+}
+
+std::uint64_t LatencyHistogram::Snapshot::quantileNs(double q) const noexcept {
+    if (count == 0) return 0;
+    const double clamped = std::min(1.0, std::max(0.0, q));
+    const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(clamped * count)));
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i + 1 < kBuckets; ++i) {
+        cumulative += counts[i];
+        if (cumulative >= rank) return boundNs(i);
+    }
+    return boundNs(kBuckets - 2);
+}
+
+// ==================== MetricsRegistry ====================
+
+MetricsRegistry::MetricsRegistry() {
+    op_tables_.push_back(std::make_unique<const OpTable>());
+    ops_.store(op_tables_.back().get(), std::memory_order_release);
+}
+
+MetricsRegistry::~MetricsRegistry() = default;
+
+LatencyHistogram& MetricsRegistry::modelLatency(const std::string& model) {
+    std::lock_guard<std::mutex> lock(mu_);
+    LatencyHistogram*& h = models_[model];
+    if (h == nullptr) h = &histograms_.emplace_back();
+    return *h;
+}
+
+LatencyHistogram& MetricsRegistry::opLatency(const std::string& op_type) {
+    const OpTable* table = ops_.load(std::memory_order_acquire);
+    if (const auto it = table->find(op_type); it != table->end()) return *it->second;
+
+    std::lock_guard<std::mutex> lock(mu_);
+    table = ops_.load(std::memory_order_relaxed);
+    if (const auto it = table->find(op_type); it != table->end()) return *it->second;
+    // Readers may still hold the old table, so every version lives as long as the registry.
+    auto next = std::make_unique<OpTable>(*table);
+    LatencyHistogram& h = histograms_.emplace_back();
+    next->emplace(op_type, &h);
+    ops_.store(next.get(), std::memory_order_release);
+    op_tables_.push_back(std::move(next));
+    return h;
+}
+
+void MetricsRegistry::execute(const ExecutionPlan::Step& step) {
+    executeStep(step, nullptr, this);
+}
+
+void MetricsRegistry::track(const std::string& name, const ThreadPool& pool) {
+    track(name, Kind::Pool, &pool);
+}
+
+void MetricsRegistry::track(const std::string& name, const DynamicBatcher& batcher) {
+    track(name, Kind::Batcher, &batcher);
+}
+
+void MetricsRegistry::track(const std::string& name, const inference_engine::core::Allocator& allocator) {
+    track(name, Kind::Allocator, &allocator);
+}
+
+void MetricsRegistry::track(const std::string& name, const Model& model) {
+    track(name, Kind::Model, &model);
+}
+
+void MetricsRegistry::track(const std::string& name, Kind kind, const void* object) {
+    std::lock_guard<std::mutex> lock(mu_);
+    for (Source& s : sources_) {
+        if (s.object == object) {
+            s = Source{name, kind, object};
+            return;
+        }
+    }
+    sources_.push_back(Source{name, kind, object});
+}
+
+void MetricsRegistry::untrack(const void* object) {
+    std::lock_guard<std::mutex> lock(mu_);
+    sources_.erase(std::remove_if(sources_.begin(), sources_.end(),
+                                  [object](const Source& s) { return s.object == object; }),
+                   sources_.end());
+}
+
+MetricsSnapshot MetricsRegistry::snapshot() const {
+    MetricsSnapshot out;
+    const OpTable* ops = ops_.load(std::memory_order_acquire);
+    for (const auto& [type, h] : *ops) out.ops.push_back({type, h->snapshot()});
+
+    // Sources are read under the lock so untrack() waits for a snapshot in progress.
+    std::lock_guard<std::mutex> lock(mu_);
+    for (const auto& [name, h] : models_) out.models.push_back({name, h->snapshot()});
+    for (const Source& source : sources_) {
+        switch (source.kind) {
+        case Kind::Pool: {
+            const auto& pool = *static_cast<const ThreadPool*>(source.object);
+            const ThreadPool::Stats s = pool.stats();
+            out.pools.push_back({source.name, pool.size(), s.queued, s.executed, s.steals, s.busy_ns});
+            break;
+        }
+        case Kind::Batcher: {
+            const DynamicBatcher::Stats s = static_cast<const DynamicBatcher*>(source.object)->stats();
+            out.batchers.push_back(
+                {source.name, s.queue_depth, s.max_queue_depth, s.requests, s.batches, s.padded_rows, s.wait});
+            break;
+        }
+        case Kind::Allocator: {
+            const auto s = static_cast<const inference_engine::core::Allocator*>(source.object)->stats();
+            out.allocators.push_back({source.name, s.live_bytes, s.peak_live_bytes, s.live_allocations});
+            break;
+        }
+        case Kind::Model: {
+            const Model::ArenaStats s = static_cast<const Model*>(source.object)->arenaStats();
+            out.arenas.push_back({source.name, s.contexts, s.bytes, s.peak_bytes});
+            break;
+        }
+        }
+    }
+    sortByName(out.allocators);
+    sortByName(out.arenas);
+    sortByName(out.pools);
+    sortByName(out.batchers);
+    return out;
+}
+
+void MetricsRegistry::writePrometheus(std::ostream& os) const {
+    using Snapshot = MetricsSnapshot;
+    const Snapshot s = snapshot();
+    const auto old_flags = os.flags();
+    const auto old_precision = os.precision();
+    os << std::defaultfloat << std::setprecision(10);
+
+    writeHistogram(os, "ie_model_latency_seconds", "Model::infer() latency.", "model", s.models,
+                   [](const Snapshot::Latency& r) -> const auto& { return r.histogram; });
+    writeHistogram(os, "ie_op_latency_seconds", "Operator execution latency by type.", "op_type", s.ops,
+                   [](const Snapshot::Latency& r) -> const auto& { return r.histogram; });
+
+    writeFamily(os, "ie_allocator_live_bytes", "gauge", "Bytes currently allocated.", "allocator", s.allocators,
+                [](const Snapshot::Allocator& r) { return r.live_bytes; });
+    writeFamily(os, "ie_allocator_peak_live_bytes", "gauge", "High-water mark of live bytes.", "allocator",
+                s.allocators, [](const Snapshot::Allocator& r) { return r.peak_live_bytes; });
+    writeFamily(os, "ie_allocator_live_allocations", "gauge", "Allocations currently live.", "allocator",
+                s.allocators, [](const Snapshot::Allocator& r) { return r.live_allocations; });
+
+    writeFamily(os, "ie_model_contexts", "gauge", "Execution contexts kept per thread.", "model", s.arenas,
+                [](const Snapshot::Arena& r) { return r.contexts; });
+    writeFamily(os, "ie_model_arena_bytes", "gauge", "Activation arena bytes of those contexts.", "model", s.arenas,
+                [](const Snapshot::Arena& r) { return r.bytes; });
+    writeFamily(os, "ie_model_arena_peak_bytes", "gauge", "High-water mark of activation arena bytes.", "model",
+                s.arenas, [](const Snapshot::Arena& r) { return r.peak_bytes; });
+
+    writeFamily(os, "ie_thread_pool_threads", "gauge", "Worker threads.", "pool", s.pools,
+                [](const Snapshot::Pool& r) { return r.threads; });
+    writeFamily(os, "ie_thread_pool_queued_tasks", "gauge", "Tasks waiting for a thread.", "pool", s.pools,
+                [](const Snapshot::Pool& r) { return r.queued; });
+    writeFamily(os, "ie_thread_pool_tasks_total", "counter", "Tasks executed.", "pool", s.pools,
+                [](const Snapshot::Pool& r) { return r.executed; });
+    writeFamily(os, "ie_thread_pool_steals_total", "counter", "Tasks stolen from another worker.", "pool", s.pools,
+                [](const Snapshot::Pool& r) { return r.steals; });
+    writeFamily(os, "ie_thread_pool_busy_seconds_total", "counter",
+                "Time spent running tasks; its rate over threads is the utilization.", "pool", s.pools,
+                [](const Snapshot::Pool& r) { return static_cast<double>(r.busy_ns) * 1e-9; });
+
+    writeFamily(os, "ie_batcher_queue_depth", "gauge", "Requests waiting for a batch.", "batcher", s.batchers,
+                [](const Snapshot::Batcher& r) { return r.queue_depth; });
+    writeFamily(os, "ie_batcher_max_queue_depth", "gauge", "High-water mark of the queue depth.", "batcher",
+                s.batchers, [](const Snapshot::Batcher& r) { return r.max_queue_depth; });
+    writeFamily(os, "ie_batcher_requests_total", "counter", "Requests submitted.", "batcher", s.batchers,
+                [](const Snapshot::Batcher& r) { return r.requests; });
+    writeFamily(os, "ie_batcher_batches_total", "counter", "Batches dispatched.", "batcher", s.batchers,
+                [](const Snapshot::Batcher& r) { return r.batches; });
+    writeFamily(os, "ie_batcher_padded_rows_total", "counter", "Compiled batch rows that carried no request.",
+                "batcher", s.batchers, [](const Snapshot::Batcher& r) { return r.padded_rows; });
+    writeHistogram(os, "ie_batcher_wait_seconds", "Time from submit() to dispatch of the request's batch.", "batcher",
+                   s.batchers, [](const Snapshot::Batcher& r) -> const auto& { return r.wait; });
+
+    os.flags(old_flags);
+    os.precision(old_precision);
+}
+
+MetricsRegistry* MetricsRegistry::current() noexcept {
+    return tl_current_metrics;
+}
+
+MetricsRegistry::Scope::Scope(MetricsRegistry* metrics) noexcept : previous_(tl_current_metrics) {
+    tl_current_metrics = metrics;
+}
+
+MetricsRegistry::Scope::~Scope() {
+    tl_current_metrics = previous_;
+}
+
+void executeStep(const ExecutionPlan::Step& step, Profiler* profiler, MetricsRegistry* metrics) {
+    const auto t0 = metrics != nullptr ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+    if (profiler != nullptr) {
+        profiler->execute(step);
+    } else {
+        step.op->execute();
+    }
+    if (metrics != nullptr) metrics->opLatency(step.op->type()).record(elapsedNs(t0));
+}
+
+} // namespace infer
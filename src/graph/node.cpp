@@ -1,6 +1,7 @@
 
 #include "inference_engine/graph/node.h"
 
+#include "inference_engine/graph/graph.h"
 #include "inference_engine/graph/operator.h"
 #include "inference_engine/graph/value.h"
 
@@ -22,6 +23,7 @@ Node::Node(Graph* graph, std::string name, std::unique_ptr<Operator> op)
 	if (name_.empty()) {
 		name_ = "node_" + std::to_string(id_);
 	}
+	syncOperatorIO();
 }
 
 Node::~Node() {
@@ -34,6 +36,17 @@ void Node::setName(std::string name) {
 
 void Node::setOperator(std::unique_ptr<Operator> op) {
 	op_ = std::move(op);
+	syncOperatorIO();
+}
+
+void Node::syncOperatorIO() {
+	if (graph_) {
+		graph_->invalidate();
+	}
+	if (op_) {
+		op_->setInputs(inputs_);
+		op_->setOutputs(outputs_);
+	}
 }
 
 void Node::resetExecutionState() noexcept {
@@ -87,6 +100,7 @@ void Node::setInputs(std::vector<Value*> inputs) {
 
 	inputs_ = std::move(inputs);
 	attachInputsToValues();
+	syncOperatorIO();
 }
 
 void Node::setOutputs(std::vector<Value*> outputs) {
@@ -99,6 +113,7 @@ void Node::setOutputs(std::vector<Value*> outputs) {
 
 	outputs_ = std::move(outputs);
 	attachOutputsToValues();
+	syncOperatorIO();
 }
 
 void Node::addInput(Value* v) {
@@ -106,6 +121,7 @@ void Node::addInput(Value* v) {
 	if (v) {
 		v->addConsumer(this);
 	}
+	syncOperatorIO();
 }
 
 void Node::addOutput(Value* v) {
@@ -113,6 +129,7 @@ void Node::addOutput(Value* v) {
 	if (v) {
 		v->setProducer(this);
 	}
+	syncOperatorIO();
 }
 
 std::string Node::debugString() const {
@@ -30,6 +30,8 @@ void Operator::addOutput(Value* v) {
 	outputs_.push_back(v);
 }
 
+void Operator::decodeAttributes(const AttributeMap& /*attrs*/) {}
+
 void Operator::validate() const {
 	auto is_null = [](const Value* v) { return v == nullptr; };
 	if (std::any_of(inputs_.begin(), inputs_.end(), is_null)) {
@@ -40,9 +42,25 @@ void Operator::validate() const {
 	}
 }
 
+void Operator::inferShapes() {
+	throw std::invalid_argument(op_type_ + ": shape inference is not supported");
+}
+
+void Operator::prepackWeights(PackedWeightCache* /*cache*/, WeightStore* /*store*/, const std::string& /*key*/) {}
+
+void Operator::prepare() {}
+
+BufferAlias Operator::outputAlias() const noexcept {
+	return BufferAlias::None;
+}
+
 std::size_t Operator::estimateMemoryBytes() const noexcept {
 	return 0;
 }
 
+std::uint64_t Operator::estimateFlops() const noexcept {
+	return 0;
+}
+
 } // namespace infer
 
@@ -0,0 +1,203 @@
+#include "inference_engine/graph/packed_weight_cache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace infer {
+
+namespace {
+
+constexpr char kMagic[8] = {'I', 'E', 'P', 'A', 'C', 'K', '\0', '\0'};
+constexpr std::uint32_t kVersion = 1;
+constexpr std::size_t kBlobAlignment = 64;
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t isa;
+    std::uint64_t model_hash;
+    std::uint64_t entries;
+    std::uint64_t file_bytes;
+    std::uint64_t reserved[3];
+};
+static_assert(sizeof(Header) == 64, "Header layout is part of the file format");
+
+std::size_t alignUp(std::size_t v, std::size_t a) {
+    return (v + a - 1) / a * a;
+}
+
+std::string hex64(std::uint64_t v) {
+    char buf[17];
+    std::snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(v));
+    return buf;
+}
+
+} // namespace
+
+PackedWeightCache::PackedWeightCache(std::string directory, std::uint64_t model_hash)
+    : PackedWeightCache(std::move(directory), model_hash, max_isa()) {}
+
+PackedWeightCache::PackedWeightCache(std::string directory, std::uint64_t model_hash, Isa isa)
+    : model_hash_(model_hash), isa_(isa) {
+    if (!directory.empty() && directory.back() != '/') directory += '/';
+    path_ = directory + hex64(model_hash) + "-" + isa_to_string(isa) + ".iepack";
+    openFile();
+}
+
+PackedWeightCache::~PackedWeightCache() = default;
+
+void PackedWeightCache::openFile() {
+    try {
+        file_ = inference_engine::core::MappedFile(path_);
+    } catch (const std::runtime_error&) {
+        return; // no cache yet
+    }
+    const auto* base = static_cast<const char*>(file_.data());
+    const std::size_t size = file_.size();
+    Header header{};
+    if (size < sizeof(header)) return;
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion ||
+        header.isa != static_cast<std::uint32_t>(isa_) || header.model_hash != model_hash_ ||
+        header.file_bytes != size) {
+        return;
+    }
+
+    // Entries are read into a local map first so a truncated table adds nothing.
+    std::map<std::string, Blob> blobs;
+    std::size_t pos = sizeof(header);
+    auto read = [&](void* dst, std::size_t n) {
+        if (n > size - pos) return false;
+        std::memcpy(dst, base + pos, n);
+        pos += n;
+        return true;
+    };
+    for (std::uint64_t i = 0; i < header.entries; ++i) {
+        std::uint32_t name_bytes = 0;
+        if (!read(&name_bytes, sizeof(name_bytes)) || name_bytes > size - pos) return;
+        std::string name(base + pos, name_bytes);
+        pos += name_bytes;
+        std::uint64_t offset = 0, bytes = 0;
+        if (!read(&offset, sizeof(offset)) || !read(&bytes, sizeof(bytes))) return;
+        if (offset % kBlobAlignment != 0 || offset > size || bytes > size - offset) return;
+        blobs[std::move(name)] = Blob{base + offset, static_cast<std::size_t>(bytes)};
+    }
+    blobs_ = std::move(blobs);
+    mapped_blobs_ = blobs_.size();
+}
+
+PackedWeightCache::Blob PackedWeightCache::find(const std::string& key, std::size_t bytes) const {
+    std::lock_guard<std::mutex> lock(mu_);
+    const auto it = blobs_.find(key);
+    if (it == blobs_.end() || it->second.bytes != bytes) return {};
+    return it->second;
+}
+
+PackedWeightCache::Blob PackedWeightCache::insert(const std::string& key, const void* data, std::size_t bytes) {
+    auto storage = std::make_unique<Line[]>(std::max<std::size_t>(1, alignUp(bytes, sizeof(Line)) / sizeof(Line)));
+    std::memcpy(storage.get(), data, bytes);
+    const Blob blob{storage.get(), bytes};
+
+    std::lock_guard<std::mutex> lock(mu_);
+    owned_.push_back(std::move(storage));
+    auto& slot = blobs_[key];
+    if (slot.data != nullptr && file_.contains(slot.data)) --mapped_blobs_;
+    slot = blob;
+    dirty_ = true;
+    return blob;
+}
+
+bool PackedWeightCache::flush() {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (!dirty_) return true;
+
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.isa = static_cast<std::uint32_t>(isa_);
+    header.model_hash = model_hash_;
+    header.entries = blobs_.size();
+
+    std::size_t table_bytes = 0;
+    for (const auto& [name, blob] : blobs_) table_bytes += sizeof(std::uint32_t) + name.size() + 16;
+    std::vector<std::uint64_t> offsets;
+    std::size_t end = alignUp(sizeof(header) + table_bytes, kBlobAlignment);
+    for (const auto& [name, blob] : blobs_) {
+        offsets.push_back(end);
+        end = alignUp(end + blob.bytes, kBlobAlignment);
+    }
+    header.file_bytes = end;
+
+    const std::string tmp = path_ + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        std::size_t i = 0;
+        for (const auto& [name, blob] : blobs_) {
+            const auto name_bytes = static_cast<std::uint32_t>(name.size());
+            const std::uint64_t bytes = blob.bytes;
+            out.write(reinterpret_cast<const char*>(&name_bytes), sizeof(name_bytes));
+            out.write(name.data(), static_cast<std::streamsize>(name.size()));
+            out.write(reinterpret_cast<const char*>(&offsets[i++]), sizeof(std::uint64_t));
+            out.write(reinterpret_cast<const char*>(&bytes), sizeof(bytes));
+        }
+        const std::vector<char> zeros(kBlobAlignment, 0);
+        std::size_t pos = sizeof(header) + table_bytes;
+        i = 0;
+        for (const auto& [name, blob] : blobs_) {
+            out.write(zeros.data(), static_cast<std::streamsize>(offsets[i] - pos));
+            out.write(static_cast<const char*>(blob.data), static_cast<std::streamsize>(blob.bytes));
+            pos = offsets[i++] + blob.bytes;
+        }
+        out.write(zeros.data(), static_cast<std::streamsize>(end - pos));
+        if (!out) {
+            out.close();
+            std::remove(tmp.c_str());
+            return false;
+        }
+    }
+    // The current mapping (if any) keeps the replaced file's pages alive.
+    if (std::rename(tmp.c_str(), path_.c_str()) != 0) {
+        std::remove(tmp.c_str());
+        return false;
+    }
+    dirty_ = false;
+    return true;
+}
+
+std::size_t PackedWeightCache::mappedBlobs() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return mapped_blobs_;
+}
+
+std::size_t PackedWeightCache::size() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return blobs_.size();
+}
+
+std::uint64_t PackedWeightCache::hashBytes(const void* data, std::size_t bytes) noexcept {
+    const auto* p = static_cast<const unsigned char*>(data);
+    std::uint64_t h = 0x9e3779b97f4a7c15ull ^ bytes;
+    auto mix = [&h](std::uint64_t w) {
+        h ^= w * 0xff51afd7ed558ccdull;
+        h = (h << 31 | h >> 33) * 0xc4ceb9fe1a85ec53ull;
+    };
+    std::size_t i = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        std::uint64_t w;
+        std::memcpy(&w, p + i, sizeof(w));
+        mix(w);
+    }
+    std::uint64_t tail = 0;
+    std::memcpy(&tail, p + i, bytes - i);
+    mix(tail);
+    h ^= h >> 29;
+    return h;
+}
+
+} // namespace infer
@@ -0,0 +1,154 @@
+#include "inference_engine/graph/plan_cache.h"
+
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/passes/shape_inference.h"
+
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace infer {
+
+using inference_engine::core::DimVector;
+using inference_engine::core::Shape;
+
+namespace {
+
+std::int64_t roundUpToPowerOfTwo(std::int64_t n) {
+    std::int64_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+// Flattened signature: rank followed by the dimensions, for every input.
+std::vector<std::int64_t> signature(const std::vector<Shape>& shapes) {
+    std::vector<std::int64_t> key;
+    for (const Shape& s : shapes) {
+        key.push_back(static_cast<std::int64_t>(s.rank()));
+        key.insert(key.end(), s.dims().begin(), s.dims().end());
+    }
+    return key;
+}
+
+} // namespace
+
+SpecializedPlan::SpecializedPlan(std::unique_ptr<Graph> graph, std::unique_ptr<ExecutionPlan> plan,
+                                 std::vector<Shape> input_shapes)
+    : graph_(std::move(graph)), plan_(std::move(plan)), input_shapes_(std::move(input_shapes)) {}
+
+SpecializedPlan::~SpecializedPlan() = default;
+
+std::size_t PlanCache::KeyHash::operator()(const std::vector<std::int64_t>& key) const noexcept {
+    std::uint64_t h = 1469598103934665603ull; // FNV-1a over the dimensions
+    for (std::int64_t d : key) {
+        h ^= static_cast<std::uint64_t>(d);
+        h *= 1099511628211ull;
+    }
+    return static_cast<std::size_t>(h);
+}
+
+PlanCache::PlanCache(Graph& source, PlanCacheOptions options)
+    : source_(source), options_(options), source_revision_(source.revision()) {
+    if (options_.capacity == 0) {
+        throw std::invalid_argument("PlanCache: capacity must be at least 1");
+    }
+}
+
+PlanCache::~PlanCache() = default;
+
+std::vector<Shape> PlanCache::bucketed(const std::vector<Shape>& input_shapes) const {
+    if (options_.batch_bucketing == BatchBucketing::None) {
+        return input_shapes;
+    }
+    std::vector<Shape> out;
+    out.reserve(input_shapes.size());
+    for (const Shape& s : input_shapes) {
+        DimVector dims = s.dims();
+        if (!dims.empty() && dims[0] > 0) dims[0] = roundUpToPowerOfTwo(dims[0]);
+        out.emplace_back(std::move(dims));
+    }
+    return out;
+}
+
+std::shared_ptr<const SpecializedPlan> PlanCache::acquire(const std::vector<Shape>& input_shapes) {
+    std::vector<Shape> shapes = bucketed(input_shapes);
+    std::vector<std::int64_t> key = signature(shapes);
+
+    std::shared_future<std::shared_ptr<const SpecializedPlan>> cached;
+    std::promise<std::shared_ptr<const SpecializedPlan>> promise;
+    std::uint64_t build_id = 0;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (source_revision_ != source_.revision()) {
+            index_.clear();
+            lru_.clear();
+            source_revision_ = source_.revision();
+        }
+        const auto it = index_.find(key);
+        if (it != index_.end()) {
+            ++stats_.hits;
+            lru_.splice(lru_.begin(), lru_, it->second);
+            cached = it->second->plan;
+        } else {
+            // Publish the in-flight entry so that a new shape still costs exactly one compile.
+            ++stats_.misses;
+            build_id = ++builds_;
+            lru_.push_front(Entry{key, promise.get_future().share(), build_id});
+            index_.emplace(key, lru_.begin());
+        }
+    }
+    // A hit waits here, outside the lock, when its entry is still being compiled.
+    if (cached.valid()) return cached.get();
+
+    std::shared_ptr<const SpecializedPlan> plan;
+    try {
+        plan = build(shapes);
+    } catch (...) {
+        promise.set_exception(std::current_exception());
+        // Drop the failed entry, unless it was already evicted or replaced, so the next caller retries.
+        std::lock_guard<std::mutex> lock(mu_);
+        const auto it = index_.find(key);
+        if (it != index_.end() && it->second->build == build_id) {
+            lru_.erase(it->second);
+            index_.erase(it);
+        }
+        throw;
+    }
+    promise.set_value(plan);
+    // Evict only once the plan exists, so a shape that fails to compile costs no cached plan.
+    std::lock_guard<std::mutex> lock(mu_);
+    while (lru_.size() > options_.capacity) {
+        index_.erase(lru_.back().key);
+        lru_.pop_back();
+        ++stats_.evictions;
+    }
+    return plan;
+}
+
+std::shared_ptr<const SpecializedPlan> PlanCache::build(const std::vector<Shape>& shapes) const {
+    std::unique_ptr<Graph> graph = source_.clone();
+    ShapeInferencePass inference(shapes);
+    graph->applyPass(inference);
+    std::unique_ptr<ExecutionPlan> plan = graph->compile(options_.compile);
+    return std::make_shared<const SpecializedPlan>(std::move(graph), std::move(plan), shapes);
+}
+
+std::size_t PlanCache::size() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return lru_.size();
+}
+
+PlanCache::Stats PlanCache::stats() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return stats_;
+}
+
+void PlanCache::clear() {
+    std::lock_guard<std::mutex> lock(mu_);
+    index_.clear();
+    lru_.clear();
+}
+
+} // namespace infer
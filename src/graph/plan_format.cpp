@@ -0,0 +1,305 @@
+#include "inference_engine/graph/plan_format.h"
+
+#include "inference_engine/core/mapped_file.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/packed_weight_cache.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/kernels/cpu_features.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace infer {
+
+using inference_engine::core::Half;
+using inference_engine::core::QuantizationParams;
+using plan_format::PlanHeader;
+using plan_format::ValueRecord;
+
+namespace {
+
+bool hostIsLittleEndian() {
+    const std::uint16_t probe = 1;
+    std::uint8_t first = 0;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+std::uint64_t alignUp(std::uint64_t v, std::uint64_t a) {
+    return (v + a - 1) / a * a;
+}
+
+// Offset of the ValueRecord array after the header and the step arrays.
+std::uint64_t valuesOffset(std::uint64_t steps, std::uint64_t edges) {
+    const std::uint64_t arrays = sizeof(PlanHeader) + sizeof(std::uint32_t) * (steps + steps + 1 + edges);
+    return alignUp(arrays, alignof(ValueRecord));
+}
+
+std::uint64_t hashString(const std::string& s) {
+    return PackedWeightCache::hashBytes(s.data(), s.size());
+}
+
+template <typename T>
+void appendBits(std::vector<std::uint64_t>& words, T value) {
+    static_assert(sizeof(T) <= sizeof(std::uint64_t), "one word per value");
+    std::uint64_t w = 0;
+    std::memcpy(&w, &value, sizeof(T));
+    words.push_back(w);
+}
+
+// Quantization parameters of a Value, 0 for none.
+std::uint64_t quantizationHash(const Value& v) {
+    if (!v.hasQuantization()) return 0;
+    const QuantizationParams& qp = *v.quantization();
+    std::vector<std::uint64_t> words;
+    appendBits(words, qp.scale);
+    appendBits(words, qp.zero_point);
+    appendBits(words, qp.axis);
+    words.push_back(qp.symmetric ? 1 : 0);
+    appendBits(words, qp.group_size);
+    appendBits(words, qp.bits);
+    words.push_back(qp.per_channel_scales.size());
+    for (float f : qp.per_channel_scales) appendBits(words, f);
+    words.push_back(qp.per_channel_zero_points.size());
+    for (std::int32_t zp : qp.per_channel_zero_points) appendBits(words, zp);
+    words.push_back(qp.group_scales.size());
+    for (Half h : qp.group_scales) words.push_back(h.bits);
+    return PackedWeightCache::hashBytes(words.data(), words.size() * sizeof(std::uint64_t));
+}
+
+// Operator attributes by name (ids are per process), 0 for none.
+std::uint64_t attributesHash(const Operator& op) {
+    const AttributeMap* attrs = op.attributes();
+    if (attrs == nullptr || attrs->empty()) return 0;
+    std::vector<std::uint64_t> words;
+    for (const auto& [key, value] : attrs->raw()) {
+        words.push_back(hashString(key.name()));
+        words.push_back(value.index());
+        std::visit(
+            [&words](const auto& a) {
+                using A = std::decay_t<decltype(a)>;
+                if constexpr (std::is_same_v<A, AttributeMap::String>) {
+                    words.push_back(hashString(a));
+                } else if constexpr (std::is_arithmetic_v<A>) {
+                    appendBits(words, a);
+                } else {
+                    words.push_back(a.size());
+                    for (const auto& e : a) {
+                        if constexpr (std::is_same_v<std::decay_t<decltype(e)>, AttributeMap::String>) {
+                            words.push_back(hashString(e));
+                        } else {
+                            appendBits(words, e);
+                        }
+                    }
+                }
+            },
+            value);
+    }
+    return PackedWeightCache::hashBytes(words.data(), words.size() * sizeof(std::uint64_t));
+}
+
+} // namespace
+
+std::uint64_t graphFingerprint(const Graph& graph) {
+    std::unordered_map<const Value*, std::uint64_t> slot;
+    slot.reserve(graph.values().size());
+    for (const auto& v : graph.values()) slot.emplace(v.get(), slot.size());
+    auto slotOf = [&slot](const Value* v) {
+        const auto it = slot.find(v);
+        return it == slot.end() ? ~std::uint64_t{0} : it->second;
+    };
+
+    std::vector<std::uint64_t> words;
+    words.push_back(graph.values().size());
+    for (const auto& v : graph.values()) {
+        words.push_back(static_cast<std::uint64_t>(v->dtype()));
+        words.push_back(v->shape().rank());
+        for (std::int64_t d : v->shape().dims()) words.push_back(static_cast<std::uint64_t>(d));
+        words.push_back(quantizationHash(*v));
+    }
+    words.push_back(graph.nodes().size());
+    for (const auto& n : graph.nodes()) {
+        const Operator* op = n->op();
+        words.push_back(op == nullptr ? 0 : hashString(op->type()));
+        words.push_back(op == nullptr ? 0 : attributesHash(*op));
+        words.push_back(n->inputs().size());
+        for (const Value* v : n->inputs()) words.push_back(slotOf(v));
+        words.push_back(n->outputs().size());
+        for (const Value* v : n->outputs()) words.push_back(slotOf(v));
+    }
+    for (const auto* io : {&graph.inputs(), &graph.outputs()}) {
+        words.push_back(io->size());
+        for (const Value* v : *io) words.push_back(slotOf(v));
+    }
+    return PackedWeightCache::hashBytes(words.data(), words.size() * sizeof(std::uint64_t));
+}
+
+void savePlan(const Graph& graph, const ExecutionPlan& plan, const std::string& path) {
+    if (!hostIsLittleEndian()) throw std::runtime_error("savePlan: big-endian hosts are not supported");
+    const auto& values = graph.values();
+    if (plan.values().size() != values.size()) {
+        throw std::invalid_argument("savePlan: the plan was not compiled from this graph");
+    }
+    std::unordered_map<Value::Id, std::uint32_t> slot_of;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (plan.values()[i] != values[i].get()) {
+            throw std::invalid_argument("savePlan: the plan was not compiled from this graph");
+        }
+        slot_of.emplace(values[i]->id(), static_cast<std::uint32_t>(i));
+    }
+
+    const auto& steps = plan.steps();
+    std::vector<std::uint32_t> order, succ_begin, succ;
+    order.reserve(steps.size());
+    succ_begin.reserve(steps.size() + 1);
+    for (const ExecutionPlan::Step& step : steps) {
+        order.push_back(step.node->graphIndex());
+        succ_begin.push_back(static_cast<std::uint32_t>(succ.size()));
+        succ.insert(succ.end(), step.successors.begin(), step.successors.end());
+    }
+    succ_begin.push_back(static_cast<std::uint32_t>(succ.size()));
+
+    const MemoryPlan& memory = plan.memoryPlan();
+    std::vector<ValueRecord> records(values.size(), ValueRecord{0, 0, 0, 0, plan_format::kNoAlias, 0});
+    for (const auto& [id, lifetime] : memory.lifetimes) {
+        const auto it = slot_of.find(id);
+        if (it == slot_of.end()) continue;
+        ValueRecord& r = records[it->second];
+        r.first_index = lifetime.first_index;
+        r.last_index = lifetime.last_index;
+        r.bytes = lifetime.bytes;
+        r.offset = lifetime.offset;
+        r.flags = plan_format::kHasLifetime | (lifetime.planned ? plan_format::kPlanned : 0u);
+        if (lifetime.alias_of != 0) {
+            const auto alias = slot_of.find(lifetime.alias_of);
+            if (alias != slot_of.end()) r.alias_of = alias->second;
+        }
+    }
+
+    PlanHeader header{};
+    std::memcpy(header.magic, plan_format::kMagic, sizeof(header.magic));
+    header.version = plan_format::kVersion;
+    header.header_bytes = sizeof(header);
+    header.graph_hash = graphFingerprint(graph);
+    header.isa = static_cast<std::uint32_t>(max_isa());
+    header.flags = memory.concurrent ? plan_format::kConcurrent : 0u;
+    header.steps = static_cast<std::uint32_t>(order.size());
+    header.edges = static_cast<std::uint32_t>(succ.size());
+    header.values = static_cast<std::uint32_t>(records.size());
+    header.alignment = static_cast<std::uint32_t>(memory.alignment);
+    header.arena_bytes = memory.arena_bytes;
+    header.peak_bytes = memory.peak_bytes;
+    header.values_offset = valuesOffset(header.steps, header.edges);
+    header.file_bytes = header.values_offset + records.size() * sizeof(ValueRecord);
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) throw std::runtime_error("savePlan: cannot open " + path);
+    auto write = [&out](const void* data, std::size_t bytes) {
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    };
+    write(&header, sizeof(header));
+    write(order.data(), order.size() * sizeof(std::uint32_t));
+    write(succ_begin.data(), succ_begin.size() * sizeof(std::uint32_t));
+    write(succ.data(), succ.size() * sizeof(std::uint32_t));
+    const char zeros[alignof(ValueRecord)] = {};
+    write(zeros, static_cast<std::size_t>(header.values_offset - static_cast<std::uint64_t>(out.tellp())));
+    write(records.data(), records.size() * sizeof(ValueRecord));
+    if (!out) throw std::runtime_error("savePlan: write failed for " + path);
+}
+
+std::unique_ptr<ExecutionPlan> loadPlan(const inference_engine::core::MappedFile& file, Graph& graph,
+                                        const CompileOptions& options, std::string* reason) {
+    if (!hostIsLittleEndian()) throw std::runtime_error("loadPlan: big-endian hosts are not supported");
+    const auto* base = static_cast<const char*>(file.data());
+    PlanHeader header{};
+    if (file.size() < sizeof(header)) throw std::runtime_error("loadPlan: file too small");
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, plan_format::kMagic, sizeof(header.magic)) != 0) {
+        throw std::runtime_error("loadPlan: not a plan file (bad magic)");
+    }
+
+    // Compatibility: anything else is a stale plan, recompiled by the caller.
+    auto stale = [reason](const std::string& why) -> std::unique_ptr<ExecutionPlan> {
+        if (reason != nullptr) *reason = "loadPlan: " + why;
+        return nullptr;
+    };
+    if (header.version != plan_format::kVersion) {
+        return stale("written by plan format version " + std::to_string(header.version) + ", this build reads " +
+                     std::to_string(plan_format::kVersion));
+    }
+    if (header.isa != static_cast<std::uint32_t>(max_isa())) {
+        return stale("written on a host with another ISA than this one");
+    }
+    if (header.values != graph.values().size() || header.graph_hash != graphFingerprint(graph)) {
+        return stale("written for a different graph (fingerprint mismatch). The file holds only the schedule, "
+                     "so the graph must be built exactly as when it was saved, after the same passes "
+                     "(fusion, constant folding, ...); a plan saved from a rewritten graph does not match "
+                     "the model file until those passes run again");
+    }
+    if (options.parallel && (header.flags & plan_format::kConcurrent) == 0) {
+        return stale("written without the concurrent memory plan that CompileOptions::parallel needs");
+    }
+
+    if (header.header_bytes != sizeof(header) || header.file_bytes != file.size() ||
+        header.values_offset != valuesOffset(header.steps, header.edges) ||
+        header.file_bytes != header.values_offset + std::uint64_t{header.values} * sizeof(ValueRecord) ||
+        header.alignment == 0) {
+        throw std::runtime_error("loadPlan: corrupt header");
+    }
+
+    // The mapping is page-aligned and every array sits at its natural alignment.
+    const auto* order = reinterpret_cast<const std::uint32_t*>(base + sizeof(header));
+    const std::uint32_t* succ_begin = order + header.steps;
+    const std::uint32_t* succ = succ_begin + header.steps + 1;
+    const auto* records = reinterpret_cast<const ValueRecord*>(base + header.values_offset);
+
+    PlanSchedule schedule;
+    schedule.order.assign(order, order + header.steps);
+    schedule.successors.resize(header.steps);
+    if (succ_begin[0] != 0 || succ_begin[header.steps] != header.edges) {
+        throw std::runtime_error("loadPlan: corrupt successor table");
+    }
+    for (std::uint32_t s = 0; s < header.steps; ++s) {
+        if (succ_begin[s + 1] < succ_begin[s]) throw std::runtime_error("loadPlan: corrupt successor table");
+        schedule.successors[s].assign(succ + succ_begin[s], succ + succ_begin[s + 1]);
+    }
+
+    MemoryPlan& memory = schedule.memory;
+    memory.alignment = header.alignment;
+    memory.arena_bytes = static_cast<std::size_t>(header.arena_bytes);
+    memory.peak_bytes = static_cast<std::size_t>(header.peak_bytes);
+    memory.concurrent = (header.flags & plan_format::kConcurrent) != 0;
+    const auto& values = graph.values();
+    memory.lifetimes.reserve(values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const ValueRecord& r = records[i];
+        if ((r.flags & plan_format::kHasLifetime) == 0) continue;
+        ValueLifetime lifetime;
+        lifetime.first_index = static_cast<std::size_t>(r.first_index);
+        lifetime.last_index = static_cast<std::size_t>(r.last_index);
+        lifetime.bytes = static_cast<std::size_t>(r.bytes);
+        lifetime.offset = static_cast<std::size_t>(r.offset);
+        lifetime.planned = (r.flags & plan_format::kPlanned) != 0;
+        if (r.alias_of != plan_format::kNoAlias) {
+            if (r.alias_of >= values.size()) throw std::runtime_error("loadPlan: corrupt value table");
+            lifetime.alias_of = values[r.alias_of]->id();
+        }
+        memory.lifetimes.emplace(values[i]->id(), lifetime);
+    }
+
+    try {
+        return graph.compile(schedule, options);
+    } catch (const std::invalid_argument& e) {
+        throw std::runtime_error(std::string("loadPlan: ") + e.what());
+    }
+}
+
+} // namespace infer
@@ -0,0 +1,184 @@
+#include "inference_engine/graph/profiler.h"
+
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/value.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <unordered_map>
+
+namespace infer {
+
+namespace {
+
+thread_local Profiler* tl_current_profiler = nullptr;
+
+std::uint64_t valueBytes(const std::vector<Value*>& values) {
+    std::uint64_t bytes = 0;
+    for (const Value* v : values) {
+        if (v == nullptr) continue;
+        bytes += static_cast<std::uint64_t>(v->shape().num_elements()) *
+                 inference_engine::core::bytes_per_element(v->dtype());
+    }
+    return bytes;
+}
+
+void writeJsonString(std::ostream& os, const std::string& s) {
+    os << '"';
+    for (const char c : s) {
+        switch (c) {
+        case '"':
+            os << "\\\"";
+            break;
+        case '\\':
+            os << "\\\\";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        case '\t':
+            os << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec
+                   << std::setfill(' ');
+            } else {
+                os << c;
+            }
+        }
+    }
+    os << '"';
+}
+
+} // namespace
+
+Profiler::Profiler() : epoch_(std::chrono::steady_clock::now()) {}
+
+void Profiler::execute(const ExecutionPlan::Step& step) {
+    const auto t0 = std::chrono::steady_clock::now();
+    step.op->execute();
+    const auto t1 = std::chrono::steady_clock::now();
+
+    Event e;
+    e.node = step.node != nullptr ? step.node->name() : std::string();
+    e.op_type = step.op->type();
+    e.duration_ns = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+    e.bytes_read = valueBytes(step.op->inputs()) + step.op->estimateMemoryBytes();
+    e.bytes_written = valueBytes(step.op->outputs());
+    e.flops = step.op->estimateFlops();
+
+    std::lock_guard<std::mutex> lock(mu_);
+    // A step that started before clear() restarted the epoch begins at 0.
+    e.start_ns = t0 > epoch_ ? static_cast<std::uint64_t>(
+                                   std::chrono::duration_cast<std::chrono::nanoseconds>(t0 - epoch_).count())
+                             : 0;
+    e.thread = threadIndex(std::this_thread::get_id());
+    events_.push_back(std::move(e));
+}
+
+std::uint32_t Profiler::threadIndex(std::thread::id id) {
+    const auto it = std::find(threads_.begin(), threads_.end(), id);
+    if (it != threads_.end()) {
+        return static_cast<std::uint32_t>(it - threads_.begin());
+    }
+    threads_.push_back(id);
+    return static_cast<std::uint32_t>(threads_.size() - 1);
+}
+
+std::vector<Profiler::Event> Profiler::events() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return events_;
+}
+
+std::vector<Profiler::OpTypeSummary> Profiler::summarize() const {
+    std::vector<OpTypeSummary> rows;
+    std::unordered_map<std::string, std::size_t> index;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        for (const Event& e : events_) {
+            auto it = index.find(e.op_type);
+            if (it == index.end()) {
+                it = index.emplace(e.op_type, rows.size()).first;
+                rows.push_back(OpTypeSummary{e.op_type});
+            }
+            OpTypeSummary& row = rows[it->second];
+            ++row.calls;
+            row.total_ns += e.duration_ns;
+            row.bytes += e.bytes_read + e.bytes_written;
+            row.flops += e.flops;
+        }
+    }
+    std::stable_sort(rows.begin(), rows.end(),
+                     [](const OpTypeSummary& a, const OpTypeSummary& b) { return a.total_ns > b.total_ns; });
+    return rows;
+}
+
+void Profiler::clear() {
+    std::lock_guard<std::mutex> lock(mu_);
+    events_.clear();
+    threads_.clear();
+    epoch_ = std::chrono::steady_clock::now();
+}
+
+void Profiler::writeChromeTrace(std::ostream& os) const {
+    const std::vector<Event> events = this->events();
+    const auto old_flags = os.flags();
+    const auto old_precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+    os << "{\"traceEvents\":[";
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        const Event& e = events[i];
+        os << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+        writeJsonString(os, e.node.empty() ? e.op_type : e.node);
+        os << ",\"cat\":";
+        writeJsonString(os, e.op_type);
+        os << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << e.thread << ",\"ts\":" << static_cast<double>(e.start_ns) * 1e-3
+           << ",\"dur\":" << static_cast<double>(e.duration_ns) * 1e-3 << ",\"args\":{\"bytes_read\":" << e.bytes_read
+           << ",\"bytes_written\":" << e.bytes_written << ",\"flops\":" << e.flops << "}}";
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    os.flags(old_flags);
+    os.precision(old_precision);
+}
+
+void Profiler::printSummary(std::ostream& os) const {
+    const std::vector<OpTypeSummary> rows = summarize();
+    std::uint64_t total_ns = 0;
+    for (const OpTypeSummary& r : rows) total_ns += r.total_ns;
+
+    const auto old_flags = os.flags();
+    const auto old_precision = os.precision();
+    os << std::left << std::setw(20) << "op_type" << std::right << std::setw(8) << "calls" << std::setw(12)
+       << "total_us" << std::setw(10) << "avg_us" << std::setw(8) << "time%" << std::setw(10) << "GFLOP/s"
+       << std::setw(10) << "GB/s" << '\n';
+    os << std::fixed;
+    for (const OpTypeSummary& r : rows) {
+        const double us = static_cast<double>(r.total_ns) * 1e-3;
+        const double seconds = static_cast<double>(r.total_ns) * 1e-9;
+        os << std::left << std::setw(20) << r.op_type << std::right << std::setw(8) << r.calls << std::setprecision(1)
+           << std::setw(12) << us << std::setw(10) << us / static_cast<double>(r.calls) << std::setw(8)
+           << (total_ns == 0 ? 0.0 : 100.0 * static_cast<double>(r.total_ns) / static_cast<double>(total_ns))
+           << std::setprecision(2) << std::setw(10)
+           << (seconds > 0.0 ? static_cast<double>(r.flops) / seconds * 1e-9 : 0.0) << std::setw(10)
+           << (seconds > 0.0 ? static_cast<double>(r.bytes) / seconds * 1e-9 : 0.0) << '\n';
+    }
+    os.flags(old_flags);
+    os.precision(old_precision);
+}
+
+Profiler* Profiler::current() noexcept {
+    return tl_current_profiler;
+}
+
+Profiler::Scope::Scope(Profiler* profiler) noexcept : previous_(tl_current_profiler) {
+    tl_current_profiler = profiler;
+}
+
+Profiler::Scope::~Scope() {
+    tl_current_profiler = previous_;
+}
+
+} // namespace infer
@@ -2,6 +2,7 @@
 #include "inference_engine/graph/value.h"
 
 #include "inference_engine/core/dtype.h"
+#include "inference_engine/graph/execution_context.h"
 
 #include <algorithm>
 #include <atomic>
@@ -58,6 +59,25 @@ void Value::removeConsumer(Node* consumer) {
 	consumers_.erase(std::remove(consumers_.begin(), consumers_.end(), consumer), consumers_.end());
 }
 
+inference_engine::core::Tensor* Value::tensor() noexcept {
+	if (ExecutionContext* ctx = ExecutionContext::current(); ctx != nullptr && ctx->tracks(this)) {
+		return ctx->binding(this);
+	}
+	return tensor_;
+}
+
+const inference_engine::core::Tensor* Value::tensor() const noexcept {
+	return const_cast<Value*>(this)->tensor();
+}
+
+void Value::setTensor(inference_engine::core::Tensor* tensor) noexcept {
+	if (ExecutionContext* ctx = ExecutionContext::current(); ctx != nullptr && ctx->tracks(this)) {
+		ctx->bind(this, tensor);
+		return;
+	}
+	tensor_ = tensor;
+}
+
 bool Value::hasConsumer(Node* consumer) const noexcept {
 	if (consumer == nullptr) {
 		return false;
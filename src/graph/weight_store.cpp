@@ -0,0 +1,90 @@
+#include "inference_engine/graph/weight_store.h"
+
+#include "inference_engine/graph/packed_weight_cache.h"
+#include "inference_engine/memory/allocator.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <utility>
+
+namespace infer {
+
+using inference_engine::core::Storage;
+
+namespace {
+
+constexpr std::size_t kBlobAlignment = 64;
+
+// Live blob of `entries` with `hash` and the same bytes as `data`, or null.
+template <typename Map>
+std::shared_ptr<const Storage> findBlob(Map& entries, std::uint64_t hash, const void* data, std::size_t bytes) {
+    const auto range = entries.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.bytes != bytes) continue;
+        std::shared_ptr<const Storage> blob = it->second.blob.lock();
+        if (blob && (bytes == 0 || std::memcmp(blob->data(), data, bytes) == 0)) return blob;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+WeightStore& WeightStore::global() {
+    static WeightStore store;
+    return store;
+}
+
+std::shared_ptr<const Storage> WeightStore::intern(const void* data, std::size_t bytes) {
+    const std::uint64_t hash = PackedWeightCache::hashBytes(data, bytes);
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (auto blob = findBlob(entries_, hash, data, bytes)) {
+            ++hits_;
+            return blob;
+        }
+    }
+
+    // Copy outside the lock; each blob owns its allocator, so it may outlive the store.
+    inference_engine::core::AllocatorConfig config;
+    config.alignment = kBlobAlignment;
+    auto allocator = std::make_unique<inference_engine::core::SystemAllocator>(config);
+    void* block = allocator->allocate_aligned(std::max<std::size_t>(bytes, 1), kBlobAlignment);
+    if (block == nullptr) throw std::bad_alloc();
+    if (bytes != 0) std::memcpy(block, data, bytes);
+    std::shared_ptr<const Storage> blob = Storage::adopt(std::move(allocator), block, bytes);
+
+    std::lock_guard<std::mutex> lock(mu_);
+    // Another thread may have interned the same bytes meanwhile.
+    if (auto existing = findBlob(entries_, hash, data, bytes)) {
+        ++hits_;
+        return existing;
+    }
+    ++misses_;
+    if (entries_.size() >= prune_at_) {
+        prune();
+        prune_at_ = std::max<std::size_t>(64, 2 * entries_.size());
+    }
+    entries_.emplace(hash, Entry{blob, bytes});
+    return blob;
+}
+
+WeightStore::Stats WeightStore::stats() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    prune();
+    Stats s;
+    s.blobs = entries_.size();
+    for (const auto& e : entries_) s.bytes += e.second.bytes;
+    s.hits = hits_;
+    s.misses = misses_;
+    return s;
+}
+
+void WeightStore::prune() const {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        it = it->second.blob.expired() ? entries_.erase(it) : std::next(it);
+    }
+}
+
+} // namespace infer
@@ -0,0 +1,24 @@
+#include "inference_engine/kernels/attention.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <stdexcept>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+
+void paged_attention(const PagedAttentionArgs& args) {
+    // Resolved once per process from the host's CPU features.
+    static PagedAttentionFn* const kernel =
+        KernelRegistry::instance().lookup<PagedAttentionFn>("paged_attention", DataType::FP32);
+    if (args.group == 0 || args.group > kMaxAttentionGroup) {
+        throw std::invalid_argument("paged_attention: group must be in [1, kMaxAttentionGroup]");
+    }
+    if (args.block_tokens == 0 || args.block_tokens > kMaxAttentionBlockTokens) {
+        throw std::invalid_argument("paged_attention: block_tokens must be in [1, kMaxAttentionBlockTokens]");
+    }
+    kernel(args);
+}
+
+} // namespace infer
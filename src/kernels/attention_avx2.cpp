@@ -0,0 +1,97 @@
+#include "builtin_kernels.h"
+#include "math_avx2.h"
+#include "paged_attention.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <limits>
+
+namespace infer {
+
+namespace {
+
+using avx2::exp256;
+using avx2::hmax256;
+using avx2::hsum256;
+using avx2::tailMask256;
+
+// Rows are head_dim floats; tails use masked loads, never reading past the row.
+struct Avx2Attention {
+    static float dot(const float* a, const float* b, std::size_t n) {
+        __m256 a0 = _mm256_setzero_ps(), a1 = a0;
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            a0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), a0);
+            a1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), a1);
+        }
+        for (; i + 8 <= n; i += 8) a0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), a0);
+        if (i < n) {
+            const __m256i mask = tailMask256(n - i);
+            a1 = _mm256_fmadd_ps(_mm256_maskload_ps(a + i, mask), _mm256_maskload_ps(b + i, mask), a1);
+        }
+        return hsum256(_mm256_add_ps(a0, a1));
+    }
+
+    static float max(const float* x, std::size_t n) {
+        const __m256 neg_inf = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+        __m256 m = neg_inf;
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) m = _mm256_max_ps(m, _mm256_loadu_ps(x + i));
+        if (i < n) {
+            const __m256i mask = tailMask256(n - i);
+            m = _mm256_max_ps(m, _mm256_blendv_ps(neg_inf, _mm256_maskload_ps(x + i, mask), _mm256_castsi256_ps(mask)));
+        }
+        return hmax256(m);
+    }
+
+    static float expSum(float* x, std::size_t n, float m) {
+        const __m256 vm = _mm256_set1_ps(m);
+        __m256 s = _mm256_setzero_ps();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m256 e = exp256(_mm256_sub_ps(_mm256_loadu_ps(x + i), vm));
+            _mm256_storeu_ps(x + i, e);
+            s = _mm256_add_ps(s, e);
+        }
+        if (i < n) {
+            const __m256i mask = tailMask256(n - i);
+            const __m256 e = _mm256_and_ps(exp256(_mm256_sub_ps(_mm256_maskload_ps(x + i, mask), vm)),
+                                           _mm256_castsi256_ps(mask));
+            _mm256_maskstore_ps(x + i, mask, e);
+            s = _mm256_add_ps(s, e);
+        }
+        return hsum256(s);
+    }
+
+    static void scale(float* y, std::size_t n, float s) {
+        const __m256 vs = _mm256_set1_ps(s);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) _mm256_storeu_ps(y + i, _mm256_mul_ps(_mm256_loadu_ps(y + i), vs));
+        if (i < n) {
+            const __m256i mask = tailMask256(n - i);
+            _mm256_maskstore_ps(y + i, mask, _mm256_mul_ps(_mm256_maskload_ps(y + i, mask), vs));
+        }
+    }
+
+    static void axpy(float* y, const float* x, std::size_t n, float a) {
+        const __m256 va = _mm256_set1_ps(a);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm256_storeu_ps(y + i, _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+        }
+        if (i < n) {
+            const __m256i mask = tailMask256(n - i);
+            _mm256_maskstore_ps(y + i, mask,
+                                _mm256_fmadd_ps(va, _mm256_maskload_ps(x + i, mask), _mm256_maskload_ps(y + i, mask)));
+        }
+    }
+};
+
+} // namespace
+
+void registerAttentionKernelsAvx2(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<PagedAttentionFn>("paged_attention", DataType::FP32, Isa::AVX2, &PagedAttention<Avx2Attention>::run);
+}
+
+} // namespace infer
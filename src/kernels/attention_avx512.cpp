@@ -0,0 +1,87 @@
+#include "builtin_kernels.h"
+#include "math_avx512.h"
+#include "paged_attention.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <limits>
+
+namespace infer {
+
+namespace {
+
+using avx512::exp512;
+using avx512::tailMask512;
+
+// Rows are head_dim floats; tails use masked loads, never reading past the row.
+struct Avx512Attention {
+    static float dot(const float* a, const float* b, std::size_t n) {
+        __m512 acc = _mm512_setzero_ps();
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) acc = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc);
+        if (i < n) {
+            const __mmask16 mask = tailMask512(n - i);
+            acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i), acc);
+        }
+        return _mm512_reduce_add_ps(acc);
+    }
+
+    static float max(const float* x, std::size_t n) {
+        const __m512 neg_inf = _mm512_set1_ps(-std::numeric_limits<float>::infinity());
+        __m512 m = neg_inf;
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) m = _mm512_max_ps(m, _mm512_loadu_ps(x + i));
+        if (i < n) m = _mm512_max_ps(m, _mm512_mask_loadu_ps(neg_inf, tailMask512(n - i), x + i));
+        return _mm512_reduce_max_ps(m);
+    }
+
+    static float expSum(float* x, std::size_t n, float m) {
+        const __m512 vm = _mm512_set1_ps(m);
+        __m512 s = _mm512_setzero_ps();
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            const __m512 e = exp512(_mm512_sub_ps(_mm512_loadu_ps(x + i), vm));
+            _mm512_storeu_ps(x + i, e);
+            s = _mm512_add_ps(s, e);
+        }
+        if (i < n) {
+            const __mmask16 mask = tailMask512(n - i);
+            const __m512 e = _mm512_maskz_mov_ps(mask, exp512(_mm512_sub_ps(_mm512_maskz_loadu_ps(mask, x + i), vm)));
+            _mm512_mask_storeu_ps(x + i, mask, e);
+            s = _mm512_add_ps(s, e);
+        }
+        return _mm512_reduce_add_ps(s);
+    }
+
+    static void scale(float* y, std::size_t n, float s) {
+        const __m512 vs = _mm512_set1_ps(s);
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) _mm512_storeu_ps(y + i, _mm512_mul_ps(_mm512_loadu_ps(y + i), vs));
+        if (i < n) {
+            const __mmask16 mask = tailMask512(n - i);
+            _mm512_mask_storeu_ps(y + i, mask, _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, y + i), vs));
+        }
+    }
+
+    static void axpy(float* y, const float* x, std::size_t n, float a) {
+        const __m512 va = _mm512_set1_ps(a);
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            _mm512_storeu_ps(y + i, _mm512_fmadd_ps(va, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+        }
+        if (i < n) {
+            const __mmask16 mask = tailMask512(n - i);
+            const __m512 vx = _mm512_maskz_loadu_ps(mask, x + i);
+            _mm512_mask_storeu_ps(y + i, mask, _mm512_fmadd_ps(va, vx, _mm512_maskz_loadu_ps(mask, y + i)));
+        }
+    }
+};
+
+} // namespace
+
+void registerAttentionKernelsAvx512(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<PagedAttentionFn>("paged_attention", DataType::FP32, Isa::AVX512, &PagedAttention<Avx512Attention>::run);
+}
+
+} // namespace infer
@@ -0,0 +1,48 @@
+#include "inference_engine/kernels/attention.h"
+
+#include "paged_attention.h"
+
+#include <cmath>
+
+namespace infer {
+
+namespace {
+
+struct ScalarAttention {
+    static float dot(const float* a, const float* b, std::size_t n) {
+        float s = 0.0f;
+        for (std::size_t i = 0; i < n; ++i) s += a[i] * b[i];
+        return s;
+    }
+
+    static float max(const float* x, std::size_t n) {
+        float m = x[0];
+        for (std::size_t i = 1; i < n; ++i) m = std::max(m, x[i]);
+        return m;
+    }
+
+    static float expSum(float* x, std::size_t n, float m) {
+        float s = 0.0f;
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = std::exp(x[i] - m);
+            s += x[i];
+        }
+        return s;
+    }
+
+    static void scale(float* y, std::size_t n, float s) {
+        for (std::size_t i = 0; i < n; ++i) y[i] *= s;
+    }
+
+    static void axpy(float* y, const float* x, std::size_t n, float a) {
+        for (std::size_t i = 0; i < n; ++i) y[i] += a * x[i];
+    }
+};
+
+} // namespace
+
+void paged_attention_scalar(const PagedAttentionArgs& args) {
+    PagedAttention<ScalarAttention>::run(args);
+}
+
+} // namespace infer
@@ -0,0 +1,80 @@
+#pragma once
+
+// Block-quantized weight-only GEMM shared by the per-ISA translation units. Each TU
+// instantiates BlockQGemm<V> with its own vector traits; everything has internal
+// linkage so the differently compiled copies never collide (see gemm_blocked.h).
+
+#include "inference_engine/kernels/linear_blockq.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace infer {
+namespace {
+
+// V must provide, for one kBlockQPanel-column panel row:
+//   using Acc;                                          kBlockQPanel floats
+//   static Acc zero();
+//   template <int Bits> static Acc weights(const std::uint8_t* row);   unscaled q as float
+//   static Acc scales(const std::uint16_t* s);          binary16 -> float
+//   static Acc fmadd(Acc w, float x, Acc acc);          acc + w * x
+//   static Acc fmadd(Acc a, Acc b, Acc acc);            acc + a * b
+//   static void store(float* y, Acc v, const float* bias, std::size_t cols, bool relu);
+// store() adds the bias (null: none), applies ReLU and writes the first `cols` lanes.
+template <typename V>
+struct BlockQGemm {
+    using Acc = typename V::Acc;
+    static constexpr std::size_t NR = kBlockQPanel;
+    static constexpr std::size_t kRows = 4;
+
+    // R rows of one panel. Each group's dot products are summed on the integer
+    // values and scaled once, so the dequantized weight matrix never exists.
+    template <int Bits, std::size_t R>
+    static void rows(const LinearBlockQArgs& a, const std::uint8_t* w, const std::uint16_t* s, std::size_t row0,
+                     const float* bias, std::size_t col, std::size_t cols) {
+        constexpr std::size_t kRowBytes = NR * Bits / 8;
+        Acc total[R];
+        for (std::size_t r = 0; r < R; ++r) total[r] = V::zero();
+        const float* x = a.x + row0 * a.ldx;
+        for (std::size_t g0 = 0; g0 < a.k; g0 += a.group) {
+            Acc part[R];
+            for (std::size_t r = 0; r < R; ++r) part[r] = V::zero();
+            for (std::size_t p = g0; p < g0 + a.group; ++p) {
+                const Acc wv = V::template weights<Bits>(w + p * kRowBytes);
+                for (std::size_t r = 0; r < R; ++r) part[r] = V::fmadd(wv, x[r * a.ldx + p], part[r]);
+            }
+            const Acc sv = V::scales(s + g0 / a.group * NR);
+            for (std::size_t r = 0; r < R; ++r) total[r] = V::fmadd(part[r], sv, total[r]);
+        }
+        const bool relu = a.activation == Activation::ReLU;
+        for (std::size_t r = 0; r < R; ++r) V::store(a.y + (row0 + r) * a.ldy + col, total[r], bias, cols, relu);
+    }
+
+    template <int Bits>
+    static void run(const LinearBlockQArgs& a) {
+        const std::size_t panel_bytes = a.k * NR * Bits / 8;
+        const std::size_t panel_scales = a.k / a.group * NR;
+        for (std::size_t col = 0; col < a.n; col += NR) {
+            const std::size_t cols = std::min(NR, a.n - col);
+            const std::uint8_t* w = a.w + col / NR * panel_bytes;
+            const std::uint16_t* s = a.scales + col / NR * panel_scales;
+            const float* bias = a.bias != nullptr ? a.bias + col : nullptr;
+            std::size_t i = 0;
+            for (; i + kRows <= a.m; i += kRows) rows<Bits, kRows>(a, w, s, i, bias, col, cols);
+            for (; i < a.m; ++i) rows<Bits, 1>(a, w, s, i, bias, col, cols);
+        }
+    }
+
+    static void linear(const LinearBlockQArgs& a) {
+        if (a.m == 0 || a.n == 0) return;
+        if (a.bits == 4) {
+            run<4>(a);
+        } else {
+            run<8>(a);
+        }
+    }
+};
+
+} // namespace
+} // namespace infer
@@ -0,0 +1,91 @@
+#pragma once
+
+// Registration hooks of the built-in kernel translation units. Each ISA TU exports
+// one function per kernel family; registry.cpp calls the ones compiled into this
+// build (IE_KERNELS_AVX2 / IE_KERNELS_AVX512 / IE_KERNELS_AVX512VNNI /
+// IE_KERNELS_NEON / IE_KERNELS_NEON_DOTPROD).
+
+#include "inference_engine/kernels/attention.h"
+#include "inference_engine/kernels/conv.h"
+#include "inference_engine/kernels/convert.h"
+#include "inference_engine/kernels/elementwise.h"
+#include "inference_engine/kernels/quantize.h"
+#include "inference_engine/kernels/reduce.h"
+#include "inference_engine/kernels/strided_copy.h"
+
+namespace infer {
+
+class KernelRegistry;
+
+void registerQuantizeKernelsScalar(KernelRegistry& registry);
+void registerQuantizeKernelsAvx2(KernelRegistry& registry);
+void registerQuantizeKernelsAvx512(KernelRegistry& registry);
+void registerQuantizeKernelsNeon(KernelRegistry& registry);
+
+void registerConvertKernelsScalar(KernelRegistry& registry);
+void registerConvertKernelsAvx2(KernelRegistry& registry);
+void registerConvertKernelsAvx512(KernelRegistry& registry);
+void registerConvertKernelsNeon(KernelRegistry& registry);
+
+void registerTransposeKernelsScalar(KernelRegistry& registry);
+void registerTransposeKernelsAvx2(KernelRegistry& registry);
+void registerTransposeKernelsNeon(KernelRegistry& registry);
+
+void registerElementwiseKernelsScalar(KernelRegistry& registry);
+void registerElementwiseKernelsAvx2(KernelRegistry& registry);
+void registerElementwiseKernelsNeon(KernelRegistry& registry);
+
+void registerReduceKernelsScalar(KernelRegistry& registry);
+void registerReduceKernelsAvx2(KernelRegistry& registry);
+void registerReduceKernelsAvx512(KernelRegistry& registry);
+void registerReduceKernelsNeon(KernelRegistry& registry);
+
+void registerConvKernelsScalar(KernelRegistry& registry);
+void registerConvKernelsAvx2(KernelRegistry& registry);
+void registerConvKernelsAvx512(KernelRegistry& registry);
+
+void registerAttentionKernelsAvx2(KernelRegistry& registry);
+void registerAttentionKernelsAvx512(KernelRegistry& registry);
+
+void registerLinearBlockQKernelsAvx2(KernelRegistry& registry);
+void registerLinearBlockQKernelsAvx512(KernelRegistry& registry);
+
+void registerLinearSparseKernelsAvx2(KernelRegistry& registry);
+void registerLinearSparseKernelsAvx512(KernelRegistry& registry);
+
+void registerLinearInt8KernelsAvx2(KernelRegistry& registry);
+void registerLinearInt8KernelsAvx512Vnni(KernelRegistry& registry);
+void registerLinearInt8KernelsNeonDotprod(KernelRegistry& registry);
+
+// Scalar kernels, also used by the SIMD variants for their tails.
+namespace scalar {
+void quantizeS8(const float* input, std::int8_t* output, std::size_t count, float inv_scale, float zero_point);
+void quantizeU8(const float* input, std::uint8_t* output, std::size_t count, float inv_scale, float zero_point);
+void quantizeS8Channels(const float* input, std::int8_t* output, std::size_t count, const float* inv_scales,
+                        const float* zero_points);
+void quantizeU8Channels(const float* input, std::uint8_t* output, std::size_t count, const float* inv_scales,
+                        const float* zero_points);
+void dequantizeS8(const std::int8_t* input, float* output, std::size_t count, float scale, std::int32_t zero_point);
+void dequantizeU8(const std::uint8_t* input, float* output, std::size_t count, float scale, std::int32_t zero_point);
+void dequantizeS8Channels(const std::int8_t* input, float* output, std::size_t count, const float* scales,
+                          const std::int32_t* zero_points);
+void dequantizeU8Channels(const std::uint8_t* input, float* output, std::size_t count, const float* scales,
+                          const std::int32_t* zero_points);
+void convertFp32ToFp16(const float* input, std::uint16_t* output, std::size_t count);
+void convertFp16ToFp32(const std::uint16_t* input, float* output, std::size_t count);
+// Blocked transpose for any element size (Transpose2dFn contract).
+void transpose2d(const void* src, std::size_t ld_src, void* dst, std::size_t ld_dst, std::size_t rows,
+                 std::size_t cols, std::size_t elem_size);
+void elementwiseUnary(ElementwiseKind kind, const float* x, float* y, std::size_t n);
+void elementwiseBinary(BinaryKind kind, BinaryOperands operands, const float* a, const float* b, float* y,
+                       std::size_t n);
+float reduceSum(const float* x, std::size_t n);
+float reduceMax(const float* x, std::size_t n);
+void reduceMoments(const float* x, std::size_t n, float* mean, float* variance);
+void softmaxRow(const float* x, float* y, std::size_t n);
+void logSoftmaxRow(const float* x, float* y, std::size_t n);
+void layerNormRow(const float* x, float* y, std::size_t n, const float* gamma, const float* beta, float epsilon);
+void rmsNormRow(const float* x, float* y, std::size_t n, const float* gamma, const float* beta, float epsilon);
+} // namespace scalar
+
+} // namespace infer
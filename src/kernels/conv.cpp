@@ -0,0 +1,609 @@
+#include "inference_engine/kernels/conv.h"
+
+#include "inference_engine/kernels/registry.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace infer {
+
+namespace {
+
+using inference_engine::core::DataType;
+
+// Tasks below this many multiply-adds are merged so small layers stay on the
+// calling thread.
+constexpr std::size_t kTaskMacs = std::size_t{1} << 16;
+// Output pixels per im2col task and Winograd tiles per task: the unfolded patch
+// matrix and the transformed tiles of one task stay in L2.
+constexpr std::size_t kIm2colCols = 256;
+constexpr std::size_t kWinogradTiles = 64;
+
+std::size_t ceilDiv(std::size_t a, std::size_t b) {
+    return (a + b - 1) / b;
+}
+
+std::size_t grainFor(std::size_t macs_per_task) {
+    return std::max<std::size_t>(1, kTaskMacs / std::max<std::size_t>(1, macs_per_task));
+}
+
+float activate(float v, Activation act) {
+    return act == Activation::ReLU && v < 0.0f ? 0.0f : v;
+}
+
+struct NchwcKernel {
+    ConvNchwcRowFn* fn = nullptr;
+    std::size_t block = 0;
+};
+
+// The row kernel and its block come from the same ISA (see linear_packed).
+const NchwcKernel& nchwcKernel() {
+    static const NchwcKernel kernel = [] {
+        const KernelRegistry& registry = KernelRegistry::instance();
+        const KernelEntry* run = registry.select("conv2d_nchwc", DataType::FP32);
+        const KernelEntry* block =
+            run != nullptr ? registry.select("conv2d_nchwc_block", DataType::FP32, run->isa) : nullptr;
+        if (block == nullptr || block->isa != run->isa) {
+            throw std::runtime_error("conv2d: no NCHWc kernel registered for the host");
+        }
+        return NchwcKernel{reinterpret_cast<ConvNchwcRowFn*>(run->fn), reinterpret_cast<ConvBlockFn*>(block->fn)()};
+    }();
+    return kernel;
+}
+
+ConvDepthwiseRowFn* depthwiseKernel() {
+    static ConvDepthwiseRowFn* const fn =
+        KernelRegistry::instance().lookup<ConvDepthwiseRowFn>("conv2d_depthwise_row", DataType::FP32);
+    return fn;
+}
+
+bool validShape(const Conv2dShape& s) noexcept {
+    return s.groups > 0 && s.in_channels > 0 && s.out_channels > 0 && s.in_channels % s.groups == 0 &&
+           s.out_channels % s.groups == 0 && s.out_h() > 0 && s.out_w() > 0;
+}
+
+bool winogradShape(const Conv2dShape& s) noexcept {
+    return s.groups == 1 && s.kernel_h == 3 && s.kernel_w == 3 && s.stride_h == 1 && s.stride_w == 1 &&
+           s.dilation_h == 1 && s.dilation_w == 1;
+}
+
+// ---- im2col + SGEMM --------------------------------------------------------------
+
+// Columns [p0, p0 + cols) of the patch matrix of one group: row (c, kh, kw) holds
+// the input pixel each output pixel reads through that tap (0 in the padding).
+void im2col(const Conv2dShape& s, const float* x, std::size_t p0, std::size_t cols, float* col) {
+    const std::size_t ow = s.out_w();
+    const std::size_t channels = s.in_channels / s.groups;
+    for (std::size_t c = 0; c < channels; ++c) {
+        const float* xc = x + c * s.in_h * s.in_w;
+        for (std::size_t kh = 0; kh < s.kernel_h; ++kh) {
+            for (std::size_t kw = 0; kw < s.kernel_w; ++kw, col += cols) {
+                std::size_t oy = p0 / ow, ox = p0 % ow;
+                for (std::size_t j = 0; j < cols; ++j) {
+                    const auto iy = static_cast<std::ptrdiff_t>(oy * s.stride_h + kh * s.dilation_h) -
+                                    static_cast<std::ptrdiff_t>(s.pad_top);
+                    const auto ix = static_cast<std::ptrdiff_t>(ox * s.stride_w + kw * s.dilation_w) -
+                                    static_cast<std::ptrdiff_t>(s.pad_left);
+                    const bool inside = iy >= 0 && ix >= 0 && iy < static_cast<std::ptrdiff_t>(s.in_h) &&
+                                        ix < static_cast<std::ptrdiff_t>(s.in_w);
+                    col[j] = inside ? xc[static_cast<std::size_t>(iy) * s.in_w + static_cast<std::size_t>(ix)] : 0.0f;
+                    if (++ox == ow) {
+                        ox = 0;
+                        ++oy;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// y_g[oc, p] = w_g[oc, :] . col[:, p] per group, one task per (image, group, column
+// range). Pointwise stride-1 layers use the input itself as the patch matrix.
+void conv2dIm2col(const Conv2dArgs& a) {
+    const Conv2dShape& s = a.shape;
+    const std::size_t pixels = s.out_h() * s.out_w();
+    const std::size_t in_ch = s.in_channels / s.groups;
+    const std::size_t out_ch = s.out_channels / s.groups;
+    const std::size_t k = in_ch * s.kernel_h * s.kernel_w;
+    const bool pointwise = s.kernel_h == 1 && s.kernel_w == 1 && s.stride_h == 1 && s.stride_w == 1 &&
+                           s.pad_top + s.pad_left + s.pad_bottom + s.pad_right == 0;
+    const std::size_t col_tiles = ceilDiv(pixels, kIm2colCols);
+    const std::size_t tasks = s.batch * s.groups * col_tiles;
+    const std::size_t grain = grainFor(out_ch * k * std::min(pixels, kIm2colCols));
+
+    parallelFor(0, tasks, grain, [&](std::size_t begin, std::size_t end) {
+        thread_local std::vector<float> col;
+        for (std::size_t t = begin; t < end; ++t) {
+            const std::size_t n = t / (s.groups * col_tiles);
+            const std::size_t g = t / col_tiles % s.groups;
+            const std::size_t p0 = t % col_tiles * kIm2colCols;
+            const std::size_t cols = std::min(kIm2colCols, pixels - p0);
+            const float* xg = a.x + (n * s.in_channels + g * in_ch) * s.in_h * s.in_w;
+            float* yg = a.y + (n * s.out_channels + g * out_ch) * pixels;
+
+            LinearArgs args;
+            args.x = a.w + g * out_ch * k;
+            args.ldx = k;
+            if (pointwise) {
+                args.w = xg + p0;
+                args.ldw = pixels;
+            } else {
+                if (col.size() < k * cols) col.resize(k * cols);
+                im2col(s, xg, p0, cols, col.data());
+                args.w = col.data();
+                args.ldw = cols;
+            }
+            args.y = yg + p0;
+            args.ldy = pixels;
+            args.m = out_ch;
+            args.k = k;
+            args.n = cols;
+            linear(args);
+
+            // The bias is per output row, so it is added here rather than by the GEMM.
+            if (a.bias == nullptr && a.activation == Activation::None) continue;
+            for (std::size_t oc = 0; oc < out_ch; ++oc) {
+                const float b = a.bias != nullptr ? a.bias[g * out_ch + oc] : 0.0f;
+                float* row = yg + oc * pixels + p0;
+                for (std::size_t j = 0; j < cols; ++j) row[j] = activate(row[j] + b, a.activation);
+            }
+        }
+    });
+}
+
+// ---- direct NCHWc ----------------------------------------------------------------
+
+void packDirect(const Conv2dShape& s, const float* w, float* dst) {
+    const std::size_t block = conv_channel_block();
+    const std::size_t taps = s.kernel_h * s.kernel_w;
+    const std::size_t in_blocks = ceilDiv(s.in_channels, block);
+    const std::size_t out_blocks = ceilDiv(s.out_channels, block);
+    for (std::size_t ob = 0; ob < out_blocks; ++ob) {
+        for (std::size_t ib = 0; ib < in_blocks; ++ib) {
+            for (std::size_t tap = 0; tap < taps; ++tap) {
+                for (std::size_t i = 0; i < block; ++i) {
+                    for (std::size_t o = 0; o < block; ++o, ++dst) {
+                        const std::size_t oc = ob * block + o;
+                        const std::size_t ic = ib * block + i;
+                        const bool real = oc < s.out_channels && ic < s.in_channels;
+                        *dst = real ? w[(oc * s.in_channels + ic) * taps + tap] : 0.0f;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// One task per output row of one output-channel block.
+void conv2dDirect(const Conv2dArgs& a) {
+    const Conv2dShape& s = a.shape;
+    const NchwcKernel& kernel = nchwcKernel();
+    const std::size_t block = kernel.block;
+    const std::size_t in_blocks = ceilDiv(s.in_channels, block);
+    const std::size_t out_blocks = ceilDiv(s.out_channels, block);
+    const std::size_t oh = s.out_h(), ow = s.out_w();
+    const std::size_t rows = s.batch * out_blocks * oh;
+    const std::size_t row_macs = ow * in_blocks * block * block * s.kernel_h * s.kernel_w;
+
+    parallelFor(0, rows, grainFor(row_macs), [&](std::size_t begin, std::size_t end) {
+        ConvNchwcRowArgs args;
+        args.in_blocks = in_blocks;
+        args.in_h = s.in_h;
+        args.in_w = s.in_w;
+        args.kernel_h = s.kernel_h;
+        args.kernel_w = s.kernel_w;
+        args.stride_h = s.stride_h;
+        args.stride_w = s.stride_w;
+        args.dilation_h = s.dilation_h;
+        args.dilation_w = s.dilation_w;
+        args.pad_top = s.pad_top;
+        args.pad_left = s.pad_left;
+        args.out_w = ow;
+        args.activation = a.activation;
+        for (std::size_t r = begin; r < end; ++r) {
+            const std::size_t n = r / (out_blocks * oh);
+            const std::size_t ob = r / oh % out_blocks;
+            args.oh = r % oh;
+            args.x = a.x + n * in_blocks * s.in_h * s.in_w * block;
+            args.w = a.w + ob * in_blocks * s.kernel_h * s.kernel_w * block * block;
+            args.bias = a.bias != nullptr ? a.bias + ob * block : nullptr;
+            args.bias_count = std::min(block, s.out_channels - ob * block);
+            args.y = a.y + r * ow * block;
+            kernel.fn(args);
+        }
+    });
+}
+
+// ---- Winograd F(m x m, 3 x 3) ----------------------------------------------------
+
+// Transform matrices of Lavin & Gray, "Fast Algorithms for Convolutional Neural
+// Networks": Y = AT [(G g GT) . (BT d B)] A over alpha x alpha input tiles.
+template <std::size_t M>
+struct Winograd;
+
+template <>
+struct Winograd<2> {
+    static constexpr std::size_t kAlpha = 4;
+    static constexpr float kBT[4][4] = {{1, 0, -1, 0}, {0, 1, 1, 0}, {0, -1, 1, 0}, {0, 1, 0, -1}};
+    static constexpr float kG[4][3] = {{1, 0, 0}, {0.5f, 0.5f, 0.5f}, {0.5f, -0.5f, 0.5f}, {0, 0, 1}};
+    static constexpr float kAT[2][4] = {{1, 1, 1, 0}, {0, 1, -1, -1}};
+};
+
+template <>
+struct Winograd<4> {
+    static constexpr std::size_t kAlpha = 6;
+    static constexpr float kBT[6][6] = {{4, 0, -5, 0, 1, 0},  {0, -4, -4, 1, 1, 0}, {0, 4, -4, -1, 1, 0},
+                                        {0, -2, -1, 2, 1, 0}, {0, 2, -1, -2, 1, 0}, {0, 4, 0, -5, 0, 1}};
+    static constexpr float kG[6][3] = {{1.0f / 4, 0, 0},
+                                       {-1.0f / 6, -1.0f / 6, -1.0f / 6},
+                                       {-1.0f / 6, 1.0f / 6, -1.0f / 6},
+                                       {1.0f / 24, 1.0f / 12, 1.0f / 6},
+                                       {1.0f / 24, -1.0f / 12, 1.0f / 6},
+                                       {0, 0, 1}};
+    static constexpr float kAT[4][6] = {
+        {1, 1, 1, 1, 1, 0}, {0, 1, -1, 2, -2, 0}, {0, 1, 1, 4, 4, 0}, {0, 1, -1, 8, -8, 1}};
+};
+
+// U[xi][oc][ic] = (G g GT)[xi] for every 3 x 3 filter g.
+template <std::size_t M>
+void packWinograd(const Conv2dShape& s, const float* w, float* dst) {
+    using W = Winograd<M>;
+    constexpr std::size_t A = W::kAlpha;
+    const std::size_t plane = s.out_channels * s.in_channels;
+    for (std::size_t oc = 0; oc < s.out_channels; ++oc) {
+        for (std::size_t ic = 0; ic < s.in_channels; ++ic) {
+            const float* g = w + (oc * s.in_channels + ic) * 9;
+            float gg[A][3] = {};
+            for (std::size_t i = 0; i < A; ++i) {
+                for (std::size_t j = 0; j < 3; ++j) {
+                    for (std::size_t k = 0; k < 3; ++k) gg[i][j] += W::kG[i][k] * g[k * 3 + j];
+                }
+            }
+            for (std::size_t i = 0; i < A; ++i) {
+                for (std::size_t j = 0; j < A; ++j) {
+                    float u = 0.0f;
+                    for (std::size_t k = 0; k < 3; ++k) u += gg[i][k] * W::kG[j][k];
+                    dst[(i * A + j) * plane + oc * s.in_channels + ic] = u;
+                }
+            }
+        }
+    }
+}
+
+// Per task: transform up to kWinogradTiles input tiles of one image, multiply them
+// by U as alpha^2 SGEMMs ([out, in] x [in, tiles]), then transform back, adding the
+// bias and activation on the way out.
+template <std::size_t M>
+void conv2dWinograd(const Conv2dArgs& a) {
+    using W = Winograd<M>;
+    constexpr std::size_t A = W::kAlpha;
+    const Conv2dShape& s = a.shape;
+    const std::size_t oh = s.out_h(), ow = s.out_w();
+    const std::size_t tiles_w = ceilDiv(ow, M);
+    const std::size_t tiles = ceilDiv(oh, M) * tiles_w;
+    const std::size_t chunks = ceilDiv(tiles, kWinogradTiles);
+    const std::size_t ic_n = s.in_channels, oc_n = s.out_channels;
+
+    parallelFor(0, s.batch * chunks, grainFor(A * A * oc_n * ic_n * std::min(tiles, kWinogradTiles)),
+                [&](std::size_t begin, std::size_t end) {
+        thread_local std::vector<float> v_buf, m_buf;
+        for (std::size_t t = begin; t < end; ++t) {
+            const std::size_t n = t / chunks;
+            const std::size_t t0 = t % chunks * kWinogradTiles;
+            const std::size_t tc = std::min(kWinogradTiles, tiles - t0);
+            if (v_buf.size() < A * A * ic_n * tc) v_buf.resize(A * A * ic_n * tc);
+            if (m_buf.size() < A * A * oc_n * tc) m_buf.resize(A * A * oc_n * tc);
+
+            for (std::size_t ic = 0; ic < ic_n; ++ic) {
+                const float* xc = a.x + (n * ic_n + ic) * s.in_h * s.in_w;
+                for (std::size_t j = 0; j < tc; ++j) {
+                    const std::size_t ty = (t0 + j) / tiles_w, tx = (t0 + j) % tiles_w;
+                    const auto y0 = static_cast<std::ptrdiff_t>(ty * M) - static_cast<std::ptrdiff_t>(s.pad_top);
+                    const auto x0 = static_cast<std::ptrdiff_t>(tx * M) - static_cast<std::ptrdiff_t>(s.pad_left);
+                    float d[A][A];
+                    for (std::size_t r = 0; r < A; ++r) {
+                        const std::ptrdiff_t iy = y0 + static_cast<std::ptrdiff_t>(r);
+                        for (std::size_t c = 0; c < A; ++c) {
+                            const std::ptrdiff_t ix = x0 + static_cast<std::ptrdiff_t>(c);
+                            const bool inside = iy >= 0 && ix >= 0 && iy < static_cast<std::ptrdiff_t>(s.in_h) &&
+                                                ix < static_cast<std::ptrdiff_t>(s.in_w);
+                            d[r][c] = inside ? xc[static_cast<std::size_t>(iy) * s.in_w + static_cast<std::size_t>(ix)]
+                                             : 0.0f;
+                        }
+                    }
+                    float bd[A][A] = {};
+                    for (std::size_t r = 0; r < A; ++r) {
+                        for (std::size_t k = 0; k < A; ++k) {
+                            if (W::kBT[r][k] == 0.0f) continue;
+                            for (std::size_t c = 0; c < A; ++c) bd[r][c] += W::kBT[r][k] * d[k][c];
+                        }
+                    }
+                    for (std::size_t r = 0; r < A; ++r) {
+                        for (std::size_t c = 0; c < A; ++c) {
+                            float v = 0.0f;
+                            for (std::size_t k = 0; k < A; ++k) v += bd[r][k] * W::kBT[c][k];
+                            v_buf[((r * A + c) * ic_n + ic) * tc + j] = v;
+                        }
+                    }
+                }
+            }
+
+            for (std::size_t xi = 0; xi < A * A; ++xi) {
+                LinearArgs args;
+                args.x = a.w + xi * oc_n * ic_n;
+                args.ldx = ic_n;
+                args.w = v_buf.data() + xi * ic_n * tc;
+                args.ldw = tc;
+                args.y = m_buf.data() + xi * oc_n * tc;
+                args.ldy = tc;
+                args.m = oc_n;
+                args.k = ic_n;
+                args.n = tc;
+                linear(args);
+            }
+
+            for (std::size_t oc = 0; oc < oc_n; ++oc) {
+                const float b = a.bias != nullptr ? a.bias[oc] : 0.0f;
+                float* yc = a.y + (n * oc_n + oc) * oh * ow;
+                for (std::size_t j = 0; j < tc; ++j) {
+                    float am[M][A] = {};
+                    for (std::size_t r = 0; r < M; ++r) {
+                        for (std::size_t k = 0; k < A; ++k) {
+                            if (W::kAT[r][k] == 0.0f) continue;
+                            for (std::size_t c = 0; c < A; ++c) {
+                                am[r][c] += W::kAT[r][k] * m_buf[((k * A + c) * oc_n + oc) * tc + j];
+                            }
+                        }
+                    }
+                    const std::size_t ty = (t0 + j) / tiles_w, tx = (t0 + j) % tiles_w;
+                    for (std::size_t r = 0; r < M && ty * M + r < oh; ++r) {
+                        for (std::size_t c = 0; c < M && tx * M + c < ow; ++c) {
+                            float v = b;
+                            for (std::size_t k = 0; k < A; ++k) v += am[r][k] * W::kAT[c][k];
+                            yc[(ty * M + r) * ow + tx * M + c] = activate(v, a.activation);
+                        }
+                    }
+                }
+            }
+        }
+    });
+}
+
+// ---- depthwise -------------------------------------------------------------------
+
+void conv2dDepthwise(const Conv2dArgs& a) {
+    const Conv2dShape& s = a.shape;
+    ConvDepthwiseRowFn* const kernel = depthwiseKernel();
+    const std::size_t oh = s.out_h(), ow = s.out_w();
+    const std::size_t channels = s.in_channels;
+    const std::size_t grain = grainFor(ow * s.kernel_h * s.kernel_w);
+    parallelFor(0, s.batch * channels * oh, grain, [&](std::size_t begin, std::size_t end) {
+        ConvDepthwiseRowArgs args;
+        args.in_h = s.in_h;
+        args.in_w = s.in_w;
+        args.kernel_h = s.kernel_h;
+        args.kernel_w = s.kernel_w;
+        args.stride_h = s.stride_h;
+        args.stride_w = s.stride_w;
+        args.dilation_h = s.dilation_h;
+        args.dilation_w = s.dilation_w;
+        args.pad_top = s.pad_top;
+        args.pad_left = s.pad_left;
+        args.out_w = ow;
+        args.activation = a.activation;
+        for (std::size_t r = begin; r < end; ++r) {
+            const std::size_t plane = r / oh; // n * channels + c
+            const std::size_t c = plane % channels;
+            args.oh = r % oh;
+            args.x = a.x + plane * s.in_h * s.in_w;
+            args.w = a.w + c * s.kernel_h * s.kernel_w;
+            args.bias = a.bias != nullptr ? a.bias[c] : 0.0f;
+            args.y = a.y + r * ow;
+            kernel(args);
+        }
+    });
+}
+
+// ---- autotuning ------------------------------------------------------------------
+
+std::vector<float> randomData(std::size_t n, std::mt19937& rng) {
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> v(std::max<std::size_t>(1, n));
+    for (float& x : v) x = dist(rng);
+    return v;
+}
+
+// Best of two timed runs after a warm-up, in seconds.
+double timeAlgorithm(ConvAlgorithm algorithm, const Conv2dShape& s) {
+    std::mt19937 rng(7);
+    const bool blocked = algorithm == ConvAlgorithm::DirectNchwc;
+    const std::size_t block = blocked ? conv_channel_block() : 1;
+    const std::size_t in_c = blocked ? ceilDiv(s.in_channels, block) * block : s.in_channels;
+    const std::size_t out_c = blocked ? ceilDiv(s.out_channels, block) * block : s.out_channels;
+    const auto x = randomData(s.batch * in_c * s.in_h * s.in_w, rng);
+    const auto w = randomData(s.out_channels * (s.in_channels / s.groups) * s.kernel_h * s.kernel_w, rng);
+    const auto bias = randomData(out_c, rng);
+    std::vector<float> packed(packed_conv_weights_size(algorithm, s));
+    if (!packed.empty()) pack_conv_weights(algorithm, s, w.data(), packed.data());
+    std::vector<float> y(std::max<std::size_t>(1, s.batch * out_c * s.out_h() * s.out_w()));
+
+    Conv2dArgs args;
+    args.x = x.data();
+    args.w = packed.empty() ? w.data() : packed.data();
+    args.bias = bias.data();
+    args.y = y.data();
+    args.shape = s;
+    args.algorithm = algorithm;
+    conv2d(args);
+    double best = 0.0;
+    for (int run = 0; run < 2; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        conv2d(args);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        best = run == 0 ? seconds : std::min(best, seconds);
+    }
+    return best;
+}
+
+} // namespace
+
+const char* conv_algorithm_name(ConvAlgorithm algorithm) noexcept {
+    switch (algorithm) {
+        case ConvAlgorithm::Auto: return "auto";
+        case ConvAlgorithm::Im2colGemm: return "im2col_gemm";
+        case ConvAlgorithm::DirectNchwc: return "direct_nchwc";
+        case ConvAlgorithm::WinogradF2x3: return "winograd_f2x3";
+        case ConvAlgorithm::WinogradF4x3: return "winograd_f4x3";
+        case ConvAlgorithm::Depthwise: return "depthwise";
+    }
+    return "unknown";
+}
+
+bool conv_algorithm_supports(ConvAlgorithm algorithm, const Conv2dShape& shape) noexcept {
+    if (!validShape(shape)) return false;
+    switch (algorithm) {
+        case ConvAlgorithm::Auto: return false;
+        case ConvAlgorithm::Im2colGemm: return true;
+        case ConvAlgorithm::DirectNchwc: return shape.groups == 1;
+        case ConvAlgorithm::WinogradF2x3:
+        case ConvAlgorithm::WinogradF4x3: return winogradShape(shape);
+        case ConvAlgorithm::Depthwise: return shape.depthwise();
+    }
+    return false;
+}
+
+ConvAlgorithm select_conv_algorithm(const Conv2dShape& s, bool allow_blocked) {
+    if (!validShape(s)) return ConvAlgorithm::Im2colGemm;
+    if (s.depthwise()) return ConvAlgorithm::Depthwise;
+    if (s.groups != 1) return ConvAlgorithm::Im2colGemm;
+    const bool pointwise = s.kernel_h == 1 && s.kernel_w == 1 && s.stride_h == 1 && s.stride_w == 1 &&
+                           s.pad_top + s.pad_left + s.pad_bottom + s.pad_right == 0;
+    if (pointwise) return ConvAlgorithm::Im2colGemm;
+    // Winograd pays off once the channel GEMMs are large enough to hide the transforms.
+    if (winogradShape(s) && s.in_channels >= 16 && s.out_channels >= 16) {
+        if (s.out_h() >= 16 && s.out_w() >= 16) return ConvAlgorithm::WinogradF4x3;
+        if (s.out_h() >= 4 && s.out_w() >= 4) return ConvAlgorithm::WinogradF2x3;
+    }
+    if (allow_blocked && s.out_channels >= conv_channel_block()) return ConvAlgorithm::DirectNchwc;
+    return ConvAlgorithm::Im2colGemm;
+}
+
+ConvAlgorithm autotune_conv_algorithm(const Conv2dShape& shape, bool allow_blocked) {
+    static std::mutex mu;
+    static std::map<std::array<std::size_t, 17>, ConvAlgorithm> cache;
+    // The batch hardly changes the ranking; one image keeps the measurement cheap.
+    Conv2dShape s = shape;
+    s.batch = 1;
+    const std::array<std::size_t, 17> key = {s.in_channels, s.in_h,       s.in_w,       s.out_channels, s.kernel_h,
+                                             s.kernel_w,    s.stride_h,   s.stride_w,   s.pad_top,      s.pad_left,
+                                             s.pad_bottom,  s.pad_right,  s.dilation_h, s.dilation_w,   s.groups,
+                                             static_cast<std::size_t>(allow_blocked), 0};
+    std::lock_guard<std::mutex> lock(mu);
+    const auto it = cache.find(key);
+    if (it != cache.end()) return it->second;
+
+    ConvAlgorithm best = select_conv_algorithm(s, allow_blocked);
+    if (validShape(s)) {
+        double best_time = timeAlgorithm(best, s);
+        for (ConvAlgorithm candidate : {ConvAlgorithm::Im2colGemm, ConvAlgorithm::DirectNchwc,
+                                        ConvAlgorithm::WinogradF2x3, ConvAlgorithm::WinogradF4x3,
+                                        ConvAlgorithm::Depthwise}) {
+            if (candidate == best || !conv_algorithm_supports(candidate, s)) continue;
+            if (candidate == ConvAlgorithm::DirectNchwc && !allow_blocked) continue;
+            const double t = timeAlgorithm(candidate, s);
+            if (t < best_time) {
+                best_time = t;
+                best = candidate;
+            }
+        }
+    }
+    cache.emplace(key, best);
+    return best;
+}
+
+std::size_t conv_channel_block() {
+    return nchwcKernel().block;
+}
+
+std::size_t packed_conv_weights_size(ConvAlgorithm algorithm, const Conv2dShape& s) {
+    switch (algorithm) {
+        case ConvAlgorithm::DirectNchwc: {
+            const std::size_t block = conv_channel_block();
+            return ceilDiv(s.out_channels, block) * ceilDiv(s.in_channels, block) * s.kernel_h * s.kernel_w * block *
+                   block;
+        }
+        case ConvAlgorithm::WinogradF2x3: return 16 * s.out_channels * s.in_channels;
+        case ConvAlgorithm::WinogradF4x3: return 36 * s.out_channels * s.in_channels;
+        default: return 0;
+    }
+}
+
+void pack_conv_weights(ConvAlgorithm algorithm, const Conv2dShape& s, const float* w, float* dst) {
+    if (!conv_algorithm_supports(algorithm, s)) {
+        throw std::invalid_argument(std::string("pack_conv_weights: ") + conv_algorithm_name(algorithm) +
+                                    " cannot compute this convolution");
+    }
+    switch (algorithm) {
+        case ConvAlgorithm::DirectNchwc: packDirect(s, w, dst); break;
+        case ConvAlgorithm::WinogradF2x3: packWinograd<2>(s, w, dst); break;
+        case ConvAlgorithm::WinogradF4x3: packWinograd<4>(s, w, dst); break;
+        default: break;
+    }
+}
+
+void conv2d(const Conv2dArgs& args) {
+    if (!conv_algorithm_supports(args.algorithm, args.shape)) {
+        throw std::invalid_argument(std::string("conv2d: ") + conv_algorithm_name(args.algorithm) +
+                                    " cannot compute this convolution");
+    }
+    if (args.shape.batch == 0) return;
+    switch (args.algorithm) {
+        case ConvAlgorithm::Im2colGemm: conv2dIm2col(args); break;
+        case ConvAlgorithm::DirectNchwc: conv2dDirect(args); break;
+        case ConvAlgorithm::WinogradF2x3: conv2dWinograd<2>(args); break;
+        case ConvAlgorithm::WinogradF4x3: conv2dWinograd<4>(args); break;
+        case ConvAlgorithm::Depthwise: conv2dDepthwise(args); break;
+        case ConvAlgorithm::Auto: break;
+    }
+}
+
+void nchw_to_nchwc(const float* x, float* y, std::size_t batch, std::size_t channels, std::size_t spatial,
+                   std::size_t block) {
+    const std::size_t blocks = ceilDiv(channels, block);
+    parallelFor(0, batch * blocks, grainFor(spatial * block), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t t = begin; t < end; ++t) {
+            const std::size_t n = t / blocks, cb = t % blocks;
+            float* dst = y + t * spatial * block;
+            for (std::size_t l = 0; l < block; ++l) {
+                const std::size_t c = cb * block + l;
+                const float* src = c < channels ? x + (n * channels + c) * spatial : nullptr;
+                for (std::size_t p = 0; p < spatial; ++p) dst[p * block + l] = src != nullptr ? src[p] : 0.0f;
+            }
+        }
+    });
+}
+
+void nchwc_to_nchw(const float* x, float* y, std::size_t batch, std::size_t channels, std::size_t spatial,
+                   std::size_t block) {
+    const std::size_t blocks = ceilDiv(channels, block);
+    parallelFor(0, batch * blocks, grainFor(spatial * block), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t t = begin; t < end; ++t) {
+            const std::size_t n = t / blocks, cb = t % blocks;
+            const float* src = x + t * spatial * block;
+            for (std::size_t l = 0; l < block && cb * block + l < channels; ++l) {
+                float* dst = y + (n * channels + cb * block + l) * spatial;
+                for (std::size_t p = 0; p < spatial; ++p) dst[p] = src[p * block + l];
+            }
+        }
+    });
+}
+
+} // namespace infer
@@ -0,0 +1,44 @@
+#include "builtin_kernels.h"
+#include "conv_nchwc.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <immintrin.h>
+
+#if !defined(__AVX2__) || !defined(__FMA__)
+#error "conv_avx2.cpp must be compiled with AVX2 and FMA enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+// NCHW8c: one ymm per output pixel. Six pixels keep six accumulators, the weight
+// vector and a broadcast in registers.
+struct Avx2Lanes {
+    static constexpr std::size_t kLanes = 8;
+    static constexpr std::size_t kRows = 6;
+    using Reg = __m256;
+
+    static Reg load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, Reg r) { _mm256_storeu_ps(p, r); }
+    static Reg zero() { return _mm256_setzero_ps(); }
+    static Reg broadcast(float s) { return _mm256_set1_ps(s); }
+    static Reg fmadd(Reg a, Reg b, Reg c) { return _mm256_fmadd_ps(a, b, c); }
+    static Reg relu(Reg a) { return _mm256_max_ps(a, _mm256_setzero_ps()); }
+};
+
+std::size_t blockAvx2() {
+    return Avx2Lanes::kLanes;
+}
+
+} // namespace
+
+void registerConvKernelsAvx2(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ConvNchwcRowFn>("conv2d_nchwc", DataType::FP32, Isa::AVX2, &ConvRows<Avx2Lanes>::nchwcRow);
+    r.add<ConvBlockFn>("conv2d_nchwc_block", DataType::FP32, Isa::AVX2, &blockAvx2);
+    r.add<ConvDepthwiseRowFn>("conv2d_depthwise_row", DataType::FP32, Isa::AVX2, &ConvRows<Avx2Lanes>::depthwiseRow);
+}
+
+} // namespace infer
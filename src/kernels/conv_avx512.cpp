@@ -0,0 +1,45 @@
+#include "builtin_kernels.h"
+#include "conv_nchwc.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <immintrin.h>
+
+#if !defined(__AVX512F__)
+#error "conv_avx512.cpp must be compiled with AVX-512F enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+// NCHW16c: one zmm per output pixel, twelve pixels per register block out of 32
+// architectural registers.
+struct Avx512Lanes {
+    static constexpr std::size_t kLanes = 16;
+    static constexpr std::size_t kRows = 12;
+    using Reg = __m512;
+
+    static Reg load(const float* p) { return _mm512_loadu_ps(p); }
+    static void store(float* p, Reg r) { _mm512_storeu_ps(p, r); }
+    static Reg zero() { return _mm512_setzero_ps(); }
+    static Reg broadcast(float s) { return _mm512_set1_ps(s); }
+    static Reg fmadd(Reg a, Reg b, Reg c) { return _mm512_fmadd_ps(a, b, c); }
+    static Reg relu(Reg a) { return _mm512_max_ps(a, _mm512_setzero_ps()); }
+};
+
+std::size_t blockAvx512() {
+    return Avx512Lanes::kLanes;
+}
+
+} // namespace
+
+void registerConvKernelsAvx512(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ConvNchwcRowFn>("conv2d_nchwc", DataType::FP32, Isa::AVX512, &ConvRows<Avx512Lanes>::nchwcRow);
+    r.add<ConvBlockFn>("conv2d_nchwc_block", DataType::FP32, Isa::AVX512, &blockAvx512);
+    r.add<ConvDepthwiseRowFn>("conv2d_depthwise_row", DataType::FP32, Isa::AVX512,
+                              &ConvRows<Avx512Lanes>::depthwiseRow);
+}
+
+} // namespace infer
@@ -0,0 +1,147 @@
+#pragma once
+
+// Direct-convolution row kernels shared by the per-ISA translation units.
+//
+// Each ISA TU includes this header and instantiates the templates with its own
+// vector traits. Everything here has internal linkage so the differently compiled
+// copies never collide under the one-definition rule (see gemm_blocked.h).
+
+#include "inference_engine/kernels/conv.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace infer {
+namespace {
+
+// V must provide:
+//   static constexpr std::size_t kLanes;  channel block of the NCHWc layout
+//   static constexpr std::size_t kRows;   output pixels per register block
+//   using Reg;                            kLanes floats
+//   static Reg zero(), load(const float*), broadcast(float), fmadd(Reg a, Reg b, Reg c) (a * b + c),
+//              relu(Reg); static void store(float*, Reg)
+// load() and store() take unaligned pointers.
+template <typename V>
+struct ConvRows {
+    using Reg = typename V::Reg;
+    static constexpr std::size_t B = V::kLanes;
+
+    // Offset of input pixel (ih, iw) of input block 0.
+    static std::size_t pixel(const ConvNchwcRowArgs& a, std::ptrdiff_t ih, std::ptrdiff_t iw) {
+        return (static_cast<std::size_t>(ih) * a.in_w + static_cast<std::size_t>(iw)) * B;
+    }
+
+    // R output pixels starting at ow0 of one output-channel block. The input column
+    // of every pixel is checked only when some tap of the block falls in the padding.
+    template <std::size_t R>
+    static void nchwcBlock(const ConvNchwcRowArgs& a, const float* bias_block, std::size_t ow0) {
+        Reg acc[R];
+        const Reg vb = V::load(bias_block);
+        for (std::size_t r = 0; r < R; ++r) acc[r] = vb;
+
+        const auto ih0 = static_cast<std::ptrdiff_t>(a.oh * a.stride_h) - static_cast<std::ptrdiff_t>(a.pad_top);
+        const auto in_h = static_cast<std::ptrdiff_t>(a.in_h);
+        const auto in_w = static_cast<std::ptrdiff_t>(a.in_w);
+        const auto sw = static_cast<std::ptrdiff_t>(a.stride_w);
+        const auto pad_left = static_cast<std::ptrdiff_t>(a.pad_left);
+        const std::size_t plane = a.in_h * a.in_w * B;
+        for (std::size_t kh = 0; kh < a.kernel_h; ++kh) {
+            const std::ptrdiff_t ih = ih0 + static_cast<std::ptrdiff_t>(kh * a.dilation_h);
+            if (ih < 0 || ih >= in_h) continue;
+            for (std::size_t kw = 0; kw < a.kernel_w; ++kw) {
+                const std::ptrdiff_t iw0 = static_cast<std::ptrdiff_t>(ow0 * a.stride_w + kw * a.dilation_w) - pad_left;
+                const std::ptrdiff_t iw_last = iw0 + static_cast<std::ptrdiff_t>(R - 1) * sw;
+                const float* w_tap = a.w + (kh * a.kernel_w + kw) * B * B;
+                const std::size_t w_block = a.kernel_h * a.kernel_w * B * B;
+                if (iw0 >= 0 && iw_last < in_w) {
+                    const float* x_tap = a.x + pixel(a, ih, iw0);
+                    for (std::size_t ib = 0; ib < a.in_blocks; ++ib) {
+                        const float* xp = x_tap + ib * plane;
+                        const float* wp = w_tap + ib * w_block;
+                        for (std::size_t i = 0; i < B; ++i) {
+                            const Reg wv = V::load(wp + i * B);
+                            for (std::size_t r = 0; r < R; ++r) {
+                                acc[r] = V::fmadd(V::broadcast(xp[r * a.stride_w * B + i]), wv, acc[r]);
+                            }
+                        }
+                    }
+                    continue;
+                }
+                for (std::size_t r = 0; r < R; ++r) {
+                    const std::ptrdiff_t iw = iw0 + static_cast<std::ptrdiff_t>(r) * sw;
+                    if (iw < 0 || iw >= in_w) continue;
+                    const float* x_tap = a.x + pixel(a, ih, iw);
+                    for (std::size_t ib = 0; ib < a.in_blocks; ++ib) {
+                        const float* xp = x_tap + ib * plane;
+                        const float* wp = w_tap + ib * w_block;
+                        for (std::size_t i = 0; i < B; ++i) {
+                            acc[r] = V::fmadd(V::broadcast(xp[i]), V::load(wp + i * B), acc[r]);
+                        }
+                    }
+                }
+            }
+        }
+        for (std::size_t r = 0; r < R; ++r) {
+            V::store(a.y + (ow0 + r) * B, a.activation == Activation::ReLU ? V::relu(acc[r]) : acc[r]);
+        }
+    }
+
+    static void nchwcRow(const ConvNchwcRowArgs& a) {
+        alignas(64) float bias_block[B] = {};
+        if (a.bias != nullptr) std::copy(a.bias, a.bias + std::min(a.bias_count, B), bias_block);
+        std::size_t ow = 0;
+        for (; ow + V::kRows <= a.out_w; ow += V::kRows) nchwcBlock<V::kRows>(a, bias_block, ow);
+        for (; ow < a.out_w; ++ow) nchwcBlock<1>(a, bias_block, ow);
+    }
+
+    // Output pixel ow of a depthwise row with every tap bounds-checked.
+    static float depthwisePixel(const ConvDepthwiseRowArgs& a, std::size_t ow) {
+        const auto ih0 = static_cast<std::ptrdiff_t>(a.oh * a.stride_h) - static_cast<std::ptrdiff_t>(a.pad_top);
+        const auto iw0 = static_cast<std::ptrdiff_t>(ow * a.stride_w) - static_cast<std::ptrdiff_t>(a.pad_left);
+        float acc = a.bias;
+        for (std::size_t kh = 0; kh < a.kernel_h; ++kh) {
+            const std::ptrdiff_t ih = ih0 + static_cast<std::ptrdiff_t>(kh * a.dilation_h);
+            if (ih < 0 || ih >= static_cast<std::ptrdiff_t>(a.in_h)) continue;
+            for (std::size_t kw = 0; kw < a.kernel_w; ++kw) {
+                const std::ptrdiff_t iw = iw0 + static_cast<std::ptrdiff_t>(kw * a.dilation_w);
+                if (iw < 0 || iw >= static_cast<std::ptrdiff_t>(a.in_w)) continue;
+                acc += a.x[static_cast<std::size_t>(ih) * a.in_w + static_cast<std::size_t>(iw)] *
+                       a.w[kh * a.kernel_w + kw];
+            }
+        }
+        return a.activation == Activation::ReLU ? std::max(acc, 0.0f) : acc;
+    }
+
+    // Pixels [lo, hi) read no padding column; with stride 1 they are computed kLanes
+    // at a time from contiguous loads, the border pixels one by one.
+    static void depthwiseRow(const ConvDepthwiseRowArgs& a) {
+        const std::size_t span = (a.kernel_w - 1) * a.dilation_w;
+        const std::size_t lo = std::min(a.out_w, (a.pad_left + a.stride_w - 1) / a.stride_w);
+        std::size_t hi = lo;
+        if (a.in_w + a.pad_left > span) {
+            hi = std::max(lo, std::min(a.out_w, (a.in_w - 1 + a.pad_left - span) / a.stride_w + 1));
+        }
+        for (std::size_t ow = 0; ow < lo; ++ow) a.y[ow] = depthwisePixel(a, ow);
+        std::size_t ow = lo;
+        if (a.stride_w == 1) {
+            const auto ih0 = static_cast<std::ptrdiff_t>(a.oh * a.stride_h) - static_cast<std::ptrdiff_t>(a.pad_top);
+            for (; ow + B <= hi; ow += B) {
+                Reg acc = V::broadcast(a.bias);
+                for (std::size_t kh = 0; kh < a.kernel_h; ++kh) {
+                    const std::ptrdiff_t ih = ih0 + static_cast<std::ptrdiff_t>(kh * a.dilation_h);
+                    if (ih < 0 || ih >= static_cast<std::ptrdiff_t>(a.in_h)) continue;
+                    const float* xr = a.x + static_cast<std::size_t>(ih) * a.in_w + ow - a.pad_left;
+                    for (std::size_t kw = 0; kw < a.kernel_w; ++kw) {
+                        acc = V::fmadd(V::load(xr + kw * a.dilation_w), V::broadcast(a.w[kh * a.kernel_w + kw]), acc);
+                    }
+                }
+                V::store(a.y + ow, a.activation == Activation::ReLU ? V::relu(acc) : acc);
+            }
+        }
+        for (; ow < a.out_w; ++ow) a.y[ow] = depthwisePixel(a, ow);
+    }
+};
+
+} // namespace
+} // namespace infer
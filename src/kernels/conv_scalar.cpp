@@ -0,0 +1,59 @@
+#include "builtin_kernels.h"
+#include "conv_nchwc.h"
+
+#include "inference_engine/kernels/registry.h"
+
+namespace infer {
+
+namespace {
+
+// Eight lanes in plain arrays: the NCHW8c block of the AVX2 kernel, so the scalar
+// fallback reads the same layout. The lane loops are left to the auto-vectorizer.
+struct ScalarLanes {
+    static constexpr std::size_t kLanes = 8;
+    static constexpr std::size_t kRows = 4;
+    struct Reg {
+        float v[kLanes];
+    };
+
+    static Reg load(const float* p) {
+        Reg r;
+        for (std::size_t i = 0; i < kLanes; ++i) r.v[i] = p[i];
+        return r;
+    }
+    static void store(float* p, const Reg& r) {
+        for (std::size_t i = 0; i < kLanes; ++i) p[i] = r.v[i];
+    }
+    static Reg zero() { return broadcast(0.0f); }
+    static Reg broadcast(float s) {
+        Reg r;
+        for (float& v : r.v) v = s;
+        return r;
+    }
+    static Reg fmadd(const Reg& a, const Reg& b, const Reg& c) {
+        Reg r;
+        for (std::size_t i = 0; i < kLanes; ++i) r.v[i] = a.v[i] * b.v[i] + c.v[i];
+        return r;
+    }
+    static Reg relu(const Reg& a) {
+        Reg r;
+        for (std::size_t i = 0; i < kLanes; ++i) r.v[i] = a.v[i] > 0.0f ? a.v[i] : 0.0f;
+        return r;
+    }
+};
+
+std::size_t blockScalar() {
+    return ScalarLanes::kLanes;
+}
+
+} // namespace
+
+void registerConvKernelsScalar(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ConvNchwcRowFn>("conv2d_nchwc", DataType::FP32, Isa::Scalar, &ConvRows<ScalarLanes>::nchwcRow);
+    r.add<ConvBlockFn>("conv2d_nchwc_block", DataType::FP32, Isa::Scalar, &blockScalar);
+    r.add<ConvDepthwiseRowFn>("conv2d_depthwise_row", DataType::FP32, Isa::Scalar,
+                              &ConvRows<ScalarLanes>::depthwiseRow);
+}
+
+} // namespace infer
@@ -0,0 +1,46 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <immintrin.h>
+
+// Built with -mavx2 -mf16c; Isa::AVX2 requires F16C on the host.
+#if !defined(__F16C__)
+#error "convert_avx2.cpp must be compiled with F16C enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+void convertFp32ToFp16(const float* input, std::uint16_t* output, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i lo = _mm256_cvtps_ph(_mm256_loadu_ps(input + i), _MM_FROUND_TO_NEAREST_INT);
+        const __m128i hi = _mm256_cvtps_ph(_mm256_loadu_ps(input + i + 8), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 8), hi);
+    }
+    scalar::convertFp32ToFp16(input + i, output + i, count - i);
+}
+
+void convertFp16ToFp32(const std::uint16_t* input, float* output, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 8));
+        _mm256_storeu_ps(output + i, _mm256_cvtph_ps(lo));
+        _mm256_storeu_ps(output + i + 8, _mm256_cvtph_ps(hi));
+    }
+    scalar::convertFp16ToFp32(input + i, output + i, count - i);
+}
+
+} // namespace
+
+void registerConvertKernelsAvx2(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ConvertFp32ToFp16Fn>("fp32_to_fp16", DataType::FP16, Isa::AVX2, &convertFp32ToFp16);
+    r.add<ConvertFp16ToFp32Fn>("fp16_to_fp32", DataType::FP16, Isa::AVX2, &convertFp16ToFp32);
+}
+
+} // namespace infer
@@ -0,0 +1,50 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <immintrin.h>
+
+#if !defined(__AVX512F__)
+#error "convert_avx512.cpp must be compiled with AVX-512 enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+// Tails go through masked loads/stores instead of the scalar fallback.
+void convertFp32ToFp16(const float* input, std::uint16_t* output, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m256i h = _mm512_cvtps_ph(_mm512_loadu_ps(input + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), h);
+    }
+    if (i < count) {
+        const __mmask16 mask = static_cast<__mmask16>((1u << (count - i)) - 1u);
+        const __m256i h = _mm512_cvtps_ph(_mm512_maskz_loadu_ps(mask, input + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm256_mask_storeu_epi16(output + i, mask, h);
+    }
+}
+
+void convertFp16ToFp32(const std::uint16_t* input, float* output, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        _mm512_storeu_ps(output + i, _mm512_cvtph_ps(h));
+    }
+    if (i < count) {
+        const __mmask16 mask = static_cast<__mmask16>((1u << (count - i)) - 1u);
+        const __m256i h = _mm256_maskz_loadu_epi16(mask, input + i);
+        _mm512_mask_storeu_ps(output + i, mask, _mm512_cvtph_ps(h));
+    }
+}
+
+} // namespace
+
+void registerConvertKernelsAvx512(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ConvertFp32ToFp16Fn>("fp32_to_fp16", DataType::FP16, Isa::AVX512, &convertFp32ToFp16);
+    r.add<ConvertFp16ToFp32Fn>("fp16_to_fp32", DataType::FP16, Isa::AVX512, &convertFp16ToFp32);
+}
+
+} // namespace infer
@@ -0,0 +1,45 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <arm_neon.h>
+
+// FCVTN/FCVTL are part of base AArch64 Advanced SIMD (no FP16 arithmetic needed)
+// and round with the default FPCR mode, nearest even.
+#if !defined(__aarch64__)
+#error "convert_neon.cpp targets AArch64 Advanced SIMD"
+#endif
+
+namespace infer {
+
+namespace {
+
+void convertFp32ToFp16(const float* input, std::uint16_t* output, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const float16x4_t lo = vcvt_f16_f32(vld1q_f32(input + i));
+        const float16x8_t h = vcvt_high_f16_f32(lo, vld1q_f32(input + i + 4));
+        vst1q_u16(output + i, vreinterpretq_u16_f16(h));
+    }
+    scalar::convertFp32ToFp16(input + i, output + i, count - i);
+}
+
+void convertFp16ToFp32(const std::uint16_t* input, float* output, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const float16x8_t h = vreinterpretq_f16_u16(vld1q_u16(input + i));
+        vst1q_f32(output + i, vcvt_f32_f16(vget_low_f16(h)));
+        vst1q_f32(output + i + 4, vcvt_high_f32_f16(h));
+    }
+    scalar::convertFp16ToFp32(input + i, output + i, count - i);
+}
+
+} // namespace
+
+void registerConvertKernelsNeon(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ConvertFp32ToFp16Fn>("fp32_to_fp16", DataType::FP16, Isa::NEON, &convertFp32ToFp16);
+    r.add<ConvertFp16ToFp32Fn>("fp16_to_fp32", DataType::FP16, Isa::NEON, &convertFp16ToFp32);
+}
+
+} // namespace infer
@@ -0,0 +1,30 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/core/half.h"
+#include "inference_engine/kernels/registry.h"
+
+namespace infer {
+
+namespace scalar {
+
+void convertFp32ToFp16(const float* input, std::uint16_t* output, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        output[i] = inference_engine::core::fp32_to_fp16(input[i]);
+    }
+}
+
+void convertFp16ToFp32(const std::uint16_t* input, float* output, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        output[i] = inference_engine::core::fp16_to_fp32(input[i]);
+    }
+}
+
+} // namespace scalar
+
+void registerConvertKernelsScalar(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ConvertFp32ToFp16Fn>("fp32_to_fp16", DataType::FP16, Isa::Scalar, &scalar::convertFp32ToFp16);
+    r.add<ConvertFp16ToFp32Fn>("fp16_to_fp32", DataType::FP16, Isa::Scalar, &scalar::convertFp16ToFp32);
+}
+
+} // namespace infer
@@ -0,0 +1,187 @@
+#include "inference_engine/kernels/cpu_features.h"
+
+#include "inference_engine/core/common.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+
+#if IE_ARCH_X86
+#if IE_COMPILER_MSVC
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#if IE_ARCH_ARM && IE_PLATFORM_LINUX && defined(__aarch64__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+
+namespace infer {
+
+namespace {
+
+#if IE_ARCH_X86
+void cpuid(std::uint32_t leaf, std::uint32_t subleaf, std::uint32_t regs[4]) {
+#if IE_COMPILER_MSVC
+    int r[4];
+    __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i) regs[i] = static_cast<std::uint32_t>(r[i]);
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+std::uint64_t xgetbv0() {
+#if IE_COMPILER_MSVC
+    return _xgetbv(0);
+#else
+    std::uint32_t lo = 0;
+    std::uint32_t hi = 0;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return (static_cast<std::uint64_t>(hi) << 32) | lo;
+#endif
+}
+
+constexpr bool bit(std::uint32_t reg, int n) {
+    return ((reg >> n) & 1u) != 0;
+}
+#endif
+
+CpuFeatures detect() {
+    CpuFeatures f;
+#if IE_ARCH_X86
+    std::uint32_t r[4] = {};
+    cpuid(0, 0, r);
+    const std::uint32_t max_leaf = r[0];
+    if (max_leaf < 1) return f;
+
+    cpuid(1, 0, r);
+    const bool osxsave = bit(r[2], 27);
+    const bool avx = bit(r[2], 28);
+    const bool fma = bit(r[2], 12);
+    const bool f16c = bit(r[2], 29);
+    if (!osxsave || !avx) return f;
+
+    // The OS must save YMM (and for AVX-512 also opmask/ZMM) state on context switch.
+    const std::uint64_t xcr0 = xgetbv0();
+    const bool ymm_state = (xcr0 & 0x6) == 0x6;
+    const bool zmm_state = (xcr0 & 0xE6) == 0xE6;
+    if (!ymm_state) return f;
+
+    f.fma = fma;
+    f.f16c = f16c;
+    if (max_leaf >= 7) {
+        cpuid(7, 0, r);
+        f.avx2 = bit(r[1], 5);
+        if (zmm_state) {
+            f.avx512f = bit(r[1], 16);
+            f.avx512dq = bit(r[1], 17);
+            f.avx512bw = bit(r[1], 30);
+            f.avx512vl = bit(r[1], 31);
+            f.avx512_vnni = bit(r[2], 11);
+        }
+        cpuid(7, 1, r);
+        f.avx_vnni = bit(r[0], 4);
+    }
+#elif IE_ARCH_ARM && defined(__aarch64__)
+    // Advanced SIMD is mandatory on AArch64.
+    f.neon = true;
+#if IE_PLATFORM_LINUX
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+#ifdef HWCAP_ASIMDDP
+    f.neon_dotprod = (hwcap & HWCAP_ASIMDDP) != 0;
+#endif
+#ifdef HWCAP_ASIMDHP
+    f.neon_fp16 = (hwcap & HWCAP_ASIMDHP) != 0;
+#endif
+#elif IE_PLATFORM_APPLE
+    // Every Apple silicon core implements dot product and FP16 arithmetic.
+    f.neon_dotprod = true;
+    f.neon_fp16 = true;
+#endif
+#endif
+    return f;
+}
+
+} // namespace
+
+const CpuFeatures& cpu_features() noexcept {
+    static const CpuFeatures features = detect();
+    return features;
+}
+
+namespace {
+
+bool isaSupportedBy(const CpuFeatures& f, Isa isa) {
+    switch (isa) {
+    case Isa::Scalar: return true;
+    case Isa::AVX2: return f.avx2 && f.fma && f.f16c;
+    case Isa::AVX512: return f.avx512f && f.avx512bw && f.avx512dq && f.avx512vl && f.fma && f.f16c;
+    case Isa::NEON: return f.neon;
+    case Isa::AVX512_VNNI: return isaSupportedBy(f, Isa::AVX512) && f.avx512_vnni;
+    case Isa::NEON_DOTPROD: return f.neon && f.neon_dotprod;
+    default: return false;
+    }
+}
+
+Isa hostBestIsa(const CpuFeatures& f) {
+    for (Isa isa : {Isa::AVX512_VNNI, Isa::AVX512, Isa::AVX2, Isa::NEON_DOTPROD, Isa::NEON}) {
+        if (isaSupportedBy(f, isa)) return isa;
+    }
+    return Isa::Scalar;
+}
+
+Isa applyEnvCap(Isa best) {
+    const char* env = std::getenv("INFER_ENGINE_MAX_ISA");
+    if (env == nullptr || *env == '\0') return best;
+    Isa cap = best;
+    if (std::strcmp(env, "scalar") == 0) {
+        cap = Isa::Scalar;
+    } else if (std::strcmp(env, "avx2") == 0) {
+        cap = Isa::AVX2;
+    } else if (std::strcmp(env, "avx512") == 0) {
+        cap = Isa::AVX512;
+    } else if (std::strcmp(env, "avx512_vnni") == 0) {
+        cap = Isa::AVX512_VNNI;
+    } else if (std::strcmp(env, "neon") == 0) {
+        cap = Isa::NEON;
+    } else if (std::strcmp(env, "neon_dotprod") == 0) {
+        cap = Isa::NEON_DOTPROD;
+    }
+    if (isa_rank(cap) >= isa_rank(best)) return best;
+    // Best host ISA at or below the cap's rank (e.g. "neon" on x86 selects AVX2).
+    for (Isa isa : {Isa::AVX512_VNNI, Isa::AVX512, Isa::AVX2, Isa::NEON_DOTPROD, Isa::NEON}) {
+        if (isa_rank(isa) <= isa_rank(cap) && isa_rank(isa) <= isa_rank(best) && isaSupportedBy(cpu_features(), isa)) {
+            return isa;
+        }
+    }
+    return Isa::Scalar;
+}
+
+} // namespace
+
+const char* isa_to_string(Isa isa) noexcept {
+    switch (isa) {
+    case Isa::Scalar: return "scalar";
+    case Isa::AVX2: return "avx2";
+    case Isa::AVX512: return "avx512";
+    case Isa::NEON: return "neon";
+    case Isa::AVX512_VNNI: return "avx512_vnni";
+    case Isa::NEON_DOTPROD: return "neon_dotprod";
+    default: return "unknown";
+    }
+}
+
+bool isa_supported(Isa isa) noexcept {
+    return isaSupportedBy(cpu_features(), isa);
+}
+
+Isa max_isa() noexcept {
+    static const Isa isa = applyEnvCap(hostBestIsa(cpu_features()));
+    return isa;
+}
+
+} // namespace infer
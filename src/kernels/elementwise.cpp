@@ -0,0 +1,169 @@
+#include "inference_engine/kernels/elementwise.h"
+
+#include "inference_engine/core/small_vector.h"
+#include "inference_engine/kernels/registry.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace infer {
+
+namespace {
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+
+// 8 KiB of output: a block stays in L1 while a fused chain runs over it.
+constexpr std::size_t kBlock = 2048;
+// Outputs below this many elements stay on the calling thread; larger ones hand
+// each task about kTaskElems.
+constexpr std::size_t kParallelElems = std::size_t{1} << 16;
+constexpr std::size_t kTaskElems = std::size_t{1} << 14;
+
+// Resolved once per process from the host's CPU features.
+ElementwiseUnaryFn* unaryKernel() {
+    static ElementwiseUnaryFn* const fn =
+        KernelRegistry::instance().lookup<ElementwiseUnaryFn>("elementwise_unary", DataType::FP32);
+    return fn;
+}
+
+ElementwiseBinaryFn* binaryKernel() {
+    static ElementwiseBinaryFn* const fn =
+        KernelRegistry::instance().lookup<ElementwiseBinaryFn>("elementwise_binary", DataType::FP32);
+    return fn;
+}
+
+// Runs fn(unit) for every unit in [0, units), through parallelFor once the output
+// is large enough to be worth the hand-off.
+template <typename Fn>
+void forEachUnit(std::size_t units, std::size_t unit_elems, const Fn& fn) {
+    if (units <= 1 || units * unit_elems < kParallelElems) {
+        for (std::size_t u = 0; u < units; ++u) fn(u);
+        return;
+    }
+    const std::size_t grain = std::max<std::size_t>(1, kTaskElems / std::max<std::size_t>(1, unit_elems));
+    parallelFor(0, units, grain, [&fn](std::size_t begin, std::size_t end) {
+        for (std::size_t u = begin; u < end; ++u) fn(u);
+    });
+}
+
+void applySteps(ElementwiseUnaryFn* unary, const ElementwiseKind* steps, std::size_t num_steps, float* y,
+                std::size_t n) {
+    for (std::size_t s = 0; s < num_steps; ++s) unary(steps[s], y, y, n);
+}
+
+// One output dimension with the element strides of both operands along it
+// (0 where the operand is broadcast).
+struct Dim {
+    std::int64_t size;
+    std::int64_t a;
+    std::int64_t b;
+};
+using Dims = inference_engine::core::SmallVector<Dim, inference_engine::core::kMaxInlineRank>;
+
+// Element strides of a dense operand of `shape`, right-aligned to `out`.
+inference_engine::core::DimVector operandStrides(const Shape& shape, const Shape& out, const char* name) {
+    const std::size_t rank = out.rank();
+    if (shape.rank() > rank) {
+        throw std::invalid_argument(std::string("elementwise_binary: ") + name +
+                                    " has a higher rank than the output");
+    }
+    inference_engine::core::DimVector strides(rank, 0);
+    std::int64_t stride = 1;
+    const std::size_t lead = rank - shape.rank();
+    for (std::size_t i = shape.rank(); i-- > 0;) {
+        const std::int64_t d = shape.dim(i);
+        if (d != 1 && d != out.dim(lead + i)) {
+            throw std::invalid_argument(std::string("elementwise_binary: ") + name + " shape " +
+                                        inference_engine::core::shape_to_string(shape) +
+                                        " does not broadcast to " + inference_engine::core::shape_to_string(out));
+        }
+        strides[lead + i] = d == 1 ? 0 : stride;
+        stride *= d;
+    }
+    return strides;
+}
+
+} // namespace
+
+void elementwise_unary(const ElementwiseKind* steps, std::size_t num_steps, const float* x, float* y,
+                       std::size_t n) {
+    if (num_steps == 0) {
+        if (x != y && n > 0) std::memcpy(y, x, n * sizeof(float));
+        return;
+    }
+    ElementwiseUnaryFn* unary = unaryKernel();
+    forEachUnit((n + kBlock - 1) / kBlock, kBlock, [&](std::size_t u) {
+        const std::size_t off = u * kBlock;
+        const std::size_t len = std::min(kBlock, n - off);
+        unary(steps[0], x + off, y + off, len);
+        applySteps(unary, steps + 1, num_steps - 1, y + off, len);
+    });
+}
+
+void elementwise_binary(BinaryKind kind, const float* a, const Shape& a_shape, const float* b, const Shape& b_shape,
+                        float* y, const Shape& y_shape, const ElementwiseKind* post, std::size_t num_post) {
+    const auto sa = operandStrides(a_shape, y_shape, "a");
+    const auto sb = operandStrides(b_shape, y_shape, "b");
+
+    // Drop size-1 output dimensions, then merge neighbours that are contiguous in
+    // both operands (the output is dense, so always in y).
+    Dims dims;
+    for (std::size_t i = 0; i < y_shape.rank(); ++i) {
+        const std::int64_t size = y_shape.dim(i);
+        if (size == 0) return;
+        if (size == 1) continue;
+        if (!dims.empty() && dims.back().a == sa[i] * size && dims.back().b == sb[i] * size) {
+            dims.back() = {dims.back().size * size, sa[i], sb[i]};
+        } else {
+            dims.push_back({size, sa[i], sb[i]});
+        }
+    }
+    // A single-element output is one row of length 1.
+    const Dim inner = dims.empty() ? Dim{1, 0, 0} : dims.back();
+    if (!dims.empty()) dims.pop_back();
+    const auto row = static_cast<std::size_t>(inner.size);
+    // Both operands pinned along the row: every element of it is the same value.
+    const bool constant_row = inner.a == 0 && inner.b == 0;
+    const BinaryOperands operands = inner.a == 0   ? BinaryOperands::ScalarVector
+                                    : inner.b == 0 ? BinaryOperands::VectorScalar
+                                                   : BinaryOperands::VectorVector;
+
+    std::size_t outer = 1;
+    for (const Dim& d : dims) outer *= static_cast<std::size_t>(d.size);
+    const std::size_t chunks = (row + kBlock - 1) / kBlock;
+    ElementwiseUnaryFn* unary = num_post > 0 ? unaryKernel() : nullptr;
+    ElementwiseBinaryFn* binary = binaryKernel();
+
+    forEachUnit(outer * chunks, std::min(row, kBlock), [&](std::size_t u) {
+        const std::size_t o = u / chunks;
+        const std::size_t c0 = (u % chunks) * kBlock;
+        const std::size_t len = std::min(kBlock, row - c0);
+
+        std::int64_t a_off = inner.a * static_cast<std::int64_t>(c0);
+        std::int64_t b_off = inner.b * static_cast<std::int64_t>(c0);
+        std::size_t index = o;
+        for (std::size_t i = dims.size(); i-- > 0;) {
+            const auto size = static_cast<std::size_t>(dims[i].size);
+            const auto idx = static_cast<std::int64_t>(index % size);
+            index /= size;
+            a_off += idx * dims[i].a;
+            b_off += idx * dims[i].b;
+        }
+
+        float* out = y + o * row + c0;
+        if (constant_row) {
+            binary(kind, BinaryOperands::VectorScalar, a + a_off, b + b_off, out, 1);
+            applySteps(unary, post, num_post, out, 1);
+            std::fill(out + 1, out + len, out[0]);
+            return;
+        }
+        binary(kind, operands, a + a_off, b + b_off, out, len);
+        applySteps(unary, post, num_post, out, len);
+    });
+}
+
+} // namespace infer
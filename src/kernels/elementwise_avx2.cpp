@@ -0,0 +1,158 @@
+#include "builtin_kernels.h"
+#include "math_avx2.h"
+
+#include "inference_engine/kernels/registry.h"
+
+namespace infer {
+
+namespace {
+
+inline __m256 sigmoid256(__m256 x) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    return _mm256_div_ps(one, _mm256_add_ps(one, avx2::exp256(_mm256_sub_ps(_mm256_setzero_ps(), x))));
+}
+
+// Odd polynomial below |x| = 0.625 (Cephes tanhf), where 1 - 2 / (e^2x + 1) would
+// cancel; the exp form elsewhere, with the sign of x restored.
+inline __m256 tanh256(__m256 x) {
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 ax = _mm256_andnot_ps(sign, x);
+    const __m256 one = _mm256_set1_ps(1.0f);
+
+    const __m256 z = _mm256_mul_ps(x, x);
+    __m256 p = _mm256_set1_ps(-5.70498872745e-3f);
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(2.06390887954e-2f));
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(-5.37397155531e-2f));
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(1.33314422036e-1f));
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(-3.33332819422e-1f));
+    const __m256 small = _mm256_fmadd_ps(_mm256_mul_ps(p, z), x, x);
+
+    const __m256 e = avx2::exp256(_mm256_add_ps(ax, ax));
+    const __m256 large_abs = _mm256_sub_ps(one, _mm256_div_ps(_mm256_set1_ps(2.0f), _mm256_add_ps(e, one)));
+    const __m256 large = _mm256_or_ps(large_abs, _mm256_and_ps(sign, x));
+
+    return _mm256_blendv_ps(large, small, _mm256_cmp_ps(ax, _mm256_set1_ps(0.625f), _CMP_LT_OQ));
+}
+
+// 0.5 x (1 + erf(z)), z = x / sqrt(2), through erfc(|z|) ~= t (a1 + t (a2 + ... a5)) e^-z^2
+// with t = 1 / (1 + p |z|) (Abramowitz & Stegun 7.1.26, absolute error below
+// 1.5e-7): 1 + erf(z) is erfc(|z|) for x < 0 and 2 - erfc(|z|) otherwise, so the
+// negative tail never cancels against 1.
+inline __m256 gelu256(__m256 x) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 z = _mm256_mul_ps(x, _mm256_set1_ps(0.70710678f));
+    const __m256 az = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), z);
+    const __m256 t = _mm256_div_ps(one, _mm256_fmadd_ps(az, _mm256_set1_ps(0.3275911f), one));
+
+    __m256 p = _mm256_set1_ps(1.061405429f);
+    p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(-1.453152027f));
+    p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(1.421413741f));
+    p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(-0.284496736f));
+    p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(0.254829592f));
+    p = _mm256_mul_ps(p, t);
+    const __m256 erfc = _mm256_mul_ps(p, avx2::exp256(_mm256_sub_ps(_mm256_setzero_ps(), _mm256_mul_ps(az, az))));
+    const __m256 cdf2 = _mm256_blendv_ps(_mm256_sub_ps(_mm256_set1_ps(2.0f), erfc), erfc,
+                                         _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ));
+
+    return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), x), cdf2);
+}
+
+template <typename F>
+void unaryLoop(const float* x, float* y, std::size_t n, F f) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(y + i, f(_mm256_loadu_ps(x + i)));
+    }
+    if (i < n) {
+        // Tail through a padded block so it gets the same approximation.
+        alignas(32) float buf[8] = {};
+        for (std::size_t j = i; j < n; ++j) buf[j - i] = x[j];
+        _mm256_store_ps(buf, f(_mm256_load_ps(buf)));
+        for (std::size_t j = i; j < n; ++j) y[j] = buf[j - i];
+    }
+}
+
+void elementwiseUnary(ElementwiseKind kind, const float* x, float* y, std::size_t n) {
+    switch (kind) {
+    case ElementwiseKind::ReLU: {
+        const __m256 zero = _mm256_setzero_ps();
+        unaryLoop(x, y, n, [zero](__m256 v) { return _mm256_max_ps(v, zero); });
+        return;
+    }
+    case ElementwiseKind::Sigmoid: unaryLoop(x, y, n, sigmoid256); return;
+    case ElementwiseKind::Tanh: unaryLoop(x, y, n, tanh256); return;
+    case ElementwiseKind::GELU: unaryLoop(x, y, n, gelu256); return;
+    }
+}
+
+// Vector part of a binary loop; returns the elements done (a multiple of 8).
+template <typename F>
+std::size_t binaryLoop(BinaryOperands operands, const float* a, const float* b, float* y, std::size_t n, F f) {
+    std::size_t i = 0;
+    switch (operands) {
+    case BinaryOperands::VectorVector:
+        for (; i + 16 <= n; i += 16) {
+            _mm256_storeu_ps(y + i, f(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+            _mm256_storeu_ps(y + i + 8, f(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8)));
+        }
+        for (; i + 8 <= n; i += 8) _mm256_storeu_ps(y + i, f(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        break;
+    case BinaryOperands::VectorScalar: {
+        const __m256 s = _mm256_broadcast_ss(b);
+        for (; i + 16 <= n; i += 16) {
+            _mm256_storeu_ps(y + i, f(_mm256_loadu_ps(a + i), s));
+            _mm256_storeu_ps(y + i + 8, f(_mm256_loadu_ps(a + i + 8), s));
+        }
+        for (; i + 8 <= n; i += 8) _mm256_storeu_ps(y + i, f(_mm256_loadu_ps(a + i), s));
+        break;
+    }
+    case BinaryOperands::ScalarVector: {
+        const __m256 s = _mm256_broadcast_ss(a);
+        for (; i + 16 <= n; i += 16) {
+            _mm256_storeu_ps(y + i, f(s, _mm256_loadu_ps(b + i)));
+            _mm256_storeu_ps(y + i + 8, f(s, _mm256_loadu_ps(b + i + 8)));
+        }
+        for (; i + 8 <= n; i += 8) _mm256_storeu_ps(y + i, f(s, _mm256_loadu_ps(b + i)));
+        break;
+    }
+    }
+    return i;
+}
+
+void elementwiseBinary(BinaryKind kind, BinaryOperands operands, const float* a, const float* b, float* y,
+                       std::size_t n) {
+    std::size_t done = 0;
+    switch (kind) {
+    case BinaryKind::Add:
+        done = binaryLoop(operands, a, b, y, n, [](__m256 p, __m256 q) { return _mm256_add_ps(p, q); });
+        break;
+    case BinaryKind::Sub:
+        done = binaryLoop(operands, a, b, y, n, [](__m256 p, __m256 q) { return _mm256_sub_ps(p, q); });
+        break;
+    case BinaryKind::Mul:
+        done = binaryLoop(operands, a, b, y, n, [](__m256 p, __m256 q) { return _mm256_mul_ps(p, q); });
+        break;
+    case BinaryKind::Div:
+        done = binaryLoop(operands, a, b, y, n, [](__m256 p, __m256 q) { return _mm256_div_ps(p, q); });
+        break;
+    case BinaryKind::Max:
+        done = binaryLoop(operands, a, b, y, n, [](__m256 p, __m256 q) { return _mm256_max_ps(p, q); });
+        break;
+    case BinaryKind::Min:
+        done = binaryLoop(operands, a, b, y, n, [](__m256 p, __m256 q) { return _mm256_min_ps(p, q); });
+        break;
+    }
+    const float* ta = operands == BinaryOperands::ScalarVector ? a : a + done;
+    const float* tb = operands == BinaryOperands::VectorScalar ? b : b + done;
+    scalar::elementwiseBinary(kind, operands, ta, tb, y + done, n - done);
+}
+
+} // namespace
+
+void registerElementwiseKernelsAvx2(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ElementwiseUnaryFn>("elementwise_unary", DataType::FP32, Isa::AVX2, &elementwiseUnary);
+    r.add<ElementwiseBinaryFn>("elementwise_binary", DataType::FP32, Isa::AVX2, &elementwiseBinary);
+}
+
+} // namespace infer
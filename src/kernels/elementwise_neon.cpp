@@ -0,0 +1,88 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <arm_neon.h>
+
+namespace infer {
+
+namespace {
+
+// Binary kinds and ReLU run four lanes at a time; the transcendental kinds keep
+// the scalar libm path.
+void elementwiseUnary(ElementwiseKind kind, const float* x, float* y, std::size_t n) {
+    if (kind != ElementwiseKind::ReLU) {
+        scalar::elementwiseUnary(kind, x, y, n);
+        return;
+    }
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const float32x4_t v = vld1q_f32(x + i);
+        // v > 0 ? v : 0, so NaN maps to 0 like the scalar kernel.
+        vst1q_f32(y + i, vbslq_f32(vcgtq_f32(v, zero), v, zero));
+    }
+    scalar::elementwiseUnary(kind, x + i, y + i, n - i);
+}
+
+// Max/Min as p > q ? p : q and p < q ? p : q (vmaxq_f32 would propagate NaN).
+template <typename F>
+std::size_t binaryLoop(BinaryOperands operands, const float* a, const float* b, float* y, std::size_t n, F f) {
+    std::size_t i = 0;
+    switch (operands) {
+    case BinaryOperands::VectorVector:
+        for (; i + 4 <= n; i += 4) vst1q_f32(y + i, f(vld1q_f32(a + i), vld1q_f32(b + i)));
+        break;
+    case BinaryOperands::VectorScalar: {
+        const float32x4_t s = vdupq_n_f32(b[0]);
+        for (; i + 4 <= n; i += 4) vst1q_f32(y + i, f(vld1q_f32(a + i), s));
+        break;
+    }
+    case BinaryOperands::ScalarVector: {
+        const float32x4_t s = vdupq_n_f32(a[0]);
+        for (; i + 4 <= n; i += 4) vst1q_f32(y + i, f(s, vld1q_f32(b + i)));
+        break;
+    }
+    }
+    return i;
+}
+
+void elementwiseBinary(BinaryKind kind, BinaryOperands operands, const float* a, const float* b, float* y,
+                       std::size_t n) {
+    std::size_t done = 0;
+    switch (kind) {
+    case BinaryKind::Add:
+        done = binaryLoop(operands, a, b, y, n, [](float32x4_t p, float32x4_t q) { return vaddq_f32(p, q); });
+        break;
+    case BinaryKind::Sub:
+        done = binaryLoop(operands, a, b, y, n, [](float32x4_t p, float32x4_t q) { return vsubq_f32(p, q); });
+        break;
+    case BinaryKind::Mul:
+        done = binaryLoop(operands, a, b, y, n, [](float32x4_t p, float32x4_t q) { return vmulq_f32(p, q); });
+        break;
+    case BinaryKind::Div:
+        done = binaryLoop(operands, a, b, y, n, [](float32x4_t p, float32x4_t q) { return vdivq_f32(p, q); });
+        break;
+    case BinaryKind::Max:
+        done = binaryLoop(operands, a, b, y, n,
+                          [](float32x4_t p, float32x4_t q) { return vbslq_f32(vcgtq_f32(p, q), p, q); });
+        break;
+    case BinaryKind::Min:
+        done = binaryLoop(operands, a, b, y, n,
+                          [](float32x4_t p, float32x4_t q) { return vbslq_f32(vcltq_f32(p, q), p, q); });
+        break;
+    }
+    const float* ta = operands == BinaryOperands::ScalarVector ? a : a + done;
+    const float* tb = operands == BinaryOperands::VectorScalar ? b : b + done;
+    scalar::elementwiseBinary(kind, operands, ta, tb, y + done, n - done);
+}
+
+} // namespace
+
+void registerElementwiseKernelsNeon(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ElementwiseUnaryFn>("elementwise_unary", DataType::FP32, Isa::NEON, &elementwiseUnary);
+    r.add<ElementwiseBinaryFn>("elementwise_binary", DataType::FP32, Isa::NEON, &elementwiseBinary);
+}
+
+} // namespace infer
@@ -0,0 +1,73 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <cmath>
+
+namespace infer {
+
+namespace {
+
+// y[i] = op(a[i * sa], b[i * sb]); the strides are 0 or 1 and known per call site.
+template <typename Op>
+void binaryLoop(BinaryOperands operands, const float* a, const float* b, float* y, std::size_t n, Op op) {
+    switch (operands) {
+    case BinaryOperands::VectorVector:
+        for (std::size_t i = 0; i < n; ++i) y[i] = op(a[i], b[i]);
+        return;
+    case BinaryOperands::VectorScalar: {
+        const float s = b[0];
+        for (std::size_t i = 0; i < n; ++i) y[i] = op(a[i], s);
+        return;
+    }
+    case BinaryOperands::ScalarVector: {
+        const float s = a[0];
+        for (std::size_t i = 0; i < n; ++i) y[i] = op(s, b[i]);
+        return;
+    }
+    }
+}
+
+} // namespace
+
+namespace scalar {
+
+void elementwiseUnary(ElementwiseKind kind, const float* x, float* y, std::size_t n) {
+    switch (kind) {
+    case ElementwiseKind::ReLU:
+        for (std::size_t i = 0; i < n; ++i) y[i] = x[i] > 0.0f ? x[i] : 0.0f;
+        break;
+    case ElementwiseKind::Sigmoid:
+        for (std::size_t i = 0; i < n; ++i) y[i] = 1.0f / (1.0f + std::exp(-x[i]));
+        break;
+    case ElementwiseKind::Tanh:
+        for (std::size_t i = 0; i < n; ++i) y[i] = std::tanh(x[i]);
+        break;
+    case ElementwiseKind::GELU:
+        // erfc(-z) = 1 + erf(z) without cancelling in the negative tail.
+        for (std::size_t i = 0; i < n; ++i) y[i] = 0.5f * x[i] * std::erfc(-x[i] * 0.70710678f);
+        break;
+    }
+}
+
+void elementwiseBinary(BinaryKind kind, BinaryOperands operands, const float* a, const float* b, float* y,
+                       std::size_t n) {
+    switch (kind) {
+    case BinaryKind::Add: binaryLoop(operands, a, b, y, n, [](float p, float q) { return p + q; }); return;
+    case BinaryKind::Sub: binaryLoop(operands, a, b, y, n, [](float p, float q) { return p - q; }); return;
+    case BinaryKind::Mul: binaryLoop(operands, a, b, y, n, [](float p, float q) { return p * q; }); return;
+    case BinaryKind::Div: binaryLoop(operands, a, b, y, n, [](float p, float q) { return p / q; }); return;
+    case BinaryKind::Max: binaryLoop(operands, a, b, y, n, [](float p, float q) { return p > q ? p : q; }); return;
+    case BinaryKind::Min: binaryLoop(operands, a, b, y, n, [](float p, float q) { return p < q ? p : q; }); return;
+    }
+}
+
+} // namespace scalar
+
+void registerElementwiseKernelsScalar(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ElementwiseUnaryFn>("elementwise_unary", DataType::FP32, Isa::Scalar, &scalar::elementwiseUnary);
+    r.add<ElementwiseBinaryFn>("elementwise_binary", DataType::FP32, Isa::Scalar, &scalar::elementwiseBinary);
+}
+
+} // namespace infer
@@ -0,0 +1,256 @@
+#pragma once
+
+// Cache-blocked SGEMM driver shared by the per-ISA kernel translation units.
+//
+// Each ISA TU includes this header and instantiates gemmBlocked<Tile> with its own
+// micro-kernel. Everything here has internal linkage so the differently compiled
+// copies (e.g. -mavx2 vs -mavx512f) never collide under the one-definition rule.
+
+#include "inference_engine/core/half.h"
+#include "inference_engine/kernels/linear.h"
+
+#if defined(__F16C__) || defined(__AVX512F__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace infer {
+namespace {
+
+// Weight rows are widened to FP32 on their way into packed panels, so one driver
+// serves FP32 and FP16 weights (LinearArgs / LinearFp16Args).
+inline void widenWeights(const float* src, float* dst, std::size_t count) {
+    std::memcpy(dst, src, count * sizeof(float));
+}
+
+inline void widenWeights(const std::uint16_t* src, float* dst, std::size_t count) {
+    std::size_t i = 0;
+#if defined(__AVX512F__)
+    for (; i + 16 <= count; i += 16) {
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i))));
+    }
+#elif defined(__F16C__)
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+    }
+#elif defined(__aarch64__)
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+    }
+#endif
+    for (; i < count; ++i) dst[i] = inference_engine::core::fp16_to_fp32(src[i]);
+}
+
+// Tile must provide:
+//   static constexpr std::size_t kMR, kNR;         register block
+//   static constexpr std::size_t kKC, kMC, kNC;    cache blocks (kMC % kMR == 0, kNC % kNR == 0)
+//   static void run(std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc,
+//                   const float* bias, bool first, bool last, Activation act);
+// run() computes a full kMR x kNR tile: on `first` the accumulators start from
+// `bias` (zero when null) instead of c; on `last` the activation is applied.
+template <typename Tile>
+struct GemmBlocked {
+    static constexpr std::size_t MR = Tile::kMR;
+    static constexpr std::size_t NR = Tile::kNR;
+
+    // A[mc, kc] -> MR-row slivers laid out k-major (dst[p * MR + r]); rows past mc are zero.
+    static void packA(const float* x, std::size_t ldx, std::size_t mc, std::size_t kc, float* dst) {
+        for (std::size_t i = 0; i < mc; i += MR) {
+            const std::size_t rows = std::min(MR, mc - i);
+            for (std::size_t p = 0; p < kc; ++p) {
+                std::size_t r = 0;
+                for (; r < rows; ++r) dst[r] = x[(i + r) * ldx + p];
+                for (; r < MR; ++r) dst[r] = 0.0f;
+                dst += MR;
+            }
+        }
+    }
+
+    // B[kc, nc] -> NR-column slivers laid out k-major (dst[p * NR + c]); columns past nc are zero.
+    template <typename W>
+    static void packB(const W* w, std::size_t ldw, std::size_t kc, std::size_t nc, float* dst) {
+        for (std::size_t j = 0; j < nc; j += NR) {
+            const std::size_t cols = std::min(NR, nc - j);
+            for (std::size_t p = 0; p < kc; ++p) {
+                widenWeights(w + p * ldw + j, dst, cols);
+                for (std::size_t c = cols; c < NR; ++c) dst[c] = 0.0f;
+                dst += NR;
+            }
+        }
+    }
+
+    // Partial tiles on the right/bottom edge go through a full-size scratch tile.
+    static void edgeTile(std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc, std::size_t mr,
+                         std::size_t nr, const float* bias, bool first, bool last, Activation act) {
+        alignas(64) float tile[MR * NR];
+        alignas(64) float bias_tile[NR] = {};
+        if (first) {
+            if (bias != nullptr) std::memcpy(bias_tile, bias, nr * sizeof(float));
+        } else {
+            for (std::size_t r = 0; r < mr; ++r) std::memcpy(tile + r * NR, c + r * ldc, nr * sizeof(float));
+        }
+        Tile::run(kc, a, b, tile, NR, bias_tile, first, last, act);
+        for (std::size_t r = 0; r < mr; ++r) std::memcpy(c + r * ldc, tile + r * NR, nr * sizeof(float));
+    }
+
+    struct PackBuffers {
+        std::vector<float> a;
+        std::vector<float> b;
+    };
+
+    static PackBuffers& packBuffers() {
+        thread_local PackBuffers buffers;
+        return buffers;
+    }
+
+    template <typename Args>
+    static void run(const Args& args) {
+        PackBuffers& buffers = packBuffers();
+        const std::size_t b_size = Tile::kKC * ((std::min(args.n, Tile::kNC) + NR - 1) / NR) * NR;
+        if (buffers.b.size() < b_size) buffers.b.resize(b_size);
+        float* packed_b = buffers.b.data();
+        blocks(args, [&](std::size_t jc, std::size_t nc, std::size_t pc, std::size_t kc) {
+            packB(args.w + pc * args.ldw + jc, args.ldw, kc, nc, packed_b);
+            return BBlock{packed_b, kc};
+        });
+    }
+
+    // Weights prepacked by pack_linear_weights() in NR-column panels of all k rows:
+    // the KC x NR sliver of panel q starts at w + (q * k + pc) * NR, already in the
+    // micro-kernel's order, so B is never packed per call.
+    static void runPacked(const LinearPackedArgs& args) {
+        blocks(args, [&](std::size_t jc, std::size_t, std::size_t pc, std::size_t) {
+            return BBlock{args.w + jc * args.k + pc * NR, args.k};
+        });
+    }
+
+    // A KC x NC block of B as NR-column slivers: sliver jr / NR starts at base + jr * stride.
+    struct BBlock {
+        const float* base;
+        std::size_t stride;
+    };
+
+    // The loop nest shared by run() and runPacked(); b_block(jc, nc, pc, kc) provides B.
+    template <typename Args, typename BlockOfB>
+    static void blocks(const Args& args, BlockOfB&& b_block) {
+        const std::size_t m = args.m;
+        const std::size_t n = args.n;
+        const std::size_t k = args.k;
+
+        PackBuffers& buffers = packBuffers();
+        const std::size_t a_size = Tile::kMC * Tile::kKC;
+        if (buffers.a.size() < a_size) buffers.a.resize(a_size);
+        float* packed_a = buffers.a.data();
+
+        for (std::size_t jc = 0; jc < n; jc += Tile::kNC) {
+            const std::size_t nc = std::min(Tile::kNC, n - jc);
+            for (std::size_t pc = 0; pc < k; pc += Tile::kKC) {
+                const std::size_t kc = std::min(Tile::kKC, k - pc);
+                const bool first = pc == 0;
+                const bool last = pc + kc == k;
+                const BBlock b = b_block(jc, nc, pc, kc);
+
+                for (std::size_t ic = 0; ic < m; ic += Tile::kMC) {
+                    const std::size_t mc = std::min(Tile::kMC, m - ic);
+                    packA(args.x + ic * args.ldx + pc, args.ldx, mc, kc, packed_a);
+
+                    for (std::size_t jr = 0; jr < nc; jr += NR) {
+                        const std::size_t nr = std::min(NR, nc - jr);
+                        const float* b_sliver = b.base + jr * b.stride;
+                        const float* bias = args.bias != nullptr ? args.bias + jc + jr : nullptr;
+                        for (std::size_t ir = 0; ir < mc; ir += MR) {
+                            const std::size_t mr = std::min(MR, mc - ir);
+                            const float* a_sliver = packed_a + ir * kc;
+                            float* c = args.y + (ic + ir) * args.ldy + jc + jr;
+                            if (mr == MR && nr == NR) {
+                                Tile::run(kc, a_sliver, b_sliver, c, args.ldy, bias, first, last, args.activation);
+                            } else {
+                                edgeTile(kc, a_sliver, b_sliver, c, args.ldy, mr, nr, bias, first, last,
+                                         args.activation);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+// Few-row product over prepacked panels (LinearPackedArgs): each panel of NR
+// columns is k x NR contiguous and is read once for all rows, which stay in L1.
+template <std::size_t NR>
+void linearPackedRows(const LinearPackedArgs& args) {
+    constexpr std::size_t kMaxRows = 16;
+    for (std::size_t i0 = 0; i0 < args.m; i0 += kMaxRows) {
+        const std::size_t rows = std::min(kMaxRows, args.m - i0);
+        for (std::size_t j0 = 0; j0 < args.n; j0 += NR) {
+            const std::size_t cols = std::min(NR, args.n - j0);
+            const float* panel = args.w + j0 * args.k;
+            for (std::size_t i = i0; i < i0 + rows; ++i) {
+                const float* x = args.x + i * args.ldx;
+                alignas(64) float acc[NR] = {};
+                if (args.bias != nullptr) std::memcpy(acc, args.bias + j0, cols * sizeof(float));
+                for (std::size_t p = 0; p < args.k; ++p) {
+                    const float xv = x[p];
+                    const float* w = panel + p * NR;
+                    for (std::size_t c = 0; c < NR; ++c) acc[c] += xv * w[c];
+                }
+                if (args.activation == Activation::ReLU) {
+                    for (std::size_t c = 0; c < NR; ++c) acc[c] = std::max(acc[c], 0.0f);
+                }
+                std::memcpy(args.y + i * args.ldy + j0, acc, cols * sizeof(float));
+            }
+        }
+    }
+}
+
+inline const float* weightRow(const float* w, float*, std::size_t) {
+    return w;
+}
+
+inline const float* weightRow(const std::uint16_t* w, float* scratch, std::size_t count) {
+    widenWeights(w, scratch, count);
+    return scratch;
+}
+
+// Unblocked row-streaming product for few-row inputs (batch-1 inference), where a
+// packed panel would be used only once. Written as plain loops over contiguous rows
+// of w so each ISA TU's compiler flags vectorize it. FP16 rows are widened in
+// column chunks that stay in L1.
+template <typename Args>
+void linearRowsPortable(const Args& args) {
+    constexpr std::size_t kChunk = 512;
+    alignas(64) float scratch[kChunk];
+    for (std::size_t i = 0; i < args.m; ++i) {
+        const float* x = args.x + i * args.ldx;
+        float* y_row = args.y + i * args.ldy;
+        for (std::size_t j0 = 0; j0 < args.n; j0 += kChunk) {
+            const std::size_t cols = std::min(kChunk, args.n - j0);
+            float* y = y_row + j0;
+            for (std::size_t j = 0; j < cols; ++j) {
+                y[j] = args.bias != nullptr ? args.bias[j0 + j] : 0.0f;
+            }
+            for (std::size_t p = 0; p < args.k; ++p) {
+                const float xv = x[p];
+                const float* w = weightRow(args.w + p * args.ldw + j0, scratch, cols);
+                for (std::size_t j = 0; j < cols; ++j) {
+                    y[j] += xv * w[j];
+                }
+            }
+            if (args.activation == Activation::ReLU) {
+                for (std::size_t j = 0; j < cols; ++j) {
+                    y[j] = std::max(0.0f, y[j]);
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+} // namespace infer
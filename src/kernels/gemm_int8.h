@@ -0,0 +1,147 @@
+#pragma once
+
+// INT8 GEMM driver shared by the per-ISA kernel translation units, in the same way
+// gemm_blocked.h is for FP32: each TU instantiates Int8Gemm<Tile> with its own
+// micro-kernel, and everything has internal linkage so differently compiled copies
+// never collide.
+
+#include "inference_engine/kernels/linear_int8.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace infer {
+namespace {
+
+using inference_engine::core::DataType;
+
+// One packed group of 4 activation bytes as the int32 that micro-kernels broadcast.
+inline std::int32_t loadGroup(const std::uint8_t* p) {
+    std::int32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// Tile must provide:
+//   static constexpr std::size_t kMR;             rows per register block
+//   static constexpr bool kUnsignedA;             activation bytes are u8 (else s8)
+//   static void run(std::size_t k_groups, const std::uint8_t* a, const std::int8_t* panel,
+//                   std::int32_t* acc);
+// run() computes acc[kMR][16] = sum over k of a * panel for one 16-column panel of
+// PackedInt8Weights, with a packed as k_groups x kMR rows x 4 bytes.
+template <typename Tile>
+struct Int8Gemm {
+    static constexpr std::size_t MR = Tile::kMR;
+    static constexpr std::size_t NR = PackedInt8Weights::kPanel;
+
+    // Activations are re-biased by 128 (x ^ 0x80) when their signedness differs
+    // from what the micro-kernel consumes; the zero point moves along with them.
+    static std::uint8_t flipMask(const LinearInt8Args& args) {
+        const bool x_unsigned = args.x_dtype == DataType::UINT8;
+        return x_unsigned == Tile::kUnsignedA ? 0 : 0x80;
+    }
+
+    static std::int32_t effectiveZeroPoint(const LinearInt8Args& args) {
+        if (flipMask(args) == 0) return args.x_zero_point;
+        return Tile::kUnsignedA ? args.x_zero_point + 128 : args.x_zero_point - 128;
+    }
+
+    // x[m, k] -> MR-row blocks of dst[(g * MR + r) * 4 + kk]; padding is zero.
+    static void packA(const LinearInt8Args& args, std::size_t k, std::size_t k_groups, std::uint8_t* dst) {
+        const auto* x = static_cast<const std::uint8_t*>(args.x);
+        const std::uint8_t flip = flipMask(args);
+        for (std::size_t i = 0; i < args.m; i += MR) {
+            const std::size_t rows = std::min(MR, args.m - i);
+            for (std::size_t g = 0; g < k_groups; ++g) {
+                std::memset(dst, 0, MR * 4);
+                for (std::size_t r = 0; r < rows; ++r) {
+                    const std::uint8_t* src = x + (i + r) * args.ldx;
+                    for (std::size_t kk = 0; kk < 4 && g * 4 + kk < k; ++kk) {
+                        dst[r * 4 + kk] = static_cast<std::uint8_t>(src[g * 4 + kk] ^ flip);
+                    }
+                }
+                dst += MR * 4;
+            }
+        }
+    }
+
+    // Zero-point correction, bias and requantization of one accumulator tile.
+    template <typename Q>
+    static void storeQuantized(const LinearInt8Args& args, const std::int32_t* acc, std::size_t row0,
+                               std::size_t rows, std::size_t col, std::size_t cols, std::int32_t zp) {
+        const float qmin = args.y_dtype == DataType::UINT8 ? 0.0f : -128.0f;
+        const float qmax = args.y_dtype == DataType::UINT8 ? 255.0f : 127.0f;
+        const float y_zp = static_cast<float>(args.y_zero_point);
+        const float lo = args.activation == Activation::ReLU ? std::max(qmin, y_zp) : qmin;
+        const std::size_t j0 = col - args.col_begin;
+        const std::int32_t* col_sums = args.w->col_sums.data() + col;
+        for (std::size_t r = 0; r < rows; ++r) {
+            Q* y = static_cast<Q*>(args.y) + (row0 + r) * args.ldy + j0;
+            for (std::size_t c = 0; c < cols; ++c) {
+                std::int32_t v = acc[r * NR + c] - zp * col_sums[c];
+                if (args.bias != nullptr) v += args.bias[j0 + c];
+                const float q = std::nearbyint(static_cast<float>(v) * args.scales[j0 + c]) + y_zp;
+                y[c] = static_cast<Q>(std::min(qmax, std::max(lo, q)));
+            }
+        }
+    }
+
+    static void storeFloat(const LinearInt8Args& args, const std::int32_t* acc, std::size_t row0, std::size_t rows,
+                           std::size_t col, std::size_t cols, std::int32_t zp) {
+        const std::size_t j0 = col - args.col_begin;
+        const std::int32_t* col_sums = args.w->col_sums.data() + col;
+        const bool relu = args.activation == Activation::ReLU;
+        for (std::size_t r = 0; r < rows; ++r) {
+            float* y = static_cast<float*>(args.y) + (row0 + r) * args.ldy + j0;
+            for (std::size_t c = 0; c < cols; ++c) {
+                std::int32_t v = acc[r * NR + c] - zp * col_sums[c];
+                if (args.bias != nullptr) v += args.bias[j0 + c];
+                const float f = static_cast<float>(v) * args.scales[j0 + c];
+                y[c] = relu ? std::max(0.0f, f) : f;
+            }
+        }
+    }
+
+    static std::vector<std::uint8_t>& packBuffer() {
+        thread_local std::vector<std::uint8_t> buffer;
+        return buffer;
+    }
+
+    static void run(const LinearInt8Args& args) {
+        const PackedInt8Weights& w = *args.w;
+        const std::size_t k_groups = w.k_groups;
+        const std::size_t row_blocks = (args.m + MR - 1) / MR;
+        const std::size_t a_block = k_groups * MR * 4;
+
+        // The whole activation matrix is packed once and then streamed against each
+        // weight panel, so every panel is read from memory exactly once.
+        std::vector<std::uint8_t>& buffer = packBuffer();
+        if (buffer.size() < row_blocks * a_block) buffer.resize(row_blocks * a_block);
+        packA(args, w.k, k_groups, buffer.data());
+        const std::int32_t zp = effectiveZeroPoint(args);
+
+        alignas(64) std::int32_t acc[MR * NR];
+        const std::size_t col_end = args.col_begin + args.n;
+        for (std::size_t col = args.col_begin; col < col_end; col += NR) {
+            const std::size_t cols = std::min(NR, col_end - col);
+            const std::int8_t* panel = w.panel(col / NR);
+            for (std::size_t rb = 0; rb < row_blocks; ++rb) {
+                const std::size_t row0 = rb * MR;
+                const std::size_t rows = std::min(MR, args.m - row0);
+                Tile::run(k_groups, buffer.data() + rb * a_block, panel, acc);
+                switch (args.y_dtype) {
+                case DataType::UINT8: storeQuantized<std::uint8_t>(args, acc, row0, rows, col, cols, zp); break;
+                case DataType::INT8: storeQuantized<std::int8_t>(args, acc, row0, rows, col, cols, zp); break;
+                default: storeFloat(args, acc, row0, rows, col, cols, zp); break;
+                }
+            }
+        }
+    }
+};
+
+} // namespace
+} // namespace infer
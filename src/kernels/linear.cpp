@@ -0,0 +1,88 @@
+#include "inference_engine/kernels/linear.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace infer {
+
+namespace {
+
+using LinearPackedFn = void(const LinearPackedArgs&);
+using LinearPackedPanelFn = std::size_t();
+
+struct PackedKernel {
+    LinearPackedFn* fn = nullptr;
+    std::size_t panel = 0;
+};
+
+// The packed kernel and its panel width come from the same ISA.
+const PackedKernel& packedKernel() {
+    static const PackedKernel kernel = [] {
+        using inference_engine::core::DataType;
+        const KernelRegistry& registry = KernelRegistry::instance();
+        const KernelEntry* run = registry.select("linear_packed", DataType::FP32);
+        const KernelEntry* panel =
+            run != nullptr ? registry.select("linear_packed_panel", DataType::FP32, run->isa) : nullptr;
+        if (panel == nullptr || panel->isa != run->isa) {
+            throw std::runtime_error("linear_packed: no packed kernel registered for the host");
+        }
+        return PackedKernel{reinterpret_cast<LinearPackedFn*>(run->fn),
+                            reinterpret_cast<LinearPackedPanelFn*>(panel->fn)()};
+    }();
+    return kernel;
+}
+
+} // namespace
+
+void linear(const LinearArgs& args) {
+    using LinearFn = void(const LinearArgs&);
+    // Resolved once per process from the host's CPU features.
+    static LinearFn* const kernel =
+        KernelRegistry::instance().lookup<LinearFn>("linear", inference_engine::core::DataType::FP32);
+    if (args.m == 0 || args.n == 0) return;
+    kernel(args);
+}
+
+void linear_fp16(const LinearFp16Args& args) {
+    using LinearFp16Fn = void(const LinearFp16Args&);
+    static LinearFp16Fn* const kernel =
+        KernelRegistry::instance().lookup<LinearFp16Fn>("linear", inference_engine::core::DataType::FP16);
+    if (args.m == 0 || args.n == 0) return;
+    kernel(args);
+}
+
+std::size_t linear_packed_panel() {
+    return packedKernel().panel;
+}
+
+std::size_t packed_linear_size(std::size_t k, std::size_t n, std::size_t panel) noexcept {
+    return panel == 0 ? 0 : k * ((n + panel - 1) / panel) * panel;
+}
+
+void pack_linear_weights(const float* w, std::size_t ldw, std::size_t k, std::size_t n, std::size_t panel,
+                         float* dst) {
+    if (panel == 0) throw std::invalid_argument("pack_linear_weights: panel width must be positive");
+    for (std::size_t j0 = 0; j0 < n; j0 += panel) {
+        const std::size_t cols = std::min(panel, n - j0);
+        for (std::size_t p = 0; p < k; ++p, dst += panel) {
+            std::memcpy(dst, w + p * ldw + j0, cols * sizeof(float));
+            std::fill(dst + cols, dst + panel, 0.0f);
+        }
+    }
+}
+
+void linear_packed(const LinearPackedArgs& args) {
+    const PackedKernel& kernel = packedKernel();
+    if (args.panel != kernel.panel) {
+        throw std::invalid_argument("linear_packed: weights were packed for panel width " +
+                                    std::to_string(args.panel) + ", the kernel uses " + std::to_string(kernel.panel));
+    }
+    if (args.m == 0 || args.n == 0) return;
+    kernel.fn(args);
+}
+
+} // namespace infer
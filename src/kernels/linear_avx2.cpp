@@ -0,0 +1,218 @@
+#include "inference_engine/kernels/linear_avx2.h"
+
+#include "gemm_blocked.h"
+#include "inference_engine/kernels/linear_scalar.h"
+
+#include <immintrin.h>
+
+// Built with -mavx2 -mfma -mf16c (see CMakeLists.txt); only reached through the
+// kernel registry after the host was checked for AVX2, FMA and F16C.
+#if !defined(__AVX2__) || !defined(__FMA__) || !defined(__F16C__)
+#error "linear_avx2.cpp must be compiled with AVX2, FMA and F16C enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+// Register block: 6 rows x 16 columns = 12 ymm accumulators, leaving room for two
+// B vectors and one A broadcast within the 16 architectural registers. A KC x NR
+// sliver of B stays in L1, an MC x KC panel of A in L2, the KC x NC panel of B in L3.
+struct Avx2Tile {
+    static constexpr std::size_t kMR = 6;
+    static constexpr std::size_t kNR = 16;
+    static constexpr std::size_t kKC = 256;
+    static constexpr std::size_t kMC = 72;
+    static constexpr std::size_t kNC = 1024;
+
+    // c[6, 16] (+)= a_sliver * b_sliver. On the first K block the accumulators start from
+    // the bias (or zero) instead of c; on the last one the activation is applied.
+    static void run(std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc,
+                    const float* bias16, bool first, bool last, Activation act) {
+        __m256 c00, c01, c10, c11, c20, c21, c30, c31, c40, c41, c50, c51;
+        if (first) {
+            const __m256 b0 = bias16 != nullptr ? _mm256_loadu_ps(bias16) : _mm256_setzero_ps();
+            const __m256 b1 = bias16 != nullptr ? _mm256_loadu_ps(bias16 + 8) : _mm256_setzero_ps();
+            c00 = c10 = c20 = c30 = c40 = c50 = b0;
+            c01 = c11 = c21 = c31 = c41 = c51 = b1;
+        } else {
+            c00 = _mm256_loadu_ps(c + 0 * ldc);
+            c01 = _mm256_loadu_ps(c + 0 * ldc + 8);
+            c10 = _mm256_loadu_ps(c + 1 * ldc);
+            c11 = _mm256_loadu_ps(c + 1 * ldc + 8);
+            c20 = _mm256_loadu_ps(c + 2 * ldc);
+            c21 = _mm256_loadu_ps(c + 2 * ldc + 8);
+            c30 = _mm256_loadu_ps(c + 3 * ldc);
+            c31 = _mm256_loadu_ps(c + 3 * ldc + 8);
+            c40 = _mm256_loadu_ps(c + 4 * ldc);
+            c41 = _mm256_loadu_ps(c + 4 * ldc + 8);
+            c50 = _mm256_loadu_ps(c + 5 * ldc);
+            c51 = _mm256_loadu_ps(c + 5 * ldc + 8);
+        }
+
+        for (std::size_t p = 0; p < kc; ++p) {
+            const __m256 b0 = _mm256_loadu_ps(b);
+            const __m256 b1 = _mm256_loadu_ps(b + 8);
+            __m256 av = _mm256_broadcast_ss(a + 0);
+            c00 = _mm256_fmadd_ps(av, b0, c00);
+            c01 = _mm256_fmadd_ps(av, b1, c01);
+            av = _mm256_broadcast_ss(a + 1);
+            c10 = _mm256_fmadd_ps(av, b0, c10);
+            c11 = _mm256_fmadd_ps(av, b1, c11);
+            av = _mm256_broadcast_ss(a + 2);
+            c20 = _mm256_fmadd_ps(av, b0, c20);
+            c21 = _mm256_fmadd_ps(av, b1, c21);
+            av = _mm256_broadcast_ss(a + 3);
+            c30 = _mm256_fmadd_ps(av, b0, c30);
+            c31 = _mm256_fmadd_ps(av, b1, c31);
+            av = _mm256_broadcast_ss(a + 4);
+            c40 = _mm256_fmadd_ps(av, b0, c40);
+            c41 = _mm256_fmadd_ps(av, b1, c41);
+            av = _mm256_broadcast_ss(a + 5);
+            c50 = _mm256_fmadd_ps(av, b0, c50);
+            c51 = _mm256_fmadd_ps(av, b1, c51);
+            a += kMR;
+            b += kNR;
+        }
+
+        if (last && act == Activation::ReLU) {
+            const __m256 zero = _mm256_setzero_ps();
+            c00 = _mm256_max_ps(c00, zero);
+            c01 = _mm256_max_ps(c01, zero);
+            c10 = _mm256_max_ps(c10, zero);
+            c11 = _mm256_max_ps(c11, zero);
+            c20 = _mm256_max_ps(c20, zero);
+            c21 = _mm256_max_ps(c21, zero);
+            c30 = _mm256_max_ps(c30, zero);
+            c31 = _mm256_max_ps(c31, zero);
+            c40 = _mm256_max_ps(c40, zero);
+            c41 = _mm256_max_ps(c41, zero);
+            c50 = _mm256_max_ps(c50, zero);
+            c51 = _mm256_max_ps(c51, zero);
+        }
+
+        _mm256_storeu_ps(c + 0 * ldc, c00);
+        _mm256_storeu_ps(c + 0 * ldc + 8, c01);
+        _mm256_storeu_ps(c + 1 * ldc, c10);
+        _mm256_storeu_ps(c + 1 * ldc + 8, c11);
+        _mm256_storeu_ps(c + 2 * ldc, c20);
+        _mm256_storeu_ps(c + 2 * ldc + 8, c21);
+        _mm256_storeu_ps(c + 3 * ldc, c30);
+        _mm256_storeu_ps(c + 3 * ldc + 8, c31);
+        _mm256_storeu_ps(c + 4 * ldc, c40);
+        _mm256_storeu_ps(c + 4 * ldc + 8, c41);
+        _mm256_storeu_ps(c + 5 * ldc, c50);
+        _mm256_storeu_ps(c + 5 * ldc + 8, c51);
+    }
+};
+
+inline __m256 loadWeights(const float* w) {
+    return _mm256_loadu_ps(w);
+}
+
+inline __m256 loadWeights(const std::uint16_t* w) {
+    return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(w)));
+}
+
+inline void linearTail(const LinearArgs& args) {
+    linear_scalar(args);
+}
+
+inline void linearTail(const LinearFp16Args& args) {
+    linear_fp16_scalar(args);
+}
+
+// Few-row products (batch-1 inference) are bandwidth bound on w: stream each row of
+// w once per x row instead of paying for packing panels that are used only once.
+template <typename Args>
+void linearRows(const Args& args) {
+    for (std::size_t i = 0; i < args.m; ++i) {
+        const float* x = args.x + i * args.ldx;
+        float* y = args.y + i * args.ldy;
+        std::size_t j = 0;
+        for (; j + 32 <= args.n; j += 32) {
+            __m256 acc0, acc1, acc2, acc3;
+            if (args.bias != nullptr) {
+                acc0 = _mm256_loadu_ps(args.bias + j);
+                acc1 = _mm256_loadu_ps(args.bias + j + 8);
+                acc2 = _mm256_loadu_ps(args.bias + j + 16);
+                acc3 = _mm256_loadu_ps(args.bias + j + 24);
+            } else {
+                acc0 = acc1 = acc2 = acc3 = _mm256_setzero_ps();
+            }
+            const auto* w = args.w + j;
+            for (std::size_t p = 0; p < args.k; ++p, w += args.ldw) {
+                const __m256 xv = _mm256_broadcast_ss(x + p);
+                acc0 = _mm256_fmadd_ps(xv, loadWeights(w), acc0);
+                acc1 = _mm256_fmadd_ps(xv, loadWeights(w + 8), acc1);
+                acc2 = _mm256_fmadd_ps(xv, loadWeights(w + 16), acc2);
+                acc3 = _mm256_fmadd_ps(xv, loadWeights(w + 24), acc3);
+            }
+            if (args.activation == Activation::ReLU) {
+                const __m256 zero = _mm256_setzero_ps();
+                acc0 = _mm256_max_ps(acc0, zero);
+                acc1 = _mm256_max_ps(acc1, zero);
+                acc2 = _mm256_max_ps(acc2, zero);
+                acc3 = _mm256_max_ps(acc3, zero);
+            }
+            _mm256_storeu_ps(y + j, acc0);
+            _mm256_storeu_ps(y + j + 8, acc1);
+            _mm256_storeu_ps(y + j + 16, acc2);
+            _mm256_storeu_ps(y + j + 24, acc3);
+        }
+        for (; j + 8 <= args.n; j += 8) {
+            __m256 acc = args.bias != nullptr ? _mm256_loadu_ps(args.bias + j) : _mm256_setzero_ps();
+            const auto* w = args.w + j;
+            for (std::size_t p = 0; p < args.k; ++p, w += args.ldw) {
+                acc = _mm256_fmadd_ps(_mm256_broadcast_ss(x + p), loadWeights(w), acc);
+            }
+            if (args.activation == Activation::ReLU) acc = _mm256_max_ps(acc, _mm256_setzero_ps());
+            _mm256_storeu_ps(y + j, acc);
+        }
+        if (j < args.n) {
+            Args tail = args;
+            tail.x = x;
+            tail.y = y + j;
+            tail.w = args.w + j;
+            tail.bias = args.bias != nullptr ? args.bias + j : nullptr;
+            tail.m = 1;
+            tail.n = args.n - j;
+            linearTail(tail);
+        }
+    }
+}
+
+} // namespace
+
+void linear_avx2(const LinearArgs& args) {
+    if (args.m == 0 || args.n == 0) return;
+    if (args.k == 0 || args.m < Avx2Tile::kMR) {
+        linearRows(args);
+        return;
+    }
+    GemmBlocked<Avx2Tile>::run(args);
+}
+
+void linear_fp16_avx2(const LinearFp16Args& args) {
+    if (args.m == 0 || args.n == 0) return;
+    if (args.k == 0 || args.m < Avx2Tile::kMR) {
+        linearRows(args);
+        return;
+    }
+    GemmBlocked<Avx2Tile>::run(args);
+}
+
+void linear_packed_avx2(const LinearPackedArgs& args) {
+    if (args.m == 0 || args.n == 0) return;
+    if (args.k == 0 || args.m < Avx2Tile::kMR) {
+        linearPackedRows<Avx2Tile::kNR>(args);
+        return;
+    }
+    GemmBlocked<Avx2Tile>::runPacked(args);
+}
+
+std::size_t linear_packed_panel_avx2() {
+    return Avx2Tile::kNR;
+}
+
+} // namespace infer
@@ -0,0 +1,156 @@
+#include "inference_engine/kernels/linear_avx512.h"
+
+#include "gemm_blocked.h"
+
+#include <immintrin.h>
+
+// Built with -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma (see CMakeLists.txt);
+// only reached through the kernel registry after the host was checked.
+#if !defined(__AVX512F__) || !defined(__FMA__)
+#error "linear_avx512.cpp must be compiled with AVX-512 and FMA enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+// 12 rows x 32 columns = 24 zmm accumulators, two B vectors and one broadcast out of
+// 32 registers.
+struct Avx512Tile {
+    static constexpr std::size_t kMR = 12;
+    static constexpr std::size_t kNR = 32;
+    static constexpr std::size_t kKC = 256;
+    static constexpr std::size_t kMC = 144;
+    static constexpr std::size_t kNC = 1024;
+
+    static void run(std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc,
+                    const float* bias, bool first, bool last, Activation act) {
+        __m512 acc[kMR][2];
+        if (first) {
+            const __m512 b0 = bias != nullptr ? _mm512_loadu_ps(bias) : _mm512_setzero_ps();
+            const __m512 b1 = bias != nullptr ? _mm512_loadu_ps(bias + 16) : _mm512_setzero_ps();
+            for (std::size_t r = 0; r < kMR; ++r) {
+                acc[r][0] = b0;
+                acc[r][1] = b1;
+            }
+        } else {
+            for (std::size_t r = 0; r < kMR; ++r) {
+                acc[r][0] = _mm512_loadu_ps(c + r * ldc);
+                acc[r][1] = _mm512_loadu_ps(c + r * ldc + 16);
+            }
+        }
+
+        for (std::size_t p = 0; p < kc; ++p) {
+            const __m512 b0 = _mm512_loadu_ps(b);
+            const __m512 b1 = _mm512_loadu_ps(b + 16);
+            for (std::size_t r = 0; r < kMR; ++r) {
+                const __m512 av = _mm512_set1_ps(a[r]);
+                acc[r][0] = _mm512_fmadd_ps(av, b0, acc[r][0]);
+                acc[r][1] = _mm512_fmadd_ps(av, b1, acc[r][1]);
+            }
+            a += kMR;
+            b += kNR;
+        }
+
+        if (last && act == Activation::ReLU) {
+            const __m512 zero = _mm512_setzero_ps();
+            for (std::size_t r = 0; r < kMR; ++r) {
+                acc[r][0] = _mm512_max_ps(acc[r][0], zero);
+                acc[r][1] = _mm512_max_ps(acc[r][1], zero);
+            }
+        }
+        for (std::size_t r = 0; r < kMR; ++r) {
+            _mm512_storeu_ps(c + r * ldc, acc[r][0]);
+            _mm512_storeu_ps(c + r * ldc + 16, acc[r][1]);
+        }
+    }
+};
+
+inline __m512 loadWeights(const float* w) {
+    return _mm512_loadu_ps(w);
+}
+
+inline __m512 loadWeights(const std::uint16_t* w) {
+    return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(w)));
+}
+
+inline __m512 loadWeights(const float* w, __mmask16 mask) {
+    return _mm512_maskz_loadu_ps(mask, w);
+}
+
+inline __m512 loadWeights(const std::uint16_t* w, __mmask16 mask) {
+    return _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, w));
+}
+
+// Few-row path: stream rows of w, 64 columns per step, masked for the tail.
+template <typename Args>
+void linearRows(const Args& args) {
+    const __m512 zero = _mm512_setzero_ps();
+    const bool relu = args.activation == Activation::ReLU;
+    for (std::size_t i = 0; i < args.m; ++i) {
+        const float* x = args.x + i * args.ldx;
+        float* y = args.y + i * args.ldy;
+        std::size_t j = 0;
+        for (; j + 64 <= args.n; j += 64) {
+            __m512 acc[4];
+            for (int v = 0; v < 4; ++v) {
+                acc[v] = args.bias != nullptr ? _mm512_loadu_ps(args.bias + j + 16 * v) : zero;
+            }
+            const auto* w = args.w + j;
+            for (std::size_t p = 0; p < args.k; ++p, w += args.ldw) {
+                const __m512 xv = _mm512_set1_ps(x[p]);
+                for (int v = 0; v < 4; ++v) {
+                    acc[v] = _mm512_fmadd_ps(xv, loadWeights(w + 16 * v), acc[v]);
+                }
+            }
+            for (int v = 0; v < 4; ++v) {
+                _mm512_storeu_ps(y + j + 16 * v, relu ? _mm512_max_ps(acc[v], zero) : acc[v]);
+            }
+        }
+        for (; j < args.n; j += 16) {
+            const std::size_t cols = args.n - j < 16 ? args.n - j : 16;
+            const __mmask16 mask = static_cast<__mmask16>((1u << cols) - 1u);
+            __m512 acc = args.bias != nullptr ? _mm512_maskz_loadu_ps(mask, args.bias + j) : zero;
+            const auto* w = args.w + j;
+            for (std::size_t p = 0; p < args.k; ++p, w += args.ldw) {
+                acc = _mm512_fmadd_ps(_mm512_set1_ps(x[p]), loadWeights(w, mask), acc);
+            }
+            _mm512_mask_storeu_ps(y + j, mask, relu ? _mm512_max_ps(acc, zero) : acc);
+        }
+    }
+}
+
+} // namespace
+
+void linear_avx512(const LinearArgs& args) {
+    if (args.m == 0 || args.n == 0) return;
+    if (args.k == 0 || args.m < Avx512Tile::kMR) {
+        linearRows(args);
+        return;
+    }
+    GemmBlocked<Avx512Tile>::run(args);
+}
+
+void linear_fp16_avx512(const LinearFp16Args& args) {
+    if (args.m == 0 || args.n == 0) return;
+    if (args.k == 0 || args.m < Avx512Tile::kMR) {
+        linearRows(args);
+        return;
+    }
+    GemmBlocked<Avx512Tile>::run(args);
+}
+
+void linear_packed_avx512(const LinearPackedArgs& args) {
+    if (args.m == 0 || args.n == 0) return;
+    if (args.k == 0 || args.m < Avx512Tile::kMR) {
+        linearPackedRows<Avx512Tile::kNR>(args);
+        return;
+    }
+    GemmBlocked<Avx512Tile>::runPacked(args);
+}
+
+std::size_t linear_packed_panel_avx512() {
+    return Avx512Tile::kNR;
+}
+
+} // namespace infer
@@ -0,0 +1,81 @@
+#include "inference_engine/kernels/linear_blockq.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+using inference_engine::core::Half;
+
+namespace {
+
+void checkFormat(int bits, std::size_t k, std::size_t group, const char* what) {
+    if (bits != 4 && bits != 8) {
+        throw std::invalid_argument(std::string(what) + ": bits must be 4 or 8");
+    }
+    if (group == 0 || k % group != 0) {
+        throw std::invalid_argument(std::string(what) + ": group size must divide k");
+    }
+}
+
+} // namespace
+
+std::size_t blockq_weight_bytes(std::size_t k, std::size_t n, int bits) noexcept {
+    const std::size_t panels = (n + kBlockQPanel - 1) / kBlockQPanel;
+    return panels * k * kBlockQPanel * static_cast<std::size_t>(bits) / 8;
+}
+
+std::size_t blockq_scale_count(std::size_t k, std::size_t n, std::size_t group) noexcept {
+    const std::size_t panels = (n + kBlockQPanel - 1) / kBlockQPanel;
+    return group == 0 ? 0 : panels * (k / group) * kBlockQPanel;
+}
+
+void pack_blockq_weights(const std::int8_t* q, const Half* scales, std::size_t k, std::size_t n, int bits,
+                         std::size_t group, std::uint8_t* weights_dst, Half* scales_dst) {
+    checkFormat(bits, k, group, "pack_blockq_weights");
+    constexpr std::size_t NR = kBlockQPanel;
+    const int qmax = (1 << (bits - 1)) - 1;
+    const std::size_t row_bytes = NR * static_cast<std::size_t>(bits) / 8;
+    const std::size_t groups = k / group;
+    // Padding columns hold zero: 0x88 is two offset-binary INT4 zeros.
+    std::memset(weights_dst, bits == 4 ? 0x88 : 0, blockq_weight_bytes(k, n, bits));
+    for (std::size_t i = 0; i < blockq_scale_count(k, n, group); ++i) scales_dst[i] = Half::from_bits(0);
+
+    for (std::size_t p = 0; p < k; ++p) {
+        for (std::size_t j = 0; j < n; ++j) {
+            const int v = q[p * n + j];
+            if (v < -qmax || v > qmax) {
+                throw std::invalid_argument("pack_blockq_weights: value out of range for " + std::to_string(bits) +
+                                            " bits");
+            }
+            std::uint8_t* row = weights_dst + (j / NR * k + p) * row_bytes;
+            const std::size_t c = j % NR;
+            if (bits == 8) {
+                row[c] = static_cast<std::uint8_t>(static_cast<std::int8_t>(v));
+            } else {
+                const auto nibble = static_cast<std::uint8_t>(v + 8);
+                std::uint8_t& b = row[c % (NR / 2)];
+                b = c < NR / 2 ? static_cast<std::uint8_t>((b & 0xF0) | nibble)
+                               : static_cast<std::uint8_t>((b & 0x0F) | (nibble << 4));
+            }
+        }
+    }
+    for (std::size_t g = 0; g < groups; ++g) {
+        for (std::size_t j = 0; j < n; ++j) scales_dst[(j / NR * groups + g) * NR + j % NR] = scales[g * n + j];
+    }
+}
+
+void linear_blockq(const LinearBlockQArgs& args) {
+    // Resolved once per process from the host's CPU features.
+    static LinearBlockQFn* const kernel =
+        KernelRegistry::instance().lookup<LinearBlockQFn>("linear_blockq", DataType::FP32);
+    if (args.m == 0 || args.n == 0) return;
+    checkFormat(args.bits, args.k, args.group, "linear_blockq");
+    kernel(args);
+}
+
+} // namespace infer
@@ -0,0 +1,87 @@
+#include "builtin_kernels.h"
+
+#include "blockq_gemm.h"
+#include "inference_engine/kernels/registry.h"
+
+#include <immintrin.h>
+
+#if !defined(__AVX2__) || !defined(__FMA__) || !defined(__F16C__)
+#error "linear_blockq_avx2.cpp must be compiled with AVX2, FMA and F16C enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+// A 16-column panel row is two ymm: columns 0-7 and 8-15.
+struct Avx2BlockQ {
+    struct Acc {
+        __m256 lo;
+        __m256 hi;
+    };
+
+    static Acc zero() { return {_mm256_setzero_ps(), _mm256_setzero_ps()}; }
+
+    template <int Bits>
+    static Acc weights(const std::uint8_t* row) {
+        if (Bits == 8) {
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row));
+            return {_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(b)),
+                    _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(b, 8)))};
+        }
+        // Byte c holds column c in the low nibble and column c + 8 in the high one.
+        const __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row));
+        const __m128i mask = _mm_set1_epi8(0x0F);
+        const __m256i eight = _mm256_set1_epi32(8);
+        const __m128i lo = _mm_and_si128(b, mask);
+        const __m128i hi = _mm_and_si128(_mm_srli_epi16(b, 4), mask);
+        return {_mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_cvtepu8_epi32(lo), eight)),
+                _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_cvtepu8_epi32(hi), eight))};
+    }
+
+    static Acc scales(const std::uint16_t* s) {
+        const __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+        return {_mm256_cvtph_ps(_mm256_castsi256_si128(h)), _mm256_cvtph_ps(_mm256_extracti128_si256(h, 1))};
+    }
+
+    static Acc fmadd(Acc w, float x, Acc acc) {
+        const __m256 vx = _mm256_set1_ps(x);
+        return {_mm256_fmadd_ps(w.lo, vx, acc.lo), _mm256_fmadd_ps(w.hi, vx, acc.hi)};
+    }
+
+    static Acc fmadd(Acc a, Acc b, Acc acc) {
+        return {_mm256_fmadd_ps(a.lo, b.lo, acc.lo), _mm256_fmadd_ps(a.hi, b.hi, acc.hi)};
+    }
+
+    static void store(float* y, Acc v, const float* bias, std::size_t cols, bool relu) {
+        if (cols == kBlockQPanel) {
+            if (bias != nullptr) {
+                v.lo = _mm256_add_ps(v.lo, _mm256_loadu_ps(bias));
+                v.hi = _mm256_add_ps(v.hi, _mm256_loadu_ps(bias + 8));
+            }
+            if (relu) {
+                v.lo = _mm256_max_ps(v.lo, _mm256_setzero_ps());
+                v.hi = _mm256_max_ps(v.hi, _mm256_setzero_ps());
+            }
+            _mm256_storeu_ps(y, v.lo);
+            _mm256_storeu_ps(y + 8, v.hi);
+            return;
+        }
+        alignas(32) float tmp[kBlockQPanel];
+        _mm256_store_ps(tmp, v.lo);
+        _mm256_store_ps(tmp + 8, v.hi);
+        for (std::size_t c = 0; c < cols; ++c) {
+            const float f = tmp[c] + (bias != nullptr ? bias[c] : 0.0f);
+            y[c] = relu && f < 0.0f ? 0.0f : f;
+        }
+    }
+};
+
+} // namespace
+
+void registerLinearBlockQKernelsAvx2(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<LinearBlockQFn>("linear_blockq", DataType::FP32, Isa::AVX2, &BlockQGemm<Avx2BlockQ>::linear);
+}
+
+} // namespace infer
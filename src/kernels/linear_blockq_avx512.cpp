@@ -0,0 +1,56 @@
+#include "builtin_kernels.h"
+
+#include "blockq_gemm.h"
+#include "inference_engine/kernels/registry.h"
+
+#include <immintrin.h>
+
+#if !defined(__AVX512F__) || !defined(__AVX512BW__)
+#error "linear_blockq_avx512.cpp must be compiled with AVX-512F/BW enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+// A 16-column panel row is one zmm; partial panels use masked bias loads and stores.
+struct Avx512BlockQ {
+    using Acc = __m512;
+
+    static Acc zero() { return _mm512_setzero_ps(); }
+
+    template <int Bits>
+    static Acc weights(const std::uint8_t* row) {
+        if (Bits == 8) {
+            return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row))));
+        }
+        // Low nibbles are columns 0-7, high nibbles columns 8-15.
+        const __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row));
+        const __m128i mask = _mm_set1_epi8(0x0F);
+        const __m128i q = _mm_unpacklo_epi64(_mm_and_si128(b, mask), _mm_and_si128(_mm_srli_epi16(b, 4), mask));
+        return _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_cvtepu8_epi32(q), _mm512_set1_epi32(8)));
+    }
+
+    static Acc scales(const std::uint16_t* s) {
+        return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(s)));
+    }
+
+    static Acc fmadd(Acc w, float x, Acc acc) { return _mm512_fmadd_ps(w, _mm512_set1_ps(x), acc); }
+    static Acc fmadd(Acc a, Acc b, Acc acc) { return _mm512_fmadd_ps(a, b, acc); }
+
+    static void store(float* y, Acc v, const float* bias, std::size_t cols, bool relu) {
+        const __mmask16 m = static_cast<__mmask16>((1u << cols) - 1u);
+        if (bias != nullptr) v = _mm512_add_ps(v, _mm512_maskz_loadu_ps(m, bias));
+        if (relu) v = _mm512_max_ps(v, _mm512_setzero_ps());
+        _mm512_mask_storeu_ps(y, m, v);
+    }
+};
+
+} // namespace
+
+void registerLinearBlockQKernelsAvx512(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<LinearBlockQFn>("linear_blockq", DataType::FP32, Isa::AVX512, &BlockQGemm<Avx512BlockQ>::linear);
+}
+
+} // namespace infer
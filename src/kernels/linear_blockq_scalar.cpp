@@ -0,0 +1,64 @@
+#include "inference_engine/kernels/linear_blockq.h"
+
+#include "blockq_gemm.h"
+
+#include <algorithm>
+
+namespace infer {
+
+namespace {
+
+struct ScalarBlockQ {
+    struct Acc {
+        float v[kBlockQPanel];
+    };
+
+    static Acc zero() { return Acc{}; }
+
+    template <int Bits>
+    static Acc weights(const std::uint8_t* row) {
+        Acc a;
+        constexpr std::size_t kHalf = kBlockQPanel / 2;
+        for (std::size_t c = 0; c < kBlockQPanel; ++c) {
+            if (Bits == 8) {
+                a.v[c] = static_cast<float>(static_cast<std::int8_t>(row[c]));
+            } else {
+                const std::uint8_t b = row[c % kHalf];
+                a.v[c] = static_cast<float>((c < kHalf ? b & 0x0F : b >> 4) - 8);
+            }
+        }
+        return a;
+    }
+
+    static Acc scales(const std::uint16_t* s) {
+        Acc a;
+        using inference_engine::core::Half;
+        for (std::size_t c = 0; c < kBlockQPanel; ++c) a.v[c] = Half::from_bits(s[c]).to_float();
+        return a;
+    }
+
+    static Acc fmadd(const Acc& w, float x, Acc acc) {
+        for (std::size_t c = 0; c < kBlockQPanel; ++c) acc.v[c] += w.v[c] * x;
+        return acc;
+    }
+
+    static Acc fmadd(const Acc& a, const Acc& b, Acc acc) {
+        for (std::size_t c = 0; c < kBlockQPanel; ++c) acc.v[c] += a.v[c] * b.v[c];
+        return acc;
+    }
+
+    static void store(float* y, const Acc& v, const float* bias, std::size_t cols, bool relu) {
+        for (std::size_t c = 0; c < cols; ++c) {
+            const float f = v.v[c] + (bias != nullptr ? bias[c] : 0.0f);
+            y[c] = relu ? std::max(0.0f, f) : f;
+        }
+    }
+};
+
+} // namespace
+
+void linear_blockq_scalar(const LinearBlockQArgs& args) {
+    BlockQGemm<ScalarBlockQ>::linear(args);
+}
+
+} // namespace infer
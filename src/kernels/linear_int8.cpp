@@ -0,0 +1,55 @@
+#include "inference_engine/kernels/linear_int8.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <stdexcept>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+
+PackedInt8Weights pack_int8_weights(const std::int8_t* w, std::size_t k, std::size_t n) {
+    constexpr std::size_t NR = PackedInt8Weights::kPanel;
+    PackedInt8Weights packed;
+    packed.k = k;
+    packed.n = n;
+    packed.k_groups = (k + 3) / 4;
+    packed.panels = (n + NR - 1) / NR;
+    packed.data.assign(packed.panels * packed.k_groups * NR * 4, 0);
+    packed.col_sums.assign(packed.panels * NR, 0);
+
+    for (std::size_t p = 0; p < k; ++p) {
+        for (std::size_t j = 0; j < n; ++j) {
+            const std::int8_t v = w[p * n + j];
+            if (v == -128) {
+                throw std::invalid_argument("pack_int8_weights: weights must lie in [-127, 127]");
+            }
+            const std::size_t panel = j / NR;
+            const std::size_t idx = ((panel * packed.k_groups + p / 4) * NR + j % NR) * 4 + p % 4;
+            packed.data[idx] = v;
+            packed.col_sums[j] += v;
+        }
+    }
+    return packed;
+}
+
+void linear_int8(const LinearInt8Args& args) {
+    // Resolved once per process from the host's CPU features.
+    static LinearInt8Fn* const kernel = KernelRegistry::instance().lookup<LinearInt8Fn>("linear", DataType::INT8);
+    if (args.m == 0 || args.n == 0) return;
+    if (args.w == nullptr || args.scales == nullptr) {
+        throw std::invalid_argument("linear_int8: packed weights and scales are required");
+    }
+    if (args.x_dtype != DataType::INT8 && args.x_dtype != DataType::UINT8) {
+        throw std::invalid_argument("linear_int8: activations must be INT8 or UINT8");
+    }
+    if (args.y_dtype != DataType::INT8 && args.y_dtype != DataType::UINT8 && args.y_dtype != DataType::FP32) {
+        throw std::invalid_argument("linear_int8: output must be INT8, UINT8 or FP32");
+    }
+    if (args.col_begin % PackedInt8Weights::kPanel != 0 || args.col_begin + args.n > args.w->n) {
+        throw std::invalid_argument("linear_int8: column range does not match the packed weights");
+    }
+    kernel(args);
+}
+
+} // namespace infer
@@ -0,0 +1,76 @@
+#include "builtin_kernels.h"
+
+#include "gemm_int8.h"
+#include "inference_engine/kernels/registry.h"
+
+#include <immintrin.h>
+
+#if !defined(__AVX2__)
+#error "linear_int8_avx2.cpp must be compiled with AVX2 enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+// 4 rows x 16 columns = 8 ymm accumulators. pmaddubsw multiplies u8 by s8 into
+// saturating s16 pairs, so signed activations go in as |x| with their sign moved
+// onto the weights: |x| * w <= 128 * 127 per product and the pair sum of 32512
+// never saturates (this is why weights exclude -128).
+struct Avx2Int8Tile {
+    static constexpr std::size_t kMR = 4;
+    static constexpr bool kUnsignedA = false;
+
+    static inline __m256i dot(__m256i acc, __m256i x, __m256i w, __m256i ones) {
+        const __m256i prod = _mm256_maddubs_epi16(_mm256_sign_epi8(x, x), _mm256_sign_epi8(w, x));
+        return _mm256_add_epi32(acc, _mm256_madd_epi16(prod, ones));
+    }
+
+    static void run(std::size_t k_groups, const std::uint8_t* a, const std::int8_t* panel, std::int32_t* acc) {
+        const __m256i ones = _mm256_set1_epi16(1);
+        __m256i c00 = _mm256_setzero_si256(), c01 = _mm256_setzero_si256();
+        __m256i c10 = _mm256_setzero_si256(), c11 = _mm256_setzero_si256();
+        __m256i c20 = _mm256_setzero_si256(), c21 = _mm256_setzero_si256();
+        __m256i c30 = _mm256_setzero_si256(), c31 = _mm256_setzero_si256();
+        for (std::size_t g = 0; g < k_groups; ++g) {
+            const __m256i w0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(panel));
+            const __m256i w1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(panel + 32));
+            __m256i x = _mm256_set1_epi32(loadGroup(a + 0));
+            c00 = dot(c00, x, w0, ones);
+            c01 = dot(c01, x, w1, ones);
+            x = _mm256_set1_epi32(loadGroup(a + 4));
+            c10 = dot(c10, x, w0, ones);
+            c11 = dot(c11, x, w1, ones);
+            x = _mm256_set1_epi32(loadGroup(a + 8));
+            c20 = dot(c20, x, w0, ones);
+            c21 = dot(c21, x, w1, ones);
+            x = _mm256_set1_epi32(loadGroup(a + 12));
+            c30 = dot(c30, x, w0, ones);
+            c31 = dot(c31, x, w1, ones);
+            a += kMR * 4;
+            panel += 64;
+        }
+        auto* out = reinterpret_cast<__m256i*>(acc);
+        _mm256_store_si256(out + 0, c00);
+        _mm256_store_si256(out + 1, c01);
+        _mm256_store_si256(out + 2, c10);
+        _mm256_store_si256(out + 3, c11);
+        _mm256_store_si256(out + 4, c20);
+        _mm256_store_si256(out + 5, c21);
+        _mm256_store_si256(out + 6, c30);
+        _mm256_store_si256(out + 7, c31);
+    }
+};
+
+void linearInt8(const LinearInt8Args& args) {
+    if (args.m == 0 || args.n == 0) return;
+    Int8Gemm<Avx2Int8Tile>::run(args);
+}
+
+} // namespace
+
+void registerLinearInt8KernelsAvx2(KernelRegistry& r) {
+    r.add<LinearInt8Fn>("linear", DataType::INT8, Isa::AVX2, &linearInt8);
+}
+
+} // namespace infer
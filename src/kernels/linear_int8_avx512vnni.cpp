@@ -0,0 +1,63 @@
+#include "builtin_kernels.h"
+
+#include "gemm_int8.h"
+#include "inference_engine/kernels/registry.h"
+
+#include <immintrin.h>
+
+#if !defined(__AVX512F__) || !defined(__AVX512VNNI__)
+#error "linear_int8_avx512vnni.cpp must be compiled with AVX-512 VNNI enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+// 8 rows x 16 columns = 8 zmm accumulators. vpdpbusd multiplies u8 activations by
+// s8 weights and adds each group of four products straight into an int32 lane,
+// without the intermediate s16 saturation of pmaddubsw.
+struct Avx512VnniInt8Tile {
+    static constexpr std::size_t kMR = 8;
+    static constexpr bool kUnsignedA = true;
+
+    static void run(std::size_t k_groups, const std::uint8_t* a, const std::int8_t* panel, std::int32_t* acc) {
+        __m512i c0 = _mm512_setzero_si512(), c1 = _mm512_setzero_si512();
+        __m512i c2 = _mm512_setzero_si512(), c3 = _mm512_setzero_si512();
+        __m512i c4 = _mm512_setzero_si512(), c5 = _mm512_setzero_si512();
+        __m512i c6 = _mm512_setzero_si512(), c7 = _mm512_setzero_si512();
+        for (std::size_t g = 0; g < k_groups; ++g) {
+            const __m512i w = _mm512_loadu_si512(panel);
+            c0 = _mm512_dpbusd_epi32(c0, _mm512_set1_epi32(loadGroup(a + 0)), w);
+            c1 = _mm512_dpbusd_epi32(c1, _mm512_set1_epi32(loadGroup(a + 4)), w);
+            c2 = _mm512_dpbusd_epi32(c2, _mm512_set1_epi32(loadGroup(a + 8)), w);
+            c3 = _mm512_dpbusd_epi32(c3, _mm512_set1_epi32(loadGroup(a + 12)), w);
+            c4 = _mm512_dpbusd_epi32(c4, _mm512_set1_epi32(loadGroup(a + 16)), w);
+            c5 = _mm512_dpbusd_epi32(c5, _mm512_set1_epi32(loadGroup(a + 20)), w);
+            c6 = _mm512_dpbusd_epi32(c6, _mm512_set1_epi32(loadGroup(a + 24)), w);
+            c7 = _mm512_dpbusd_epi32(c7, _mm512_set1_epi32(loadGroup(a + 28)), w);
+            a += kMR * 4;
+            panel += 64;
+        }
+        _mm512_store_si512(acc + 0 * 16, c0);
+        _mm512_store_si512(acc + 1 * 16, c1);
+        _mm512_store_si512(acc + 2 * 16, c2);
+        _mm512_store_si512(acc + 3 * 16, c3);
+        _mm512_store_si512(acc + 4 * 16, c4);
+        _mm512_store_si512(acc + 5 * 16, c5);
+        _mm512_store_si512(acc + 6 * 16, c6);
+        _mm512_store_si512(acc + 7 * 16, c7);
+    }
+};
+
+void linearInt8(const LinearInt8Args& args) {
+    if (args.m == 0 || args.n == 0) return;
+    Int8Gemm<Avx512VnniInt8Tile>::run(args);
+}
+
+} // namespace
+
+void registerLinearInt8KernelsAvx512Vnni(KernelRegistry& r) {
+    r.add<LinearInt8Fn>("linear", DataType::INT8, Isa::AVX512_VNNI, &linearInt8);
+}
+
+} // namespace infer
@@ -0,0 +1,65 @@
+#include "builtin_kernels.h"
+
+#include "gemm_int8.h"
+#include "inference_engine/kernels/registry.h"
+
+#include <arm_neon.h>
+
+// Built with the dot-product extension (armv8.2-a+dotprod); registered only for
+// hosts that report it.
+#if !defined(__aarch64__) || !defined(__ARM_FEATURE_DOTPROD)
+#error "linear_int8_neon.cpp must be compiled for AArch64 with the dot-product extension"
+#endif
+
+namespace infer {
+
+namespace {
+
+// 4 rows x 16 columns = 16 q accumulators. One 16-byte load holds a 4-byte group
+// for each of the four rows, and sdot's lane form broadcasts it per row.
+struct NeonDotInt8Tile {
+    static constexpr std::size_t kMR = 4;
+    static constexpr bool kUnsignedA = false;
+
+    static void run(std::size_t k_groups, const std::uint8_t* a, const std::int8_t* panel, std::int32_t* acc) {
+        int32x4_t c[kMR][4];
+        for (std::size_t r = 0; r < kMR; ++r) {
+            for (int v = 0; v < 4; ++v) c[r][v] = vdupq_n_s32(0);
+        }
+        for (std::size_t g = 0; g < k_groups; ++g) {
+            const int8x16_t x = vreinterpretq_s8_u8(vld1q_u8(a));
+            const int8x16_t w0 = vld1q_s8(panel);
+            const int8x16_t w1 = vld1q_s8(panel + 16);
+            const int8x16_t w2 = vld1q_s8(panel + 32);
+            const int8x16_t w3 = vld1q_s8(panel + 48);
+#define IE_DOT_ROW(r)                                    \
+    c[r][0] = vdotq_laneq_s32(c[r][0], w0, x, r);        \
+    c[r][1] = vdotq_laneq_s32(c[r][1], w1, x, r);        \
+    c[r][2] = vdotq_laneq_s32(c[r][2], w2, x, r);        \
+    c[r][3] = vdotq_laneq_s32(c[r][3], w3, x, r)
+            IE_DOT_ROW(0);
+            IE_DOT_ROW(1);
+            IE_DOT_ROW(2);
+            IE_DOT_ROW(3);
+#undef IE_DOT_ROW
+            a += kMR * 4;
+            panel += 64;
+        }
+        for (std::size_t r = 0; r < kMR; ++r) {
+            for (int v = 0; v < 4; ++v) vst1q_s32(acc + r * 16 + v * 4, c[r][v]);
+        }
+    }
+};
+
+void linearInt8(const LinearInt8Args& args) {
+    if (args.m == 0 || args.n == 0) return;
+    Int8Gemm<NeonDotInt8Tile>::run(args);
+}
+
+} // namespace
+
+void registerLinearInt8KernelsNeonDotprod(KernelRegistry& r) {
+    r.add<LinearInt8Fn>("linear", DataType::INT8, Isa::NEON_DOTPROD, &linearInt8);
+}
+
+} // namespace infer
@@ -0,0 +1,37 @@
+#include "inference_engine/kernels/linear_int8.h"
+
+#include "gemm_int8.h"
+
+namespace infer {
+
+namespace {
+
+struct ScalarInt8Tile {
+    static constexpr std::size_t kMR = 4;
+    static constexpr bool kUnsignedA = false;
+
+    static void run(std::size_t k_groups, const std::uint8_t* a, const std::int8_t* panel, std::int32_t* acc) {
+        constexpr std::size_t NR = PackedInt8Weights::kPanel;
+        for (std::size_t i = 0; i < kMR * NR; ++i) acc[i] = 0;
+        for (std::size_t g = 0; g < k_groups; ++g) {
+            for (std::size_t r = 0; r < kMR; ++r) {
+                const auto* x = reinterpret_cast<const std::int8_t*>(a + r * 4);
+                for (std::size_t c = 0; c < NR; ++c) {
+                    const std::int8_t* w = panel + c * 4;
+                    acc[r * NR + c] += x[0] * w[0] + x[1] * w[1] + x[2] * w[2] + x[3] * w[3];
+                }
+            }
+            a += kMR * 4;
+            panel += NR * 4;
+        }
+    }
+};
+
+} // namespace
+
+void linear_int8_scalar(const LinearInt8Args& args) {
+    if (args.m == 0 || args.n == 0) return;
+    Int8Gemm<ScalarInt8Tile>::run(args);
+}
+
+} // namespace infer
@@ -0,0 +1,115 @@
+#include "inference_engine/kernels/linear_neon.h"
+
+#include "gemm_blocked.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__)
+#error "linear_neon.cpp targets AArch64 Advanced SIMD"
+#endif
+
+namespace infer {
+
+namespace {
+
+// 8 rows x 12 columns = 24 q-register accumulators; the 8 A values of a k step are
+// loaded as two vectors and applied with lane-indexed FMLA.
+struct NeonTile {
+    static constexpr std::size_t kMR = 8;
+    static constexpr std::size_t kNR = 12;
+    static constexpr std::size_t kKC = 256;
+    static constexpr std::size_t kMC = 64;
+    static constexpr std::size_t kNC = 1020;
+
+    static void run(std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc,
+                    const float* bias, bool first, bool last, Activation act) {
+        float32x4_t acc[kMR][3];
+        if (first) {
+            const float32x4_t zero = vdupq_n_f32(0.0f);
+            const float32x4_t b0 = bias != nullptr ? vld1q_f32(bias) : zero;
+            const float32x4_t b1 = bias != nullptr ? vld1q_f32(bias + 4) : zero;
+            const float32x4_t b2 = bias != nullptr ? vld1q_f32(bias + 8) : zero;
+            for (std::size_t r = 0; r < kMR; ++r) {
+                acc[r][0] = b0;
+                acc[r][1] = b1;
+                acc[r][2] = b2;
+            }
+        } else {
+            for (std::size_t r = 0; r < kMR; ++r) {
+                acc[r][0] = vld1q_f32(c + r * ldc);
+                acc[r][1] = vld1q_f32(c + r * ldc + 4);
+                acc[r][2] = vld1q_f32(c + r * ldc + 8);
+            }
+        }
+
+        for (std::size_t p = 0; p < kc; ++p) {
+            const float32x4_t b0 = vld1q_f32(b);
+            const float32x4_t b1 = vld1q_f32(b + 4);
+            const float32x4_t b2 = vld1q_f32(b + 8);
+            const float32x4_t a_lo = vld1q_f32(a);
+            const float32x4_t a_hi = vld1q_f32(a + 4);
+#define IE_NEON_ROW(r, av, lane)                               \
+    acc[r][0] = vfmaq_laneq_f32(acc[r][0], b0, av, lane);      \
+    acc[r][1] = vfmaq_laneq_f32(acc[r][1], b1, av, lane);      \
+    acc[r][2] = vfmaq_laneq_f32(acc[r][2], b2, av, lane)
+            IE_NEON_ROW(0, a_lo, 0);
+            IE_NEON_ROW(1, a_lo, 1);
+            IE_NEON_ROW(2, a_lo, 2);
+            IE_NEON_ROW(3, a_lo, 3);
+            IE_NEON_ROW(4, a_hi, 0);
+            IE_NEON_ROW(5, a_hi, 1);
+            IE_NEON_ROW(6, a_hi, 2);
+            IE_NEON_ROW(7, a_hi, 3);
+#undef IE_NEON_ROW
+            a += kMR;
+            b += kNR;
+        }
+
+        if (last && act == Activation::ReLU) {
+            const float32x4_t zero = vdupq_n_f32(0.0f);
+            for (std::size_t r = 0; r < kMR; ++r) {
+                for (int v = 0; v < 3; ++v) acc[r][v] = vmaxq_f32(acc[r][v], zero);
+            }
+        }
+        for (std::size_t r = 0; r < kMR; ++r) {
+            vst1q_f32(c + r * ldc, acc[r][0]);
+            vst1q_f32(c + r * ldc + 4, acc[r][1]);
+            vst1q_f32(c + r * ldc + 8, acc[r][2]);
+        }
+    }
+};
+
+} // namespace
+
+void linear_neon(const LinearArgs& args) {
+    if (args.m == 0 || args.n == 0) return;
+    if (args.k == 0 || args.m < NeonTile::kMR) {
+        linearRowsPortable(args);
+        return;
+    }
+    GemmBlocked<NeonTile>::run(args);
+}
+
+void linear_fp16_neon(const LinearFp16Args& args) {
+    if (args.m == 0 || args.n == 0) return;
+    if (args.k == 0 || args.m < NeonTile::kMR) {
+        linearRowsPortable(args);
+        return;
+    }
+    GemmBlocked<NeonTile>::run(args);
+}
+
+void linear_packed_neon(const LinearPackedArgs& args) {
+    if (args.m == 0 || args.n == 0) return;
+    if (args.k == 0 || args.m < NeonTile::kMR) {
+        linearPackedRows<NeonTile::kNR>(args);
+        return;
+    }
+    GemmBlocked<NeonTile>::runPacked(args);
+}
+
+std::size_t linear_packed_panel_neon() {
+    return NeonTile::kNR;
+}
+
+} // namespace infer
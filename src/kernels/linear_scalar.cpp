@@ -0,0 +1,96 @@
+#include "inference_engine/kernels/linear_scalar.h"
+
+#include "inference_engine/core/half.h"
+
+#include <algorithm>
+
+namespace infer {
+
+void linear_scalar(const float* input, const float* weights, const float* bias, float* output,
+                   int input_size, int output_size) {
+    LinearArgs args;
+    args.x = input;
+    args.ldx = static_cast<std::size_t>(input_size);
+    args.w = weights;
+    args.ldw = static_cast<std::size_t>(output_size);
+    args.bias = bias;
+    args.y = output;
+    args.ldy = static_cast<std::size_t>(output_size);
+    args.m = 1;
+    args.k = static_cast<std::size_t>(input_size);
+    args.n = static_cast<std::size_t>(output_size);
+    linear_scalar(args);
+}
+
+void linear_scalar(const LinearArgs& args) {
+    for (std::size_t i = 0; i < args.m; ++i) {
+        const float* x = args.x + i * args.ldx;
+        float* y = args.y + i * args.ldy;
+        for (std::size_t j = 0; j < args.n; ++j) {
+            y[j] = args.bias != nullptr ? args.bias[j] : 0.0f;
+        }
+        // i-k-j order: every inner loop walks one contiguous row of w.
+        for (std::size_t p = 0; p < args.k; ++p) {
+            const float xv = x[p];
+            const float* w = args.w + p * args.ldw;
+            for (std::size_t j = 0; j < args.n; ++j) {
+                y[j] += xv * w[j];
+            }
+        }
+        if (args.activation == Activation::ReLU) {
+            for (std::size_t j = 0; j < args.n; ++j) {
+                y[j] = std::max(0.0f, y[j]);
+            }
+        }
+    }
+}
+
+void linear_fp16_scalar(const LinearFp16Args& args) {
+    for (std::size_t i = 0; i < args.m; ++i) {
+        const float* x = args.x + i * args.ldx;
+        float* y = args.y + i * args.ldy;
+        for (std::size_t j = 0; j < args.n; ++j) {
+            y[j] = args.bias != nullptr ? args.bias[j] : 0.0f;
+        }
+        for (std::size_t p = 0; p < args.k; ++p) {
+            const float xv = x[p];
+            const std::uint16_t* w = args.w + p * args.ldw;
+            for (std::size_t j = 0; j < args.n; ++j) {
+                y[j] += xv * inference_engine::core::fp16_to_fp32(w[j]);
+            }
+        }
+        if (args.activation == Activation::ReLU) {
+            for (std::size_t j = 0; j < args.n; ++j) {
+                y[j] = std::max(0.0f, y[j]);
+            }
+        }
+    }
+}
+
+void linear_packed_scalar(const LinearPackedArgs& args) {
+    constexpr std::size_t kPanel = 16;
+    for (std::size_t j0 = 0; j0 < args.n; j0 += kPanel) {
+        const std::size_t cols = std::min(kPanel, args.n - j0);
+        const float* panel = args.w + j0 * args.k;
+        for (std::size_t i = 0; i < args.m; ++i) {
+            const float* x = args.x + i * args.ldx;
+            float acc[kPanel] = {};
+            for (std::size_t c = 0; c < cols; ++c) acc[c] = args.bias != nullptr ? args.bias[j0 + c] : 0.0f;
+            for (std::size_t p = 0; p < args.k; ++p) {
+                const float xv = x[p];
+                const float* w = panel + p * kPanel;
+                for (std::size_t c = 0; c < kPanel; ++c) acc[c] += xv * w[c];
+            }
+            float* y = args.y + i * args.ldy + j0;
+            for (std::size_t c = 0; c < cols; ++c) {
+                y[c] = args.activation == Activation::ReLU ? std::max(0.0f, acc[c]) : acc[c];
+            }
+        }
+    }
+}
+
+std::size_t linear_packed_panel_scalar() {
+    return 16;
+}
+
+} // namespace infer
@@ -0,0 +1,171 @@
+#include "inference_engine/kernels/linear_sparse.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+
+namespace {
+
+constexpr std::size_t NR = kSparsePanel;
+
+void checkPattern(const SparsePattern& pattern, std::size_t k, const char* what) {
+    if (!sparse_pattern_supported(pattern, k)) {
+        throw std::invalid_argument(std::string(what) + ": unsupported sparse pattern " +
+                                    sparse_pattern_name(pattern) + " for in_dim " + std::to_string(k));
+    }
+}
+
+// Whether block (block row b, input block ib) of w[k, n] holds a non-zero weight.
+bool blockNonZero(const float* w, std::size_t n, const SparsePattern& p, std::size_t b, std::size_t ib) {
+    const std::size_t col_end = std::min(n, (b + 1) * p.block_out);
+    for (std::size_t q = ib * p.block_in; q < (ib + 1) * p.block_in; ++q) {
+        for (std::size_t j = b * p.block_out; j < col_end; ++j) {
+            if (w[q * n + j] != 0.0f) return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+std::string sparse_pattern_name(const SparsePattern& p) {
+    if (p.format == SparseFormat::NM) return std::to_string(p.n) + ":" + std::to_string(p.m);
+    return "bcsr" + std::to_string(p.block_out) + "x" + std::to_string(p.block_in);
+}
+
+bool sparse_pattern_supported(const SparsePattern& p, std::size_t k) noexcept {
+    if (p.format == SparseFormat::NM) {
+        return (p.m == 4 || p.m == 8) && p.n >= 1 && p.n < p.m && k % p.m == 0;
+    }
+    const bool shape = (p.block_out == 8 && p.block_in == 1) || (p.block_out == 4 && p.block_in == 4);
+    return shape && k % p.block_in == 0;
+}
+
+bool fits_sparse_pattern(const float* w, std::size_t k, std::size_t n, const SparsePattern& p) {
+    if (!sparse_pattern_supported(p, k)) return false;
+    if (p.format == SparseFormat::BlockCsr) return true;
+    for (std::size_t p0 = 0; p0 < k; p0 += p.m) {
+        for (std::size_t j = 0; j < n; ++j) {
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < p.m; ++i) kept += w[(p0 + i) * n + j] != 0.0f;
+            if (kept > p.n) return false;
+        }
+    }
+    return true;
+}
+
+std::size_t sparse_stored_weights(const float* w, std::size_t k, std::size_t n, const SparsePattern& p) {
+    if (!sparse_pattern_supported(p, k)) return 0;
+    if (p.format == SparseFormat::NM) return k / p.m * p.n * n;
+    std::size_t blocks = 0;
+    for (std::size_t b = 0; b < sparse_block_rows(n, p); ++b) {
+        for (std::size_t ib = 0; ib < k / p.block_in; ++ib) blocks += blockNonZero(w, n, p, b, ib);
+    }
+    return blocks * p.block_out * p.block_in;
+}
+
+std::size_t sparse_nm_value_count(std::size_t k, std::size_t n, const SparsePattern& p) noexcept {
+    if (p.format != SparseFormat::NM || p.m == 0) return 0;
+    return (n + NR - 1) / NR * (k / p.m) * p.n * NR;
+}
+
+std::size_t sparse_block_rows(std::size_t n, const SparsePattern& p) noexcept {
+    if (p.format != SparseFormat::BlockCsr || p.block_out == 0) return 0;
+    return (n + p.block_out - 1) / p.block_out;
+}
+
+SparseWeights pack_sparse_weights(const float* w, std::size_t k, std::size_t n, const SparsePattern& p) {
+    checkPattern(p, k, "pack_sparse_weights");
+    SparseWeights out;
+    out.pattern = p;
+    if (p.format == SparseFormat::NM) {
+        const std::size_t runs = k / p.m;
+        out.values.assign(sparse_nm_value_count(k, n, p), 0.0f);
+        out.indices.assign(out.values.size(), 0);
+        for (std::size_t j = 0; j < n; ++j) {
+            for (std::size_t r = 0; r < runs; ++r) {
+                std::size_t t = 0;
+                for (std::size_t i = 0; i < p.m; ++i) {
+                    const float v = w[(r * p.m + i) * n + j];
+                    if (v == 0.0f) continue;
+                    if (t == p.n) {
+                        throw std::invalid_argument("pack_sparse_weights: column " + std::to_string(j) +
+                                                    " keeps more than " + sparse_pattern_name(p) + " at row " +
+                                                    std::to_string(r * p.m));
+                    }
+                    const std::size_t slot = ((j / NR * runs + r) * p.n + t++) * NR + j % NR;
+                    out.values[slot] = v;
+                    out.indices[slot] = static_cast<std::uint8_t>(i);
+                }
+            }
+        }
+        return out;
+    }
+
+    const std::size_t block_rows = sparse_block_rows(n, p);
+    const std::size_t block_size = p.block_out * p.block_in;
+    out.row_ptr.reserve(block_rows + 1);
+    out.row_ptr.push_back(0);
+    for (std::size_t b = 0; b < block_rows; ++b) {
+        for (std::size_t ib = 0; ib < k / p.block_in; ++ib) {
+            if (!blockNonZero(w, n, p, b, ib)) continue;
+            out.col_idx.push_back(static_cast<std::uint32_t>(ib));
+            const std::size_t base = out.values.size();
+            out.values.resize(base + block_size, 0.0f);
+            for (std::size_t q = 0; q < p.block_in; ++q) {
+                for (std::size_t o = 0; o < p.block_out && b * p.block_out + o < n; ++o) {
+                    out.values[base + q * p.block_out + o] = w[(ib * p.block_in + q) * n + b * p.block_out + o];
+                }
+            }
+        }
+        out.row_ptr.push_back(static_cast<std::uint32_t>(out.col_idx.size()));
+    }
+    return out;
+}
+
+std::vector<float> unpack_sparse_weights(const SparsePattern& p, std::size_t k, std::size_t n, const float* values,
+                                         const std::uint8_t* indices, const std::uint32_t* row_ptr,
+                                         const std::uint32_t* col_idx) {
+    checkPattern(p, k, "unpack_sparse_weights");
+    std::vector<float> w(k * n, 0.0f);
+    if (p.format == SparseFormat::NM) {
+        const std::size_t runs = k / p.m;
+        for (std::size_t j = 0; j < n; ++j) {
+            for (std::size_t r = 0; r < runs; ++r) {
+                for (std::size_t t = 0; t < p.n; ++t) {
+                    const std::size_t slot = ((j / NR * runs + r) * p.n + t) * NR + j % NR;
+                    if (values[slot] != 0.0f) w[(r * p.m + indices[slot]) * n + j] = values[slot];
+                }
+            }
+        }
+        return w;
+    }
+    for (std::size_t b = 0; b < sparse_block_rows(n, p); ++b) {
+        for (std::uint32_t e = row_ptr[b]; e < row_ptr[b + 1]; ++e) {
+            const float* block = values + static_cast<std::size_t>(e) * p.block_out * p.block_in;
+            for (std::size_t q = 0; q < p.block_in; ++q) {
+                for (std::size_t o = 0; o < p.block_out && b * p.block_out + o < n; ++o) {
+                    w[(col_idx[e] * p.block_in + q) * n + b * p.block_out + o] = block[q * p.block_out + o];
+                }
+            }
+        }
+    }
+    return w;
+}
+
+void linear_sparse(const LinearSparseArgs& args) {
+    // Resolved once per process from the host's CPU features.
+    static LinearSparseFn* const kernel =
+        KernelRegistry::instance().lookup<LinearSparseFn>("linear_sparse", DataType::FP32);
+    if (args.m == 0 || args.n == 0) return;
+    checkPattern(args.pattern, args.k, "linear_sparse");
+    kernel(args);
+}
+
+} // namespace infer
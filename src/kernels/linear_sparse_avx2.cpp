@@ -0,0 +1,113 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+#include "sparse_gemm.h"
+
+#include <immintrin.h>
+
+#if !defined(__AVX2__) || !defined(__FMA__)
+#error "linear_sparse_avx2.cpp must be compiled with AVX2 and FMA enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+// A 16-column panel is two ymm: columns 0-7 and 8-15.
+struct Avx2Sparse {
+    struct Acc {
+        __m256 lo;
+        __m256 hi;
+    };
+    struct Idx {
+        __m256i lo;
+        __m256i hi;
+    };
+    using Acc8 = __m256;
+
+    static Acc zero() { return {_mm256_setzero_ps(), _mm256_setzero_ps()}; }
+    static Acc load(const float* v) { return {_mm256_loadu_ps(v), _mm256_loadu_ps(v + 8)}; }
+
+    static Idx indices(const std::uint8_t* idx) {
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx));
+        return {_mm256_cvtepu8_epi32(b), _mm256_cvtepu8_epi32(_mm_srli_si128(b, 8))};
+    }
+
+    // Lanes past M are never selected, so M = 4 loads only the run's 4 floats.
+    template <std::size_t M>
+    static Acc permute(const float* x, Idx idx) {
+        const __m256 v = M == 4 ? _mm256_castps128_ps256(_mm_loadu_ps(x)) : _mm256_loadu_ps(x);
+        return {_mm256_permutevar8x32_ps(v, idx.lo), _mm256_permutevar8x32_ps(v, idx.hi)};
+    }
+
+    static Acc spread4(const float* x) {
+        const __m256 v = _mm256_castps128_ps256(_mm_loadu_ps(x));
+        return {_mm256_permutevar8x32_ps(v, _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1)),
+                _mm256_permutevar8x32_ps(v, _mm256_setr_epi32(2, 2, 2, 2, 3, 3, 3, 3))};
+    }
+
+    static Acc fmadd(Acc a, Acc b, Acc acc) {
+        return {_mm256_fmadd_ps(a.lo, b.lo, acc.lo), _mm256_fmadd_ps(a.hi, b.hi, acc.hi)};
+    }
+
+    static void finish(float* y, const float* v, const float* bias, std::size_t cols, bool relu) {
+        for (std::size_t c = 0; c < cols; ++c) {
+            const float f = v[c] + (bias != nullptr ? bias[c] : 0.0f);
+            y[c] = relu && f < 0.0f ? 0.0f : f;
+        }
+    }
+
+    static __m256 epilogue(__m256 v, const float* bias, bool relu) {
+        if (bias != nullptr) v = _mm256_add_ps(v, _mm256_loadu_ps(bias));
+        return relu ? _mm256_max_ps(v, _mm256_setzero_ps()) : v;
+    }
+
+    static void store(float* y, Acc v, const float* bias, std::size_t cols, bool relu) {
+        if (cols == kSparsePanel) {
+            _mm256_storeu_ps(y, epilogue(v.lo, bias, relu));
+            _mm256_storeu_ps(y + 8, epilogue(v.hi, bias != nullptr ? bias + 8 : nullptr, relu));
+            return;
+        }
+        alignas(32) float tmp[kSparsePanel];
+        _mm256_store_ps(tmp, v.lo);
+        _mm256_store_ps(tmp + 8, v.hi);
+        finish(y, tmp, bias, cols, relu);
+    }
+
+    static void store4(float* y, Acc v, const float* bias, std::size_t cols, bool relu) {
+        const __m256 s = _mm256_add_ps(v.lo, v.hi);
+        __m128 q = _mm_add_ps(_mm256_castps256_ps128(s), _mm256_extractf128_ps(s, 1));
+        if (cols == 4) {
+            if (bias != nullptr) q = _mm_add_ps(q, _mm_loadu_ps(bias));
+            if (relu) q = _mm_max_ps(q, _mm_setzero_ps());
+            _mm_storeu_ps(y, q);
+            return;
+        }
+        alignas(16) float tmp[4];
+        _mm_store_ps(tmp, q);
+        finish(y, tmp, bias, cols, relu);
+    }
+
+    static Acc8 zero8() { return _mm256_setzero_ps(); }
+    static Acc8 load8(const float* v) { return _mm256_loadu_ps(v); }
+    static Acc8 fmadd8(Acc8 w, float x, Acc8 acc) { return _mm256_fmadd_ps(w, _mm256_set1_ps(x), acc); }
+
+    static void store8(float* y, Acc8 v, const float* bias, std::size_t cols, bool relu) {
+        if (cols == 8) {
+            _mm256_storeu_ps(y, epilogue(v, bias, relu));
+            return;
+        }
+        alignas(32) float tmp[8];
+        _mm256_store_ps(tmp, v);
+        finish(y, tmp, bias, cols, relu);
+    }
+};
+
+} // namespace
+
+void registerLinearSparseKernelsAvx2(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<LinearSparseFn>("linear_sparse", DataType::FP32, Isa::AVX2, &SparseGemm<Avx2Sparse>::linear);
+}
+
+} // namespace infer
@@ -0,0 +1,78 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+#include "sparse_gemm.h"
+
+#include <immintrin.h>
+
+#if !defined(__AVX512F__) || !defined(__AVX512VL__)
+#error "linear_sparse_avx512.cpp must be compiled with AVX-512F/VL enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+// A 16-column panel is one zmm; partial panels and blocks use masked loads and stores.
+struct Avx512Sparse {
+    using Acc = __m512;
+    using Idx = __m512i;
+    using Acc8 = __m256;
+
+    static Acc zero() { return _mm512_setzero_ps(); }
+    static Acc load(const float* v) { return _mm512_loadu_ps(v); }
+
+    static Idx indices(const std::uint8_t* idx) {
+        return _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(idx)));
+    }
+
+    // Lanes past M are never selected, so only the run's M floats are loaded.
+    template <std::size_t M>
+    static Acc permute(const float* x, Idx idx) {
+        const __m512 v = M == 4 ? _mm512_castps128_ps512(_mm_loadu_ps(x)) : _mm512_castps256_ps512(_mm256_loadu_ps(x));
+        return _mm512_permutexvar_ps(idx, v);
+    }
+
+    static Acc spread4(const float* x) {
+        const __m512i quarters = _mm512_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3);
+        return _mm512_permutexvar_ps(quarters, _mm512_castps128_ps512(_mm_loadu_ps(x)));
+    }
+
+    static Acc fmadd(Acc a, Acc b, Acc acc) { return _mm512_fmadd_ps(a, b, acc); }
+
+    static void store(float* y, Acc v, const float* bias, std::size_t cols, bool relu) {
+        const __mmask16 m = static_cast<__mmask16>((1u << cols) - 1u);
+        if (bias != nullptr) v = _mm512_add_ps(v, _mm512_maskz_loadu_ps(m, bias));
+        if (relu) v = _mm512_max_ps(v, _mm512_setzero_ps());
+        _mm512_mask_storeu_ps(y, m, v);
+    }
+
+    static void store4(float* y, Acc v, const float* bias, std::size_t cols, bool relu) {
+        __m128 q = _mm_add_ps(_mm_add_ps(_mm512_extractf32x4_ps(v, 0), _mm512_extractf32x4_ps(v, 1)),
+                              _mm_add_ps(_mm512_extractf32x4_ps(v, 2), _mm512_extractf32x4_ps(v, 3)));
+        const __mmask8 m = static_cast<__mmask8>((1u << cols) - 1u);
+        if (bias != nullptr) q = _mm_add_ps(q, _mm_maskz_loadu_ps(m, bias));
+        if (relu) q = _mm_max_ps(q, _mm_setzero_ps());
+        _mm_mask_storeu_ps(y, m, q);
+    }
+
+    static Acc8 zero8() { return _mm256_setzero_ps(); }
+    static Acc8 load8(const float* v) { return _mm256_loadu_ps(v); }
+    static Acc8 fmadd8(Acc8 w, float x, Acc8 acc) { return _mm256_fmadd_ps(w, _mm256_set1_ps(x), acc); }
+
+    static void store8(float* y, Acc8 v, const float* bias, std::size_t cols, bool relu) {
+        const __mmask8 m = static_cast<__mmask8>((1u << cols) - 1u);
+        if (bias != nullptr) v = _mm256_add_ps(v, _mm256_maskz_loadu_ps(m, bias));
+        if (relu) v = _mm256_max_ps(v, _mm256_setzero_ps());
+        _mm256_mask_storeu_ps(y, m, v);
+    }
+};
+
+} // namespace
+
+void registerLinearSparseKernelsAvx512(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<LinearSparseFn>("linear_sparse", DataType::FP32, Isa::AVX512, &SparseGemm<Avx512Sparse>::linear);
+}
+
+} // namespace infer
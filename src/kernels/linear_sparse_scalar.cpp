@@ -0,0 +1,42 @@
+#include "inference_engine/kernels/linear_sparse.h"
+
+#include <algorithm>
+
+namespace infer {
+
+void linear_sparse_scalar(const LinearSparseArgs& a) {
+    constexpr std::size_t NR = kSparsePanel;
+    const SparsePattern& p = a.pattern;
+    const bool relu = a.activation == Activation::ReLU;
+    for (std::size_t i = 0; i < a.m; ++i) {
+        const float* x = a.x + i * a.ldx;
+        float* y = a.y + i * a.ldy;
+        for (std::size_t j = 0; j < a.n; ++j) {
+            float acc = 0.0f;
+            if (p.format == SparseFormat::NM) {
+                const std::size_t runs = a.k / p.m;
+                const std::size_t offset = j / NR * runs * p.n * NR + j % NR;
+                const float* values = a.values + offset;
+                const std::uint8_t* indices = a.indices + offset;
+                for (std::size_t r = 0; r < runs; ++r) {
+                    for (std::size_t t = 0; t < p.n; ++t) {
+                        const std::size_t slot = (r * p.n + t) * NR;
+                        acc += values[slot] * x[r * p.m + indices[slot]];
+                    }
+                }
+            } else {
+                const std::size_t b = j / p.block_out;
+                const std::size_t o = j % p.block_out;
+                for (std::uint32_t e = a.row_ptr[b]; e < a.row_ptr[b + 1]; ++e) {
+                    const float* block = a.values + static_cast<std::size_t>(e) * p.block_out * p.block_in + o;
+                    const float* xb = x + static_cast<std::size_t>(a.col_idx[e]) * p.block_in;
+                    for (std::size_t q = 0; q < p.block_in; ++q) acc += block[q * p.block_out] * xb[q];
+                }
+            }
+            const float v = acc + (a.bias != nullptr ? a.bias[j] : 0.0f);
+            y[j] = relu ? std::max(0.0f, v) : v;
+        }
+    }
+}
+
+} // namespace infer
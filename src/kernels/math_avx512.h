@@ -0,0 +1,43 @@
+#pragma once
+
+// Inline AVX-512 math shared by the AVX-512 kernel translation units. Include only
+// from sources built with the AVX-512 flags (IE_AVX512_SOURCES).
+
+#include <cstddef>
+
+#include <immintrin.h>
+
+#if !defined(__AVX512F__)
+#error "math_avx512.h requires AVX-512F"
+#endif
+
+namespace infer {
+namespace avx512 {
+
+// exp(x) with the same reduction and polynomial as avx2::exp256; vscalefps applies
+// 2^n, so results underflow to 0 and overflow to +inf without an exponent-field
+// build. Inputs are clamped first so -inf and large magnitudes stay finite in r.
+inline __m512 exp512(__m512 x) {
+    x = _mm512_min_ps(_mm512_max_ps(x, _mm512_set1_ps(-104.0f)), _mm512_set1_ps(88.8f));
+    const __m512 n = _mm512_roundscale_ps(_mm512_mul_ps(x, _mm512_set1_ps(1.44269504f)),
+                                          _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512 r = _mm512_fnmadd_ps(n, _mm512_set1_ps(0.693359375f), x);
+    r = _mm512_fnmadd_ps(n, _mm512_set1_ps(-2.12194440e-4f), r);
+
+    __m512 p = _mm512_set1_ps(1.9875691500e-4f);
+    p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(1.3981999507e-3f));
+    p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(8.3334519073e-3f));
+    p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(4.1665795894e-2f));
+    p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(1.6666665459e-1f));
+    p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(5.0000001201e-1f));
+    p = _mm512_fmadd_ps(p, _mm512_mul_ps(r, r), _mm512_add_ps(r, _mm512_set1_ps(1.0f)));
+    return _mm512_scalef_ps(p, n);
+}
+
+// Mask selecting the first n (< 16) lanes.
+inline __mmask16 tailMask512(std::size_t n) {
+    return static_cast<__mmask16>((1u << n) - 1u);
+}
+
+} // namespace avx512
+} // namespace infer
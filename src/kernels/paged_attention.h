@@ -0,0 +1,63 @@
+#pragma once
+
+// Paged online-softmax attention shared by the per-ISA translation units. Each TU
+// instantiates PagedAttention<V> with its own vector traits; everything has
+// internal linkage so the differently compiled copies never collide (see
+// gemm_blocked.h).
+
+#include "inference_engine/kernels/attention.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace infer {
+namespace {
+
+// V must provide, for rows of head_dim floats:
+//   static float dot(const float* a, const float* b, std::size_t n);
+//   static float max(const float* x, std::size_t n);
+//   static float expSum(float* x, std::size_t n, float m);   x = exp(x - m), returns the sum
+//   static void scale(float* y, std::size_t n, float s);     y *= s
+//   static void axpy(float* y, const float* x, std::size_t n, float a);   y += a * x
+template <typename V>
+struct PagedAttention {
+    static void run(const PagedAttentionArgs& a) {
+        const std::size_t d = a.head_dim;
+        float m[kMaxAttentionGroup];
+        float l[kMaxAttentionGroup];
+        for (std::size_t g = 0; g < a.group; ++g) {
+            m[g] = -std::numeric_limits<float>::infinity();
+            l[g] = 0.0f;
+            std::fill(a.out + g * a.ldo, a.out + g * a.ldo + d, 0.0f);
+        }
+
+        float scores[kMaxAttentionBlockTokens];
+        for (std::size_t t0 = 0, j = 0; t0 < a.tokens; t0 += a.block_tokens, ++j) {
+            const std::size_t n = std::min(a.block_tokens, a.tokens - t0);
+            const float* k = a.keys + a.blocks[j] * a.block_stride;
+            const float* v = a.values + a.blocks[j] * a.block_stride;
+            // The page stays in L1 while every query head of the group visits it.
+            for (std::size_t g = 0; g < a.group; ++g) {
+                const float* q = a.q + g * a.ldq;
+                float* o = a.out + g * a.ldo;
+                for (std::size_t t = 0; t < n; ++t) scores[t] = a.scale * V::dot(q, k + t * d, d);
+                const float m_new = std::max(m[g], V::max(scores, n));
+                const float sum = V::expSum(scores, n, m_new);
+                if (l[g] != 0.0f) {
+                    const float correction = std::exp(m[g] - m_new);
+                    l[g] *= correction;
+                    V::scale(o, d, correction);
+                }
+                l[g] += sum;
+                m[g] = m_new;
+                for (std::size_t t = 0; t < n; ++t) V::axpy(o, v + t * d, d, scores[t]);
+            }
+        }
+        for (std::size_t g = 0; g < a.group && a.tokens != 0; ++g) V::scale(a.out + g * a.ldo, d, 1.0f / l[g]);
+    }
+};
+
+} // namespace
+} // namespace infer
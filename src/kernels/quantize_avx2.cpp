@@ -0,0 +1,155 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <immintrin.h>
+
+#include <type_traits>
+
+// Built with -mavx2 -ffp-contract=off: x * inv_scale + zero_point must round twice,
+// exactly like the scalar kernels, so results are bit-identical across ISAs.
+#if !defined(__AVX2__)
+#error "quantize_avx2.cpp must be compiled with AVX2 enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+// std::round semantics (half away from zero): truncate, then step one unit away
+// from zero when the dropped fraction is at least one half. v - trunc(v) is exact.
+inline __m256 roundHalfAway(__m256 v) {
+    const __m256 sign_mask = _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(0x80000000u)));
+    const __m256 t = _mm256_round_ps(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    const __m256 frac = _mm256_andnot_ps(sign_mask, _mm256_sub_ps(v, t));
+    const __m256 step = _mm256_or_ps(_mm256_set1_ps(1.0f), _mm256_and_ps(v, sign_mask));
+    const __m256 need = _mm256_cmp_ps(frac, _mm256_set1_ps(0.5f), _CMP_GE_OQ);
+    return _mm256_add_ps(t, _mm256_and_ps(need, step));
+}
+
+// Rounded, clamped integer lanes. min(hi, r) propagates NaN and max(NaN, lo) then
+// yields lo, matching std::max(lo, std::min(r, hi)) in the scalar kernels.
+inline __m256i quantizeLanes(__m256 x, __m256 inv_scale, __m256 zero_point, __m256 lo, __m256 hi) {
+    const __m256 r = roundHalfAway(_mm256_add_ps(_mm256_mul_ps(x, inv_scale), zero_point));
+    return _mm256_cvttps_epi32(_mm256_max_ps(_mm256_min_ps(hi, r), lo));
+}
+
+// 4 x 8 int32 lanes -> 32 bytes in order. packs work per 128-bit lane, so the
+// dwords come out as a0 b0 c0 d0 a1 b1 c1 d1 and are permuted back.
+template <bool kUnsigned>
+inline __m256i packBytes(__m256i a, __m256i b, __m256i c, __m256i d) {
+    const __m256i ab = _mm256_packs_epi32(a, b);
+    const __m256i cd = _mm256_packs_epi32(c, d);
+    const __m256i bytes = kUnsigned ? _mm256_packus_epi16(ab, cd) : _mm256_packs_epi16(ab, cd);
+    return _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+template <typename Q, bool kPerElement>
+std::size_t quantizeBody(const float* in, Q* out, std::size_t count, float inv_scale, float zero_point,
+                         const float* inv_scales, const float* zero_points) {
+    constexpr bool kUnsigned = std::is_same<Q, std::uint8_t>::value;
+    const __m256 lo = _mm256_set1_ps(kUnsigned ? 0.0f : -128.0f);
+    const __m256 hi = _mm256_set1_ps(kUnsigned ? 255.0f : 127.0f);
+    __m256 inv = _mm256_set1_ps(inv_scale);
+    __m256 zp = _mm256_set1_ps(zero_point);
+    __m256i lanes[4];
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        for (int v = 0; v < 4; ++v) {
+            if (kPerElement) {
+                inv = _mm256_loadu_ps(inv_scales + i + 8 * v);
+                zp = _mm256_loadu_ps(zero_points + i + 8 * v);
+            }
+            lanes[v] = quantizeLanes(_mm256_loadu_ps(in + i + 8 * v), inv, zp, lo, hi);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                            packBytes<kUnsigned>(lanes[0], lanes[1], lanes[2], lanes[3]));
+    }
+    return i;
+}
+
+template <bool kUnsigned>
+inline __m256i widenBytes(const void* p) {
+    const __m128i bytes = _mm_loadl_epi64(static_cast<const __m128i*>(p));
+    return kUnsigned ? _mm256_cvtepu8_epi32(bytes) : _mm256_cvtepi8_epi32(bytes);
+}
+
+template <typename Q, bool kPerElement>
+std::size_t dequantizeBody(const Q* in, float* out, std::size_t count, float scale, std::int32_t zero_point,
+                           const float* scales, const std::int32_t* zero_points) {
+    constexpr bool kUnsigned = std::is_same<Q, std::uint8_t>::value;
+    __m256 s = _mm256_set1_ps(scale);
+    __m256i zp = _mm256_set1_epi32(zero_point);
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        for (int v = 0; v < 4; ++v) {
+            if (kPerElement) {
+                s = _mm256_loadu_ps(scales + i + 8 * v);
+                zp = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(zero_points + i + 8 * v));
+            }
+            const __m256i q = _mm256_sub_epi32(widenBytes<kUnsigned>(in + i + 8 * v), zp);
+            _mm256_storeu_ps(out + i + 8 * v, _mm256_mul_ps(_mm256_cvtepi32_ps(q), s));
+        }
+    }
+    return i;
+}
+
+void quantizeS8(const float* in, std::int8_t* out, std::size_t count, float inv_scale, float zero_point) {
+    const std::size_t done = quantizeBody<std::int8_t, false>(in, out, count, inv_scale, zero_point, nullptr, nullptr);
+    scalar::quantizeS8(in + done, out + done, count - done, inv_scale, zero_point);
+}
+
+void quantizeU8(const float* in, std::uint8_t* out, std::size_t count, float inv_scale, float zero_point) {
+    const std::size_t done = quantizeBody<std::uint8_t, false>(in, out, count, inv_scale, zero_point, nullptr, nullptr);
+    scalar::quantizeU8(in + done, out + done, count - done, inv_scale, zero_point);
+}
+
+void quantizeS8Channels(const float* in, std::int8_t* out, std::size_t count, const float* inv_scales,
+                        const float* zero_points) {
+    const std::size_t done = quantizeBody<std::int8_t, true>(in, out, count, 0.0f, 0.0f, inv_scales, zero_points);
+    scalar::quantizeS8Channels(in + done, out + done, count - done, inv_scales + done, zero_points + done);
+}
+
+void quantizeU8Channels(const float* in, std::uint8_t* out, std::size_t count, const float* inv_scales,
+                        const float* zero_points) {
+    const std::size_t done = quantizeBody<std::uint8_t, true>(in, out, count, 0.0f, 0.0f, inv_scales, zero_points);
+    scalar::quantizeU8Channels(in + done, out + done, count - done, inv_scales + done, zero_points + done);
+}
+
+void dequantizeS8(const std::int8_t* in, float* out, std::size_t count, float scale, std::int32_t zero_point) {
+    const std::size_t done = dequantizeBody<std::int8_t, false>(in, out, count, scale, zero_point, nullptr, nullptr);
+    scalar::dequantizeS8(in + done, out + done, count - done, scale, zero_point);
+}
+
+void dequantizeU8(const std::uint8_t* in, float* out, std::size_t count, float scale, std::int32_t zero_point) {
+    const std::size_t done = dequantizeBody<std::uint8_t, false>(in, out, count, scale, zero_point, nullptr, nullptr);
+    scalar::dequantizeU8(in + done, out + done, count - done, scale, zero_point);
+}
+
+void dequantizeS8Channels(const std::int8_t* in, float* out, std::size_t count, const float* scales,
+                          const std::int32_t* zero_points) {
+    const std::size_t done = dequantizeBody<std::int8_t, true>(in, out, count, 0.0f, 0, scales, zero_points);
+    scalar::dequantizeS8Channels(in + done, out + done, count - done, scales + done, zero_points + done);
+}
+
+void dequantizeU8Channels(const std::uint8_t* in, float* out, std::size_t count, const float* scales,
+                          const std::int32_t* zero_points) {
+    const std::size_t done = dequantizeBody<std::uint8_t, true>(in, out, count, 0.0f, 0, scales, zero_points);
+    scalar::dequantizeU8Channels(in + done, out + done, count - done, scales + done, zero_points + done);
+}
+
+} // namespace
+
+void registerQuantizeKernelsAvx2(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<QuantizeS8Fn>("quantize", DataType::INT8, Isa::AVX2, &quantizeS8);
+    r.add<QuantizeU8Fn>("quantize", DataType::UINT8, Isa::AVX2, &quantizeU8);
+    r.add<QuantizeS8ChannelsFn>("quantize_channels", DataType::INT8, Isa::AVX2, &quantizeS8Channels);
+    r.add<QuantizeU8ChannelsFn>("quantize_channels", DataType::UINT8, Isa::AVX2, &quantizeU8Channels);
+    r.add<DequantizeS8Fn>("dequantize", DataType::INT8, Isa::AVX2, &dequantizeS8);
+    r.add<DequantizeU8Fn>("dequantize", DataType::UINT8, Isa::AVX2, &dequantizeU8);
+    r.add<DequantizeS8ChannelsFn>("dequantize_channels", DataType::INT8, Isa::AVX2, &dequantizeS8Channels);
+    r.add<DequantizeU8ChannelsFn>("dequantize_channels", DataType::UINT8, Isa::AVX2, &dequantizeU8Channels);
+}
+
+} // namespace infer
@@ -0,0 +1,134 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <immintrin.h>
+
+#include <type_traits>
+
+// Built with -mavx512f -mavx512bw -mavx512dq -mavx512vl -ffp-contract=off; see
+// quantize_avx2.cpp for why contraction is disabled.
+#if !defined(__AVX512F__) || !defined(__AVX512BW__)
+#error "quantize_avx512.cpp must be compiled with AVX-512 F/BW enabled"
+#endif
+
+namespace infer {
+
+namespace {
+
+// std::round semantics (half away from zero), as in quantize_avx2.cpp.
+inline __m512 roundHalfAway(__m512 v) {
+    const __m512i sign_mask = _mm512_set1_epi32(static_cast<int>(0x80000000u));
+    const __m512 t = _mm512_roundscale_ps(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    const __m512 frac = _mm512_abs_ps(_mm512_sub_ps(v, t));
+    const __m512 step = _mm512_castsi512_ps(
+        _mm512_or_si512(_mm512_castps_si512(_mm512_set1_ps(1.0f)),
+                        _mm512_and_si512(_mm512_castps_si512(v), sign_mask)));
+    const __mmask16 need = _mm512_cmp_ps_mask(frac, _mm512_set1_ps(0.5f), _CMP_GE_OQ);
+    return _mm512_mask_add_ps(t, need, t, step);
+}
+
+// NaN maps to lo: min(hi, NaN) returns NaN and max(NaN, lo) returns lo.
+inline __m512i quantizeLanes(__m512 x, __m512 inv_scale, __m512 zero_point, __m512 lo, __m512 hi) {
+    const __m512 r = roundHalfAway(_mm512_add_ps(_mm512_mul_ps(x, inv_scale), zero_point));
+    return _mm512_cvttps_epi32(_mm512_max_ps(_mm512_min_ps(hi, r), lo));
+}
+
+template <typename Q, bool kPerElement>
+void quantize(const float* in, Q* out, std::size_t count, float inv_scale, float zero_point,
+              const float* inv_scales, const float* zero_points) {
+    constexpr bool kUnsigned = std::is_same<Q, std::uint8_t>::value;
+    const __m512 lo = _mm512_set1_ps(kUnsigned ? 0.0f : -128.0f);
+    const __m512 hi = _mm512_set1_ps(kUnsigned ? 255.0f : 127.0f);
+    __m512 inv = _mm512_set1_ps(inv_scale);
+    __m512 zp = _mm512_set1_ps(zero_point);
+    for (std::size_t i = 0; i < count; i += 16) {
+        const std::size_t rest = count - i;
+        const __mmask16 mask = rest >= 16 ? static_cast<__mmask16>(0xFFFF)
+                                          : static_cast<__mmask16>((1u << rest) - 1u);
+        if (kPerElement) {
+            inv = _mm512_maskz_loadu_ps(mask, inv_scales + i);
+            zp = _mm512_maskz_loadu_ps(mask, zero_points + i);
+        }
+        // Values are already clamped, so the saturating narrow is exact.
+        const __m512i q = quantizeLanes(_mm512_maskz_loadu_ps(mask, in + i), inv, zp, lo, hi);
+        if (kUnsigned) {
+            _mm512_mask_cvtusepi32_storeu_epi8(out + i, mask, q);
+        } else {
+            _mm512_mask_cvtsepi32_storeu_epi8(out + i, mask, q);
+        }
+    }
+}
+
+template <typename Q, bool kPerElement>
+void dequantize(const Q* in, float* out, std::size_t count, float scale, std::int32_t zero_point, const float* scales,
+                const std::int32_t* zero_points) {
+    constexpr bool kUnsigned = std::is_same<Q, std::uint8_t>::value;
+    __m512 s = _mm512_set1_ps(scale);
+    __m512i zp = _mm512_set1_epi32(zero_point);
+    for (std::size_t i = 0; i < count; i += 16) {
+        const std::size_t rest = count - i;
+        const __mmask16 mask = rest >= 16 ? static_cast<__mmask16>(0xFFFF)
+                                          : static_cast<__mmask16>((1u << rest) - 1u);
+        if (kPerElement) {
+            s = _mm512_maskz_loadu_ps(mask, scales + i);
+            zp = _mm512_maskz_loadu_epi32(mask, zero_points + i);
+        }
+        const __m128i bytes = _mm_maskz_loadu_epi8(mask, in + i);
+        const __m512i wide = kUnsigned ? _mm512_cvtepu8_epi32(bytes) : _mm512_cvtepi8_epi32(bytes);
+        const __m512 f = _mm512_cvtepi32_ps(_mm512_sub_epi32(wide, zp));
+        _mm512_mask_storeu_ps(out + i, mask, _mm512_mul_ps(f, s));
+    }
+}
+
+void quantizeS8(const float* in, std::int8_t* out, std::size_t count, float inv_scale, float zero_point) {
+    quantize<std::int8_t, false>(in, out, count, inv_scale, zero_point, nullptr, nullptr);
+}
+
+void quantizeU8(const float* in, std::uint8_t* out, std::size_t count, float inv_scale, float zero_point) {
+    quantize<std::uint8_t, false>(in, out, count, inv_scale, zero_point, nullptr, nullptr);
+}
+
+void quantizeS8Channels(const float* in, std::int8_t* out, std::size_t count, const float* inv_scales,
+                        const float* zero_points) {
+    quantize<std::int8_t, true>(in, out, count, 0.0f, 0.0f, inv_scales, zero_points);
+}
+
+void quantizeU8Channels(const float* in, std::uint8_t* out, std::size_t count, const float* inv_scales,
+                        const float* zero_points) {
+    quantize<std::uint8_t, true>(in, out, count, 0.0f, 0.0f, inv_scales, zero_points);
+}
+
+void dequantizeS8(const std::int8_t* in, float* out, std::size_t count, float scale, std::int32_t zero_point) {
+    dequantize<std::int8_t, false>(in, out, count, scale, zero_point, nullptr, nullptr);
+}
+
+void dequantizeU8(const std::uint8_t* in, float* out, std::size_t count, float scale, std::int32_t zero_point) {
+    dequantize<std::uint8_t, false>(in, out, count, scale, zero_point, nullptr, nullptr);
+}
+
+void dequantizeS8Channels(const std::int8_t* in, float* out, std::size_t count, const float* scales,
+                          const std::int32_t* zero_points) {
+    dequantize<std::int8_t, true>(in, out, count, 0.0f, 0, scales, zero_points);
+}
+
+void dequantizeU8Channels(const std::uint8_t* in, float* out, std::size_t count, const float* scales,
+                          const std::int32_t* zero_points) {
+    dequantize<std::uint8_t, true>(in, out, count, 0.0f, 0, scales, zero_points);
+}
+
+} // namespace
+
+void registerQuantizeKernelsAvx512(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<QuantizeS8Fn>("quantize", DataType::INT8, Isa::AVX512, &quantizeS8);
+    r.add<QuantizeU8Fn>("quantize", DataType::UINT8, Isa::AVX512, &quantizeU8);
+    r.add<QuantizeS8ChannelsFn>("quantize_channels", DataType::INT8, Isa::AVX512, &quantizeS8Channels);
+    r.add<QuantizeU8ChannelsFn>("quantize_channels", DataType::UINT8, Isa::AVX512, &quantizeU8Channels);
+    r.add<DequantizeS8Fn>("dequantize", DataType::INT8, Isa::AVX512, &dequantizeS8);
+    r.add<DequantizeU8Fn>("dequantize", DataType::UINT8, Isa::AVX512, &dequantizeU8);
+    r.add<DequantizeS8ChannelsFn>("dequantize_channels", DataType::INT8, Isa::AVX512, &dequantizeS8Channels);
+    r.add<DequantizeU8ChannelsFn>("dequantize_channels", DataType::UINT8, Isa::AVX512, &dequantizeU8Channels);
+}
+
+} // namespace infer
@@ -0,0 +1,181 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <arm_neon.h>
+
+// Built with -ffp-contract=off; see quantize_avx2.cpp.
+#if !defined(__aarch64__)
+#error "quantize_neon.cpp targets AArch64 Advanced SIMD"
+#endif
+
+namespace infer {
+
+namespace {
+
+// FCVTAS rounds half away from zero, matching std::round. Clamping first with
+// maxnm/minnm maps NaN to lo, as the scalar kernels do.
+inline int32x4_t quantizeLanes(float32x4_t x, float32x4_t inv_scale, float32x4_t zero_point, float32x4_t lo,
+                               float32x4_t hi) {
+    const float32x4_t s = vaddq_f32(vmulq_f32(x, inv_scale), zero_point);
+    return vcvtaq_s32_f32(vminnmq_f32(vmaxnmq_f32(s, lo), hi));
+}
+
+// 16 int32 lanes in [-128, 255] -> 16 bytes.
+inline int16x8_t narrow(int32x4_t a, int32x4_t b) {
+    return vcombine_s16(vqmovn_s32(a), vqmovn_s32(b));
+}
+
+template <bool kPerElement>
+std::size_t quantizeS8Body(const float* in, std::int8_t* out, std::size_t count, float inv_scale, float zero_point,
+                           const float* inv_scales, const float* zero_points) {
+    const float32x4_t lo = vdupq_n_f32(-128.0f);
+    const float32x4_t hi = vdupq_n_f32(127.0f);
+    float32x4_t inv = vdupq_n_f32(inv_scale);
+    float32x4_t zp = vdupq_n_f32(zero_point);
+    int32x4_t q[4];
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        for (int v = 0; v < 4; ++v) {
+            if (kPerElement) {
+                inv = vld1q_f32(inv_scales + i + 4 * v);
+                zp = vld1q_f32(zero_points + i + 4 * v);
+            }
+            q[v] = quantizeLanes(vld1q_f32(in + i + 4 * v), inv, zp, lo, hi);
+        }
+        vst1q_s8(out + i, vcombine_s8(vqmovn_s16(narrow(q[0], q[1])), vqmovn_s16(narrow(q[2], q[3]))));
+    }
+    return i;
+}
+
+template <bool kPerElement>
+std::size_t quantizeU8Body(const float* in, std::uint8_t* out, std::size_t count, float inv_scale, float zero_point,
+                           const float* inv_scales, const float* zero_points) {
+    const float32x4_t lo = vdupq_n_f32(0.0f);
+    const float32x4_t hi = vdupq_n_f32(255.0f);
+    float32x4_t inv = vdupq_n_f32(inv_scale);
+    float32x4_t zp = vdupq_n_f32(zero_point);
+    int32x4_t q[4];
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        for (int v = 0; v < 4; ++v) {
+            if (kPerElement) {
+                inv = vld1q_f32(inv_scales + i + 4 * v);
+                zp = vld1q_f32(zero_points + i + 4 * v);
+            }
+            q[v] = quantizeLanes(vld1q_f32(in + i + 4 * v), inv, zp, lo, hi);
+        }
+        vst1q_u8(out + i, vcombine_u8(vqmovun_s16(narrow(q[0], q[1])), vqmovun_s16(narrow(q[2], q[3]))));
+    }
+    return i;
+}
+
+inline int32x4_t widenLow(int16x8_t v) { return vmovl_s16(vget_low_s16(v)); }
+inline int32x4_t widenHigh(int16x8_t v) { return vmovl_s16(vget_high_s16(v)); }
+
+// 16 widened bytes -> (q - zp) * scale.
+template <bool kPerElement>
+void dequantizeBlock(int16x8_t lo8, int16x8_t hi8, float* out, float32x4_t s, int32x4_t zp, const float* scales,
+                     const std::int32_t* zero_points) {
+    const int32x4_t parts[4] = {widenLow(lo8), widenHigh(lo8), widenLow(hi8), widenHigh(hi8)};
+    for (int v = 0; v < 4; ++v) {
+        if (kPerElement) {
+            s = vld1q_f32(scales + 4 * v);
+            zp = vld1q_s32(zero_points + 4 * v);
+        }
+        vst1q_f32(out + 4 * v, vmulq_f32(vcvtq_f32_s32(vsubq_s32(parts[v], zp)), s));
+    }
+}
+
+template <bool kPerElement>
+std::size_t dequantizeS8Body(const std::int8_t* in, float* out, std::size_t count, float scale,
+                             std::int32_t zero_point, const float* scales, const std::int32_t* zero_points) {
+    const float32x4_t s = vdupq_n_f32(scale);
+    const int32x4_t zp = vdupq_n_s32(zero_point);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const int8x16_t b = vld1q_s8(in + i);
+        dequantizeBlock<kPerElement>(vmovl_s8(vget_low_s8(b)), vmovl_s8(vget_high_s8(b)), out + i, s, zp,
+                                     scales + (kPerElement ? i : 0), zero_points + (kPerElement ? i : 0));
+    }
+    return i;
+}
+
+template <bool kPerElement>
+std::size_t dequantizeU8Body(const std::uint8_t* in, float* out, std::size_t count, float scale,
+                             std::int32_t zero_point, const float* scales, const std::int32_t* zero_points) {
+    const float32x4_t s = vdupq_n_f32(scale);
+    const int32x4_t zp = vdupq_n_s32(zero_point);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const uint8x16_t b = vld1q_u8(in + i);
+        dequantizeBlock<kPerElement>(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(b))),
+                                     vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(b))), out + i, s, zp,
+                                     scales + (kPerElement ? i : 0), zero_points + (kPerElement ? i : 0));
+    }
+    return i;
+}
+
+void quantizeS8(const float* in, std::int8_t* out, std::size_t count, float inv_scale, float zero_point) {
+    const std::size_t done = quantizeS8Body<false>(in, out, count, inv_scale, zero_point, nullptr, nullptr);
+    scalar::quantizeS8(in + done, out + done, count - done, inv_scale, zero_point);
+}
+
+void quantizeU8(const float* in, std::uint8_t* out, std::size_t count, float inv_scale, float zero_point) {
+    const std::size_t done = quantizeU8Body<false>(in, out, count, inv_scale, zero_point, nullptr, nullptr);
+    scalar::quantizeU8(in + done, out + done, count - done, inv_scale, zero_point);
+}
+
+void quantizeS8Channels(const float* in, std::int8_t* out, std::size_t count, const float* inv_scales,
+                        const float* zero_points) {
+    const std::size_t done = quantizeS8Body<true>(in, out, count, 0.0f, 0.0f, inv_scales, zero_points);
+    scalar::quantizeS8Channels(in + done, out + done, count - done, inv_scales + done, zero_points + done);
+}
+
+void quantizeU8Channels(const float* in, std::uint8_t* out, std::size_t count, const float* inv_scales,
+                        const float* zero_points) {
+    const std::size_t done = quantizeU8Body<true>(in, out, count, 0.0f, 0.0f, inv_scales, zero_points);
+    scalar::quantizeU8Channels(in + done, out + done, count - done, inv_scales + done, zero_points + done);
+}
+
+void dequantizeS8(const std::int8_t* in, float* out, std::size_t count, float scale, std::int32_t zero_point) {
+    static const float kNoScales[16] = {};
+    static const std::int32_t kNoZeroPoints[16] = {};
+    const std::size_t done = dequantizeS8Body<false>(in, out, count, scale, zero_point, kNoScales, kNoZeroPoints);
+    scalar::dequantizeS8(in + done, out + done, count - done, scale, zero_point);
+}
+
+void dequantizeU8(const std::uint8_t* in, float* out, std::size_t count, float scale, std::int32_t zero_point) {
+    static const float kNoScales[16] = {};
+    static const std::int32_t kNoZeroPoints[16] = {};
+    const std::size_t done = dequantizeU8Body<false>(in, out, count, scale, zero_point, kNoScales, kNoZeroPoints);
+    scalar::dequantizeU8(in + done, out + done, count - done, scale, zero_point);
+}
+
+void dequantizeS8Channels(const std::int8_t* in, float* out, std::size_t count, const float* scales,
+                          const std::int32_t* zero_points) {
+    const std::size_t done = dequantizeS8Body<true>(in, out, count, 0.0f, 0, scales, zero_points);
+    scalar::dequantizeS8Channels(in + done, out + done, count - done, scales + done, zero_points + done);
+}
+
+void dequantizeU8Channels(const std::uint8_t* in, float* out, std::size_t count, const float* scales,
+                          const std::int32_t* zero_points) {
+    const std::size_t done = dequantizeU8Body<true>(in, out, count, 0.0f, 0, scales, zero_points);
+    scalar::dequantizeU8Channels(in + done, out + done, count - done, scales + done, zero_points + done);
+}
+
+} // namespace
+
+void registerQuantizeKernelsNeon(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<QuantizeS8Fn>("quantize", DataType::INT8, Isa::NEON, &quantizeS8);
+    r.add<QuantizeU8Fn>("quantize", DataType::UINT8, Isa::NEON, &quantizeU8);
+    r.add<QuantizeS8ChannelsFn>("quantize_channels", DataType::INT8, Isa::NEON, &quantizeS8Channels);
+    r.add<QuantizeU8ChannelsFn>("quantize_channels", DataType::UINT8, Isa::NEON, &quantizeU8Channels);
+    r.add<DequantizeS8Fn>("dequantize", DataType::INT8, Isa::NEON, &dequantizeS8);
+    r.add<DequantizeU8Fn>("dequantize", DataType::UINT8, Isa::NEON, &dequantizeU8);
+    r.add<DequantizeS8ChannelsFn>("dequantize_channels", DataType::INT8, Isa::NEON, &dequantizeS8Channels);
+    r.add<DequantizeU8ChannelsFn>("dequantize_channels", DataType::UINT8, Isa::NEON, &dequantizeU8Channels);
+}
+
+} // namespace infer
@@ -0,0 +1,89 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace infer {
+
+namespace {
+
+template <typename Q>
+inline Q quantizeOne(float x, float inv_scale, float zero_point, float lo, float hi) {
+    const float scaled = std::round(x * inv_scale + zero_point);
+    return static_cast<Q>(std::max(lo, std::min(scaled, hi)));
+}
+
+} // namespace
+
+namespace scalar {
+
+void quantizeS8(const float* input, std::int8_t* output, std::size_t count, float inv_scale, float zero_point) {
+    for (std::size_t i = 0; i < count; ++i) {
+        output[i] = quantizeOne<std::int8_t>(input[i], inv_scale, zero_point, -128.0f, 127.0f);
+    }
+}
+
+void quantizeU8(const float* input, std::uint8_t* output, std::size_t count, float inv_scale, float zero_point) {
+    for (std::size_t i = 0; i < count; ++i) {
+        output[i] = quantizeOne<std::uint8_t>(input[i], inv_scale, zero_point, 0.0f, 255.0f);
+    }
+}
+
+void quantizeS8Channels(const float* input, std::int8_t* output, std::size_t count, const float* inv_scales,
+                        const float* zero_points) {
+    for (std::size_t i = 0; i < count; ++i) {
+        output[i] = quantizeOne<std::int8_t>(input[i], inv_scales[i], zero_points[i], -128.0f, 127.0f);
+    }
+}
+
+void quantizeU8Channels(const float* input, std::uint8_t* output, std::size_t count, const float* inv_scales,
+                        const float* zero_points) {
+    for (std::size_t i = 0; i < count; ++i) {
+        output[i] = quantizeOne<std::uint8_t>(input[i], inv_scales[i], zero_points[i], 0.0f, 255.0f);
+    }
+}
+
+void dequantizeS8(const std::int8_t* input, float* output, std::size_t count, float scale, std::int32_t zero_point) {
+    for (std::size_t i = 0; i < count; ++i) {
+        output[i] = static_cast<float>(static_cast<std::int32_t>(input[i]) - zero_point) * scale;
+    }
+}
+
+void dequantizeU8(const std::uint8_t* input, float* output, std::size_t count, float scale, std::int32_t zero_point) {
+    for (std::size_t i = 0; i < count; ++i) {
+        output[i] = static_cast<float>(static_cast<std::int32_t>(input[i]) - zero_point) * scale;
+    }
+}
+
+void dequantizeS8Channels(const std::int8_t* input, float* output, std::size_t count, const float* scales,
+                          const std::int32_t* zero_points) {
+    for (std::size_t i = 0; i < count; ++i) {
+        output[i] = static_cast<float>(static_cast<std::int32_t>(input[i]) - zero_points[i]) * scales[i];
+    }
+}
+
+void dequantizeU8Channels(const std::uint8_t* input, float* output, std::size_t count, const float* scales,
+                          const std::int32_t* zero_points) {
+    for (std::size_t i = 0; i < count; ++i) {
+        output[i] = static_cast<float>(static_cast<std::int32_t>(input[i]) - zero_points[i]) * scales[i];
+    }
+}
+
+} // namespace scalar
+
+void registerQuantizeKernelsScalar(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<QuantizeS8Fn>("quantize", DataType::INT8, Isa::Scalar, &scalar::quantizeS8);
+    r.add<QuantizeU8Fn>("quantize", DataType::UINT8, Isa::Scalar, &scalar::quantizeU8);
+    r.add<QuantizeS8ChannelsFn>("quantize_channels", DataType::INT8, Isa::Scalar, &scalar::quantizeS8Channels);
+    r.add<QuantizeU8ChannelsFn>("quantize_channels", DataType::UINT8, Isa::Scalar, &scalar::quantizeU8Channels);
+    r.add<DequantizeS8Fn>("dequantize", DataType::INT8, Isa::Scalar, &scalar::dequantizeS8);
+    r.add<DequantizeU8Fn>("dequantize", DataType::UINT8, Isa::Scalar, &scalar::dequantizeU8);
+    r.add<DequantizeS8ChannelsFn>("dequantize_channels", DataType::INT8, Isa::Scalar, &scalar::dequantizeS8Channels);
+    r.add<DequantizeU8ChannelsFn>("dequantize_channels", DataType::UINT8, Isa::Scalar,
+                                  &scalar::dequantizeU8Channels);
+}
+
+} // namespace infer
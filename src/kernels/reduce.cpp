@@ -0,0 +1,92 @@
+#include "inference_engine/kernels/reduce.h"
+
+#include "inference_engine/kernels/registry.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <algorithm>
+
+namespace infer {
+
+namespace {
+
+using inference_engine::core::DataType;
+
+// Row batches below this many elements stay on the calling thread; larger ones
+// hand each task about kTaskElems (whole rows only).
+constexpr std::size_t kParallelElems = std::size_t{1} << 16;
+constexpr std::size_t kTaskElems = std::size_t{1} << 14;
+
+// Resolved once per process from the host's CPU features.
+template <typename Fn>
+Fn* rowKernel(const char* name) {
+    return KernelRegistry::instance().lookup<Fn>(name, DataType::FP32);
+}
+
+SoftmaxRowFn* softmaxKernel() {
+    static SoftmaxRowFn* const fn = rowKernel<SoftmaxRowFn>("softmax_row");
+    return fn;
+}
+
+SoftmaxRowFn* logSoftmaxKernel() {
+    static SoftmaxRowFn* const fn = rowKernel<SoftmaxRowFn>("log_softmax_row");
+    return fn;
+}
+
+NormRowFn* layerNormKernel() {
+    static NormRowFn* const fn = rowKernel<NormRowFn>("layer_norm_row");
+    return fn;
+}
+
+NormRowFn* rmsNormKernel() {
+    static NormRowFn* const fn = rowKernel<NormRowFn>("rms_norm_row");
+    return fn;
+}
+
+// Runs fn(x_row, y_row) for every row, through parallelFor once the batch is large
+// enough to be worth the hand-off.
+template <typename Fn>
+void forEachRow(const float* x, std::int64_t x_row_stride, float* y, std::int64_t y_row_stride, std::size_t rows,
+                std::size_t n, const Fn& fn) {
+    auto run = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t r = begin; r < end; ++r) {
+            const auto ri = static_cast<std::int64_t>(r);
+            fn(x + ri * x_row_stride, y + ri * y_row_stride);
+        }
+    };
+    if (rows <= 1 || rows * n < kParallelElems) {
+        run(0, rows);
+        return;
+    }
+    const std::size_t grain = std::max<std::size_t>(1, kTaskElems / std::max<std::size_t>(1, n));
+    parallelFor(0, rows, grain, run);
+}
+
+} // namespace
+
+void softmax_rows(const float* x, std::int64_t x_row_stride, float* y, std::int64_t y_row_stride, std::size_t rows,
+                  std::size_t n) {
+    SoftmaxRowFn* const kernel = softmaxKernel();
+    forEachRow(x, x_row_stride, y, y_row_stride, rows, n, [&](const float* xr, float* yr) { kernel(xr, yr, n); });
+}
+
+void log_softmax_rows(const float* x, std::int64_t x_row_stride, float* y, std::int64_t y_row_stride,
+                      std::size_t rows, std::size_t n) {
+    SoftmaxRowFn* const kernel = logSoftmaxKernel();
+    forEachRow(x, x_row_stride, y, y_row_stride, rows, n, [&](const float* xr, float* yr) { kernel(xr, yr, n); });
+}
+
+void layer_norm_rows(const float* x, std::int64_t x_row_stride, float* y, std::int64_t y_row_stride,
+                     std::size_t rows, std::size_t n, const float* gamma, const float* beta, float epsilon) {
+    NormRowFn* const kernel = layerNormKernel();
+    forEachRow(x, x_row_stride, y, y_row_stride, rows, n,
+               [&](const float* xr, float* yr) { kernel(xr, yr, n, gamma, beta, epsilon); });
+}
+
+void rms_norm_rows(const float* x, std::int64_t x_row_stride, float* y, std::int64_t y_row_stride, std::size_t rows,
+                   std::size_t n, const float* gamma, const float* beta, float epsilon) {
+    NormRowFn* const kernel = rmsNormKernel();
+    forEachRow(x, x_row_stride, y, y_row_stride, rows, n,
+               [&](const float* xr, float* yr) { kernel(xr, yr, n, gamma, beta, epsilon); });
+}
+
+} // namespace infer
@@ -0,0 +1,194 @@
+#include "builtin_kernels.h"
+#include "math_avx2.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <cmath>
+#include <limits>
+
+namespace infer {
+
+namespace {
+
+using avx2::exp256;
+using avx2::hmax256;
+using avx2::hsum256;
+using avx2::tailMask256;
+
+// Four accumulators hide the add latency; tails use masked loads, never reading
+// past the row.
+float reduceSum(const float* x, std::size_t n) {
+    __m256 a0 = _mm256_setzero_ps(), a1 = a0, a2 = a0, a3 = a0;
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        a0 = _mm256_add_ps(a0, _mm256_loadu_ps(x + i));
+        a1 = _mm256_add_ps(a1, _mm256_loadu_ps(x + i + 8));
+        a2 = _mm256_add_ps(a2, _mm256_loadu_ps(x + i + 16));
+        a3 = _mm256_add_ps(a3, _mm256_loadu_ps(x + i + 24));
+    }
+    for (; i + 8 <= n; i += 8) a0 = _mm256_add_ps(a0, _mm256_loadu_ps(x + i));
+    if (i < n) a1 = _mm256_add_ps(a1, _mm256_maskload_ps(x + i, tailMask256(n - i)));
+    return hsum256(_mm256_add_ps(_mm256_add_ps(a0, a1), _mm256_add_ps(a2, a3)));
+}
+
+float reduceMax(const float* x, std::size_t n) {
+    const __m256 neg_inf = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+    __m256 m0 = neg_inf, m1 = neg_inf, m2 = neg_inf, m3 = neg_inf;
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        m0 = _mm256_max_ps(m0, _mm256_loadu_ps(x + i));
+        m1 = _mm256_max_ps(m1, _mm256_loadu_ps(x + i + 8));
+        m2 = _mm256_max_ps(m2, _mm256_loadu_ps(x + i + 16));
+        m3 = _mm256_max_ps(m3, _mm256_loadu_ps(x + i + 24));
+    }
+    for (; i + 8 <= n; i += 8) m0 = _mm256_max_ps(m0, _mm256_loadu_ps(x + i));
+    if (i < n) {
+        const __m256i mask = tailMask256(n - i);
+        const __m256 v = _mm256_blendv_ps(neg_inf, _mm256_maskload_ps(x + i, mask), _mm256_castsi256_ps(mask));
+        m1 = _mm256_max_ps(m1, v);
+    }
+    return hmax256(_mm256_max_ps(_mm256_max_ps(m0, m1), _mm256_max_ps(m2, m3)));
+}
+
+// Sum of (x - c)^2.
+float sumSquaredDiff(const float* x, std::size_t n, float c) {
+    const __m256 vc = _mm256_set1_ps(c);
+    __m256 a0 = _mm256_setzero_ps(), a1 = a0;
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(x + i), vc);
+        const __m256 d1 = _mm256_sub_ps(_mm256_loadu_ps(x + i + 8), vc);
+        a0 = _mm256_fmadd_ps(d0, d0, a0);
+        a1 = _mm256_fmadd_ps(d1, d1, a1);
+    }
+    for (; i + 8 <= n; i += 8) {
+        const __m256 d = _mm256_sub_ps(_mm256_loadu_ps(x + i), vc);
+        a0 = _mm256_fmadd_ps(d, d, a0);
+    }
+    if (i < n) {
+        const __m256i mask = tailMask256(n - i);
+        const __m256 d =
+            _mm256_and_ps(_mm256_sub_ps(_mm256_maskload_ps(x + i, mask), vc), _mm256_castsi256_ps(mask));
+        a1 = _mm256_fmadd_ps(d, d, a1);
+    }
+    return hsum256(_mm256_add_ps(a0, a1));
+}
+
+void reduceMoments(const float* x, std::size_t n, float* mean, float* variance) {
+    if (n == 0) {
+        *mean = 0.0f;
+        *variance = 0.0f;
+        return;
+    }
+    const float m = reduceSum(x, n) / static_cast<float>(n);
+    *mean = m;
+    *variance = sumSquaredDiff(x, n, m) / static_cast<float>(n);
+}
+
+// y = x * s, in place on the softmax output.
+void scaleRow(float* y, std::size_t n, float s) {
+    const __m256 vs = _mm256_set1_ps(s);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) _mm256_storeu_ps(y + i, _mm256_mul_ps(_mm256_loadu_ps(y + i), vs));
+    if (i < n) {
+        const __m256i mask = tailMask256(n - i);
+        _mm256_maskstore_ps(y + i, mask, _mm256_mul_ps(_mm256_maskload_ps(y + i, mask), vs));
+    }
+}
+
+// Stores exp(x - max) to y (when y is not null) and returns the sum.
+float expShiftedSum(const float* x, float* y, std::size_t n, float max_v) {
+    const __m256 vmax = _mm256_set1_ps(max_v);
+    __m256 a0 = _mm256_setzero_ps(), a1 = a0;
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m256 e0 = exp256(_mm256_sub_ps(_mm256_loadu_ps(x + i), vmax));
+        const __m256 e1 = exp256(_mm256_sub_ps(_mm256_loadu_ps(x + i + 8), vmax));
+        if (y != nullptr) {
+            _mm256_storeu_ps(y + i, e0);
+            _mm256_storeu_ps(y + i + 8, e1);
+        }
+        a0 = _mm256_add_ps(a0, e0);
+        a1 = _mm256_add_ps(a1, e1);
+    }
+    for (; i + 8 <= n; i += 8) {
+        const __m256 e = exp256(_mm256_sub_ps(_mm256_loadu_ps(x + i), vmax));
+        if (y != nullptr) _mm256_storeu_ps(y + i, e);
+        a0 = _mm256_add_ps(a0, e);
+    }
+    if (i < n) {
+        const __m256i mask = tailMask256(n - i);
+        const __m256 e = _mm256_and_ps(exp256(_mm256_sub_ps(_mm256_maskload_ps(x + i, mask), vmax)),
+                                       _mm256_castsi256_ps(mask));
+        if (y != nullptr) _mm256_maskstore_ps(y + i, mask, e);
+        a1 = _mm256_add_ps(a1, e);
+    }
+    return hsum256(_mm256_add_ps(a0, a1));
+}
+
+// Pass 1 finds the max, pass 2 writes exp(x - max) and sums it, pass 3 rescales y
+// while the row is still in cache.
+void softmaxRow(const float* x, float* y, std::size_t n) {
+    const float sum = expShiftedSum(x, y, n, reduceMax(x, n));
+    scaleRow(y, n, sum == 0.0f ? 0.0f : 1.0f / sum);
+}
+
+void logSoftmaxRow(const float* x, float* y, std::size_t n) {
+    const float max_v = reduceMax(x, n);
+    const __m256 shift = _mm256_set1_ps(max_v + std::log(expShiftedSum(x, nullptr, n, max_v)));
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) _mm256_storeu_ps(y + i, _mm256_sub_ps(_mm256_loadu_ps(x + i), shift));
+    if (i < n) {
+        const __m256i mask = tailMask256(n - i);
+        _mm256_maskstore_ps(y + i, mask, _mm256_sub_ps(_mm256_maskload_ps(x + i, mask), shift));
+    }
+}
+
+// y = (x - center) * scale * gamma + beta, with null gamma/beta as 1/0.
+void normalizeRow(const float* x, float* y, std::size_t n, float center, float scale, const float* gamma,
+                  const float* beta) {
+    const __m256 vc = _mm256_set1_ps(center);
+    const __m256 vs = _mm256_set1_ps(scale);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256 v = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(x + i), vc), vs);
+        const __m256 g = gamma != nullptr ? _mm256_loadu_ps(gamma + i) : one;
+        const __m256 b = beta != nullptr ? _mm256_loadu_ps(beta + i) : zero;
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(v, g, b));
+    }
+    if (i < n) {
+        const __m256i mask = tailMask256(n - i);
+        const __m256 v = _mm256_mul_ps(_mm256_sub_ps(_mm256_maskload_ps(x + i, mask), vc), vs);
+        const __m256 g = gamma != nullptr ? _mm256_maskload_ps(gamma + i, mask) : one;
+        const __m256 b = beta != nullptr ? _mm256_maskload_ps(beta + i, mask) : zero;
+        _mm256_maskstore_ps(y + i, mask, _mm256_fmadd_ps(v, g, b));
+    }
+}
+
+void layerNormRow(const float* x, float* y, std::size_t n, const float* gamma, const float* beta, float epsilon) {
+    float mean = 0.0f, variance = 0.0f;
+    reduceMoments(x, n, &mean, &variance);
+    normalizeRow(x, y, n, mean, 1.0f / std::sqrt(variance + epsilon), gamma, beta);
+}
+
+void rmsNormRow(const float* x, float* y, std::size_t n, const float* gamma, const float* beta, float epsilon) {
+    const float mean_sq = n == 0 ? 0.0f : sumSquaredDiff(x, n, 0.0f) / static_cast<float>(n);
+    normalizeRow(x, y, n, 0.0f, 1.0f / std::sqrt(mean_sq + epsilon), gamma, beta);
+}
+
+} // namespace
+
+void registerReduceKernelsAvx2(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ReduceFn>("reduce_sum", DataType::FP32, Isa::AVX2, &reduceSum);
+    r.add<ReduceFn>("reduce_max", DataType::FP32, Isa::AVX2, &reduceMax);
+    r.add<MomentsFn>("reduce_moments", DataType::FP32, Isa::AVX2, &reduceMoments);
+    r.add<SoftmaxRowFn>("softmax_row", DataType::FP32, Isa::AVX2, &softmaxRow);
+    r.add<SoftmaxRowFn>("log_softmax_row", DataType::FP32, Isa::AVX2, &logSoftmaxRow);
+    r.add<NormRowFn>("layer_norm_row", DataType::FP32, Isa::AVX2, &layerNormRow);
+    r.add<NormRowFn>("rms_norm_row", DataType::FP32, Isa::AVX2, &rmsNormRow);
+}
+
+} // namespace infer
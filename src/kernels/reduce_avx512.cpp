@@ -0,0 +1,175 @@
+#include "builtin_kernels.h"
+#include "math_avx512.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <cmath>
+#include <limits>
+
+namespace infer {
+
+namespace {
+
+using avx512::exp512;
+using avx512::tailMask512;
+
+float reduceSum(const float* x, std::size_t n) {
+    __m512 a0 = _mm512_setzero_ps(), a1 = a0, a2 = a0, a3 = a0;
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        a0 = _mm512_add_ps(a0, _mm512_loadu_ps(x + i));
+        a1 = _mm512_add_ps(a1, _mm512_loadu_ps(x + i + 16));
+        a2 = _mm512_add_ps(a2, _mm512_loadu_ps(x + i + 32));
+        a3 = _mm512_add_ps(a3, _mm512_loadu_ps(x + i + 48));
+    }
+    for (; i + 16 <= n; i += 16) a0 = _mm512_add_ps(a0, _mm512_loadu_ps(x + i));
+    if (i < n) a1 = _mm512_add_ps(a1, _mm512_maskz_loadu_ps(tailMask512(n - i), x + i));
+    return _mm512_reduce_add_ps(_mm512_add_ps(_mm512_add_ps(a0, a1), _mm512_add_ps(a2, a3)));
+}
+
+float reduceMax(const float* x, std::size_t n) {
+    const __m512 neg_inf = _mm512_set1_ps(-std::numeric_limits<float>::infinity());
+    __m512 m0 = neg_inf, m1 = neg_inf, m2 = neg_inf, m3 = neg_inf;
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        m0 = _mm512_max_ps(m0, _mm512_loadu_ps(x + i));
+        m1 = _mm512_max_ps(m1, _mm512_loadu_ps(x + i + 16));
+        m2 = _mm512_max_ps(m2, _mm512_loadu_ps(x + i + 32));
+        m3 = _mm512_max_ps(m3, _mm512_loadu_ps(x + i + 48));
+    }
+    for (; i + 16 <= n; i += 16) m0 = _mm512_max_ps(m0, _mm512_loadu_ps(x + i));
+    if (i < n) m1 = _mm512_max_ps(m1, _mm512_mask_loadu_ps(neg_inf, tailMask512(n - i), x + i));
+    return _mm512_reduce_max_ps(_mm512_max_ps(_mm512_max_ps(m0, m1), _mm512_max_ps(m2, m3)));
+}
+
+// Sum of (x - c)^2.
+float sumSquaredDiff(const float* x, std::size_t n, float c) {
+    const __m512 vc = _mm512_set1_ps(c);
+    __m512 a0 = _mm512_setzero_ps(), a1 = a0;
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m512 d0 = _mm512_sub_ps(_mm512_loadu_ps(x + i), vc);
+        const __m512 d1 = _mm512_sub_ps(_mm512_loadu_ps(x + i + 16), vc);
+        a0 = _mm512_fmadd_ps(d0, d0, a0);
+        a1 = _mm512_fmadd_ps(d1, d1, a1);
+    }
+    for (; i + 16 <= n; i += 16) {
+        const __m512 d = _mm512_sub_ps(_mm512_loadu_ps(x + i), vc);
+        a0 = _mm512_fmadd_ps(d, d, a0);
+    }
+    if (i < n) {
+        const __mmask16 mask = tailMask512(n - i);
+        const __m512 d = _mm512_maskz_sub_ps(mask, _mm512_maskz_loadu_ps(mask, x + i), vc);
+        a1 = _mm512_fmadd_ps(d, d, a1);
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(a0, a1));
+}
+
+void reduceMoments(const float* x, std::size_t n, float* mean, float* variance) {
+    if (n == 0) {
+        *mean = 0.0f;
+        *variance = 0.0f;
+        return;
+    }
+    const float m = reduceSum(x, n) / static_cast<float>(n);
+    *mean = m;
+    *variance = sumSquaredDiff(x, n, m) / static_cast<float>(n);
+}
+
+void scaleRow(float* y, std::size_t n, float s) {
+    const __m512 vs = _mm512_set1_ps(s);
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) _mm512_storeu_ps(y + i, _mm512_mul_ps(_mm512_loadu_ps(y + i), vs));
+    if (i < n) {
+        const __mmask16 mask = tailMask512(n - i);
+        _mm512_mask_storeu_ps(y + i, mask, _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, y + i), vs));
+    }
+}
+
+// Stores exp(x - max) to y (when y is not null) and returns the sum.
+float expShiftedSum(const float* x, float* y, std::size_t n, float max_v) {
+    const __m512 vmax = _mm512_set1_ps(max_v);
+    __m512 a0 = _mm512_setzero_ps(), a1 = a0;
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m512 e0 = exp512(_mm512_sub_ps(_mm512_loadu_ps(x + i), vmax));
+        const __m512 e1 = exp512(_mm512_sub_ps(_mm512_loadu_ps(x + i + 16), vmax));
+        if (y != nullptr) {
+            _mm512_storeu_ps(y + i, e0);
+            _mm512_storeu_ps(y + i + 16, e1);
+        }
+        a0 = _mm512_add_ps(a0, e0);
+        a1 = _mm512_add_ps(a1, e1);
+    }
+    for (; i + 16 <= n; i += 16) {
+        const __m512 e = exp512(_mm512_sub_ps(_mm512_loadu_ps(x + i), vmax));
+        if (y != nullptr) _mm512_storeu_ps(y + i, e);
+        a0 = _mm512_add_ps(a0, e);
+    }
+    if (i < n) {
+        const __mmask16 mask = tailMask512(n - i);
+        const __m512 d = _mm512_sub_ps(_mm512_maskz_loadu_ps(mask, x + i), vmax);
+        const __m512 e = _mm512_maskz_mov_ps(mask, exp512(d));
+        if (y != nullptr) _mm512_mask_storeu_ps(y + i, mask, e);
+        a1 = _mm512_add_ps(a1, e);
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(a0, a1));
+}
+
+void softmaxRow(const float* x, float* y, std::size_t n) {
+    const float sum = expShiftedSum(x, y, n, reduceMax(x, n));
+    scaleRow(y, n, sum == 0.0f ? 0.0f : 1.0f / sum);
+}
+
+void logSoftmaxRow(const float* x, float* y, std::size_t n) {
+    const float max_v = reduceMax(x, n);
+    const __m512 shift = _mm512_set1_ps(max_v + std::log(expShiftedSum(x, nullptr, n, max_v)));
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) _mm512_storeu_ps(y + i, _mm512_sub_ps(_mm512_loadu_ps(x + i), shift));
+    if (i < n) {
+        const __mmask16 mask = tailMask512(n - i);
+        _mm512_mask_storeu_ps(y + i, mask, _mm512_sub_ps(_mm512_maskz_loadu_ps(mask, x + i), shift));
+    }
+}
+
+// y = (x - center) * scale * gamma + beta, with null gamma/beta as 1/0.
+void normalizeRow(const float* x, float* y, std::size_t n, float center, float scale, const float* gamma,
+                  const float* beta) {
+    const __m512 vc = _mm512_set1_ps(center);
+    const __m512 vs = _mm512_set1_ps(scale);
+    const __m512 one = _mm512_set1_ps(1.0f);
+    const __m512 zero = _mm512_setzero_ps();
+    for (std::size_t i = 0; i < n; i += 16) {
+        const __mmask16 mask = n - i >= 16 ? static_cast<__mmask16>(0xFFFF) : tailMask512(n - i);
+        const __m512 v = _mm512_mul_ps(_mm512_sub_ps(_mm512_maskz_loadu_ps(mask, x + i), vc), vs);
+        const __m512 g = gamma != nullptr ? _mm512_maskz_loadu_ps(mask, gamma + i) : one;
+        const __m512 b = beta != nullptr ? _mm512_maskz_loadu_ps(mask, beta + i) : zero;
+        _mm512_mask_storeu_ps(y + i, mask, _mm512_fmadd_ps(v, g, b));
+    }
+}
+
+void layerNormRow(const float* x, float* y, std::size_t n, const float* gamma, const float* beta, float epsilon) {
+    float mean = 0.0f, variance = 0.0f;
+    reduceMoments(x, n, &mean, &variance);
+    normalizeRow(x, y, n, mean, 1.0f / std::sqrt(variance + epsilon), gamma, beta);
+}
+
+void rmsNormRow(const float* x, float* y, std::size_t n, const float* gamma, const float* beta, float epsilon) {
+    const float mean_sq = n == 0 ? 0.0f : sumSquaredDiff(x, n, 0.0f) / static_cast<float>(n);
+    normalizeRow(x, y, n, 0.0f, 1.0f / std::sqrt(mean_sq + epsilon), gamma, beta);
+}
+
+} // namespace
+
+void registerReduceKernelsAvx512(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ReduceFn>("reduce_sum", DataType::FP32, Isa::AVX512, &reduceSum);
+    r.add<ReduceFn>("reduce_max", DataType::FP32, Isa::AVX512, &reduceMax);
+    r.add<MomentsFn>("reduce_moments", DataType::FP32, Isa::AVX512, &reduceMoments);
+    r.add<SoftmaxRowFn>("softmax_row", DataType::FP32, Isa::AVX512, &softmaxRow);
+    r.add<SoftmaxRowFn>("log_softmax_row", DataType::FP32, Isa::AVX512, &logSoftmaxRow);
+    r.add<NormRowFn>("layer_norm_row", DataType::FP32, Isa::AVX512, &layerNormRow);
+    r.add<NormRowFn>("rms_norm_row", DataType::FP32, Isa::AVX512, &rmsNormRow);
+}
+
+} // namespace infer
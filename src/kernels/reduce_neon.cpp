@@ -0,0 +1,152 @@
+#include "builtin_kernels.h"
+#include "math_neon.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <cmath>
+#include <limits>
+
+namespace infer {
+
+namespace {
+
+using neon::exp128;
+
+// Four-lane bodies; the last n % 4 elements go through the same scalar
+// expressions, so no load reads past the row.
+float reduceSum(const float* x, std::size_t n) {
+    float32x4_t a0 = vdupq_n_f32(0.0f), a1 = a0;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        a0 = vaddq_f32(a0, vld1q_f32(x + i));
+        a1 = vaddq_f32(a1, vld1q_f32(x + i + 4));
+    }
+    for (; i + 4 <= n; i += 4) a0 = vaddq_f32(a0, vld1q_f32(x + i));
+    float sum = vaddvq_f32(vaddq_f32(a0, a1));
+    for (; i < n; ++i) sum += x[i];
+    return sum;
+}
+
+float reduceMax(const float* x, std::size_t n) {
+    float32x4_t m0 = vdupq_n_f32(-std::numeric_limits<float>::infinity()), m1 = m0;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        m0 = vmaxq_f32(m0, vld1q_f32(x + i));
+        m1 = vmaxq_f32(m1, vld1q_f32(x + i + 4));
+    }
+    for (; i + 4 <= n; i += 4) m0 = vmaxq_f32(m0, vld1q_f32(x + i));
+    float m = vmaxvq_f32(vmaxq_f32(m0, m1));
+    for (; i < n; ++i) m = x[i] > m ? x[i] : m;
+    return m;
+}
+
+// Sum of (x - c)^2.
+float sumSquaredDiff(const float* x, std::size_t n, float c) {
+    const float32x4_t vc = vdupq_n_f32(c);
+    float32x4_t a0 = vdupq_n_f32(0.0f), a1 = a0;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const float32x4_t d0 = vsubq_f32(vld1q_f32(x + i), vc);
+        const float32x4_t d1 = vsubq_f32(vld1q_f32(x + i + 4), vc);
+        a0 = vfmaq_f32(a0, d0, d0);
+        a1 = vfmaq_f32(a1, d1, d1);
+    }
+    for (; i + 4 <= n; i += 4) {
+        const float32x4_t d = vsubq_f32(vld1q_f32(x + i), vc);
+        a0 = vfmaq_f32(a0, d, d);
+    }
+    float sum = vaddvq_f32(vaddq_f32(a0, a1));
+    for (; i < n; ++i) sum += (x[i] - c) * (x[i] - c);
+    return sum;
+}
+
+void reduceMoments(const float* x, std::size_t n, float* mean, float* variance) {
+    if (n == 0) {
+        *mean = 0.0f;
+        *variance = 0.0f;
+        return;
+    }
+    const float m = reduceSum(x, n) / static_cast<float>(n);
+    *mean = m;
+    *variance = sumSquaredDiff(x, n, m) / static_cast<float>(n);
+}
+
+// Stores exp(x - max) to y (when y is not null) and returns the sum.
+float expShiftedSum(const float* x, float* y, std::size_t n, float max_v) {
+    const float32x4_t vmax = vdupq_n_f32(max_v);
+    float32x4_t acc = vdupq_n_f32(0.0f);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const float32x4_t e = exp128(vsubq_f32(vld1q_f32(x + i), vmax));
+        if (y != nullptr) vst1q_f32(y + i, e);
+        acc = vaddq_f32(acc, e);
+    }
+    float sum = vaddvq_f32(acc);
+    for (; i < n; ++i) {
+        const float e = std::exp(x[i] - max_v);
+        if (y != nullptr) y[i] = e;
+        sum += e;
+    }
+    return sum;
+}
+
+void softmaxRow(const float* x, float* y, std::size_t n) {
+    const float sum = expShiftedSum(x, y, n, reduceMax(x, n));
+    const float inv_sum = sum == 0.0f ? 0.0f : 1.0f / sum;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) vst1q_f32(y + i, vmulq_n_f32(vld1q_f32(y + i), inv_sum));
+    for (; i < n; ++i) y[i] *= inv_sum;
+}
+
+void logSoftmaxRow(const float* x, float* y, std::size_t n) {
+    const float max_v = reduceMax(x, n);
+    const float shift = max_v + std::log(expShiftedSum(x, nullptr, n, max_v));
+    const float32x4_t vshift = vdupq_n_f32(shift);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) vst1q_f32(y + i, vsubq_f32(vld1q_f32(x + i), vshift));
+    for (; i < n; ++i) y[i] = x[i] - shift;
+}
+
+// y = (x - center) * scale * gamma + beta, with null gamma/beta as 1/0.
+void normalizeRow(const float* x, float* y, std::size_t n, float center, float scale, const float* gamma,
+                  const float* beta) {
+    const float32x4_t vc = vdupq_n_f32(center);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const float32x4_t v = vmulq_n_f32(vsubq_f32(vld1q_f32(x + i), vc), scale);
+        const float32x4_t g = gamma != nullptr ? vld1q_f32(gamma + i) : one;
+        const float32x4_t b = beta != nullptr ? vld1q_f32(beta + i) : zero;
+        vst1q_f32(y + i, vfmaq_f32(b, v, g));
+    }
+    for (; i < n; ++i) {
+        y[i] = (x[i] - center) * scale * (gamma != nullptr ? gamma[i] : 1.0f) + (beta != nullptr ? beta[i] : 0.0f);
+    }
+}
+
+void layerNormRow(const float* x, float* y, std::size_t n, const float* gamma, const float* beta, float epsilon) {
+    float mean = 0.0f, variance = 0.0f;
+    reduceMoments(x, n, &mean, &variance);
+    normalizeRow(x, y, n, mean, 1.0f / std::sqrt(variance + epsilon), gamma, beta);
+}
+
+void rmsNormRow(const float* x, float* y, std::size_t n, const float* gamma, const float* beta, float epsilon) {
+    const float mean_sq = n == 0 ? 0.0f : sumSquaredDiff(x, n, 0.0f) / static_cast<float>(n);
+    normalizeRow(x, y, n, 0.0f, 1.0f / std::sqrt(mean_sq + epsilon), gamma, beta);
+}
+
+} // namespace
+
+void registerReduceKernelsNeon(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ReduceFn>("reduce_sum", DataType::FP32, Isa::NEON, &reduceSum);
+    r.add<ReduceFn>("reduce_max", DataType::FP32, Isa::NEON, &reduceMax);
+    r.add<MomentsFn>("reduce_moments", DataType::FP32, Isa::NEON, &reduceMoments);
+    r.add<SoftmaxRowFn>("softmax_row", DataType::FP32, Isa::NEON, &softmaxRow);
+    r.add<SoftmaxRowFn>("log_softmax_row", DataType::FP32, Isa::NEON, &logSoftmaxRow);
+    r.add<NormRowFn>("layer_norm_row", DataType::FP32, Isa::NEON, &layerNormRow);
+    r.add<NormRowFn>("rms_norm_row", DataType::FP32, Isa::NEON, &rmsNormRow);
+}
+
+} // namespace infer
@@ -0,0 +1,89 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <cmath>
+#include <limits>
+
+namespace infer {
+
+namespace scalar {
+
+float reduceSum(const float* x, std::size_t n) {
+    float sum = 0.0f;
+    for (std::size_t i = 0; i < n; ++i) sum += x[i];
+    return sum;
+}
+
+float reduceMax(const float* x, std::size_t n) {
+    float m = -std::numeric_limits<float>::infinity();
+    for (std::size_t i = 0; i < n; ++i) m = x[i] > m ? x[i] : m;
+    return m;
+}
+
+void reduceMoments(const float* x, std::size_t n, float* mean, float* variance) {
+    if (n == 0) {
+        *mean = 0.0f;
+        *variance = 0.0f;
+        return;
+    }
+    const float m = reduceSum(x, n) / static_cast<float>(n);
+    float sq = 0.0f;
+    for (std::size_t i = 0; i < n; ++i) sq += (x[i] - m) * (x[i] - m);
+    *mean = m;
+    *variance = sq / static_cast<float>(n);
+}
+
+void softmaxRow(const float* x, float* y, std::size_t n) {
+    const float max_v = reduceMax(x, n);
+    float sum = 0.0f;
+    for (std::size_t i = 0; i < n; ++i) {
+        y[i] = std::exp(x[i] - max_v);
+        sum += y[i];
+    }
+    const float inv_sum = sum == 0.0f ? 0.0f : 1.0f / sum;
+    for (std::size_t i = 0; i < n; ++i) y[i] *= inv_sum;
+}
+
+void logSoftmaxRow(const float* x, float* y, std::size_t n) {
+    const float max_v = reduceMax(x, n);
+    float sum = 0.0f;
+    for (std::size_t i = 0; i < n; ++i) sum += std::exp(x[i] - max_v);
+    const float shift = max_v + std::log(sum);
+    for (std::size_t i = 0; i < n; ++i) y[i] = x[i] - shift;
+}
+
+void layerNormRow(const float* x, float* y, std::size_t n, const float* gamma, const float* beta, float epsilon) {
+    float mean = 0.0f, variance = 0.0f;
+    reduceMoments(x, n, &mean, &variance);
+    const float rstd = 1.0f / std::sqrt(variance + epsilon);
+    for (std::size_t i = 0; i < n; ++i) {
+        const float v = (x[i] - mean) * rstd;
+        y[i] = v * (gamma != nullptr ? gamma[i] : 1.0f) + (beta != nullptr ? beta[i] : 0.0f);
+    }
+}
+
+void rmsNormRow(const float* x, float* y, std::size_t n, const float* gamma, const float* beta, float epsilon) {
+    float sq = 0.0f;
+    for (std::size_t i = 0; i < n; ++i) sq += x[i] * x[i];
+    const float mean_sq = n == 0 ? 0.0f : sq / static_cast<float>(n);
+    const float rstd = 1.0f / std::sqrt(mean_sq + epsilon);
+    for (std::size_t i = 0; i < n; ++i) {
+        y[i] = x[i] * rstd * (gamma != nullptr ? gamma[i] : 1.0f) + (beta != nullptr ? beta[i] : 0.0f);
+    }
+}
+
+} // namespace scalar
+
+void registerReduceKernelsScalar(KernelRegistry& r) {
+    using inference_engine::core::DataType;
+    r.add<ReduceFn>("reduce_sum", DataType::FP32, Isa::Scalar, &scalar::reduceSum);
+    r.add<ReduceFn>("reduce_max", DataType::FP32, Isa::Scalar, &scalar::reduceMax);
+    r.add<MomentsFn>("reduce_moments", DataType::FP32, Isa::Scalar, &scalar::reduceMoments);
+    r.add<SoftmaxRowFn>("softmax_row", DataType::FP32, Isa::Scalar, &scalar::softmaxRow);
+    r.add<SoftmaxRowFn>("log_softmax_row", DataType::FP32, Isa::Scalar, &scalar::logSoftmaxRow);
+    r.add<NormRowFn>("layer_norm_row", DataType::FP32, Isa::Scalar, &scalar::layerNormRow);
+    r.add<NormRowFn>("rms_norm_row", DataType::FP32, Isa::Scalar, &scalar::rmsNormRow);
+}
+
+} // namespace infer
@@ -0,0 +1,205 @@
+#include "inference_engine/kernels/registry.h"
+
+#include "builtin_kernels.h"
+#include "inference_engine/kernels/linear_blockq.h"
+#include "inference_engine/kernels/linear_int8.h"
+#include "inference_engine/kernels/linear_scalar.h"
+#include "inference_engine/kernels/linear_sparse.h"
+#if defined(IE_KERNELS_AVX2)
+#include "inference_engine/kernels/linear_avx2.h"
+#endif
+#if defined(IE_KERNELS_AVX512)
+#include "inference_engine/kernels/linear_avx512.h"
+#endif
+#if defined(IE_KERNELS_NEON)
+#include "inference_engine/kernels/linear_neon.h"
+#endif
+
+#include <stdexcept>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+
+namespace {
+
+void registerBuiltinKernels(KernelRegistry& r) {
+    using LinearFn = void(const LinearArgs&);
+    using LinearFp16Fn = void(const LinearFp16Args&);
+    using LinearPackedFn = void(const LinearPackedArgs&);
+    using LinearPackedPanelFn = std::size_t();
+    r.add<LinearFn>("linear", DataType::FP32, Isa::Scalar, &linear_scalar);
+    r.add<LinearFp16Fn>("linear", DataType::FP16, Isa::Scalar, &linear_fp16_scalar);
+    r.add<LinearPackedFn>("linear_packed", DataType::FP32, Isa::Scalar, &linear_packed_scalar);
+    r.add<LinearPackedPanelFn>("linear_packed_panel", DataType::FP32, Isa::Scalar, &linear_packed_panel_scalar);
+#if defined(IE_KERNELS_AVX2)
+    r.add<LinearFn>("linear", DataType::FP32, Isa::AVX2, &linear_avx2);
+    r.add<LinearFp16Fn>("linear", DataType::FP16, Isa::AVX2, &linear_fp16_avx2);
+    r.add<LinearPackedFn>("linear_packed", DataType::FP32, Isa::AVX2, &linear_packed_avx2);
+    r.add<LinearPackedPanelFn>("linear_packed_panel", DataType::FP32, Isa::AVX2, &linear_packed_panel_avx2);
+#endif
+#if defined(IE_KERNELS_AVX512)
+    r.add<LinearFn>("linear", DataType::FP32, Isa::AVX512, &linear_avx512);
+    r.add<LinearFp16Fn>("linear", DataType::FP16, Isa::AVX512, &linear_fp16_avx512);
+    r.add<LinearPackedFn>("linear_packed", DataType::FP32, Isa::AVX512, &linear_packed_avx512);
+    r.add<LinearPackedPanelFn>("linear_packed_panel", DataType::FP32, Isa::AVX512, &linear_packed_panel_avx512);
+#endif
+#if defined(IE_KERNELS_NEON)
+    r.add<LinearFn>("linear", DataType::FP32, Isa::NEON, &linear_neon);
+    r.add<LinearFp16Fn>("linear", DataType::FP16, Isa::NEON, &linear_fp16_neon);
+    r.add<LinearPackedFn>("linear_packed", DataType::FP32, Isa::NEON, &linear_packed_neon);
+    r.add<LinearPackedPanelFn>("linear_packed_panel", DataType::FP32, Isa::NEON, &linear_packed_panel_neon);
+#endif
+
+    registerQuantizeKernelsScalar(r);
+#if defined(IE_KERNELS_AVX2)
+    registerQuantizeKernelsAvx2(r);
+#endif
+#if defined(IE_KERNELS_AVX512)
+    registerQuantizeKernelsAvx512(r);
+#endif
+#if defined(IE_KERNELS_NEON)
+    registerQuantizeKernelsNeon(r);
+#endif
+
+    registerConvertKernelsScalar(r);
+#if defined(IE_KERNELS_AVX2)
+    registerConvertKernelsAvx2(r);
+#endif
+#if defined(IE_KERNELS_AVX512)
+    registerConvertKernelsAvx512(r);
+#endif
+#if defined(IE_KERNELS_NEON)
+    registerConvertKernelsNeon(r);
+#endif
+
+    registerTransposeKernelsScalar(r);
+#if defined(IE_KERNELS_AVX2)
+    registerTransposeKernelsAvx2(r);
+#endif
+#if defined(IE_KERNELS_NEON)
+    registerTransposeKernelsNeon(r);
+#endif
+
+    registerElementwiseKernelsScalar(r);
+#if defined(IE_KERNELS_AVX2)
+    registerElementwiseKernelsAvx2(r);
+#endif
+#if defined(IE_KERNELS_NEON)
+    registerElementwiseKernelsNeon(r);
+#endif
+
+    registerReduceKernelsScalar(r);
+#if defined(IE_KERNELS_AVX2)
+    registerReduceKernelsAvx2(r);
+#endif
+#if defined(IE_KERNELS_AVX512)
+    registerReduceKernelsAvx512(r);
+#endif
+#if defined(IE_KERNELS_NEON)
+    registerReduceKernelsNeon(r);
+#endif
+
+    registerConvKernelsScalar(r);
+#if defined(IE_KERNELS_AVX2)
+    registerConvKernelsAvx2(r);
+#endif
+#if defined(IE_KERNELS_AVX512)
+    registerConvKernelsAvx512(r);
+#endif
+
+    r.add<PagedAttentionFn>("paged_attention", DataType::FP32, Isa::Scalar, &paged_attention_scalar);
+#if defined(IE_KERNELS_AVX2)
+    registerAttentionKernelsAvx2(r);
+#endif
+#if defined(IE_KERNELS_AVX512)
+    registerAttentionKernelsAvx512(r);
+#endif
+
+    r.add<LinearBlockQFn>("linear_blockq", DataType::FP32, Isa::Scalar, &linear_blockq_scalar);
+#if defined(IE_KERNELS_AVX2)
+    registerLinearBlockQKernelsAvx2(r);
+#endif
+#if defined(IE_KERNELS_AVX512)
+    registerLinearBlockQKernelsAvx512(r);
+#endif
+
+    r.add<LinearSparseFn>("linear_sparse", DataType::FP32, Isa::Scalar, &linear_sparse_scalar);
+#if defined(IE_KERNELS_AVX2)
+    registerLinearSparseKernelsAvx2(r);
+#endif
+#if defined(IE_KERNELS_AVX512)
+    registerLinearSparseKernelsAvx512(r);
+#endif
+
+    r.add<LinearInt8Fn>("linear", DataType::INT8, Isa::Scalar, &linear_int8_scalar);
+#if defined(IE_KERNELS_AVX2)
+    registerLinearInt8KernelsAvx2(r);
+#endif
+#if defined(IE_KERNELS_AVX512VNNI)
+    registerLinearInt8KernelsAvx512Vnni(r);
+#endif
+#if defined(IE_KERNELS_NEON_DOTPROD)
+    registerLinearInt8KernelsNeonDotprod(r);
+#endif
+}
+
+} // namespace
+
+KernelRegistry& KernelRegistry::instance() {
+    static KernelRegistry registry;
+    return registry;
+}
+
+KernelRegistry::KernelRegistry() {
+    registerBuiltinKernels(*this);
+}
+
+void KernelRegistry::add(std::string op, DataType dtype, Isa isa, KernelFn fn) {
+    if (fn == nullptr) {
+        throw std::invalid_argument("KernelRegistry::add: null kernel for " + op);
+    }
+    std::lock_guard<std::mutex> lock(mu_);
+    for (KernelEntry& e : entries_) {
+        if (e.op == op && e.dtype == dtype && e.isa == isa) {
+            e.fn = fn;
+            return;
+        }
+    }
+    entries_.push_back({std::move(op), dtype, isa, fn});
+}
+
+const KernelEntry* KernelRegistry::select(std::string_view op, DataType dtype, Isa max) const {
+    std::lock_guard<std::mutex> lock(mu_);
+    const KernelEntry* best = nullptr;
+    for (const KernelEntry& e : entries_) {
+        if (e.op != op || e.dtype != dtype) continue;
+        if (isa_rank(e.isa) > isa_rank(max) || !isa_supported(e.isa)) continue;
+        if (best == nullptr || isa_rank(e.isa) > isa_rank(best->isa)) {
+            best = &e;
+        }
+    }
+    return best;
+}
+
+std::vector<const KernelEntry*> KernelRegistry::candidates(std::string_view op, DataType dtype) const {
+    std::lock_guard<std::mutex> lock(mu_);
+    std::vector<const KernelEntry*> out;
+    for (const KernelEntry& e : entries_) {
+        if (e.op == op && e.dtype == dtype && isa_supported(e.isa)) {
+            out.push_back(&e);
+        }
+    }
+    return out;
+}
+
+const KernelEntry& KernelRegistry::requireEntry(std::string_view op, DataType dtype) const {
+    const KernelEntry* e = select(op, dtype);
+    if (e == nullptr) {
+        throw std::runtime_error("KernelRegistry: no kernel for " + std::string(op) + "/" +
+                                 inference_engine::core::data_type_to_string(dtype));
+    }
+    return *e;
+}
+
+} // namespace infer
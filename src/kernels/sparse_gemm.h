@@ -0,0 +1,142 @@
+#pragma once
+
+// Sparse-weight GEMM shared by the per-ISA translation units. Each TU instantiates
+// SparseGemm<V> with its own vector traits; everything has internal linkage so the
+// differently compiled copies never collide (see gemm_blocked.h).
+
+#include "inference_engine/kernels/linear_sparse.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace infer {
+namespace {
+
+// V must provide:
+//   using Acc;                                          kSparsePanel floats
+//   using Idx;                                          kSparsePanel N:M slot indices
+//   using Acc8;                                         8 floats, for 8x1 blocks
+//   static Acc zero();
+//   static Acc load(const float* v);
+//   static Idx indices(const std::uint8_t* idx);
+//   template <std::size_t M> static Acc permute(const float* x, Idx idx);   lane c = x[idx[c]], idx[c] < M
+//   static Acc spread4(const float* x);                 lane c = x[c / 4]
+//   static Acc fmadd(Acc a, Acc b, Acc acc);            acc + a * b
+//   static void store(float* y, Acc v, const float* bias, std::size_t cols, bool relu);
+//   static void store4(float* y, Acc v, const float* bias, std::size_t cols, bool relu);
+//   static Acc8 zero8();
+//   static Acc8 load8(const float* v);
+//   static Acc8 fmadd8(Acc8 w, float x, Acc8 acc);      acc + w * x
+//   static void store8(float* y, Acc8 v, const float* bias, std::size_t cols, bool relu);
+// The stores add the bias (null: none), apply ReLU and write the first `cols` lanes;
+// store4 first sums the four 4-lane quarters of v into 4 columns.
+template <typename V>
+struct SparseGemm {
+    using Acc = typename V::Acc;
+    using Acc8 = typename V::Acc8;
+    static constexpr std::size_t NR = kSparsePanel;
+    static constexpr std::size_t kRows = 4;
+
+    // R rows of one N:M panel. Each slot's weights and indices are decoded once and
+    // reused by every row.
+    template <std::size_t M, std::size_t R>
+    static void nmRows(const LinearSparseArgs& a, const float* values, const std::uint8_t* indices, std::size_t row0,
+                       const float* bias, std::size_t col, std::size_t cols) {
+        Acc acc[R];
+        for (std::size_t r = 0; r < R; ++r) acc[r] = V::zero();
+        const float* x = a.x + row0 * a.ldx;
+        for (std::size_t p0 = 0; p0 < a.k; p0 += M) {
+            for (std::size_t t = 0; t < a.pattern.n; ++t, values += NR, indices += NR) {
+                const Acc w = V::load(values);
+                const typename V::Idx idx = V::indices(indices);
+                for (std::size_t r = 0; r < R; ++r) {
+                    acc[r] = V::fmadd(w, V::template permute<M>(x + r * a.ldx + p0, idx), acc[r]);
+                }
+            }
+        }
+        const bool relu = a.activation == Activation::ReLU;
+        for (std::size_t r = 0; r < R; ++r) V::store(a.y + (row0 + r) * a.ldy + col, acc[r], bias, cols, relu);
+    }
+
+    template <std::size_t M>
+    static void nm(const LinearSparseArgs& a) {
+        const std::size_t panel = a.k / M * a.pattern.n * NR;
+        for (std::size_t col = 0; col < a.n; col += NR) {
+            const std::size_t cols = std::min(NR, a.n - col);
+            const float* values = a.values + col / NR * panel;
+            const std::uint8_t* indices = a.indices + col / NR * panel;
+            const float* bias = a.bias != nullptr ? a.bias + col : nullptr;
+            std::size_t i = 0;
+            for (; i + kRows <= a.m; i += kRows) nmRows<M, kRows>(a, values, indices, i, bias, col, cols);
+            for (; i < a.m; ++i) nmRows<M, 1>(a, values, indices, i, bias, col, cols);
+        }
+    }
+
+    // R rows of block row b, 8x1 blocks: one weight row of 8 columns per block.
+    template <std::size_t R>
+    static void blocks8x1(const LinearSparseArgs& a, std::size_t b, std::size_t row0, const float* bias,
+                          std::size_t col, std::size_t cols) {
+        Acc8 acc[R];
+        for (std::size_t r = 0; r < R; ++r) acc[r] = V::zero8();
+        const float* x = a.x + row0 * a.ldx;
+        for (std::uint32_t e = a.row_ptr[b]; e < a.row_ptr[b + 1]; ++e) {
+            const Acc8 w = V::load8(a.values + static_cast<std::size_t>(e) * 8);
+            const float* xe = x + a.col_idx[e];
+            for (std::size_t r = 0; r < R; ++r) acc[r] = V::fmadd8(w, xe[r * a.ldx], acc[r]);
+        }
+        const bool relu = a.activation == Activation::ReLU;
+        for (std::size_t r = 0; r < R; ++r) V::store8(a.y + (row0 + r) * a.ldy + col, acc[r], bias, cols, relu);
+    }
+
+    // R rows of block row b, 4x4 blocks: the 16 weights of a block in one Acc against
+    // its 4 inputs spread over the quarters, summed across quarters at the end.
+    template <std::size_t R>
+    static void blocks4x4(const LinearSparseArgs& a, std::size_t b, std::size_t row0, const float* bias,
+                          std::size_t col, std::size_t cols) {
+        Acc acc[R];
+        for (std::size_t r = 0; r < R; ++r) acc[r] = V::zero();
+        const float* x = a.x + row0 * a.ldx;
+        for (std::uint32_t e = a.row_ptr[b]; e < a.row_ptr[b + 1]; ++e) {
+            const Acc w = V::load(a.values + static_cast<std::size_t>(e) * 16);
+            const float* xe = x + static_cast<std::size_t>(a.col_idx[e]) * 4;
+            for (std::size_t r = 0; r < R; ++r) acc[r] = V::fmadd(w, V::spread4(xe + r * a.ldx), acc[r]);
+        }
+        const bool relu = a.activation == Activation::ReLU;
+        for (std::size_t r = 0; r < R; ++r) V::store4(a.y + (row0 + r) * a.ldy + col, acc[r], bias, cols, relu);
+    }
+
+    template <std::size_t BlockOut>
+    static void blockCsr(const LinearSparseArgs& a) {
+        for (std::size_t b = 0, col = 0; col < a.n; ++b, col += BlockOut) {
+            const std::size_t cols = std::min(BlockOut, a.n - col);
+            const float* bias = a.bias != nullptr ? a.bias + col : nullptr;
+            std::size_t i = 0;
+            if (BlockOut == 8) {
+                for (; i + kRows <= a.m; i += kRows) blocks8x1<kRows>(a, b, i, bias, col, cols);
+                for (; i < a.m; ++i) blocks8x1<1>(a, b, i, bias, col, cols);
+            } else {
+                for (; i + kRows <= a.m; i += kRows) blocks4x4<kRows>(a, b, i, bias, col, cols);
+                for (; i < a.m; ++i) blocks4x4<1>(a, b, i, bias, col, cols);
+            }
+        }
+    }
+
+    static void linear(const LinearSparseArgs& a) {
+        if (a.m == 0 || a.n == 0) return;
+        if (a.pattern.format == SparseFormat::NM) {
+            if (a.pattern.m == 4) {
+                nm<4>(a);
+            } else {
+                nm<8>(a);
+            }
+        } else if (a.pattern.block_out == 8) {
+            blockCsr<8>(a);
+        } else {
+            blockCsr<4>(a);
+        }
+    }
+};
+
+} // namespace
+} // namespace infer
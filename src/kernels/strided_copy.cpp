@@ -0,0 +1,190 @@
+#include "inference_engine/kernels/strided_copy.h"
+
+#include "builtin_kernels.h"
+#include "inference_engine/core/shape.h"
+#include "inference_engine/core/small_vector.h"
+#include "inference_engine/kernels/registry.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace infer {
+
+namespace {
+
+// Copies below this size stay on the calling thread; larger ones hand each task
+// about kTaskBytes.
+constexpr std::size_t kParallelBytes = std::size_t{1} << 20;
+constexpr std::size_t kTaskBytes = std::size_t{256} << 10;
+// Row tile of a transposed plane: one parallelFor unit.
+constexpr std::size_t kTransposeRows = 64;
+
+struct Dim {
+    std::int64_t size;
+    std::int64_t src;
+    std::int64_t dst;
+};
+using Dims = inference_engine::core::SmallVector<Dim, inference_engine::core::kMaxInlineRank>;
+
+struct Offsets {
+    std::int64_t src = 0;
+    std::int64_t dst = 0;
+};
+
+// Byte offsets of flat index `index` over `dims` (row-major, innermost last).
+Offsets locate(const Dims& dims, std::size_t index) noexcept {
+    Offsets off;
+    for (std::size_t i = dims.size(); i-- > 0;) {
+        const auto size = static_cast<std::size_t>(dims[i].size);
+        const auto idx = static_cast<std::int64_t>(index % size);
+        index /= size;
+        off.src += idx * dims[i].src;
+        off.dst += idx * dims[i].dst;
+    }
+    return off;
+}
+
+std::size_t count(const Dims& dims) noexcept {
+    std::size_t n = 1;
+    for (const Dim& d : dims) n *= static_cast<std::size_t>(d.size);
+    return n;
+}
+
+// Runs fn(unit) for every unit in [0, units), through parallelFor once the copy is
+// large enough to be worth the hand-off.
+template <typename Fn>
+void forEachUnit(std::size_t units, std::size_t unit_bytes, const Fn& fn) {
+    if (units <= 1 || units * unit_bytes < kParallelBytes) {
+        for (std::size_t u = 0; u < units; ++u) fn(u);
+        return;
+    }
+    const std::size_t grain = std::max<std::size_t>(1, kTaskBytes / std::max<std::size_t>(1, unit_bytes));
+    parallelFor(0, units, grain, [&fn](std::size_t begin, std::size_t end) {
+        for (std::size_t u = begin; u < end; ++u) fn(u);
+    });
+}
+
+template <typename T>
+void gatherTyped(const std::uint8_t* src, std::int64_t src_stride, std::uint8_t* dst, std::int64_t dst_stride,
+                 std::int64_t n) {
+    for (std::int64_t i = 0; i < n; ++i) {
+        T v;
+        std::memcpy(&v, src + i * src_stride, sizeof(T));
+        std::memcpy(dst + i * dst_stride, &v, sizeof(T));
+    }
+}
+
+void gather(const std::uint8_t* src, std::int64_t src_stride, std::uint8_t* dst, std::int64_t dst_stride,
+            std::int64_t n, std::size_t elem_size) {
+    switch (elem_size) {
+    case 1: gatherTyped<std::uint8_t>(src, src_stride, dst, dst_stride, n); return;
+    case 2: gatherTyped<std::uint16_t>(src, src_stride, dst, dst_stride, n); return;
+    case 4: gatherTyped<std::uint32_t>(src, src_stride, dst, dst_stride, n); return;
+    case 8: gatherTyped<std::uint64_t>(src, src_stride, dst, dst_stride, n); return;
+    default:
+        for (std::int64_t i = 0; i < n; ++i) {
+            std::memcpy(dst + i * dst_stride, src + i * src_stride, elem_size);
+        }
+    }
+}
+
+void transpose(const void* src, std::size_t ld_src, void* dst, std::size_t ld_dst, std::size_t rows,
+               std::size_t cols, std::size_t elem_size) {
+    // Resolved once per process from the host's CPU features.
+    static Transpose2dFn* const kernel32 =
+        KernelRegistry::instance().lookup<Transpose2dFn>("transpose2d", inference_engine::core::DataType::FP32);
+    if (elem_size == sizeof(std::uint32_t)) {
+        kernel32(src, ld_src, dst, ld_dst, rows, cols);
+    } else {
+        scalar::transpose2d(src, ld_src, dst, ld_dst, rows, cols, elem_size);
+    }
+}
+
+} // namespace
+
+void strided_copy(const void* src, const std::int64_t* src_strides, void* dst, const std::int64_t* dst_strides,
+                  const std::int64_t* dims, std::size_t rank, std::size_t elem_size) {
+    Dims d;
+    for (std::size_t i = 0; i < rank; ++i) {
+        if (dims[i] == 0) return;
+        if (dims[i] != 1) d.push_back({dims[i], src_strides[i], dst_strides[i]});
+    }
+    // Walk in destination order so writes stream (stable insertion sort: no
+    // allocation), then merge dimensions that are contiguous in both layouts.
+    for (std::size_t i = 1; i < d.size(); ++i) {
+        const Dim key = d[i];
+        std::size_t j = i;
+        for (; j > 0 && std::llabs(d[j - 1].dst) < std::llabs(key.dst); --j) d[j] = d[j - 1];
+        d[j] = key;
+    }
+    Dims m;
+    for (const Dim& dim : d) {
+        if (!m.empty() && m.back().src == dim.src * dim.size && m.back().dst == dim.dst * dim.size) {
+            m.back() = {m.back().size * dim.size, dim.src, dim.dst};
+        } else {
+            m.push_back(dim);
+        }
+    }
+
+    const auto* s = static_cast<const std::uint8_t*>(src);
+    auto* o = static_cast<std::uint8_t*>(dst);
+    if (m.empty()) {
+        std::memcpy(o, s, elem_size);
+        return;
+    }
+    const auto e = static_cast<std::int64_t>(elem_size);
+    const Dim inner = m.back();
+
+    // Contiguous inner runs: memcpy per run, or chunks of one dense block.
+    if (inner.src == e && inner.dst == e) {
+        m.pop_back();
+        const std::size_t run = static_cast<std::size_t>(inner.size) * elem_size;
+        if (m.empty()) {
+            const std::size_t chunks = (run + kTaskBytes - 1) / kTaskBytes;
+            forEachUnit(chunks, kTaskBytes, [&](std::size_t c) {
+                const std::size_t off = c * kTaskBytes;
+                std::memcpy(o + off, s + off, std::min(kTaskBytes, run - off));
+            });
+            return;
+        }
+        forEachUnit(count(m), run, [&](std::size_t u) {
+            const Offsets off = locate(m, u);
+            std::memcpy(o + off.dst, s + off.src, run);
+        });
+        return;
+    }
+
+    // Permuted plane: the source's innermost dimension is some outer dimension of the
+    // destination. Transpose [inner x plane] tiles for every remaining index.
+    if (inner.dst == e && inner.src > 0 && inner.src % e == 0) {
+        for (std::size_t j = 0; j + 1 < m.size(); ++j) {
+            const Dim plane = m[j];
+            if (plane.src != e || plane.dst <= 0 || plane.dst % e != 0) continue;
+            m.erase(m.begin() + static_cast<std::ptrdiff_t>(j));
+            m.pop_back();
+            const auto rows = static_cast<std::size_t>(inner.size);
+            const auto cols = static_cast<std::size_t>(plane.size);
+            const std::size_t tiles = (rows + kTransposeRows - 1) / kTransposeRows;
+            forEachUnit(count(m) * tiles, std::min(rows, kTransposeRows) * cols * elem_size, [&](std::size_t u) {
+                const Offsets off = locate(m, u / tiles);
+                const std::size_t r0 = (u % tiles) * kTransposeRows;
+                transpose(s + off.src + static_cast<std::int64_t>(r0) * inner.src,
+                          static_cast<std::size_t>(inner.src / e), o + off.dst + static_cast<std::int64_t>(r0) * e,
+                          static_cast<std::size_t>(plane.dst / e), std::min(kTransposeRows, rows - r0), cols,
+                          elem_size);
+            });
+            return;
+        }
+    }
+
+    // Anything else: strided element gather along the innermost dimension.
+    m.pop_back();
+    forEachUnit(count(m), static_cast<std::size_t>(inner.size) * elem_size, [&](std::size_t u) {
+        const Offsets off = locate(m, u);
+        gather(s + off.src, inner.src, o + off.dst, inner.dst, inner.size, elem_size);
+    });
+}
+
+} // namespace infer
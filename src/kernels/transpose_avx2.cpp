@@ -0,0 +1,91 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <immintrin.h>
+
+#include <algorithm>
+
+namespace infer {
+
+namespace {
+
+// Tiles of 64 x 64 elements (16 KiB) bound the source and destination lines in
+// flight; inside a tile the work is done in 8 x 8 register transposes.
+constexpr std::size_t kTile = 64;
+
+inline void transpose8x8(const float* src, std::size_t ld_src, float* dst, std::size_t ld_dst) {
+    const __m256 r0 = _mm256_loadu_ps(src + 0 * ld_src);
+    const __m256 r1 = _mm256_loadu_ps(src + 1 * ld_src);
+    const __m256 r2 = _mm256_loadu_ps(src + 2 * ld_src);
+    const __m256 r3 = _mm256_loadu_ps(src + 3 * ld_src);
+    const __m256 r4 = _mm256_loadu_ps(src + 4 * ld_src);
+    const __m256 r5 = _mm256_loadu_ps(src + 5 * ld_src);
+    const __m256 r6 = _mm256_loadu_ps(src + 6 * ld_src);
+    const __m256 r7 = _mm256_loadu_ps(src + 7 * ld_src);
+
+    const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    const __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+    const __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+    const __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+    const __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+    const __m256 u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 u4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 u5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 u6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 u7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+    _mm256_storeu_ps(dst + 0 * ld_dst, _mm256_permute2f128_ps(u0, u4, 0x20));
+    _mm256_storeu_ps(dst + 1 * ld_dst, _mm256_permute2f128_ps(u1, u5, 0x20));
+    _mm256_storeu_ps(dst + 2 * ld_dst, _mm256_permute2f128_ps(u2, u6, 0x20));
+    _mm256_storeu_ps(dst + 3 * ld_dst, _mm256_permute2f128_ps(u3, u7, 0x20));
+    _mm256_storeu_ps(dst + 4 * ld_dst, _mm256_permute2f128_ps(u0, u4, 0x31));
+    _mm256_storeu_ps(dst + 5 * ld_dst, _mm256_permute2f128_ps(u1, u5, 0x31));
+    _mm256_storeu_ps(dst + 6 * ld_dst, _mm256_permute2f128_ps(u2, u6, 0x31));
+    _mm256_storeu_ps(dst + 7 * ld_dst, _mm256_permute2f128_ps(u3, u7, 0x31));
+}
+
+// Loads, unpacks and shuffles never inspect the lanes, so any 4-byte payload
+// (including NaN bit patterns and integers) is moved unchanged.
+void transpose2d32(const void* src_v, std::size_t ld_src, void* dst_v, std::size_t ld_dst, std::size_t rows,
+                   std::size_t cols) {
+    const auto* src = static_cast<const float*>(src_v);
+    auto* dst = static_cast<float*>(dst_v);
+    for (std::size_t r0 = 0; r0 < rows; r0 += kTile) {
+        const std::size_t r1 = std::min(rows, r0 + kTile);
+        const std::size_t r8 = r0 + (r1 - r0) / 8 * 8;
+        for (std::size_t c0 = 0; c0 < cols; c0 += kTile) {
+            const std::size_t c1 = std::min(cols, c0 + kTile);
+            const std::size_t c8 = c0 + (c1 - c0) / 8 * 8;
+            for (std::size_t r = r0; r < r8; r += 8) {
+                for (std::size_t c = c0; c < c8; c += 8) {
+                    transpose8x8(src + r * ld_src + c, ld_src, dst + c * ld_dst + r, ld_dst);
+                }
+            }
+            // Ragged edges of the tile.
+            if (c8 < c1) {
+                scalar::transpose2d(src + r0 * ld_src + c8, ld_src, dst + c8 * ld_dst + r0, ld_dst, r1 - r0, c1 - c8,
+                                    sizeof(float));
+            }
+            if (r8 < r1) {
+                scalar::transpose2d(src + r8 * ld_src + c0, ld_src, dst + c0 * ld_dst + r8, ld_dst, r1 - r8, c8 - c0,
+                                    sizeof(float));
+            }
+        }
+    }
+}
+
+} // namespace
+
+void registerTransposeKernelsAvx2(KernelRegistry& r) {
+    r.add<Transpose2dFn>("transpose2d", inference_engine::core::DataType::FP32, Isa::AVX2, &transpose2d32);
+}
+
+} // namespace infer
@@ -0,0 +1,59 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <arm_neon.h>
+
+#include <algorithm>
+
+namespace infer {
+
+namespace {
+
+// Tiles of 64 x 64 elements bound the lines in flight; inside a tile the work is
+// done in 4 x 4 register transposes.
+constexpr std::size_t kTile = 64;
+
+inline void transpose4x4(const std::uint32_t* src, std::size_t ld_src, std::uint32_t* dst, std::size_t ld_dst) {
+    const uint32x4x2_t t01 = vtrnq_u32(vld1q_u32(src), vld1q_u32(src + ld_src));
+    const uint32x4x2_t t23 = vtrnq_u32(vld1q_u32(src + 2 * ld_src), vld1q_u32(src + 3 * ld_src));
+    vst1q_u32(dst, vcombine_u32(vget_low_u32(t01.val[0]), vget_low_u32(t23.val[0])));
+    vst1q_u32(dst + ld_dst, vcombine_u32(vget_low_u32(t01.val[1]), vget_low_u32(t23.val[1])));
+    vst1q_u32(dst + 2 * ld_dst, vcombine_u32(vget_high_u32(t01.val[0]), vget_high_u32(t23.val[0])));
+    vst1q_u32(dst + 3 * ld_dst, vcombine_u32(vget_high_u32(t01.val[1]), vget_high_u32(t23.val[1])));
+}
+
+void transpose2d32(const void* src_v, std::size_t ld_src, void* dst_v, std::size_t ld_dst, std::size_t rows,
+                   std::size_t cols) {
+    const auto* src = static_cast<const std::uint32_t*>(src_v);
+    auto* dst = static_cast<std::uint32_t*>(dst_v);
+    for (std::size_t r0 = 0; r0 < rows; r0 += kTile) {
+        const std::size_t r1 = std::min(rows, r0 + kTile);
+        const std::size_t r4 = r0 + (r1 - r0) / 4 * 4;
+        for (std::size_t c0 = 0; c0 < cols; c0 += kTile) {
+            const std::size_t c1 = std::min(cols, c0 + kTile);
+            const std::size_t c4 = c0 + (c1 - c0) / 4 * 4;
+            for (std::size_t r = r0; r < r4; r += 4) {
+                for (std::size_t c = c0; c < c4; c += 4) {
+                    transpose4x4(src + r * ld_src + c, ld_src, dst + c * ld_dst + r, ld_dst);
+                }
+            }
+            if (c4 < c1) {
+                scalar::transpose2d(src + r0 * ld_src + c4, ld_src, dst + c4 * ld_dst + r0, ld_dst, r1 - r0, c1 - c4,
+                                    sizeof(std::uint32_t));
+            }
+            if (r4 < r1) {
+                scalar::transpose2d(src + r4 * ld_src + c0, ld_src, dst + c0 * ld_dst + r4, ld_dst, r1 - r4, c4 - c0,
+                                    sizeof(std::uint32_t));
+            }
+        }
+    }
+}
+
+} // namespace
+
+void registerTransposeKernelsNeon(KernelRegistry& r) {
+    r.add<Transpose2dFn>("transpose2d", inference_engine::core::DataType::FP32, Isa::NEON, &transpose2d32);
+}
+
+} // namespace infer
@@ -0,0 +1,77 @@
+#include "builtin_kernels.h"
+
+#include "inference_engine/kernels/registry.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace infer {
+
+namespace {
+
+// 16 x 16 tiles keep one block of source rows and destination columns in L1.
+constexpr std::size_t kBlock = 16;
+
+template <typename T>
+void transposeBlocked(const T* src, std::size_t ld_src, T* dst, std::size_t ld_dst, std::size_t rows,
+                      std::size_t cols) {
+    for (std::size_t r0 = 0; r0 < rows; r0 += kBlock) {
+        const std::size_t r1 = std::min(rows, r0 + kBlock);
+        for (std::size_t c0 = 0; c0 < cols; c0 += kBlock) {
+            const std::size_t c1 = std::min(cols, c0 + kBlock);
+            for (std::size_t c = c0; c < c1; ++c) {
+                for (std::size_t r = r0; r < r1; ++r) {
+                    dst[c * ld_dst + r] = src[r * ld_src + c];
+                }
+            }
+        }
+    }
+}
+
+void transpose2d32(const void* src, std::size_t ld_src, void* dst, std::size_t ld_dst, std::size_t rows,
+                   std::size_t cols) {
+    scalar::transpose2d(src, ld_src, dst, ld_dst, rows, cols, sizeof(std::uint32_t));
+}
+
+} // namespace
+
+namespace scalar {
+
+void transpose2d(const void* src, std::size_t ld_src, void* dst, std::size_t ld_dst, std::size_t rows,
+                 std::size_t cols, std::size_t elem_size) {
+    switch (elem_size) {
+    case 1:
+        transposeBlocked(static_cast<const std::uint8_t*>(src), ld_src, static_cast<std::uint8_t*>(dst), ld_dst,
+                         rows, cols);
+        return;
+    case 2:
+        transposeBlocked(static_cast<const std::uint16_t*>(src), ld_src, static_cast<std::uint16_t*>(dst), ld_dst,
+                         rows, cols);
+        return;
+    case 4:
+        transposeBlocked(static_cast<const std::uint32_t*>(src), ld_src, static_cast<std::uint32_t*>(dst), ld_dst,
+                         rows, cols);
+        return;
+    case 8:
+        transposeBlocked(static_cast<const std::uint64_t*>(src), ld_src, static_cast<std::uint64_t*>(dst), ld_dst,
+                         rows, cols);
+        return;
+    default:
+        break;
+    }
+    const auto* s = static_cast<const std::uint8_t*>(src);
+    auto* d = static_cast<std::uint8_t*>(dst);
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t c = 0; c < cols; ++c) {
+            std::memcpy(d + (c * ld_dst + r) * elem_size, s + (r * ld_src + c) * elem_size, elem_size);
+        }
+    }
+}
+
+} // namespace scalar
+
+void registerTransposeKernelsScalar(KernelRegistry& r) {
+    r.add<Transpose2dFn>("transpose2d", inference_engine::core::DataType::FP32, Isa::Scalar, &transpose2d32);
+}
+
+} // namespace infer
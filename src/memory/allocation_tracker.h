@@ -0,0 +1,166 @@
+#ifndef INFERENCE_ENGINE_MEMORY_ALLOCATION_TRACKER_H_
+#define INFERENCE_ENGINE_MEMORY_ALLOCATION_TRACKER_H_
+
+// Internal: allocation statistics shared by the Allocator backends.
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#include "inference_engine/memory/allocator.h"
+
+namespace inference_engine {
+namespace core {
+namespace detail {
+
+constexpr std::size_t kCacheLine = 64;
+constexpr std::size_t kTrackerShards = 64; // power of two
+
+// Shard of the counters a thread updates; threads are spread round-robin.
+inline std::size_t thread_shard() noexcept {
+	static std::atomic<std::size_t> next{0};
+	thread_local const std::size_t shard = next.fetch_add(1, std::memory_order_relaxed) & (kTrackerShards - 1);
+	return shard;
+}
+
+// Shard of the live-pointer table that holds `ptr`.
+inline std::size_t pointer_shard(const void* ptr) noexcept {
+	const auto bits = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(ptr)) >> 4;
+	return static_cast<std::size_t>((bits * 0x9E3779B97F4A7C15ull) >> 58) & (kTrackerShards - 1);
+}
+
+inline void atomic_max(std::atomic<std::int64_t>& target, std::int64_t value) noexcept {
+	std::int64_t current = target.load(std::memory_order_relaxed);
+	while (current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+	}
+}
+
+// Allocation tracking shared by the backends. Event counters are sharded per thread
+// and updated with relaxed atomics; stats() merges the shards. Live bytes are one
+// atomic so the peak can be kept with an atomic max. The live-pointer table (sizes
+// for deallocate(), owns()) is split into independently locked shards by address,
+// so concurrent threads touching different blocks do not serialize.
+class AllocationTracker {
+public:
+	void on_allocate(const void* ptr, std::size_t size) {
+		{
+			LiveShard& live = live_[pointer_shard(ptr)];
+			std::lock_guard<std::mutex> lock(live.mu);
+			live.sizes[ptr] = size;
+		}
+		CounterShard& c = counters_[thread_shard()];
+		c.allocations.fetch_add(1, std::memory_order_relaxed);
+		c.bytes_allocated.fetch_add(size, std::memory_order_relaxed);
+		c.live_allocations.fetch_add(1, std::memory_order_relaxed);
+		const auto bytes = static_cast<std::int64_t>(size);
+		atomic_max(peak_live_bytes_, live_bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+	}
+
+	// Counts a free; accounts bytes only for pointers handed out by on_allocate().
+	void on_free(const void* ptr) noexcept {
+		std::size_t size = 0;
+		bool known = false;
+		{
+			LiveShard& live = live_[pointer_shard(ptr)];
+			std::lock_guard<std::mutex> lock(live.mu);
+			const auto it = live.sizes.find(ptr);
+			if (it != live.sizes.end()) {
+				size = it->second;
+				known = true;
+				live.sizes.erase(it);
+			}
+		}
+		CounterShard& c = counters_[thread_shard()];
+		c.frees.fetch_add(1, std::memory_order_relaxed);
+		if (known) {
+			c.bytes_freed.fetch_add(size, std::memory_order_relaxed);
+			c.live_allocations.fetch_sub(1, std::memory_order_relaxed);
+			live_bytes_.fetch_sub(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+		}
+	}
+
+	// Size recorded for a live pointer, or 0.
+	std::size_t size_of(const void* ptr) const noexcept {
+		const LiveShard& live = live_[pointer_shard(ptr)];
+		std::lock_guard<std::mutex> lock(live.mu);
+		const auto it = live.sizes.find(ptr);
+		return it != live.sizes.end() ? it->second : 0;
+	}
+
+	bool is_live(const void* ptr) const noexcept {
+		const LiveShard& live = live_[pointer_shard(ptr)];
+		std::lock_guard<std::mutex> lock(live.mu);
+		return live.sizes.find(ptr) != live.sizes.end();
+	}
+
+	AllocationStats snapshot() const noexcept {
+		AllocationStats s;
+		std::int64_t live_allocations = 0;
+		for (const CounterShard& c : counters_) {
+			s.allocations += c.allocations.load(std::memory_order_relaxed);
+			s.frees += c.frees.load(std::memory_order_relaxed);
+			s.bytes_allocated += c.bytes_allocated.load(std::memory_order_relaxed);
+			s.bytes_freed += c.bytes_freed.load(std::memory_order_relaxed);
+			live_allocations += c.live_allocations.load(std::memory_order_relaxed);
+		}
+		// Counters reset by reset_stats() while blocks were live can go negative.
+		s.live_allocations = static_cast<std::size_t>(std::max<std::int64_t>(live_allocations, 0));
+		s.live_bytes = static_cast<std::size_t>(std::max<std::int64_t>(live_bytes_.load(std::memory_order_relaxed), 0));
+		s.peak_live_bytes = static_cast<std::size_t>(
+			std::max<std::int64_t>(peak_live_bytes_.load(std::memory_order_relaxed), 0));
+		s.peak_live_bytes = std::max(s.peak_live_bytes, s.live_bytes);
+		return s;
+	}
+
+	// Forgets every live pointer (arena reset); event counters and the peak remain.
+	void clear_live() noexcept {
+		for (LiveShard& live : live_) {
+			std::lock_guard<std::mutex> lock(live.mu);
+			live.sizes.clear();
+		}
+		for (CounterShard& c : counters_) {
+			c.live_allocations.store(0, std::memory_order_relaxed);
+		}
+		live_bytes_.store(0, std::memory_order_relaxed);
+	}
+
+	void reset_stats() noexcept {
+		for (CounterShard& c : counters_) {
+			c.allocations.store(0, std::memory_order_relaxed);
+			c.frees.store(0, std::memory_order_relaxed);
+			c.bytes_allocated.store(0, std::memory_order_relaxed);
+			c.bytes_freed.store(0, std::memory_order_relaxed);
+			c.live_allocations.store(0, std::memory_order_relaxed);
+		}
+		live_bytes_.store(0, std::memory_order_relaxed);
+		peak_live_bytes_.store(0, std::memory_order_relaxed);
+	}
+
+private:
+	struct alignas(kCacheLine) LiveShard {
+		mutable std::mutex mu;
+		std::unordered_map<const void*, std::size_t> sizes;
+	};
+
+	struct alignas(kCacheLine) CounterShard {
+		std::atomic<std::size_t> allocations{0};
+		std::atomic<std::size_t> frees{0};
+		std::atomic<std::size_t> bytes_allocated{0};
+		std::atomic<std::size_t> bytes_freed{0};
+		std::atomic<std::int64_t> live_allocations{0};
+	};
+
+	LiveShard live_[kTrackerShards];
+	CounterShard counters_[kTrackerShards];
+	alignas(kCacheLine) std::atomic<std::int64_t> live_bytes_{0};
+	alignas(kCacheLine) std::atomic<std::int64_t> peak_live_bytes_{0};
+};
+
+} // namespace detail
+} // namespace core
+} // namespace inference_engine
+
+#endif // INFERENCE_ENGINE_MEMORY_ALLOCATION_TRACKER_H_
@@ -1,5 +1,7 @@
 #include "inference_engine/memory/allocator.h"
 
+#include "allocation_tracker.h"
+
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
@@ -47,19 +49,27 @@ inline void free_aligned_system(void* ptr) noexcept {
 #endif
 }
 
-inline void update_peak(AllocationStats& s) noexcept {
-	s.peak_live_bytes = std::max(s.peak_live_bytes, s.live_bytes);
+memory::Arena::Options with_pages(memory::Arena::Options options, const AllocatorConfig& config) noexcept {
+	if (options.pages.is_default()) {
+		options.pages = config.pages;
+	}
+	return options;
+}
+
+memory::Arena::Options arena_options(std::size_t capacity, std::size_t base_alignment,
+									 const AllocatorConfig& config) noexcept {
+	memory::Arena::Options options;
+	options.initial_bytes = capacity;
+	options.base_alignment = base_alignment;
+	options.pages = config.pages;
+	return options;
 }
 
 } // namespace
 
 // ==================== SystemAllocator ====================
 
-struct SystemAllocator::TrackingState {
-	mutable std::mutex mu;
-	std::unordered_map<const void*, std::size_t> live_sizes;
-	AllocationStats stats;
-};
+struct SystemAllocator::TrackingState : detail::AllocationTracker {};
 
 SystemAllocator::~SystemAllocator() noexcept = default;
 
@@ -89,13 +99,7 @@ void* SystemAllocator::allocate_aligned(std::size_t size_bytes, std::size_t alig
 	}
 
 	if (track_allocations_ && tracking_) {
-		std::lock_guard<std::mutex> lock(tracking_->mu);
-		tracking_->live_sizes[ptr] = size_bytes;
-		tracking_->stats.allocations += 1;
-		tracking_->stats.bytes_allocated += size_bytes;
-		tracking_->stats.live_allocations += 1;
-		tracking_->stats.live_bytes += size_bytes;
-		update_peak(tracking_->stats);
+		tracking_->on_allocate(ptr, size_bytes);
 	}
 
 	return ptr;
@@ -107,26 +111,8 @@ void SystemAllocator::deallocate(void* ptr) noexcept {
 	}
 
 	if (track_allocations_ && tracking_) {
-		std::lock_guard<std::mutex> lock(tracking_->mu);
-		const auto it = tracking_->live_sizes.find(ptr);
-		if (it != tracking_->live_sizes.end()) {
-			const std::size_t size = it->second;
-			tracking_->live_sizes.erase(it);
-
-			tracking_->stats.frees += 1;
-			tracking_->stats.bytes_freed += size;
-			if (tracking_->stats.live_allocations > 0) {
-				tracking_->stats.live_allocations -= 1;
-			}
-			if (tracking_->stats.live_bytes >= size) {
-				tracking_->stats.live_bytes -= size;
-			} else {
-				tracking_->stats.live_bytes = 0;
-			}
-		} else {
-			// Unknown pointer: still free it, but don't try to account bytes.
-			tracking_->stats.frees += 1;
-		}
+		// Unknown pointers are still freed, but their bytes are not accounted.
+		tracking_->on_free(ptr);
 	}
 
 	free_aligned_system(ptr);
@@ -141,11 +127,7 @@ void* SystemAllocator::reallocate(void* ptr, int64_t new_size_bytes) {
 	// If we can't determine old size, we can't safely preserve content.
 	std::size_t old_size = 0;
 	if (ptr && track_allocations_ && tracking_) {
-		std::lock_guard<std::mutex> lock(tracking_->mu);
-		const auto it = tracking_->live_sizes.find(ptr);
-		if (it != tracking_->live_sizes.end()) {
-			old_size = it->second;
-		}
+		old_size = tracking_->size_of(ptr);
 	}
 
 	void* new_ptr = allocate(static_cast<int64_t>(new_size_bytes));
@@ -167,8 +149,7 @@ bool SystemAllocator::owns(const void* ptr) const noexcept {
 		return false;
 	}
 	if (track_allocations_ && tracking_) {
-		std::lock_guard<std::mutex> lock(tracking_->mu);
-		return tracking_->live_sizes.find(ptr) != tracking_->live_sizes.end();
+		return tracking_->is_live(ptr);
 	}
 	return true;
 }
@@ -177,32 +158,36 @@ AllocationStats SystemAllocator::stats() const noexcept {
 	if (!track_allocations_ || !tracking_) {
 		return {};
 	}
-	std::lock_guard<std::mutex> lock(tracking_->mu);
-	return tracking_->stats;
+	return tracking_->snapshot();
 }
 
 void SystemAllocator::reset_stats() noexcept {
 	if (!track_allocations_ || !tracking_) {
 		return;
 	}
-	std::lock_guard<std::mutex> lock(tracking_->mu);
-	tracking_->stats = {};
+	tracking_->reset_stats();
 }
 
 // ==================== ArenaAllocator ====================
 
-struct ArenaAllocator::TrackingState {
-	mutable std::mutex mu;
-	std::unordered_map<const void*, std::size_t> live_sizes;
-	AllocationStats stats;
-};
+struct ArenaAllocator::TrackingState : detail::AllocationTracker {};
 
 ArenaAllocator::~ArenaAllocator() noexcept = default;
 
 ArenaAllocator::ArenaAllocator(std::size_t arena_capacity_bytes,
 							   std::size_t arena_base_alignment,
 							   AllocatorConfig config) noexcept
-	: arena_(arena_capacity_bytes, arena_base_alignment),
+	: arena_(arena_options(arena_capacity_bytes, arena_base_alignment, config)),
+	  alignment_(normalize_alignment(config.alignment)),
+	  track_allocations_(config.track_allocations) {
+	if (track_allocations_) {
+		tracking_ = std::make_unique<TrackingState>();
+	}
+}
+
+ArenaAllocator::ArenaAllocator(const memory::Arena::Options& arena_options,
+							   AllocatorConfig config) noexcept
+	: arena_(with_pages(arena_options, config)),
 	  alignment_(normalize_alignment(config.alignment)),
 	  track_allocations_(config.track_allocations) {
 	if (track_allocations_) {
@@ -228,13 +213,7 @@ void* ArenaAllocator::allocate_aligned(std::size_t size_bytes, std::size_t align
 	}
 
 	if (track_allocations_ && tracking_) {
-		std::lock_guard<std::mutex> lock(tracking_->mu);
-		tracking_->live_sizes[ptr] = size_bytes;
-		tracking_->stats.allocations += 1;
-		tracking_->stats.bytes_allocated += size_bytes;
-		tracking_->stats.live_allocations += 1;
-		tracking_->stats.live_bytes += size_bytes;
-		update_peak(tracking_->stats);
+		tracking_->on_allocate(ptr, size_bytes);
 	}
 
 	return ptr;
@@ -247,25 +226,7 @@ void ArenaAllocator::deallocate(void* ptr) noexcept {
 	}
 
 	if (track_allocations_ && tracking_) {
-		std::lock_guard<std::mutex> lock(tracking_->mu);
-		const auto it = tracking_->live_sizes.find(ptr);
-		if (it != tracking_->live_sizes.end()) {
-			const std::size_t size = it->second;
-			tracking_->live_sizes.erase(it);
-
-			tracking_->stats.frees += 1;
-			tracking_->stats.bytes_freed += size;
-			if (tracking_->stats.live_allocations > 0) {
-				tracking_->stats.live_allocations -= 1;
-			}
-			if (tracking_->stats.live_bytes >= size) {
-				tracking_->stats.live_bytes -= size;
-			} else {
-				tracking_->stats.live_bytes = 0;
-			}
-		} else {
-			tracking_->stats.frees += 1;
-		}
+		tracking_->on_free(ptr);
 	}
 }
 
@@ -274,8 +235,7 @@ bool ArenaAllocator::owns(const void* ptr) const noexcept {
 		return false;
 	}
 	if (track_allocations_ && tracking_) {
-		std::lock_guard<std::mutex> lock(tracking_->mu);
-		return tracking_->live_sizes.find(ptr) != tracking_->live_sizes.end();
+		return tracking_->is_live(ptr);
 	}
 	return arena_.owns(ptr);
 }
@@ -283,10 +243,7 @@ bool ArenaAllocator::owns(const void* ptr) const noexcept {
 void ArenaAllocator::reset() noexcept {
 	arena_.reset();
 	if (track_allocations_ && tracking_) {
-		std::lock_guard<std::mutex> lock(tracking_->mu);
-		tracking_->live_sizes.clear();
-		tracking_->stats.live_allocations = 0;
-		tracking_->stats.live_bytes = 0;
+		tracking_->clear_live();
 	}
 }
 
@@ -294,16 +251,130 @@ AllocationStats ArenaAllocator::stats() const noexcept {
 	if (!track_allocations_ || !tracking_) {
 		return {};
 	}
-	std::lock_guard<std::mutex> lock(tracking_->mu);
-	return tracking_->stats;
+	return tracking_->snapshot();
 }
 
 void ArenaAllocator::reset_stats() noexcept {
 	if (!track_allocations_ || !tracking_) {
 		return;
 	}
-	std::lock_guard<std::mutex> lock(tracking_->mu);
-	tracking_->stats = {};
+	tracking_->reset_stats();
+}
+
+// ==================== PageAllocator ====================
+
+struct PageAllocator::State {
+	mutable std::mutex mu;
+	std::unordered_map<const void*, memory::PageRegion> regions;
+	detail::AllocationTracker tracker;
+};
+
+PageAllocator::PageAllocator(AllocatorConfig config)
+	: pages_(config.pages),
+	  alignment_(config.pages.huge_pages != memory::HugePages::None ? memory::huge_page_size()
+																	 : memory::page_size()),
+	  track_allocations_(config.track_allocations),
+	  state_(std::make_unique<State>()) {}
+
+PageAllocator::~PageAllocator() noexcept {
+	for (const auto& entry : state_->regions) {
+		memory::unmap_pages(entry.second);
+	}
+}
+
+void* PageAllocator::allocate(int64_t size_bytes) {
+	if (size_bytes <= 0) {
+		return nullptr;
+	}
+	return allocate_aligned(static_cast<std::size_t>(size_bytes), 0);
+}
+
+void* PageAllocator::allocate_aligned(std::size_t size_bytes, std::size_t alignment_bytes) {
+	if (size_bytes == 0 || alignment_bytes > alignment_) {
+		return nullptr;
+	}
+	const memory::PageRegion region = memory::map_pages(size_bytes, pages_);
+	if (!region.data) {
+		return nullptr;
+	}
+	try {
+		std::lock_guard<std::mutex> lock(state_->mu);
+		state_->regions.emplace(region.data, region);
+	} catch (...) {
+		memory::unmap_pages(region);
+		throw;
+	}
+	if (track_allocations_) {
+		state_->tracker.on_allocate(region.data, size_bytes);
+	}
+	return region.data;
+}
+
+void PageAllocator::deallocate(void* ptr) noexcept {
+	if (!ptr) {
+		return;
+	}
+	if (track_allocations_) {
+		state_->tracker.on_free(ptr);
+	}
+	memory::PageRegion region;
+	{
+		std::lock_guard<std::mutex> lock(state_->mu);
+		const auto it = state_->regions.find(ptr);
+		if (it == state_->regions.end()) {
+			return; // not ours
+		}
+		region = it->second;
+		state_->regions.erase(it);
+	}
+	memory::unmap_pages(region);
+}
+
+void* PageAllocator::reallocate(void* ptr, int64_t new_size_bytes) {
+	if (new_size_bytes <= 0) {
+		deallocate(ptr);
+		return nullptr;
+	}
+	const memory::PageRegion old = region(ptr);
+	const auto new_size = static_cast<std::size_t>(new_size_bytes);
+	if (old.data && new_size <= old.bytes && !track_allocations_) {
+		return ptr; // still fits the mapped pages
+	}
+	void* new_ptr = allocate(new_size_bytes);
+	if (!new_ptr) {
+		return nullptr;
+	}
+	if (old.data) {
+		std::memcpy(new_ptr, ptr, std::min(old.bytes, new_size));
+	}
+	deallocate(ptr);
+	return new_ptr;
+}
+
+bool PageAllocator::owns(const void* ptr) const noexcept {
+	return region(ptr).data != nullptr;
+}
+
+memory::PageRegion PageAllocator::region(const void* ptr) const noexcept {
+	if (!ptr) {
+		return {};
+	}
+	std::lock_guard<std::mutex> lock(state_->mu);
+	const auto it = state_->regions.find(ptr);
+	return it != state_->regions.end() ? it->second : memory::PageRegion{};
+}
+
+AllocationStats PageAllocator::stats() const noexcept {
+	if (!track_allocations_) {
+		return {};
+	}
+	return state_->tracker.snapshot();
+}
+
+void PageAllocator::reset_stats() noexcept {
+	if (track_allocations_) {
+		state_->tracker.reset_stats();
+	}
 }
 
 // ==================== Factories ====================
@@ -318,6 +389,10 @@ std::unique_ptr<Allocator> make_arena_allocator(std::size_t arena_capacity_bytes
 	return std::make_unique<ArenaAllocator>(arena_capacity_bytes, arena_base_alignment, config);
 }
 
+std::unique_ptr<Allocator> make_page_allocator(AllocatorConfig config) {
+	return std::make_unique<PageAllocator>(config);
+}
+
 } // namespace core
 } // namespace inference_engine
 
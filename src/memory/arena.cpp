@@ -3,12 +3,18 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <limits>
 
 namespace inference_engine {
 namespace memory {
 
 namespace {
 
+// Smallest chunk a growable arena adds, so tiny requests do not chain tiny chunks.
+constexpr std::size_t kMinChunkBytes = 4096;
+// First chunk of each thread's scratch arena.
+constexpr std::size_t kScratchInitialBytes = 64 * 1024;
+
 inline void* allocate_aligned(std::size_t size, std::size_t alignment) noexcept {
 #if defined(_MSC_VER)
     return _aligned_malloc(size, alignment);
@@ -40,39 +46,77 @@ std::size_t Arena::align_up(std::size_t value, std::size_t alignment) noexcept {
 }
 
 Arena::Arena(std::size_t capacity_bytes, std::size_t base_alignment) noexcept
-    : capacity_bytes_(capacity_bytes), base_alignment_(base_alignment) {
-    if (base_alignment_ == 0) {
-        base_alignment_ = alignof(std::max_align_t);
+    : Arena([&] {
+          Options options;
+          options.initial_bytes = capacity_bytes;
+          options.base_alignment = base_alignment;
+          return options;
+      }()) {}
+
+Arena::Arena(const Options& options) noexcept : options_(options) {
+    if (options_.base_alignment == 0) {
+        options_.base_alignment = alignof(std::max_align_t);
     }
     // posix_memalign requires power-of-two and multiple of sizeof(void*)
-    if (!is_power_of_two(base_alignment_) || base_alignment_ < sizeof(void*)) {
-        base_alignment_ = alignof(std::max_align_t);
+    if (!is_power_of_two(options_.base_alignment) || options_.base_alignment < sizeof(void*)) {
+        options_.base_alignment = alignof(std::max_align_t);
+    }
+    if (options_.growth_factor == 0) {
+        options_.growth_factor = 1;
     }
 
-    if (capacity_bytes_ == 0) {
-        base_ = nullptr;
+    if (options_.initial_bytes == 0) {
         return;
     }
+    add_chunk(options_.initial_bytes);
+}
 
-    base_ = allocate_aligned(capacity_bytes_, base_alignment_);
-    if (!base_) {
-        capacity_bytes_ = 0;
-        used_bytes_ = 0;
-        stats_ = {};
+bool Arena::add_chunk(std::size_t bytes) noexcept {
+    Chunk chunk;
+    chunk.capacity = bytes;
+    if (!options_.pages.is_default() && options_.base_alignment <= page_size()) {
+        chunk.region = map_pages(bytes, options_.pages);
+        chunk.base = chunk.region.data;
+    } else {
+        chunk.base = allocate_aligned(bytes, options_.base_alignment);
     }
+    if (!chunk.base) {
+        return false;
+    }
+    try {
+        chunks_.push_back(chunk);
+    } catch (...) {
+        release_chunk(chunk);
+        return false;
+    }
+    capacity_bytes_ += bytes;
+    return true;
 }
 
-Arena::Arena(Arena&& other) noexcept {
-    base_ = other.base_;
-    capacity_bytes_ = other.capacity_bytes_;
-    used_bytes_ = other.used_bytes_;
-    base_alignment_ = other.base_alignment_;
-    stats_ = other.stats_;
+Arena Arena::growable(std::size_t initial_bytes, std::size_t base_alignment) noexcept {
+    Options options;
+    options.initial_bytes = initial_bytes;
+    options.base_alignment = base_alignment;
+    options.growable = true;
+    return Arena(options);
+}
 
-    other.base_ = nullptr;
-    other.capacity_bytes_ = 0;
+Arena::Arena(Arena&& other) noexcept
+    : options_(other.options_),
+      chunks_(std::move(other.chunks_)),
+      current_(other.current_),
+      used_bytes_(other.used_bytes_),
+      capacity_bytes_(other.capacity_bytes_),
+      allocations_(other.allocations_),
+      peak_used_bytes_(other.peak_used_bytes_),
+      growths_(other.growths_) {
+    other.chunks_.clear();
+    other.current_ = 0;
     other.used_bytes_ = 0;
-    other.stats_ = {};
+    other.capacity_bytes_ = 0;
+    other.allocations_ = 0;
+    other.peak_used_bytes_ = 0;
+    other.growths_ = 0;
 }
 
 Arena& Arena::operator=(Arena&& other) noexcept {
@@ -80,75 +124,204 @@ Arena& Arena::operator=(Arena&& other) noexcept {
         return *this;
     }
 
-    if (base_) {
-        free_aligned(base_);
-    }
+    release();
 
-    base_ = other.base_;
-    capacity_bytes_ = other.capacity_bytes_;
+    options_ = other.options_;
+    chunks_ = std::move(other.chunks_);
+    current_ = other.current_;
     used_bytes_ = other.used_bytes_;
-    base_alignment_ = other.base_alignment_;
-    stats_ = other.stats_;
+    capacity_bytes_ = other.capacity_bytes_;
+    allocations_ = other.allocations_;
+    peak_used_bytes_ = other.peak_used_bytes_;
+    growths_ = other.growths_;
 
-    other.base_ = nullptr;
-    other.capacity_bytes_ = 0;
+    other.chunks_.clear();
+    other.current_ = 0;
     other.used_bytes_ = 0;
-    other.stats_ = {};
+    other.capacity_bytes_ = 0;
+    other.allocations_ = 0;
+    other.peak_used_bytes_ = 0;
+    other.growths_ = 0;
 
     return *this;
 }
 
 Arena::~Arena() noexcept {
-    if (base_) {
-        free_aligned(base_);
-        base_ = nullptr;
-    }
+    release();
 }
 
-void* Arena::allocate(std::size_t size_bytes, std::size_t alignment) noexcept {
-    if (!base_ || capacity_bytes_ == 0) {
-        return nullptr;
+void Arena::release_chunk(const Chunk& chunk) noexcept {
+    if (chunk.region.data) {
+        unmap_pages(chunk.region);
+    } else {
+        free_aligned(chunk.base);
     }
+}
 
-    if (alignment == 0) {
-        alignment = alignof(std::max_align_t);
-    }
-    if (!is_power_of_two(alignment)) {
-        return nullptr;
+void Arena::release() noexcept {
+    for (const Chunk& chunk : chunks_) {
+        release_chunk(chunk);
     }
+    chunks_.clear();
+}
 
-    const auto base_addr = reinterpret_cast<std::uintptr_t>(base_);
-    const auto current_addr = base_addr + used_bytes_;
+void* Arena::try_allocate(Chunk& chunk, std::size_t size_bytes, std::size_t alignment) noexcept {
+    const auto base_addr = reinterpret_cast<std::uintptr_t>(chunk.base);
+    const auto current_addr = base_addr + chunk.used;
     const auto aligned_addr = static_cast<std::uintptr_t>(align_up(static_cast<std::size_t>(current_addr), alignment));
 
     const std::size_t aligned_offset = static_cast<std::size_t>(aligned_addr - base_addr);
-    if (aligned_offset > capacity_bytes_) {
+    if (aligned_offset > chunk.capacity) {
         return nullptr;
     }
 
     // Avoid overflow
-    if (size_bytes > capacity_bytes_ - aligned_offset) {
+    if (size_bytes > chunk.capacity - aligned_offset) {
         return nullptr;
     }
 
-    used_bytes_ = aligned_offset + size_bytes;
-    stats_.allocations += 1;
-    stats_.peak_used_bytes = std::max(stats_.peak_used_bytes, used_bytes_);
+    used_bytes_ += aligned_offset + size_bytes - chunk.used;
+    chunk.used = aligned_offset + size_bytes;
+    chunk.allocations += 1;
+    chunk.peak_used = std::max(chunk.peak_used, chunk.used);
+    allocations_ += 1;
+    peak_used_bytes_ = std::max(peak_used_bytes_, used_bytes_);
     return reinterpret_cast<void*>(aligned_addr);
 }
 
+bool Arena::grow(std::size_t size_bytes, std::size_t alignment) noexcept {
+    // Room for the request even when it needs more alignment than the chunk base.
+    const std::size_t padding = alignment > options_.base_alignment ? alignment : 0;
+    if (size_bytes > std::numeric_limits<std::size_t>::max() - padding) {
+        return false;
+    }
+    const std::size_t needed = size_bytes + padding;
+
+    std::size_t bytes = chunks_.empty() ? options_.initial_bytes : chunks_.back().capacity;
+    if (bytes > std::numeric_limits<std::size_t>::max() / options_.growth_factor) {
+        bytes = std::numeric_limits<std::size_t>::max();
+    } else if (!chunks_.empty()) {
+        bytes *= options_.growth_factor;
+    }
+    if (options_.max_chunk_bytes != 0) {
+        bytes = std::min(bytes, options_.max_chunk_bytes);
+    }
+    bytes = std::max({bytes, needed, kMinChunkBytes});
+    if (options_.max_total_bytes != 0) {
+        if (capacity_bytes_ >= options_.max_total_bytes ||
+            needed > options_.max_total_bytes - capacity_bytes_) {
+            return false;
+        }
+        bytes = std::min(bytes, options_.max_total_bytes - capacity_bytes_);
+    }
+
+    if (!add_chunk(bytes)) {
+        return false;
+    }
+    growths_ += 1;
+    return true;
+}
+
+void* Arena::allocate(std::size_t size_bytes, std::size_t alignment) noexcept {
+    if (alignment == 0) {
+        alignment = alignof(std::max_align_t);
+    }
+    if (!is_power_of_two(alignment)) {
+        return nullptr;
+    }
+
+    if (!chunks_.empty()) {
+        if (void* ptr = try_allocate(chunks_[current_], size_bytes, alignment)) {
+            return ptr;
+        }
+        // Chunks after the current one are empty: retained from an earlier cycle.
+        for (std::size_t i = current_ + 1; i < chunks_.size(); ++i) {
+            if (void* ptr = try_allocate(chunks_[i], size_bytes, alignment)) {
+                current_ = i;
+                return ptr;
+            }
+        }
+    }
+
+    if (!options_.growable || !grow(size_bytes, alignment)) {
+        return nullptr;
+    }
+    void* ptr = try_allocate(chunks_.back(), size_bytes, alignment);
+    if (ptr) {
+        current_ = chunks_.size() - 1;
+    }
+    return ptr;
+}
+
 void Arena::reset() noexcept {
+    for (Chunk& chunk : chunks_) {
+        chunk.used = 0;
+        chunk.peak_used = 0;
+        chunk.allocations = 0;
+    }
+    current_ = 0;
     used_bytes_ = 0;
-    stats_ = {};
+    allocations_ = 0;
+    peak_used_bytes_ = 0;
+}
+
+void Arena::rewind(const Marker& marker) noexcept {
+    if (chunks_.empty() || marker.chunk > current_) {
+        return;
+    }
+    for (std::size_t i = marker.chunk + 1; i <= current_; ++i) {
+        used_bytes_ -= chunks_[i].used;
+        chunks_[i].used = 0;
+    }
+    Chunk& chunk = chunks_[marker.chunk];
+    if (marker.offset < chunk.used) {
+        used_bytes_ -= chunk.used - marker.offset;
+        chunk.used = marker.offset;
+    }
+    current_ = marker.chunk;
+}
+
+std::size_t Arena::remaining() const noexcept {
+    if (chunks_.empty()) {
+        return 0;
+    }
+    std::size_t bytes = chunks_[current_].capacity - chunks_[current_].used;
+    for (std::size_t i = current_ + 1; i < chunks_.size(); ++i) {
+        bytes += chunks_[i].capacity;
+    }
+    return bytes;
+}
+
+Arena::Stats Arena::stats() const {
+    Stats stats;
+    stats.allocations = allocations_;
+    stats.peak_used_bytes = peak_used_bytes_;
+    stats.growths = growths_;
+    stats.chunks.reserve(chunks_.size());
+    for (const Chunk& chunk : chunks_) {
+        stats.chunks.push_back(ChunkStats{chunk.capacity, chunk.used, chunk.peak_used, chunk.allocations,
+                                          chunk.region.huge_pages, chunk.region.numa_node});
+    }
+    return stats;
 }
 
 bool Arena::owns(const void* ptr) const noexcept {
-    if (!base_ || !ptr || capacity_bytes_ == 0) {
+    if (!ptr) {
         return false;
     }
-    const auto base_addr = reinterpret_cast<std::uintptr_t>(base_);
     const auto ptr_addr = reinterpret_cast<std::uintptr_t>(ptr);
-    return ptr_addr >= base_addr && ptr_addr < (base_addr + capacity_bytes_);
+    for (const Chunk& chunk : chunks_) {
+        const auto base_addr = reinterpret_cast<std::uintptr_t>(chunk.base);
+        if (ptr_addr >= base_addr && ptr_addr < base_addr + chunk.capacity) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Arena& thread_scratch_arena() noexcept {
+    thread_local Arena arena = Arena::growable(kScratchInitialBytes, 64);
+    return arena;
 }
 
 } // namespace memory
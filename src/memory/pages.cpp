@@ -0,0 +1,269 @@
+#include "inference_engine/memory/pages.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace inference_engine {
+namespace memory {
+
+namespace {
+
+constexpr std::size_t kDefaultHugePageSize = std::size_t{2} << 20;
+
+std::size_t round_up(std::size_t value, std::size_t multiple) noexcept {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+#if defined(__linux__)
+
+constexpr int kMpolBind = 2; // MPOL_BIND from <linux/mempolicy.h>
+
+// Binds [data, data + bytes) to `node`; false when the kernel refuses.
+bool bind_to_node(void* data, std::size_t bytes, int node) noexcept {
+#if defined(SYS_mbind)
+    constexpr std::size_t kBitsPerWord = sizeof(unsigned long) * 8;
+    unsigned long mask[4] = {};
+    if (node < 0 || static_cast<std::size_t>(node) >= sizeof(mask) * 8) {
+        return false;
+    }
+    mask[static_cast<std::size_t>(node) / kBitsPerWord] |= 1ul << (static_cast<std::size_t>(node) % kBitsPerWord);
+    return syscall(SYS_mbind, data, bytes, kMpolBind, mask, sizeof(mask) * 8, 0) == 0;
+#else
+    (void)data;
+    (void)bytes;
+    (void)node;
+    return false;
+#endif
+}
+
+void* map_anonymous(std::size_t bytes, int extra_flags) noexcept {
+    void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | extra_flags, -1, 0);
+    return p == MAP_FAILED ? nullptr : p;
+}
+
+// Anonymous mapping of `bytes` aligned to `alignment` (over-map, then trim).
+void* map_aligned(std::size_t bytes, std::size_t alignment) noexcept {
+    auto* raw = static_cast<std::uint8_t*>(map_anonymous(bytes + alignment, 0));
+    if (!raw) {
+        return nullptr;
+    }
+    const auto addr = reinterpret_cast<std::uintptr_t>(raw);
+    const std::uintptr_t aligned = (addr + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    const std::size_t head = static_cast<std::size_t>(aligned - addr);
+    if (head != 0) {
+        ::munmap(raw, head);
+    }
+    const std::size_t tail = alignment - head;
+    if (tail != 0) {
+        ::munmap(reinterpret_cast<std::uint8_t*>(aligned) + bytes, tail);
+    }
+    return reinterpret_cast<void*>(aligned);
+}
+
+#endif
+
+} // namespace
+
+std::size_t page_size() noexcept {
+#if defined(__linux__)
+    static const std::size_t size = [] {
+        const long s = ::sysconf(_SC_PAGESIZE);
+        return s > 0 ? static_cast<std::size_t>(s) : std::size_t{4096};
+    }();
+    return size;
+#else
+    return 4096;
+#endif
+}
+
+std::size_t huge_page_size() noexcept {
+    static const std::size_t size = [] {
+        std::ifstream meminfo("/proc/meminfo");
+        std::string key;
+        while (meminfo >> key) {
+            if (key == "Hugepagesize:") {
+                std::size_t kib = 0;
+                if (meminfo >> kib && kib != 0) {
+                    return kib * 1024;
+                }
+                break;
+            }
+            meminfo.ignore(256, '\n');
+        }
+        return kDefaultHugePageSize;
+    }();
+    return size;
+}
+
+PageRegion map_pages(std::size_t bytes, const PageOptions& options) noexcept {
+    PageRegion region;
+    if (bytes == 0) {
+        return region;
+    }
+#if defined(__linux__)
+    const std::size_t huge = huge_page_size();
+    if (options.huge_pages == HugePages::Explicit) {
+        const std::size_t rounded = round_up(bytes, huge);
+        if (void* p = map_anonymous(rounded, MAP_HUGETLB)) {
+            region.data = p;
+            region.bytes = rounded;
+            region.huge_pages = true;
+        }
+    }
+    if (!region.data && options.huge_pages != HugePages::None) {
+        // Transparent huge pages need huge-page-aligned extents.
+        const std::size_t rounded = round_up(bytes, huge);
+        if (void* p = map_aligned(rounded, huge)) {
+            region.data = p;
+            region.bytes = rounded;
+            region.huge_pages = ::madvise(p, rounded, MADV_HUGEPAGE) == 0;
+        }
+    }
+    if (!region.data) {
+        const std::size_t rounded = round_up(bytes, page_size());
+        region.data = map_anonymous(rounded, 0);
+        if (!region.data) {
+            return PageRegion{};
+        }
+        region.bytes = rounded;
+    }
+    region.mapped = true;
+
+    const int node = options.numa_node == kLocalNumaNode ? current_numa_node() : options.numa_node;
+    if (node >= 0 && bind_to_node(region.data, region.bytes, node)) {
+        region.numa_node = node;
+    }
+#else
+    const std::size_t rounded = round_up(bytes, page_size());
+    void* p = nullptr;
+#if defined(_MSC_VER)
+    p = _aligned_malloc(rounded, page_size());
+#else
+    if (posix_memalign(&p, page_size(), rounded) != 0) {
+        p = nullptr;
+    }
+#endif
+    if (!p) {
+        return region;
+    }
+    std::memset(p, 0, rounded);
+    region.data = p;
+    region.bytes = rounded;
+#endif
+    if (options.prefault) {
+        prefault_pages(region.data, region.bytes, true);
+    }
+    return region;
+}
+
+void unmap_pages(const PageRegion& region) noexcept {
+    if (!region.data) {
+        return;
+    }
+#if defined(__linux__)
+    if (region.mapped) {
+        ::munmap(region.data, region.bytes);
+        return;
+    }
+#endif
+#if defined(_MSC_VER)
+    _aligned_free(region.data);
+#else
+    std::free(region.data);
+#endif
+}
+
+void prefault_pages(const void* data, std::size_t bytes, bool writable) noexcept {
+    if (!data || bytes == 0) {
+        return;
+    }
+    const std::size_t step = page_size();
+    if (writable) {
+        auto* p = static_cast<volatile std::uint8_t*>(const_cast<void*>(data));
+        for (std::size_t off = 0; off < bytes; off += step) {
+            p[off] = p[off];
+        }
+    } else {
+#if defined(__linux__)
+        const auto addr = reinterpret_cast<std::uintptr_t>(data) & ~(static_cast<std::uintptr_t>(step) - 1);
+        ::madvise(reinterpret_cast<void*>(addr), bytes + (reinterpret_cast<std::uintptr_t>(data) - addr),
+                  MADV_WILLNEED);
+#endif
+        const auto* p = static_cast<const volatile std::uint8_t*>(data);
+        std::uint8_t sink = 0;
+        for (std::size_t off = 0; off < bytes; off += step) {
+            sink ^= p[off];
+        }
+        (void)sink;
+    }
+}
+
+int numa_node_count() noexcept {
+#if defined(__linux__)
+    static const int count = [] {
+        int nodes = 0;
+        if (DIR* dir = ::opendir("/sys/devices/system/node")) {
+            while (const dirent* entry = ::readdir(dir)) {
+                if (std::strncmp(entry->d_name, "node", 4) == 0 && entry->d_name[4] >= '0' &&
+                    entry->d_name[4] <= '9') {
+                    ++nodes;
+                }
+            }
+            ::closedir(dir);
+        }
+        return nodes > 0 ? nodes : 1;
+    }();
+    return count;
+#else
+    return 1;
+#endif
+}
+
+int current_numa_node() noexcept {
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+        return static_cast<int>(node);
+    }
+#endif
+    return 0;
+}
+
+std::vector<int> numa_node_cpus(int node) {
+    std::vector<int> cpus;
+    if (node < 0) {
+        return cpus;
+    }
+    std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string list;
+    if (!std::getline(file, list)) {
+        return cpus;
+    }
+    // Format: comma-separated CPUs and inclusive ranges, e.g. "0-3,8-11".
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.empty()) continue;
+        const std::size_t dash = item.find('-');
+        const int first = std::atoi(item.c_str());
+        const int last = dash == std::string::npos ? first : std::atoi(item.c_str() + dash + 1);
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+} // namespace memory
+} // namespace inference_engine
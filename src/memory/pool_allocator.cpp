@@ -0,0 +1,491 @@
+#include "inference_engine/memory/pool_allocator.h"
+
+#include "allocation_tracker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace inference_engine {
+namespace core {
+
+namespace {
+
+constexpr std::size_t kHeaderBytes = PoolAllocator::kAlignment;
+constexpr std::uint32_t kBlockMagic = 0x504f4f4cu; // "POOL"
+constexpr std::uint32_t kDirectClass = 0xffffffffu;
+constexpr std::size_t kMaxTransferBlocks = 32;
+
+// Lives in the kHeaderBytes in front of every block. Written once when the block is
+// carved (or directly allocated) and never touched by the user.
+struct BlockHeader {
+	std::uint32_t magic;
+	std::uint32_t size_class; // kDirectClass for system allocations
+	std::size_t capacity;     // usable bytes
+	void* base;               // system pointer of a direct allocation
+};
+static_assert(sizeof(BlockHeader) <= kHeaderBytes, "block header must fit the alignment gap");
+
+// Free blocks are chained through their first bytes.
+struct FreeNode {
+	FreeNode* next;
+};
+
+struct FreeList {
+	FreeNode* head = nullptr;
+	std::size_t count = 0;
+
+	void push(FreeNode* node) noexcept {
+		node->next = head;
+		head = node;
+		++count;
+	}
+
+	FreeNode* pop() noexcept {
+		FreeNode* node = head;
+		head = node->next;
+		--count;
+		return node;
+	}
+};
+
+inline void* allocate_aligned_system(std::size_t size, std::size_t alignment) noexcept {
+#if defined(_MSC_VER)
+	return _aligned_malloc(size, alignment);
+#else
+	void* ptr = nullptr;
+	if (posix_memalign(&ptr, alignment, size) != 0) {
+		return nullptr;
+	}
+	return ptr;
+#endif
+}
+
+inline void free_aligned_system(void* ptr) noexcept {
+#if defined(_MSC_VER)
+	_aligned_free(ptr);
+#else
+	std::free(ptr);
+#endif
+}
+
+inline BlockHeader* header_of(const void* ptr) noexcept {
+	return reinterpret_cast<BlockHeader*>(const_cast<std::uint8_t*>(static_cast<const std::uint8_t*>(ptr)) -
+										  kHeaderBytes);
+}
+
+std::atomic<std::uint64_t> next_depot_id{1};
+
+} // namespace
+
+// ==================== Depot ====================
+
+struct PoolAllocator::Depot {
+	explicit Depot(const PoolConfig& pool);
+	~Depot();
+
+	// Fills `list` with up to one transfer of blocks of `cls`; false when the
+	// system is out of memory and nothing could be moved.
+	bool fetch(std::size_t cls, FreeList& list);
+	// Moves one transfer of blocks from `list` back to the depot.
+	void give_back(std::size_t cls, FreeList& list) noexcept;
+	// Returns every block in `list`.
+	void give_back_all(std::size_t cls, FreeList& list) noexcept;
+
+	[[nodiscard]] std::size_t class_of(std::size_t size) const noexcept;
+	[[nodiscard]] bool in_slab(const void* ptr) const noexcept;
+
+	void* allocate_direct(std::size_t size, std::size_t alignment);
+	void free_direct(void* ptr, BlockHeader* header) noexcept;
+	[[nodiscard]] bool is_direct(const void* ptr) const noexcept;
+
+	struct alignas(64) ClassDepot {
+		std::mutex mu;
+		FreeList free;
+	};
+
+	const std::uint64_t id;
+	PoolConfig config;
+	std::vector<std::size_t> class_sizes;
+	std::vector<std::size_t> transfer_blocks;
+	std::unique_ptr<ClassDepot[]> classes;
+
+	mutable std::mutex slab_mu;
+	std::vector<std::pair<std::uintptr_t, std::size_t>> slabs; // sorted by address
+
+	mutable std::mutex direct_mu;
+	std::unordered_set<const void*> direct;
+
+	std::atomic<std::size_t> depot_fetches{0};
+	std::atomic<std::size_t> depot_returns{0};
+	std::atomic<std::size_t> slab_bytes{0};
+	std::atomic<std::size_t> direct_allocations{0};
+
+private:
+	bool carve(std::size_t cls); // requires classes[cls].mu
+};
+
+PoolAllocator::Depot::Depot(const PoolConfig& pool) : id(next_depot_id.fetch_add(1)), config(pool) {
+	config.max_pooled_bytes = std::max(config.max_pooled_bytes, kAlignment);
+	// 64-byte steps up to 1 KiB, then four classes per power of two.
+	for (std::size_t size = kAlignment; size <= 1024 && size <= config.max_pooled_bytes + kAlignment - 1;
+		 size += kAlignment) {
+		class_sizes.push_back(size);
+	}
+	for (std::size_t p = 1024; class_sizes.back() < config.max_pooled_bytes; p *= 2) {
+		for (std::size_t step = 1; step <= 4 && class_sizes.back() < config.max_pooled_bytes; ++step) {
+			class_sizes.push_back(p + step * (p / 4));
+		}
+	}
+	transfer_blocks.reserve(class_sizes.size());
+	for (std::size_t size : class_sizes) {
+		transfer_blocks.push_back(std::clamp<std::size_t>(config.transfer_bytes / size, 2, kMaxTransferBlocks));
+	}
+	classes = std::make_unique<ClassDepot[]>(class_sizes.size());
+}
+
+PoolAllocator::Depot::~Depot() {
+	for (const auto& slab : slabs) {
+		free_aligned_system(reinterpret_cast<void*>(slab.first));
+	}
+	// Direct blocks the user never freed.
+	for (const void* ptr : direct) {
+		free_aligned_system(header_of(ptr)->base);
+	}
+}
+
+std::size_t PoolAllocator::Depot::class_of(std::size_t size) const noexcept {
+	if (size <= 1024) {
+		return (size - 1) / kAlignment;
+	}
+	return static_cast<std::size_t>(std::lower_bound(class_sizes.begin(), class_sizes.end(), size) -
+									class_sizes.begin());
+}
+
+bool PoolAllocator::Depot::carve(std::size_t cls) {
+	const std::size_t stride = kHeaderBytes + class_sizes[cls];
+	const std::size_t bytes = std::max(config.slab_bytes, stride * transfer_blocks[cls]);
+	const std::size_t blocks = bytes / stride;
+	auto* slab = static_cast<std::uint8_t*>(allocate_aligned_system(blocks * stride, kAlignment));
+	if (!slab) {
+		return false;
+	}
+	{
+		std::lock_guard<std::mutex> lock(slab_mu);
+		const auto entry = std::make_pair(reinterpret_cast<std::uintptr_t>(slab), blocks * stride);
+		try {
+			slabs.insert(std::upper_bound(slabs.begin(), slabs.end(), entry), entry);
+		} catch (...) {
+			free_aligned_system(slab);
+			return false;
+		}
+	}
+	slab_bytes.fetch_add(blocks * stride, std::memory_order_relaxed);
+
+	FreeList& free = classes[cls].free;
+	// Pushed back to front so blocks are handed out in address order.
+	for (std::size_t i = blocks; i-- > 0;) {
+		std::uint8_t* block = slab + i * stride + kHeaderBytes;
+		auto* header = header_of(block);
+		header->magic = kBlockMagic;
+		header->size_class = static_cast<std::uint32_t>(cls);
+		header->capacity = class_sizes[cls];
+		header->base = nullptr;
+		free.push(reinterpret_cast<FreeNode*>(block));
+	}
+	return true;
+}
+
+bool PoolAllocator::Depot::fetch(std::size_t cls, FreeList& list) {
+	ClassDepot& depot = classes[cls];
+	std::lock_guard<std::mutex> lock(depot.mu);
+	if (depot.free.count == 0 && !carve(cls)) {
+		return false;
+	}
+	const std::size_t n = std::min(transfer_blocks[cls], depot.free.count);
+	for (std::size_t i = 0; i < n; ++i) {
+		list.push(depot.free.pop());
+	}
+	depot_fetches.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
+void PoolAllocator::Depot::give_back(std::size_t cls, FreeList& list) noexcept {
+	ClassDepot& depot = classes[cls];
+	const std::size_t n = std::min(transfer_blocks[cls], list.count);
+	std::lock_guard<std::mutex> lock(depot.mu);
+	for (std::size_t i = 0; i < n; ++i) {
+		depot.free.push(list.pop());
+	}
+	depot_returns.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PoolAllocator::Depot::give_back_all(std::size_t cls, FreeList& list) noexcept {
+	if (list.count == 0) {
+		return;
+	}
+	ClassDepot& depot = classes[cls];
+	std::lock_guard<std::mutex> lock(depot.mu);
+	while (list.count != 0) {
+		depot.free.push(list.pop());
+	}
+}
+
+bool PoolAllocator::Depot::in_slab(const void* ptr) const noexcept {
+	const auto addr = reinterpret_cast<std::uintptr_t>(ptr);
+	std::lock_guard<std::mutex> lock(slab_mu);
+	auto it = std::upper_bound(slabs.begin(), slabs.end(), std::make_pair(addr, ~std::size_t{0}));
+	if (it == slabs.begin()) {
+		return false;
+	}
+	--it;
+	return addr < it->first + it->second;
+}
+
+void* PoolAllocator::Depot::allocate_direct(std::size_t size, std::size_t alignment) {
+	const std::size_t offset = std::max(alignment, kHeaderBytes);
+	if (size > ~std::size_t{0} - offset) {
+		return nullptr;
+	}
+	auto* base = static_cast<std::uint8_t*>(allocate_aligned_system(offset + size, offset));
+	if (!base) {
+		return nullptr;
+	}
+	std::uint8_t* ptr = base + offset;
+	auto* header = header_of(ptr);
+	header->magic = kBlockMagic;
+	header->size_class = kDirectClass;
+	header->capacity = size;
+	header->base = base;
+	try {
+		std::lock_guard<std::mutex> lock(direct_mu);
+		direct.insert(ptr);
+	} catch (...) {
+		free_aligned_system(base);
+		return nullptr;
+	}
+	direct_allocations.fetch_add(1, std::memory_order_relaxed);
+	return ptr;
+}
+
+void PoolAllocator::Depot::free_direct(void* ptr, BlockHeader* header) noexcept {
+	{
+		std::lock_guard<std::mutex> lock(direct_mu);
+		direct.erase(ptr);
+	}
+	free_aligned_system(header->base);
+}
+
+bool PoolAllocator::Depot::is_direct(const void* ptr) const noexcept {
+	std::lock_guard<std::mutex> lock(direct_mu);
+	return direct.find(ptr) != direct.end();
+}
+
+// ==================== Thread caches ====================
+
+namespace {
+
+// One thread's free lists for one pool. Returned to the depot when the thread
+// exits, unless the pool (and with it every block) is already gone.
+struct ThreadCache {
+	std::uint64_t id = 0;
+	std::weak_ptr<PoolAllocator::Depot> owner;
+	std::vector<FreeList> lists;
+
+	~ThreadCache() {
+		if (auto depot = owner.lock()) {
+			for (std::size_t cls = 0; cls < lists.size(); ++cls) {
+				depot->give_back_all(cls, lists[cls]);
+			}
+		}
+	}
+};
+
+struct ThreadCaches {
+	std::vector<std::unique_ptr<ThreadCache>> caches;
+	ThreadCache* last = nullptr;
+};
+
+thread_local ThreadCaches tl_caches;
+
+ThreadCache& thread_cache(const std::shared_ptr<PoolAllocator::Depot>& depot) {
+	ThreadCaches& tl = tl_caches;
+	if (tl.last != nullptr && tl.last->id == depot->id) {
+		return *tl.last;
+	}
+	for (const auto& cache : tl.caches) {
+		if (cache->id == depot->id) {
+			tl.last = cache.get();
+			return *cache;
+		}
+	}
+	// First use of this pool on this thread: drop caches of destroyed pools.
+	tl.caches.erase(std::remove_if(tl.caches.begin(), tl.caches.end(),
+								   [](const std::unique_ptr<ThreadCache>& c) { return c->owner.expired(); }),
+					tl.caches.end());
+	auto cache = std::make_unique<ThreadCache>();
+	cache->id = depot->id;
+	cache->owner = depot;
+	cache->lists.resize(depot->class_sizes.size());
+	tl.caches.push_back(std::move(cache));
+	tl.last = tl.caches.back().get();
+	return *tl.last;
+}
+
+} // namespace
+
+// ==================== PoolAllocator ====================
+
+struct PoolAllocator::TrackingState : detail::AllocationTracker {};
+
+PoolAllocator::PoolAllocator(PoolConfig pool, AllocatorConfig config)
+	: depot_(std::make_shared<Depot>(pool)), track_allocations_(config.track_allocations) {
+	if (track_allocations_) {
+		tracking_ = std::make_unique<TrackingState>();
+	}
+}
+
+PoolAllocator::~PoolAllocator() noexcept = default;
+
+void* PoolAllocator::allocate(int64_t size_bytes) {
+	if (size_bytes <= 0) {
+		return nullptr;
+	}
+	return allocate_aligned(static_cast<std::size_t>(size_bytes), kAlignment);
+}
+
+void* PoolAllocator::allocate_aligned(std::size_t size_bytes, std::size_t alignment_bytes) {
+	if (size_bytes == 0) {
+		return nullptr;
+	}
+	if (alignment_bytes != 0 && (alignment_bytes & (alignment_bytes - 1)) != 0) {
+		return nullptr;
+	}
+
+	void* ptr = nullptr;
+	if (size_bytes > depot_->config.max_pooled_bytes || alignment_bytes > kAlignment) {
+		ptr = depot_->allocate_direct(size_bytes, std::max(alignment_bytes, kAlignment));
+	} else {
+		const std::size_t cls = depot_->class_of(size_bytes);
+		FreeList& list = thread_cache(depot_).lists[cls];
+		if (list.count == 0 && !depot_->fetch(cls, list)) {
+			return nullptr;
+		}
+		ptr = list.pop();
+	}
+	if (ptr && track_allocations_ && tracking_) {
+		tracking_->on_allocate(ptr, size_bytes);
+	}
+	return ptr;
+}
+
+void PoolAllocator::deallocate(void* ptr) noexcept {
+	if (!ptr) {
+		return;
+	}
+	if (track_allocations_ && tracking_) {
+		tracking_->on_free(ptr);
+	}
+
+	BlockHeader* header = header_of(ptr);
+	if (header->size_class == kDirectClass) {
+		depot_->free_direct(ptr, header);
+		return;
+	}
+	const std::size_t cls = header->size_class;
+	try {
+		FreeList& list = thread_cache(depot_).lists[cls];
+		list.push(static_cast<FreeNode*>(ptr));
+		if (list.count >= 2 * depot_->transfer_blocks[cls]) {
+			depot_->give_back(cls, list);
+		}
+	} catch (...) {
+		// No cache for this thread (out of memory): hand the block to the depot.
+		FreeList single;
+		single.push(static_cast<FreeNode*>(ptr));
+		depot_->give_back_all(cls, single);
+	}
+}
+
+void* PoolAllocator::reallocate(void* ptr, int64_t new_size_bytes) {
+	if (new_size_bytes <= 0) {
+		deallocate(ptr);
+		return nullptr;
+	}
+	if (!ptr) {
+		return allocate(new_size_bytes);
+	}
+
+	const auto new_size = static_cast<std::size_t>(new_size_bytes);
+	const BlockHeader* header = header_of(ptr);
+	if (header->size_class != kDirectClass && new_size <= header->capacity) {
+		if (track_allocations_ && tracking_) {
+			tracking_->on_free(ptr);
+			tracking_->on_allocate(ptr, new_size);
+		}
+		return ptr;
+	}
+
+	void* new_ptr = allocate(new_size_bytes);
+	if (!new_ptr) {
+		return nullptr;
+	}
+	std::memcpy(new_ptr, ptr, std::min(header->capacity, new_size));
+	deallocate(ptr);
+	return new_ptr;
+}
+
+bool PoolAllocator::owns(const void* ptr) const noexcept {
+	if (!ptr) {
+		return false;
+	}
+	if (track_allocations_ && tracking_) {
+		return tracking_->is_live(ptr);
+	}
+	return depot_->in_slab(ptr) || depot_->is_direct(ptr);
+}
+
+std::size_t PoolAllocator::block_size(std::size_t size_bytes) const noexcept {
+	if (size_bytes == 0 || size_bytes > depot_->config.max_pooled_bytes) {
+		return size_bytes;
+	}
+	return depot_->class_sizes[depot_->class_of(size_bytes)];
+}
+
+AllocationStats PoolAllocator::stats() const noexcept {
+	if (!track_allocations_ || !tracking_) {
+		return {};
+	}
+	return tracking_->snapshot();
+}
+
+void PoolAllocator::reset_stats() noexcept {
+	if (!track_allocations_ || !tracking_) {
+		return;
+	}
+	tracking_->reset_stats();
+}
+
+PoolStats PoolAllocator::pool_stats() const noexcept {
+	PoolStats s;
+	s.depot_fetches = depot_->depot_fetches.load(std::memory_order_relaxed);
+	s.depot_returns = depot_->depot_returns.load(std::memory_order_relaxed);
+	s.slab_bytes = depot_->slab_bytes.load(std::memory_order_relaxed);
+	s.direct_allocations = depot_->direct_allocations.load(std::memory_order_relaxed);
+	std::lock_guard<std::mutex> lock(depot_->slab_mu);
+	s.slabs = depot_->slabs.size();
+	return s;
+}
+
+std::unique_ptr<Allocator> make_pool_allocator(PoolConfig pool, AllocatorConfig config) {
+	return std::make_unique<PoolAllocator>(pool, config);
+}
+
+} // namespace core
+} // namespace inference_engine
@@ -0,0 +1,413 @@
+// OnnxModel::buildGraph: ONNX nodes -> infer::Graph, with shape inference for
+// intermediates the file does not annotate.
+
+#include "inference_engine/onnx/onnx_model.h"
+
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/onnx/onnx_node_op.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/binary_elementwise.h"
+#include "inference_engine/ops/conv2d.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/normalization.h"
+#include "inference_engine/ops/reshape.h"
+#include "inference_engine/ops/softmax.h"
+#include "inference_engine/ops/transpose.h"
+
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+
+namespace {
+
+using Dims = std::vector<std::int64_t>;
+
+struct ValueType {
+    DataType dtype = DataType::UNKNOWN;
+    std::optional<Dims> dims; // nullopt when unknown
+};
+
+std::optional<Dims> resolveDims(const OnnxValueInfo& info, std::int64_t symbolic) {
+    if (!info.has_shape) return std::nullopt;
+    Dims dims = info.dims;
+    for (auto& d : dims) {
+        if (d < 0) d = symbolic;
+    }
+    return dims;
+}
+
+std::int64_t intAttr(const OnnxNode& node, const char* key, std::int64_t fallback) {
+    const auto* v = node.attributes.tryGetPtr<AttributeMap::Int>(key);
+    return v != nullptr ? *v : fallback;
+}
+
+double floatAttr(const OnnxNode& node, const char* key, double fallback) {
+    const auto* v = node.attributes.tryGetPtr<AttributeMap::Float>(key);
+    return v != nullptr ? *v : fallback;
+}
+
+std::string stringAttr(const OnnxNode& node, const char* key, const std::string& fallback) {
+    const auto* v = node.attributes.tryGetPtr<AttributeMap::String>(key);
+    return v != nullptr ? *v : fallback;
+}
+
+// The engine's binary elementwise operators; their initializer operands become
+// graph initializers instead of being baked into the operator.
+std::optional<BinaryKind> binaryKind(const std::string& op_type) {
+    if (op_type == "Add") return BinaryKind::Add;
+    if (op_type == "Sub") return BinaryKind::Sub;
+    if (op_type == "Mul") return BinaryKind::Mul;
+    if (op_type == "Div") return BinaryKind::Div;
+    if (op_type == "Max") return BinaryKind::Max;
+    if (op_type == "Min") return BinaryKind::Min;
+    return std::nullopt;
+}
+
+std::optional<Dims> broadcast(const Dims& a, const Dims& b) {
+    Dims out(std::max(a.size(), b.size()), 1);
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        const std::int64_t da = i < out.size() - a.size() ? 1 : a[i - (out.size() - a.size())];
+        const std::int64_t db = i < out.size() - b.size() ? 1 : b[i - (out.size() - b.size())];
+        if (da != db && da != 1 && db != 1) return std::nullopt;
+        out[i] = da == 1 ? db : da;
+    }
+    return out;
+}
+
+std::vector<std::int64_t> intsAttr(const OnnxNode& node, const char* key, std::vector<std::int64_t> fallback) {
+    const auto* v = node.attributes.tryGetPtr<AttributeMap::Ints>(key);
+    return v != nullptr ? *v : fallback;
+}
+
+// Conv output [N, M, OH, OW] from X [N, C, H, W] and W [M, C / group, KH, KW].
+std::optional<Dims> convDims(const OnnxNode& node, const Dims& x, const Dims& w) {
+    if (x.size() != 4 || w.size() != 4) return std::nullopt;
+    const Dims strides = intsAttr(node, "strides", {1, 1});
+    const Dims pads = intsAttr(node, "pads", {0, 0, 0, 0});
+    const Dims dilations = intsAttr(node, "dilations", {1, 1});
+    if (strides.size() != 2 || pads.size() != 4 || dilations.size() != 2) return std::nullopt;
+    Dims out{x[0], w[0], 0, 0};
+    for (std::size_t i = 0; i < 2; ++i) {
+        const std::int64_t span = (w[2 + i] - 1) * dilations[i] + 1;
+        const std::int64_t padded = x[2 + i] + pads[i] + pads[i + 2];
+        if (strides[i] <= 0 || padded < span) return std::nullopt;
+        out[2 + i] = (padded - span) / strides[i] + 1;
+    }
+    return out;
+}
+
+// Output type of the first output for the operators the engine knows about.
+ValueType inferOutput(const OnnxNode& node, const std::vector<ValueType>& in) {
+    static const std::unordered_set<std::string> kSameShape = {
+        "Relu", "LeakyRelu", "Sigmoid", "Tanh", "Softmax", "LogSoftmax", "Identity", "Dropout", "Erf",
+        "Gelu", "Exp", "Log", "Neg", "Sqrt", "Abs", "Clip", "HardSigmoid", "HardSwish", "Elu",
+        "LayerNormalization", "RMSNormalization", "BatchNormalization", "Softplus"};
+    static const std::unordered_set<std::string> kBroadcast = {"Add", "Sub", "Mul", "Div", "Pow", "Max", "Min"};
+
+    ValueType out;
+    if (in.empty()) return out;
+    out.dtype = in[0].dtype;
+    const auto& a = in[0].dims;
+    const std::string& op = node.op_type;
+    if (kSameShape.count(op) != 0) {
+        out.dims = a;
+    } else if (kBroadcast.count(op) != 0 && in.size() == 2 && a && in[1].dims) {
+        out.dims = broadcast(*a, *in[1].dims);
+    } else if (op == "Gemm" && in.size() >= 2 && a && in[1].dims && a->size() == 2 && in[1].dims->size() == 2) {
+        const auto& b = *in[1].dims;
+        const std::int64_t m = intAttr(node, "transA", 0) != 0 ? (*a)[1] : (*a)[0];
+        const std::int64_t n = intAttr(node, "transB", 0) != 0 ? b[0] : b[1];
+        out.dims = Dims{m, n};
+    } else if (op == "MatMul" && in.size() == 2 && a && in[1].dims && !a->empty() && in[1].dims->size() == 2) {
+        Dims d = *a;
+        d.back() = (*in[1].dims)[1];
+        out.dims = d;
+    } else if (op == "Conv" && in.size() >= 2 && a && in[1].dims) {
+        if (stringAttr(node, "auto_pad", "NOTSET") == "NOTSET") out.dims = convDims(node, *a, *in[1].dims);
+    } else if (op == "Flatten" && a) {
+        std::int64_t axis = intAttr(node, "axis", 1);
+        if (axis < 0) axis += static_cast<std::int64_t>(a->size());
+        std::int64_t outer = 1, inner = 1;
+        for (std::size_t i = 0; i < a->size(); ++i) (static_cast<std::int64_t>(i) < axis ? outer : inner) *= (*a)[i];
+        out.dims = Dims{outer, inner};
+    } else if (op == "Transpose" && a) {
+        const auto* perm = node.attributes.tryGetPtr<AttributeMap::Ints>("perm");
+        Dims d(a->rbegin(), a->rend());
+        if (perm != nullptr && perm->size() == a->size()) {
+            for (std::size_t i = 0; i < perm->size(); ++i) d[i] = (*a)[static_cast<std::size_t>((*perm)[i])];
+        }
+        out.dims = d;
+    }
+    return out;
+}
+
+const Tensor& requireFp32Weight(const Tensor& t, const OnnxNode& node, const char* what) {
+    if (t.dtype() != DataType::FP32) {
+        throw std::invalid_argument("ONNX: " + node.op_type + " '" + node.name + "' needs FP32 " + what);
+    }
+    return t;
+}
+
+[[noreturn]] void unsupported(const OnnxNode& node, const std::string& why) {
+    throw std::invalid_argument("ONNX: cannot execute " + node.op_type + " node '" + node.name + "': " + why +
+                                " (import with load_weights = false to inspect it)");
+}
+
+// Gemm/MatMul with a constant right-hand side -> MatMulBiasOp. Weights the engine can
+// use as stored (row-major [K, N], alpha 1) stay views of the file; transposed or
+// scaled weights are materialized once.
+std::unique_ptr<Operator> makeLinear(const OnnxModel& model, const OnnxNode& node, const ValueType& a_type) {
+    const bool gemm = node.op_type == "Gemm";
+    const OnnxInitializer* b_init = node.inputs.size() > 1 ? model.findInitializer(node.inputs[1]) : nullptr;
+    if (b_init == nullptr || b_init->dims.size() != 2) unsupported(node, "B must be a 2-D initializer");
+    if (!a_type.dims || a_type.dims->size() != 2) unsupported(node, "A must be 2-D");
+    if (gemm && intAttr(node, "transA", 0) != 0) unsupported(node, "transA is not supported");
+
+    const bool trans_b = gemm && intAttr(node, "transB", 0) != 0;
+    const float alpha = gemm ? static_cast<float>(floatAttr(node, "alpha", 1.0)) : 1.0f;
+    const float beta = gemm ? static_cast<float>(floatAttr(node, "beta", 1.0)) : 1.0f;
+    const Tensor b = requireFp32Weight(model.initializerData(*b_init), node, "weights");
+    const std::int64_t k = trans_b ? b.dim(1) : b.dim(0);
+    const std::int64_t n = trans_b ? b.dim(0) : b.dim(1);
+    if ((*a_type.dims)[1] != k) unsupported(node, "inner dimensions differ");
+    const std::size_t kn = static_cast<std::size_t>(k * n);
+
+    WeightBuffer<float> weights;
+    if (!trans_b && alpha == 1.0f) {
+        weights = WeightBuffer<float>::view(b.data_as<float>(), kn);
+    } else {
+        std::vector<float> w(kn);
+        const float* src = b.data_as<float>();
+        for (std::int64_t p = 0; p < k; ++p) {
+            for (std::int64_t j = 0; j < n; ++j) {
+                w[static_cast<std::size_t>(p * n + j)] = alpha * (trans_b ? src[j * k + p] : src[p * n + j]);
+            }
+        }
+        weights = std::move(w);
+    }
+
+    WeightBuffer<float> bias = std::vector<float>(static_cast<std::size_t>(n), 0.0f);
+    const OnnxInitializer* c_init =
+        gemm && node.inputs.size() > 2 && !node.inputs[2].empty() ? model.findInitializer(node.inputs[2]) : nullptr;
+    if (gemm && node.inputs.size() > 2 && !node.inputs[2].empty() && c_init == nullptr) {
+        unsupported(node, "C must be an initializer");
+    }
+    if (c_init != nullptr) {
+        const Tensor c = requireFp32Weight(model.initializerData(*c_init), node, "bias");
+        const std::int64_t count = c.num_elements();
+        const bool row = count == n && (c.rank() == 1 || (c.rank() == 2 && c.dim(0) == 1));
+        if (!row && count != 1) unsupported(node, "C must broadcast along rows");
+        if (row && beta == 1.0f) {
+            bias = WeightBuffer<float>::view(c.data_as<float>(), static_cast<std::size_t>(n));
+        } else {
+            std::vector<float> v(static_cast<std::size_t>(n));
+            for (std::int64_t j = 0; j < n; ++j) v[static_cast<std::size_t>(j)] = beta * c.data_as<float>()[row ? j : 0];
+            bias = std::move(v);
+        }
+    }
+    return std::make_unique<MatMulBiasOp>(k, n, std::move(weights), std::move(bias));
+}
+
+// Conv(X, W[, B]) with constant weights -> Conv2dOp viewing the file's OIHW weights.
+// Strides, pads, dilations and group come from Operator::decodeAttributes.
+std::unique_ptr<Operator> makeConv(const OnnxModel& model, const OnnxNode& node, const ValueType& x_type) {
+    const OnnxInitializer* w_init = node.inputs.size() > 1 ? model.findInitializer(node.inputs[1]) : nullptr;
+    if (w_init == nullptr || w_init->dims.size() != 4) unsupported(node, "W must be a 4-D initializer");
+    if (!x_type.dims || x_type.dims->size() != 4) unsupported(node, "X must be [N, C, H, W] (2-D convolution)");
+    if (stringAttr(node, "auto_pad", "NOTSET") != "NOTSET") unsupported(node, "only auto_pad=NOTSET is supported");
+
+    const Tensor w = requireFp32Weight(model.initializerData(*w_init), node, "weights");
+    Conv2dParams params;
+    params.groups = intAttr(node, "group", 1);
+    params.out_channels = w.dim(0);
+    params.in_channels = w.dim(1) * params.groups;
+    params.kernel_h = w.dim(2);
+    params.kernel_w = w.dim(3);
+    if ((*x_type.dims)[1] != params.in_channels) unsupported(node, "input channels do not match W and group");
+
+    WeightBuffer<float> bias;
+    if (node.inputs.size() > 2 && !node.inputs[2].empty()) {
+        const OnnxInitializer* b_init = model.findInitializer(node.inputs[2]);
+        if (b_init == nullptr) unsupported(node, "B must be an initializer");
+        const Tensor b = requireFp32Weight(model.initializerData(*b_init), node, "bias");
+        if (b.num_elements() != params.out_channels) unsupported(node, "B needs one value per output channel");
+        bias = WeightBuffer<float>::view(b.data_as<float>(), static_cast<std::size_t>(params.out_channels));
+    }
+    return std::make_unique<Conv2dOp>(
+        params, WeightBuffer<float>::view(w.data_as<float>(), static_cast<std::size_t>(w.num_elements())),
+        std::move(bias));
+}
+
+// True when `axis` names the last axis of input 0 (-1 always does; a non-negative
+// axis needs the rank).
+bool lastAxis(const std::vector<ValueType>& inputs, std::int64_t axis) {
+    if (axis == -1) return true;
+    return !inputs.empty() && inputs[0].dims && axis == static_cast<std::int64_t>(inputs[0].dims->size()) - 1;
+}
+
+// Optional FP32 initializer of one value per normalized element; empty when the
+// input is absent.
+WeightBuffer<float> normParam(const OnnxModel& model, const OnnxNode& node, std::size_t index, const char* what) {
+    if (node.inputs.size() <= index || node.inputs[index].empty()) return {};
+    const OnnxInitializer* init = model.findInitializer(node.inputs[index]);
+    if (init == nullptr) unsupported(node, std::string(what) + " must be an initializer");
+    const Tensor t = requireFp32Weight(model.initializerData(*init), node, what);
+    return WeightBuffer<float>::view(t.data_as<float>(), static_cast<std::size_t>(t.num_elements()));
+}
+
+// LayerNormalization(X, Scale, B) and RMSNormalization(X, scale) over the last axis
+// -> LayerNormOp / RmsNormOp with the parameters viewing the file.
+std::unique_ptr<Operator> makeNormalization(const OnnxModel& model, const OnnxNode& node,
+                                            const std::vector<ValueType>& inputs) {
+    if (!lastAxis(inputs, intAttr(node, "axis", -1))) unsupported(node, "only axis=-1 is supported");
+    for (std::size_t o = 1; o < node.outputs.size(); ++o) {
+        if (!node.outputs[o].empty()) unsupported(node, "only the normalized output is supported");
+    }
+    // epsilon comes from Operator::decodeAttributes.
+    WeightBuffer<float> gamma = normParam(model, node, 1, "scale");
+    if (node.op_type == "RMSNormalization") return std::make_unique<RmsNormOp>(std::move(gamma));
+    return std::make_unique<LayerNormOp>(std::move(gamma), normParam(model, node, 2, "bias"));
+}
+
+std::unique_ptr<Operator> makeExecutable(const OnnxModel& model, const OnnxNode& node,
+                                         const std::vector<ValueType>& inputs) {
+    if (!node.domain.empty() && node.domain != "ai.onnx") unsupported(node, "unknown domain " + node.domain);
+    if (node.op_type == "Gemm" || node.op_type == "MatMul") {
+        return makeLinear(model, node, inputs.empty() ? ValueType{} : inputs[0]);
+    }
+    if (node.op_type == "Conv") return makeConv(model, node, inputs.empty() ? ValueType{} : inputs[0]);
+    if (node.op_type == "Relu") return std::make_unique<ReluOp>();
+    if (node.op_type == "Sigmoid") return std::make_unique<SigmoidOp>();
+    if (node.op_type == "Tanh") return std::make_unique<TanhOp>();
+    if (node.op_type == "Gelu") {
+        if (stringAttr(node, "approximate", "none") != "none") unsupported(node, "only approximate=none is supported");
+        return std::make_unique<GeluOp>();
+    }
+    if (const auto kind = binaryKind(node.op_type)) {
+        if (inputs.size() != 2) unsupported(node, "expected exactly 2 inputs");
+        return std::make_unique<BinaryElementwiseOp>(*kind);
+    }
+    if (node.op_type == "Flatten") return std::make_unique<ReshapeOp>();
+    if (node.op_type == "Transpose") return std::make_unique<TransposeOp>(); // perm: decodeAttributes
+    if (node.op_type == "Softmax" || node.op_type == "LogSoftmax") {
+        if (!lastAxis(inputs, intAttr(node, "axis", -1))) {
+            unsupported(node, "only " + node.op_type + " over the last axis is supported");
+        }
+        if (node.op_type == "Softmax") return std::make_unique<SoftmaxOp>();
+        return std::make_unique<LogSoftmaxOp>();
+    }
+    if (node.op_type == "LayerNormalization" || node.op_type == "RMSNormalization") {
+        return makeNormalization(model, node, inputs);
+    }
+    unsupported(node, "operator not implemented");
+}
+
+} // namespace
+
+void OnnxModel::buildGraph(Graph& graph, const OnnxImportOptions& options) {
+    graph.setModelName(graph_name_);
+
+    std::unordered_map<std::string, const OnnxValueInfo*> declared;
+    for (const auto& v : value_infos_) declared[v.name] = &v;
+    for (const auto& v : outputs_) declared[v.name] = &v;
+
+    std::unordered_map<std::string, Value*> values;
+    auto create = [&](const std::string& name, const ValueType& type) {
+        if (values.count(name) != 0 || findInitializer(name) != nullptr) {
+            throw std::runtime_error("ONNX: value '" + name + "' is defined more than once");
+        }
+        // Unknown shapes get UNKNOWN dtype so the memory planner counts them as 0 bytes.
+        Value* v = type.dims ? graph.createValue(Shape(*type.dims), type.dtype, name)
+                             : graph.createValue(Shape(), DataType::UNKNOWN, name);
+        values.emplace(name, v);
+        return v;
+    };
+
+    // Initializers consumed as operands, created on first use.
+    std::unordered_map<std::string, Value*> constants;
+    auto constant = [&](const OnnxInitializer& init) {
+        const auto it = constants.find(init.name);
+        if (it != constants.end()) return it->second;
+        Value* v = graph.createValue(Shape(init.dims), init.dtype, init.name);
+        graph.setInitializer(v, initializerData(init));
+        constants.emplace(init.name, v);
+        return v;
+    };
+
+    std::vector<Value*> graph_inputs;
+    for (const auto& in : inputs_) {
+        graph_inputs.push_back(create(in.name, {in.dtype, resolveDims(in, options.symbolic_dim_value)}));
+    }
+
+    for (std::size_t i = 0; i < nodes_.size(); ++i) {
+        OnnxNode& node = nodes_[i];
+        const std::string node_name = node.name.empty() ? node.op_type + "_" + std::to_string(i) : node.name;
+
+        std::vector<Value*> node_inputs;
+        std::vector<ValueType> input_types;
+        std::size_t weight_bytes = 0;
+        for (const std::string& in : node.inputs) {
+            if (in.empty()) continue;
+            if (const OnnxInitializer* init = findInitializer(in)) {
+                input_types.push_back({init->dtype, init->dims});
+                weight_bytes += init->byteSize();
+                if (options.load_weights && binaryKind(node.op_type)) node_inputs.push_back(constant(*init));
+                continue;
+            }
+            const auto it = values.find(in);
+            if (it == values.end()) {
+                throw std::runtime_error("ONNX: node '" + node_name + "' consumes undefined value '" + in + "'");
+            }
+            node_inputs.push_back(it->second);
+            const Value* v = it->second;
+            input_types.push_back(v->dtype() == DataType::UNKNOWN ? ValueType{}
+                                                                  : ValueType{v->dtype(), v->shape().dims().to_vector()});
+        }
+
+        std::vector<Value*> node_outputs;
+        for (std::size_t o = 0; o < node.outputs.size(); ++o) {
+            const std::string& out = node.outputs[o];
+            if (out.empty()) continue;
+            ValueType type;
+            const auto d = declared.find(out);
+            if (d != declared.end() && d->second->has_shape) {
+                type = {d->second->dtype, resolveDims(*d->second, options.symbolic_dim_value)};
+            } else if (o == 0) {
+                type = inferOutput(node, input_types);
+            }
+            node_outputs.push_back(create(out, type));
+        }
+
+        std::unique_ptr<Operator> op =
+            options.load_weights ? makeExecutable(*this, node, input_types)
+                                 : std::make_unique<OnnxNodeOp>(node.op_type, node.domain, weight_bytes);
+        op->setAttributes(&node.attributes);
+        op->decodeAttributes(node.attributes); // Graph::compile decodes again; this keeps validate() usable
+        Node* n = graph.addNode(std::move(op), node_name);
+        n->setInputs(std::move(node_inputs));
+        n->setOutputs(std::move(node_outputs));
+    }
+
+    std::vector<Value*> graph_outputs;
+    for (const auto& out : outputs_) {
+        const auto it = values.find(out.name);
+        if (it == values.end()) {
+            throw std::runtime_error("ONNX: graph output '" + out.name + "' is not produced by any node");
+        }
+        graph_outputs.push_back(it->second);
+    }
+    graph.setInputs(std::move(graph_inputs));
+    graph.setOutputs(std::move(graph_outputs));
+}
+
+} // namespace infer
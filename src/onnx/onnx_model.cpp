@@ -0,0 +1,456 @@
+#include "inference_engine/onnx/onnx_model.h"
+
+#include "protobuf_reader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+using inference_engine::core::MappedFile;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using onnx_detail::ProtoField;
+using onnx_detail::ProtoReader;
+using onnx_detail::WireType;
+
+namespace {
+
+// onnx.TensorProto.DataType -> DataType; UNKNOWN for types the engine lacks.
+DataType fromOnnxType(std::uint64_t t) {
+    switch (t) {
+    case 1: return DataType::FP32;
+    case 2: return DataType::UINT8;
+    case 3: return DataType::INT8;
+    case 4: return DataType::UINT16;
+    case 5: return DataType::INT16;
+    case 6: return DataType::INT32;
+    case 7: return DataType::INT64;
+    case 9: return DataType::BOOL;
+    case 10: return DataType::FP16;
+    case 12: return DataType::UINT32;
+    case 13: return DataType::UINT64;
+    default: return DataType::UNKNOWN;
+    }
+}
+
+bool checkedNumElements(const std::vector<std::int64_t>& dims, std::int64_t& out) {
+    std::int64_t n = 1;
+    for (std::int64_t d : dims) {
+        if (d < 0) return false;
+        if (d != 0 && n > std::numeric_limits<std::int64_t>::max() / d) return false;
+        n *= d;
+    }
+    out = n;
+    return true;
+}
+
+// TypeProto -> dtype and shape.
+void parseType(const ProtoField& type_field, OnnxValueInfo& info) {
+    ProtoReader type(type_field);
+    ProtoField f;
+    while (type.next(f)) {
+        if (f.number != 1 || f.wire != WireType::Bytes) continue; // tensor_type
+        ProtoReader tensor(f);
+        ProtoField t;
+        while (tensor.next(t)) {
+            if (t.number == 1 && t.wire == WireType::Varint) {
+                info.dtype = fromOnnxType(t.value);
+            } else if (t.number == 2 && t.wire == WireType::Bytes) {
+                info.has_shape = true;
+                ProtoReader shape(t);
+                ProtoField d;
+                while (shape.next(d)) {
+                    if (d.number != 1 || d.wire != WireType::Bytes) continue;
+                    std::int64_t value = -1;
+                    std::string param;
+                    ProtoReader dim(d);
+                    ProtoField df;
+                    while (dim.next(df)) {
+                        if (df.number == 1 && df.wire == WireType::Varint) value = static_cast<std::int64_t>(df.value);
+                        if (df.number == 2 && df.wire == WireType::Bytes) param = df.str();
+                    }
+                    info.dims.push_back(value);
+                    info.dim_params.push_back(std::move(param));
+                }
+            }
+        }
+    }
+}
+
+OnnxValueInfo parseValueInfo(const ProtoField& field) {
+    OnnxValueInfo info;
+    ProtoReader r(field);
+    ProtoField f;
+    while (r.next(f)) {
+        if (f.number == 1 && f.wire == WireType::Bytes) info.name = f.str();
+        if (f.number == 2 && f.wire == WireType::Bytes) parseType(f, info);
+    }
+    return info;
+}
+
+// TensorProto metadata. Payload fields are located but not decoded.
+OnnxInitializer parseTensor(const ProtoField& field, const std::uint8_t* file_base) {
+    OnnxInitializer init;
+    bool external = false;
+    std::size_t raw_fields = 0;
+    std::size_t typed_fields = 0;
+    const ProtoField* raw = nullptr;
+    ProtoField raw_copy;
+    std::size_t ext_offset = 0;
+    std::size_t ext_length = 0;
+    bool has_ext_length = false;
+
+    ProtoReader r(field);
+    ProtoField f;
+    while (r.next(f)) {
+        switch (f.number) {
+        case 1: onnx_detail::appendInt64s(f, init.dims); break;
+        case 2: init.dtype = fromOnnxType(f.value); break;
+        case 3: throw std::runtime_error("ONNX: segmented tensors are not supported");
+        case 8: init.name = f.str(); break;
+        case 9:
+        case 4: // raw_data, or float_data (packed floats are the raw bytes)
+            if (f.number == 4 && f.wire != WireType::Bytes) {
+                ++typed_fields;
+                break;
+            }
+            ++raw_fields;
+            raw_copy = f;
+            raw = &raw_copy;
+            break;
+        case 5:
+        case 7:
+        case 10:
+        case 11: ++typed_fields; break;
+        case 13: {
+            std::string key, value;
+            ProtoReader entry(f);
+            ProtoField e;
+            while (entry.next(e)) {
+                if (e.number == 1) key = e.str();
+                if (e.number == 2) value = e.str();
+            }
+            if (key == "location") {
+                init.location = value;
+            } else if (key == "offset") {
+                ext_offset = static_cast<std::size_t>(std::stoull(value));
+            } else if (key == "length") {
+                ext_length = static_cast<std::size_t>(std::stoull(value));
+                has_ext_length = true;
+            }
+            break;
+        }
+        case 14: external = f.value == 1; break;
+        default: break;
+        }
+    }
+
+    std::int64_t elems = 0;
+    if (!checkedNumElements(init.dims, elems)) {
+        throw std::runtime_error("ONNX: initializer '" + init.name + "' has invalid dims");
+    }
+    if (external) {
+        if (init.location.empty()) {
+            throw std::runtime_error("ONNX: external initializer '" + init.name + "' has no location");
+        }
+        init.storage = OnnxInitializer::Storage::External;
+        init.offset = ext_offset;
+        init.length = has_ext_length ? ext_length : init.byteSize();
+    } else if (raw_fields == 1 && typed_fields == 0) {
+        init.storage = OnnxInitializer::Storage::Raw;
+        init.offset = static_cast<std::size_t>(raw->data - file_base);
+        init.length = raw->size;
+    } else if (raw_fields == 0 && typed_fields == 0 && elems == 0) {
+        init.storage = OnnxInitializer::Storage::Raw;
+    } else {
+        // Unpacked or varint-encoded *_data fields: re-walked on first access.
+        init.storage = OnnxInitializer::Storage::Typed;
+        init.offset = static_cast<std::size_t>(field.data - file_base);
+        init.length = field.size;
+    }
+    if (init.storage != OnnxInitializer::Storage::Typed && init.dtype != DataType::UNKNOWN &&
+        init.length != init.byteSize()) {
+        throw std::runtime_error("ONNX: initializer '" + init.name + "' data size does not match its shape");
+    }
+    return init;
+}
+
+void parseAttribute(const ProtoField& field, OnnxNode& node, const std::uint8_t* file_base,
+                    std::vector<OnnxInitializer>& constants) {
+    std::string name;
+    std::uint64_t type = 0;
+    std::optional<double> f_val;
+    std::optional<std::int64_t> i_val;
+    std::optional<std::string> s_val;
+    AttributeMap::Floats floats;
+    AttributeMap::Ints ints;
+    AttributeMap::Strings strings;
+    std::optional<ProtoField> tensor;
+
+    ProtoReader r(field);
+    ProtoField f;
+    while (r.next(f)) {
+        switch (f.number) {
+        case 1: name = f.str(); break;
+        case 2: f_val = f.f32(); break;
+        case 3: i_val = static_cast<std::int64_t>(f.value); break;
+        case 4: s_val = f.str(); break;
+        case 5: tensor = f; break;
+        case 7: onnx_detail::appendFloats(f, floats); break;
+        case 8: onnx_detail::appendInt64s(f, ints); break;
+        case 9: strings.push_back(f.str()); break;
+        case 20: type = f.value; break;
+        default: break; // graphs, sparse tensors and doc strings are not imported
+        }
+    }
+    if (type == 0) {
+        // Pre-IR3 files omit the type; infer it from the populated field.
+        type = f_val ? 1 : i_val ? 2 : s_val ? 3 : tensor ? 4 : !floats.empty() ? 6 : !ints.empty() ? 7 : 8;
+    }
+    switch (type) {
+    case 1: node.attributes.set(name, f_val.value_or(0.0)); break;
+    case 2: node.attributes.set(name, i_val.value_or(0)); break;
+    case 3: node.attributes.set(name, s_val.value_or(std::string())); break;
+    case 4:
+        if (tensor && node.op_type == "Constant" && name == "value" && !node.outputs.empty()) {
+            OnnxInitializer init = parseTensor(*tensor, file_base);
+            init.name = node.outputs[0];
+            constants.push_back(std::move(init));
+        }
+        break;
+    case 6: node.attributes.set(name, std::move(floats)); break;
+    case 7: node.attributes.set(name, std::move(ints)); break;
+    case 8: node.attributes.set(name, std::move(strings)); break;
+    default: break;
+    }
+}
+
+template <typename T>
+void storeDecoded(std::vector<std::uint8_t>& out, std::size_t index, T v) {
+    std::memcpy(out.data() + index * sizeof(T), &v, sizeof(T));
+}
+
+// Decodes int32_data/int64_data/uint64_data/float_data fields into packed storage.
+void decodeTyped(const OnnxInitializer& init, const std::uint8_t* tensor, std::vector<std::uint8_t>& out) {
+    const std::size_t elem = inference_engine::core::bytes_per_element(init.dtype);
+    const std::size_t count = static_cast<std::size_t>(init.numElements());
+    out.assign(count * elem, 0);
+    std::size_t i = 0;
+    auto put = [&](std::uint64_t bits, bool is_float) {
+        if (i >= count) throw std::runtime_error("ONNX: initializer '" + init.name + "' has too many values");
+        if (is_float) {
+            const auto b = static_cast<std::uint32_t>(bits);
+            storeDecoded(out, i, b);
+        } else if (elem == 1) {
+            storeDecoded(out, i, static_cast<std::uint8_t>(bits));
+        } else if (elem == 2) {
+            storeDecoded(out, i, static_cast<std::uint16_t>(bits)); // includes FP16 bit patterns
+        } else if (elem == 4) {
+            storeDecoded(out, i, static_cast<std::uint32_t>(bits));
+        } else {
+            storeDecoded(out, i, bits);
+        }
+        ++i;
+    };
+
+    ProtoReader r(tensor, init.length);
+    ProtoField f;
+    while (r.next(f)) {
+        const bool is_float = f.number == 4;
+        if (f.number != 4 && f.number != 5 && f.number != 7 && f.number != 11) continue;
+        if (is_float && init.dtype != DataType::FP32) continue;
+        if (f.wire == WireType::Bytes && is_float) {
+            for (std::size_t p = 0; p + 4 <= f.size; p += 4) {
+                std::uint32_t b;
+                std::memcpy(&b, f.data + p, sizeof(b));
+                put(b, true);
+            }
+        } else if (f.wire == WireType::Bytes) {
+            ProtoReader packed(f);
+            while (!packed.done()) put(packed.varint(), false);
+        } else {
+            put(f.value, is_float);
+        }
+    }
+    if (i != count) throw std::runtime_error("ONNX: initializer '" + init.name + "' has too few values");
+}
+
+} // namespace
+
+std::int64_t OnnxInitializer::numElements() const noexcept {
+    std::int64_t n = 0;
+    return checkedNumElements(dims, n) ? n : 0;
+}
+
+std::size_t OnnxInitializer::byteSize() const noexcept {
+    return static_cast<std::size_t>(numElements()) * inference_engine::core::bytes_per_element(dtype);
+}
+
+OnnxModel::OnnxModel(const std::string& path)
+    : file_(path), directory_(std::filesystem::path(path).parent_path().string()) {
+    parseModel(static_cast<const std::uint8_t*>(file_.data()), file_.size());
+    loaded_.assign(initializers_.size(), nullptr);
+    decoded_.resize(initializers_.size());
+}
+
+void OnnxModel::parseModel(const std::uint8_t* data, std::size_t size) {
+    bool has_graph = false;
+    ProtoReader r(data, size);
+    ProtoField f;
+    while (r.next(f)) {
+        switch (f.number) {
+        case 1: ir_version_ = static_cast<std::int64_t>(f.value); break;
+        case 2: producer_name_ = f.str(); break;
+        case 3: producer_version_ = f.str(); break;
+        case 7:
+            parseGraph(f.data, f.size);
+            has_graph = true;
+            break;
+        case 8: {
+            OnnxOpset opset;
+            ProtoReader o(f);
+            ProtoField of;
+            while (o.next(of)) {
+                if (of.number == 1) opset.domain = of.str();
+                if (of.number == 2) opset.version = static_cast<std::int64_t>(of.value);
+            }
+            opsets_.push_back(std::move(opset));
+            break;
+        }
+        default: break;
+        }
+    }
+    if (!has_graph) throw std::runtime_error("ONNX: model has no graph");
+}
+
+void OnnxModel::parseGraph(const std::uint8_t* data, std::size_t size) {
+    const auto* base = static_cast<const std::uint8_t*>(file_.data());
+    std::vector<OnnxValueInfo> declared_inputs;
+    ProtoReader r(data, size);
+    ProtoField f;
+    while (r.next(f)) {
+        if (f.wire != WireType::Bytes) continue;
+        switch (f.number) {
+        case 1: {
+            OnnxNode node;
+            std::vector<ProtoField> attrs;
+            ProtoReader n(f);
+            ProtoField nf;
+            while (n.next(nf)) {
+                switch (nf.number) {
+                case 1: node.inputs.push_back(nf.str()); break;
+                case 2: node.outputs.push_back(nf.str()); break;
+                case 3: node.name = nf.str(); break;
+                case 4: node.op_type = nf.str(); break;
+                case 5: attrs.push_back(nf); break;
+                case 7: node.domain = nf.str(); break;
+                default: break;
+                }
+            }
+            // Attributes last: a Constant's tensor is named after the node's output.
+            const std::size_t constants_before = initializers_.size();
+            for (const ProtoField& a : attrs) parseAttribute(a, node, base, initializers_);
+            if (initializers_.size() == constants_before) nodes_.push_back(std::move(node));
+            break;
+        }
+        case 2: graph_name_ = f.str(); break;
+        case 5: initializers_.push_back(parseTensor(f, base)); break;
+        case 11: declared_inputs.push_back(parseValueInfo(f)); break;
+        case 12: outputs_.push_back(parseValueInfo(f)); break;
+        case 13: value_infos_.push_back(parseValueInfo(f)); break;
+        default: break;
+        }
+    }
+
+    std::unordered_set<std::string> names;
+    for (const auto& init : initializers_) {
+        if (!names.insert(init.name).second) {
+            throw std::runtime_error("ONNX: duplicate initializer '" + init.name + "'");
+        }
+    }
+    for (auto& in : declared_inputs) {
+        if (names.count(in.name) == 0) inputs_.push_back(std::move(in));
+    }
+}
+
+const OnnxInitializer* OnnxModel::findInitializer(const std::string& name) const noexcept {
+    const auto it = std::find_if(initializers_.begin(), initializers_.end(),
+                                 [&](const OnnxInitializer& i) { return i.name == name; });
+    return it == initializers_.end() ? nullptr : &*it;
+}
+
+std::size_t OnnxModel::weightBytes() const noexcept {
+    std::size_t total = 0;
+    for (const auto& init : initializers_) total += init.byteSize();
+    return total;
+}
+
+std::size_t OnnxModel::loadedWeightBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return loaded_bytes_;
+}
+
+Tensor OnnxModel::initializerData(const OnnxInitializer& init) const {
+    if (&init < initializers_.data() || &init >= initializers_.data() + initializers_.size()) {
+        throw std::invalid_argument("OnnxModel::initializerData: initializer belongs to another model");
+    }
+    const std::size_t index = static_cast<std::size_t>(&init - initializers_.data());
+    const std::size_t elem = inference_engine::core::bytes_per_element(init.dtype);
+    if (elem == 0) {
+        throw std::runtime_error("ONNX: initializer '" + init.name + "' has an unsupported data type");
+    }
+    const std::size_t bytes = init.byteSize();
+    const Shape shape(init.dims);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (loaded_[index] == nullptr) {
+        const std::uint8_t* src = nullptr;
+        if (init.storage == OnnxInitializer::Storage::External) {
+            auto it = std::find_if(external_files_.begin(), external_files_.end(),
+                                   [&](const ExternalFile& e) { return e.location == init.location; });
+            if (it == external_files_.end()) {
+                const std::filesystem::path rel(init.location);
+                if (rel.is_absolute() || std::find(rel.begin(), rel.end(), "..") != rel.end()) {
+                    throw std::runtime_error("ONNX: external data location '" + init.location +
+                                             "' must stay inside the model directory");
+                }
+                const std::string full = (std::filesystem::path(directory_) / rel).string();
+                external_files_.push_back({init.location, std::make_unique<MappedFile>(full)});
+                it = external_files_.end() - 1;
+            }
+            const MappedFile& ext = *it->file;
+            if (init.offset > ext.size() || bytes > ext.size() - init.offset || init.length != bytes) {
+                throw std::runtime_error("ONNX: external data for '" + init.name + "' is out of range");
+            }
+            src = static_cast<const std::uint8_t*>(ext.data()) + init.offset;
+        } else if (init.storage == OnnxInitializer::Storage::Raw) {
+            src = static_cast<const std::uint8_t*>(file_.data()) + init.offset;
+        }
+
+        if (src != nullptr && reinterpret_cast<std::uintptr_t>(src) % elem == 0) {
+            loaded_[index] = src; // used in place
+        } else {
+            auto storage = std::make_unique<std::vector<std::uint8_t>>();
+            if (src != nullptr) {
+                storage->assign(src, src + bytes); // misaligned protobuf payload
+            } else if (init.storage == OnnxInitializer::Storage::Typed) {
+                decodeTyped(init, static_cast<const std::uint8_t*>(file_.data()) + init.offset, *storage);
+            }
+            storage->resize(std::max<std::size_t>(bytes, 1));
+            loaded_[index] = storage->data();
+            decoded_[index] = std::move(storage);
+        }
+        loaded_bytes_ += bytes;
+    }
+    return Tensor(shape, init.dtype, const_cast<void*>(loaded_[index]), false);
+}
+
+} // namespace infer
@@ -0,0 +1,23 @@
+#include "inference_engine/onnx/onnx_node_op.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace infer {
+
+OnnxNodeOp::OnnxNodeOp(std::string op_type, std::string domain, std::size_t weight_bytes)
+    : Operator(std::move(op_type)), domain_(std::move(domain)), weight_bytes_(weight_bytes) {}
+
+std::size_t OnnxNodeOp::estimateMemoryBytes() const noexcept {
+    return weight_bytes_;
+}
+
+void OnnxNodeOp::execute() {
+    throw std::runtime_error("OnnxNodeOp: '" + type() + "' was imported without weights and cannot run");
+}
+
+std::unique_ptr<Operator> OnnxNodeOp::clone() const {
+    return std::make_unique<OnnxNodeOp>(*this);
+}
+
+} // namespace infer
@@ -0,0 +1,139 @@
+#pragma once
+
+// Minimal protobuf wire-format cursor for the ONNX importer. It walks a message in
+// place: length-delimited fields come back as (pointer, size) slices of the input,
+// so nested messages are parsed without copying and large payloads (initializer
+// raw_data) are never touched unless a caller reads them.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace infer {
+namespace onnx_detail {
+
+enum class WireType : std::uint8_t {
+    Varint = 0,
+    Fixed64 = 1,
+    Bytes = 2,
+    Fixed32 = 5,
+};
+
+struct ProtoField {
+    std::uint32_t number = 0;
+    WireType wire = WireType::Varint;
+    std::uint64_t value = 0;          // Varint, Fixed64 and Fixed32 payloads
+    const std::uint8_t* data = nullptr; // Bytes payload
+    std::size_t size = 0;
+
+    [[nodiscard]] std::string str() const { return std::string(reinterpret_cast<const char*>(data), size); }
+    [[nodiscard]] float f32() const {
+        const auto bits = static_cast<std::uint32_t>(value);
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+};
+
+[[noreturn]] inline void malformed(const char* what) {
+    throw std::runtime_error(std::string("ONNX: malformed protobuf (") + what + ")");
+}
+
+class ProtoReader {
+public:
+    ProtoReader(const std::uint8_t* data, std::size_t size) noexcept : p_(data), end_(data + size) {}
+    explicit ProtoReader(const ProtoField& f) noexcept : ProtoReader(f.data, f.size) {}
+
+    [[nodiscard]] bool done() const noexcept { return p_ == end_; }
+
+    // Reads the next field; returns false at the end of the message.
+    bool next(ProtoField& f) {
+        if (p_ == end_) return false;
+        const std::uint64_t key = varint();
+        f.number = static_cast<std::uint32_t>(key >> 3);
+        if (f.number == 0) malformed("field number 0");
+        f.data = nullptr;
+        f.size = 0;
+        switch (key & 7u) {
+        case 0:
+            f.wire = WireType::Varint;
+            f.value = varint();
+            break;
+        case 1:
+            f.wire = WireType::Fixed64;
+            f.value = fixed<std::uint64_t>();
+            break;
+        case 2: {
+            f.wire = WireType::Bytes;
+            const std::uint64_t n = varint();
+            if (n > static_cast<std::uint64_t>(end_ - p_)) malformed("length past end of message");
+            f.data = p_;
+            f.size = static_cast<std::size_t>(n);
+            p_ += n;
+            break;
+        }
+        case 5:
+            f.wire = WireType::Fixed32;
+            f.value = fixed<std::uint32_t>();
+            break;
+        default:
+            malformed("unsupported wire type");
+        }
+        return true;
+    }
+
+    std::uint64_t varint() {
+        std::uint64_t v = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (p_ == end_) malformed("truncated varint");
+            const std::uint8_t b = *p_++;
+            v |= static_cast<std::uint64_t>(b & 0x7Fu) << shift;
+            if ((b & 0x80u) == 0) return v;
+        }
+        malformed("varint too long");
+    }
+
+private:
+    template <typename T>
+    T fixed() {
+        if (static_cast<std::size_t>(end_ - p_) < sizeof(T)) malformed("truncated fixed-width field");
+        T v;
+        std::memcpy(&v, p_, sizeof(T));
+        p_ += sizeof(T);
+        return v;
+    }
+
+    const std::uint8_t* p_;
+    const std::uint8_t* end_;
+};
+
+// Appends a repeated int64 field that may be packed (one Bytes field) or not.
+inline void appendInt64s(const ProtoField& f, std::vector<std::int64_t>& out) {
+    if (f.wire == WireType::Varint) {
+        out.push_back(static_cast<std::int64_t>(f.value));
+        return;
+    }
+    if (f.wire != WireType::Bytes) malformed("repeated int64 field");
+    ProtoReader r(f);
+    while (!r.done()) out.push_back(static_cast<std::int64_t>(r.varint()));
+}
+
+// Appends a repeated float field that may be packed or not.
+inline void appendFloats(const ProtoField& f, std::vector<double>& out) {
+    if (f.wire == WireType::Fixed32) {
+        out.push_back(f.f32());
+        return;
+    }
+    if (f.wire != WireType::Bytes || f.size % sizeof(float) != 0) malformed("repeated float field");
+    for (std::size_t i = 0; i < f.size; i += sizeof(float)) {
+        float v;
+        std::memcpy(&v, f.data + i, sizeof(v));
+        out.push_back(v);
+    }
+}
+
+} // namespace onnx_detail
+} // namespace infer
@@ -0,0 +1,129 @@
+#include "inference_engine/ops/activation.h"
+
+#include "inference_engine/graph/value.h"
+#include "inference_engine/ops/fused_elementwise.h"
+#include "op_utils.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace infer {
+
+using inference_engine::core::Tensor;
+
+namespace {
+
+void validateUnary(const Operator& op) {
+    if (op.inputs().size() != 1 || op.outputs().size() != 1) {
+        throw std::invalid_argument(op.type() + " expects 1 input and 1 output");
+    }
+}
+
+void runUnary(const Operator& op, ElementwiseKind kind, std::vector<float>& buf, Tensor& fallback) {
+    const Value* in_val = op.inputs()[0];
+    Value* out_val = op.outputs()[0];
+    const Tensor& input = ops_detail::requireFp32Input(in_val, op.type().c_str());
+
+    const std::size_t elems = static_cast<std::size_t>(input.num_elements());
+    Tensor& output = ops_detail::bindOutputTensor(out_val, in_val->shape(), buf, fallback);
+    applyElementwise(kind, input.data_as<float>(), output.data_as<float>(), elems);
+}
+
+} // namespace
+
+ReluOp::ReluOp() : Operator("ReLU") {}
+
+std::uint64_t ReluOp::estimateFlops() const noexcept {
+    return ops_detail::outputElements(*this);
+}
+
+void ReluOp::inferShapes() {
+    ops_detail::inferSameShape(*this);
+}
+
+void ReluOp::validate() const {
+    Operator::validate();
+    validateUnary(*this);
+}
+
+void ReluOp::execute() {
+    runUnary(*this, ElementwiseKind::ReLU, output_buf_, output_tensor_);
+}
+
+std::unique_ptr<Operator> ReluOp::clone() const {
+    return std::make_unique<ReluOp>(*this);
+}
+
+SigmoidOp::SigmoidOp() : Operator("Sigmoid") {}
+
+// Counted as 4 operations per element (negate, exp, add, divide); tanh alike.
+std::uint64_t SigmoidOp::estimateFlops() const noexcept {
+    return 4 * ops_detail::outputElements(*this);
+}
+
+void SigmoidOp::inferShapes() {
+    ops_detail::inferSameShape(*this);
+}
+
+void SigmoidOp::validate() const {
+    Operator::validate();
+    validateUnary(*this);
+}
+
+void SigmoidOp::execute() {
+    runUnary(*this, ElementwiseKind::Sigmoid, output_buf_, output_tensor_);
+}
+
+std::unique_ptr<Operator> SigmoidOp::clone() const {
+    return std::make_unique<SigmoidOp>(*this);
+}
+
+TanhOp::TanhOp() : Operator("Tanh") {}
+
+std::uint64_t TanhOp::estimateFlops() const noexcept {
+    return 4 * ops_detail::outputElements(*this);
+}
+
+void TanhOp::inferShapes() {
+    ops_detail::inferSameShape(*this);
+}
+
+void TanhOp::validate() const {
+    Operator::validate();
+    validateUnary(*this);
+}
+
+void TanhOp::execute() {
+    runUnary(*this, ElementwiseKind::Tanh, output_buf_, output_tensor_);
+}
+
+std::unique_ptr<Operator> TanhOp::clone() const {
+    return std::make_unique<TanhOp>(*this);
+}
+
+GeluOp::GeluOp() : Operator("GELU") {}
+
+// Scale, erf, add and multiply: 4 operations per element like sigmoid.
+std::uint64_t GeluOp::estimateFlops() const noexcept {
+    return 4 * ops_detail::outputElements(*this);
+}
+
+void GeluOp::inferShapes() {
+    ops_detail::inferSameShape(*this);
+}
+
+void GeluOp::validate() const {
+    Operator::validate();
+    validateUnary(*this);
+}
+
+void GeluOp::execute() {
+    runUnary(*this, ElementwiseKind::GELU, output_buf_, output_tensor_);
+}
+
+std::unique_ptr<Operator> GeluOp::clone() const {
+    return std::make_unique<GeluOp>(*this);
+}
+
+} // namespace infer
@@ -0,0 +1,78 @@
+#include "inference_engine/ops/binary_elementwise.h"
+
+#include "inference_engine/graph/value.h"
+#include "op_utils.h"
+
+#include <stdexcept>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+
+const char* binaryKindName(BinaryKind kind) noexcept {
+    switch (kind) {
+    case BinaryKind::Add: return "Add";
+    case BinaryKind::Sub: return "Sub";
+    case BinaryKind::Mul: return "Mul";
+    case BinaryKind::Div: return "Div";
+    case BinaryKind::Max: return "Max";
+    case BinaryKind::Min: return "Min";
+    }
+    return "?";
+}
+
+BinaryElementwiseOp::BinaryElementwiseOp(BinaryKind kind, std::vector<ElementwiseKind> epilogue)
+    : Operator(binaryKindName(kind)), kind_(kind), epilogue_(std::move(epilogue)) {}
+
+std::uint64_t BinaryElementwiseOp::estimateFlops() const noexcept {
+    std::uint64_t per_element = 1;
+    for (ElementwiseKind step : epilogue_) {
+        per_element += step == ElementwiseKind::ReLU ? 1 : 4;
+    }
+    return per_element * ops_detail::outputElements(*this);
+}
+
+void BinaryElementwiseOp::inferShapes() {
+    if (inputs().size() != 2 || outputs().size() != 1) {
+        throw std::invalid_argument(type() + " expects 2 inputs and 1 output");
+    }
+    outputs()[0]->setShape(Shape::broadcast(inputs()[0]->shape(), inputs()[1]->shape()));
+}
+
+void BinaryElementwiseOp::validate() const {
+    Operator::validate();
+    if (inputs().size() != 2 || outputs().size() != 1) {
+        throw std::invalid_argument(type() + " expects 2 inputs and 1 output");
+    }
+    for (const Value* v : {inputs()[0], inputs()[1], outputs()[0]}) {
+        if (v->dtype() != DataType::FP32) {
+            throw std::invalid_argument(type() + " only supports FP32");
+        }
+    }
+    const Shape& out = outputs()[0]->shape();
+    if (Shape::broadcast(inputs()[0]->shape(), inputs()[1]->shape()) != out) {
+        throw std::invalid_argument(type() + ": output shape " + inference_engine::core::shape_to_string(out) +
+                                    " is not the broadcast of the input shapes");
+    }
+}
+
+void BinaryElementwiseOp::execute() {
+    const Tensor& a_in = ops_detail::requireFp32Input(inputs()[0], type().c_str());
+    const Tensor& b_in = ops_detail::requireFp32Input(inputs()[1], type().c_str());
+    // Caller-provided views are densified; arena tensors are already dense.
+    const Tensor a = a_in.contiguous();
+    const Tensor b = b_in.contiguous();
+
+    const Shape shape = Shape::broadcast(a.shape(), b.shape());
+    Tensor& output = ops_detail::bindOutputTensor(outputs()[0], shape, output_buf_, output_tensor_);
+    elementwise_binary(kind_, a.data_as<float>(), a.shape(), b.data_as<float>(), b.shape(), output.data_as<float>(),
+                       shape, epilogue_.data(), epilogue_.size());
+}
+
+std::unique_ptr<Operator> BinaryElementwiseOp::clone() const {
+    return std::make_unique<BinaryElementwiseOp>(*this);
+}
+
+} // namespace infer
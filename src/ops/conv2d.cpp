@@ -0,0 +1,250 @@
+#include "inference_engine/ops/conv2d.h"
+
+#include "inference_engine/graph/attributes.h"
+#include "inference_engine/graph/packed_weight_cache.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/graph/weight_store.h"
+#include "op_utils.h"
+
+#include <stdexcept>
+
+namespace infer {
+
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+
+namespace {
+
+std::size_t ceilDiv(std::size_t a, std::size_t b) {
+    return (a + b - 1) / b;
+}
+
+// Reads a 2-element (or, for pads, 4-element) integer attribute into `dst`.
+void decodePair(const Operator& op, const AttributeMap& attrs, AttrKey key, std::size_t count,
+                std::int64_t* const* dst) {
+    const auto* v = ops_detail::decodeAttribute<AttributeMap::Ints>(op, attrs, key);
+    if (v == nullptr) return;
+    if (v->size() != count) {
+        throw std::invalid_argument(op.type() + ": attribute '" + key.name() + "' needs " + std::to_string(count) +
+                                    " values for a 2-D convolution");
+    }
+    for (std::size_t i = 0; i < count; ++i) *dst[i] = (*v)[i];
+}
+
+} // namespace
+
+Conv2dOp::Conv2dOp(Conv2dParams params, WeightBuffer<float> weights, WeightBuffer<float> bias, Activation activation)
+    : Operator("Conv2d"),
+      params_(params),
+      weights_(std::move(weights)),
+      bias_(std::move(bias)),
+      activation_(activation) {
+    const Conv2dParams& p = params_;
+    if (p.in_channels <= 0 || p.out_channels <= 0 || p.kernel_h <= 0 || p.kernel_w <= 0 || p.groups <= 0 ||
+        p.in_channels % p.groups != 0 || p.out_channels % p.groups != 0) {
+        throw std::invalid_argument("Conv2dOp: invalid channel, kernel or group configuration");
+    }
+    if (weights_.size() != static_cast<std::size_t>(p.out_channels * (p.in_channels / p.groups) * p.kernel_h *
+                                                    p.kernel_w)) {
+        throw std::invalid_argument("Conv2dOp: weight size mismatch");
+    }
+    if (!bias_.empty() && bias_.size() != static_cast<std::size_t>(p.out_channels)) {
+        throw std::invalid_argument("Conv2dOp: bias size mismatch");
+    }
+}
+
+void Conv2dOp::decodeAttributes(const AttributeMap& attrs) {
+    Conv2dParams p = params_;
+    std::int64_t* strides[] = {&p.stride_h, &p.stride_w};
+    std::int64_t* pads[] = {&p.pad_top, &p.pad_left, &p.pad_bottom, &p.pad_right};
+    std::int64_t* dilations[] = {&p.dilation_h, &p.dilation_w};
+    std::int64_t* kernel[] = {&p.kernel_h, &p.kernel_w};
+    decodePair(*this, attrs, attr_names::kStrides, 2, strides);
+    decodePair(*this, attrs, attr_names::kPads, 4, pads);
+    decodePair(*this, attrs, attr_names::kDilations, 2, dilations);
+    decodePair(*this, attrs, attr_names::kKernelShape, 2, kernel);
+    if (const auto* group = ops_detail::decodeAttribute<AttributeMap::Int>(*this, attrs, attr_names::kGroup)) {
+        p.groups = *group;
+    }
+    if (p.kernel_h != params_.kernel_h || p.kernel_w != params_.kernel_w) {
+        throw std::invalid_argument("Conv2d: kernel_shape does not match the weights");
+    }
+    params_ = p;
+}
+
+Conv2dShape Conv2dOp::convShape(std::size_t batch, std::size_t in_h, std::size_t in_w) const noexcept {
+    Conv2dShape s;
+    s.batch = batch;
+    s.in_channels = static_cast<std::size_t>(params_.in_channels);
+    s.in_h = in_h;
+    s.in_w = in_w;
+    s.out_channels = static_cast<std::size_t>(params_.out_channels);
+    s.kernel_h = static_cast<std::size_t>(params_.kernel_h);
+    s.kernel_w = static_cast<std::size_t>(params_.kernel_w);
+    s.stride_h = static_cast<std::size_t>(params_.stride_h);
+    s.stride_w = static_cast<std::size_t>(params_.stride_w);
+    s.pad_top = static_cast<std::size_t>(params_.pad_top);
+    s.pad_left = static_cast<std::size_t>(params_.pad_left);
+    s.pad_bottom = static_cast<std::size_t>(params_.pad_bottom);
+    s.pad_right = static_cast<std::size_t>(params_.pad_right);
+    s.dilation_h = static_cast<std::size_t>(params_.dilation_h);
+    s.dilation_w = static_cast<std::size_t>(params_.dilation_w);
+    s.groups = static_cast<std::size_t>(params_.groups);
+    return s;
+}
+
+Conv2dShape Conv2dOp::inputConvShape() const {
+    const Shape& in = inputs()[0]->shape();
+    const std::size_t rank = channel_block_ == 0 ? 4 : 5;
+    if (in.rank() != rank) {
+        throw std::invalid_argument("Conv2dOp: expected a " +
+                                    std::string(channel_block_ == 0 ? "[N, C, H, W]" : "[N, C/block, H, W, block]") +
+                                    " input, got " + inference_engine::core::shape_to_string(in));
+    }
+    return convShape(static_cast<std::size_t>(in.dim(0)), static_cast<std::size_t>(in.dim(2)),
+                     static_cast<std::size_t>(in.dim(3)));
+}
+
+Shape Conv2dOp::outputShape(const Conv2dShape& s) const {
+    const auto n = static_cast<std::int64_t>(s.batch);
+    const auto oh = static_cast<std::int64_t>(s.out_h());
+    const auto ow = static_cast<std::int64_t>(s.out_w());
+    if (channel_block_ == 0) return Shape({n, params_.out_channels, oh, ow});
+    const auto blocks = static_cast<std::int64_t>(ceilDiv(s.out_channels, channel_block_));
+    return Shape({n, blocks, oh, ow, static_cast<std::int64_t>(channel_block_)});
+}
+
+void Conv2dOp::validate() const {
+    Operator::validate();
+    if (inputs().size() != 1 || outputs().size() != 1) {
+        throw std::invalid_argument("Conv2dOp expects 1 input and 1 output");
+    }
+    const Conv2dParams& p = params_;
+    if (p.groups <= 0 || p.in_channels % p.groups != 0 || p.out_channels % p.groups != 0 || p.stride_h <= 0 ||
+        p.stride_w <= 0 || p.dilation_h <= 0 || p.dilation_w <= 0 || p.pad_top < 0 || p.pad_left < 0 ||
+        p.pad_bottom < 0 || p.pad_right < 0) {
+        throw std::invalid_argument("Conv2dOp: invalid strides, pads, dilations or group");
+    }
+    if (weights_.size() != static_cast<std::size_t>(p.out_channels * (p.in_channels / p.groups) * p.kernel_h *
+                                                    p.kernel_w)) {
+        throw std::invalid_argument("Conv2dOp: weight size does not match the group count");
+    }
+
+    const Conv2dShape s = inputConvShape();
+    const Shape& in = inputs()[0]->shape();
+    if (channel_block_ == 0) {
+        if (in.dim(1) != p.in_channels) throw std::invalid_argument("Conv2dOp: input channel count mismatch");
+    } else {
+        if (channel_block_ != conv_channel_block()) {
+            throw std::invalid_argument("Conv2dOp: channel block " + std::to_string(channel_block_) +
+                                        " is not the host's NCHWc block " + std::to_string(conv_channel_block()));
+        }
+        if (static_cast<std::size_t>(in.dim(1)) != ceilDiv(s.in_channels, channel_block_) ||
+            static_cast<std::size_t>(in.dim(4)) != channel_block_) {
+            throw std::invalid_argument("Conv2dOp: blocked input shape mismatch");
+        }
+        if (algorithm_ != ConvAlgorithm::Auto && algorithm_ != ConvAlgorithm::DirectNchwc) {
+            throw std::invalid_argument("Conv2dOp: the blocked layout needs the direct_nchwc algorithm");
+        }
+    }
+    if (s.out_h() == 0 || s.out_w() == 0) {
+        throw std::invalid_argument("Conv2dOp: kernel does not fit the padded input");
+    }
+    if (outputs()[0]->shape() != outputShape(s)) {
+        throw std::invalid_argument("Conv2dOp: output shape mismatch");
+    }
+    const ConvAlgorithm algorithm = resolveAlgorithm();
+    if (!conv_algorithm_supports(algorithm, s)) {
+        throw std::invalid_argument(std::string("Conv2dOp: ") + conv_algorithm_name(algorithm) +
+                                    " cannot compute this convolution");
+    }
+}
+
+void Conv2dOp::inferShapes() {
+    if (inputs().size() != 1 || outputs().size() != 1 || inputs()[0] == nullptr || outputs()[0] == nullptr) {
+        throw std::invalid_argument(type() + ": cannot infer shapes without an input and an output");
+    }
+    outputs()[0]->setShape(outputShape(inputConvShape()));
+}
+
+std::size_t Conv2dOp::estimateMemoryBytes() const noexcept {
+    return (weights_.size() + bias_.size()) * sizeof(float);
+}
+
+std::uint64_t Conv2dOp::estimateFlops() const noexcept {
+    if (inputs().size() != 1 || inputs()[0] == nullptr) return 0;
+    const Shape& in = inputs()[0]->shape();
+    if (in.rank() != (channel_block_ == 0 ? 4u : 5u)) return 0;
+    const Conv2dShape s = convShape(static_cast<std::size_t>(in.dim(0)), static_cast<std::size_t>(in.dim(2)),
+                                    static_cast<std::size_t>(in.dim(3)));
+    const std::uint64_t macs_per_output = s.in_channels / s.groups * s.kernel_h * s.kernel_w;
+    return static_cast<std::uint64_t>(s.batch * s.out_channels * s.out_h() * s.out_w()) * (2 * macs_per_output + 1);
+}
+
+ConvAlgorithm Conv2dOp::resolveAlgorithm() const {
+    if (channel_block_ != 0) return ConvAlgorithm::DirectNchwc;
+    if (algorithm_ != ConvAlgorithm::Auto) return algorithm_;
+    return select_conv_algorithm(inputConvShape(), false);
+}
+
+void Conv2dOp::pack(ConvAlgorithm algorithm, PackedWeightCache* cache, WeightStore* store, const std::string& key) {
+    if (packed_algorithm_ == algorithm) return;
+    const Conv2dShape s = inputConvShape();
+    const std::size_t size = packed_conv_weights_size(algorithm, s);
+    if (size == 0) {
+        packed_ = {};
+        packed_algorithm_ = algorithm;
+        return;
+    }
+    const std::string blob_key = key + "/Conv2d/" + conv_algorithm_name(algorithm) + "/" +
+                                 std::to_string(s.out_channels) + "x" + std::to_string(s.in_channels) + "x" +
+                                 std::to_string(s.kernel_h) + "x" + std::to_string(s.kernel_w) + "/b" +
+                                 std::to_string(conv_channel_block());
+    PackedWeightCache::Blob blob{};
+    if (cache != nullptr) blob = cache->find(blob_key, size * sizeof(float));
+    if (blob.data == nullptr) {
+        std::vector<float> packed(size);
+        pack_conv_weights(algorithm, s, weights_.data(), packed.data());
+        if (cache != nullptr) {
+            blob = cache->insert(blob_key, packed.data(), size * sizeof(float));
+        } else if (store != nullptr) {
+            packed_ = WeightBuffer<float>::shared(store->intern(packed.data(), size * sizeof(float)));
+        } else {
+            packed_ = WeightBuffer<float>(std::move(packed));
+        }
+    }
+    if (blob.data != nullptr) packed_ = WeightBuffer<float>::view(static_cast<const float*>(blob.data), size);
+    packed_algorithm_ = algorithm;
+}
+
+void Conv2dOp::prepackWeights(PackedWeightCache* cache, WeightStore* store, const std::string& key) {
+    pack(resolveAlgorithm(), cache, store, key);
+}
+
+void Conv2dOp::prepare() {
+    resolved_ = resolveAlgorithm();
+    pack(resolved_, nullptr, nullptr, std::string());
+}
+
+void Conv2dOp::execute() {
+    if (resolved_ == ConvAlgorithm::Auto) throw std::runtime_error("Conv2dOp: execute() before prepare()");
+    const Tensor& input = ops_detail::requireFp32Input(inputs()[0], "Conv2dOp");
+    const Conv2dShape s = inputConvShape();
+    Tensor& output = ops_detail::bindOutputTensor(outputs()[0], outputShape(s), output_buf_, output_tensor_);
+
+    Conv2dArgs args;
+    args.x = input.data_as<float>();
+    args.w = packed_.empty() ? weights_.data() : packed_.data();
+    args.bias = bias_.empty() ? nullptr : bias_.data();
+    args.y = output.data_as<float>();
+    args.shape = s;
+    args.algorithm = resolved_;
+    args.activation = activation_;
+    conv2d(args);
+}
+
+std::unique_ptr<Operator> Conv2dOp::clone() const {
+    return std::make_unique<Conv2dOp>(*this);
+}
+
+} // namespace infer
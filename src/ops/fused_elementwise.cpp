@@ -0,0 +1,76 @@
+#include "inference_engine/ops/fused_elementwise.h"
+
+#include "inference_engine/graph/value.h"
+#include "op_utils.h"
+
+#include <stdexcept>
+
+namespace infer {
+
+using inference_engine::core::Tensor;
+
+const char* elementwiseKindName(ElementwiseKind kind) noexcept {
+    switch (kind) {
+    case ElementwiseKind::ReLU: return "ReLU";
+    case ElementwiseKind::Sigmoid: return "Sigmoid";
+    case ElementwiseKind::Tanh: return "Tanh";
+    case ElementwiseKind::GELU: return "GELU";
+    }
+    return "?";
+}
+
+void applyElementwise(ElementwiseKind kind, const float* x, float* y, std::size_t n) {
+    elementwise_unary(&kind, 1, x, y, n);
+}
+
+std::optional<std::vector<ElementwiseKind>> elementwiseSteps(const Operator& op) {
+    if (const auto* fused = dynamic_cast<const FusedElementwiseOp*>(&op)) return fused->steps();
+    const std::string& type = op.type();
+    if (type == "ReLU") return std::vector<ElementwiseKind>{ElementwiseKind::ReLU};
+    if (type == "Sigmoid") return std::vector<ElementwiseKind>{ElementwiseKind::Sigmoid};
+    if (type == "Tanh") return std::vector<ElementwiseKind>{ElementwiseKind::Tanh};
+    if (type == "GELU") return std::vector<ElementwiseKind>{ElementwiseKind::GELU};
+    return std::nullopt;
+}
+
+FusedElementwiseOp::FusedElementwiseOp(std::vector<ElementwiseKind> steps)
+    : Operator("FusedElementwise"), steps_(std::move(steps)) {
+    if (steps_.empty()) {
+        throw std::invalid_argument("FusedElementwiseOp: at least one step is required");
+    }
+}
+
+std::uint64_t FusedElementwiseOp::estimateFlops() const noexcept {
+    std::uint64_t per_element = 0;
+    for (ElementwiseKind kind : steps_) {
+        per_element += kind == ElementwiseKind::ReLU ? 1 : 4;
+    }
+    return per_element * ops_detail::outputElements(*this);
+}
+
+void FusedElementwiseOp::inferShapes() {
+    ops_detail::inferSameShape(*this);
+}
+
+void FusedElementwiseOp::validate() const {
+    Operator::validate();
+    if (inputs().size() != 1 || outputs().size() != 1) {
+        throw std::invalid_argument("FusedElementwise expects 1 input and 1 output");
+    }
+}
+
+void FusedElementwiseOp::execute() {
+    const Value* in_val = inputs()[0];
+    Value* out_val = outputs()[0];
+    const Tensor& input = ops_detail::requireFp32Input(in_val, "FusedElementwise");
+
+    Tensor& output = ops_detail::bindOutputTensor(out_val, in_val->shape(), output_buf_, output_tensor_);
+    elementwise_unary(steps_.data(), steps_.size(), input.data_as<float>(), output.data_as<float>(),
+                      static_cast<std::size_t>(input.num_elements()));
+}
+
+std::unique_ptr<Operator> FusedElementwiseOp::clone() const {
+    return std::make_unique<FusedElementwiseOp>(*this);
+}
+
+} // namespace infer
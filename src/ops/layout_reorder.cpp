@@ -0,0 +1,72 @@
+#include "inference_engine/ops/layout_reorder.h"
+
+#include "inference_engine/graph/value.h"
+#include "inference_engine/kernels/conv.h"
+#include "op_utils.h"
+
+#include <stdexcept>
+
+namespace infer {
+
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+
+LayoutReorderOp::LayoutReorderOp(Direction direction, std::size_t block, std::int64_t channels)
+    : Operator("LayoutReorder"), direction_(direction), block_(block), channels_(channels) {
+    if (block_ == 0 || channels_ <= 0) {
+        throw std::invalid_argument("LayoutReorderOp: block and channels must be positive");
+    }
+}
+
+Shape LayoutReorderOp::outputShape(const Shape& in) const {
+    const auto block = static_cast<std::int64_t>(block_);
+    if (direction_ == Direction::ToBlocked) {
+        if (in.rank() != 4 || in.dim(1) != channels_) {
+            throw std::invalid_argument("LayoutReorderOp: expected [N, " + std::to_string(channels_) +
+                                        ", H, W] input, got " + inference_engine::core::shape_to_string(in));
+        }
+        return Shape({in.dim(0), (channels_ + block - 1) / block, in.dim(2), in.dim(3), block});
+    }
+    if (in.rank() != 5 || in.dim(1) != (channels_ + block - 1) / block || in.dim(4) != block) {
+        throw std::invalid_argument("LayoutReorderOp: expected blocked input for " + std::to_string(channels_) +
+                                    " channels, got " + inference_engine::core::shape_to_string(in));
+    }
+    return Shape({in.dim(0), channels_, in.dim(2), in.dim(3)});
+}
+
+void LayoutReorderOp::validate() const {
+    Operator::validate();
+    if (inputs().size() != 1 || outputs().size() != 1) {
+        throw std::invalid_argument("LayoutReorderOp expects 1 input and 1 output");
+    }
+    if (outputs()[0]->shape() != outputShape(inputs()[0]->shape())) {
+        throw std::invalid_argument("LayoutReorderOp: output shape mismatch");
+    }
+}
+
+void LayoutReorderOp::inferShapes() {
+    if (inputs().size() != 1 || outputs().size() != 1 || inputs()[0] == nullptr || outputs()[0] == nullptr) {
+        throw std::invalid_argument(type() + ": cannot infer shapes without an input and an output");
+    }
+    outputs()[0]->setShape(outputShape(inputs()[0]->shape()));
+}
+
+void LayoutReorderOp::execute() {
+    const Tensor& input = ops_detail::requireFp32Input(inputs()[0], "LayoutReorderOp");
+    const Shape& in = inputs()[0]->shape();
+    Tensor& output = ops_detail::bindOutputTensor(outputs()[0], outputShape(in), output_buf_, output_tensor_);
+    const auto batch = static_cast<std::size_t>(in.dim(0));
+    const auto spatial = static_cast<std::size_t>(in.dim(2) * in.dim(3));
+    const auto channels = static_cast<std::size_t>(channels_);
+    if (direction_ == Direction::ToBlocked) {
+        nchw_to_nchwc(input.data_as<float>(), output.data_as<float>(), batch, channels, spatial, block_);
+    } else {
+        nchwc_to_nchw(input.data_as<float>(), output.data_as<float>(), batch, channels, spatial, block_);
+    }
+}
+
+std::unique_ptr<Operator> LayoutReorderOp::clone() const {
+    return std::make_unique<LayoutReorderOp>(*this);
+}
+
+} // namespace infer
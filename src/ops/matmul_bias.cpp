@@ -0,0 +1,158 @@
+#include "inference_engine/ops/matmul_bias.h"
+
+#include "inference_engine/graph/packed_weight_cache.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/graph/weight_store.h"
+#include "op_utils.h"
+
+#include <stdexcept>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+
+MatMulBiasOp::MatMulBiasOp(std::int64_t in_dim, std::int64_t out_dim, WeightBuffer<float> weights,
+                           WeightBuffer<float> bias, Activation activation)
+    : Operator("MatMulBias"),
+      in_dim_(in_dim),
+      out_dim_(out_dim),
+      weights_(std::move(weights)),
+      bias_(std::move(bias)),
+      activation_(activation) {
+    if (weights_.size() != static_cast<std::size_t>(in_dim_ * out_dim_)) {
+        throw std::invalid_argument("MatMulBiasOp: weight size mismatch");
+    }
+    if (bias_.size() != static_cast<std::size_t>(out_dim_)) {
+        throw std::invalid_argument("MatMulBiasOp: bias size mismatch");
+    }
+}
+
+void MatMulBiasOp::inferShapes() {
+    ops_detail::inferDenseShape(*this, out_dim_);
+}
+
+void MatMulBiasOp::validate() const {
+    Operator::validate();
+    if (inputs().size() != 1 || outputs().size() != 1) {
+        throw std::invalid_argument("MatMulBiasOp expects 1 input and 1 output");
+    }
+    const auto& s = inputs()[0]->shape();
+    if (s.rank() != 2 || s.dim(1) != in_dim_) {
+        throw std::invalid_argument("MatMulBiasOp: expected [batch, in_dim] input shape");
+    }
+}
+
+std::uint64_t MatMulBiasOp::estimateFlops() const noexcept {
+    return ops_detail::denseFlops(*this, in_dim_);
+}
+
+std::size_t MatMulBiasOp::estimateMemoryBytes() const noexcept {
+    // One layout of the weights is read per call (panel padding aside).
+    return (static_cast<std::size_t>(in_dim_ * out_dim_) + bias_.size()) * sizeof(float);
+}
+
+void MatMulBiasOp::prepackWeights(PackedWeightCache* cache, WeightStore* store, const std::string& key) {
+    const std::size_t panel = linear_packed_panel();
+    if (!packed_.empty() && packed_panel_ == panel) return;
+    const std::size_t k = static_cast<std::size_t>(in_dim_);
+    const std::size_t n = static_cast<std::size_t>(out_dim_);
+    const std::size_t size = packed_linear_size(k, n, panel);
+    if (size == 0) return;
+
+    const std::string blob_key =
+        key + "/MatMulBias/" + std::to_string(k) + "x" + std::to_string(n) + "/p" + std::to_string(panel);
+    PackedWeightCache::Blob blob{};
+    if (cache != nullptr) blob = cache->find(blob_key, size * sizeof(float));
+    if (blob.data == nullptr) {
+        std::vector<float> packed(size);
+        if (weights_.empty()) {
+            const std::vector<float> w = rowMajorWeights();
+            pack_linear_weights(w.data(), n, k, n, panel, packed.data());
+        } else {
+            pack_linear_weights(weights_.data(), n, k, n, panel, packed.data());
+        }
+        if (cache != nullptr) {
+            blob = cache->insert(blob_key, packed.data(), size * sizeof(float));
+        } else if (store != nullptr) {
+            packed_ = WeightBuffer<float>::shared(store->intern(packed.data(), size * sizeof(float)));
+        } else {
+            packed_ = WeightBuffer<float>(std::move(packed));
+        }
+    }
+    if (blob.data != nullptr) packed_ = WeightBuffer<float>::view(static_cast<const float*>(blob.data), size);
+    packed_panel_ = panel;
+    // A view costs nothing to keep (and its file outlives the op); an owned copy does.
+    if (!weights_.isView()) weights_ = {};
+}
+
+std::vector<float> MatMulBiasOp::rowMajorWeights() const {
+    if (!weights_.empty() || packed_.empty()) return std::vector<float>(weights_.begin(), weights_.end());
+    const std::size_t k = static_cast<std::size_t>(in_dim_);
+    const std::size_t n = static_cast<std::size_t>(out_dim_);
+    std::vector<float> w(k * n);
+    for (std::size_t p = 0; p < k; ++p) {
+        for (std::size_t j = 0; j < n; ++j) {
+            w[p * n + j] = packed_[(j / packed_panel_ * k + p) * packed_panel_ + j % packed_panel_];
+        }
+    }
+    return w;
+}
+
+void MatMulBiasOp::execute() {
+    const Value* in_val = inputs()[0];
+    Value* out_val = outputs()[0];
+    const Tensor& input = ops_detail::requireFp32Input(in_val, "MatMulBiasOp");
+
+    const std::int64_t batch = in_val->shape().dim(0);
+    const float* x = input.data_as<float>();
+    Tensor& output = ops_detail::bindOutputTensor(out_val, Shape({batch, out_dim_}), output_buf_, output_tensor_);
+    float* y = output.data_as<float>();
+
+    const std::size_t m = static_cast<std::size_t>(batch);
+    const std::size_t k = static_cast<std::size_t>(in_dim_);
+    const std::size_t n = static_cast<std::size_t>(out_dim_);
+    if (!packed_.empty()) {
+        ops_detail::forEachLinearTile(
+            m, k, n,
+            [&](std::size_t row0, std::size_t rows, std::size_t col0, std::size_t cols) {
+                LinearPackedArgs args;
+                args.x = x + row0 * k;
+                args.ldx = k;
+                args.w = packed_.data() + col0 * k;
+                args.panel = packed_panel_;
+                args.bias = bias_.data() + col0;
+                args.y = y + row0 * n + col0;
+                args.ldy = n;
+                args.m = rows;
+                args.k = k;
+                args.n = cols;
+                args.activation = activation_;
+                linear_packed(args);
+            },
+            packed_panel_);
+        return;
+    }
+    ops_detail::forEachLinearTile(m, k, n, [&](std::size_t row0, std::size_t rows, std::size_t col0, std::size_t cols) {
+        LinearArgs args;
+        args.x = x + row0 * k;
+        args.ldx = k;
+        args.w = weights_.data() + col0;
+        args.ldw = n;
+        args.bias = bias_.data() + col0;
+        args.y = y + row0 * n + col0;
+        args.ldy = n;
+        args.m = rows;
+        args.k = k;
+        args.n = cols;
+        args.activation = activation_;
+        linear(args);
+    });
+}
+
+std::unique_ptr<Operator> MatMulBiasOp::clone() const {
+    return std::make_unique<MatMulBiasOp>(*this);
+}
+
+} // namespace infer
@@ -0,0 +1,155 @@
+#include "inference_engine/ops/matmul_bias_blockq.h"
+
+#include "inference_engine/graph/value.h"
+#include "op_utils.h"
+
+#include <stdexcept>
+
+namespace infer {
+
+using inference_engine::core::Half;
+using inference_engine::core::QuantizationParams;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+
+MatMulBiasBlockQOp::MatMulBiasBlockQOp(std::int64_t in_dim, std::int64_t out_dim, int bits, std::int64_t group_size,
+                                       WeightBuffer<std::uint8_t> packed_weights,
+                                       WeightBuffer<Half> packed_scales, WeightBuffer<float> bias,
+                                       Activation activation)
+    : Operator("MatMulBiasBlockQ"),
+      in_dim_(in_dim),
+      out_dim_(out_dim),
+      bits_(bits),
+      group_size_(group_size),
+      weights_(std::move(packed_weights)),
+      scales_(std::move(packed_scales)),
+      bias_(std::move(bias)),
+      activation_(activation) {
+    if (bits_ != 4 && bits_ != 8) {
+        throw std::invalid_argument("MatMulBiasBlockQOp: bits must be 4 or 8");
+    }
+    if (in_dim_ <= 0 || out_dim_ <= 0 || group_size_ <= 0 || in_dim_ % group_size_ != 0) {
+        throw std::invalid_argument("MatMulBiasBlockQOp: group_size must divide in_dim");
+    }
+    const auto k = static_cast<std::size_t>(in_dim_);
+    const auto n = static_cast<std::size_t>(out_dim_);
+    if (weights_.size() != blockq_weight_bytes(k, n, bits_)) {
+        throw std::invalid_argument("MatMulBiasBlockQOp: packed weight size mismatch");
+    }
+    if (scales_.size() != blockq_scale_count(k, n, static_cast<std::size_t>(group_size_))) {
+        throw std::invalid_argument("MatMulBiasBlockQOp: packed scale count mismatch");
+    }
+    if (bias_.size() != n) {
+        throw std::invalid_argument("MatMulBiasBlockQOp: bias size mismatch");
+    }
+}
+
+std::unique_ptr<MatMulBiasBlockQOp> MatMulBiasBlockQOp::fromFloat(std::int64_t in_dim, std::int64_t out_dim,
+                                                                  const std::vector<float>& weights,
+                                                                  std::vector<float> bias, int bits,
+                                                                  std::int64_t group_size, Activation activation) {
+    const auto k = static_cast<std::size_t>(in_dim);
+    const auto n = static_cast<std::size_t>(out_dim);
+    if (weights.size() != k * n) {
+        throw std::invalid_argument("MatMulBiasBlockQOp: weight size mismatch");
+    }
+    if (group_size <= 0 || in_dim % group_size != 0) {
+        throw std::invalid_argument("MatMulBiasBlockQOp: group_size must divide in_dim");
+    }
+    const std::vector<std::int64_t> dims = {in_dim, out_dim};
+    const QuantizationParams qp = inference_engine::core::calculate_group_quant_params(
+        weights.data(), dims, 0, static_cast<std::int32_t>(group_size), bits);
+    std::vector<std::int8_t> q(k * n);
+    inference_engine::core::quantize_buffer_grouped(weights.data(), q.data(), dims, qp);
+
+    const auto group = static_cast<std::size_t>(group_size);
+    std::vector<std::uint8_t> packed(blockq_weight_bytes(k, n, bits));
+    std::vector<Half> scales(blockq_scale_count(k, n, group));
+    pack_blockq_weights(q.data(), qp.group_scales.data(), k, n, bits, group, packed.data(), scales.data());
+    return std::make_unique<MatMulBiasBlockQOp>(in_dim, out_dim, bits, group_size, std::move(packed),
+                                                std::move(scales), std::move(bias), activation);
+}
+
+QuantizationParams MatMulBiasBlockQOp::weightQuantization() const {
+    const auto n = static_cast<std::size_t>(out_dim_);
+    const auto groups = static_cast<std::size_t>(in_dim_ / group_size_);
+    QuantizationParams qp;
+    qp.axis = 0;
+    qp.symmetric = true;
+    qp.group_size = static_cast<std::int32_t>(group_size_);
+    qp.bits = bits_;
+    qp.group_scales.resize(groups * n);
+    for (std::size_t g = 0; g < groups; ++g) {
+        for (std::size_t j = 0; j < n; ++j) {
+            qp.group_scales[g * n + j] = scales_[(j / kBlockQPanel * groups + g) * kBlockQPanel + j % kBlockQPanel];
+        }
+    }
+    return qp;
+}
+
+void MatMulBiasBlockQOp::inferShapes() {
+    ops_detail::inferDenseShape(*this, out_dim_);
+}
+
+void MatMulBiasBlockQOp::validate() const {
+    Operator::validate();
+    if (inputs().size() != 1 || outputs().size() != 1) {
+        throw std::invalid_argument("MatMulBiasBlockQOp expects 1 input and 1 output");
+    }
+    const auto& s = inputs()[0]->shape();
+    if (s.rank() != 2 || s.dim(1) != in_dim_) {
+        throw std::invalid_argument("MatMulBiasBlockQOp: expected [batch, in_dim] input shape");
+    }
+}
+
+std::uint64_t MatMulBiasBlockQOp::estimateFlops() const noexcept {
+    return ops_detail::denseFlops(*this, in_dim_);
+}
+
+std::size_t MatMulBiasBlockQOp::estimateMemoryBytes() const noexcept {
+    return weights_.size() + scales_.size() * sizeof(Half) + bias_.size() * sizeof(float);
+}
+
+void MatMulBiasBlockQOp::execute() {
+    const Value* in_val = inputs()[0];
+    Value* out_val = outputs()[0];
+    const Tensor& input = ops_detail::requireFp32Input(in_val, "MatMulBiasBlockQOp");
+
+    const std::int64_t batch = in_val->shape().dim(0);
+    const float* x = input.data_as<float>();
+    Tensor& output = ops_detail::bindOutputTensor(out_val, Shape({batch, out_dim_}), output_buf_, output_tensor_);
+    float* y = output.data_as<float>();
+    const auto* scales = reinterpret_cast<const std::uint16_t*>(scales_.data());
+
+    const std::size_t m = static_cast<std::size_t>(batch);
+    const std::size_t k = static_cast<std::size_t>(in_dim_);
+    const std::size_t n = static_cast<std::size_t>(out_dim_);
+    const std::size_t group = static_cast<std::size_t>(group_size_);
+    const std::size_t panel_bytes = blockq_weight_bytes(k, kBlockQPanel, bits_);
+    ops_detail::forEachLinearTile(
+        m, k, n,
+        [&](std::size_t row0, std::size_t rows, std::size_t col0, std::size_t cols) {
+            LinearBlockQArgs args;
+            args.x = x + row0 * k;
+            args.ldx = k;
+            args.w = weights_.data() + col0 / kBlockQPanel * panel_bytes;
+            args.scales = scales + col0 * (k / group);
+            args.bits = bits_;
+            args.group = group;
+            args.bias = bias_.data() + col0;
+            args.y = y + row0 * n + col0;
+            args.ldy = n;
+            args.m = rows;
+            args.k = k;
+            args.n = cols;
+            args.activation = activation_;
+            linear_blockq(args);
+        },
+        kBlockQPanel);
+}
+
+std::unique_ptr<Operator> MatMulBiasBlockQOp::clone() const {
+    return std::make_unique<MatMulBiasBlockQOp>(*this);
+}
+
+} // namespace infer
@@ -0,0 +1,97 @@
+#include "inference_engine/ops/matmul_bias_fp16.h"
+
+#include "inference_engine/core/dtype.h"
+#include "inference_engine/graph/value.h"
+#include "op_utils.h"
+
+#include <stdexcept>
+
+namespace infer {
+
+using inference_engine::core::Half;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+
+MatMulBiasFp16Op::MatMulBiasFp16Op(std::int64_t in_dim, std::int64_t out_dim, WeightBuffer<Half> weights,
+                                   WeightBuffer<float> bias, Activation activation)
+    : Operator("MatMulBiasFp16"),
+      in_dim_(in_dim),
+      out_dim_(out_dim),
+      weights_(std::move(weights)),
+      bias_(std::move(bias)),
+      activation_(activation) {
+    if (weights_.size() != static_cast<std::size_t>(in_dim_ * out_dim_)) {
+        throw std::invalid_argument("MatMulBiasFp16Op: weight size mismatch");
+    }
+    if (bias_.size() != static_cast<std::size_t>(out_dim_)) {
+        throw std::invalid_argument("MatMulBiasFp16Op: bias size mismatch");
+    }
+}
+
+std::unique_ptr<MatMulBiasFp16Op> MatMulBiasFp16Op::fromFloat(std::int64_t in_dim, std::int64_t out_dim,
+                                                              const std::vector<float>& weights,
+                                                              std::vector<float> bias, Activation activation) {
+    std::vector<Half> half(weights.size());
+    inference_engine::core::convert_fp32_to_fp16(weights.data(), half.data(), weights.size());
+    return std::make_unique<MatMulBiasFp16Op>(in_dim, out_dim, std::move(half), std::move(bias), activation);
+}
+
+void MatMulBiasFp16Op::inferShapes() {
+    ops_detail::inferDenseShape(*this, out_dim_);
+}
+
+void MatMulBiasFp16Op::validate() const {
+    Operator::validate();
+    if (inputs().size() != 1 || outputs().size() != 1) {
+        throw std::invalid_argument("MatMulBiasFp16Op expects 1 input and 1 output");
+    }
+    const auto& s = inputs()[0]->shape();
+    if (s.rank() != 2 || s.dim(1) != in_dim_) {
+        throw std::invalid_argument("MatMulBiasFp16Op: expected [batch, in_dim] input shape");
+    }
+}
+
+std::uint64_t MatMulBiasFp16Op::estimateFlops() const noexcept {
+    return ops_detail::denseFlops(*this, in_dim_);
+}
+
+std::size_t MatMulBiasFp16Op::estimateMemoryBytes() const noexcept {
+    return weights_.size() * sizeof(Half) + bias_.size() * sizeof(float);
+}
+
+void MatMulBiasFp16Op::execute() {
+    const Value* in_val = inputs()[0];
+    Value* out_val = outputs()[0];
+    const Tensor& input = ops_detail::requireFp32Input(in_val, "MatMulBiasFp16Op");
+
+    const std::int64_t batch = in_val->shape().dim(0);
+    const float* x = input.data_as<float>();
+    Tensor& output = ops_detail::bindOutputTensor(out_val, Shape({batch, out_dim_}), output_buf_, output_tensor_);
+    float* y = output.data_as<float>();
+    const auto* w = reinterpret_cast<const std::uint16_t*>(weights_.data());
+
+    const std::size_t m = static_cast<std::size_t>(batch);
+    const std::size_t k = static_cast<std::size_t>(in_dim_);
+    const std::size_t n = static_cast<std::size_t>(out_dim_);
+    ops_detail::forEachLinearTile(m, k, n, [&](std::size_t row0, std::size_t rows, std::size_t col0, std::size_t cols) {
+        LinearFp16Args args;
+        args.x = x + row0 * k;
+        args.ldx = k;
+        args.w = w + col0;
+        args.ldw = n;
+        args.bias = bias_.data() + col0;
+        args.y = y + row0 * n + col0;
+        args.ldy = n;
+        args.m = rows;
+        args.k = k;
+        args.n = cols;
+        args.activation = activation_;
+        linear_fp16(args);
+    });
+}
+
+std::unique_ptr<Operator> MatMulBiasFp16Op::clone() const {
+    return std::make_unique<MatMulBiasFp16Op>(*this);
+}
+
+} // namespace infer
@@ -0,0 +1,160 @@
+#include "inference_engine/ops/matmul_bias_sparse.h"
+
+#include "inference_engine/graph/value.h"
+#include "op_utils.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace infer {
+
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+
+MatMulBiasSparseOp::MatMulBiasSparseOp(std::int64_t in_dim, std::int64_t out_dim, SparsePattern pattern,
+                                       WeightBuffer<float> values, WeightBuffer<std::uint8_t> indices,
+                                       WeightBuffer<std::uint32_t> row_ptr, WeightBuffer<std::uint32_t> col_idx,
+                                       WeightBuffer<float> bias, Activation activation)
+    : Operator("MatMulBiasSparse"),
+      in_dim_(in_dim),
+      out_dim_(out_dim),
+      pattern_(pattern),
+      values_(std::move(values)),
+      indices_(std::move(indices)),
+      row_ptr_(std::move(row_ptr)),
+      col_idx_(std::move(col_idx)),
+      bias_(std::move(bias)),
+      activation_(activation) {
+    if (in_dim_ <= 0 || out_dim_ <= 0) {
+        throw std::invalid_argument("MatMulBiasSparseOp: dimensions must be positive");
+    }
+    const auto k = static_cast<std::size_t>(in_dim_);
+    const auto n = static_cast<std::size_t>(out_dim_);
+    if (!sparse_pattern_supported(pattern_, k)) {
+        throw std::invalid_argument("MatMulBiasSparseOp: unsupported pattern " + sparse_pattern_name(pattern_) +
+                                    " for in_dim " + std::to_string(in_dim_));
+    }
+    if (bias_.size() != n) {
+        throw std::invalid_argument("MatMulBiasSparseOp: bias size mismatch");
+    }
+    if (pattern_.format == SparseFormat::NM) {
+        const std::size_t count = sparse_nm_value_count(k, n, pattern_);
+        if (values_.size() != count || indices_.size() != count || !row_ptr_.empty() || !col_idx_.empty()) {
+            throw std::invalid_argument("MatMulBiasSparseOp: packed N:M size mismatch");
+        }
+        if (std::any_of(indices_.begin(), indices_.end(), [this](std::uint8_t i) { return i >= pattern_.m; })) {
+            throw std::invalid_argument("MatMulBiasSparseOp: N:M index out of range");
+        }
+        return;
+    }
+    const std::size_t block_rows = sparse_block_rows(n, pattern_);
+    if (row_ptr_.size() != block_rows + 1 || row_ptr_[0] != 0 || row_ptr_[block_rows] != col_idx_.size() ||
+        values_.size() != col_idx_.size() * pattern_.block_out * pattern_.block_in || !indices_.empty()) {
+        throw std::invalid_argument("MatMulBiasSparseOp: packed block-CSR size mismatch");
+    }
+    if (!std::is_sorted(row_ptr_.begin(), row_ptr_.end())) {
+        throw std::invalid_argument("MatMulBiasSparseOp: block-CSR row pointers decrease");
+    }
+    const std::size_t in_blocks = k / pattern_.block_in;
+    if (std::any_of(col_idx_.begin(), col_idx_.end(), [in_blocks](std::uint32_t c) { return c >= in_blocks; })) {
+        throw std::invalid_argument("MatMulBiasSparseOp: block-CSR column index out of range");
+    }
+}
+
+std::unique_ptr<MatMulBiasSparseOp> MatMulBiasSparseOp::fromFloat(std::int64_t in_dim, std::int64_t out_dim,
+                                                                  const float* weights, WeightBuffer<float> bias,
+                                                                  const SparsePattern& pattern,
+                                                                  Activation activation) {
+    if (in_dim <= 0 || out_dim <= 0) {
+        throw std::invalid_argument("MatMulBiasSparseOp: dimensions must be positive");
+    }
+    SparseWeights packed = pack_sparse_weights(weights, static_cast<std::size_t>(in_dim),
+                                               static_cast<std::size_t>(out_dim), pattern);
+    return std::make_unique<MatMulBiasSparseOp>(in_dim, out_dim, pattern, std::move(packed.values),
+                                                std::move(packed.indices), std::move(packed.row_ptr),
+                                                std::move(packed.col_idx), std::move(bias), activation);
+}
+
+std::size_t MatMulBiasSparseOp::storedWeights() const noexcept {
+    if (pattern_.format == SparseFormat::NM) {
+        return static_cast<std::size_t>(in_dim_) / pattern_.m * pattern_.n * static_cast<std::size_t>(out_dim_);
+    }
+    return col_idx_.size() * pattern_.block_out * pattern_.block_in;
+}
+
+std::vector<float> MatMulBiasSparseOp::rowMajorWeights() const {
+    return unpack_sparse_weights(pattern_, static_cast<std::size_t>(in_dim_), static_cast<std::size_t>(out_dim_),
+                                 values_.data(), indices_.data(), row_ptr_.data(), col_idx_.data());
+}
+
+void MatMulBiasSparseOp::inferShapes() {
+    ops_detail::inferDenseShape(*this, out_dim_);
+}
+
+void MatMulBiasSparseOp::validate() const {
+    Operator::validate();
+    if (inputs().size() != 1 || outputs().size() != 1) {
+        throw std::invalid_argument("MatMulBiasSparseOp expects 1 input and 1 output");
+    }
+    const auto& s = inputs()[0]->shape();
+    if (s.rank() != 2 || s.dim(1) != in_dim_) {
+        throw std::invalid_argument("MatMulBiasSparseOp: expected [batch, in_dim] input shape");
+    }
+}
+
+std::uint64_t MatMulBiasSparseOp::estimateFlops() const noexcept {
+    const std::uint64_t rows = ops_detail::outputElements(*this) / static_cast<std::uint64_t>(out_dim_);
+    return rows * (2 * static_cast<std::uint64_t>(storedWeights()) + static_cast<std::uint64_t>(out_dim_));
+}
+
+std::size_t MatMulBiasSparseOp::estimateMemoryBytes() const noexcept {
+    return (values_.size() + bias_.size()) * sizeof(float) + indices_.size() +
+           (row_ptr_.size() + col_idx_.size()) * sizeof(std::uint32_t);
+}
+
+void MatMulBiasSparseOp::execute() {
+    const Value* in_val = inputs()[0];
+    Value* out_val = outputs()[0];
+    const Tensor& input = ops_detail::requireFp32Input(in_val, "MatMulBiasSparseOp");
+
+    const std::int64_t batch = in_val->shape().dim(0);
+    const float* x = input.data_as<float>();
+    Tensor& output = ops_detail::bindOutputTensor(out_val, Shape({batch, out_dim_}), output_buf_, output_tensor_);
+    float* y = output.data_as<float>();
+
+    const std::size_t m = static_cast<std::size_t>(batch);
+    const std::size_t k = static_cast<std::size_t>(in_dim_);
+    const std::size_t n = static_cast<std::size_t>(out_dim_);
+    const std::size_t panel_values = sparse_nm_value_count(k, kSparsePanel, pattern_);
+    ops_detail::forEachLinearTile(
+        m, k, n,
+        [&](std::size_t row0, std::size_t rows, std::size_t col0, std::size_t cols) {
+            LinearSparseArgs args;
+            args.x = x + row0 * k;
+            args.ldx = k;
+            args.pattern = pattern_;
+            if (pattern_.format == SparseFormat::NM) {
+                args.values = values_.data() + col0 / kSparsePanel * panel_values;
+                args.indices = indices_.data() + col0 / kSparsePanel * panel_values;
+            } else {
+                args.values = values_.data();
+                args.row_ptr = row_ptr_.data() + col0 / pattern_.block_out;
+                args.col_idx = col_idx_.data();
+            }
+            args.bias = bias_.data() + col0;
+            args.y = y + row0 * n + col0;
+            args.ldy = n;
+            args.m = rows;
+            args.k = k;
+            args.n = cols;
+            args.activation = activation_;
+            linear_sparse(args);
+        },
+        kSparsePanel);
+}
+
+std::unique_ptr<Operator> MatMulBiasSparseOp::clone() const {
+    return std::make_unique<MatMulBiasSparseOp>(*this);
+}
+
+} // namespace infer
@@ -0,0 +1,145 @@
+#include "inference_engine/ops/normalization.h"
+
+#include "inference_engine/graph/value.h"
+#include "inference_engine/kernels/reduce.h"
+#include "op_utils.h"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace infer {
+
+using inference_engine::core::Tensor;
+
+namespace {
+
+using NormRowsFn = void(const float*, std::int64_t, float*, std::int64_t, std::size_t, std::size_t, const float*,
+                        const float*, float);
+
+void checkParams(const char* op_name, const WeightBuffer<float>& gamma, const WeightBuffer<float>& beta) {
+    if (!gamma.empty() && !beta.empty() && gamma.size() != beta.size()) {
+        throw std::invalid_argument(std::string(op_name) + ": gamma and beta sizes differ");
+    }
+}
+
+void decodeNormAttributes(const Operator& op, const AttributeMap& attrs, float& epsilon, std::int64_t& axis) {
+    if (const auto* v = ops_detail::decodeAttribute<AttributeMap::Float>(op, attrs, attr_names::kEpsilon)) {
+        epsilon = static_cast<float>(*v);
+    }
+    if (const auto* v = ops_detail::decodeAttribute<AttributeMap::Int>(op, attrs, attr_names::kAxis)) axis = *v;
+}
+
+void validateNormOp(const Operator& op, const WeightBuffer<float>& gamma, const WeightBuffer<float>& beta,
+                    std::int64_t axis) {
+    if (op.inputs().size() != 1 || op.outputs().size() != 1) {
+        throw std::invalid_argument(op.type() + " expects 1 input and 1 output");
+    }
+    const auto& s = op.inputs()[0]->shape();
+    if (s.rank() == 0) {
+        throw std::invalid_argument(op.type() + ": expected an input of rank >= 1");
+    }
+    ops_detail::requireLastAxis(op, axis);
+    const auto n = static_cast<std::size_t>(s.dim(s.rank() - 1));
+    if ((!gamma.empty() && gamma.size() != n) || (!beta.empty() && beta.size() != n)) {
+        throw std::invalid_argument(op.type() + ": gamma/beta must match the last dimension " + std::to_string(n));
+    }
+}
+
+// Evenly spaced rows of a strided input are read in place; any other layout is
+// made contiguous first.
+void executeNormOp(Operator& op, NormRowsFn* rows_fn, const WeightBuffer<float>& gamma,
+                   const WeightBuffer<float>& beta, float epsilon, std::vector<float>& buf, Tensor& fallback) {
+    const Value* in_val = op.inputs()[0];
+    const Tensor& input = ops_detail::requireFp32Input(in_val, op.type().c_str());
+    const auto& s = in_val->shape();
+    Tensor& output = ops_detail::bindOutputTensor(op.outputs()[0], s, buf, fallback);
+
+    const std::int64_t n = s.dim(s.rank() - 1);
+    if (n == 0) return;
+    std::int64_t x_stride = ops_detail::lastAxisRowStride(input);
+    Tensor dense;
+    const float* x = input.data_as<float>();
+    if (x_stride < 0) {
+        dense = input.contiguous();
+        x = dense.data_as<float>();
+        x_stride = n;
+    }
+    rows_fn(x, x_stride, output.data_as<float>(), n, static_cast<std::size_t>(s.num_elements() / n),
+            static_cast<std::size_t>(n), gamma.empty() ? nullptr : gamma.data(),
+            beta.empty() ? nullptr : beta.data(), epsilon);
+}
+
+} // namespace
+
+LayerNormOp::LayerNormOp(WeightBuffer<float> gamma, WeightBuffer<float> beta, float epsilon)
+    : Operator("LayerNorm"), gamma_(std::move(gamma)), beta_(std::move(beta)), epsilon_(epsilon) {
+    checkParams("LayerNormOp", gamma_, beta_);
+}
+
+void LayerNormOp::inferShapes() {
+    ops_detail::inferSameShape(*this);
+}
+
+void LayerNormOp::decodeAttributes(const AttributeMap& attrs) {
+    decodeNormAttributes(*this, attrs, epsilon_, axis_);
+}
+
+void LayerNormOp::validate() const {
+    Operator::validate();
+    validateNormOp(*this, gamma_, beta_, axis_);
+}
+
+std::size_t LayerNormOp::estimateMemoryBytes() const noexcept {
+    return (gamma_.size() + beta_.size()) * sizeof(float);
+}
+
+// Sum, squared difference, then subtract, scale, multiply and add per element.
+std::uint64_t LayerNormOp::estimateFlops() const noexcept {
+    return 7 * ops_detail::outputElements(*this);
+}
+
+void LayerNormOp::execute() {
+    executeNormOp(*this, &layer_norm_rows, gamma_, beta_, epsilon_, output_buf_, output_tensor_);
+}
+
+std::unique_ptr<Operator> LayerNormOp::clone() const {
+    return std::make_unique<LayerNormOp>(*this);
+}
+
+RmsNormOp::RmsNormOp(WeightBuffer<float> gamma, WeightBuffer<float> beta, float epsilon)
+    : Operator("RMSNorm"), gamma_(std::move(gamma)), beta_(std::move(beta)), epsilon_(epsilon) {
+    checkParams("RmsNormOp", gamma_, beta_);
+}
+
+void RmsNormOp::inferShapes() {
+    ops_detail::inferSameShape(*this);
+}
+
+void RmsNormOp::decodeAttributes(const AttributeMap& attrs) {
+    decodeNormAttributes(*this, attrs, epsilon_, axis_);
+}
+
+void RmsNormOp::validate() const {
+    Operator::validate();
+    validateNormOp(*this, gamma_, beta_, axis_);
+}
+
+std::size_t RmsNormOp::estimateMemoryBytes() const noexcept {
+    return (gamma_.size() + beta_.size()) * sizeof(float);
+}
+
+// Square-accumulate, then scale, multiply and add per element.
+std::uint64_t RmsNormOp::estimateFlops() const noexcept {
+    return 5 * ops_detail::outputElements(*this);
+}
+
+void RmsNormOp::execute() {
+    executeNormOp(*this, &rms_norm_rows, gamma_, beta_, epsilon_, output_buf_, output_tensor_);
+}
+
+std::unique_ptr<Operator> RmsNormOp::clone() const {
+    return std::make_unique<RmsNormOp>(*this);
+}
+
+} // namespace infer
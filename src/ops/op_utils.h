@@ -0,0 +1,186 @@
+#pragma once
+
+// Internal helpers shared by the built-in operators.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/attributes.h"
+#include "inference_engine/graph/execution_context.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+namespace infer {
+namespace ops_detail {
+
+// Returns the tensor the memory planner bound to `out` when it matches the expected
+// layout. Otherwise binds `fallback` over the operator-private `buf` (grown on
+// demand, never shrunk) so unplanned graphs keep working. `buf` is float-typed for
+// alignment only; it backs outputs of any `dtype`. Under an ExecutionContext the
+// context's scratch for `out` stands in for both, keeping the operator untouched.
+inline inference_engine::core::Tensor& bindOutputTensor(Value* out,
+                                                        const inference_engine::core::Shape& shape,
+                                                        inference_engine::core::DataType dtype,
+                                                        std::vector<float>& op_buf,
+                                                        inference_engine::core::Tensor& op_fallback) {
+    using inference_engine::core::Tensor;
+
+    Tensor* bound = out->tensor();
+    if (bound != nullptr && bound != &op_fallback && bound->data() != nullptr &&
+        bound->dtype() == dtype && bound->shape() == shape) {
+        return *bound;
+    }
+
+    ExecutionContext* ctx = ExecutionContext::current();
+    ExecutionContext::Scratch* scratch = ctx != nullptr && ctx->tracks(out) ? &ctx->scratch(out) : nullptr;
+    std::vector<float>& buf = scratch != nullptr ? scratch->buf : op_buf;
+    Tensor& fallback = scratch != nullptr ? scratch->tensor : op_fallback;
+
+    const std::size_t bytes =
+        static_cast<std::size_t>(shape.num_elements()) * inference_engine::core::bytes_per_element(dtype);
+    const std::size_t elems = (bytes + sizeof(float) - 1) / sizeof(float);
+    if (buf.size() < elems) {
+        buf.resize(elems);
+    }
+    if (fallback.data() != buf.data() || fallback.shape() != shape || fallback.dtype() != dtype) {
+        fallback = Tensor(shape, dtype, static_cast<void*>(buf.data()), false);
+    }
+    out->setTensor(&fallback);
+    return fallback;
+}
+
+inline inference_engine::core::Tensor& bindOutputTensor(Value* out,
+                                                        const inference_engine::core::Shape& shape,
+                                                        std::vector<float>& buf,
+                                                        inference_engine::core::Tensor& fallback) {
+    return bindOutputTensor(out, shape, inference_engine::core::DataType::FP32, buf, fallback);
+}
+
+// Operator::inferShapes() for operators whose output 0 has input 0's shape.
+inline void inferSameShape(const Operator& op) {
+    if (op.inputs().empty() || op.outputs().empty() || op.inputs()[0] == nullptr || op.outputs()[0] == nullptr) {
+        throw std::invalid_argument(op.type() + ": cannot infer shapes without an input and an output");
+    }
+    op.outputs()[0]->setShape(op.inputs()[0]->shape());
+}
+
+// Operator::inferShapes() for dense layers: [batch, in_dim] -> [batch, out_dim].
+inline void inferDenseShape(const Operator& op, std::int64_t out_dim) {
+    if (op.inputs().size() != 1 || op.outputs().size() != 1 || op.inputs()[0] == nullptr ||
+        op.outputs()[0] == nullptr) {
+        throw std::invalid_argument(op.type() + ": cannot infer shapes without an input and an output");
+    }
+    const inference_engine::core::Shape& in = op.inputs()[0]->shape();
+    if (in.rank() != 2) {
+        throw std::invalid_argument(op.type() + ": expected [batch, in_dim] input shape, got " +
+                                    inference_engine::core::shape_to_string(in));
+    }
+    op.outputs()[0]->setShape(inference_engine::core::Shape({in.dim(0), out_dim}));
+}
+
+// Elements of output 0 at its Value shape (0 when the operator is not wired).
+inline std::uint64_t outputElements(const Operator& op) noexcept {
+    if (op.outputs().empty() || op.outputs()[0] == nullptr) return 0;
+    return static_cast<std::uint64_t>(op.outputs()[0]->shape().num_elements());
+}
+
+// Operator::estimateFlops() of a dense layer: a multiply-add per weight and row,
+// plus the bias add.
+inline std::uint64_t denseFlops(const Operator& op, std::int64_t in_dim) noexcept {
+    return outputElements(op) * (2 * static_cast<std::uint64_t>(in_dim) + 1);
+}
+
+// Fetches the single FP32 input tensor of an operator, with uniform error messages.
+inline const inference_engine::core::Tensor& requireFp32Input(const Value* in, const char* op_name) {
+    using inference_engine::core::DataType;
+    const auto* t = in->tensor();
+    if (t == nullptr) {
+        throw std::runtime_error(std::string(op_name) + ": input tensor is null");
+    }
+    if (t->dtype() != DataType::FP32) {
+        throw std::invalid_argument(std::string(op_name) + " only supports FP32");
+    }
+    if (t->data() == nullptr) {
+        throw std::runtime_error(std::string(op_name) + ": input tensor has null data");
+    }
+    return *t;
+}
+
+// Operator::decodeAttributes() helper: the attribute `key` as a T, or null when the
+// map does not hold it; throws when it holds another type.
+template <typename T>
+const T* decodeAttribute(const Operator& op, const AttributeMap& attrs, AttrKey key) {
+    if (!attrs.has(key)) return nullptr;
+    const T* v = attrs.tryGetPtr<T>(key);
+    if (v == nullptr) {
+        throw std::invalid_argument(op.type() + ": attribute '" + key.name() + "' has the wrong type");
+    }
+    return v;
+}
+
+// Throws unless `axis` (negative values count from the end) names the last
+// dimension of op's input 0, for operators that only work over the last axis.
+inline void requireLastAxis(const Operator& op, std::int64_t axis) {
+    const auto rank = static_cast<std::int64_t>(op.inputs()[0]->shape().rank());
+    if (axis != -1 && axis != rank - 1) {
+        throw std::invalid_argument(op.type() + ": only axis -1 (the last axis) is supported, got " +
+                                    std::to_string(axis));
+    }
+}
+
+// Element distance between consecutive rows of the last axis of an FP32 tensor
+// (each row n unit-stride elements), read from Tensor::strides(); -1 when the
+// rows are not evenly spaced and the tensor must be made contiguous first.
+inline std::int64_t lastAxisRowStride(const inference_engine::core::Tensor& t) {
+    const std::size_t rank = t.rank();
+    if (rank == 0) return 1;
+    const auto elem = static_cast<std::int64_t>(sizeof(float));
+    const std::int64_t n = t.dim(rank - 1);
+    if (n != 1 && t.stride(rank - 1) != elem) return -1;
+    std::int64_t row_stride = n;
+    std::int64_t expect = -1; // byte stride the next outer non-unit axis must have
+    for (std::size_t i = rank - 1; i-- > 0;) {
+        if (t.dim(i) == 1) continue;
+        if (expect < 0) {
+            if (t.stride(i) % elem != 0) return -1;
+            row_stride = t.stride(i) / elem;
+        } else if (t.stride(i) != expect) {
+            return -1;
+        }
+        expect = t.stride(i) * t.dim(i);
+    }
+    return row_stride;
+}
+
+// Splits an m x n dense output (inner dimension k) into row x column tiles and runs
+// fn(row0, rows, col0, cols) for each through parallelFor. Column tiles keep batch-1
+// inference parallel and are a multiple of `col_align` columns (a weight panel: 16
+// for INT8, linear_packed_panel() for prepacked FP32); each task does at least ~64K
+// MACs so small layers stay on the calling thread.
+template <typename Fn>
+void forEachLinearTile(std::size_t m, std::size_t k, std::size_t n, Fn&& fn, std::size_t col_align = 16) {
+    constexpr std::size_t kTileRows = 64;
+    const std::size_t kTileCols = std::max<std::size_t>(col_align, 256 / col_align * col_align);
+    constexpr std::size_t kMinMacsPerTask = std::size_t{1} << 16;
+    const std::size_t row_tiles = (m + kTileRows - 1) / kTileRows;
+    const std::size_t col_tiles = (n + kTileCols - 1) / kTileCols;
+    const std::size_t macs_per_tile = std::max<std::size_t>(1, std::min(m, kTileRows) * std::min(n, kTileCols) * k);
+    const std::size_t grain = std::max<std::size_t>(1, kMinMacsPerTask / macs_per_tile);
+
+    parallelFor(0, row_tiles * col_tiles, grain, [&](std::size_t tile_begin, std::size_t tile_end) {
+        for (std::size_t t = tile_begin; t < tile_end; ++t) {
+            const std::size_t row0 = (t / col_tiles) * kTileRows;
+            const std::size_t col0 = (t % col_tiles) * kTileCols;
+            fn(row0, std::min(kTileRows, m - row0), col0, std::min(kTileCols, n - col0));
+        }
+    });
+}
+
+} // namespace ops_detail
+} // namespace infer
@@ -0,0 +1,149 @@
+#include "inference_engine/ops/paged_attention.h"
+
+#include "inference_engine/graph/kv_cache.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/kernels/attention.h"
+#include "op_utils.h"
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace infer {
+
+using inference_engine::core::Tensor;
+
+PagedAttentionOp::PagedAttentionOp(std::int64_t layer, std::int64_t heads, std::int64_t kv_heads,
+                                   std::int64_t head_dim, float scale)
+    : Operator("PagedAttention"),
+      layer_(layer),
+      heads_(heads),
+      kv_heads_(kv_heads),
+      head_dim_(head_dim),
+      scale_(scale != 0.0f ? scale : 1.0f / std::sqrt(static_cast<float>(std::max<std::int64_t>(1, head_dim)))) {
+    if (layer < 0 || heads <= 0 || kv_heads <= 0 || head_dim <= 0) {
+        throw std::invalid_argument("PagedAttentionOp: layer must be >= 0 and heads, kv_heads, head_dim positive");
+    }
+    if (heads % kv_heads != 0 || static_cast<std::size_t>(heads / kv_heads) > kMaxAttentionGroup) {
+        throw std::invalid_argument("PagedAttentionOp: heads must be a multiple of kv_heads, at most " +
+                                    std::to_string(kMaxAttentionGroup) + " per KV head");
+    }
+}
+
+void PagedAttentionOp::validate() const {
+    Operator::validate();
+    if (inputs().size() != 3 || outputs().size() != 1) {
+        throw std::invalid_argument("PagedAttentionOp expects q, k, v inputs and 1 output");
+    }
+    const auto& q = inputs()[0]->shape();
+    const auto& k = inputs()[1]->shape();
+    const auto& v = inputs()[2]->shape();
+    if (q.rank() != 2 || q.dim(1) != heads_ * head_dim_) {
+        throw std::invalid_argument("PagedAttentionOp: expected q of shape [tokens, heads * head_dim]");
+    }
+    const inference_engine::core::Shape kv({q.dim(0), kv_heads_ * head_dim_});
+    if (k != kv || v != kv) {
+        throw std::invalid_argument("PagedAttentionOp: expected k and v of shape [tokens, kv_heads * head_dim]");
+    }
+    if (cache_ != nullptr) {
+        const KVCacheConfig& c = cache_->config();
+        if (static_cast<std::size_t>(layer_) >= c.layers || static_cast<std::size_t>(kv_heads_) != c.kv_heads ||
+            static_cast<std::size_t>(head_dim_) != c.head_dim) {
+            throw std::invalid_argument("PagedAttentionOp: layer, kv_heads or head_dim do not match the KVCache");
+        }
+    }
+}
+
+void PagedAttentionOp::inferShapes() {
+    ops_detail::inferSameShape(*this);
+}
+
+std::uint64_t PagedAttentionOp::estimateFlops() const noexcept {
+    if (cache_ == nullptr) return 0;
+    const KVCache::Step& step = cache_->step();
+    std::uint64_t attended = 0;
+    for (std::size_t position : step.positions) {
+        // Token t attends to position + t + 1 entries.
+        attended += step.tokens * position + step.tokens * (step.tokens + 1) / 2;
+    }
+    // Score and weighted sum: two multiply-adds per attended entry and dimension.
+    return attended * static_cast<std::uint64_t>(heads_ * head_dim_) * 4;
+}
+
+void PagedAttentionOp::execute() {
+    if (cache_ == nullptr) {
+        throw std::runtime_error("PagedAttentionOp: no KVCache bound");
+    }
+    const Tensor& q = ops_detail::requireFp32Input(inputs()[0], "PagedAttentionOp");
+    const Tensor& k = ops_detail::requireFp32Input(inputs()[1], "PagedAttentionOp");
+    const Tensor& v = ops_detail::requireFp32Input(inputs()[2], "PagedAttentionOp");
+    const auto& shape = inputs()[0]->shape();
+    Tensor& output = ops_detail::bindOutputTensor(outputs()[0], shape, output_buf_, output_tensor_);
+
+    const KVCache::Step& step = cache_->step();
+    const std::size_t rows = step.rows.size();
+    const std::size_t tokens = step.tokens;
+    if (rows * tokens != static_cast<std::size_t>(shape.dim(0))) {
+        throw std::invalid_argument("PagedAttentionOp: " + std::to_string(shape.dim(0)) +
+                                    " input rows do not match the KVCache step (" + std::to_string(rows) + " x " +
+                                    std::to_string(tokens) + " tokens)");
+    }
+    const auto layer = static_cast<std::size_t>(layer_);
+    const auto kv_heads = static_cast<std::size_t>(kv_heads_);
+    const auto d = static_cast<std::size_t>(head_dim_);
+    const std::size_t group = static_cast<std::size_t>(heads_) / kv_heads;
+    const std::size_t block_tokens = cache_->config().block_tokens;
+    const std::size_t q_row = group * kv_heads * d;
+    const std::size_t kv_row = kv_heads * d;
+
+    // Append the new keys and values first: every token of the step attends to them.
+    const float* kd = k.data_as<float>();
+    const float* vd = v.data_as<float>();
+    for (std::size_t r = 0; r < rows; ++r) {
+        const std::vector<std::uint32_t>& table = cache_->blockTable(step.rows[r]);
+        for (std::size_t t = 0; t < tokens; ++t) {
+            const std::size_t pos = step.positions[r] + t;
+            const std::uint32_t block = table[pos / block_tokens];
+            const std::size_t offset = pos % block_tokens * d;
+            const std::size_t src = (r * tokens + t) * kv_row;
+            for (std::size_t h = 0; h < kv_heads; ++h) {
+                std::memcpy(cache_->keys(block, layer, h) + offset, kd + src + h * d, d * sizeof(float));
+                std::memcpy(cache_->values(block, layer, h) + offset, vd + src + h * d, d * sizeof(float));
+            }
+        }
+    }
+
+    // One task per (token, KV head); each reads its sequence's pages in place.
+    const float* qd = q.data_as<float>();
+    float* out = output.data_as<float>();
+    KVCache& cache = *cache_;
+    parallelFor(0, rows * tokens * kv_heads, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const std::size_t row = i / kv_heads;
+            const std::size_t h = i % kv_heads;
+            const std::size_t r = row / tokens;
+            PagedAttentionArgs args;
+            args.q = qd + row * q_row + h * group * d;
+            args.ldq = d;
+            args.out = out + row * q_row + h * group * d;
+            args.ldo = d;
+            args.group = group;
+            args.keys = cache.keys(0, layer, h);
+            args.values = cache.values(0, layer, h);
+            args.blocks = cache.blockTable(step.rows[r]).data();
+            args.block_stride = cache.blockStride();
+            args.block_tokens = block_tokens;
+            args.tokens = step.positions[r] + row % tokens + 1;
+            args.head_dim = d;
+            args.scale = scale_;
+            paged_attention(args);
+        }
+    });
+}
+
+std::unique_ptr<Operator> PagedAttentionOp::clone() const {
+    return std::make_unique<PagedAttentionOp>(*this);
+}
+
+} // namespace infer
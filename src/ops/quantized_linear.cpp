@@ -0,0 +1,214 @@
+#include "inference_engine/ops/quantized_linear.h"
+
+#include "inference_engine/graph/value.h"
+#include "op_utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+using inference_engine::core::QuantizationParams;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+
+namespace {
+
+bool isQuantizedByteType(DataType dt) {
+    return dt == DataType::INT8 || dt == DataType::UINT8;
+}
+
+// Per-tensor scale/zero point of a quantized activation Value.
+const QuantizationParams& requireActivationQuant(const Value* v, const char* what) {
+    if (!isQuantizedByteType(v->dtype()) || !v->hasQuantization()) {
+        throw std::invalid_argument(std::string("QuantizedLinearOp: ") + what + " must be quantized INT8/UINT8");
+    }
+    const QuantizationParams& qp = *v->quantization();
+    if (qp.is_per_channel()) {
+        throw std::invalid_argument(std::string("QuantizedLinearOp: ") + what + " needs per-tensor quantization");
+    }
+    if (!(qp.scale > 0.0f)) {
+        throw std::invalid_argument(std::string("QuantizedLinearOp: ") + what + " scale must be positive");
+    }
+    return qp;
+}
+
+} // namespace
+
+QuantizedLinearOp::QuantizedLinearOp(std::int64_t in_dim, std::int64_t out_dim, std::vector<std::int8_t> weights,
+                                     QuantizationParams weight_qparams, std::vector<float> bias,
+                                     Activation activation)
+    : Operator("QuantizedLinear"),
+      in_dim_(in_dim),
+      out_dim_(out_dim),
+      bias_(std::move(bias)),
+      activation_(activation) {
+    const std::size_t k = static_cast<std::size_t>(in_dim_);
+    const std::size_t n = static_cast<std::size_t>(out_dim_);
+    if (weights.size() != k * n) {
+        throw std::invalid_argument("QuantizedLinearOp: weight size mismatch");
+    }
+    if (bias_.size() != n) {
+        throw std::invalid_argument("QuantizedLinearOp: bias size mismatch");
+    }
+    if (weight_qparams.is_per_channel()) {
+        const int axis = weight_qparams.axis < 0 ? weight_qparams.axis + 2 : weight_qparams.axis;
+        if (axis != 1 || weight_qparams.per_channel_scales.size() != n) {
+            throw std::invalid_argument("QuantizedLinearOp: weight scales must be per output channel (axis 1)");
+        }
+        weight_scales_ = weight_qparams.per_channel_scales;
+    } else {
+        weight_scales_.assign(n, weight_qparams.scale);
+    }
+    const bool zero_points_are_zero =
+        weight_qparams.zero_point == 0 &&
+        std::all_of(weight_qparams.per_channel_zero_points.begin(), weight_qparams.per_channel_zero_points.end(),
+                    [](std::int32_t zp) { return zp == 0; });
+    if (!zero_points_are_zero) {
+        throw std::invalid_argument("QuantizedLinearOp: weights must be symmetric (zero point 0)");
+    }
+    for (float s : weight_scales_) {
+        if (!(s > 0.0f)) {
+            throw std::invalid_argument("QuantizedLinearOp: weight scales must be positive");
+        }
+    }
+    weights_ = std::make_shared<const PackedInt8Weights>(pack_int8_weights(weights.data(), k, n));
+}
+
+std::unique_ptr<QuantizedLinearOp> QuantizedLinearOp::fromFloat(std::int64_t in_dim, std::int64_t out_dim,
+                                                                const std::vector<float>& weights,
+                                                                std::vector<float> bias, Activation activation) {
+    const std::size_t k = static_cast<std::size_t>(in_dim);
+    const std::size_t n = static_cast<std::size_t>(out_dim);
+    if (weights.size() != k * n) {
+        throw std::invalid_argument("QuantizedLinearOp: weight size mismatch");
+    }
+    std::vector<float> col_min(n, 0.0f);
+    std::vector<float> col_max(n, 0.0f);
+    for (std::size_t p = 0; p < k; ++p) {
+        for (std::size_t j = 0; j < n; ++j) {
+            col_min[j] = std::min(col_min[j], weights[p * n + j]);
+            col_max[j] = std::max(col_max[j], weights[p * n + j]);
+        }
+    }
+    QuantizationParams qp =
+        inference_engine::core::calculate_per_channel_quant_params(col_min, col_max, 1, true, DataType::INT8);
+    std::vector<std::int8_t> q(k * n);
+    inference_engine::core::quantize_buffer_per_channel_int8(weights.data(), q.data(), {in_dim, out_dim}, qp);
+    // Symmetric scales map the column range onto [-127, 127]; keep rounding noise
+    // from ever producing the -128 the kernels reject.
+    for (std::int8_t& v : q) v = std::max<std::int8_t>(v, -127);
+    return std::make_unique<QuantizedLinearOp>(in_dim, out_dim, std::move(q), std::move(qp), std::move(bias),
+                                               activation);
+}
+
+void QuantizedLinearOp::inferShapes() {
+    ops_detail::inferDenseShape(*this, out_dim_);
+}
+
+void QuantizedLinearOp::validate() const {
+    Operator::validate();
+    if (inputs().size() != 1 || outputs().size() != 1) {
+        throw std::invalid_argument("QuantizedLinearOp expects 1 input and 1 output");
+    }
+    const Value* in = inputs()[0];
+    const auto& s = in->shape();
+    if (s.rank() != 2 || s.dim(1) != in_dim_) {
+        throw std::invalid_argument("QuantizedLinearOp: expected [batch, in_dim] input shape");
+    }
+    (void)requireActivationQuant(in, "input");
+    const Value* out = outputs()[0];
+    if (out->dtype() != DataType::FP32) {
+        (void)requireActivationQuant(out, "output");
+    }
+}
+
+std::uint64_t QuantizedLinearOp::estimateFlops() const noexcept {
+    return ops_detail::denseFlops(*this, in_dim_);
+}
+
+std::size_t QuantizedLinearOp::estimateMemoryBytes() const noexcept {
+    return weights_->data.size() + weights_->col_sums.size() * sizeof(std::int32_t) +
+           (weight_scales_.size() + bias_.size()) * sizeof(float);
+}
+
+void QuantizedLinearOp::prepareEpilogue(float x_scale, float y_scale, bool quantized_output) {
+    const float y_key = quantized_output ? y_scale : 0.0f;
+    if (!multipliers_.empty() && cached_x_scale_ == x_scale && cached_y_scale_ == y_key) return;
+    const std::size_t n = static_cast<std::size_t>(out_dim_);
+    bias_q_.resize(n);
+    multipliers_.resize(n);
+    for (std::size_t j = 0; j < n; ++j) {
+        const float acc_scale = x_scale * weight_scales_[j];
+        bias_q_[j] = static_cast<std::int32_t>(std::lround(bias_[j] / acc_scale));
+        multipliers_[j] = quantized_output ? acc_scale / y_scale : acc_scale;
+    }
+    cached_x_scale_ = x_scale;
+    cached_y_scale_ = y_key;
+}
+
+void QuantizedLinearOp::prepare() {
+    const Value* in_val = inputs()[0];
+    const Value* out_val = outputs()[0];
+    const bool quantized_output = out_val->dtype() != DataType::FP32;
+    const float y_scale = quantized_output ? requireActivationQuant(out_val, "output").scale : 0.0f;
+    prepareEpilogue(requireActivationQuant(in_val, "input").scale, y_scale, quantized_output);
+}
+
+void QuantizedLinearOp::execute() {
+    const Value* in_val = inputs()[0];
+    Value* out_val = outputs()[0];
+    const Tensor* input = in_val->tensor();
+    if (input == nullptr || input->data() == nullptr) {
+        throw std::runtime_error("QuantizedLinearOp: input tensor is null");
+    }
+    if (input->dtype() != in_val->dtype()) {
+        throw std::invalid_argument("QuantizedLinearOp: input tensor dtype does not match its Value");
+    }
+    const QuantizationParams& x_qp = requireActivationQuant(in_val, "input");
+    const DataType y_dtype = out_val->dtype();
+    const bool quantized_output = y_dtype != DataType::FP32;
+    QuantizationParams y_qp;
+    if (quantized_output) y_qp = requireActivationQuant(out_val, "output");
+    prepareEpilogue(x_qp.scale, y_qp.scale, quantized_output);
+
+    const std::int64_t batch = in_val->shape().dim(0);
+    Tensor& output =
+        ops_detail::bindOutputTensor(out_val, Shape({batch, out_dim_}), y_dtype, output_buf_, output_tensor_);
+    if (quantized_output) output.set_quant_params(y_qp.scale, y_qp.zero_point);
+
+    const std::size_t m = static_cast<std::size_t>(batch);
+    const std::size_t k = static_cast<std::size_t>(in_dim_);
+    const std::size_t n = static_cast<std::size_t>(out_dim_);
+    const std::size_t y_elem = inference_engine::core::bytes_per_element(y_dtype);
+    const auto* x = static_cast<const std::uint8_t*>(input->data());
+    auto* y = static_cast<std::uint8_t*>(output.data());
+    ops_detail::forEachLinearTile(m, k, n, [&](std::size_t row0, std::size_t rows, std::size_t col0, std::size_t cols) {
+        LinearInt8Args args;
+        args.x = x + row0 * k;
+        args.ldx = k;
+        args.x_dtype = in_val->dtype();
+        args.x_zero_point = x_qp.zero_point;
+        args.w = weights_.get();
+        args.col_begin = col0;
+        args.bias = bias_q_.data() + col0;
+        args.scales = multipliers_.data() + col0;
+        args.y = y + (row0 * n + col0) * y_elem;
+        args.ldy = n;
+        args.y_dtype = y_dtype;
+        args.y_zero_point = y_qp.zero_point;
+        args.m = rows;
+        args.n = cols;
+        args.activation = activation_;
+        linear_int8(args);
+    });
+}
+
+std::unique_ptr<Operator> QuantizedLinearOp::clone() const {
+    return std::make_unique<QuantizedLinearOp>(*this);
+}
+
+} // namespace infer
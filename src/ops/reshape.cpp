@@ -0,0 +1,85 @@
+#include "inference_engine/ops/reshape.h"
+
+#include "inference_engine/graph/value.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace infer {
+
+using inference_engine::core::Tensor;
+
+ReshapeOp::ReshapeOp() : Operator("Reshape") {}
+
+// Keeps the output's trailing dimensions and recomputes the leading one, so a
+// flatten of [batch, ...] follows the batch size.
+void ReshapeOp::inferShapes() {
+    if (inputs().size() != 1 || outputs().size() != 1) {
+        throw std::invalid_argument("Reshape expects 1 input and 1 output");
+    }
+    const std::int64_t elements = inputs()[0]->shape().num_elements();
+    inference_engine::core::DimVector dims = outputs()[0]->shape().dims();
+    std::int64_t trailing = 1;
+    for (std::size_t i = 1; i < dims.size(); ++i) {
+        trailing *= dims[i];
+    }
+    if (dims.empty() || trailing == 0 || elements % trailing != 0) {
+        throw std::invalid_argument("Reshape: cannot view " +
+                                    inference_engine::core::shape_to_string(inputs()[0]->shape()) +
+                                    " with the trailing dimensions of " +
+                                    inference_engine::core::shape_to_string(outputs()[0]->shape()));
+    }
+    dims[0] = elements / trailing;
+    outputs()[0]->setShape(inference_engine::core::Shape(std::move(dims)));
+}
+
+void ReshapeOp::validate() const {
+    Operator::validate();
+    if (inputs().size() != 1 || outputs().size() != 1) {
+        throw std::invalid_argument("Reshape expects 1 input and 1 output");
+    }
+    const Value* in = inputs()[0];
+    const Value* out = outputs()[0];
+    if (in->dtype() != out->dtype()) {
+        throw std::invalid_argument("Reshape: input and output dtypes differ");
+    }
+    if (in->shape().num_elements() != out->shape().num_elements()) {
+        throw std::invalid_argument("Reshape: cannot view " + inference_engine::core::shape_to_string(in->shape()) +
+                                    " as " + inference_engine::core::shape_to_string(out->shape()));
+    }
+}
+
+void ReshapeOp::execute() {
+    const Value* in_val = inputs()[0];
+    Value* out_val = outputs()[0];
+    const Tensor* input = in_val->tensor();
+    if (input == nullptr || input->data() == nullptr) {
+        throw std::runtime_error("Reshape: input tensor is null");
+    }
+    if (!input->is_contiguous()) {
+        throw std::invalid_argument("Reshape: input must be contiguous");
+    }
+    // Planned view: the output already aliases the input's slot.
+    Tensor* bound = out_val->tensor();
+    if (bound != nullptr && bound->data() == input->data()) {
+        return;
+    }
+    // Otherwise repoint whatever tensor the output is bound to (the plan's, or the
+    // request context's); only unplanned graphs fall back to the operator's own view.
+    if (bound == nullptr || bound->shape() != out_val->shape() || bound->dtype() != out_val->dtype()) {
+        if (view_.shape() != out_val->shape() || view_.dtype() != out_val->dtype()) {
+            view_ = Tensor(out_val->shape(), out_val->dtype());
+        }
+        bound = &view_;
+        out_val->setTensor(bound);
+    }
+    bound->set_data(const_cast<void*>(input->data()), false);
+    bound->set_quant_params(input->quant_params());
+}
+
+std::unique_ptr<Operator> ReshapeOp::clone() const {
+    return std::make_unique<ReshapeOp>(*this);
+}
+
+} // namespace infer
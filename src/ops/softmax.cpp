@@ -0,0 +1,112 @@
+#include "inference_engine/ops/softmax.h"
+
+#include "inference_engine/graph/value.h"
+#include "inference_engine/kernels/reduce.h"
+#include "op_utils.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace infer {
+
+using inference_engine::core::Tensor;
+
+namespace {
+
+using RowsFn = void(const float*, std::int64_t, float*, std::int64_t, std::size_t, std::size_t);
+
+void decodeAxis(const Operator& op, const AttributeMap& attrs, std::int64_t& axis) {
+    if (const auto* v = ops_detail::decodeAttribute<AttributeMap::Int>(op, attrs, attr_names::kAxis)) axis = *v;
+}
+
+void validateRowOp(const Operator& op, std::int64_t axis) {
+    if (op.inputs().size() != 1 || op.outputs().size() != 1) {
+        throw std::invalid_argument(op.type() + " expects 1 input and 1 output");
+    }
+    if (op.inputs()[0]->shape().rank() == 0) {
+        throw std::invalid_argument(op.type() + ": expected an input of rank >= 1");
+    }
+    ops_detail::requireLastAxis(op, axis);
+}
+
+// Runs `rows_fn` over the last axis. Evenly spaced rows of a strided input are
+// read in place; any other layout is made contiguous first.
+void executeRowOp(Operator& op, RowsFn* rows_fn, std::vector<float>& buf, Tensor& fallback) {
+    const Value* in_val = op.inputs()[0];
+    const Tensor& input = ops_detail::requireFp32Input(in_val, op.type().c_str());
+    const auto& s = in_val->shape();
+    Tensor& output = ops_detail::bindOutputTensor(op.outputs()[0], s, buf, fallback);
+
+    const std::int64_t n = s.dim(s.rank() - 1);
+    if (n == 0) return;
+    std::int64_t x_stride = ops_detail::lastAxisRowStride(input);
+    Tensor dense;
+    const float* x = input.data_as<float>();
+    if (x_stride < 0) {
+        dense = input.contiguous();
+        x = dense.data_as<float>();
+        x_stride = n;
+    }
+    rows_fn(x, x_stride, output.data_as<float>(), n, static_cast<std::size_t>(s.num_elements() / n),
+            static_cast<std::size_t>(n));
+}
+
+} // namespace
+
+SoftmaxOp::SoftmaxOp() : Operator("Softmax") {}
+
+// Max, subtract, exp, sum and normalize per element.
+std::uint64_t SoftmaxOp::estimateFlops() const noexcept {
+    return 5 * ops_detail::outputElements(*this);
+}
+
+void SoftmaxOp::inferShapes() {
+    ops_detail::inferSameShape(*this);
+}
+
+void SoftmaxOp::decodeAttributes(const AttributeMap& attrs) {
+    decodeAxis(*this, attrs, axis_);
+}
+
+void SoftmaxOp::validate() const {
+    Operator::validate();
+    validateRowOp(*this, axis_);
+}
+
+void SoftmaxOp::execute() {
+    executeRowOp(*this, &softmax_rows, output_buf_, output_tensor_);
+}
+
+std::unique_ptr<Operator> SoftmaxOp::clone() const {
+    return std::make_unique<SoftmaxOp>(*this);
+}
+
+LogSoftmaxOp::LogSoftmaxOp() : Operator("LogSoftmax") {}
+
+// Max, subtract, exp and sum per element, then one subtract.
+std::uint64_t LogSoftmaxOp::estimateFlops() const noexcept {
+    return 5 * ops_detail::outputElements(*this);
+}
+
+void LogSoftmaxOp::inferShapes() {
+    ops_detail::inferSameShape(*this);
+}
+
+void LogSoftmaxOp::decodeAttributes(const AttributeMap& attrs) {
+    decodeAxis(*this, attrs, axis_);
+}
+
+void LogSoftmaxOp::validate() const {
+    Operator::validate();
+    validateRowOp(*this, axis_);
+}
+
+void LogSoftmaxOp::execute() {
+    executeRowOp(*this, &log_softmax_rows, output_buf_, output_tensor_);
+}
+
+std::unique_ptr<Operator> LogSoftmaxOp::clone() const {
+    return std::make_unique<LogSoftmaxOp>(*this);
+}
+
+} // namespace infer
@@ -0,0 +1,103 @@
+#include "inference_engine/ops/transpose.h"
+
+#include "inference_engine/graph/value.h"
+#include "op_utils.h"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace infer {
+
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+
+TransposeOp::TransposeOp(std::vector<int> perm) : Operator("Transpose"), perm_(std::move(perm)) {}
+
+std::vector<int> TransposeOp::axes(std::size_t rank) const {
+    if (!perm_.empty()) {
+        return perm_;
+    }
+    std::vector<int> reversed(rank);
+    for (std::size_t i = 0; i < rank; ++i) {
+        reversed[i] = static_cast<int>(rank - 1 - i);
+    }
+    return reversed;
+}
+
+void TransposeOp::inferShapes() {
+    if (inputs().size() != 1 || outputs().size() != 1) {
+        throw std::invalid_argument("Transpose expects 1 input and 1 output");
+    }
+    const Shape& in = inputs()[0]->shape();
+    const std::vector<int> order = axes(in.rank());
+    if (order.size() != in.rank()) {
+        throw std::invalid_argument("Transpose: perm does not match input rank " + std::to_string(in.rank()));
+    }
+    inference_engine::core::DimVector dims;
+    for (int axis : order) {
+        dims.push_back(in.dim(static_cast<std::size_t>(axis)));
+    }
+    outputs()[0]->setShape(Shape(std::move(dims)));
+}
+
+void TransposeOp::decodeAttributes(const AttributeMap& attrs) {
+    const auto* perm = ops_detail::decodeAttribute<AttributeMap::Ints>(*this, attrs, attr_names::kPerm);
+    if (perm == nullptr) return;
+    std::vector<int> decoded;
+    for (const AttributeMap::Int axis : *perm) {
+        if (axis < 0 || axis > std::numeric_limits<int>::max()) {
+            throw std::invalid_argument("Transpose: perm entry " + std::to_string(axis) + " is out of range");
+        }
+        decoded.push_back(static_cast<int>(axis));
+    }
+    perm_ = std::move(decoded);
+}
+
+void TransposeOp::validate() const {
+    Operator::validate();
+    if (inputs().size() != 1 || outputs().size() != 1) {
+        throw std::invalid_argument("Transpose expects 1 input and 1 output");
+    }
+    const Value* in = inputs()[0];
+    const Value* out = outputs()[0];
+    const std::vector<int> order = axes(in->shape().rank());
+    std::vector<bool> seen(order.size(), false);
+    bool valid = order.size() == in->shape().rank() && out->shape().rank() == order.size();
+    for (std::size_t i = 0; valid && i < order.size(); ++i) {
+        const int axis = order[i];
+        valid = axis >= 0 && static_cast<std::size_t>(axis) < order.size() && !seen[axis] &&
+                out->shape().dim(i) == in->shape().dim(static_cast<std::size_t>(axis));
+        if (valid) seen[axis] = true;
+    }
+    if (!valid) {
+        throw std::invalid_argument("Transpose: cannot permute " + inference_engine::core::shape_to_string(in->shape()) +
+                                    " into " + inference_engine::core::shape_to_string(out->shape()));
+    }
+    if (in->dtype() != out->dtype()) {
+        throw std::invalid_argument("Transpose: input and output dtypes differ");
+    }
+}
+
+void TransposeOp::prepare() {
+    resolved_ = axes(inputs()[0]->shape().rank());
+}
+
+void TransposeOp::execute() {
+    const Value* in_val = inputs()[0];
+    Value* out_val = outputs()[0];
+    const Tensor* input = in_val->tensor();
+    if (input == nullptr || input->data() == nullptr) {
+        throw std::runtime_error("Transpose: input tensor is null");
+    }
+    Tensor& output = ops_detail::bindOutputTensor(out_val, out_val->shape(), input->dtype(), output_buf_, output_tensor_);
+    const Tensor view = input->transpose(resolved_.size() == input->rank() ? resolved_ : axes(input->rank()));
+    view.copy_into(output);
+    output.set_quant_params(input->quant_params());
+}
+
+std::unique_ptr<Operator> TransposeOp::clone() const {
+    return std::make_unique<TransposeOp>(*this);
+}
+
+} // namespace infer
@@ -0,0 +1,88 @@
+#include "inference_engine/passes/constant_folding.h"
+
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/value.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <vector>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+using inference_engine::core::Tensor;
+
+namespace {
+
+bool foldable(const Graph& g, const Node& node) {
+    if (node.op() == nullptr || node.inputs().empty() || node.outputs().empty()) return false;
+    for (const Value* in : node.inputs()) {
+        if (!g.isInitializer(in)) return false;
+    }
+    for (const Value* out : node.outputs()) {
+        if (out->dtype() == DataType::UNKNOWN || out->shape().num_elements() <= 0) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+void ConstantFoldingPass::run(Graph& g) {
+    folded_ = 0;
+    for (Node* node : g.topologicalSort()) {
+        if (!foldable(g, *node)) continue;
+
+        // Evaluate into scratch buffers owned here; the node's own Values may still
+        // point at a previously bound arena.
+        const std::vector<Value*> outputs = node->outputs();
+        std::vector<std::vector<std::uint64_t>> storage(outputs.size());
+        std::vector<Tensor> results;
+        results.reserve(outputs.size());
+        for (std::size_t i = 0; i < outputs.size(); ++i) {
+            Value* out = outputs[i];
+            const auto bytes = static_cast<std::size_t>(out->shape().num_elements()) *
+                               inference_engine::core::bytes_per_element(out->dtype());
+            storage[i].assign((bytes + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t), 0);
+            results.emplace_back(out->shape(), out->dtype(), static_cast<void*>(storage[i].data()), false);
+        }
+        std::vector<Tensor*> previous;
+        previous.reserve(outputs.size());
+        for (std::size_t i = 0; i < outputs.size(); ++i) {
+            previous.push_back(outputs[i]->tensor());
+            outputs[i]->setTensor(&results[i]);
+        }
+
+        try {
+            node->op()->validate();
+            node->op()->execute();
+        } catch (const std::exception&) {
+            // Not evaluable ahead of time (e.g. an import placeholder): keep the node.
+            for (std::size_t i = 0; i < outputs.size(); ++i) outputs[i]->setTensor(previous[i]);
+            continue;
+        }
+        // Ops without a preset output fall back to their own buffer; take the data
+        // from wherever the Value ended up pointing.
+        for (std::size_t i = 0; i < outputs.size(); ++i) {
+            const Tensor* t = outputs[i]->tensor();
+            if (t != &results[i] && t != nullptr) {
+                std::memcpy(results[i].data(), t->data(), static_cast<std::size_t>(results[i].byte_size()));
+                results[i].set_quant_params(t->quant_params());
+            }
+        }
+
+        const std::vector<Value*> inputs = node->inputs();
+        g.removeNode(node);
+        for (std::size_t i = 0; i < outputs.size(); ++i) {
+            g.setInitializer(outputs[i], results[i]);
+        }
+        for (Value* in : inputs) {
+            if (in->consumers().empty()) g.removeValue(in);
+        }
+        ++folded_;
+    }
+}
+
+} // namespace infer
@@ -0,0 +1,136 @@
+#include "inference_engine/passes/conv_layout.h"
+
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/kernels/conv.h"
+#include "inference_engine/ops/conv2d.h"
+#include "inference_engine/ops/layout_reorder.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+
+namespace {
+
+using Direction = LayoutReorderOp::Direction;
+
+std::vector<Node*> nodeList(const Graph& g) {
+    std::vector<Node*> nodes;
+    nodes.reserve(g.nodes().size());
+    for (const auto& n : g.nodes()) nodes.push_back(n.get());
+    return nodes;
+}
+
+bool alive(const Graph& g, const Node* n) {
+    return std::any_of(g.nodes().begin(), g.nodes().end(), [n](const auto& p) { return p.get() == n; });
+}
+
+const LayoutReorderOp* reorderOf(const Node* node, Direction direction) {
+    const auto* r = node != nullptr ? dynamic_cast<const LayoutReorderOp*>(node->op()) : nullptr;
+    return r != nullptr && r->direction() == direction ? r : nullptr;
+}
+
+bool isGraphOutput(const Graph& g, const Value* v) {
+    return std::find(g.outputs().begin(), g.outputs().end(), v) != g.outputs().end();
+}
+
+Shape blockedShape(const Shape& plain, std::size_t block) {
+    const auto b = static_cast<std::int64_t>(block);
+    return Shape({plain.dim(0), (plain.dim(1) + b - 1) / b, plain.dim(2), plain.dim(3), b});
+}
+
+// The blocked form of plain Value `in`: the output of an existing ToBlocked reorder
+// of it, or of a new one.
+Value* blockedInput(Graph& g, Value* in, std::size_t block) {
+    for (Node* consumer : in->consumers()) {
+        const LayoutReorderOp* r = reorderOf(consumer, Direction::ToBlocked);
+        if (r != nullptr && r->block() == block) return consumer->outputs()[0];
+    }
+    Value* blocked = g.createValue(blockedShape(in->shape(), block), DataType::FP32, in->name() + "_nchwc");
+    Node* reorder = g.addNode(std::make_unique<LayoutReorderOp>(Direction::ToBlocked, block, in->shape().dim(1)),
+                              in->name() + "_to_nchwc");
+    reorder->setInputs({in});
+    reorder->setOutputs({blocked});
+    return blocked;
+}
+
+} // namespace
+
+void ConvLayoutPass::run(Graph& g) {
+    blocked_ = 0;
+    reorders_ = 0;
+    cancelled_ = 0;
+
+    const std::size_t block = conv_channel_block();
+    for (Node* node : nodeList(g)) {
+        auto* conv = dynamic_cast<Conv2dOp*>(node->op());
+        if (conv == nullptr || conv->algorithm() != ConvAlgorithm::Auto || conv->channelBlock() != 0) continue;
+        if (node->inputs().size() != 1 || node->outputs().size() != 1) continue;
+        Value* in = node->inputs()[0];
+        Value* out = node->outputs()[0];
+        if (in == nullptr || out == nullptr || in->shape().rank() != 4 || in->dtype() != DataType::FP32) continue;
+
+        const Shape& x = in->shape();
+        const Conv2dShape s = conv->convShape(static_cast<std::size_t>(x.dim(0)), static_cast<std::size_t>(x.dim(2)),
+                                              static_cast<std::size_t>(x.dim(3)));
+        if (!conv_algorithm_supports(ConvAlgorithm::Im2colGemm, s)) continue; // left for validate() to report
+        const ConvAlgorithm algorithm =
+            options_.autotune ? autotune_conv_algorithm(s, true) : select_conv_algorithm(s, true);
+        conv->setAlgorithm(algorithm);
+        if (algorithm != ConvAlgorithm::DirectNchwc) continue;
+
+        // x -> ToBlocked -> conv -> ToPlain -> y; the algorithm follows from the block.
+        conv->setAlgorithm(ConvAlgorithm::Auto);
+        conv->setChannelBlock(block);
+        Value* blocked_out =
+            g.createValue(blockedShape(out->shape(), block), DataType::FP32, out->name() + "_nchwc");
+        Value* blocked_in = blockedInput(g, in, block);
+        node->setInputs({blocked_in});
+        node->setOutputs({blocked_out});
+        Node* to_plain = g.addNode(std::make_unique<LayoutReorderOp>(Direction::ToPlain, block, out->shape().dim(1)),
+                                   out->name() + "_to_nchw");
+        to_plain->setInputs({blocked_out});
+        to_plain->setOutputs({out});
+        ++blocked_;
+    }
+
+    // ToPlain -> v -> ToBlocked: consumers of the ToBlocked output read the blocked
+    // source directly. The ToPlain goes too once v has no other reader.
+    for (Node* node : nodeList(g)) {
+        if (!alive(g, node)) continue;
+        const LayoutReorderOp* to_blocked = reorderOf(node, Direction::ToBlocked);
+        if (to_blocked == nullptr) continue;
+        Value* plain = node->inputs()[0];
+        Node* producer = plain->producer();
+        const LayoutReorderOp* to_plain = reorderOf(producer, Direction::ToPlain);
+        Value* blocked = node->outputs()[0];
+        if (to_plain == nullptr || to_plain->block() != to_blocked->block() || isGraphOutput(g, blocked)) continue;
+
+        Value* source = producer->inputs()[0];
+        const std::vector<Node*> readers = blocked->consumers();
+        for (Node* reader : readers) {
+            std::vector<Value*> ins = reader->inputs();
+            std::replace(ins.begin(), ins.end(), blocked, source);
+            reader->setInputs(std::move(ins));
+        }
+        g.removeNode(node);
+        g.removeValue(blocked);
+        if (plain->consumers().empty() && !isGraphOutput(g, plain)) {
+            g.removeNode(producer);
+            g.removeValue(plain);
+        }
+        ++cancelled_;
+    }
+
+    for (const auto& n : g.nodes()) {
+        if (dynamic_cast<const LayoutReorderOp*>(n->op()) != nullptr) ++reorders_;
+    }
+}
+
+} // namespace infer
@@ -0,0 +1,47 @@
+#include "inference_engine/passes/dead_code_elimination.h"
+
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/value.h"
+
+#include <unordered_set>
+#include <vector>
+
+namespace infer {
+
+void DeadCodeEliminationPass::run(Graph& g) {
+    removed_nodes_ = 0;
+    removed_values_ = 0;
+
+    std::unordered_set<const Node*> live_nodes;
+    std::unordered_set<const Value*> live_values;
+    std::vector<const Value*> stack(g.outputs().begin(), g.outputs().end());
+    while (!stack.empty()) {
+        const Value* v = stack.back();
+        stack.pop_back();
+        if (v == nullptr || !live_values.insert(v).second) continue;
+        const Node* producer = v->producer();
+        if (producer == nullptr || !live_nodes.insert(producer).second) continue;
+        for (const Value* in : producer->inputs()) stack.push_back(in);
+        // Side outputs of a live node are written anyway; keep them.
+        for (const Value* out : producer->outputs()) live_values.insert(out);
+    }
+
+    std::vector<Node*> dead_nodes;
+    for (const auto& n : g.nodes()) {
+        if (live_nodes.count(n.get()) == 0) dead_nodes.push_back(n.get());
+    }
+    for (Node* n : dead_nodes) {
+        if (g.removeNode(n)) ++removed_nodes_;
+    }
+
+    // Every dead Value is now detached; removeValue() refuses graph inputs.
+    std::vector<Value*> dead_values;
+    for (const auto& v : g.values()) {
+        if (live_values.count(v.get()) == 0) dead_values.push_back(v.get());
+    }
+    for (Value* v : dead_values) {
+        if (g.removeValue(v)) ++removed_values_;
+    }
+}
+
+} // namespace infer
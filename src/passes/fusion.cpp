@@ -0,0 +1,162 @@
+#include "inference_engine/passes/fusion.h"
+
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/ops/binary_elementwise.h"
+#include "inference_engine/ops/conv2d.h"
+#include "inference_engine/ops/fused_elementwise.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/matmul_bias_blockq.h"
+#include "inference_engine/ops/matmul_bias_fp16.h"
+#include "inference_engine/ops/matmul_bias_sparse.h"
+#include "inference_engine/ops/quantized_linear.h"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+
+namespace {
+
+// The Value `producer` hands to exactly one other node, or nullptr when the link
+// cannot be fused (several outputs or consumers, or the Value is observable as a
+// graph output).
+Value* fusibleOutput(const Graph& g, const Node* producer) {
+    if (producer->outputs().size() != 1) return nullptr;
+    Value* v = producer->outputs()[0];
+    if (v == nullptr || v->consumers().size() != 1) return nullptr;
+    const auto& outs = g.outputs();
+    if (std::find(outs.begin(), outs.end(), v) != outs.end()) return nullptr;
+    const Node* consumer = v->consumers()[0];
+    if (consumer->inputs().size() != 1 || consumer->outputs().size() != 1) return nullptr;
+    return v;
+}
+
+// `consumer` is the sole consumer of keep's only output: make keep produce the
+// consumer's output instead and delete the consumer and the intermediate.
+void splice(Graph& g, Node* keep, Node* consumer) {
+    Value* intermediate = keep->outputs()[0];
+    Value* out = consumer->outputs()[0];
+    const std::string info = (keep->debugInfo().empty() ? keep->name() : keep->debugInfo()) + " + " + consumer->name();
+    g.removeNode(consumer);
+    keep->setOutputs({out});
+    keep->setDebugInfo("fused: " + info);
+    g.removeValue(intermediate);
+}
+
+// Sets a ReLU epilogue on dense and convolution layers that support one and have
+// none yet.
+bool tryEnableRelu(Operator* op, const Value* out) {
+    if (out->dtype() != DataType::FP32) return false;
+    if (auto* fc = dynamic_cast<MatMulBiasOp*>(op)) {
+        if (fc->activation() != Activation::None) return false;
+        fc->setActivation(Activation::ReLU);
+        return true;
+    }
+    if (auto* fc16 = dynamic_cast<MatMulBiasFp16Op*>(op)) {
+        if (fc16->activation() != Activation::None) return false;
+        fc16->setActivation(Activation::ReLU);
+        return true;
+    }
+    if (auto* fcq = dynamic_cast<MatMulBiasBlockQOp*>(op)) {
+        if (fcq->activation() != Activation::None) return false;
+        fcq->setActivation(Activation::ReLU);
+        return true;
+    }
+    if (auto* fcs = dynamic_cast<MatMulBiasSparseOp*>(op)) {
+        if (fcs->activation() != Activation::None) return false;
+        fcs->setActivation(Activation::ReLU);
+        return true;
+    }
+    if (auto* conv = dynamic_cast<Conv2dOp*>(op)) {
+        if (conv->activation() != Activation::None) return false;
+        conv->setActivation(Activation::ReLU);
+        return true;
+    }
+    if (auto* q = dynamic_cast<QuantizedLinearOp*>(op)) {
+        if (q->activation() != Activation::None) return false;
+        q->setActivation(Activation::ReLU);
+        return true;
+    }
+    return false;
+}
+
+// Snapshot of the current nodes; rewrites remove entries, so callers skip dead ones.
+std::vector<Node*> nodeList(const Graph& g) {
+    std::vector<Node*> nodes;
+    nodes.reserve(g.nodes().size());
+    for (const auto& n : g.nodes()) nodes.push_back(n.get());
+    return nodes;
+}
+
+bool alive(const Graph& g, const Node* n) {
+    return std::any_of(g.nodes().begin(), g.nodes().end(), [n](const auto& p) { return p.get() == n; });
+}
+
+} // namespace
+
+void FuseLinearActivationPass::run(Graph& g) {
+    fused_ = 0;
+    for (Node* node : nodeList(g)) {
+        if (!alive(g, node) || node->op() == nullptr) continue;
+        Value* v = fusibleOutput(g, node);
+        if (v == nullptr) continue;
+        Node* consumer = v->consumers()[0];
+        if (consumer->op() == nullptr) continue;
+        const auto steps = elementwiseSteps(*consumer->op());
+        if (!steps || steps->front() != ElementwiseKind::ReLU) continue;
+        if (!tryEnableRelu(node->op(), v)) continue;
+
+        ++fused_;
+        if (steps->size() == 1) {
+            splice(g, node, consumer);
+        } else {
+            // Keep the rest of the chain; only its leading ReLU moves into the GEMM.
+            consumer->setOperator(
+                std::make_unique<FusedElementwiseOp>(std::vector<ElementwiseKind>(steps->begin() + 1, steps->end())));
+        }
+    }
+}
+
+void FuseElementwiseChainPass::run(Graph& g) {
+    fused_ = 0;
+    for (Node* node : nodeList(g)) {
+        if (!alive(g, node) || node->op() == nullptr) continue;
+        // A binary operator takes the chain as its epilogue.
+        auto* binary = dynamic_cast<BinaryElementwiseOp*>(node->op());
+        auto steps = binary != nullptr ? std::optional<std::vector<ElementwiseKind>>(binary->epilogue())
+                                       : elementwiseSteps(*node->op());
+        if (!steps) continue;
+
+        bool grew = false;
+        while (Value* v = fusibleOutput(g, node)) {
+            Node* next = v->consumers()[0];
+            const auto more = next->op() != nullptr ? elementwiseSteps(*next->op()) : std::nullopt;
+            if (!more || v->dtype() != DataType::FP32) break;
+            steps->insert(steps->end(), more->begin(), more->end());
+            splice(g, node, next);
+            ++fused_;
+            grew = true;
+        }
+        if (grew && binary != nullptr) {
+            binary->setEpilogue(std::move(*steps));
+        } else if (grew) {
+            node->setOperator(std::make_unique<FusedElementwiseOp>(std::move(*steps)));
+        }
+    }
+}
+
+void FusionPass::run(Graph& g) {
+    FuseElementwiseChainPass chains;
+    chains.run(g);
+    FuseLinearActivationPass linear;
+    linear.run(g);
+    fused_ = chains.fusedCount() + linear.fusedCount();
+}
+
+} // namespace infer
@@ -0,0 +1,41 @@
+#include "inference_engine/passes/shape_inference.h"
+
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/value.h"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace infer {
+
+ShapeInferencePass::ShapeInferencePass(std::vector<inference_engine::core::Shape> input_shapes)
+    : input_shapes_(std::move(input_shapes)) {}
+
+void ShapeInferencePass::run(Graph& g) {
+    if (input_shapes_.size() != g.inputs().size()) {
+        throw std::invalid_argument("ShapeInferencePass: expected " + std::to_string(g.inputs().size()) +
+                                    " input shapes, got " + std::to_string(input_shapes_.size()));
+    }
+    for (std::size_t i = 0; i < input_shapes_.size(); ++i) {
+        Value* in = g.inputs()[i];
+        if (input_shapes_[i].rank() != in->shape().rank()) {
+            throw std::invalid_argument("ShapeInferencePass: input '" + in->name() + "' has rank " +
+                                        std::to_string(in->shape().rank()) + ", got " +
+                                        inference_engine::core::shape_to_string(input_shapes_[i]));
+        }
+        in->setShape(input_shapes_[i]);
+    }
+
+    const auto order = g.topologicalSort();
+    if (order.size() != g.nodes().size()) {
+        throw std::runtime_error("ShapeInferencePass: graph has cycles");
+    }
+    for (Node* node : order) {
+        if (node->op() != nullptr) node->op()->inferShapes();
+    }
+    g.invalidate();
+}
+
+} // namespace infer
@@ -0,0 +1,127 @@
+#include "inference_engine/passes/sparse_linear.h"
+
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/kernels/linear_sparse.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/matmul_bias_sparse.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+
+namespace {
+
+const SparsePattern kCandidates[] = {
+    SparsePattern::nm(1, 4),       SparsePattern::nm(2, 4),       SparsePattern::nm(1, 8), SparsePattern::nm(2, 8),
+    SparsePattern::nm(4, 8),       SparsePattern::blockCsr(8, 1), SparsePattern::blockCsr(4, 4),
+};
+
+// Time of one multiplied weight relative to a weight of the dense packed kernel. Up
+// to a few rows every kernel streams its weights once, the sparse ones paying for
+// their index data; past that the dense kernel reuses each weight across a register
+// tile of rows, which the sparse kernels only partly match.
+double weightCost(const SparsePattern& p, std::int64_t batch) {
+    const bool small = batch <= 4;
+    if (p.format == SparseFormat::NM) return small ? 1.15 : 1.9;
+    if (p.block_out == 8) return small ? 1.25 : 2.8;
+    return small ? 1.0 : 1.9;
+}
+
+// A sparse layer must be estimated (or measured) below this fraction of the dense
+// time to be switched; closer calls are not worth the risk of a misestimate.
+constexpr double kMinGain = 0.85;
+
+// Best of three runs of `op` on synthetic [batch, k] input, in microseconds per call.
+double timeLayer(Operator& op, std::int64_t batch, std::int64_t k, std::int64_t n) {
+    std::vector<float> x(static_cast<std::size_t>(batch * k));
+    for (std::size_t i = 0; i < x.size(); ++i) x[i] = std::sin(0.37f * static_cast<float>(i));
+    Value in(Shape({batch, k}), DataType::FP32, "x");
+    Value out(Shape({batch, n}), DataType::FP32, "y");
+    Tensor xt(Shape({batch, k}), DataType::FP32, x.data(), false);
+    in.setTensor(&xt);
+    op.setInputs({&in});
+    op.setOutputs({&out});
+    op.execute();
+
+    using Clock = std::chrono::steady_clock;
+    double best = 0.0;
+    for (int run = 0; run < 3; ++run) {
+        const auto t0 = Clock::now();
+        int calls = 0;
+        double us = 0.0;
+        do {
+            op.execute();
+            ++calls;
+            us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+        } while (us < 2000.0);
+        best = run == 0 ? us / calls : std::min(best, us / calls);
+    }
+    return best;
+}
+
+} // namespace
+
+void SparseLinearPass::run(Graph& g) {
+    sparse_ = 0;
+    for (const auto& entry : g.nodes()) {
+        Node* node = entry.get();
+        auto* fc = dynamic_cast<MatMulBiasOp*>(node->op());
+        if (fc == nullptr || node->inputs().size() != 1 || node->outputs().size() != 1) continue;
+        const Value* in = node->inputs()[0];
+        if (in == nullptr || in->dtype() != DataType::FP32 || in->shape().rank() != 2) continue;
+
+        const auto k = static_cast<std::size_t>(fc->inDim());
+        const auto n = static_cast<std::size_t>(fc->outDim());
+        std::vector<float> unpacked;
+        const float* w = fc->weights().data();
+        if (fc->weights().empty()) {
+            unpacked = fc->rowMajorWeights();
+            w = unpacked.data();
+        }
+        const auto dense = static_cast<double>(k * n);
+        const auto nonzero = static_cast<double>(k * n - static_cast<std::size_t>(std::count(w, w + k * n, 0.0f)));
+        if (nonzero > options_.max_density * dense) continue;
+
+        const std::int64_t batch = std::max<std::int64_t>(1, in->shape().dim(0));
+        const SparsePattern* pick = nullptr;
+        if (options_.autotune) {
+            std::unique_ptr<Operator> reference = fc->clone();
+            reference->prepackWeights(nullptr, nullptr, node->name());
+            double best = kMinGain * timeLayer(*reference, batch, fc->inDim(), fc->outDim());
+            for (const SparsePattern& p : kCandidates) {
+                if (!fits_sparse_pattern(w, k, n, p)) continue;
+                auto candidate = MatMulBiasSparseOp::fromFloat(fc->inDim(), fc->outDim(), w, fc->bias(), p);
+                const double t = timeLayer(*candidate, batch, fc->inDim(), fc->outDim());
+                if (t < best) {
+                    best = t;
+                    pick = &p;
+                }
+            }
+        } else {
+            double best = kMinGain * dense;
+            for (const SparsePattern& p : kCandidates) {
+                if (!fits_sparse_pattern(w, k, n, p)) continue;
+                const double cost = static_cast<double>(sparse_stored_weights(w, k, n, p)) * weightCost(p, batch);
+                if (cost < best) {
+                    best = cost;
+                    pick = &p;
+                }
+            }
+        }
+        if (pick == nullptr) continue;
+        node->setOperator(
+            MatMulBiasSparseOp::fromFloat(fc->inDim(), fc->outDim(), w, fc->bias(), *pick, fc->activation()));
+        ++sparse_;
+    }
+}
+
+} // namespace infer
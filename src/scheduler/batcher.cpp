@@ -0,0 +1,194 @@
+#include "inference_engine/scheduler/batcher.h"
+#include "inference_engine/core/model.h"
+#include "inference_engine/graph/execution_context.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/value.h"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+namespace infer {
+
+using inference_engine::core::DataType;
+using inference_engine::core::DimVector;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using inference_engine::core::bytes_per_element;
+
+namespace {
+
+std::size_t rowBytes(const Shape& shape, DataType dtype) {
+    std::size_t n = bytes_per_element(dtype);
+    for (std::size_t i = 1; i < shape.rank(); ++i) {
+        n *= static_cast<std::size_t>(shape.dim(i));
+    }
+    return n;
+}
+
+// True if `sample` is one row of `batched`: [1, d1, ...] or [d1, ...].
+bool isRowOf(const Shape& sample, const Shape& batched) {
+    const auto& s = sample.dims();
+    const auto& b = batched.dims();
+    if (s.size() == b.size()) {
+        return s[0] == 1 && std::equal(s.begin() + 1, s.end(), b.begin() + 1);
+    }
+    return s.size() + 1 == b.size() && std::equal(s.begin(), s.end(), b.begin() + 1);
+}
+
+} // namespace
+
+DynamicBatcher::DynamicBatcher(Model& model, BatcherOptions options)
+    : model_(model), options_(options) {
+    const ExecutionPlan& plan = model_.plan();
+    if (plan.inputs().size() != 1 || plan.outputs().size() != 1) {
+        throw std::invalid_argument("DynamicBatcher: expected a single-input, single-output model");
+    }
+    const Value* in = plan.inputs()[0];
+    const Value* out = plan.outputs()[0];
+    if (in->shape().rank() == 0 || out->shape().rank() == 0 || in->shape().dim(0) != out->shape().dim(0) ||
+        in->shape().dim(0) < 1) {
+        throw std::invalid_argument("DynamicBatcher: input and output must share a leading batch dimension");
+    }
+    compiled_batch_ = static_cast<std::size_t>(in->shape().dim(0));
+    max_batch_ = options_.max_batch_size == 0 ? compiled_batch_ : options_.max_batch_size;
+    if (max_batch_ > compiled_batch_) {
+        throw std::invalid_argument("DynamicBatcher: max_batch_size " + std::to_string(max_batch_) +
+                                    " exceeds the compiled batch of " + std::to_string(compiled_batch_));
+    }
+
+    input_shape_ = in->shape();
+    input_dtype_ = in->dtype();
+    output_dtype_ = out->dtype();
+    DimVector row_dims = out->shape().dims();
+    row_dims[0] = 1;
+    output_row_shape_ = Shape(std::move(row_dims));
+    row_bytes_in_ = rowBytes(input_shape_, input_dtype_);
+    row_bytes_out_ = rowBytes(out->shape(), output_dtype_);
+
+    const std::size_t in_bytes = row_bytes_in_ * compiled_batch_;
+    batch_buf_.assign((in_bytes + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t), 0);
+    ctx_ = plan.createContext();
+
+    dispatcher_ = std::thread([this]() { dispatchLoop(); });
+}
+
+DynamicBatcher::~DynamicBatcher() {
+    shutdown();
+}
+
+void DynamicBatcher::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (dispatcher_.joinable()) {
+        dispatcher_.join();
+    }
+}
+
+std::future<Tensor> DynamicBatcher::submit(const Tensor& sample) {
+    if (sample.dtype() != input_dtype_ || !isRowOf(sample.shape(), input_shape_)) {
+        throw std::invalid_argument("DynamicBatcher::submit: sample " +
+                                    inference_engine::core::shape_to_string(sample.shape()) +
+                                    " is not a row of the model input " +
+                                    inference_engine::core::shape_to_string(input_shape_));
+    }
+    if (sample.data() == nullptr || !sample.is_contiguous()) {
+        throw std::invalid_argument("DynamicBatcher::submit: sample must be contiguous and non-empty");
+    }
+
+    Request req;
+    const auto* src = static_cast<const std::uint8_t*>(sample.data());
+    req.input.assign(src, src + row_bytes_in_);
+    std::future<Tensor> result = req.result.get_future();
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (stopping_) {
+            throw std::runtime_error("DynamicBatcher::submit: batcher is shut down");
+        }
+        req.enqueued = std::chrono::steady_clock::now();
+        queue_.push_back(std::move(req));
+        ++stats_.requests;
+        stats_.max_queue_depth = std::max<std::uint64_t>(stats_.max_queue_depth, queue_.size());
+    }
+    cv_.notify_one();
+    return result;
+}
+
+DynamicBatcher::Stats DynamicBatcher::stats() const {
+    Stats s;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        s = stats_;
+        s.queue_depth = queue_.size();
+    }
+    s.wait = wait_.snapshot();
+    return s;
+}
+
+void DynamicBatcher::dispatchLoop() {
+    std::vector<Request> batch;
+    batch.reserve(max_batch_);
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mu_);
+            cv_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return; // stopping and drained
+            }
+            // Hold the batch open until it is full or its oldest request is due.
+            const auto deadline = queue_.front().enqueued + options_.max_wait;
+            cv_.wait_until(lock, deadline, [this]() { return stopping_ || queue_.size() >= max_batch_; });
+            const std::size_t n = std::min(queue_.size(), max_batch_);
+            const auto now = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < n; ++i) {
+                const auto waited = std::chrono::duration_cast<std::chrono::nanoseconds>(now - queue_.front().enqueued);
+                wait_.record(static_cast<std::uint64_t>(std::max<std::int64_t>(0, waited.count())));
+                batch.push_back(std::move(queue_.front()));
+                queue_.pop_front();
+            }
+            ++stats_.batches;
+            stats_.padded_rows += compiled_batch_ - n;
+        }
+        runBatch(batch);
+        batch.clear();
+    }
+}
+
+void DynamicBatcher::runBatch(std::vector<Request>& batch) {
+    auto* dst = reinterpret_cast<std::uint8_t*>(batch_buf_.data());
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        std::memcpy(dst + i * row_bytes_in_, batch[i].input.data(), row_bytes_in_);
+    }
+    // Zero the padding rows so they stay finite through every operator.
+    if (batch.size() < compiled_batch_) {
+        std::memset(dst + batch.size() * row_bytes_in_, 0, (compiled_batch_ - batch.size()) * row_bytes_in_);
+    }
+
+    Tensor out;
+    try {
+        out = model_.infer(*ctx_, Tensor(input_shape_, input_dtype_, dst, false));
+    } catch (...) {
+        const std::exception_ptr error = std::current_exception();
+        for (Request& req : batch) {
+            req.result.set_exception(error);
+        }
+        return;
+    }
+    const auto* rows = static_cast<const std::uint8_t*>(out.data());
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        try {
+            auto* row = new std::uint8_t[row_bytes_out_];
+            std::memcpy(row, rows + i * row_bytes_out_, row_bytes_out_);
+            batch[i].result.set_value(Tensor(output_row_shape_, output_dtype_, row, true));
+        } catch (...) {
+            batch[i].result.set_exception(std::current_exception());
+        }
+    }
+}
+
+} // namespace infer
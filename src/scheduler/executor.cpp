@@ -0,0 +1,129 @@
+#include "inference_engine/scheduler/executor.h"
+
+#include "inference_engine/graph/metrics.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/profiler.h"
+
+#include <chrono>
+#include <stdexcept>
+
+namespace infer {
+
+using inference_engine::core::Tensor;
+
+ParallelExecutor::ParallelExecutor(ExecutionPlan& plan, ThreadPool& pool) : plan_(plan), pool_(pool) {
+    if (!plan_.memoryPlan().concurrent) {
+        throw std::invalid_argument(
+            "ParallelExecutor: plan was compiled without CompileOptions::parallel");
+    }
+    const auto& steps = plan_.steps();
+    remaining_ = std::make_unique<std::atomic<std::uint32_t>[]>(steps.size());
+    for (std::uint32_t i = 0; i < steps.size(); ++i) {
+        if (steps[i].num_predecessors == 0) {
+            roots_.push_back(i);
+        }
+    }
+}
+
+void ParallelExecutor::run(const std::vector<Tensor>& inputs, std::vector<Tensor>& outputs) {
+    plan_.bindInputs(inputs);
+    ctx_ = nullptr;
+    runSteps();
+    plan_.collectOutputs(outputs);
+}
+
+void ParallelExecutor::run(ExecutionContext& ctx, const std::vector<Tensor>& inputs, std::vector<Tensor>& outputs) {
+    plan_.bindInputs(ctx, inputs);
+    ctx_ = &ctx;
+    try {
+        runSteps();
+    } catch (...) {
+        ctx_ = nullptr;
+        throw;
+    }
+    ctx_ = nullptr;
+    plan_.collectOutputs(ctx, outputs);
+}
+
+void ParallelExecutor::runSteps() {
+    const auto& steps = plan_.steps();
+    if (!steps.empty()) {
+        for (std::uint32_t i = 0; i < steps.size(); ++i) {
+            remaining_[i].store(steps[i].num_predecessors, std::memory_order_relaxed);
+            if (ctx_ == nullptr) steps[i].node->resetExecutionState();
+        }
+        failed_.store(false, std::memory_order_relaxed);
+        error_ = nullptr;
+        profiler_ = Profiler::current();
+        metrics_ = MetricsRegistry::current();
+        outstanding_.store(steps.size(), std::memory_order_release);
+        done_ = false;
+
+        // Operators calling infer::parallelFor from this thread reach the pool too.
+        ThreadPool::Scope scope(&pool_);
+        for (std::uint32_t root : roots_) {
+            submit(root);
+        }
+
+        // Help with queued work until the last step has completed. Completion is
+        // observed under mu_, so the last worker is done with this executor (and
+        // its mutex and condition variable) before run() can return.
+        std::unique_lock<std::mutex> lock(mu_);
+        while (!done_) {
+            lock.unlock();
+            const bool ran = pool_.tryRunOne();
+            lock.lock();
+            if (!ran) done_cv_.wait_for(lock, std::chrono::microseconds(200), [this] { return done_; });
+        }
+        lock.unlock();
+
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+    }
+}
+
+void ParallelExecutor::submit(std::uint32_t step) {
+    if (ctx_ == nullptr) {
+        auto* node = plan_.steps()[step].node;
+        node->setReady(true);
+        node->setScheduled(true);
+    }
+    pool_.enqueue([this, step] { runStep(step); });
+}
+
+void ParallelExecutor::runStep(std::uint32_t step) {
+    const auto& s = plan_.steps()[step];
+    if (!failed_.load(std::memory_order_acquire)) {
+        try {
+            ExecutionContext::Scope scope(ctx_);
+            if (profiler_ == nullptr && metrics_ == nullptr) {
+                s.op->execute();
+            } else {
+                executeStep(s, profiler_, metrics_);
+            }
+            if (ctx_ == nullptr) s.node->setExecuted(true);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mu_);
+            if (!error_) {
+                error_ = std::current_exception();
+            }
+            failed_.store(true, std::memory_order_release);
+        }
+    }
+
+    for (std::uint32_t next : s.successors) {
+        if (remaining_[next].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            submit(next);
+        }
+    }
+
+    if (outstanding_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(mu_);
+        done_ = true;
+        done_cv_.notify_all();
+    }
+}
+
+} // namespace infer
@@ -0,0 +1,215 @@
+#include "inference_engine/scheduler/pipeline.h"
+#include "inference_engine/core/model.h"
+#include "inference_engine/graph/execution_context.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/value.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace infer {
+
+using inference_engine::core::Tensor;
+
+namespace {
+
+void copyRequest(const Tensor& request, Tensor& input) {
+    if (request.dtype() != input.dtype() || request.num_elements() != input.num_elements() ||
+        !request.is_contiguous() || request.data() == nullptr) {
+        throw std::invalid_argument("InferencePipeline: request " +
+                                    inference_engine::core::shape_to_string(request.shape()) +
+                                    " does not match the model input " +
+                                    inference_engine::core::shape_to_string(input.shape()));
+    }
+    std::memcpy(input.data(), request.data(), static_cast<std::size_t>(input.byte_size()));
+}
+
+Tensor copyOutput(const Tensor& output) {
+    return output.clone();
+}
+
+} // namespace
+
+InferencePipeline::InferencePipeline(Model& model, ThreadPool& pool, PipelineOptions options, Preprocess preprocess,
+                                     Postprocess postprocess)
+    : model_(model),
+      pool_(pool),
+      preprocess_(preprocess ? std::move(preprocess) : Preprocess(copyRequest)),
+      postprocess_(postprocess ? std::move(postprocess) : Postprocess(copyOutput)) {
+    if (options.depth == 0) {
+        throw std::invalid_argument("InferencePipeline: depth must be at least 1");
+    }
+    const ExecutionPlan& plan = model_.plan();
+    if (plan.inputs().size() != 1) {
+        throw std::invalid_argument("InferencePipeline: expected a single-input model");
+    }
+    const Value* in = plan.inputs()[0];
+    const std::size_t bytes = in->shape().num_elements() * inference_engine::core::bytes_per_element(in->dtype());
+
+    // Slot arenas live on the pool's NUMA node when it has one.
+    inference_engine::memory::PageOptions pages = plan.memoryPlan().arena_pages;
+    if (pool_.numaNode() != inference_engine::memory::kAnyNumaNode) {
+        pages.numa_node = pool_.numaNode();
+    }
+
+    slots_.reserve(options.depth);
+    free_.reserve(options.depth);
+    for (std::size_t i = 0; i < options.depth; ++i) {
+        auto slot = std::make_unique<Slot>();
+        slot->ctx = plan.createContext(pages);
+        slot->staging.assign((bytes + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t), 0);
+        slot->input = Tensor(in->shape(), in->dtype(), slot->staging.data(), false);
+        if (in->hasQuantization()) {
+            const auto& qp = *in->quantization();
+            slot->input.set_quant_params(qp.scale, qp.zero_point);
+        }
+        free_.push_back(slot.get());
+        slots_.push_back(std::move(slot));
+    }
+}
+
+InferencePipeline::~InferencePipeline() {
+    drain();
+}
+
+std::future<Tensor> InferencePipeline::submit(const Tensor& request) {
+    auto promise = std::make_shared<std::promise<Tensor>>();
+    std::future<Tensor> result = promise->get_future();
+    submit(request, [promise](Tensor value, std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value(std::move(value));
+        }
+    });
+    return result;
+}
+
+void InferencePipeline::submit(const Tensor& request, Callback done) {
+    Slot* slot = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        ++in_flight_;
+        if (free_.empty()) {
+            pending_.push_back(Pending{request, std::move(done)});
+            return;
+        }
+        slot = free_.back();
+        free_.pop_back();
+    }
+    slot->request = request;
+    slot->done = std::move(done);
+    start(slot);
+}
+
+void InferencePipeline::drain() {
+    std::unique_lock<std::mutex> lock(mu_);
+    idle_cv_.wait(lock, [this]() { return in_flight_ == 0; });
+}
+
+std::size_t InferencePipeline::inFlight() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return in_flight_;
+}
+
+// ==================== Stages ====================
+
+void InferencePipeline::dispatch(std::function<void()> task) {
+    if (pool_.size() == 0) {
+        task();
+    } else {
+        pool_.enqueue(std::move(task));
+    }
+}
+
+void InferencePipeline::start(Slot* slot) {
+    dispatch([this, slot]() { runPreprocess(slot); });
+}
+
+void InferencePipeline::runPreprocess(Slot* slot) {
+    try {
+        preprocess_(slot->request, slot->input);
+    } catch (...) {
+        slot->error = std::current_exception();
+        finish(slot, Tensor{});
+        return;
+    }
+    bool start_compute = false;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        ready_.push_back(slot);
+        if (!computing_) {
+            computing_ = true;
+            start_compute = true;
+        }
+    }
+    if (start_compute) {
+        dispatch([this]() { runCompute(); });
+    }
+}
+
+void InferencePipeline::runCompute() {
+    // One compute task at a time drains the ready queue in order.
+    for (;;) {
+        Slot* slot = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            if (ready_.empty()) {
+                computing_ = false;
+                return;
+            }
+            slot = ready_.front();
+            ready_.pop_front();
+        }
+        try {
+            slot->output = model_.infer(*slot->ctx, slot->input);
+        } catch (...) {
+            slot->error = std::current_exception();
+        }
+        dispatch([this, slot]() { runPostprocess(slot); });
+    }
+}
+
+void InferencePipeline::runPostprocess(Slot* slot) {
+    Tensor result;
+    if (!slot->error) {
+        try {
+            result = postprocess_(slot->output);
+        } catch (...) {
+            slot->error = std::current_exception();
+        }
+    }
+    finish(slot, std::move(result));
+}
+
+void InferencePipeline::finish(Slot* slot, Tensor result) {
+    Callback done = std::move(slot->done);
+    const std::exception_ptr error = slot->error;
+    slot->done = nullptr;
+    slot->error = nullptr;
+    slot->request = Tensor{};
+    slot->output = Tensor{};
+    done(error ? Tensor{} : std::move(result), error);
+
+    bool reuse = false;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (!pending_.empty()) {
+            slot->request = pending_.front().request;
+            slot->done = std::move(pending_.front().done);
+            pending_.pop_front();
+            reuse = true;
+        } else {
+            free_.push_back(slot);
+        }
+        --in_flight_;
+        // Notified under the lock: drain() may destroy the pipeline once it wakes.
+        idle_cv_.notify_all();
+    }
+    if (reuse) {
+        start(slot);
+    }
+}
+
+} // namespace infer
@@ -0,0 +1,289 @@
+#include "inference_engine/scheduler/pipeline_executor.h"
+
+#include "inference_engine/graph/execution_context.h"
+#include "inference_engine/graph/metrics.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/profiler.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace infer {
+
+using inference_engine::core::Tensor;
+
+namespace {
+
+// Polls before a consumer parks: a stage that is briefly ahead of its producer
+// should not pay for a futex round trip per micro-batch.
+constexpr int kSpinRounds = 64;
+
+// Smallest stage count greedy packing needs when no stage may exceed `bound`.
+std::size_t stagesNeeded(const std::vector<std::uint64_t>& costs, std::uint64_t bound) {
+    std::size_t stages = 1;
+    std::uint64_t sum = 0;
+    for (std::uint64_t c : costs) {
+        if (sum + c > bound) {
+            ++stages;
+            sum = 0;
+        }
+        sum += c;
+    }
+    return stages;
+}
+
+} // namespace
+
+std::uint64_t stepCost(const ExecutionPlan::Step& step) noexcept {
+    const std::uint64_t cost = step.op->estimateFlops() + static_cast<std::uint64_t>(step.op->estimateMemoryBytes());
+    return std::max<std::uint64_t>(1, cost);
+}
+
+std::vector<PipelineStage> partitionStages(const ExecutionPlan& plan, std::size_t stages) {
+    const auto& steps = plan.steps();
+    std::vector<PipelineStage> out;
+    if (steps.empty() || stages == 0) return out;
+    stages = std::min(stages, steps.size());
+
+    std::vector<std::uint64_t> costs;
+    costs.reserve(steps.size());
+    std::uint64_t lo = 0;
+    std::uint64_t hi = 0;
+    for (const auto& step : steps) {
+        costs.push_back(stepCost(step));
+        lo = std::max(lo, costs.back());
+        hi += costs.back();
+    }
+    // Smallest bound on the largest stage that still fits into `stages` ranges.
+    while (lo < hi) {
+        const std::uint64_t mid = lo + (hi - lo) / 2;
+        if (stagesNeeded(costs, mid) <= stages) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    // Pack greedily under the bound, closing a stage early once the remaining steps
+    // are just enough to give every remaining stage one.
+    out.reserve(stages);
+    out.push_back(PipelineStage{});
+    for (std::size_t i = 0; i < costs.size(); ++i) {
+        PipelineStage* cur = &out.back();
+        const bool must_split = steps.size() - i == stages - out.size();
+        if (cur->end > cur->begin && (cur->cost + costs[i] > lo || must_split)) {
+            out.push_back(PipelineStage{i, i, 0, {}});
+            cur = &out.back();
+        }
+        cur->end = i + 1;
+        cur->cost += costs[i];
+    }
+    return out;
+}
+
+// ==================== Signal ====================
+
+template <typename Ready>
+void PipelineExecutor::Signal::wait(Ready ready) {
+    for (int i = 0; i < kSpinRounds; ++i) {
+        if (ready()) return;
+        std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> lock(mu);
+    parked.store(true, std::memory_order_relaxed);
+    // Pairs with the fence in notify(): either the producer sees `parked` or this
+    // thread's re-check of `ready` sees the producer's push.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    cv.wait(lock, ready);
+    parked.store(false, std::memory_order_relaxed);
+}
+
+void PipelineExecutor::Signal::notify() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parked.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(mu);
+        cv.notify_one();
+    }
+}
+
+// ==================== Lifetime ====================
+
+PipelineExecutor::PipelineExecutor(ExecutionPlan& plan, PipelineExecutorOptions options)
+    : plan_(plan) {
+    if (plan_.steps().empty()) {
+        throw std::invalid_argument("PipelineExecutor: plan has no steps");
+    }
+    if (options.cores_per_stage == 0) {
+        throw std::invalid_argument("PipelineExecutor: cores_per_stage must be at least 1");
+    }
+    const std::size_t cores = options.cores_per_stage;
+    const std::vector<int> cpus = options.pin ? availableCpus() : std::vector<int>{};
+    std::size_t stages = options.stages;
+    if (stages == 0) {
+        const std::size_t available = !cpus.empty() ? cpus.size() : std::max(1u, std::thread::hardware_concurrency());
+        stages = std::max<std::size_t>(1, available / cores);
+    }
+    stages_ = partitionStages(plan_, stages);
+
+    // Consecutive core groups, wrapping around when stages outnumber them.
+    const std::size_t groups = std::max<std::size_t>(1, cpus.size() / cores);
+    for (std::size_t s = 0; s < stages_.size() && !cpus.empty(); ++s) {
+        const std::size_t first = (s % groups) * cores;
+        const std::size_t last = std::min(cpus.size(), first + cores);
+        stages_[s].cpus.assign(cpus.begin() + static_cast<std::ptrdiff_t>(first),
+                               cpus.begin() + static_cast<std::ptrdiff_t>(last));
+    }
+
+    const std::size_t micro_batches = options.micro_batches != 0 ? options.micro_batches : 2 * stages_.size();
+    free_ = std::make_unique<SpscQueue<Slot*>>(micro_batches);
+    slots_.reserve(micro_batches);
+    for (std::size_t i = 0; i < micro_batches; ++i) {
+        auto slot = std::make_unique<Slot>();
+        slot->ctx = plan_.createContext();
+        free_->tryPush(slot.get());
+        slots_.push_back(std::move(slot));
+    }
+
+    stage_state_.reserve(stages_.size());
+    for (const PipelineStage& range : stages_) {
+        auto stage = std::make_unique<Stage>();
+        stage->range = range;
+        if (cores > 1) {
+            stage->pool = std::make_unique<ThreadPool>(cores - 1, range.cpus);
+        }
+        stage->in = std::make_unique<SpscQueue<Slot*>>(micro_batches);
+        stage_state_.push_back(std::move(stage));
+    }
+    for (std::size_t s = 0; s < stage_state_.size(); ++s) {
+        stage_state_[s]->driver = std::thread([this, s]() { stageLoop(s); });
+    }
+}
+
+PipelineExecutor::~PipelineExecutor() {
+    drain();
+    stop_.store(true, std::memory_order_release);
+    for (auto& stage : stage_state_) {
+        {
+            std::lock_guard<std::mutex> lock(stage->signal.mu);
+            stage->signal.cv.notify_all();
+        }
+        stage->driver.join();
+    }
+}
+
+// ==================== Submission ====================
+
+std::future<std::vector<Tensor>> PipelineExecutor::submit(const std::vector<Tensor>& inputs) {
+    auto promise = std::make_shared<std::promise<std::vector<Tensor>>>();
+    std::future<std::vector<Tensor>> result = promise->get_future();
+    submit(inputs, [promise](std::vector<Tensor> outputs, std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value(std::move(outputs));
+        }
+    });
+    return result;
+}
+
+void PipelineExecutor::submit(const std::vector<Tensor>& inputs, Callback done) {
+    std::lock_guard<std::mutex> lock(submit_mu_);
+    Slot* slot = spare_;
+    spare_ = nullptr;
+    if (slot == nullptr) {
+        free_signal_.wait([this, &slot]() { return free_->tryPop(slot); });
+    }
+    try {
+        plan_.bindInputs(*slot->ctx, inputs);
+    } catch (...) {
+        spare_ = slot; // only the last stage may push to free_
+        throw;
+    }
+    slot->done = std::move(done);
+    slot->profiler = Profiler::current();
+    slot->metrics = MetricsRegistry::current();
+    in_flight_.fetch_add(1, std::memory_order_relaxed);
+    Stage& first = *stage_state_.front();
+    first.in->tryPush(slot); // never full: it holds at most every slot
+    first.signal.notify();
+}
+
+void PipelineExecutor::drain() {
+    std::unique_lock<std::mutex> lock(idle_mu_);
+    idle_cv_.wait(lock, [this]() { return in_flight_.load(std::memory_order_acquire) == 0; });
+}
+
+// ==================== Stages ====================
+
+void PipelineExecutor::stageLoop(std::size_t index) {
+    Stage& stage = *stage_state_[index];
+    if (!stage.range.cpus.empty()) {
+        (void)pinCurrentThread(stage.range.cpus);
+    }
+    // Operators calling infer::parallelFor split their work across the stage's cores.
+    ThreadPool::Scope scope(stage.pool.get());
+    Stage* next = index + 1 < stage_state_.size() ? stage_state_[index + 1].get() : nullptr;
+    for (;;) {
+        Slot* slot = nullptr;
+        stage.signal.wait(
+            [this, &stage, &slot]() { return stage.in->tryPop(slot) || stop_.load(std::memory_order_acquire); });
+        if (slot == nullptr) return;
+        runStage(stage, *slot);
+        if (next != nullptr) {
+            next->in->tryPush(slot);
+            next->signal.notify();
+        } else {
+            deliver(*slot);
+        }
+    }
+}
+
+void PipelineExecutor::runStage(const Stage& stage, Slot& slot) {
+    if (slot.error) return;
+    const auto& steps = plan_.steps();
+    try {
+        ExecutionContext::Scope scope(slot.ctx.get());
+        for (std::size_t i = stage.range.begin; i < stage.range.end; ++i) {
+            if (slot.profiler == nullptr && slot.metrics == nullptr) {
+                steps[i].op->execute();
+            } else {
+                executeStep(steps[i], slot.profiler, slot.metrics);
+            }
+        }
+    } catch (...) {
+        slot.error = std::current_exception();
+    }
+}
+
+void PipelineExecutor::deliver(Slot& slot) {
+    std::vector<Tensor> outputs;
+    if (!slot.error) {
+        try {
+            std::vector<Tensor> views;
+            plan_.collectOutputs(*slot.ctx, views);
+            outputs.reserve(views.size());
+            for (const Tensor& view : views) outputs.push_back(view.clone());
+        } catch (...) {
+            slot.error = std::current_exception();
+            outputs.clear();
+        }
+    }
+    Callback done = std::move(slot.done);
+    const std::exception_ptr error = slot.error;
+    slot.done = nullptr;
+    slot.error = nullptr;
+    slot.profiler = nullptr;
+    slot.metrics = nullptr;
+    done(std::move(outputs), error);
+
+    free_->tryPush(&slot);
+    free_signal_.notify();
+    if (in_flight_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // Notified under the lock: drain() may destroy the executor once it wakes.
+        std::lock_guard<std::mutex> lock(idle_mu_);
+        idle_cv_.notify_all();
+    }
+}
+
+} // namespace infer
@@ -0,0 +1,356 @@
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <utility>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace infer {
+
+namespace {
+
+constexpr std::size_t kNoWorker = static_cast<std::size_t>(-1);
+
+thread_local ThreadPool* tl_current_pool = nullptr;
+thread_local const ThreadPool* tl_worker_pool = nullptr;
+thread_local std::size_t tl_worker_index = kNoWorker;
+
+} // namespace
+
+// ==================== Lifetime ====================
+
+ThreadPool::ThreadPool(std::size_t num_threads) {
+    start(num_threads);
+}
+
+ThreadPool::ThreadPool(std::size_t num_threads, int numa_node) : numa_node_(numa_node) {
+    cpus_ = inference_engine::memory::numa_node_cpus(numa_node);
+    if (num_threads == 0 && !cpus_.empty()) {
+        num_threads = cpus_.size();
+    }
+    start(num_threads);
+}
+
+ThreadPool::ThreadPool(std::size_t num_threads, std::vector<int> cpus) : cpus_(std::move(cpus)) {
+    if (num_threads == 0 && !cpus_.empty()) {
+        num_threads = cpus_.size();
+    }
+    start(num_threads);
+}
+
+void ThreadPool::start(std::size_t num_threads) {
+#if defined(ENABLE_MT)
+    if (num_threads == 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+#else
+    num_threads = 0;
+#endif
+    // Always keep at least one queue so external submitters have somewhere to push.
+    const std::size_t num_queues = std::max<std::size_t>(1, num_threads);
+    queues_.reserve(num_queues);
+    for (std::size_t i = 0; i < num_queues; ++i) {
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+    workers_.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; ++i) {
+        workers_.emplace_back([this, i]() { workerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    try {
+        wait();
+    } catch (...) {
+        // Errors of fire-and-forget tasks are dropped on destruction.
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleep_mu_);
+        stop_.store(true, std::memory_order_release);
+    }
+    sleep_cv_.notify_all();
+    for (auto& t : workers_) {
+        t.join();
+    }
+}
+
+// ==================== Submission ====================
+
+void ThreadPool::enqueue(Task task) {
+    pending_.fetch_add(1, std::memory_order_acq_rel);
+
+    std::size_t index;
+    if (tl_worker_pool == this && tl_worker_index != kNoWorker) {
+        index = tl_worker_index;
+    } else {
+        index = next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    }
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mu);
+        queues_[index]->tasks.push_back(std::move(task));
+        queued_.fetch_add(1, std::memory_order_release);
+    }
+    {
+        // Taking the sleep mutex orders this wake-up after a worker's predicate check.
+        std::lock_guard<std::mutex> lock(sleep_mu_);
+    }
+    sleep_cv_.notify_one();
+}
+
+// ==================== Execution ====================
+
+bool ThreadPool::popLocal(std::size_t index, Task& out) {
+    WorkerQueue& q = *queues_[index];
+    std::lock_guard<std::mutex> lock(q.mu);
+    if (q.tasks.empty()) {
+        return false;
+    }
+    out = std::move(q.tasks.back());
+    q.tasks.pop_back();
+    queued_.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
+
+bool ThreadPool::steal(std::size_t thief, Task& out) {
+    const std::size_t n = queues_.size();
+    const std::size_t start = (thief == kNoWorker) ? 0 : thief + 1;
+    for (std::size_t k = 0; k < n; ++k) {
+        const std::size_t victim = (start + k) % n;
+        if (victim == thief) continue;
+        WorkerQueue& q = *queues_[victim];
+        std::lock_guard<std::mutex> lock(q.mu);
+        if (q.tasks.empty()) continue;
+        out = std::move(q.tasks.front());
+        q.tasks.pop_front();
+        queued_.fetch_sub(1, std::memory_order_acq_rel);
+        if (thief != kNoWorker) {
+            steals_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::runTask(Task& task) {
+    const auto t0 = std::chrono::steady_clock::now();
+    try {
+        task();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mu_);
+        if (!first_error_) {
+            first_error_ = std::current_exception();
+        }
+    }
+    task = nullptr;
+    const auto busy = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t0);
+    busy_ns_.fetch_add(static_cast<std::uint64_t>(busy.count()), std::memory_order_relaxed);
+    executed_.fetch_add(1, std::memory_order_relaxed);
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(done_mu_);
+        done_cv_.notify_all();
+    }
+}
+
+bool ThreadPool::tryRunOne() {
+    const std::size_t self = (tl_worker_pool == this) ? tl_worker_index : kNoWorker;
+    Task task;
+    if ((self != kNoWorker && popLocal(self, task)) || steal(self, task)) {
+        runTask(task);
+        return true;
+    }
+    return false;
+}
+
+inference_engine::memory::PageOptions ThreadPool::pageOptions() const noexcept {
+    inference_engine::memory::PageOptions options;
+    options.numa_node = numa_node_;
+    return options;
+}
+
+void ThreadPool::workerLoop(std::size_t index) {
+    if (!cpus_.empty()) {
+        (void)pinCurrentThread(cpus_);
+    }
+    tl_worker_pool = this;
+    tl_worker_index = index;
+    tl_current_pool = this;
+
+    for (;;) {
+        Task task;
+        if (popLocal(index, task) || steal(index, task)) {
+            runTask(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mu_);
+        sleep_cv_.wait(lock, [this]() {
+            return stop_.load(std::memory_order_acquire) || queued_.load(std::memory_order_acquire) > 0;
+        });
+        if (stop_.load(std::memory_order_acquire) && queued_.load(std::memory_order_acquire) == 0) {
+            break;
+        }
+    }
+}
+
+void ThreadPool::wait() {
+    while (pending_.load(std::memory_order_acquire) != 0) {
+        if (tryRunOne()) {
+            continue;
+        }
+        // Remaining work is running on workers; poll so that tasks they spawn can
+        // still be picked up by this thread.
+        std::unique_lock<std::mutex> lock(done_mu_);
+        done_cv_.wait_for(lock, std::chrono::microseconds(200),
+                          [this]() { return pending_.load(std::memory_order_acquire) == 0; });
+    }
+
+    std::exception_ptr err;
+    {
+        std::lock_guard<std::mutex> lock(error_mu_);
+        std::swap(err, first_error_);
+    }
+    if (err) {
+        std::rethrow_exception(err);
+    }
+}
+
+// ==================== Data parallelism ====================
+
+void ThreadPool::parallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+                             const std::function<void(std::size_t, std::size_t)>& fn) {
+    if (end <= begin) {
+        return;
+    }
+    const std::size_t n = end - begin;
+    grain = std::max<std::size_t>(1, grain);
+    const std::size_t max_chunks = std::max<std::size_t>(1, size() * 4);
+    const std::size_t chunks = std::min((n + grain - 1) / grain, max_chunks);
+    if (chunks <= 1 || size() == 0) {
+        fn(begin, end);
+        return;
+    }
+
+    // Shared so helpers that start after the loop finished can still inspect it.
+    struct State {
+        std::atomic<std::size_t> next{0};
+        std::atomic<std::size_t> done{0};
+        std::size_t chunks = 0;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        std::size_t chunk_len = 0;
+        const std::function<void(std::size_t, std::size_t)>* fn = nullptr;
+        std::mutex err_mu;
+        std::exception_ptr err;
+    };
+    auto state = std::make_shared<State>();
+    state->chunks = chunks;
+    state->begin = begin;
+    state->end = end;
+    state->chunk_len = (n + chunks - 1) / chunks;
+    state->fn = &fn;
+
+    auto drain = [](State& s) {
+        for (;;) {
+            const std::size_t c = s.next.fetch_add(1, std::memory_order_relaxed);
+            if (c >= s.chunks) {
+                return;
+            }
+            const std::size_t lo = s.begin + c * s.chunk_len;
+            const std::size_t hi = std::min(s.end, lo + s.chunk_len);
+            try {
+                if (lo < hi) {
+                    (*s.fn)(lo, hi);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(s.err_mu);
+                if (!s.err) s.err = std::current_exception();
+            }
+            s.done.fetch_add(1, std::memory_order_acq_rel);
+        }
+    };
+
+    const std::size_t helpers = std::min(size(), chunks - 1);
+    for (std::size_t i = 0; i < helpers; ++i) {
+        enqueue([state, drain]() { drain(*state); });
+    }
+    drain(*state);
+    while (state->done.load(std::memory_order_acquire) < chunks) {
+        if (!tryRunOne()) {
+            std::this_thread::yield();
+        }
+    }
+    if (state->err) {
+        std::rethrow_exception(state->err);
+    }
+}
+
+ThreadPool::Stats ThreadPool::stats() const noexcept {
+    Stats s;
+    s.executed = executed_.load(std::memory_order_relaxed);
+    s.steals = steals_.load(std::memory_order_relaxed);
+    s.busy_ns = busy_ns_.load(std::memory_order_relaxed);
+    s.queued = queued_.load(std::memory_order_relaxed);
+    return s;
+}
+
+// ==================== Thread association ====================
+
+ThreadPool* ThreadPool::current() noexcept {
+    return tl_current_pool;
+}
+
+ThreadPool::Scope::Scope(ThreadPool* pool) noexcept : previous_(tl_current_pool) {
+    tl_current_pool = pool;
+}
+
+ThreadPool::Scope::~Scope() {
+    tl_current_pool = previous_;
+}
+
+std::vector<int> availableCpus() {
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+        }
+    }
+#endif
+    return cpus;
+}
+
+bool pinCurrentThread(const std::vector<int>& cpus) noexcept {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    bool any = false;
+    for (int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+            any = true;
+        }
+    }
+    return any && pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+void parallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+                 const std::function<void(std::size_t, std::size_t)>& fn) {
+    ThreadPool* pool = ThreadPool::current();
+    if (pool == nullptr) {
+        if (begin < end) fn(begin, end);
+        return;
+    }
+    pool->parallelFor(begin, end, grain, fn);
+}
+
+} // namespace infer
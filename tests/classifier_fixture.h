@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/reshape.h"
+#include "inference_engine/ops/softmax.h"
+
+namespace infer {
+namespace fixtures {
+
+// x[input] -> reshape [batch, features] -> fc -> relu -> softmax -> y[batch, classes]
+// The reshape is only added when `input` has more than two dims, so a [batch, features]
+// input yields the three nodes fc, relu and softmax.
+inline void buildClassifier(Graph& g, const inference_engine::core::Shape& input, std::int64_t classes) {
+	using inference_engine::core::DataType;
+	using inference_engine::core::Shape;
+	const std::int64_t batch = input.dim(0);
+	const std::int64_t features = input.num_elements() / batch;
+	auto link = [&g](std::unique_ptr<Operator> op, Value* in, Value* out) {
+		Node* n = g.addNode(std::move(op));
+		n->setInputs({in});
+		n->setOutputs({out});
+	};
+
+	Value* x = g.createValue(input, DataType::FP32, "x");
+	Value* flat = x;
+	if (input.rank() > 2) {
+		flat = g.createValue(Shape({batch, features}), DataType::FP32, "flat");
+		link(std::make_unique<ReshapeOp>(), x, flat);
+	}
+	Value* h = g.createValue(Shape({batch, classes}), DataType::FP32, "h");
+	Value* r = g.createValue(Shape({batch, classes}), DataType::FP32, "r");
+	Value* y = g.createValue(Shape({batch, classes}), DataType::FP32, "y");
+	std::vector<float> w(static_cast<std::size_t>(features * classes));
+	for (std::size_t i = 0; i < w.size(); ++i) w[i] = std::sin(static_cast<float>(i)) * 0.5f;
+	link(std::make_unique<MatMulBiasOp>(features, classes, w, std::vector<float>(classes, 0.1f)), flat, h);
+	link(std::make_unique<ReluOp>(), h, r);
+	link(std::make_unique<SoftmaxOp>(), r, y);
+	g.setInputs({x});
+	g.setOutputs({y});
+}
+
+} // namespace fixtures
+} // namespace infer
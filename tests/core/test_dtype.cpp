@@ -93,3 +93,11 @@ TEST(DTypeTest, QuantizeDequantize) {
 	float dq = dequantize_symmetric_int8(q, scale);
 	EXPECT_NEAR(dq, 0.5f, 1e-5f);
 }
+
+TEST(DTypeTest, CppTypeMapping) {
+	static_assert(std::is_same_v<DataTypeToCppTypeT<DataType::FP16>, Half>);
+	static_assert(std::is_same_v<DataTypeToCppTypeT<DataType::UINT16>, uint16_t>);
+	EXPECT_EQ(cpp_type_to_datatype<Half>(), DataType::FP16);
+	EXPECT_EQ(cpp_type_to_datatype<uint16_t>(), DataType::UINT16);
+	EXPECT_EQ(cpp_type_to_datatype<float>(), DataType::FP32);
+}
@@ -0,0 +1,530 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/core/model.h"
+#include "inference_engine/core/model_format.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/packed_weight_cache.h"
+#include "inference_engine/graph/weight_store.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/matmul_bias_blockq.h"
+#include "inference_engine/ops/matmul_bias_fp16.h"
+#include "inference_engine/ops/matmul_bias_sparse.h"
+#include "inference_engine/ops/quantized_linear.h"
+#include "inference_engine/ops/softmax.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+// Removes the file when the test ends, pass or fail.
+struct TempFile {
+	explicit TempFile(const std::string& stem)
+		: path((std::filesystem::temp_directory_path() / ("ie_test_model_" + stem + ".iem")).string()) {}
+	~TempFile() { std::remove(path.c_str()); }
+	std::string path;
+};
+
+std::vector<float> ramp(std::size_t n, float scale, float offset) {
+	std::vector<float> v(n);
+	for (std::size_t i = 0; i < n; ++i) v[i] = static_cast<float>(static_cast<int>(i % 7) - 3) * scale + offset;
+	return v;
+}
+
+// x[1, 8] -> MatMulBias(ReLU) [8, 16] -> MatMulBiasFp16 [16, 4] -> Softmax
+// Unlike fixtures::buildClassifier, every node here can be saved, and the named layers
+// cover an FP32 and an FP16 weight tensor. `head_offset` varies the last layer between
+// versions of the model.
+void buildMixedPrecisionModel(Graph& g, float head_offset = 0.125f) {
+	g.setModelName("classifier");
+	g.setModelVersion("3");
+	Value* x = g.createValue(Shape({1, 8}), DataType::FP32, "x");
+	Value* h = g.createValue(Shape({1, 16}), DataType::FP32, "h");
+	Value* logits = g.createValue(Shape({1, 4}), DataType::FP32, "logits");
+	Value* y = g.createValue(Shape({1, 4}), DataType::FP32, "y");
+	g.setInputs({x});
+	g.setOutputs({y});
+	Node* fc1 = g.addNode(std::make_unique<MatMulBiasOp>(8, 16, ramp(8 * 16, 0.25f, 0.0f), ramp(16, 0.1f, 0.05f),
+														 Activation::ReLU),
+						  "fc1");
+	fc1->setInputs({x});
+	fc1->setOutputs({h});
+	Node* fc2 =
+		g.addNode(MatMulBiasFp16Op::fromFloat(16, 4, ramp(16 * 4, 0.5f, head_offset), ramp(4, 0.5f, 0.0f)), "fc2");
+	fc2->setInputs({h});
+	fc2->setOutputs({logits});
+	Node* sm = g.addNode(std::make_unique<SoftmaxOp>(), "softmax");
+	sm->setInputs({logits});
+	sm->setOutputs({y});
+}
+
+std::vector<char> readAll(const std::string& path) {
+	std::ifstream in(path, std::ios::binary);
+	return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeAll(const std::string& path, const std::vector<char>& bytes) {
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+} // namespace
+
+TEST(ModelTest, SaveLoadRoundTripMatchesInMemoryGraph) {
+	TempFile file("roundtrip");
+	Model source;
+	buildMixedPrecisionModel(source.graph());
+	source.save(file.path);
+
+	std::vector<float> input = ramp(8, 0.3f, 0.2f);
+	Tensor x(Shape({1, 8}), DataType::FP32, input.data(), false);
+	const Tensor expected_view = source.infer(x);
+	const std::vector<float> expected(expected_view.data_as<float>(), expected_view.data_as<float>() + 4);
+
+	Model loaded;
+	loaded.load(file.path);
+	EXPECT_EQ(loaded.graph().modelName(), "classifier");
+	EXPECT_EQ(loaded.graph().modelVersion(), "3");
+	ASSERT_EQ(loaded.graph().nodes().size(), 3u);
+
+	const Tensor y = loaded.infer(x);
+	ASSERT_EQ(y.shape(), Shape({1, 4}));
+	for (int j = 0; j < 4; ++j) {
+		EXPECT_EQ(y.data_as<float>()[j], expected[j]) << "class " << j;
+	}
+}
+
+TEST(ModelTest, BlockQuantizedLayerRoundTripsInPlace) {
+	TempFile file("blockq");
+	Model source;
+	Graph& g = source.graph();
+	Value* x = g.createValue(Shape({2, 64}), DataType::FP32, "x");
+	Value* y = g.createValue(Shape({2, 20}), DataType::FP32, "y");
+	g.setInputs({x});
+	g.setOutputs({y});
+	Node* fc = g.addNode(MatMulBiasBlockQOp::fromFloat(64, 20, ramp(64 * 20, 0.01f, 0.3f), ramp(20, 0.1f, 0.0f), 4,
+													   32, Activation::ReLU),
+						 "fc");
+	fc->setInputs({x});
+	fc->setOutputs({y});
+	source.save(file.path);
+
+	std::vector<float> input = ramp(2 * 64, 0.05f, 0.1f);
+	Tensor in(Shape({2, 64}), DataType::FP32, input.data(), false);
+	const Tensor expected_view = source.infer(in);
+	const std::vector<float> expected(expected_view.data_as<float>(), expected_view.data_as<float>() + 40);
+
+	Model loaded;
+	loaded.load(file.path);
+	const auto* op = dynamic_cast<const MatMulBiasBlockQOp*>(loaded.graph().nodes()[0]->op());
+	ASSERT_NE(op, nullptr);
+	EXPECT_EQ(op->bits(), 4);
+	EXPECT_EQ(op->groupSize(), 32);
+	EXPECT_EQ(op->activation(), Activation::ReLU);
+	EXPECT_TRUE(op->packedWeights().isView());
+	EXPECT_EQ(loaded.findWeight("fc.qweight")->shape(), Shape({2, 64, 8}));
+	EXPECT_EQ(loaded.findWeight("fc.scales")->shape(), Shape({2, 2, 16}));
+	const Tensor out = loaded.infer(in);
+	for (std::size_t i = 0; i < expected.size(); ++i) EXPECT_EQ(out.data_as<float>()[i], expected[i]) << i;
+}
+
+TEST(ModelTest, SparseLayersRoundTripInPlace) {
+	TempFile file("sparse");
+	// 2:4 keeps rows 0 and 1 of every run of four; block CSR keeps a checkerboard of 4x4 blocks.
+	std::vector<float> w_nm = ramp(32 * 24, 0.02f, 0.01f);
+	for (std::size_t i = 0; i < w_nm.size(); ++i) {
+		if ((i / 24) % 4 >= 2) w_nm[i] = 0.0f;
+	}
+	std::vector<float> w_bsr = ramp(24 * 12, 0.03f, -0.02f);
+	for (std::size_t i = 0; i < w_bsr.size(); ++i) {
+		if ((i / 12 / 4 + i % 12 / 4) % 2 == 1) w_bsr[i] = 0.0f;
+	}
+	Model source;
+	Graph& g = source.graph();
+	Value* x = g.createValue(Shape({3, 32}), DataType::FP32, "x");
+	Value* h = g.createValue(Shape({3, 24}), DataType::FP32, "h");
+	Value* y = g.createValue(Shape({3, 12}), DataType::FP32, "y");
+	g.setInputs({x});
+	g.setOutputs({y});
+	Node* fc1 = g.addNode(MatMulBiasSparseOp::fromFloat(32, 24, w_nm.data(), ramp(24, 0.1f, 0.0f),
+														SparsePattern::nm(2, 4), Activation::ReLU),
+						  "fc1");
+	fc1->setInputs({x});
+	fc1->setOutputs({h});
+	Node* fc2 = g.addNode(MatMulBiasSparseOp::fromFloat(24, 12, w_bsr.data(), ramp(12, 0.05f, 0.0f),
+														SparsePattern::blockCsr(4, 4)),
+						  "fc2");
+	fc2->setInputs({h});
+	fc2->setOutputs({y});
+	source.save(file.path);
+
+	std::vector<float> input = ramp(3 * 32, 0.05f, 0.1f);
+	Tensor in(Shape({3, 32}), DataType::FP32, input.data(), false);
+	const Tensor expected_view = source.infer(in);
+	const std::vector<float> expected(expected_view.data_as<float>(), expected_view.data_as<float>() + 36);
+
+	Model loaded;
+	loaded.load(file.path);
+	const auto* nm = dynamic_cast<const MatMulBiasSparseOp*>(loaded.graph().nodes()[0]->op());
+	const auto* bsr = dynamic_cast<const MatMulBiasSparseOp*>(loaded.graph().nodes()[1]->op());
+	ASSERT_NE(nm, nullptr);
+	ASSERT_NE(bsr, nullptr);
+	EXPECT_EQ(sparse_pattern_name(nm->pattern()), "2:4");
+	EXPECT_EQ(nm->activation(), Activation::ReLU);
+	EXPECT_TRUE(nm->values().isView());
+	EXPECT_EQ(nm->rowMajorWeights(), w_nm);
+	EXPECT_EQ(loaded.findWeight("fc1.indices")->shape(), Shape({2, 8, 2, 16}));
+	EXPECT_EQ(sparse_pattern_name(bsr->pattern()), "bcsr4x4");
+	EXPECT_EQ(bsr->rowMajorWeights(), w_bsr);
+	EXPECT_EQ(bsr->colIdx().size(), 9u);
+	EXPECT_EQ(loaded.findWeight("fc2.values")->shape(), Shape({9, 4, 4}));
+	EXPECT_EQ(loaded.findWeight("fc2.row_ptr")->shape(), Shape({4}));
+	const Tensor out = loaded.infer(in);
+	for (std::size_t i = 0; i < expected.size(); ++i) EXPECT_EQ(out.data_as<float>()[i], expected[i]) << i;
+}
+
+TEST(ModelTest, GroupQuantizationRoundTrips) {
+	TempFile file("group_quant");
+	Model source;
+	buildMixedPrecisionModel(source.graph());
+	inference_engine::core::QuantizationParams qp;
+	qp.symmetric = true;
+	qp.axis = 1;
+	qp.group_size = 4;
+	qp.bits = 4;
+	for (float s : {0.5f, 0.25f, -0.0f, 0.125f}) qp.group_scales.push_back(inference_engine::core::Half(s));
+	source.graph().values()[1]->setQuantization(qp);
+	source.save(file.path);
+
+	Model loaded;
+	loaded.load(file.path);
+	const Value* v = loaded.graph().values()[1].get();
+	ASSERT_TRUE(v->hasQuantization());
+	EXPECT_TRUE(v->quantization()->is_grouped());
+	EXPECT_EQ(*v->quantization(), qp);
+	EXPECT_FALSE(loaded.graph().values()[0]->hasQuantization());
+}
+
+TEST(ModelTest, WeightsAreAlignedViewsIntoTheMapping) {
+	TempFile file("zerocopy");
+	Model source;
+	buildMixedPrecisionModel(source.graph());
+	source.save(file.path);
+
+	Model loaded;
+	loaded.load(file.path);
+	ASSERT_TRUE(loaded.mapping().is_open());
+	EXPECT_EQ(loaded.weights().size(), 4u);
+	for (const char* name : {"fc1.weight", "fc1.bias", "fc2.weight", "fc2.bias"}) {
+		const Tensor* t = loaded.findWeight(name);
+		ASSERT_NE(t, nullptr) << name;
+		EXPECT_FALSE(t->owns_data()) << name;
+		EXPECT_TRUE(loaded.mapping().contains(t->data(), static_cast<std::size_t>(t->byte_size()))) << name;
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(t->data()) % model_format::kTensorAlignment, 0u) << name;
+	}
+	EXPECT_EQ(loaded.findWeight("fc2.weight")->dtype(), DataType::FP16);
+	EXPECT_EQ(loaded.findWeight("missing"), nullptr);
+
+	// The operators run directly on the mapped bytes, and clones keep sharing them.
+	const auto* fc1 = dynamic_cast<const MatMulBiasOp*>(loaded.graph().nodes()[0]->op());
+	ASSERT_NE(fc1, nullptr);
+	EXPECT_TRUE(fc1->weights().isView());
+	EXPECT_EQ(fc1->weights().data(), loaded.findWeight("fc1.weight")->data());
+	EXPECT_EQ(fc1->activation(), Activation::ReLU);
+	auto copy = fc1->clone();
+	EXPECT_EQ(static_cast<const MatMulBiasOp&>(*copy).weights().data(), fc1->weights().data());
+}
+
+TEST(ModelTest, PackedWeightCacheIsWrittenOnceThenMapped) {
+	TempFile file("packed");
+	const std::filesystem::path dir = std::filesystem::temp_directory_path() / "ie_test_model_packed_cache";
+	std::filesystem::remove_all(dir);
+	std::filesystem::create_directories(dir);
+
+	std::vector<float> input = ramp(8, 0.3f, 0.2f);
+	Tensor x(Shape({1, 8}), DataType::FP32, input.data(), false);
+	Model source;
+	buildMixedPrecisionModel(source.graph());
+	const Tensor expected_view = source.infer(x);
+	const std::vector<float> expected(expected_view.data_as<float>(), expected_view.data_as<float>() + 4);
+
+	// Compiling replaced fc1's owned weights with the packed copy; saving unpacks them.
+	const auto* src_fc1 = dynamic_cast<const MatMulBiasOp*>(source.graph().nodes()[0]->op());
+	ASSERT_NE(src_fc1, nullptr);
+	EXPECT_TRUE(src_fc1->weights().empty());
+	EXPECT_EQ(src_fc1->packedPanel(), linear_packed_panel());
+	EXPECT_EQ(src_fc1->rowMajorWeights(), ramp(8 * 16, 0.25f, 0.0f));
+	source.save(file.path);
+
+	for (int run = 0; run < 2; ++run) {
+		SCOPED_TRACE(run == 0 ? "cold" : "warm");
+		Model loaded;
+		loaded.setWeightCacheDirectory(dir.string());
+		loaded.load(file.path);
+		ASSERT_NE(loaded.weightCache(), nullptr);
+		const Tensor y = loaded.infer(x);
+		for (int j = 0; j < 4; ++j) {
+			EXPECT_EQ(y.data_as<float>()[j], expected[j]) << "class " << j;
+		}
+		EXPECT_EQ(loaded.weightCache()->size(), 1u);
+		EXPECT_EQ(loaded.weightCache()->mappedBlobs(), run == 0 ? 0u : 1u);
+		EXPECT_TRUE(std::filesystem::exists(loaded.weightCache()->path()));
+
+		// Mapped weights stay in place next to the packed copy.
+		const auto* fc1 = dynamic_cast<const MatMulBiasOp*>(loaded.graph().nodes()[0]->op());
+		ASSERT_NE(fc1, nullptr);
+		EXPECT_TRUE(fc1->weights().isView());
+		EXPECT_TRUE(fc1->packedWeights().isView());
+	}
+	std::filesystem::remove_all(dir);
+}
+
+TEST(ModelTest, WeightStoreSharesIdenticalBlobs) {
+	WeightStore store;
+	const std::vector<float> a = ramp(100, 0.5f, 0.0f);
+	const std::vector<float> b = ramp(100, 0.5f, 1.0f);
+	auto first = store.intern(a.data(), a.size() * sizeof(float));
+	auto again = store.intern(a.data(), a.size() * sizeof(float));
+	auto other = store.intern(b.data(), b.size() * sizeof(float));
+	EXPECT_EQ(first, again);
+	EXPECT_NE(first->data(), other->data());
+	EXPECT_NE(first->data(), static_cast<const void*>(a.data()));
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first->data()) % 64, 0u);
+	EXPECT_EQ(std::memcmp(first->data(), a.data(), a.size() * sizeof(float)), 0);
+	// Same bytes, shorter: a blob of its own.
+	EXPECT_NE(store.intern(a.data(), 10 * sizeof(float)), first);
+
+	WeightStore::Stats s = store.stats();
+	EXPECT_EQ(s.blobs, 2u);
+	EXPECT_EQ(s.bytes, 2 * a.size() * sizeof(float));
+	EXPECT_EQ(s.hits, 1u);
+	EXPECT_EQ(s.misses, 3u);
+
+	// The store does not keep blobs alive.
+	first.reset();
+	again.reset();
+	EXPECT_EQ(store.stats().blobs, 1u);
+	const auto copy = WeightBuffer<float>::shared(other);
+	other.reset();
+	EXPECT_EQ(store.stats().blobs, 1u);
+	EXPECT_EQ(std::vector<float>(copy.begin(), copy.end()), b);
+	EXPECT_FALSE(copy.isView());
+}
+
+TEST(ModelTest, ModelVersionsShareInternedWeights) {
+	TempFile v1("store_v1");
+	TempFile v2("store_v2");
+	{
+		Model source;
+		buildMixedPrecisionModel(source.graph());
+		source.save(v1.path);
+		Model next;
+		buildMixedPrecisionModel(next.graph(), -0.25f);
+		next.save(v2.path);
+	}
+	std::vector<float> input = ramp(8, 0.3f, 0.2f);
+	Tensor x(Shape({1, 8}), DataType::FP32, input.data(), false);
+	auto expected = [&x](const std::string& path) {
+		Model m;
+		m.load(path);
+		const Tensor y = m.infer(x);
+		return std::vector<float>(y.data_as<float>(), y.data_as<float>() + 4);
+	};
+	auto output = [&x](Model& m) {
+		const Tensor y = m.infer(x);
+		return std::vector<float>(y.data_as<float>(), y.data_as<float>() + 4);
+	};
+	auto fc = [](Model& m) { return dynamic_cast<const MatMulBiasOp*>(m.graph().nodes()[0]->op()); };
+
+	// Footprint of v2 on its own; a destroyed model leaves nothing behind.
+	WeightStore alone;
+	std::size_t alone_bytes = 0;
+	{
+		Model m;
+		m.setWeightStore(&alone);
+		m.load(v2.path);
+		(void)m.plan();
+	}
+	EXPECT_EQ(alone.stats().blobs, 0u);
+	{
+		Model m;
+		m.setWeightStore(&alone);
+		m.load(v2.path);
+		(void)m.plan();
+		const WeightStore::Stats s = alone.stats();
+		EXPECT_EQ(s.blobs, 5u); // four tensors and fc1's packed copy
+		alone_bytes = s.bytes;
+	}
+
+	WeightStore store;
+	auto old_version = std::make_unique<Model>();
+	old_version->setWeightStore(&store);
+	old_version->load(v1.path);
+	EXPECT_FALSE(old_version->mapping().is_open());
+	EXPECT_TRUE(old_version->findWeight("fc1.weight")->owns_data());
+	EXPECT_EQ(output(*old_version), expected(v1.path));
+
+	// Hot swap: the new version shares every tensor but the changed head.
+	Model new_version;
+	new_version.setWeightStore(&store);
+	new_version.load(v2.path);
+	EXPECT_EQ(new_version.findWeight("fc1.weight")->data(), old_version->findWeight("fc1.weight")->data());
+	EXPECT_EQ(new_version.findWeight("fc1.bias")->data(), old_version->findWeight("fc1.bias")->data());
+	EXPECT_EQ(new_version.findWeight("fc2.bias")->data(), old_version->findWeight("fc2.bias")->data());
+	EXPECT_NE(new_version.findWeight("fc2.weight")->data(), old_version->findWeight("fc2.weight")->data());
+	EXPECT_EQ(output(new_version), expected(v2.path));
+	ASSERT_NE(fc(new_version), nullptr);
+	EXPECT_EQ(fc(new_version)->packedWeights().data(), fc(*old_version)->packedWeights().data());
+	EXPECT_EQ(store.stats().blobs, 6u);
+
+	// Clones share the interned weights as well.
+	auto copy = fc(new_version)->clone();
+	EXPECT_EQ(static_cast<const MatMulBiasOp&>(*copy).packedWeights().data(), fc(new_version)->packedWeights().data());
+
+	old_version.reset();
+	EXPECT_EQ(store.stats().blobs, 5u);
+	EXPECT_EQ(store.stats().bytes, alone_bytes);
+	EXPECT_EQ(output(new_version), expected(v2.path));
+}
+
+TEST(ModelTest, LoadPlacesWeightsInPrivatePages) {
+	TempFile file("pages");
+	Model source;
+	buildMixedPrecisionModel(source.graph());
+	source.save(file.path);
+
+	std::vector<float> input = ramp(8, 0.3f, 0.2f);
+	Tensor x(Shape({1, 8}), DataType::FP32, input.data(), false);
+	const Tensor expected_view = source.infer(x);
+	const std::vector<float> expected(expected_view.data_as<float>(), expected_view.data_as<float>() + 4);
+
+	inference_engine::memory::PageOptions pages;
+	pages.huge_pages = inference_engine::memory::HugePages::Transparent;
+	pages.prefault = true;
+	Model loaded;
+	loaded.load(file.path, pages);
+	ASSERT_TRUE(loaded.mapping().is_private_copy());
+	EXPECT_EQ(loaded.mapping().size(), static_cast<std::size_t>(std::filesystem::file_size(file.path)));
+	const Tensor* fc1 = loaded.findWeight("fc1.weight");
+	ASSERT_NE(fc1, nullptr);
+	EXPECT_TRUE(loaded.mapping().contains(fc1->data(), static_cast<std::size_t>(fc1->byte_size())));
+
+	inference_engine::memory::PageOptions arena_pages;
+	arena_pages.prefault = true;
+	loaded.setArenaPages(arena_pages);
+	EXPECT_TRUE(loaded.plan().memoryPlan().arena_pages.prefault);
+
+	const Tensor y = loaded.infer(x);
+	ASSERT_EQ(y.shape(), Shape({1, 4}));
+	for (int j = 0; j < 4; ++j) {
+		EXPECT_EQ(y.data_as<float>()[j], expected[j]) << "class " << j;
+	}
+
+	// Pre-faulting alone keeps the shared file mapping.
+	inference_engine::memory::PageOptions prefault_only;
+	prefault_only.prefault = true;
+	Model shared;
+	shared.load(file.path, prefault_only);
+	EXPECT_FALSE(shared.mapping().is_private_copy());
+}
+
+TEST(ModelTest, LoadRejectsMalformedFiles) {
+	TempFile good("good");
+	Model source;
+	buildMixedPrecisionModel(source.graph());
+	source.save(good.path);
+	const std::vector<char> bytes = readAll(good.path);
+	ASSERT_GT(bytes.size(), sizeof(model_format::FileHeader));
+
+	TempFile bad("bad");
+	Model m;
+	EXPECT_THROW(m.load(bad.path + ".does_not_exist"), std::runtime_error);
+
+	std::vector<char> corrupt = bytes;
+	corrupt[0] = 'X';
+	writeAll(bad.path, corrupt);
+	EXPECT_THROW(m.load(bad.path), std::runtime_error);
+
+	// Neither a future version nor the previous one, whose Values lack the group fields.
+	for (const std::uint32_t version : {model_format::kVersion + 1, model_format::kVersion - 1}) {
+		corrupt = bytes;
+		std::memcpy(corrupt.data() + offsetof(model_format::FileHeader, version), &version, sizeof(version));
+		writeAll(bad.path, corrupt);
+		EXPECT_THROW(m.load(bad.path), std::runtime_error) << "version " << version;
+	}
+
+	corrupt.assign(bytes.begin(), bytes.begin() + static_cast<std::ptrdiff_t>(bytes.size() / 2));
+	writeAll(bad.path, corrupt);
+	EXPECT_THROW(m.load(bad.path), std::runtime_error);
+
+	// A failed load leaves the model usable and loading the good file still works.
+	m.load(good.path);
+	EXPECT_EQ(m.graph().nodes().size(), 3u);
+}
+
+TEST(ModelTest, LoadRejectsOverflowingTensorSizes) {
+	TempFile good("overflow_good");
+	Model source;
+	buildMixedPrecisionModel(source.graph());
+	source.save(good.path);
+	const std::vector<char> bytes = readAll(good.path);
+
+	// fc1.weight is stored as FP32 [8, 16]: its name, dtype, rank and dims follow each other in the metadata.
+	const std::string name = "fc1.weight";
+	const auto at = std::search(bytes.begin(), bytes.end(), name.begin(), name.end());
+	ASSERT_NE(at, bytes.end());
+	const auto dims = static_cast<std::size_t>(at - bytes.begin()) + name.size() + 2 * sizeof(std::uint32_t);
+	std::int64_t stored[2];
+	std::memcpy(stored, bytes.data() + dims, sizeof(stored));
+	ASSERT_EQ(stored[0], 8);
+	ASSERT_EQ(stored[1], 16);
+
+	TempFile bad("overflow_bad");
+	Model m;
+	// The first pair's element count overflows int64; the second's byte count wraps to the stored 512 bytes.
+	// Both must be caught while reading the tensor table, not by whichever op happens to check shapes later.
+	const std::int64_t huge[][2] = {{std::int64_t{1} << 62, 4}, {(std::int64_t{1} << 61) + 64, 2}};
+	const char* const errors[] = {"tensor dimensions overflow", "'fc1.weight' lies outside the data section"};
+	for (std::size_t i = 0; i < 2; ++i) {
+		std::vector<char> corrupt = bytes;
+		std::memcpy(corrupt.data() + dims, huge[i], sizeof(huge[i]));
+		writeAll(bad.path, corrupt);
+		std::string error;
+		try {
+			m.load(bad.path);
+		} catch (const std::runtime_error& e) {
+			error = e.what();
+		}
+		EXPECT_NE(error.find(errors[i]), std::string::npos) << huge[i][0] << " x " << huge[i][1] << ": " << error;
+	}
+}
+
+TEST(ModelTest, SaveRejectsUnsupportedOperators) {
+	TempFile file("unsupported");
+	Graph g;
+	Value* x = g.createValue(Shape({1, 4}), DataType::FP32, "x");
+	Value* y = g.createValue(Shape({1, 4}), DataType::FP32, "y");
+	g.setInputs({x});
+	g.setOutputs({y});
+	Node* q = g.addNode(QuantizedLinearOp::fromFloat(4, 4, ramp(16, 0.5f, 0.0f), ramp(4, 0.1f, 0.0f)), "q");
+	q->setInputs({x});
+	q->setOutputs({y});
+	EXPECT_THROW(saveModel(g, file.path), std::invalid_argument);
+}
@@ -56,3 +56,41 @@ TEST(ShapeTest, ElementwiseHelpers) {
 	EXPECT_EQ(out.rank(), 1u);
 	EXPECT_EQ(out[0], 4);
 }
+
+TEST(ShapeTest, DimsStayInlineUpToMaxInlineRank) {
+	Shape s({1, 2, 3, 4, 5, 6, 7, 8});
+	EXPECT_TRUE(s.dims().is_inline());
+	Shape copy = s;
+	EXPECT_TRUE(copy.dims().is_inline());
+	EXPECT_EQ(copy, s);
+	EXPECT_TRUE(s.strides().is_inline());
+	EXPECT_EQ(s.strides()[0], 40320);
+}
+
+TEST(ShapeTest, DimsSpillPastMaxInlineRank) {
+	DimVector dims;
+	for (int64_t d = 1; d <= 12; ++d) {
+		dims.push_back(d);
+	}
+	EXPECT_FALSE(dims.is_inline());
+	Shape s(dims);
+	EXPECT_EQ(s.rank(), 12u);
+	EXPECT_EQ(s[11], 12);
+
+	Shape squeezed = s.squeeze(0);
+	EXPECT_EQ(squeezed.rank(), 11u);
+	EXPECT_EQ(squeezed[0], 2);
+	Shape unsqueezed = squeezed.unsqueeze(3);
+	EXPECT_EQ(unsqueezed.rank(), 12u);
+	EXPECT_EQ(unsqueezed[3], 1);
+
+	// Moving keeps the heap storage; the source is left empty.
+	Shape moved = std::move(s);
+	EXPECT_EQ(moved.rank(), 12u);
+	EXPECT_EQ(moved.num_elements(), 479001600);
+
+	DimVector erased = dims;
+	erased.erase(erased.begin() + 2, erased.end());
+	EXPECT_EQ(erased, DimVector({1, 2}));
+	EXPECT_EQ(erased.to_vector(), (std::vector<int64_t>{1, 2}));
+}
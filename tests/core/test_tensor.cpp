@@ -5,11 +5,20 @@
 #include "inference_engine/core/dtype.h"
 #include "inference_engine/memory/allocator.h"
 
+#include <atomic>
 #include <cstdint>
+#include <cstdlib>
 #include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace {
 
+// Heap allocations made while g_count_allocations is set.
+std::atomic<bool> g_count_allocations{false};
+std::atomic<int> g_allocations{0};
+
 class SimpleAllocator : public inference_engine::core::Allocator {
 public:
 	void* allocate(int64_t size_bytes) override {
@@ -17,12 +26,33 @@ public:
 	}
 
 	void deallocate(void* ptr) noexcept override {
+		++frees;
 		delete[] static_cast<uint8_t*>(ptr);
 	}
+
+	int frees = 0;
 };
 
 } // namespace
 
+void* operator new(std::size_t size) {
+	if (g_count_allocations.load(std::memory_order_relaxed)) {
+		g_allocations.fetch_add(1, std::memory_order_relaxed);
+	}
+	if (void* p = std::malloc(size == 0 ? 1 : size)) {
+		return p;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+	std::free(p);
+}
+
 using namespace inference_engine::core;
 
 TEST(TensorTest, BasicCreation) {
@@ -112,3 +142,82 @@ TEST(TensorTest, QuantParams) {
 	EXPECT_FLOAT_EQ(qt.quant_params().scale, 0.25f);
 	EXPECT_EQ(qt.quant_params().zero_point, 10);
 }
+
+TEST(TensorTest, CloneOwnsIndependentCopy) {
+	float data[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+	Tensor t(Shape({2, 2}), DataType::FP32, data, false);
+	t.set_quant_params(0.5f, 3);
+
+	Tensor c = t.clone();
+	EXPECT_TRUE(c.owns_data());
+	EXPECT_NE(c.data(), t.data());
+	EXPECT_EQ(c.shape(), t.shape());
+	EXPECT_FLOAT_EQ(c.quant_params().scale, 0.5f);
+	data[0] = 9.0f;
+	EXPECT_FLOAT_EQ(c.data_as<float>()[0], 1.0f);
+	EXPECT_FLOAT_EQ(c.data_as<float>()[3], 4.0f);
+
+	Tensor transposed = t.transpose({1, 0});
+	EXPECT_THROW(transposed.clone(), std::runtime_error);
+}
+
+TEST(TensorTest, MetadataOperationsDoNotAllocate) {
+	float data[2 * 3 * 4] = {};
+	const std::vector<std::pair<int64_t, int64_t>> ranges = {{0, 1}, {1, 3}, {0, 4}};
+	const std::vector<int> axes = {2, 0, 1};
+
+	g_allocations = 0;
+	g_count_allocations = true;
+	{
+		Tensor t(Shape({2, 3, 4}), DataType::FP32, data, false);
+		Tensor copy = t;
+		Tensor moved = std::move(copy);
+		Tensor sliced = t.slice(ranges);
+		Tensor reshaped = t.reshape(Shape({6, 4}));
+		Tensor transposed = t.transpose(axes);
+		Shape squeezed = sliced.shape().squeeze(0);
+		moved = reshaped;
+		(void)squeezed;
+		(void)transposed;
+	}
+	g_count_allocations = false;
+	EXPECT_EQ(g_allocations.load(), 0);
+}
+
+TEST(TensorTest, CopiesAndViewsShareStorage) {
+	SimpleAllocator alloc;
+	Tensor view;
+	{
+		Tensor t(Shape({2, 3}), DataType::FP32, &alloc);
+		ASSERT_NE(t.storage(), nullptr);
+		EXPECT_EQ(t.storage()->allocator(), &alloc);
+		t.data_as<float>()[4] = 7.0f;
+
+		Tensor copy = t;
+		EXPECT_TRUE(copy.owns_data());
+		EXPECT_EQ(copy.storage(), t.storage());
+		EXPECT_EQ(t.storage().use_count(), 2);
+
+		view = t.slice({{1, 2}, {0, 3}}).reshape(Shape({3}));
+	}
+	// The view alone keeps the block alive; it returns to the allocator with the last reference.
+	EXPECT_EQ(alloc.frees, 0);
+	EXPECT_EQ(view.storage().use_count(), 1);
+	EXPECT_FLOAT_EQ(view.data_as<float>()[1], 7.0f);
+	view.deallocate();
+	EXPECT_EQ(view.data(), nullptr);
+	EXPECT_EQ(alloc.frees, 1);
+}
+
+TEST(TensorTest, ShareStorageRequiresDataInside) {
+	auto storage = Storage::allocate(64);
+	Tensor inside(Shape({4}), DataType::FP32, static_cast<uint8_t*>(storage->data()) + 16, false);
+	EXPECT_FALSE(inside.owns_data());
+	inside.share_storage(storage);
+	EXPECT_TRUE(inside.owns_data());
+	EXPECT_EQ(storage.use_count(), 2);
+
+	float other[4] = {};
+	Tensor outside(Shape({4}), DataType::FP32, other, false);
+	EXPECT_THROW(outside.share_storage(storage), std::invalid_argument);
+}
@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/core/model.h"
+#include "inference_engine/core/model_format.h"
+#include "inference_engine/graph/calibration.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/matmul_bias.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::QuantizationParams;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+constexpr std::int64_t kBatch = 2;
+constexpr std::int64_t kIn = 8;
+constexpr std::int64_t kOut = 6;
+
+std::vector<float> ramp(std::size_t n, float scale, float offset) {
+	std::vector<float> v(n);
+	for (std::size_t i = 0; i < n; ++i) v[i] = scale * std::sin(0.7f * static_cast<float>(i)) + offset;
+	return v;
+}
+
+// x[2, 8] -> fc -> h -> relu -> y
+void buildMlp(Graph& g) {
+	Value* x = g.createValue(Shape({kBatch, kIn}), DataType::FP32, "x");
+	Value* h = g.createValue(Shape({kBatch, kOut}), DataType::FP32, "h");
+	Value* y = g.createValue(Shape({kBatch, kOut}), DataType::FP32, "y");
+	g.setInputs({x});
+	g.setOutputs({y});
+	Node* fc = g.addNode(std::make_unique<MatMulBiasOp>(kIn, kOut, ramp(kIn * kOut, 0.5f, 0.0f), ramp(kOut, 0.1f, 0.0f)),
+						 "fc");
+	fc->setInputs({x});
+	fc->setOutputs({h});
+	Node* relu = g.addNode(std::make_unique<ReluOp>(), "relu");
+	relu->setInputs({h});
+	relu->setOutputs({y});
+}
+
+struct Dataset {
+	std::vector<std::vector<float>> data;
+	std::vector<std::vector<Tensor>> samples;
+};
+
+Dataset makeDataset(std::size_t count) {
+	Dataset d;
+	std::mt19937 rng(42);
+	std::normal_distribution<float> dist(0.0f, 1.0f);
+	d.data.resize(count, std::vector<float>(kBatch * kIn));
+	for (auto& sample : d.data) {
+		for (float& v : sample) v = dist(rng);
+		d.samples.push_back({Tensor(Shape({kBatch, kIn}), DataType::FP32, sample.data(), false)});
+	}
+	return d;
+}
+
+// Per-tensor min/max of x, h and y, computed directly from the samples.
+void referenceRanges(const Dataset& d, std::vector<float>& lo, std::vector<float>& hi) {
+	const std::vector<float> w = ramp(kIn * kOut, 0.5f, 0.0f);
+	const std::vector<float> b = ramp(kOut, 0.1f, 0.0f);
+	lo.assign(3, INFINITY);
+	hi.assign(3, -INFINITY);
+	auto record = [&](std::size_t v, float x) {
+		lo[v] = std::min(lo[v], x);
+		hi[v] = std::max(hi[v], x);
+	};
+	for (const auto& x : d.data) {
+		for (float xi : x) record(0, xi);
+		for (std::int64_t r = 0; r < kBatch; ++r) {
+			for (std::int64_t o = 0; o < kOut; ++o) {
+				float h = b[o];
+				for (std::int64_t i = 0; i < kIn; ++i) h += x[r * kIn + i] * w[i * kOut + o];
+				record(1, h);
+				record(2, std::max(h, 0.0f));
+			}
+		}
+	}
+}
+
+} // namespace
+
+TEST(CalibrationTest, MinMaxObserverTracksChannelsAndMerges) {
+	// [2, 3, 2] along axis 1: channel c holds values 10c + {0..1} and 10c + {6..7}.
+	std::vector<float> a(12);
+	for (std::size_t i = 0; i < a.size(); ++i) a[i] = static_cast<float>(10 * ((i / 2) % 3) + (i % 2) + 6 * (i / 6));
+	MinMaxObserver first(3);
+	first.observe(a.data(), Shape({2, 3, 2}), 1);
+	EXPECT_EQ(first.min(), (std::vector<float>{0.0f, 10.0f, 20.0f}));
+	EXPECT_EQ(first.max(), (std::vector<float>{7.0f, 17.0f, 27.0f}));
+
+	MinMaxObserver second(3);
+	std::vector<float> b(12, -1.0f);
+	b[5] = 40.0f; // channel 2
+	second.observe(b.data(), Shape({2, 3, 2}), 1);
+	first.merge(second);
+	EXPECT_EQ(first.min(), (std::vector<float>{-1.0f, -1.0f, -1.0f}));
+	EXPECT_EQ(first.max(), (std::vector<float>{7.0f, 17.0f, 40.0f}));
+	EXPECT_THROW(first.merge(MinMaxObserver(2)), std::invalid_argument);
+	EXPECT_THROW(first.observe(a.data(), Shape({3, 4}), 1), std::invalid_argument);
+}
+
+TEST(CalibrationTest, HistogramClipsOutliers) {
+	std::mt19937 rng(7);
+	std::normal_distribution<float> dist(0.0f, 1.0f);
+	std::vector<float> x(200000);
+	for (float& v : x) v = dist(rng);
+	x[0] = 60.0f; // one far outlier sets the histogram range
+	HistogramObserver h({60.0f}, 2048);
+	h.observe(x.data(), Shape({static_cast<std::int64_t>(x.size())}), -1);
+
+	const float t = h.entropyThreshold(0, 128);
+	EXPECT_GT(t, 2.0f);
+	EXPECT_LT(t, 10.0f);
+
+	const auto [lo, hi] = h.percentileRange(0, 99.0);
+	// The 1% and 99% points of a standard normal are -/+2.326; bins are ~0.06 wide.
+	EXPECT_NEAR(lo, -2.326f, 0.1f);
+	EXPECT_NEAR(hi, 2.326f, 0.1f);
+
+	HistogramObserver twice = h;
+	twice.merge(h);
+	for (std::size_t j = 0; j < twice.bins(); ++j) EXPECT_EQ(twice.counts(0)[j], 2 * h.counts(0)[j]);
+	EXPECT_THROW(twice.merge(HistogramObserver({30.0f}, 2048)), std::invalid_argument);
+}
+
+TEST(CalibrationTest, MinMaxMatchesSequentialRunsAndSetsQuantization) {
+	const Dataset d = makeDataset(37);
+	std::vector<float> lo, hi;
+	referenceRanges(d, lo, hi);
+
+	Graph g;
+	buildMlp(g);
+	CalibrationOptions options;
+	options.threads = 3;
+	const CalibrationReport report = calibrate(g, d.samples, options);
+	EXPECT_EQ(report.samples, 37u);
+	ASSERT_EQ(report.values.size(), 3u);
+	for (std::size_t v = 0; v < 3; ++v) {
+		const CalibrationReport::Entry& e = report.values[v];
+		EXPECT_EQ(e.value, g.values()[v].get());
+		EXPECT_NEAR(e.observed_min[0], lo[v], 1e-4f) << e.value->name();
+		EXPECT_NEAR(e.observed_max[0], hi[v], 1e-4f) << e.value->name();
+		ASSERT_TRUE(e.value->hasQuantization());
+		const QuantizationParams& qp = *e.value->quantization();
+		EXPECT_TRUE(qp.symmetric);
+		EXPECT_FLOAT_EQ(qp.scale, std::max(-e.observed_min[0], e.observed_max[0]) / 127.0f);
+	}
+	EXPECT_EQ(report.values[2].observed_min[0], 0.0f); // after ReLU
+}
+
+TEST(CalibrationTest, ResultsDoNotDependOnThreadCount) {
+	const Dataset d = makeDataset(29);
+	for (CalibrationMethod method : {CalibrationMethod::Entropy, CalibrationMethod::Percentile}) {
+		CalibrationOptions options;
+		options.method = method;
+		options.per_channel = true;
+		options.axis = 1;
+		options.dtype = DataType::UINT8;
+		options.symmetric = false;
+		options.percentile = 99.0;
+
+		Graph serial;
+		buildMlp(serial);
+		options.threads = 1;
+		(void)calibrate(serial, d.samples, options);
+		Graph parallel;
+		buildMlp(parallel);
+		options.threads = 4;
+		const CalibrationReport report = calibrate(parallel, d.samples, options);
+		for (std::size_t v = 0; v < report.values.size(); ++v) {
+			const CalibrationReport::Entry& e = report.values[v];
+			EXPECT_EQ(e.min.size(), static_cast<std::size_t>(e.value->shape().dim(1)));
+			for (std::size_t c = 0; c < e.min.size(); ++c) {
+				EXPECT_GE(e.min[c], e.observed_min[c]);
+				EXPECT_LE(e.max[c], e.observed_max[c]);
+			}
+			const QuantizationParams& got = *parallel.values()[v]->quantization();
+			const QuantizationParams& want = *serial.values()[v]->quantization();
+			EXPECT_TRUE(got.is_per_channel());
+			EXPECT_EQ(got, want) << e.value->name();
+		}
+	}
+}
+
+TEST(CalibrationTest, CalibratedModelRoundTripsThroughTheFileFormat) {
+	const std::string path =
+		(std::filesystem::temp_directory_path() / "ie_test_calibration_model.iem").string();
+	const Dataset d = makeDataset(8);
+	Graph g;
+	buildMlp(g);
+	(void)calibrate(g, d.samples);
+	saveModel(g, path);
+
+	Model loaded;
+	loaded.load(path);
+	ASSERT_EQ(loaded.graph().values().size(), g.values().size());
+	for (std::size_t v = 0; v < g.values().size(); ++v) {
+		ASSERT_TRUE(loaded.graph().values()[v]->hasQuantization());
+		EXPECT_EQ(*loaded.graph().values()[v]->quantization(), *g.values()[v]->quantization());
+	}
+	std::remove(path.c_str());
+}
+
+TEST(CalibrationTest, RejectsBadInput) {
+	Graph g;
+	buildMlp(g);
+	EXPECT_THROW((void)calibrate(g, {}), std::invalid_argument);
+	const Dataset d = makeDataset(2);
+	CalibrationOptions options;
+	options.symmetric = false; // asymmetric INT8
+	EXPECT_THROW((void)calibrate(g, d.samples, options), std::invalid_argument);
+	std::vector<float> wrong(3);
+	const std::vector<std::vector<Tensor>> bad = {{Tensor(Shape({3}), DataType::FP32, wrong.data(), false)}};
+	EXPECT_THROW((void)calibrate(g, bad), std::invalid_argument);
+	EXPECT_EQ(parseCalibrationMethod("kl"), CalibrationMethod::Entropy);
+	EXPECT_THROW((void)parseCalibrationMethod("mse"), std::invalid_argument);
+}
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/passes/constant_folding.h"
+#include "inference_engine/passes/dead_code_elimination.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+Node* addUnary(Graph& g, std::unique_ptr<Operator> op, Value* in, Value* out, std::string name) {
+	Node* n = g.addNode(std::move(op), std::move(name));
+	n->setInputs({in});
+	n->setOutputs({out});
+	return n;
+}
+} // namespace
+
+TEST(GraphInitializerTest, CopiesDataAndRejectsProducedValues) {
+	Graph g;
+	Value* c = g.createValue(Shape({2}), DataType::FP32, "c");
+	std::vector<float> data = {1.5f, -2.0f};
+	g.setInitializer(c, Tensor(Shape({2}), DataType::FP32, data.data(), false));
+	data[0] = 0.0f;
+
+	ASSERT_TRUE(g.isInitializer(c));
+	ASSERT_NE(c->tensor(), nullptr);
+	EXPECT_EQ(c->tensor(), g.initializer(c));
+	EXPECT_FLOAT_EQ(c->tensor()->data_as<float>()[0], 1.5f);
+	EXPECT_THROW(g.setInitializer(c, Tensor(Shape({3}), DataType::FP32, data.data(), false)),
+				 std::invalid_argument);
+
+	Value* x = g.createValue(Shape({2}), DataType::FP32, "x");
+	Value* y = g.createValue(Shape({2}), DataType::FP32, "y");
+	addUnary(g, std::make_unique<ReluOp>(), x, y, "relu");
+	EXPECT_THROW(g.setInitializer(y, Tensor(Shape({2}), DataType::FP32, data.data(), false)), std::invalid_argument);
+	g.setInputs({x});
+	EXPECT_THROW(g.setInitializer(x, Tensor(Shape({2}), DataType::FP32, data.data(), false)), std::invalid_argument);
+}
+
+TEST(ConstantFoldingTest, FoldsConstantSubgraphAndKeepsResults) {
+	// k = relu(tanh(c)) depends only on the initializer c.
+	// y = relu(x) depends on the input and must survive.
+	Graph g;
+	Value* c = g.createValue(Shape({1, 4}), DataType::FP32, "c");
+	Value* t = g.createValue(Shape({1, 4}), DataType::FP32, "t");
+	Value* k = g.createValue(Shape({1, 4}), DataType::FP32, "k");
+	Value* x = g.createValue(Shape({1, 4}), DataType::FP32, "x");
+	Value* y = g.createValue(Shape({1, 4}), DataType::FP32, "y");
+	std::vector<float> cdata = {-1.0f, 0.5f, 2.0f, -0.25f};
+	g.setInitializer(c, Tensor(Shape({1, 4}), DataType::FP32, cdata.data(), false));
+	addUnary(g, std::make_unique<TanhOp>(), c, t, "tanh");
+	addUnary(g, std::make_unique<ReluOp>(), t, k, "relu_const");
+	addUnary(g, std::make_unique<ReluOp>(), x, y, "relu_x");
+	g.setInputs({x});
+	g.setOutputs({y, k});
+
+	ConstantFoldingPass fold;
+	g.applyPass(fold);
+
+	EXPECT_EQ(fold.foldedCount(), 2u);
+	ASSERT_EQ(g.nodes().size(), 1u);
+	EXPECT_EQ(g.nodes()[0]->name(), "relu_x");
+	ASSERT_TRUE(g.isInitializer(k));
+	EXPECT_EQ(k->producer(), nullptr);
+	// c and t lost every consumer and were deleted.
+	EXPECT_EQ(g.values().size(), 3u);
+	EXPECT_EQ(g.initializerCount(), 1u);
+	for (std::size_t i = 0; i < cdata.size(); ++i) {
+		EXPECT_FLOAT_EQ(g.initializer(k)->data_as<float>()[i], std::max(0.0f, std::tanh(cdata[i])));
+	}
+
+	// The folded graph still compiles and runs; the constant output is never planned.
+	auto plan = g.compile();
+	std::vector<float> in = {-1, 2, -3, 4};
+	std::vector<Tensor> outputs;
+	plan->run({Tensor(Shape({1, 4}), DataType::FP32, in.data(), false)}, outputs);
+	ASSERT_EQ(outputs.size(), 2u);
+	EXPECT_FLOAT_EQ(outputs[0].data_as<float>()[1], 2.0f);
+	EXPECT_FLOAT_EQ(outputs[1].data_as<float>()[2], std::tanh(2.0f));
+	EXPECT_FALSE(plan->memoryPlan().lifetimes.at(k->id()).planned);
+}
+
+TEST(ConstantFoldingTest, FoldsLinearLayerOnConstantInput) {
+	Graph g;
+	Value* c = g.createValue(Shape({1, 2}), DataType::FP32, "c");
+	Value* y = g.createValue(Shape({1, 2}), DataType::FP32, "y");
+	std::vector<float> cdata = {1.0f, 2.0f};
+	g.setInitializer(c, Tensor(Shape({1, 2}), DataType::FP32, cdata.data(), false));
+	Node* fc = g.addNode(std::make_unique<MatMulBiasOp>(2, 2, std::vector<float>{1, 0, 0, 1},
+														std::vector<float>{0.5f, -0.5f}),
+						 "fc");
+	fc->setInputs({c});
+	fc->setOutputs({y});
+	g.setOutputs({y});
+
+	ConstantFoldingPass fold;
+	g.applyPass(fold);
+	EXPECT_EQ(fold.foldedCount(), 1u);
+	EXPECT_TRUE(g.nodes().empty());
+	ASSERT_TRUE(g.isInitializer(y));
+	EXPECT_FLOAT_EQ(y->tensor()->data_as<float>()[0], 1.5f);
+	EXPECT_FLOAT_EQ(y->tensor()->data_as<float>()[1], 1.5f);
+}
+
+TEST(DeadCodeEliminationTest, RemovesNodesAndValuesNotReachingOutputs) {
+	Graph g;
+	Value* x = g.createValue(Shape({1, 4}), DataType::FP32, "x");
+	Value* unused_in = g.createValue(Shape({1, 4}), DataType::FP32, "unused_in");
+	Value* y = g.createValue(Shape({1, 4}), DataType::FP32, "y");
+	Value* dead1 = g.createValue(Shape({1, 4}), DataType::FP32, "dead1");
+	Value* dead2 = g.createValue(Shape({1, 4}), DataType::FP32, "dead2");
+	(void)g.createValue(Shape({1, 4}), DataType::FP32, "orphan");
+	addUnary(g, std::make_unique<ReluOp>(), x, y, "live");
+	addUnary(g, std::make_unique<SigmoidOp>(), x, dead1, "dead_a");
+	addUnary(g, std::make_unique<TanhOp>(), dead1, dead2, "dead_b");
+	g.setInputs({x, unused_in});
+	g.setOutputs({y});
+
+	DeadCodeEliminationPass dce;
+	g.applyPass(dce);
+
+	EXPECT_EQ(dce.removedNodes(), 2u);
+	EXPECT_EQ(dce.removedValues(), 3u);
+	ASSERT_EQ(g.nodes().size(), 1u);
+	EXPECT_EQ(g.nodes()[0]->name(), "live");
+	EXPECT_EQ(g.values().size(), 3u); // x, unused_in (graph input) and y
+	EXPECT_EQ(x->consumers().size(), 1u);
+	EXPECT_NO_THROW(g.validate());
+}
+
+TEST(DeadCodeEliminationTest, ChainsWithConstantFolding) {
+	// Folding leaves a constant branch that only fed a dead node; DCE then drops it.
+	Graph g;
+	Value* c = g.createValue(Shape({4}), DataType::FP32, "c");
+	Value* folded = g.createValue(Shape({4}), DataType::FP32, "folded");
+	Value* x = g.createValue(Shape({4}), DataType::FP32, "x");
+	Value* y = g.createValue(Shape({4}), DataType::FP32, "y");
+	std::vector<float> cdata(4, 1.0f);
+	g.setInitializer(c, Tensor(Shape({4}), DataType::FP32, cdata.data(), false));
+	addUnary(g, std::make_unique<TanhOp>(), c, folded, "const_tanh");
+	addUnary(g, std::make_unique<ReluOp>(), x, y, "relu");
+	g.setInputs({x});
+	g.setOutputs({y});
+
+	ConstantFoldingPass fold;
+	DeadCodeEliminationPass dce;
+	g.applyPass(fold);
+	g.applyPass(dce);
+	EXPECT_EQ(fold.foldedCount(), 1u);
+	EXPECT_EQ(dce.removedValues(), 1u);
+	EXPECT_EQ(g.initializerCount(), 0u);
+	EXPECT_EQ(g.values().size(), 2u);
+}
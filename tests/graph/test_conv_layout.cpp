@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/binary_elementwise.h"
+#include "inference_engine/ops/conv2d.h"
+#include "inference_engine/ops/layout_reorder.h"
+#include "inference_engine/passes/conv_layout.h"
+#include "inference_engine/passes/fusion.h"
+
+#include <cmath>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+std::vector<float> wave(std::size_t n, float scale, float phase) {
+	std::vector<float> v(n);
+	for (std::size_t i = 0; i < n; ++i) v[i] = scale * std::sin(0.29f * static_cast<float>(i) + phase);
+	return v;
+}
+
+// 3x3 convolution; stride 2 or dilation 2 keeps Winograd out of the heuristic's way.
+std::unique_ptr<Conv2dOp> conv3x3(std::int64_t in, std::int64_t out, std::int64_t stride, std::int64_t dilation,
+								  float phase) {
+	Conv2dParams p;
+	p.in_channels = in;
+	p.out_channels = out;
+	p.kernel_h = p.kernel_w = 3;
+	p.stride_h = p.stride_w = stride;
+	p.dilation_h = p.dilation_w = dilation;
+	p.pad_top = p.pad_left = p.pad_bottom = p.pad_right = dilation;
+	return std::make_unique<Conv2dOp>(p, wave(static_cast<std::size_t>(out * in * 9), 0.2f, phase),
+									  wave(static_cast<std::size_t>(out), 0.1f, phase + 1.0f));
+}
+
+Node* wire(Graph& g, std::unique_ptr<Operator> op, const char* name, Value* in, Value* out) {
+	Node* n = g.addNode(std::move(op), name);
+	n->setInputs({in});
+	n->setOutputs({out});
+	return n;
+}
+
+// x[1, 16, 14, 14] -> conv(stride 2) -> relu -> conv(dilation 2) -> y[1, 32, 7, 7]
+void buildChain(Graph& g) {
+	Value* x = g.createValue(Shape({1, 16, 14, 14}), DataType::FP32, "x");
+	Value* a = g.createValue(Shape({1, 32, 7, 7}), DataType::FP32, "a");
+	Value* r = g.createValue(Shape({1, 32, 7, 7}), DataType::FP32, "r");
+	Value* y = g.createValue(Shape({1, 32, 7, 7}), DataType::FP32, "y");
+	g.setInputs({x});
+	wire(g, conv3x3(16, 32, 2, 1, 0.3f), "conv1", x, a);
+	wire(g, std::make_unique<ReluOp>(), "relu", a, r);
+	wire(g, conv3x3(32, 32, 1, 2, 0.7f), "conv2", r, y);
+	g.setOutputs({y});
+}
+
+// Two blocked convolutions of the same input, summed.
+void buildFork(Graph& g) {
+	Value* x = g.createValue(Shape({1, 16, 10, 10}), DataType::FP32, "x");
+	Value* a = g.createValue(Shape({1, 24, 5, 5}), DataType::FP32, "a");
+	Value* b = g.createValue(Shape({1, 24, 5, 5}), DataType::FP32, "b");
+	Value* y = g.createValue(Shape({1, 24, 5, 5}), DataType::FP32, "y");
+	g.setInputs({x});
+	wire(g, conv3x3(16, 24, 2, 1, 0.1f), "left", x, a);
+	wire(g, conv3x3(16, 24, 2, 1, 0.9f), "right", x, b);
+	Node* add = g.addNode(std::make_unique<BinaryElementwiseOp>(BinaryKind::Add), "add");
+	add->setInputs({a, b});
+	add->setOutputs({y});
+	g.setOutputs({y});
+}
+
+std::vector<float> run(Graph& g, const Shape& shape) {
+	std::vector<float> in = wave(static_cast<std::size_t>(shape.num_elements()), 1.0f, 0.5f);
+	Tensor out = g.execute(Tensor(shape, DataType::FP32, in.data(), false));
+	const float* p = out.data_as<float>();
+	return std::vector<float>(p, p + out.num_elements());
+}
+
+std::size_t countReorders(const Graph& g) {
+	std::size_t n = 0;
+	for (const auto& node : g.nodes()) {
+		if (dynamic_cast<const LayoutReorderOp*>(node->op()) != nullptr) ++n;
+	}
+	return n;
+}
+
+void expectNear(const std::vector<float>& got, const std::vector<float>& want) {
+	ASSERT_EQ(got.size(), want.size());
+	for (std::size_t i = 0; i < got.size(); ++i) ASSERT_NEAR(got[i], want[i], 1e-4f) << "at " << i;
+}
+
+} // namespace
+
+TEST(ConvLayoutTest, BlockedChainKeepsLayoutBetweenConvolutions) {
+	Graph plain;
+	buildChain(plain);
+	const std::vector<float> want = run(plain, Shape({1, 16, 14, 14}));
+
+	Graph g;
+	buildChain(g);
+	FusionPass fusion;
+	fusion.run(g);
+	EXPECT_EQ(fusion.fusedCount(), 1u); // the ReLU rides in conv1's epilogue
+	ConvLayoutPass layout;
+	layout.run(g);
+	EXPECT_EQ(layout.blockedConvs(), 2u);
+	EXPECT_EQ(layout.cancelledPairs(), 1u);
+	// x -> ToBlocked -> conv1 -> conv2 -> ToPlain -> y
+	EXPECT_EQ(layout.reorders(), 2u);
+	EXPECT_EQ(countReorders(g), 2u);
+	EXPECT_EQ(g.nodes().size(), 4u);
+	for (const auto& node : g.nodes()) {
+		if (const auto* conv = dynamic_cast<const Conv2dOp*>(node->op())) {
+			EXPECT_EQ(conv->channelBlock(), conv_channel_block());
+			EXPECT_EQ(node->inputs()[0]->shape().rank(), 5u);
+		}
+	}
+	expectNear(run(g, Shape({1, 16, 14, 14})), want);
+	for (const auto& node : g.nodes()) {
+		if (const auto* conv = dynamic_cast<const Conv2dOp*>(node->op())) {
+			EXPECT_EQ(conv->resolvedAlgorithm(), ConvAlgorithm::DirectNchwc);
+		}
+	}
+}
+
+TEST(ConvLayoutTest, SharedInputIsConvertedOnce) {
+	Graph plain;
+	buildFork(plain);
+	const std::vector<float> want = run(plain, Shape({1, 16, 10, 10}));
+
+	Graph g;
+	buildFork(g);
+	ConvLayoutPass layout;
+	layout.run(g);
+	EXPECT_EQ(layout.blockedConvs(), 2u);
+	EXPECT_EQ(layout.cancelledPairs(), 0u);
+	EXPECT_EQ(layout.reorders(), 3u); // one ToBlocked, a ToPlain per convolution
+	expectNear(run(g, Shape({1, 16, 10, 10})), want);
+}
+
+TEST(ConvLayoutTest, NonBlockedAlgorithmsStayPlain) {
+	Graph g;
+	Value* x = g.createValue(Shape({1, 16, 12, 12}), DataType::FP32, "x");
+	Value* y = g.createValue(Shape({1, 16, 12, 12}), DataType::FP32, "y");
+	g.setInputs({x});
+	Node* conv = wire(g, conv3x3(16, 16, 1, 1, 0.2f), "conv", x, y);
+	g.setOutputs({y});
+	ConvLayoutPass layout;
+	layout.run(g);
+	EXPECT_EQ(layout.blockedConvs(), 0u);
+	EXPECT_EQ(layout.reorders(), 0u);
+	const auto* op = dynamic_cast<const Conv2dOp*>(conv->op());
+	EXPECT_EQ(op->algorithm(), ConvAlgorithm::WinogradF2x3);
+	EXPECT_EQ(op->channelBlock(), 0u);
+}
+
+TEST(ConvLayoutTest, ReluFusesIntoConvolution) {
+	Graph plain;
+	buildChain(plain);
+	const std::vector<float> want = run(plain, Shape({1, 16, 14, 14}));
+	Graph g;
+	buildChain(g);
+	FuseLinearActivationPass fuse;
+	fuse.run(g);
+	EXPECT_EQ(fuse.fusedCount(), 1u);
+	EXPECT_EQ(g.nodes().size(), 2u);
+	expectNear(run(g, Shape({1, 16, 14, 14})), want);
+}
@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/core/model.h"
+#include "inference_engine/graph/execution_context.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/scheduler/executor.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include "../classifier_fixture.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+// x[2,3,2] -> reshape -> [2,6] -> fc -> relu -> softmax -> y[2,4]
+void buildClassifier(Graph& g) {
+	fixtures::buildClassifier(g, Shape({2, 3, 2}), 4);
+}
+
+std::vector<float> inputFor(int request) {
+	std::vector<float> in(12);
+	for (std::size_t i = 0; i < in.size(); ++i) in[i] = static_cast<float>((request * 7 + static_cast<int>(i)) % 11) - 5.0f;
+	return in;
+}
+
+// Reference result from the single-threaded Graph::execute path.
+std::vector<float> reference(int request) {
+	Graph g;
+	buildClassifier(g);
+	std::vector<float> in = inputFor(request);
+	const Tensor out = g.execute(Tensor(Shape({2, 3, 2}), DataType::FP32, in.data(), false));
+	return std::vector<float>(out.data_as<float>(), out.data_as<float>() + out.num_elements());
+}
+
+// x[4, 64] -> `width` independent ReLUs, each a graph output. The outputs are
+// declared [1] so the planner reserves too little for them and every ReLU writes
+// through the context's scratch, all at once under ParallelExecutor.
+void buildWideRelu(Graph& g, int width) {
+	Value* x = g.createValue(Shape({4, 64}), DataType::FP32, "x");
+	g.setInputs({x});
+	std::vector<Value*> outputs;
+	for (int i = 0; i < width; ++i) {
+		Value* y = g.createValue(Shape({1}), DataType::FP32, "y" + std::to_string(i));
+		Node* n = g.addNode(std::make_unique<ReluOp>());
+		n->setInputs({x});
+		n->setOutputs({y});
+		outputs.push_back(y);
+	}
+	g.setOutputs(outputs);
+}
+
+void expectNear(const Tensor& got, const std::vector<float>& expected) {
+	ASSERT_EQ(static_cast<std::size_t>(got.num_elements()), expected.size());
+	for (std::size_t i = 0; i < expected.size(); ++i) EXPECT_NEAR(got.data_as<float>()[i], expected[i], 1e-6f);
+}
+} // namespace
+
+TEST(ExecutionContextTest, ContextsOwnAllRequestState) {
+	Graph g;
+	buildClassifier(g);
+	CompileOptions options;
+	options.bind_memory = false;
+	auto plan = g.compile(options);
+	EXPECT_FALSE(g.hasBoundMemory());
+
+	auto a = plan->createContext();
+	auto b = plan->createContext();
+	EXPECT_EQ(a->arenaBytes(), plan->memoryPlan().arena_bytes);
+
+	std::vector<float> in_a = inputFor(1);
+	std::vector<float> in_b = inputFor(2);
+	std::vector<Tensor> out_a;
+	std::vector<Tensor> out_b;
+	plan->run(*a, {Tensor(Shape({2, 3, 2}), DataType::FP32, in_a.data(), false)}, out_a);
+	plan->run(*b, {Tensor(Shape({2, 3, 2}), DataType::FP32, in_b.data(), false)}, out_b);
+	ASSERT_EQ(out_a.size(), 1u);
+	EXPECT_NE(out_a[0].data(), out_b[0].data());
+	expectNear(out_a[0], reference(1));
+	expectNear(out_b[0], reference(2));
+
+	// Nothing leaked onto the shared graph: its intermediates are still unbound.
+	for (const auto& v : g.values()) {
+		if (v->producer() != nullptr) EXPECT_EQ(v->tensor(), nullptr) << v->name();
+	}
+
+	Graph other;
+	buildClassifier(other);
+	auto other_plan = other.compile();
+	EXPECT_THROW(other_plan->run(*a, {Tensor(Shape({2, 3, 2}), DataType::FP32, in_a.data(), false)}, out_a),
+				 std::invalid_argument);
+}
+
+TEST(ExecutionContextTest, ConcurrentRequestsOnOneCompiledPlan) {
+	Graph g;
+	buildClassifier(g);
+	auto plan = g.compile();
+
+	constexpr int kThreads = 4;
+	constexpr int kIterations = 200;
+	std::vector<std::vector<float>> expected;
+	for (int t = 0; t < kThreads; ++t) expected.push_back(reference(t));
+
+	std::vector<int> mismatches(kThreads, 0);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < kThreads; ++t) {
+		threads.emplace_back([&, t] {
+			auto ctx = plan->createContext();
+			std::vector<float> in = inputFor(t);
+			const std::vector<Tensor> inputs = {Tensor(Shape({2, 3, 2}), DataType::FP32, in.data(), false)};
+			std::vector<Tensor> outputs;
+			for (int i = 0; i < kIterations; ++i) {
+				plan->run(*ctx, inputs, outputs);
+				const float* y = outputs[0].data_as<float>();
+				for (std::size_t j = 0; j < expected[t].size(); ++j) {
+					if (std::fabs(y[j] - expected[t][j]) > 1e-6f) ++mismatches[t];
+				}
+			}
+		});
+	}
+	for (auto& th : threads) th.join();
+	for (int t = 0; t < kThreads; ++t) EXPECT_EQ(mismatches[t], 0) << "thread " << t;
+}
+
+TEST(ExecutionContextTest, ModelInferIsThreadSafe) {
+	Model model;
+	buildClassifier(model.graph());
+
+	constexpr int kThreads = 4;
+	std::vector<int> mismatches(kThreads, 0);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < kThreads; ++t) {
+		threads.emplace_back([&, t] {
+			const std::vector<float> expected = reference(t);
+			std::vector<float> in = inputFor(t);
+			for (int i = 0; i < 100; ++i) {
+				const Tensor y = model.infer(Tensor(Shape({2, 3, 2}), DataType::FP32, in.data(), false));
+				for (std::size_t j = 0; j < expected.size(); ++j) {
+					if (std::fabs(y.data_as<float>()[j] - expected[j]) > 1e-6f) ++mismatches[t];
+				}
+			}
+		});
+	}
+	for (auto& th : threads) th.join();
+	for (int t = 0; t < kThreads; ++t) EXPECT_EQ(mismatches[t], 0) << "thread " << t;
+
+	// Explicit contexts share the same compiled plan.
+	auto ctx = model.createContext();
+	EXPECT_EQ(&ctx->plan(), &model.plan());
+	std::vector<float> in = inputFor(3);
+	expectNear(model.infer(*ctx, Tensor(Shape({2, 3, 2}), DataType::FP32, in.data(), false)), reference(3));
+}
+
+TEST(ExecutionContextTest, ParallelStepsUseDisjointScratch) {
+	constexpr int kWidth = 16;
+	Graph g;
+	buildWideRelu(g, kWidth);
+	CompileOptions options;
+	options.parallel = true;
+	options.bind_memory = false;
+	auto plan = g.compile(options);
+
+	ThreadPool pool(4);
+	constexpr int kRequests = 2;
+	std::vector<int> mismatches(kRequests, 0);
+	std::vector<std::thread> clients;
+	for (int r = 0; r < kRequests; ++r) {
+		clients.emplace_back([&, r] {
+			ParallelExecutor executor(*plan, pool);
+			auto ctx = plan->createContext();
+			std::vector<float> in(4 * 64);
+			for (std::size_t i = 0; i < in.size(); ++i) in[i] = static_cast<float>(i % 9) - 4.0f + static_cast<float>(r);
+			const std::vector<Tensor> inputs = {Tensor(Shape({4, 64}), DataType::FP32, in.data(), false)};
+			std::vector<Tensor> outputs;
+			for (int iter = 0; iter < 50; ++iter) {
+				executor.run(*ctx, inputs, outputs);
+				for (const Tensor& y : outputs) {
+					if (y.shape() != Shape({4, 64})) {
+						++mismatches[r];
+						continue;
+					}
+					for (std::size_t i = 0; i < in.size(); ++i) {
+						if (y.data_as<float>()[i] != std::max(in[i], 0.0f)) ++mismatches[r];
+					}
+				}
+			}
+			// Each output has its own scratch buffer.
+			for (int i = 1; i < kWidth; ++i) {
+				if (outputs[static_cast<std::size_t>(i)].data() == outputs[0].data()) ++mismatches[r];
+			}
+		});
+	}
+	for (auto& c : clients) c.join();
+	for (int r = 0; r < kRequests; ++r) EXPECT_EQ(mismatches[r], 0) << "request " << r;
+}
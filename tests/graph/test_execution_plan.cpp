@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/matmul_bias.h"
+
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+class CountingOp final : public Operator {
+public:
+	explicit CountingOp(int* validations) : Operator("Counting"), validations_(validations) {}
+	void validate() const override {
+		Operator::validate();
+		++*validations_;
+	}
+	void execute() override { ++executions; }
+	std::unique_ptr<Operator> clone() const override { return std::make_unique<CountingOp>(*this); }
+	int executions = 0;
+
+private:
+	int* validations_;
+};
+
+// y = relu(x * W + b) with W = [[1, -1], [1, -1]] and b = [0, 1].
+void buildMlp(Graph& g) {
+	Value* x = g.createValue(Shape({1, 2}), DataType::FP32, "x");
+	Value* h = g.createValue(Shape({1, 2}), DataType::FP32, "h");
+	Value* y = g.createValue(Shape({1, 2}), DataType::FP32, "y");
+	g.setInputs({x});
+	g.setOutputs({y});
+	Node* fc = g.addNode(std::make_unique<MatMulBiasOp>(2, 2, std::vector<float>{1, -1, 1, -1},
+														std::vector<float>{0, 1}));
+	fc->setInputs({x});
+	fc->setOutputs({h});
+	Node* relu = g.addNode(std::make_unique<ReluOp>());
+	relu->setInputs({h});
+	relu->setOutputs({y});
+}
+} // namespace
+
+TEST(ExecutionPlanTest, CompileProducesFlatScheduleAndRunsRepeatedly) {
+	Graph g;
+	buildMlp(g);
+
+	auto plan = g.compile();
+	ASSERT_NE(plan, nullptr);
+	ASSERT_EQ(plan->steps().size(), 2u);
+	EXPECT_EQ(plan->steps()[0].op->type(), "MatMulBias");
+	EXPECT_EQ(plan->steps()[1].op->type(), "ReLU");
+	EXPECT_GT(plan->memoryPlan().arena_bytes, 0u);
+
+	std::vector<float> a = {1.0f, 2.0f};
+	std::vector<float> b = {-3.0f, 1.0f};
+	std::vector<Tensor> inputs = {Tensor(Shape({1, 2}), DataType::FP32, a.data(), false)};
+	std::vector<Tensor> outputs;
+
+	plan->run(inputs, outputs);
+	ASSERT_EQ(outputs.size(), 1u);
+	const void* first_out = outputs[0].data();
+	EXPECT_FLOAT_EQ(outputs[0].data_as<float>()[0], 3.0f);
+	EXPECT_FLOAT_EQ(outputs[0].data_as<float>()[1], 0.0f);
+
+	inputs[0] = Tensor(Shape({1, 2}), DataType::FP32, b.data(), false);
+	plan->run(inputs, outputs);
+	EXPECT_EQ(outputs[0].data(), first_out);
+	EXPECT_FLOAT_EQ(outputs[0].data_as<float>()[0], 0.0f);
+	EXPECT_FLOAT_EQ(outputs[0].data_as<float>()[1], 3.0f);
+}
+
+TEST(ExecutionPlanTest, RunRejectsMismatchedInputs) {
+	Graph g;
+	buildMlp(g);
+	auto plan = g.compile();
+
+	std::vector<float> wrong(3, 0.0f);
+	std::vector<Tensor> outputs;
+	EXPECT_THROW(plan->run({}, outputs), std::invalid_argument);
+	EXPECT_THROW(plan->run({Tensor(Shape({1, 3}), DataType::FP32, wrong.data(), false)}, outputs),
+				 std::invalid_argument);
+}
+
+TEST(ExecutionPlanTest, ExecuteValidatesOnlyWhenGraphChanges) {
+	Graph g;
+	int validations = 0;
+	Value* x = g.createValue(Shape({1}), DataType::FP32, "x");
+	Value* y = g.createValue(Shape({1}), DataType::FP32, "y");
+	Node* n = g.addNode(std::make_unique<CountingOp>(&validations));
+	n->setInputs({x});
+	n->setOutputs({y});
+	g.setInputs({x});
+	g.setOutputs({y});
+
+	float v = 1.0f;
+	Tensor in(Shape({1}), DataType::FP32, &v, false);
+	(void)g.execute(in);
+	const int after_first = validations;
+	EXPECT_GT(after_first, 0);
+	for (int i = 0; i < 5; ++i) {
+		(void)g.execute(in);
+	}
+	EXPECT_EQ(validations, after_first);
+	EXPECT_EQ(static_cast<CountingOp*>(n->op())->executions, 6);
+
+	// Rewiring a node invalidates the cached plan.
+	n->setOutputs({y});
+	(void)g.execute(in);
+	EXPECT_GT(validations, after_first);
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/fused_elementwise.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/passes/fusion.h"
+
+#include <cmath>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+// y = relu(x * W + b), optionally followed by sigmoid and tanh.
+struct Mlp {
+	Value* x = nullptr;
+	Value* h = nullptr;
+	Value* y = nullptr;
+	Node* fc = nullptr;
+};
+
+Mlp buildMlp(Graph& g, bool with_tail) {
+	Mlp m;
+	m.x = g.createValue(Shape({2, 3}), DataType::FP32, "x");
+	m.h = g.createValue(Shape({2, 2}), DataType::FP32, "h");
+	Value* r = g.createValue(Shape({2, 2}), DataType::FP32, "r");
+	g.setInputs({m.x});
+	m.fc = g.addNode(std::make_unique<MatMulBiasOp>(3, 2, std::vector<float>{1, -1, 0.5f, 2, -1, 0.25f},
+												   std::vector<float>{0.1f, -0.2f}),
+					 "fc");
+	m.fc->setInputs({m.x});
+	m.fc->setOutputs({m.h});
+	Node* relu = g.addNode(std::make_unique<ReluOp>(), "relu");
+	relu->setInputs({m.h});
+	relu->setOutputs({r});
+	m.y = r;
+	if (with_tail) {
+		Value* s = g.createValue(Shape({2, 2}), DataType::FP32, "s");
+		Value* t = g.createValue(Shape({2, 2}), DataType::FP32, "t");
+		Node* sig = g.addNode(std::make_unique<SigmoidOp>(), "sigmoid");
+		sig->setInputs({r});
+		sig->setOutputs({s});
+		Node* tanh = g.addNode(std::make_unique<TanhOp>(), "tanh");
+		tanh->setInputs({s});
+		tanh->setOutputs({t});
+		m.y = t;
+	}
+	g.setOutputs({m.y});
+	return m;
+}
+
+std::vector<float> run(Graph& g) {
+	std::vector<float> in = {1, -2, 3, -0.5f, 0.25f, 4};
+	Tensor out = g.execute(Tensor(Shape({2, 3}), DataType::FP32, in.data(), false));
+	const float* p = out.data_as<float>();
+	return std::vector<float>(p, p + out.num_elements());
+}
+} // namespace
+
+TEST(FusionTest, FoldsReluIntoLinearAndDeletesIntermediate) {
+	Graph ref;
+	buildMlp(ref, false);
+	const std::vector<float> expected = run(ref);
+
+	Graph g;
+	Mlp m = buildMlp(g, false);
+	FuseLinearActivationPass pass;
+	g.applyPass(pass);
+
+	EXPECT_EQ(pass.fusedCount(), 1u);
+	ASSERT_EQ(g.nodes().size(), 1u);
+	EXPECT_EQ(static_cast<MatMulBiasOp*>(m.fc->op())->activation(), Activation::ReLU);
+	EXPECT_EQ(g.values().size(), 2u);
+	ASSERT_EQ(m.fc->outputs().size(), 1u);
+	EXPECT_EQ(m.fc->outputs()[0], m.y);
+	EXPECT_EQ(m.y->producer(), m.fc);
+	EXPECT_NE(m.fc->debugInfo().find("fused"), std::string::npos);
+
+	const std::vector<float> got = run(g);
+	ASSERT_EQ(got.size(), expected.size());
+	for (std::size_t i = 0; i < got.size(); ++i) EXPECT_FLOAT_EQ(got[i], expected[i]);
+}
+
+TEST(FusionTest, FusesElementwiseChainThenAbsorbsLeadingRelu) {
+	Graph ref;
+	buildMlp(ref, true);
+	const std::vector<float> expected = run(ref);
+
+	Graph g;
+	Mlp m = buildMlp(g, true);
+	FusionPass pass;
+	g.applyPass(pass);
+
+	// relu -> sigmoid -> tanh becomes one node, then relu moves into the GEMM.
+	EXPECT_EQ(pass.fusedCount(), 3u);
+	ASSERT_EQ(g.nodes().size(), 2u);
+	EXPECT_EQ(static_cast<MatMulBiasOp*>(m.fc->op())->activation(), Activation::ReLU);
+	const Node* tail = m.y->producer();
+	ASSERT_NE(tail, nullptr);
+	ASSERT_EQ(tail->op()->type(), "FusedElementwise");
+	const auto& steps = static_cast<const FusedElementwiseOp*>(tail->op())->steps();
+	EXPECT_EQ(steps, (std::vector<ElementwiseKind>{ElementwiseKind::Sigmoid, ElementwiseKind::Tanh}));
+	EXPECT_EQ(g.values().size(), 3u);
+
+	const std::vector<float> got = run(g);
+	ASSERT_EQ(got.size(), expected.size());
+	for (std::size_t i = 0; i < got.size(); ++i) EXPECT_NEAR(got[i], expected[i], 1e-6f);
+}
+
+TEST(FusionTest, LeavesSharedAndObservableValuesAlone) {
+	// h feeds both the ReLU and a graph output, so it must survive.
+	Graph g;
+	Mlp m = buildMlp(g, false);
+	g.setOutputs({m.y, m.h});
+	FusionPass pass;
+	g.applyPass(pass);
+	EXPECT_EQ(pass.fusedCount(), 0u);
+	EXPECT_EQ(g.nodes().size(), 2u);
+	EXPECT_EQ(static_cast<MatMulBiasOp*>(m.fc->op())->activation(), Activation::None);
+
+	// Two ReLUs reading h: neither may be folded into the GEMM.
+	Graph g2;
+	Mlp m2 = buildMlp(g2, false);
+	Value* r2 = g2.createValue(Shape({2, 2}), DataType::FP32, "r2");
+	Node* relu2 = g2.addNode(std::make_unique<ReluOp>(), "relu2");
+	relu2->setInputs({m2.h});
+	relu2->setOutputs({r2});
+	g2.setOutputs({m2.y, r2});
+	FuseLinearActivationPass linear;
+	g2.applyPass(linear);
+	EXPECT_EQ(linear.fusedCount(), 0u);
+	EXPECT_EQ(g2.nodes().size(), 3u);
+}
+
+TEST(FusedElementwiseTest, MatchesSequentialApplication) {
+	std::vector<float> x(5000);
+	for (std::size_t i = 0; i < x.size(); ++i) x[i] = std::sin(static_cast<float>(i) * 0.01f) * 4.0f;
+	std::vector<float> y(x.size());
+	applyElementwise(ElementwiseKind::Tanh, x.data(), y.data(), x.size());
+	applyElementwise(ElementwiseKind::ReLU, y.data(), y.data(), y.size());
+	for (std::size_t i = 0; i < x.size(); ++i) EXPECT_FLOAT_EQ(y[i], std::max(0.0f, std::tanh(x[i])));
+}
@@ -2,8 +2,17 @@
 #include <gtest/gtest.h>
 
 #include "inference_engine/graph/attributes.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
 #include "inference_engine/graph/operator.h"
 #include "inference_engine/graph/value.h"
+#include "inference_engine/ops/softmax.h"
+#include "inference_engine/ops/transpose.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
 
 using namespace infer;
 
@@ -51,6 +60,70 @@ TEST(GraphAttributesTest, GetThrowsOnMissingOrTypeMismatch) {
 	EXPECT_THROW((void)attrs.get<AttributeMap::String>("axis"), std::invalid_argument);
 }
 
+TEST(GraphAttributesTest, KeysAreInternedSymbols) {
+	const AttrKey axis("axis");
+	EXPECT_EQ(axis, attr_names::kAxis);
+	EXPECT_EQ(attr_names::kAxis.id(), 0u);
+	EXPECT_EQ(attr_names::kGroup.name(), "group");
+
+	const AttrKey approximate(std::string("approximate"));
+	EXPECT_EQ(approximate, AttrKey("approximate"));
+	EXPECT_NE(approximate, axis);
+	EXPECT_EQ(approximate.name(), "approximate");
+
+	AttributeMap attrs;
+	attrs.set(approximate, "none");
+	attrs.set("axis", 1);
+	attrs.set(attr_names::kAxis, 2); // same symbol: overwrites in place
+	ASSERT_EQ(attrs.size(), 2u);
+	EXPECT_EQ(attrs.raw()[0].first, approximate);
+	EXPECT_EQ(attrs.raw()[1].first, attr_names::kAxis);
+	EXPECT_EQ(attrs.get<AttributeMap::Int>(attr_names::kAxis), 2);
+	EXPECT_EQ(attrs.get<AttributeMap::String>("approximate"), "none");
+}
+
+TEST(GraphAttributesTest, CompileDecodesOperatorAttributes) {
+	using inference_engine::core::DataType;
+	using inference_engine::core::Shape;
+	using inference_engine::core::Tensor;
+
+	Graph g;
+	Value* x = g.createValue(Shape({2, 3}), DataType::FP32, "x");
+	Value* t = g.createValue(Shape({3, 2}), DataType::FP32, "t");
+	Value* y = g.createValue(Shape({3, 2}), DataType::FP32, "y");
+	AttributeMap transpose_attrs;
+	transpose_attrs.set(attr_names::kPerm, AttributeMap::Ints{1, 0});
+	AttributeMap softmax_attrs;
+	softmax_attrs.set(attr_names::kAxis, 1);
+
+	Node* transpose = g.addNode(std::make_unique<TransposeOp>(std::vector<int>{0, 1}), "transpose");
+	transpose->op()->setAttributes(&transpose_attrs);
+	transpose->setInputs({x});
+	transpose->setOutputs({t});
+	Node* softmax = g.addNode(std::make_unique<SoftmaxOp>(), "softmax");
+	softmax->op()->setAttributes(&softmax_attrs);
+	softmax->setInputs({t});
+	softmax->setOutputs({y});
+	g.setInputs({x});
+	g.setOutputs({y});
+
+	// The attributes replace the constructor's perm; softmax runs over rows of t.
+	std::vector<float> in = {0.0f, 1.0f, 2.0f, 0.0f, 0.0f, 0.0f};
+	const Tensor out = g.execute(Tensor(Shape({2, 3}), DataType::FP32, in.data(), false));
+	EXPECT_EQ(dynamic_cast<const TransposeOp*>(transpose->op())->perm(), (std::vector<int>{1, 0}));
+	const float* o = out.data_as<float>();
+	for (int r = 0; r < 3; ++r) {
+		const float e = std::exp(in[static_cast<std::size_t>(r)]);
+		EXPECT_NEAR(o[2 * r], e / (e + 1.0f), 1e-6f);
+		EXPECT_NEAR(o[2 * r + 1], 1.0f / (e + 1.0f), 1e-6f);
+	}
+
+	softmax_attrs.set(attr_names::kAxis, 0);
+	EXPECT_THROW((void)g.compile(), std::invalid_argument);
+	softmax_attrs.set(attr_names::kAxis, 1.0);
+	EXPECT_THROW((void)g.compile(), std::invalid_argument);
+}
+
 TEST(GraphAttributesTest, ToStringContainsKeys) {
 	AttributeMap attrs;
 	attrs.set("axis", 1);
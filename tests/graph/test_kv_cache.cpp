@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/kv_cache.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/ops/paged_attention.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+constexpr std::int64_t kRows = 2;
+constexpr std::int64_t kHeads = 4;
+constexpr std::int64_t kKvHeads = 2;
+constexpr std::int64_t kHeadDim = 8;
+
+KVCacheConfig smallConfig(std::size_t blocks) {
+	KVCacheConfig c;
+	c.layers = 2;
+	c.kv_heads = kKvHeads;
+	c.head_dim = kHeadDim;
+	c.block_tokens = 4;
+	c.blocks = blocks;
+	return c;
+}
+
+// q, k, v [2, ...] -> attention on layer 1 -> y
+PagedAttentionOp* buildAttention(Graph& g, KVCache& cache) {
+	Value* q = g.createValue(Shape({kRows, kHeads * kHeadDim}), DataType::FP32, "q");
+	Value* k = g.createValue(Shape({kRows, kKvHeads * kHeadDim}), DataType::FP32, "k");
+	Value* v = g.createValue(Shape({kRows, kKvHeads * kHeadDim}), DataType::FP32, "v");
+	Value* y = g.createValue(Shape({kRows, kHeads * kHeadDim}), DataType::FP32, "y");
+	g.setInputs({q, k, v});
+	g.setOutputs({y});
+	auto op = std::make_unique<PagedAttentionOp>(1, kHeads, kKvHeads, kHeadDim);
+	PagedAttentionOp* attention = op.get();
+	attention->bindCache(&cache);
+	Node* n = g.addNode(std::move(op), "attention");
+	n->setInputs({q, k, v});
+	n->setOutputs({y});
+	return attention;
+}
+
+// Full causal attention of one query row against every stored key and value.
+std::vector<float> recompute(const float* q, const std::vector<float>& keys, const std::vector<float>& values,
+							 std::size_t tokens) {
+	const std::size_t d = kHeadDim;
+	const std::size_t kv_row = kKvHeads * d;
+	const float scale = 1.0f / std::sqrt(static_cast<float>(d));
+	std::vector<float> out(kHeads * d);
+	for (std::size_t h = 0; h < kHeads; ++h) {
+		const std::size_t kvh = h / (kHeads / kKvHeads);
+		std::vector<double> s(tokens);
+		double m = -INFINITY;
+		for (std::size_t t = 0; t < tokens; ++t) {
+			double dot = 0.0;
+			for (std::size_t i = 0; i < d; ++i) {
+				dot += static_cast<double>(q[h * d + i]) * keys[t * kv_row + kvh * d + i];
+			}
+			s[t] = scale * dot;
+			m = std::max(m, s[t]);
+		}
+		double sum = 0.0;
+		for (double& x : s) sum += (x = std::exp(x - m));
+		for (std::size_t i = 0; i < d; ++i) {
+			double acc = 0.0;
+			for (std::size_t t = 0; t < tokens; ++t) acc += s[t] * values[t * kv_row + kvh * d + i];
+			out[h * d + i] = static_cast<float>(acc / sum);
+		}
+	}
+	return out;
+}
+
+} // namespace
+
+TEST(KVCacheTest, AllocatesAndRecyclesBlocks) {
+	KVCache cache(smallConfig(5));
+	EXPECT_EQ(cache.freeBlocks(), 5u);
+	const KVCache::SequenceId a = cache.addSequence();
+	const KVCache::SequenceId b = cache.addSequence();
+	EXPECT_NE(a, b);
+	EXPECT_EQ(cache.sequences(), 2u);
+
+	cache.beginStep({a}, 6); // two blocks of 4
+	EXPECT_EQ(cache.length(a), 6u);
+	EXPECT_EQ(cache.blockTable(a).size(), 2u);
+	EXPECT_EQ(cache.step().positions, (std::vector<std::size_t>{0}));
+	cache.beginStep({b, a}, 2); // b takes one block, a fills its second
+	EXPECT_EQ(cache.step().positions, (std::vector<std::size_t>{0, 6}));
+	EXPECT_EQ(cache.blockTable(a).size(), 2u);
+	EXPECT_EQ(cache.freeBlocks(), 2u);
+
+	// Needs 3 blocks with 2 free: nothing changes.
+	EXPECT_THROW(cache.beginStep({a, b}, 5), std::length_error);
+	EXPECT_EQ(cache.length(a), 8u);
+	EXPECT_EQ(cache.length(b), 2u);
+	EXPECT_EQ(cache.freeBlocks(), 2u);
+	EXPECT_EQ(cache.step().rows, (std::vector<KVCache::SequenceId>{b, a}));
+
+	EXPECT_THROW(cache.beginStep({a, a}), std::invalid_argument);
+	EXPECT_THROW(cache.beginStep({7}), std::invalid_argument);
+
+	// Blocks of a removed sequence are reused, and so is its id.
+	const std::vector<std::uint32_t> freed = cache.blockTable(a);
+	cache.removeSequence(a);
+	EXPECT_TRUE(cache.step().rows.empty());
+	EXPECT_EQ(cache.freeBlocks(), 4u);
+	EXPECT_THROW((void)cache.length(a), std::invalid_argument);
+	const KVCache::SequenceId c = cache.addSequence();
+	EXPECT_EQ(c, a);
+	EXPECT_EQ(cache.length(c), 0u);
+	cache.beginStep({c}, 4);
+	EXPECT_NE(std::find(freed.begin(), freed.end(), cache.blockTable(c)[0]), freed.end());
+
+	EXPECT_THROW(KVCache(smallConfig(0)), std::invalid_argument);
+	KVCacheConfig wide = smallConfig(1);
+	wide.block_tokens = 1024;
+	EXPECT_THROW(KVCache{wide}, std::invalid_argument);
+}
+
+TEST(KVCacheTest, DecodingMatchesFullRecompute) {
+	KVCache cache(smallConfig(8));
+	Graph g;
+	buildAttention(g, cache);
+	auto plan = g.compile();
+
+	std::mt19937 rng(3);
+	std::normal_distribution<float> dist(0.0f, 1.0f);
+	const std::size_t q_row = kHeads * kHeadDim;
+	const std::size_t kv_row = kKvHeads * kHeadDim;
+	std::vector<float> q(kRows * q_row), k(kRows * kv_row), v(kRows * kv_row);
+	const std::vector<Tensor> inputs{Tensor(Shape({kRows, kHeads * kHeadDim}), DataType::FP32, q.data(), false),
+									 Tensor(Shape({kRows, kKvHeads * kHeadDim}), DataType::FP32, k.data(), false),
+									 Tensor(Shape({kRows, kKvHeads * kHeadDim}), DataType::FP32, v.data(), false)};
+	std::vector<Tensor> outputs;
+
+	const KVCache::SequenceId a = cache.addSequence();
+	const KVCache::SequenceId b = cache.addSequence();
+	// Every key and value each sequence has seen, dense and in order.
+	std::vector<std::vector<float>> keys(2), values(2);
+
+	auto step = [&](std::vector<KVCache::SequenceId> rows, std::size_t tokens) {
+		for (float& x : q) x = dist(rng);
+		for (float& x : k) x = dist(rng);
+		for (float& x : v) x = dist(rng);
+		cache.beginStep(rows, tokens);
+		plan->run(inputs, outputs);
+		ASSERT_EQ(outputs.size(), 1u);
+		const float* y = outputs[0].data_as<float>();
+		for (std::size_t r = 0; r < rows.size(); ++r) {
+			for (std::size_t t = 0; t < tokens; ++t) {
+				const std::size_t row = r * tokens + t;
+				std::vector<float>& ks = keys[rows[r]];
+				std::vector<float>& vs = values[rows[r]];
+				ks.insert(ks.end(), k.begin() + row * kv_row, k.begin() + (row + 1) * kv_row);
+				vs.insert(vs.end(), v.begin() + row * kv_row, v.begin() + (row + 1) * kv_row);
+				const std::size_t seen = ks.size() / kv_row;
+				const std::vector<float> want = recompute(q.data() + row * q_row, ks, vs, seen);
+				for (std::size_t i = 0; i < q_row; ++i) {
+					EXPECT_NEAR(y[row * q_row + i], want[i], 1e-5f) << "seq " << rows[r] << " pos " << seen;
+				}
+			}
+		}
+	};
+
+	step({b}, 2); // prefills
+	step({a}, 2);
+	for (int i = 0; i < 9; ++i) step({a, b}, 1);
+	EXPECT_EQ(cache.length(a), 11u);
+	EXPECT_EQ(cache.length(b), 11u);
+	EXPECT_EQ(cache.blockTable(a).size(), 3u);
+
+	// The rows of a step must match the input batch.
+	cache.beginStep({a}, 1);
+	EXPECT_THROW(plan->run(inputs, outputs), std::invalid_argument);
+}
+
+TEST(KVCacheTest, OperatorChecksItsCache) {
+	KVCache cache(smallConfig(2));
+	PagedAttentionOp unbound(1, kHeads, kKvHeads, kHeadDim);
+	EXPECT_THROW(unbound.execute(), std::runtime_error);
+	EXPECT_THROW(PagedAttentionOp(0, 3, 2, kHeadDim), std::invalid_argument);
+
+	Graph g;
+	PagedAttentionOp* attention = buildAttention(g, cache);
+	EXPECT_NO_THROW(g.validate());
+	KVCache other(KVCacheConfig{1, kKvHeads, kHeadDim, 4, 2, {}});
+	attention->bindCache(&other); // layer 1 of a 1-layer cache
+	EXPECT_THROW(g.validate(), std::invalid_argument);
+}
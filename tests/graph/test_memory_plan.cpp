@@ -0,0 +1,447 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/reshape.h"
+#include "inference_engine/ops/softmax.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+class NoopOp final : public Operator {
+public:
+	NoopOp() : Operator("Noop") {}
+	void execute() override {}
+	std::unique_ptr<Operator> clone() const override { return std::make_unique<NoopOp>(*this); }
+};
+
+// Exposes a transposed view of a private [rows, cols] buffer, overwritten by every
+// run, instead of writing its planned output.
+class TransposedViewOp final : public Operator {
+public:
+	TransposedViewOp() : Operator("TransposedView") {}
+	void execute() override {
+		const Tensor* in = inputs()[0]->tensor();
+		buf_.assign(in->data_as<float>(), in->data_as<float>() + in->num_elements());
+		view_ = Tensor(in->shape(), DataType::FP32, buf_.data(), false).transpose({1, 0});
+		outputs()[0]->setTensor(&view_);
+	}
+	std::unique_ptr<Operator> clone() const override { return std::make_unique<TransposedViewOp>(); }
+
+private:
+	std::vector<float> buf_;
+	Tensor view_;
+};
+
+bool rangesOverlap(const ValueLifetime& a, const ValueLifetime& b) {
+	return a.first_index <= b.last_index && b.first_index <= a.last_index;
+}
+
+bool bytesOverlap(const ValueLifetime& a, const ValueLifetime& b) {
+	return a.offset < b.offset + b.bytes && b.offset < a.offset + a.bytes;
+}
+
+Node* link(Graph& g, std::unique_ptr<Operator> op, std::vector<Value*> in, std::vector<Value*> out) {
+	Node* n = g.addNode(std::move(op));
+	n->setInputs(std::move(in));
+	n->setOutputs(std::move(out));
+	return n;
+}
+
+// x[4,8] -> fc -> h -> relu -> r -> softmax -> y
+struct Mlp {
+	Value* h = nullptr;
+	Value* r = nullptr;
+	Value* y = nullptr;
+};
+
+Mlp buildSoftmaxMlp(Graph& g) {
+	Mlp m;
+	Value* x = g.createValue(Shape({4, 8}), DataType::FP32, "x");
+	m.h = g.createValue(Shape({4, 8}), DataType::FP32, "h");
+	m.r = g.createValue(Shape({4, 8}), DataType::FP32, "r");
+	m.y = g.createValue(Shape({4, 8}), DataType::FP32, "y");
+	std::vector<float> w(64);
+	for (std::size_t i = 0; i < w.size(); ++i) w[i] = static_cast<float>(static_cast<int>(i % 7) - 3) * 0.25f;
+	link(g, std::make_unique<MatMulBiasOp>(8, 8, w, std::vector<float>(8, 0.1f)), {x}, {m.h});
+	link(g, std::make_unique<ReluOp>(), {m.h}, {m.r});
+	link(g, std::make_unique<SoftmaxOp>(), {m.r}, {m.y});
+	g.setInputs({x});
+	g.setOutputs({m.y});
+	return m;
+}
+
+std::vector<float> mlpInput() {
+	std::vector<float> in(32);
+	for (std::size_t i = 0; i < in.size(); ++i) in[i] = static_cast<float>(i % 5) - 2.0f;
+	return in;
+}
+
+std::vector<float> runOnce(Graph& g) {
+	std::vector<float> in = mlpInput();
+	Tensor out = g.execute(Tensor(Shape({4, 8}), DataType::FP32, in.data(), false));
+	return std::vector<float>(out.data_as<float>(), out.data_as<float>() + out.num_elements());
+}
+} // namespace
+
+TEST(MemoryPlanTest, ChainReusesDeadBuffers) {
+	// x -> n1 -> a -> n2 -> b -> n3 -> c -> n4 -> d (all 1 KiB)
+	Graph g;
+	Value* x = g.createValue(Shape({256}), DataType::FP32, "x");
+	std::vector<Value*> vals;
+	Value* prev = x;
+	for (int i = 0; i < 4; ++i) {
+		Value* next = g.createValue(Shape({256}), DataType::FP32);
+		Node* n = g.addNode(std::make_unique<NoopOp>());
+		n->setInputs({prev});
+		n->setOutputs({next});
+		vals.push_back(next);
+		prev = next;
+	}
+	g.setInputs({x});
+	g.setOutputs({prev});
+
+	const MemoryPlan plan = g.planMemory();
+	EXPECT_FALSE(plan.lifetimes.at(x->id()).planned);
+
+	// Only two intermediates are ever live at once, so two slots suffice.
+	EXPECT_EQ(plan.arena_bytes, 2u * 1024u);
+	for (std::size_t i = 0; i < vals.size(); ++i) {
+		const auto& li = plan.lifetimes.at(vals[i]->id());
+		EXPECT_TRUE(li.planned);
+		EXPECT_EQ(li.offset % plan.alignment, 0u);
+		for (std::size_t j = i + 1; j < vals.size(); ++j) {
+			const auto& lj = plan.lifetimes.at(vals[j]->id());
+			if (rangesOverlap(li, lj)) {
+				EXPECT_FALSE(bytesOverlap(li, lj));
+			}
+		}
+	}
+}
+
+TEST(MemoryPlanTest, PeakFollowsTheLiveSetOfAWideGraph) {
+	// x fans out to 2000 branches of 64 B that a final node joins: every branch value
+	// stays live until the join, so the peak is all of them plus x (last read by the
+	// final branch) or plus the join output.
+	constexpr int kBranches = 2000;
+	Graph g;
+	Value* x = g.createValue(Shape({16}), DataType::FP32, "x");
+	std::vector<Value*> branches;
+	for (int i = 0; i < kBranches; ++i) {
+		branches.push_back(g.createValue(Shape({16}), DataType::FP32));
+		link(g, std::make_unique<NoopOp>(), {x}, {branches.back()});
+	}
+	Value* y = g.createValue(Shape({16}), DataType::FP32, "y");
+	link(g, std::make_unique<NoopOp>(), branches, {y});
+	g.setInputs({x});
+	g.setOutputs({y});
+
+	const MemoryPlan plan = g.planMemory();
+	EXPECT_EQ(plan.peak_bytes, (kBranches + 1) * 64u);
+	EXPECT_EQ(plan.lifetimes.at(x->id()).last_index, static_cast<std::size_t>(kBranches - 1));
+	EXPECT_EQ(plan.lifetimes.at(branches[0]->id()).last_index, static_cast<std::size_t>(kBranches));
+	EXPECT_EQ(plan.arena_bytes, (kBranches + 1) * 64u);
+	EXPECT_EQ(g.compile()->steps().back().node->inputs().size(), static_cast<std::size_t>(kBranches));
+}
+
+TEST(MemoryPlanTest, LiveValuesNeverShareBytes) {
+	// Diamond: x -> {a, b} -> c, plus a long-lived value feeding the last node.
+	Graph g;
+	Value* x = g.createValue(Shape({16}), DataType::FP32, "x");
+	Value* a = g.createValue(Shape({64}), DataType::FP32, "a");
+	Value* b = g.createValue(Shape({32}), DataType::FP32, "b");
+	Value* c = g.createValue(Shape({128}), DataType::FP32, "c");
+	Value* d = g.createValue(Shape({8}), DataType::FP32, "d");
+
+	Node* na = g.addNode(std::make_unique<NoopOp>());
+	na->setInputs({x});
+	na->setOutputs({a});
+	Node* nb = g.addNode(std::make_unique<NoopOp>());
+	nb->setInputs({x});
+	nb->setOutputs({b});
+	Node* nc = g.addNode(std::make_unique<NoopOp>());
+	nc->setInputs({a});
+	nc->setOutputs({c});
+	Node* nd = g.addNode(std::make_unique<NoopOp>());
+	nd->setInputs({b, c});
+	nd->setOutputs({d});
+	g.setInputs({x});
+	g.setOutputs({d});
+
+	const MemoryPlan plan = g.planMemory();
+	const std::vector<Value*> planned = {a, b, c, d};
+	std::size_t sum = 0;
+	for (Value* v : planned) {
+		const auto& lv = plan.lifetimes.at(v->id());
+		ASSERT_TRUE(lv.planned);
+		EXPECT_LE(lv.offset + lv.bytes, plan.arena_bytes);
+		sum += lv.bytes;
+		for (Value* w : planned) {
+			if (v == w) continue;
+			const auto& lw = plan.lifetimes.at(w->id());
+			if (rangesOverlap(lv, lw)) {
+				EXPECT_FALSE(bytesOverlap(lv, lw)) << v->name() << " vs " << w->name();
+			}
+		}
+	}
+	EXPECT_LT(plan.arena_bytes, sum);
+}
+
+TEST(MemoryPlanTest, BindMemoryBacksIntermediatesWithArena) {
+	Graph g;
+	Value* x = g.createValue(Shape({2, 3}), DataType::FP32, "x");
+	Value* h = g.createValue(Shape({2, 2}), DataType::FP32, "h");
+	Value* y = g.createValue(Shape({2, 2}), DataType::FP32, "y");
+	g.setInputs({x});
+	g.setOutputs({y});
+
+	// W[3,2]: column 0 sums inputs, column 1 negates the sum.
+	Node* fc = g.addNode(std::make_unique<MatMulBiasOp>(3, 2, std::vector<float>{1, -1, 1, -1, 1, -1},
+														std::vector<float>{0.5f, 0.5f}));
+	fc->setInputs({x});
+	fc->setOutputs({h});
+	Node* relu = g.addNode(std::make_unique<ReluOp>());
+	relu->setInputs({h});
+	relu->setOutputs({y});
+
+	const MemoryPlan plan = g.planMemory();
+	g.bindMemory(plan);
+	ASSERT_TRUE(g.hasBoundMemory());
+	ASSERT_NE(h->tensor(), nullptr);
+	ASSERT_NE(y->tensor(), nullptr);
+	EXPECT_EQ(x->tensor(), nullptr);
+
+	const auto base = reinterpret_cast<std::uintptr_t>(h->tensor()->data()) - plan.lifetimes.at(h->id()).offset;
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(y->tensor()->data()) - plan.lifetimes.at(y->id()).offset, base);
+	EXPECT_EQ(base % plan.alignment, 0u);
+
+	std::vector<float> in = {1, 2, 3, -1, -2, -3};
+	Tensor input(Shape({2, 3}), DataType::FP32, in.data(), false);
+	Tensor out = g.execute(input);
+	EXPECT_EQ(out.data(), y->tensor()->data());
+	const float* o = out.data_as<float>();
+	EXPECT_FLOAT_EQ(o[0], 6.5f);
+	EXPECT_FLOAT_EQ(o[1], 0.0f);
+	EXPECT_FLOAT_EQ(o[2], 0.0f);
+	EXPECT_FLOAT_EQ(o[3], 6.5f);
+
+	g.releaseMemory();
+	EXPECT_FALSE(g.hasBoundMemory());
+	EXPECT_EQ(h->tensor(), nullptr);
+}
+
+TEST(MemoryPlanTest, ElementwiseChainRunsInPlace) {
+	Graph g;
+	const Mlp m = buildSoftmaxMlp(g);
+	const MemoryPlan plan = g.planMemory();
+	const auto& h = plan.lifetimes.at(m.h->id());
+	const auto& r = plan.lifetimes.at(m.r->id());
+	const auto& y = plan.lifetimes.at(m.y->id());
+	ASSERT_TRUE(r.planned && y.planned);
+	EXPECT_EQ(r.alias_of, m.h->id());
+	EXPECT_EQ(y.alias_of, m.r->id());
+	EXPECT_EQ(r.offset, h.offset);
+	EXPECT_EQ(y.offset, h.offset);
+	EXPECT_EQ(plan.arena_bytes, 128u);
+	EXPECT_EQ(plan.peak_bytes, 128u + 128u); // the caller's input plus one slot
+
+	MemoryPlanOptions no_alias;
+	no_alias.in_place = false;
+	EXPECT_GT(g.planMemory(no_alias).arena_bytes, plan.arena_bytes);
+
+	// Same numbers as running the operators unplanned, each on its own buffer.
+	Graph ref;
+	const Mlp rm = buildSoftmaxMlp(ref);
+	std::vector<float> in = mlpInput();
+	Tensor ref_in(Shape({4, 8}), DataType::FP32, in.data(), false);
+	ref.inputs()[0]->setTensor(&ref_in);
+	for (Node* n : ref.topologicalSort()) n->op()->execute();
+	EXPECT_NE(rm.r->tensor()->data(), rm.h->tensor()->data());
+	const float* expected = rm.y->tensor()->data_as<float>();
+
+	const std::vector<float> got = runOnce(g);
+	ASSERT_EQ(got.size(), 32u);
+	for (std::size_t i = 0; i < got.size(); ++i) EXPECT_FLOAT_EQ(got[i], expected[i]);
+	ref.inputs()[0]->clearTensor();
+}
+
+TEST(MemoryPlanTest, InPlaceWaitsForLaterReaders) {
+	// h is also read by `late` after the ReLU, so the ReLU must not overwrite it.
+	Graph g;
+	Value* x = g.createValue(Shape({64}), DataType::FP32, "x");
+	Value* h = g.createValue(Shape({64}), DataType::FP32, "h");
+	Value* r = g.createValue(Shape({64}), DataType::FP32, "r");
+	Value* y = g.createValue(Shape({64}), DataType::FP32, "y");
+	link(g, std::make_unique<NoopOp>(), {x}, {h});
+	link(g, std::make_unique<ReluOp>(), {h}, {r});
+	link(g, std::make_unique<NoopOp>(), {h, r}, {y});
+	g.setInputs({x});
+	g.setOutputs({y});
+	const MemoryPlan plan = g.planMemory();
+	EXPECT_EQ(plan.lifetimes.at(r->id()).alias_of, 0u);
+	EXPECT_FALSE(bytesOverlap(plan.lifetimes.at(h->id()), plan.lifetimes.at(r->id())));
+
+	// Graph outputs stay intact too.
+	Graph g2;
+	Value* x2 = g2.createValue(Shape({64}), DataType::FP32, "x");
+	Value* h2 = g2.createValue(Shape({64}), DataType::FP32, "h");
+	Value* r2 = g2.createValue(Shape({64}), DataType::FP32, "r");
+	link(g2, std::make_unique<NoopOp>(), {x2}, {h2});
+	link(g2, std::make_unique<ReluOp>(), {h2}, {r2});
+	g2.setInputs({x2});
+	g2.setOutputs({h2, r2});
+	const MemoryPlan plan2 = g2.planMemory();
+	EXPECT_EQ(plan2.lifetimes.at(r2->id()).alias_of, 0u);
+	EXPECT_FALSE(bytesOverlap(plan2.lifetimes.at(h2->id()), plan2.lifetimes.at(r2->id())));
+}
+
+TEST(MemoryPlanTest, ReshapeViewsShareTheInputSlot) {
+	// x[2,4] -> reshape -> xv[8] -> relu -> r -> reshape -> rv[2,4] -> sigmoid -> y
+	Graph g;
+	Value* x = g.createValue(Shape({2, 4}), DataType::FP32, "x");
+	Value* xv = g.createValue(Shape({8}), DataType::FP32, "xv");
+	Value* r = g.createValue(Shape({8}), DataType::FP32, "r");
+	Value* rv = g.createValue(Shape({2, 4}), DataType::FP32, "rv");
+	Value* y = g.createValue(Shape({2, 4}), DataType::FP32, "y");
+	link(g, std::make_unique<ReshapeOp>(), {x}, {xv});
+	link(g, std::make_unique<ReluOp>(), {xv}, {r});
+	link(g, std::make_unique<ReshapeOp>(), {r}, {rv});
+	link(g, std::make_unique<SigmoidOp>(), {rv}, {y});
+	g.setInputs({x});
+	g.setOutputs({y});
+
+	const MemoryPlan plan = g.planMemory();
+	// xv views the caller's buffer: no slot, and the ReLU may not overwrite it.
+	EXPECT_FALSE(plan.lifetimes.at(xv->id()).planned);
+	EXPECT_EQ(plan.lifetimes.at(xv->id()).alias_of, x->id());
+	EXPECT_EQ(plan.lifetimes.at(r->id()).alias_of, 0u);
+	EXPECT_EQ(plan.lifetimes.at(rv->id()).offset, plan.lifetimes.at(r->id()).offset);
+	EXPECT_EQ(plan.lifetimes.at(y->id()).offset, plan.lifetimes.at(r->id()).offset);
+	EXPECT_EQ(plan.arena_bytes, 32u < plan.alignment ? plan.alignment : 32u);
+
+	std::vector<float> in = {-1, 2, -3, 4, -5, 6, -7, 8};
+	Tensor out = g.execute(Tensor(Shape({2, 4}), DataType::FP32, in.data(), false));
+	ASSERT_EQ(out.shape(), Shape({2, 4}));
+	EXPECT_EQ(xv->tensor()->data(), static_cast<const void*>(in.data()));
+	for (std::size_t i = 0; i < in.size(); ++i) {
+		const float relu = in[i] > 0.0f ? in[i] : 0.0f;
+		EXPECT_FLOAT_EQ(out.data_as<float>()[i], 1.0f / (1.0f + std::exp(-relu)));
+		EXPECT_FLOAT_EQ(in[i], i % 2 == 0 ? -static_cast<float>(i + 1) : static_cast<float>(i + 1));
+	}
+}
+
+TEST(MemoryPlanTest, ConcurrentPlanOnlyOverwritesProvablyDeadInputs) {
+	// h feeds two independent ReLUs; under a parallel schedule neither may reuse h.
+	Graph g;
+	Value* x = g.createValue(Shape({64}), DataType::FP32, "x");
+	Value* h = g.createValue(Shape({64}), DataType::FP32, "h");
+	Value* a = g.createValue(Shape({64}), DataType::FP32, "a");
+	Value* b = g.createValue(Shape({64}), DataType::FP32, "b");
+	Value* y = g.createValue(Shape({64}), DataType::FP32, "y");
+	Value* t = g.createValue(Shape({64}), DataType::FP32, "t");
+	link(g, std::make_unique<NoopOp>(), {x}, {h});
+	link(g, std::make_unique<ReluOp>(), {h}, {a});
+	link(g, std::make_unique<ReluOp>(), {h}, {b});
+	link(g, std::make_unique<NoopOp>(), {a, b}, {y});
+	link(g, std::make_unique<TanhOp>(), {y}, {t});
+	g.setInputs({x});
+	g.setOutputs({t});
+
+	MemoryPlanOptions options;
+	options.concurrent = true;
+	const MemoryPlan plan = g.planMemory(options);
+	EXPECT_EQ(plan.lifetimes.at(a->id()).alias_of, 0u);
+	EXPECT_EQ(plan.lifetimes.at(b->id()).alias_of, 0u);
+	EXPECT_FALSE(bytesOverlap(plan.lifetimes.at(h->id()), plan.lifetimes.at(a->id())));
+	EXPECT_FALSE(bytesOverlap(plan.lifetimes.at(h->id()), plan.lifetimes.at(b->id())));
+	EXPECT_FALSE(bytesOverlap(plan.lifetimes.at(a->id()), plan.lifetimes.at(b->id())));
+	// The tail has a single reader chain and still runs in place.
+	EXPECT_EQ(plan.lifetimes.at(t->id()).alias_of, y->id());
+}
+
+TEST(MemoryPlanTest, ExecuteResultsStayValidWhileHeld) {
+	Graph g;
+	const Mlp m = buildSoftmaxMlp(g);
+	(void)m;
+	std::vector<float> in = mlpInput();
+	const Tensor input(Shape({4, 8}), DataType::FP32, in.data(), false);
+
+	const Tensor first = g.execute(input);
+	ASSERT_TRUE(first.owns_data());
+	const std::vector<float> expected(first.data_as<float>(), first.data_as<float>() + first.num_elements());
+
+	// Holding `first` moves the next run to another arena instead of overwriting it.
+	std::vector<float> shifted(in.size(), 1.0f);
+	const Tensor second = g.execute(Tensor(Shape({4, 8}), DataType::FP32, shifted.data(), false));
+	EXPECT_NE(second.storage(), first.storage());
+	for (std::size_t i = 0; i < expected.size(); ++i) {
+		EXPECT_FLOAT_EQ(first.data_as<float>()[i], expected[i]) << i;
+	}
+
+	// Results survive releasing the graph's memory.
+	const void* second_data = second.data();
+	{
+		Tensor dropped = g.execute(input);
+		(void)dropped;
+	}
+	g.releaseMemory();
+	EXPECT_EQ(second.data(), second_data);
+	EXPECT_EQ(second.storage().use_count(), 1);
+}
+
+TEST(MemoryPlanTest, ExecuteReusesReleasedArenas) {
+	Graph g;
+	buildSoftmaxMlp(g);
+	std::vector<float> in = mlpInput();
+	const Tensor input(Shape({4, 8}), DataType::FP32, in.data(), false);
+
+	// Dropping each result before the next call keeps a single arena.
+	const void* data = g.execute(input).data();
+	for (int i = 0; i < 3; ++i) {
+		EXPECT_EQ(g.execute(input).data(), data);
+	}
+
+	// While one result is held the runs alternate between two arenas.
+	Tensor held = g.execute(input);
+	const void* a = held.data();
+	held = g.execute(input);
+	const void* b = held.data();
+	EXPECT_NE(a, b);
+	held = g.execute(input);
+	EXPECT_EQ(held.data(), a);
+	held = g.execute(input);
+	EXPECT_EQ(held.data(), b);
+}
+
+TEST(MemoryPlanTest, ExecuteCopiesStridedViewsOutsideTheArena) {
+	Graph g;
+	Value* x = g.createValue(Shape({2, 3}), DataType::FP32, "x");
+	Value* y = g.createValue(Shape({3, 2}), DataType::FP32, "y");
+	link(g, std::make_unique<TransposedViewOp>(), {x}, {y});
+	g.setInputs({x});
+	g.setOutputs({y});
+
+	std::vector<float> in = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+	const Tensor first = g.execute(Tensor(Shape({2, 3}), DataType::FP32, in.data(), false));
+	ASSERT_EQ(first.shape(), Shape({3, 2}));
+	EXPECT_TRUE(first.is_contiguous());
+	EXPECT_TRUE(first.owns_data());
+	const std::vector<float> expected = {0.0f, 3.0f, 1.0f, 4.0f, 2.0f, 5.0f};
+
+	// The next run overwrites the operator's buffer; the first result is a copy.
+	std::vector<float> other(6, -1.0f);
+	const Tensor second = g.execute(Tensor(Shape({2, 3}), DataType::FP32, other.data(), false));
+	EXPECT_EQ(second.data_as<float>()[0], -1.0f);
+	for (std::size_t i = 0; i < expected.size(); ++i) EXPECT_EQ(first.data_as<float>()[i], expected[i]) << i;
+}
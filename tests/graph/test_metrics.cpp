@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/core/model.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/metrics.h"
+#include "inference_engine/memory/allocator.h"
+#include "inference_engine/scheduler/batcher.h"
+#include "inference_engine/scheduler/executor.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include "../classifier_fixture.h"
+
+#include <future>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+constexpr std::int64_t kBatch = 4;
+constexpr std::int64_t kIn = 8;
+constexpr std::int64_t kOut = 4;
+
+// x[kBatch, kIn] -> fc -> relu -> softmax -> y
+void buildClassifier(Graph& g) {
+	fixtures::buildClassifier(g, Shape({kBatch, kIn}), kOut);
+}
+
+const MetricsSnapshot::Latency* findLatency(const std::vector<MetricsSnapshot::Latency>& rows,
+											const std::string& name) {
+	for (const auto& row : rows) {
+		if (row.name == name) return &row;
+	}
+	return nullptr;
+}
+} // namespace
+
+TEST(LatencyHistogramTest, BucketsByPowersOfTwoMicroseconds) {
+	LatencyHistogram h;
+	h.record(0);
+	h.record(1000);        // (0, 1us]
+	h.record(1001);        // (1us, 2us]
+	h.record(5000);        // (4us, 8us]
+	h.record(8000);        // (4us, 8us]
+	h.record(20000000000); // beyond the last bound
+	const LatencyHistogram::Snapshot s = h.snapshot();
+	EXPECT_EQ(s.count, 6u);
+	EXPECT_EQ(s.sum_ns, 0u + 1000 + 1001 + 5000 + 8000 + 20000000000ull);
+	EXPECT_EQ(s.counts[0], 2u);
+	EXPECT_EQ(s.counts[1], 1u);
+	EXPECT_EQ(s.counts[3], 2u);
+	EXPECT_EQ(s.counts[LatencyHistogram::kBuckets - 1], 1u);
+
+	EXPECT_EQ(LatencyHistogram::boundNs(3), 8000u);
+	EXPECT_EQ(s.quantileNs(0.0), 1000u);
+	EXPECT_EQ(s.quantileNs(0.5), 2000u);
+	EXPECT_EQ(s.quantileNs(0.8), 8000u);
+	EXPECT_EQ(s.quantileNs(1.0), LatencyHistogram::boundNs(LatencyHistogram::kBuckets - 2));
+	EXPECT_EQ(LatencyHistogram().snapshot().quantileNs(0.5), 0u);
+}
+
+TEST(MetricsTest, ModelRecordsInferAndOpLatencies) {
+	MetricsRegistry metrics;
+	Model model;
+	buildClassifier(model.graph());
+	std::vector<float> in(kBatch * kIn, 1.0f);
+	const Tensor x(Shape({kBatch, kIn}), DataType::FP32, in.data(), false);
+
+	(void)model.infer(x); // not recorded
+	model.setMetrics(&metrics, "classifier");
+	EXPECT_EQ(model.metrics(), &metrics);
+	for (int i = 0; i < 3; ++i) (void)model.infer(x);
+
+	MetricsSnapshot s = metrics.snapshot();
+	ASSERT_EQ(s.models.size(), 1u);
+	EXPECT_EQ(s.models[0].name, "classifier");
+	EXPECT_EQ(s.models[0].histogram.count, 3u);
+	EXPECT_GT(s.models[0].histogram.sum_ns, 0u);
+	ASSERT_EQ(s.ops.size(), model.plan().steps().size());
+	for (const auto& step : model.plan().steps()) {
+		const auto* op = findLatency(s.ops, step.op->type());
+		ASSERT_NE(op, nullptr) << step.op->type();
+		EXPECT_EQ(op->histogram.count, 3u) << step.op->type();
+	}
+
+	ASSERT_EQ(s.arenas.size(), 1u);
+	EXPECT_EQ(s.arenas[0].name, "classifier");
+	EXPECT_EQ(s.arenas[0].contexts, 1u);
+	EXPECT_EQ(s.arenas[0].bytes, model.arenaStats().bytes);
+	EXPECT_GE(s.arenas[0].peak_bytes, s.arenas[0].bytes);
+
+	model.setMetrics(nullptr);
+	(void)model.infer(x);
+	s = metrics.snapshot();
+	EXPECT_EQ(s.models[0].histogram.count, 3u);
+	EXPECT_TRUE(s.arenas.empty());
+}
+
+TEST(MetricsTest, ExecutorsRecordOpsWhileInstalled) {
+	Graph g;
+	buildClassifier(g);
+	CompileOptions options;
+	options.parallel = true;
+	auto plan = g.compile(options);
+	ThreadPool pool(2);
+	ParallelExecutor executor(*plan, pool);
+	std::vector<float> in(kBatch * kIn, 1.0f);
+	const std::vector<Tensor> inputs = {Tensor(Shape({kBatch, kIn}), DataType::FP32, in.data(), false)};
+	std::vector<Tensor> outputs;
+
+	MetricsRegistry metrics;
+	executor.run(inputs, outputs);
+	EXPECT_TRUE(metrics.snapshot().ops.empty());
+	{
+		MetricsRegistry::Scope scope(&metrics);
+		EXPECT_EQ(MetricsRegistry::current(), &metrics);
+		executor.run(inputs, outputs);
+		plan->run(inputs, outputs);
+	}
+	EXPECT_EQ(MetricsRegistry::current(), nullptr);
+	const MetricsSnapshot s = metrics.snapshot();
+	std::uint64_t steps = 0;
+	for (const auto& op : s.ops) steps += op.histogram.count;
+	EXPECT_EQ(steps, 2 * plan->steps().size());
+}
+
+TEST(MetricsTest, ReportsPoolsBatchersAndAllocators) {
+	MetricsRegistry metrics;
+	ThreadPool pool(2);
+	metrics.track("workers", pool);
+	pool.parallelFor(0, 64, 1, [](std::size_t, std::size_t) {});
+
+	inference_engine::core::AllocatorConfig config;
+	config.track_allocations = true;
+	inference_engine::core::SystemAllocator allocator(config);
+	metrics.track("scratch", allocator);
+	void* block = allocator.allocate(256);
+
+	Model model;
+	buildClassifier(model.graph());
+	model.setMetrics(&metrics, "classifier \"v2\"");
+	{
+		BatcherOptions options;
+		options.max_wait = std::chrono::microseconds(200);
+		DynamicBatcher batcher(model, options);
+		metrics.track("classifier", batcher);
+		std::vector<float> row(kIn, 0.5f);
+		std::vector<std::future<Tensor>> results;
+		for (int i = 0; i < 6; ++i) {
+			results.push_back(batcher.submit(Tensor(Shape({1, kIn}), DataType::FP32, row.data(), false)));
+		}
+		for (auto& r : results) (void)r.get();
+		batcher.shutdown();
+
+		const MetricsSnapshot s = metrics.snapshot();
+		ASSERT_EQ(s.batchers.size(), 1u);
+		EXPECT_EQ(s.batchers[0].requests, 6u);
+		EXPECT_EQ(s.batchers[0].queue_depth, 0u);
+		EXPECT_GE(s.batchers[0].max_queue_depth, 1u);
+		EXPECT_EQ(s.batchers[0].wait.count, 6u);
+		EXPECT_EQ(s.models[0].histogram.count, s.batchers[0].batches);
+
+		ASSERT_EQ(s.pools.size(), 1u);
+		EXPECT_EQ(s.pools[0].threads, 2u);
+		EXPECT_GT(s.pools[0].executed, 0u);
+		EXPECT_EQ(s.pools[0].queued, 0u);
+		ASSERT_EQ(s.allocators.size(), 1u);
+		EXPECT_EQ(s.allocators[0].live_bytes, 256u);
+		EXPECT_EQ(s.allocators[0].live_allocations, 1u);
+
+		std::ostringstream text;
+		metrics.writePrometheus(text);
+		const std::string out = text.str();
+		for (const char* line : {
+				 "# TYPE ie_model_latency_seconds histogram\n",
+				 "ie_model_latency_seconds_bucket{model=\"classifier \\\"v2\\\"\",le=\"1e-06\"} ",
+				 "ie_model_latency_seconds_bucket{model=\"classifier \\\"v2\\\"\",le=\"+Inf\"} ",
+				 "# TYPE ie_op_latency_seconds histogram\n",
+				 "ie_op_latency_seconds_count{op_type=\"Softmax\"} ",
+				 "ie_allocator_live_bytes{allocator=\"scratch\"} 256\n",
+				 "ie_thread_pool_threads{pool=\"workers\"} 2\n",
+				 "# TYPE ie_thread_pool_steals_total counter\n",
+				 "ie_thread_pool_busy_seconds_total{pool=\"workers\"} ",
+				 "ie_batcher_requests_total{batcher=\"classifier\"} 6\n",
+				 "ie_batcher_wait_seconds_count{batcher=\"classifier\"} 6\n",
+				 "ie_model_arena_peak_bytes{model=\"classifier \\\"v2\\\"\"} ",
+			 }) {
+			EXPECT_NE(out.find(line), std::string::npos) << line;
+		}
+		metrics.untrack(&batcher);
+	}
+	EXPECT_TRUE(metrics.snapshot().batchers.empty());
+	allocator.deallocate(block);
+	EXPECT_EQ(metrics.snapshot().allocators[0].live_bytes, 0u);
+}
@@ -5,6 +5,9 @@
 #include "inference_engine/graph/node.h"
 #include "inference_engine/graph/operator.h"
 
+#include <optional>
+#include <vector>
+
 using namespace infer;
 
 namespace {
@@ -84,3 +87,49 @@ TEST(GraphNodeTest, ValidateDetectsCycles) {
 	EXPECT_NE(order.size(), 2u);
 }
 
+
+TEST(GraphNodeTest, TopologyFollowsEditsAndDenseIndices) {
+	using inference_engine::core::DataType;
+	using inference_engine::core::Shape;
+	Graph g;
+	Value* x = g.createValue(Shape({4}), DataType::FP32, "x");
+	Value* a = g.createValue(Shape({4}), DataType::FP32, "a");
+	Value* b = g.createValue(Shape({4}), DataType::FP32, "b");
+	Value* c = g.createValue(Shape({4}), DataType::FP32, "c");
+
+	// Added consumer-first; "square" reads the same Value twice (one dependency).
+	Node* square = g.addNode(std::make_unique<NoopOp>(), "square");
+	Node* first = g.addNode(std::make_unique<NoopOp>(), "first");
+	first->setInputs({x});
+	first->setOutputs({a});
+	square->setInputs({a, a});
+	square->setOutputs({b});
+	g.setInputs({x});
+	g.setOutputs({b});
+	EXPECT_EQ(square->graphIndex(), 0u);
+	EXPECT_EQ(first->graphIndex(), 1u);
+	EXPECT_EQ(c->planSlot(), 3u);
+
+	EXPECT_NO_THROW(g.validate());
+	EXPECT_EQ(g.topologicalSort(), (std::vector<Node*>{first, square}));
+	EXPECT_EQ(square->topoIndex(), std::optional<std::size_t>(1));
+
+	// Rewiring drops the cached order.
+	Node* tail = g.addNode(std::make_unique<NoopOp>(), "tail");
+	tail->setInputs({b});
+	tail->setOutputs({c});
+	square->setInputs({x});
+	EXPECT_EQ(g.topologicalSort(), (std::vector<Node*>{square, first, tail}));
+
+	// Removal renumbers the survivors.
+	EXPECT_TRUE(g.removeNode(first));
+	EXPECT_EQ(square->graphIndex(), 0u);
+	EXPECT_EQ(tail->graphIndex(), 1u);
+	EXPECT_FALSE(g.removeNode(first));
+	EXPECT_EQ(g.topologicalSort(), (std::vector<Node*>{square, tail}));
+	EXPECT_TRUE(g.removeValue(a));
+	EXPECT_EQ(b->planSlot(), 1u);
+	EXPECT_EQ(c->planSlot(), 2u);
+	g.setOutputs({c});
+	EXPECT_NO_THROW(g.validate());
+}
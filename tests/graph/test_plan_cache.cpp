@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/core/model.h"
+#include "inference_engine/graph/execution_context.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/graph/plan_cache.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/passes/shape_inference.h"
+
+#include "../classifier_fixture.h"
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+constexpr std::int64_t kOut = 5;
+
+class NoopOp final : public Operator {
+public:
+	NoopOp() : Operator("Noop") {}
+	void execute() override {}
+	std::unique_ptr<Operator> clone() const override { return std::make_unique<NoopOp>(*this); }
+};
+
+// Identity whose shape inference at batch `hold` blocks until released, keeping a
+// PlanCache compile in flight.
+class GateOp final : public Operator {
+public:
+	struct Gate {
+		std::int64_t hold = 0;
+		std::promise<void> entered;
+		std::shared_future<void> release;
+	};
+
+	explicit GateOp(std::shared_ptr<Gate> gate) : Operator("Gate"), gate_(std::move(gate)) {}
+	void inferShapes() override {
+		const Shape& s = inputs()[0]->shape();
+		if (s.dim(0) == gate_->hold) {
+			gate_->entered.set_value();
+			gate_->release.wait();
+		}
+		outputs()[0]->setShape(s);
+	}
+	void execute() override {}
+	std::unique_ptr<Operator> clone() const override { return std::make_unique<GateOp>(*this); }
+
+private:
+	std::shared_ptr<Gate> gate_;
+};
+
+void link(Graph& g, std::unique_ptr<Operator> op, Value* in, Value* out) {
+	Node* n = g.addNode(std::move(op));
+	n->setInputs({in});
+	n->setOutputs({out});
+}
+
+// x[batch,2,3] -> reshape [batch,6] -> fc -> relu -> softmax -> y[batch,5]
+void buildClassifier(Graph& g, std::int64_t batch) {
+	fixtures::buildClassifier(g, Shape({batch, 2, 3}), kOut);
+}
+
+std::vector<float> inputFor(std::int64_t batch) {
+	std::vector<float> in(static_cast<std::size_t>(batch * 6));
+	for (std::size_t i = 0; i < in.size(); ++i) in[i] = static_cast<float>(static_cast<int>(i % 9) - 4) * 0.5f;
+	return in;
+}
+
+// Runs a graph built directly for `batch`.
+std::vector<float> reference(std::int64_t batch) {
+	Graph g;
+	buildClassifier(g, batch);
+	std::vector<float> in = inputFor(batch);
+	const Tensor out = g.execute(Tensor(Shape({batch, 2, 3}), DataType::FP32, in.data(), false));
+	return std::vector<float>(out.data_as<float>(), out.data_as<float>() + out.num_elements());
+}
+
+std::vector<float> runSpecialized(const SpecializedPlan& specialized, std::int64_t batch) {
+	auto ctx = specialized.plan().createContext();
+	std::vector<float> in = inputFor(batch);
+	std::vector<Tensor> outputs;
+	specialized.plan().run(*ctx, {Tensor(Shape({batch, 2, 3}), DataType::FP32, in.data(), false)}, outputs);
+	return std::vector<float>(outputs[0].data_as<float>(), outputs[0].data_as<float>() + outputs[0].num_elements());
+}
+
+void expectNear(const std::vector<float>& got, const std::vector<float>& expected) {
+	ASSERT_EQ(got.size(), expected.size());
+	for (std::size_t i = 0; i < got.size(); ++i) EXPECT_NEAR(got[i], expected[i], 1e-6f) << i;
+}
+} // namespace
+
+TEST(PlanCacheTest, ShapeInferencePropagatesInputShapes) {
+	Graph g;
+	buildClassifier(g, 1);
+	ShapeInferencePass pass({Shape({7, 2, 3})});
+	g.applyPass(pass);
+	for (const auto& v : g.values()) EXPECT_EQ(v->shape().dim(0), 7) << v->name();
+	EXPECT_EQ(g.outputs()[0]->shape(), Shape({7, kOut}));
+
+	ShapeInferencePass wrong_rank({Shape({7, 6})});
+	EXPECT_THROW(g.applyPass(wrong_rank), std::invalid_argument);
+	ShapeInferencePass wrong_count({Shape({7, 2, 3}), Shape({1})});
+	EXPECT_THROW(g.applyPass(wrong_count), std::invalid_argument);
+
+	Graph unsupported;
+	Value* a = unsupported.createValue(Shape({1, 4}), DataType::FP32, "a");
+	Value* b = unsupported.createValue(Shape({1, 4}), DataType::FP32, "b");
+	link(unsupported, std::make_unique<NoopOp>(), a, b);
+	unsupported.setInputs({a});
+	unsupported.setOutputs({b});
+	ShapeInferencePass noop({Shape({2, 4})});
+	EXPECT_THROW(unsupported.applyPass(noop), std::invalid_argument);
+}
+
+TEST(PlanCacheTest, CloneSharesWeightsAndLeavesSourceUntouched) {
+	Graph g;
+	buildClassifier(g, 2);
+	auto copy = g.clone();
+	ASSERT_EQ(copy->nodes().size(), g.nodes().size());
+	ASSERT_EQ(copy->values().size(), g.values().size());
+	const auto* fc = dynamic_cast<const MatMulBiasOp*>(g.nodes()[1]->op());
+	const auto* fc_copy = dynamic_cast<const MatMulBiasOp*>(copy->nodes()[1]->op());
+	ASSERT_NE(fc_copy, nullptr);
+	EXPECT_EQ(fc_copy->weights().data(), fc->weights().data());
+	EXPECT_NE(copy->inputs()[0], g.inputs()[0]);
+
+	ShapeInferencePass pass({Shape({4, 2, 3})});
+	copy->applyPass(pass);
+	EXPECT_EQ(g.inputs()[0]->shape(), Shape({2, 2, 3}));
+	EXPECT_EQ(copy->outputs()[0]->shape(), Shape({4, kOut}));
+}
+
+TEST(PlanCacheTest, CachesPlansPerShapeWithLruEviction) {
+	Graph g;
+	buildClassifier(g, 1);
+	PlanCacheOptions options;
+	options.capacity = 2;
+	PlanCache cache(g, options);
+
+	auto p3 = cache.acquire({Shape({3, 2, 3})});
+	auto p5 = cache.acquire({Shape({5, 2, 3})});
+	EXPECT_EQ(cache.acquire({Shape({3, 2, 3})}), p3);
+	EXPECT_EQ(cache.stats().hits, 1u);
+	EXPECT_EQ(cache.stats().misses, 2u);
+	expectNear(runSpecialized(*p3, 3), reference(3));
+	expectNear(runSpecialized(*p5, 5), reference(5));
+
+	// 5 is least recently used and goes; the held pointer stays usable.
+	auto p9 = cache.acquire({Shape({9, 2, 3})});
+	EXPECT_EQ(cache.size(), 2u);
+	EXPECT_EQ(cache.stats().evictions, 1u);
+	expectNear(runSpecialized(*p5, 5), reference(5));
+	expectNear(runSpecialized(*p9, 9), reference(9));
+	EXPECT_NE(cache.acquire({Shape({5, 2, 3})}), p5);
+	EXPECT_EQ(cache.stats().misses, 4u);
+
+	// A shape that fails to compile leaves the cached plans alone.
+	const std::uint64_t evictions = cache.stats().evictions;
+	EXPECT_THROW((void)cache.acquire({Shape({3, 7})}), std::invalid_argument);
+	EXPECT_EQ(cache.size(), 2u);
+	EXPECT_EQ(cache.stats().evictions, evictions);
+	EXPECT_THROW((void)cache.acquire({Shape({3, 7})}), std::invalid_argument);
+
+	// Editing the source drops every specialization.
+	g.invalidate();
+	EXPECT_NE(cache.acquire({Shape({3, 2, 3})}), p3);
+	EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(PlanCacheTest, PowerOfTwoBucketsShareOnePlan) {
+	Graph g;
+	buildClassifier(g, 1);
+	PlanCacheOptions options;
+	options.batch_bucketing = BatchBucketing::PowerOfTwo;
+	PlanCache cache(g, options);
+
+	EXPECT_EQ(cache.bucketed({Shape({5, 2, 3})})[0], Shape({8, 2, 3}));
+	EXPECT_EQ(cache.bucketed({Shape({8, 2, 3})})[0], Shape({8, 2, 3}));
+	auto p = cache.acquire({Shape({5, 2, 3})});
+	EXPECT_EQ(cache.acquire({Shape({7, 2, 3})}), p);
+	EXPECT_EQ(p->inputShapes()[0], Shape({8, 2, 3}));
+	EXPECT_EQ(cache.stats().misses, 1u);
+}
+
+TEST(PlanCacheTest, CompilingOneShapeDoesNotBlockOthers) {
+	auto gate = std::make_shared<GateOp::Gate>();
+	gate->hold = 3;
+	std::promise<void> release;
+	gate->release = release.get_future().share();
+	std::future<void> entered = gate->entered.get_future();
+	Graph g;
+	Value* x = g.createValue(Shape({1, 4}), DataType::FP32, "x");
+	Value* y = g.createValue(Shape({1, 4}), DataType::FP32, "y");
+	link(g, std::make_unique<GateOp>(gate), x, y);
+	g.setInputs({x});
+	g.setOutputs({y});
+	PlanCache cache(g);
+	auto p1 = cache.acquire({Shape({1, 4})});
+
+	auto first = std::async(std::launch::async, [&cache] { return cache.acquire({Shape({3, 4})}); });
+	entered.wait();
+	auto second = std::async(std::launch::async, [&cache] { return cache.acquire({Shape({3, 4})}); });
+	// While [3, 4] compiles, a hit on [1, 4] must not wait for it.
+	auto hit = std::async(std::launch::async, [&cache] { return cache.acquire({Shape({1, 4})}); });
+	const bool unblocked = hit.wait_for(std::chrono::seconds(10)) == std::future_status::ready;
+	release.set_value();
+	ASSERT_TRUE(unblocked);
+	EXPECT_EQ(hit.get(), p1);
+
+	// Both callers of [3, 4] get the one compiled plan.
+	auto p3 = first.get();
+	EXPECT_EQ(second.get(), p3);
+	EXPECT_EQ(p3->inputShapes()[0], Shape({3, 4}));
+	EXPECT_EQ(cache.stats().misses, 2u);
+	EXPECT_EQ(cache.stats().hits, 2u);
+}
+
+TEST(PlanCacheTest, ModelInfersVaryingBatchSizes) {
+	Model model;
+	buildClassifier(model.graph(), 1);
+	PlanCacheOptions options;
+	options.batch_bucketing = BatchBucketing::PowerOfTwo;
+	model.setPlanCacheOptions(options);
+
+	for (std::int64_t batch : {1, 3, 4, 6, 3, 1}) {
+		std::vector<float> in = inputFor(batch);
+		const Tensor y = model.infer(Tensor(Shape({batch, 2, 3}), DataType::FP32, in.data(), false));
+		EXPECT_EQ(y.shape(), Shape({batch, kOut}));
+		expectNear(std::vector<float>(y.data_as<float>(), y.data_as<float>() + y.num_elements()), reference(batch));
+	}
+	// Batch 1 is the graph's own shape; 3 and 4 share the 4 bucket, 6 uses 8.
+	EXPECT_EQ(model.planCache().size(), 2u);
+	EXPECT_EQ(model.planCache().stats().misses, 2u);
+}
@@ -0,0 +1,306 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/core/mapped_file.h"
+#include "inference_engine/core/model.h"
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/plan_format.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/binary_elementwise.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/softmax.h"
+#include "inference_engine/passes/fusion.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::MappedFile;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+// Removes the file when the test ends, pass or fail.
+struct TempFile {
+	explicit TempFile(const std::string& stem)
+		: path((std::filesystem::temp_directory_path() / ("ie_test_plan_" + stem)).string()) {}
+	~TempFile() { std::remove(path.c_str()); }
+	std::string path;
+};
+
+std::vector<float> wave(std::size_t n, float phase) {
+	std::vector<float> v(n);
+	for (std::size_t i = 0; i < n; ++i) v[i] = 0.5f * std::sin(0.9f * static_cast<float>(i) + phase);
+	return v;
+}
+
+// x[2, 8] -> fc1 -> relu, fc2 -> relu; add -> softmax -> y[2, width]
+void buildDiamond(Graph& g, std::int64_t width = 4) {
+	Value* x = g.createValue(Shape({2, 8}), DataType::FP32, "x");
+	Value* a = g.createValue(Shape({2, width}), DataType::FP32, "a");
+	Value* ra = g.createValue(Shape({2, width}), DataType::FP32, "ra");
+	Value* b = g.createValue(Shape({2, width}), DataType::FP32, "b");
+	Value* rb = g.createValue(Shape({2, width}), DataType::FP32, "rb");
+	Value* s = g.createValue(Shape({2, width}), DataType::FP32, "s");
+	Value* y = g.createValue(Shape({2, width}), DataType::FP32, "y");
+	g.setInputs({x});
+	g.setOutputs({y});
+	const auto w = static_cast<std::size_t>(width);
+	auto link = [&g](std::unique_ptr<Operator> op, std::vector<Value*> in, Value* out) {
+		Node* n = g.addNode(std::move(op));
+		n->setInputs(std::move(in));
+		n->setOutputs({out});
+	};
+	link(std::make_unique<MatMulBiasOp>(8, width, wave(8 * w, 0.0f), wave(w, 1.0f)), {x}, a);
+	link(std::make_unique<MatMulBiasOp>(8, width, wave(8 * w, 2.0f), wave(w, 3.0f)), {x}, b);
+	link(std::make_unique<ReluOp>(), {a}, ra);
+	link(std::make_unique<ReluOp>(), {b}, rb);
+	link(std::make_unique<BinaryElementwiseOp>(BinaryKind::Add), {ra, rb}, s);
+	link(std::make_unique<SoftmaxOp>(), {s}, y);
+}
+
+std::vector<float> run(ExecutionPlan& plan) {
+	std::vector<float> input = wave(16, 0.5f);
+	std::vector<Tensor> outputs;
+	plan.run({Tensor(Shape({2, 8}), DataType::FP32, input.data(), false)}, outputs);
+	const float* y = outputs.at(0).data_as<float>();
+	return std::vector<float>(y, y + outputs[0].num_elements());
+}
+
+std::vector<char> readAll(const std::string& path) {
+	std::ifstream in(path, std::ios::binary);
+	return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeAll(const std::string& path, const std::vector<char>& bytes) {
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+} // namespace
+
+TEST(PlanFormatTest, LoadedPlanMatchesCompiledPlan) {
+	TempFile file("roundtrip.ieplan");
+	Graph original;
+	buildDiamond(original);
+	auto compiled = original.compile();
+	const std::vector<float> expected = run(*compiled);
+	savePlan(original, *compiled, file.path);
+
+	// A fresh process builds the same graph and maps the plan instead of compiling.
+	Graph g;
+	buildDiamond(g);
+	EXPECT_EQ(graphFingerprint(g), graphFingerprint(original));
+	const MappedFile mapped(file.path);
+	auto loaded = loadPlan(mapped, g);
+	ASSERT_NE(loaded, nullptr);
+	ASSERT_EQ(loaded->steps().size(), compiled->steps().size());
+	for (std::size_t s = 0; s < loaded->steps().size(); ++s) {
+		EXPECT_EQ(loaded->steps()[s].node->graphIndex(), compiled->steps()[s].node->graphIndex());
+		EXPECT_EQ(loaded->steps()[s].successors, compiled->steps()[s].successors);
+		EXPECT_EQ(loaded->steps()[s].num_predecessors, compiled->steps()[s].num_predecessors);
+	}
+	const MemoryPlan& want = compiled->memoryPlan();
+	const MemoryPlan& got = loaded->memoryPlan();
+	EXPECT_EQ(got.arena_bytes, want.arena_bytes);
+	EXPECT_EQ(got.peak_bytes, want.peak_bytes);
+	ASSERT_EQ(got.lifetimes.size(), want.lifetimes.size());
+	for (std::size_t i = 0; i < g.values().size(); ++i) {
+		const auto w = want.lifetimes.find(original.values()[i]->id());
+		const auto l = got.lifetimes.find(g.values()[i]->id());
+		ASSERT_EQ(w == want.lifetimes.end(), l == got.lifetimes.end()) << i;
+		if (w == want.lifetimes.end()) continue;
+		EXPECT_EQ(l->second.offset, w->second.offset) << i;
+		EXPECT_EQ(l->second.planned, w->second.planned) << i;
+		EXPECT_EQ(l->second.alias_of != 0, w->second.alias_of != 0) << i;
+	}
+	EXPECT_EQ(run(*loaded), expected);
+}
+
+TEST(PlanFormatTest, StalePlansAreNotUsed) {
+	TempFile file("stale.ieplan");
+	{
+		Graph g;
+		buildDiamond(g);
+		savePlan(g, *g.compile(), file.path);
+	}
+	const std::vector<char> bytes = readAll(file.path);
+
+	Graph g;
+	buildDiamond(g);
+	// Another graph: wider layers.
+	Graph other;
+	buildDiamond(other, 6);
+	EXPECT_NE(graphFingerprint(other), graphFingerprint(g));
+	std::string reason;
+	EXPECT_EQ(loadPlan(MappedFile(file.path), other, {}, &reason), nullptr);
+	EXPECT_NE(reason.find("different graph"), std::string::npos) << reason;
+
+	// The same graph, but a sequential plan cannot run in parallel.
+	CompileOptions parallel;
+	parallel.parallel = true;
+	EXPECT_EQ(loadPlan(MappedFile(file.path), g, parallel, &reason), nullptr);
+	EXPECT_NE(reason.find("concurrent"), std::string::npos) << reason;
+
+	// Written for another ISA or format version.
+	plan_format::PlanHeader header{};
+	std::memcpy(&header, bytes.data(), sizeof(header));
+	for (int field = 0; field < 2; ++field) {
+		plan_format::PlanHeader changed = header;
+		if (field == 0) changed.isa += 1;
+		if (field == 1) changed.version += 1;
+		std::vector<char> copy = bytes;
+		std::memcpy(copy.data(), &changed, sizeof(changed));
+		writeAll(file.path, copy);
+		EXPECT_EQ(loadPlan(MappedFile(file.path), g, {}, &reason), nullptr) << field;
+		EXPECT_NE(reason.find(field == 0 ? "ISA" : "version"), std::string::npos) << reason;
+	}
+}
+
+TEST(PlanFormatTest, FingerprintCoversQuantizationAndAttributes) {
+	Graph g;
+	buildDiamond(g);
+	const std::uint64_t plain = graphFingerprint(g);
+
+	Graph quantized;
+	buildDiamond(quantized);
+	inference_engine::core::QuantizationParams qp;
+	qp.scale = 0.05f;
+	quantized.values()[1]->setQuantization(qp);
+	EXPECT_NE(graphFingerprint(quantized), plain);
+
+	Graph attributed;
+	buildDiamond(attributed);
+	AttributeMap attrs;
+	attrs.set("axis", 1);
+	attributed.nodes()[5]->op()->setAttributes(&attrs);
+	const std::uint64_t with_axis = graphFingerprint(attributed);
+	EXPECT_NE(with_axis, plain);
+	attrs.set("axis", 0);
+	EXPECT_NE(graphFingerprint(attributed), with_axis);
+}
+
+TEST(PlanFormatTest, PlanOfARewrittenGraphNeedsTheSamePasses) {
+	TempFile file("fused.ieplan");
+	{
+		Graph g;
+		buildDiamond(g);
+		FuseLinearActivationPass fuse;
+		g.applyPass(fuse);
+		ASSERT_EQ(fuse.fusedCount(), 2u);
+		savePlan(g, *g.compile(), file.path);
+	}
+
+	// The graph as built (or loaded from the model file) still has its ReLU nodes.
+	Graph g;
+	buildDiamond(g);
+	std::string reason;
+	EXPECT_EQ(loadPlan(MappedFile(file.path), g, {}, &reason), nullptr);
+	EXPECT_NE(reason.find("same passes"), std::string::npos) << reason;
+
+	FuseLinearActivationPass fuse;
+	g.applyPass(fuse);
+	auto loaded = loadPlan(MappedFile(file.path), g, {}, &reason);
+	ASSERT_NE(loaded, nullptr) << reason;
+	EXPECT_EQ(loaded->steps().size(), 4u);
+}
+
+TEST(PlanFormatTest, CorruptPlansAreRejected) {
+	TempFile file("corrupt.ieplan");
+	Graph g;
+	buildDiamond(g);
+	savePlan(g, *g.compile(), file.path);
+	const std::vector<char> bytes = readAll(file.path);
+	plan_format::PlanHeader header{};
+	std::memcpy(&header, bytes.data(), sizeof(header));
+
+	auto expectThrow = [&](std::vector<char> copy, const char* what) {
+		writeAll(file.path, copy);
+		EXPECT_THROW((void)loadPlan(MappedFile(file.path), g), std::runtime_error) << what;
+	};
+	std::vector<char> copy = bytes;
+	copy[0] = 'X';
+	expectThrow(copy, "magic");
+	copy = bytes;
+	copy.resize(copy.size() - 8);
+	expectThrow(copy, "truncated");
+	// A step that names the same node twice.
+	copy = bytes;
+	std::memcpy(copy.data() + sizeof(header) + sizeof(std::uint32_t), copy.data() + sizeof(header),
+				sizeof(std::uint32_t));
+	expectThrow(copy, "duplicate step");
+	// A successor that runs before its producer.
+	ASSERT_GT(header.edges, 0u);
+	copy = bytes;
+	const std::size_t succ = sizeof(header) + sizeof(std::uint32_t) * (2 * header.steps + 1);
+	const std::uint32_t first = 0;
+	std::memcpy(copy.data() + succ, &first, sizeof(first));
+	expectThrow(copy, "backward edge");
+	// A value placed beyond the arena.
+	copy = bytes;
+	plan_format::ValueRecord record{};
+	std::size_t slot = 0;
+	for (; slot < header.values; ++slot) {
+		std::memcpy(&record, bytes.data() + header.values_offset + slot * sizeof(record), sizeof(record));
+		if (record.flags & plan_format::kPlanned) break;
+	}
+	ASSERT_LT(slot, header.values);
+	record.offset = header.arena_bytes;
+	std::memcpy(copy.data() + header.values_offset + slot * sizeof(record), &record, sizeof(record));
+	expectThrow(copy, "offset");
+
+	Graph other;
+	buildDiamond(other);
+	EXPECT_THROW(savePlan(g, *other.compile(), file.path), std::invalid_argument);
+}
+
+TEST(PlanFormatTest, ModelStartsFromSavedPlan) {
+	TempFile model_file("model.iem");
+	TempFile plan_file("model.ieplan");
+	std::vector<float> input = wave(8, 0.25f);
+	Tensor x(Shape({1, 8}), DataType::FP32, input.data(), false);
+	std::vector<float> expected;
+	{
+		Model source;
+		Graph& g = source.graph();
+		Value* in = g.createValue(Shape({1, 8}), DataType::FP32, "x");
+		Value* h = g.createValue(Shape({1, 4}), DataType::FP32, "h");
+		Value* y = g.createValue(Shape({1, 4}), DataType::FP32, "y");
+		g.setInputs({in});
+		g.setOutputs({y});
+		Node* fc = g.addNode(std::make_unique<MatMulBiasOp>(8, 4, wave(32, 0.0f), wave(4, 1.0f), Activation::ReLU));
+		fc->setInputs({in});
+		fc->setOutputs({h});
+		Node* sm = g.addNode(std::make_unique<SoftmaxOp>());
+		sm->setInputs({h});
+		sm->setOutputs({y});
+		source.save(model_file.path);
+
+		Model loaded;
+		loaded.load(model_file.path);
+		const Tensor out = loaded.infer(x);
+		expected.assign(out.data_as<float>(), out.data_as<float>() + 4);
+		loaded.savePlan(plan_file.path);
+	}
+
+	Model m;
+	m.load(model_file.path);
+	std::string reason;
+	EXPECT_FALSE(m.loadPlan(plan_file.path + ".missing", &reason));
+	EXPECT_NE(reason.find("no plan file"), std::string::npos) << reason;
+	ASSERT_TRUE(m.loadPlan(plan_file.path));
+	const ExecutionPlan* installed = &m.plan();
+	const Tensor out = m.infer(x);
+	EXPECT_EQ(&m.plan(), installed); // not recompiled
+	EXPECT_EQ(std::vector<float>(out.data_as<float>(), out.data_as<float>() + 4), expected);
+}
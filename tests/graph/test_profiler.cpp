@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/graph/execution_plan.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/profiler.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/softmax.h"
+#include "inference_engine/scheduler/executor.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+constexpr std::int64_t kBatch = 4;
+constexpr std::int64_t kIn = 8;
+constexpr std::int64_t kOut = 6;
+
+Node* link(Graph& g, std::unique_ptr<Operator> op, std::vector<Value*> in, std::vector<Value*> out,
+		   std::string name) {
+	Node* n = g.addNode(std::move(op), std::move(name));
+	n->setInputs(std::move(in));
+	n->setOutputs(std::move(out));
+	return n;
+}
+
+// x -> fc -> relu -> softmax -> y, with a second relu branch off fc into y2.
+void buildGraph(Graph& g) {
+	Value* x = g.createValue(Shape({kBatch, kIn}), DataType::FP32, "x");
+	Value* h = g.createValue(Shape({kBatch, kOut}), DataType::FP32, "h");
+	Value* r = g.createValue(Shape({kBatch, kOut}), DataType::FP32, "r");
+	Value* y = g.createValue(Shape({kBatch, kOut}), DataType::FP32, "y");
+	Value* y2 = g.createValue(Shape({kBatch, kOut}), DataType::FP32, "y2");
+	std::vector<float> w(kIn * kOut, 0.125f);
+	link(g, std::make_unique<MatMulBiasOp>(kIn, kOut, w, std::vector<float>(kOut, 0.0f)), {x}, {h}, "fc \"main\"");
+	link(g, std::make_unique<ReluOp>(), {h}, {r}, "relu");
+	link(g, std::make_unique<SoftmaxOp>(), {r}, {y}, "softmax");
+	link(g, std::make_unique<SigmoidOp>(), {h}, {y2}, "sigmoid");
+	g.setInputs({x});
+	g.setOutputs({y, y2});
+}
+} // namespace
+
+TEST(ProfilerTest, RecordsStepsOnlyWhileInstalled) {
+	Graph g;
+	buildGraph(g);
+	auto plan = g.compile();
+	std::vector<float> in(kBatch * kIn, 1.0f);
+	const std::vector<Tensor> inputs = {Tensor(Shape({kBatch, kIn}), DataType::FP32, in.data(), false)};
+	std::vector<Tensor> outputs;
+
+	Profiler profiler;
+	plan->run(inputs, outputs);
+	EXPECT_TRUE(profiler.events().empty());
+	EXPECT_EQ(Profiler::current(), nullptr);
+	{
+		Profiler::Scope scope(&profiler);
+		EXPECT_EQ(Profiler::current(), &profiler);
+		plan->run(inputs, outputs);
+		plan->run(inputs, outputs);
+	}
+	EXPECT_EQ(Profiler::current(), nullptr);
+	plan->run(inputs, outputs);
+
+	const auto events = profiler.events();
+	ASSERT_EQ(events.size(), 2 * plan->steps().size());
+	const Profiler::Event* fc = nullptr;
+	for (const auto& e : events) {
+		EXPECT_EQ(e.thread, 0u);
+		if (e.op_type == "MatMulBias") fc = &e;
+	}
+	ASSERT_NE(fc, nullptr);
+	EXPECT_EQ(fc->node, "fc \"main\"");
+	EXPECT_EQ(fc->flops, static_cast<std::uint64_t>(kBatch * kOut * (2 * kIn + 1)));
+	// Input activations plus weights and bias; one output.
+	EXPECT_EQ(fc->bytes_read, static_cast<std::uint64_t>((kBatch * kIn + kIn * kOut + kOut) * sizeof(float)));
+	EXPECT_EQ(fc->bytes_written, static_cast<std::uint64_t>(kBatch * kOut * sizeof(float)));
+	EXPECT_GE(events.back().start_ns, events.front().start_ns);
+
+	const auto summary = profiler.summarize();
+	ASSERT_EQ(summary.size(), 4u);
+	for (std::size_t i = 1; i < summary.size(); ++i) EXPECT_GE(summary[i - 1].total_ns, summary[i].total_ns);
+	for (const auto& row : summary) EXPECT_EQ(row.calls, 2u) << row.op_type;
+
+	profiler.clear();
+	EXPECT_TRUE(profiler.events().empty());
+}
+
+TEST(ProfilerTest, ExportsChromeTraceAndSummaryTable) {
+	Graph g;
+	buildGraph(g);
+	std::vector<float> in(kBatch * kIn, 0.5f);
+	Profiler profiler;
+	{
+		Profiler::Scope scope(&profiler);
+		(void)g.execute(Tensor(Shape({kBatch, kIn}), DataType::FP32, in.data(), false));
+	}
+
+	std::ostringstream trace;
+	profiler.writeChromeTrace(trace);
+	const std::string json = trace.str();
+	EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+	EXPECT_NE(json.find("\"name\":\"fc \\\"main\\\"\""), std::string::npos);
+	EXPECT_NE(json.find("\"cat\":\"Softmax\""), std::string::npos);
+	EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+	EXPECT_NE(json.find("\"flops\":" + std::to_string(kBatch * kOut * (2 * kIn + 1))), std::string::npos);
+
+	std::ostringstream table;
+	profiler.printSummary(table);
+	const std::string text = table.str();
+	EXPECT_NE(text.find("op_type"), std::string::npos);
+	for (const char* type : {"MatMulBias", "ReLU", "Softmax", "Sigmoid"}) {
+		EXPECT_NE(text.find(type), std::string::npos) << type;
+	}
+}
+
+TEST(ProfilerTest, ParallelExecutorRecordsWorkerSteps) {
+	Graph g;
+	buildGraph(g);
+	CompileOptions options;
+	options.parallel = true;
+	auto plan = g.compile(options);
+	ThreadPool pool(2);
+	ParallelExecutor executor(*plan, pool);
+	std::vector<float> in(kBatch * kIn, 1.0f);
+	std::vector<Tensor> outputs;
+
+	Profiler profiler;
+	{
+		Profiler::Scope scope(&profiler);
+		executor.run({Tensor(Shape({kBatch, kIn}), DataType::FP32, in.data(), false)}, outputs);
+	}
+	const auto events = profiler.events();
+	ASSERT_EQ(events.size(), plan->steps().size());
+	for (const auto& e : events) EXPECT_LT(e.thread, 3u);
+
+	// Not installed: the executor records nothing.
+	executor.run({Tensor(Shape({kBatch, kIn}), DataType::FP32, in.data(), false)}, outputs);
+	EXPECT_EQ(profiler.events().size(), plan->steps().size());
+}
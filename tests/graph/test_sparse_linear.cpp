@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/matmul_bias_sparse.h"
+#include "inference_engine/passes/fusion.h"
+#include "inference_engine/passes/sparse_linear.h"
+
+#include <cmath>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+std::vector<float> wave(std::size_t n, float scale, float phase) {
+	std::vector<float> v(n);
+	for (std::size_t i = 0; i < n; ++i) v[i] = scale * std::sin(0.29f * static_cast<float>(i) + phase);
+	return v;
+}
+
+// w[k, n] keeping `kept` of every four rows; kept == 4 leaves it dense.
+std::vector<float> pruned(std::size_t k, std::size_t n, std::size_t kept, float phase) {
+	std::vector<float> w = wave(k * n, 0.05f, phase);
+	for (std::size_t i = 0; i < w.size(); ++i) {
+		if ((i / n + i % n) % 4 >= kept) w[i] = 0.0f;
+	}
+	return w;
+}
+
+Node* wire(Graph& g, std::unique_ptr<Operator> op, const char* name, Value* in, Value* out) {
+	Node* n = g.addNode(std::move(op), name);
+	n->setInputs({in});
+	n->setOutputs({out});
+	return n;
+}
+
+// x[batch, 256] -> fc1 (1 of 4 kept) -> relu -> fc2 (dense) -> y[batch, 64]
+void buildMlp(Graph& g, std::int64_t batch) {
+	Value* x = g.createValue(Shape({batch, 256}), DataType::FP32, "x");
+	Value* a = g.createValue(Shape({batch, 128}), DataType::FP32, "a");
+	Value* r = g.createValue(Shape({batch, 128}), DataType::FP32, "r");
+	Value* y = g.createValue(Shape({batch, 64}), DataType::FP32, "y");
+	g.setInputs({x});
+	wire(g, std::make_unique<MatMulBiasOp>(256, 128, pruned(256, 128, 1, 0.3f), wave(128, 0.1f, 1.0f)), "fc1", x, a);
+	wire(g, std::make_unique<ReluOp>(), "relu", a, r);
+	wire(g, std::make_unique<MatMulBiasOp>(128, 64, pruned(128, 64, 4, 0.7f), wave(64, 0.1f, 2.0f)), "fc2", r, y);
+	g.setOutputs({y});
+}
+
+std::vector<float> run(Graph& g, const Shape& shape) {
+	std::vector<float> in = wave(static_cast<std::size_t>(shape.num_elements()), 1.0f, 0.5f);
+	Tensor out = g.execute(Tensor(shape, DataType::FP32, in.data(), false));
+	const float* p = out.data_as<float>();
+	return std::vector<float>(p, p + out.num_elements());
+}
+
+void expectNear(const std::vector<float>& got, const std::vector<float>& want) {
+	ASSERT_EQ(got.size(), want.size());
+	for (std::size_t i = 0; i < got.size(); ++i) ASSERT_NEAR(got[i], want[i], 1e-4f) << "at " << i;
+}
+
+} // namespace
+
+TEST(SparseLinearTest, PrunedLayerSwitchesAndDenseLayerStays) {
+	Graph plain;
+	buildMlp(plain, 2);
+	const std::vector<float> want = run(plain, Shape({2, 256}));
+
+	Graph g;
+	buildMlp(g, 2);
+	SparseLinearPass sparse;
+	g.applyPass(sparse);
+	EXPECT_EQ(sparse.sparseLayers(), 1u);
+	const auto* fc1 = dynamic_cast<const MatMulBiasSparseOp*>(g.nodes()[0]->op());
+	ASSERT_NE(fc1, nullptr);
+	// One weight of every four rows fits 1:4, which stores no padding.
+	EXPECT_EQ(fc1->pattern().format, SparseFormat::NM);
+	EXPECT_EQ(fc1->storedWeights(), 256u * 128u / 4u);
+	EXPECT_NE(dynamic_cast<const MatMulBiasOp*>(g.nodes()[2]->op()), nullptr);
+	expectNear(run(g, Shape({2, 256})), want);
+
+	FuseLinearActivationPass fuse;
+	g.applyPass(fuse);
+	EXPECT_EQ(fuse.fusedCount(), 1u);
+	EXPECT_EQ(fc1->activation(), Activation::ReLU);
+	expectNear(run(g, Shape({2, 256})), want);
+}
+
+TEST(SparseLinearTest, DensityThresholdKeepsLayersDense) {
+	Graph g;
+	buildMlp(g, 1);
+	SparseLinearPass::Options options;
+	options.max_density = 0.2;
+	SparseLinearPass sparse(options);
+	g.applyPass(sparse);
+	EXPECT_EQ(sparse.sparseLayers(), 0u);
+	EXPECT_NE(dynamic_cast<const MatMulBiasOp*>(g.nodes()[0]->op()), nullptr);
+}
+
+TEST(SparseLinearTest, AutotunedChoiceKeepsResults) {
+	Graph plain;
+	buildMlp(plain, 4);
+	const std::vector<float> want = run(plain, Shape({4, 256}));
+
+	Graph g;
+	buildMlp(g, 4);
+	SparseLinearPass::Options options;
+	options.autotune = true;
+	SparseLinearPass sparse(options);
+	g.applyPass(sparse);
+	// Whether the sparse kernel wins depends on the machine; the result must not.
+	EXPECT_LE(sparse.sparseLayers(), 1u);
+	EXPECT_NE(dynamic_cast<const MatMulBiasOp*>(g.nodes()[2]->op()), nullptr);
+	expectNear(run(g, Shape({4, 256})), want);
+}
@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/kernels/attention.h"
+#include "inference_engine/kernels/registry.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using inference_engine::core::DataType;
+using namespace infer;
+
+namespace {
+
+// Keys and values of `tokens` positions scattered over pages in shuffled order.
+struct Pages {
+    std::size_t head_dim = 0;
+    std::size_t block_tokens = 0;
+    std::size_t stride = 0;
+    std::vector<float> keys;
+    std::vector<float> values;
+    std::vector<std::uint32_t> blocks;
+    std::vector<float> k; // dense [tokens, head_dim]
+    std::vector<float> v;
+};
+
+Pages makePages(std::size_t tokens, std::size_t head_dim, std::size_t block_tokens, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> dist(0.0f, 1.0f);
+    Pages p;
+    p.head_dim = head_dim;
+    p.block_tokens = block_tokens;
+    // Padding between pages catches reads past a page.
+    p.stride = block_tokens * head_dim + 3;
+    const std::size_t used = (tokens + block_tokens - 1) / block_tokens;
+    const std::size_t pool = used + 2;
+    p.keys.assign(pool * p.stride, NAN);
+    p.values.assign(pool * p.stride, NAN);
+    std::vector<std::uint32_t> order(pool);
+    std::iota(order.begin(), order.end(), 0u);
+    std::shuffle(order.begin(), order.end(), rng);
+    p.blocks.assign(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(used));
+    p.k.resize(tokens * head_dim);
+    p.v.resize(tokens * head_dim);
+    for (std::size_t t = 0; t < tokens; ++t) {
+        const std::size_t base = p.blocks[t / block_tokens] * p.stride + t % block_tokens * head_dim;
+        for (std::size_t i = 0; i < head_dim; ++i) {
+            p.k[t * head_dim + i] = p.keys[base + i] = dist(rng);
+            p.v[t * head_dim + i] = p.values[base + i] = dist(rng);
+        }
+    }
+    return p;
+}
+
+// softmax(scale * q . K) * V in double.
+std::vector<float> reference(const std::vector<float>& q, const Pages& p, std::size_t tokens, float scale) {
+    const std::size_t d = p.head_dim;
+    std::vector<double> s(tokens);
+    double m = -INFINITY;
+    for (std::size_t t = 0; t < tokens; ++t) {
+        double dot = 0.0;
+        for (std::size_t i = 0; i < d; ++i) dot += static_cast<double>(q[i]) * p.k[t * d + i];
+        s[t] = scale * dot;
+        m = std::max(m, s[t]);
+    }
+    double sum = 0.0;
+    for (double& x : s) sum += (x = std::exp(x - m));
+    std::vector<float> out(d);
+    for (std::size_t i = 0; i < d; ++i) {
+        double acc = 0.0;
+        for (std::size_t t = 0; t < tokens; ++t) acc += s[t] * p.v[t * d + i];
+        out[i] = static_cast<float>(acc / sum);
+    }
+    return out;
+}
+
+} // namespace
+
+TEST(AttentionKernelTest, PagedKernelsMatchReference) {
+    const auto candidates = KernelRegistry::instance().candidates("paged_attention", DataType::FP32);
+    ASSERT_FALSE(candidates.empty());
+    std::mt19937 rng(11);
+    std::normal_distribution<float> dist(0.0f, 1.0f);
+    for (const KernelEntry* e : candidates) {
+        SCOPED_TRACE(isa_to_string(e->isa));
+        auto* kernel = reinterpret_cast<PagedAttentionFn*>(e->fn);
+        for (std::size_t head_dim : {5u, 16u, 64u, 72u}) {
+            for (std::size_t block_tokens : {1u, 4u, 16u}) {
+                for (std::size_t tokens : {1u, 7u, 33u}) {
+                    for (std::size_t group : {1u, 3u}) {
+                        const Pages p = makePages(tokens, head_dim, block_tokens, static_cast<unsigned>(tokens));
+                        const std::size_t ld = head_dim + 2;
+                        std::vector<float> q(group * ld);
+                        for (float& x : q) x = dist(rng);
+                        std::vector<float> out(group * ld, -7.0f);
+                        PagedAttentionArgs args;
+                        args.q = q.data();
+                        args.ldq = ld;
+                        args.out = out.data();
+                        args.ldo = ld;
+                        args.group = group;
+                        args.keys = p.keys.data();
+                        args.values = p.values.data();
+                        args.blocks = p.blocks.data();
+                        args.block_stride = p.stride;
+                        args.block_tokens = block_tokens;
+                        args.tokens = tokens;
+                        args.head_dim = head_dim;
+                        args.scale = 1.0f / std::sqrt(static_cast<float>(head_dim));
+                        kernel(args);
+                        for (std::size_t g = 0; g < group; ++g) {
+                            const std::vector<float> qg(q.begin() + static_cast<std::ptrdiff_t>(g * ld),
+                                                        q.begin() + static_cast<std::ptrdiff_t>(g * ld + head_dim));
+                            const std::vector<float> want = reference(qg, p, tokens, args.scale);
+                            for (std::size_t i = 0; i < head_dim; ++i) {
+                                EXPECT_NEAR(out[g * ld + i], want[i], 1e-5f + 1e-5f * std::abs(want[i]))
+                                    << "d=" << head_dim << " bt=" << block_tokens << " n=" << tokens << " g=" << g;
+                            }
+                            // Row padding is never written.
+                            EXPECT_EQ(out[g * ld + head_dim], -7.0f);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(AttentionKernelTest, OnlineSoftmaxSurvivesGrowingMaxima) {
+    // Scores rise steeply page after page, so every page rescales the running sum.
+    const std::size_t d = 8, bt = 2, n = 12;
+    Pages p = makePages(n, d, bt, 5);
+    std::vector<float> q(d, 1.0f);
+    for (std::size_t t = 0; t < n; ++t) {
+        const std::size_t base = p.blocks[t / bt] * p.stride + t % bt * d;
+        for (std::size_t i = 0; i < d; ++i) p.k[t * d + i] = p.keys[base + i] = 2.0f * static_cast<float>(t);
+    }
+    for (const KernelEntry* e : KernelRegistry::instance().candidates("paged_attention", DataType::FP32)) {
+        SCOPED_TRACE(isa_to_string(e->isa));
+        std::vector<float> out(d);
+        PagedAttentionArgs args;
+        args.q = q.data();
+        args.out = out.data();
+        args.keys = p.keys.data();
+        args.values = p.values.data();
+        args.blocks = p.blocks.data();
+        args.block_stride = p.stride;
+        args.block_tokens = bt;
+        args.tokens = n;
+        args.head_dim = d;
+        reinterpret_cast<PagedAttentionFn*>(e->fn)(args);
+        const std::vector<float> want = reference(q, p, n, 1.0f);
+        for (std::size_t i = 0; i < d; ++i) EXPECT_NEAR(out[i], want[i], 1e-5f + 1e-5f * std::abs(want[i]));
+    }
+}
+
+TEST(AttentionKernelTest, DispatchValidatesArguments) {
+    std::vector<float> q(4, 1.0f), out(4, 1.0f);
+    PagedAttentionArgs args;
+    args.q = q.data();
+    args.out = out.data();
+    args.head_dim = 4;
+    args.block_tokens = 4;
+    args.tokens = 0;
+    paged_attention(args);
+    EXPECT_EQ(out, std::vector<float>(4, 0.0f));
+
+    args.group = kMaxAttentionGroup + 1;
+    EXPECT_THROW(paged_attention(args), std::invalid_argument);
+    args.group = 1;
+    args.block_tokens = kMaxAttentionBlockTokens + 1;
+    EXPECT_THROW(paged_attention(args), std::invalid_argument);
+}
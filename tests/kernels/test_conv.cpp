@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/kernels/conv.h"
+#include "inference_engine/kernels/registry.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using inference_engine::core::DataType;
+using namespace infer;
+
+namespace {
+
+std::vector<float> wave(std::size_t n, float scale, float phase) {
+    std::vector<float> v(n);
+    for (std::size_t i = 0; i < n; ++i) v[i] = scale * std::sin(0.37f * static_cast<float>(i) + phase);
+    return v;
+}
+
+Conv2dShape makeShape(std::size_t c, std::size_t h, std::size_t w, std::size_t m, std::size_t k, std::size_t stride,
+                      std::size_t pad, std::size_t dilation = 1, std::size_t groups = 1) {
+    Conv2dShape s;
+    s.batch = 2;
+    s.in_channels = c;
+    s.in_h = h;
+    s.in_w = w;
+    s.out_channels = m;
+    s.kernel_h = s.kernel_w = k;
+    s.stride_h = s.stride_w = stride;
+    s.pad_top = s.pad_left = pad;
+    s.pad_bottom = pad;
+    s.pad_right = pad + (pad > 0 ? 1 : 0); // asymmetric on purpose
+    s.dilation_h = s.dilation_w = dilation;
+    s.groups = groups;
+    return s;
+}
+
+// Direct definition in double precision, plain NCHW.
+std::vector<float> reference(const Conv2dShape& s, const std::vector<float>& x, const std::vector<float>& w,
+                             const std::vector<float>& bias, Activation act) {
+    const std::size_t oh = s.out_h(), ow = s.out_w();
+    const std::size_t icg = s.in_channels / s.groups, ocg = s.out_channels / s.groups;
+    std::vector<float> y(s.batch * s.out_channels * oh * ow);
+    for (std::size_t n = 0; n < s.batch; ++n) {
+        for (std::size_t oc = 0; oc < s.out_channels; ++oc) {
+            const std::size_t g = oc / ocg;
+            for (std::size_t i = 0; i < oh; ++i) {
+                for (std::size_t j = 0; j < ow; ++j) {
+                    double acc = bias.empty() ? 0.0 : bias[oc];
+                    for (std::size_t c = 0; c < icg; ++c) {
+                        for (std::size_t kh = 0; kh < s.kernel_h; ++kh) {
+                            for (std::size_t kw = 0; kw < s.kernel_w; ++kw) {
+                                const auto iy = static_cast<long>(i * s.stride_h + kh * s.dilation_h) -
+                                                static_cast<long>(s.pad_top);
+                                const auto ix = static_cast<long>(j * s.stride_w + kw * s.dilation_w) -
+                                                static_cast<long>(s.pad_left);
+                                if (iy < 0 || ix < 0 || iy >= static_cast<long>(s.in_h) ||
+                                    ix >= static_cast<long>(s.in_w)) {
+                                    continue;
+                                }
+                                const std::size_t ic = g * icg + c;
+                                acc += static_cast<double>(
+                                           x[((n * s.in_channels + ic) * s.in_h + static_cast<std::size_t>(iy)) *
+                                                 s.in_w +
+                                             static_cast<std::size_t>(ix)]) *
+                                       w[((oc * icg + c) * s.kernel_h + kh) * s.kernel_w + kw];
+                            }
+                        }
+                    }
+                    if (act == Activation::ReLU) acc = std::max(acc, 0.0);
+                    y[((n * s.out_channels + oc) * oh + i) * ow + j] = static_cast<float>(acc);
+                }
+            }
+        }
+    }
+    return y;
+}
+
+// conv2d() with `algorithm` on plain tensors, converting to and from NCHWc for the
+// blocked algorithm.
+std::vector<float> run(ConvAlgorithm algorithm, const Conv2dShape& s, const std::vector<float>& x,
+                       const std::vector<float>& w, const std::vector<float>& bias, Activation act) {
+    const std::size_t out_spatial = s.out_h() * s.out_w();
+    std::vector<float> packed(packed_conv_weights_size(algorithm, s));
+    if (!packed.empty()) pack_conv_weights(algorithm, s, w.data(), packed.data());
+
+    Conv2dArgs args;
+    args.w = packed.empty() ? w.data() : packed.data();
+    args.bias = bias.empty() ? nullptr : bias.data();
+    args.shape = s;
+    args.algorithm = algorithm;
+    args.activation = act;
+    std::vector<float> y(s.batch * s.out_channels * out_spatial);
+    if (algorithm != ConvAlgorithm::DirectNchwc) {
+        args.x = x.data();
+        args.y = y.data();
+        conv2d(args);
+        return y;
+    }
+    const std::size_t b = conv_channel_block();
+    std::vector<float> xb(s.batch * ((s.in_channels + b - 1) / b * b) * s.in_h * s.in_w, -7.0f);
+    std::vector<float> yb(s.batch * ((s.out_channels + b - 1) / b * b) * out_spatial, -7.0f);
+    nchw_to_nchwc(x.data(), xb.data(), s.batch, s.in_channels, s.in_h * s.in_w, b);
+    args.x = xb.data();
+    args.y = yb.data();
+    conv2d(args);
+    nchwc_to_nchw(yb.data(), y.data(), s.batch, s.out_channels, out_spatial, b);
+    return y;
+}
+
+void expectClose(const std::vector<float>& got, const std::vector<float>& want, float tol, const char* what) {
+    ASSERT_EQ(got.size(), want.size()) << what;
+    for (std::size_t i = 0; i < got.size(); ++i) {
+        ASSERT_NEAR(got[i], want[i], tol * (1.0f + std::fabs(want[i]))) << what << " at " << i;
+    }
+}
+
+const ConvAlgorithm kAlgorithms[] = {ConvAlgorithm::Im2colGemm, ConvAlgorithm::DirectNchwc,
+                                     ConvAlgorithm::WinogradF2x3, ConvAlgorithm::WinogradF4x3,
+                                     ConvAlgorithm::Depthwise};
+
+} // namespace
+
+TEST(ConvTest, EveryAlgorithmMatchesReference) {
+    const Conv2dShape shapes[] = {
+        makeShape(3, 9, 11, 5, 3, 1, 1),           // odd channels: partial NCHWc blocks
+        makeShape(16, 14, 13, 24, 3, 1, 1),        // several blocks, Winograd edge tiles
+        makeShape(8, 10, 10, 8, 3, 2, 1),          // stride 2
+        makeShape(6, 12, 12, 10, 3, 1, 2, 2),      // dilation
+        makeShape(4, 7, 9, 9, 1, 1, 0),            // pointwise (GEMM reads x in place)
+        makeShape(5, 8, 8, 7, 5, 1, 2),            // 5 x 5
+        makeShape(8, 9, 9, 12, 3, 1, 1, 1, 4),     // grouped
+        makeShape(12, 11, 37, 12, 3, 1, 1, 1, 12), // depthwise, vector and border pixels
+        makeShape(12, 11, 13, 12, 5, 2, 2, 1, 12), // depthwise, stride 2
+        makeShape(2, 2, 3, 4, 3, 1, 1),            // output smaller than one tile
+    };
+    for (const Conv2dShape& s : shapes) {
+        const std::size_t weights = s.out_channels * (s.in_channels / s.groups) * s.kernel_h * s.kernel_w;
+        const auto x = wave(s.batch * s.in_channels * s.in_h * s.in_w, 1.0f, 0.1f);
+        const auto w = wave(weights, 0.5f, 1.3f);
+        const auto bias = wave(s.out_channels, 0.2f, 2.1f);
+        for (const Activation act : {Activation::None, Activation::ReLU}) {
+            for (const auto& b : {std::vector<float>{}, bias}) {
+                const auto want = reference(s, x, w, b, act);
+                int checked = 0;
+                for (const ConvAlgorithm algorithm : kAlgorithms) {
+                    if (!conv_algorithm_supports(algorithm, s)) continue;
+                    ++checked;
+                    // Winograd trades a little accuracy for fewer multiplies.
+                    const float tol = algorithm == ConvAlgorithm::WinogradF4x3 ? 5e-4f : 2e-5f;
+                    SCOPED_TRACE(std::string(conv_algorithm_name(algorithm)) + " c=" + std::to_string(s.in_channels) +
+                                 " k=" + std::to_string(s.kernel_h) + " g=" + std::to_string(s.groups));
+                    expectClose(run(algorithm, s, x, w, b, act), want, tol, conv_algorithm_name(algorithm));
+                }
+                EXPECT_GE(checked, 1);
+            }
+        }
+    }
+}
+
+TEST(ConvTest, RejectsUnsupportedAlgorithms) {
+    const Conv2dShape strided = makeShape(8, 10, 10, 8, 3, 2, 1);
+    EXPECT_FALSE(conv_algorithm_supports(ConvAlgorithm::WinogradF2x3, strided));
+    EXPECT_FALSE(conv_algorithm_supports(ConvAlgorithm::Depthwise, strided));
+    EXPECT_FALSE(conv_algorithm_supports(ConvAlgorithm::Auto, strided));
+    const Conv2dShape grouped = makeShape(8, 9, 9, 12, 3, 1, 1, 1, 4);
+    EXPECT_FALSE(conv_algorithm_supports(ConvAlgorithm::DirectNchwc, grouped));
+    EXPECT_TRUE(conv_algorithm_supports(ConvAlgorithm::Im2colGemm, grouped));
+
+    std::vector<float> x(2 * 8 * 100), w(8 * 8 * 9), y(2 * 8 * 25);
+    Conv2dArgs args;
+    args.x = x.data();
+    args.w = w.data();
+    args.y = y.data();
+    args.shape = strided;
+    args.algorithm = ConvAlgorithm::WinogradF4x3;
+    EXPECT_THROW(conv2d(args), std::invalid_argument);
+    Conv2dShape too_small = makeShape(1, 2, 2, 1, 5, 1, 0);
+    EXPECT_FALSE(conv_algorithm_supports(ConvAlgorithm::Im2colGemm, too_small));
+}
+
+TEST(ConvTest, RowKernelsOfEveryIsaAgree) {
+    const KernelRegistry& registry = KernelRegistry::instance();
+    const Conv2dShape s = makeShape(1, 9, 23, 1, 3, 1, 1, 2, 1);
+    const auto x = wave(s.in_h * s.in_w, 1.0f, 0.4f);
+    const auto w = wave(9, 0.5f, 0.9f);
+    Conv2dShape one = s;
+    one.batch = 1;
+    const auto want = reference(one, x, w, {0.25f}, Activation::ReLU);
+    for (const KernelEntry* e : registry.candidates("conv2d_depthwise_row", DataType::FP32)) {
+        auto* fn = reinterpret_cast<ConvDepthwiseRowFn*>(e->fn);
+        std::vector<float> y(one.out_h() * one.out_w());
+        ConvDepthwiseRowArgs args;
+        args.x = x.data();
+        args.w = w.data();
+        args.bias = 0.25f;
+        args.in_h = s.in_h;
+        args.in_w = s.in_w;
+        args.kernel_h = args.kernel_w = 3;
+        args.dilation_h = args.dilation_w = 2;
+        args.pad_top = args.pad_left = 1;
+        args.out_w = one.out_w();
+        args.activation = Activation::ReLU;
+        for (std::size_t oh = 0; oh < one.out_h(); ++oh) {
+            args.oh = oh;
+            args.y = y.data() + oh * one.out_w();
+            fn(args);
+        }
+        expectClose(y, want, 1e-5f, isa_to_string(e->isa));
+    }
+    for (const KernelEntry* e : registry.candidates("conv2d_nchwc_block", DataType::FP32)) {
+        const std::size_t b = reinterpret_cast<ConvBlockFn*>(e->fn)();
+        EXPECT_TRUE(b == 8 || b == 16) << isa_to_string(e->isa);
+    }
+}
+
+TEST(ConvTest, LayoutConversionRoundTrips) {
+    for (const std::size_t block : {std::size_t{8}, std::size_t{16}}) {
+        for (const std::size_t channels : {std::size_t{1}, std::size_t{8}, std::size_t{13}, std::size_t{33}}) {
+            const std::size_t spatial = 7;
+            const auto x = wave(2 * channels * spatial, 1.0f, 0.0f);
+            const std::size_t blocked = 2 * ((channels + block - 1) / block * block) * spatial;
+            std::vector<float> xb(blocked, 9.0f), back(x.size());
+            nchw_to_nchwc(x.data(), xb.data(), 2, channels, spatial, block);
+            // Channel c of pixel p sits at [c / block][p][c % block]; padding lanes are 0.
+            const std::size_t blocks = (channels + block - 1) / block;
+            EXPECT_EQ(xb[((1 * blocks + 0) * spatial + 3) * block + 0], x[(1 * channels + 0) * spatial + 3]);
+            if (channels % block != 0) EXPECT_EQ(xb[(blocks * spatial - 1) * block + block - 1], 0.0f);
+            nchwc_to_nchw(xb.data(), back.data(), 2, channels, spatial, block);
+            EXPECT_EQ(back, x) << "block " << block << " channels " << channels;
+        }
+    }
+}
+
+TEST(ConvTest, HeuristicPicksAlgorithmByShape) {
+    EXPECT_EQ(select_conv_algorithm(makeShape(32, 12, 12, 32, 3, 1, 1, 1, 32), true), ConvAlgorithm::Depthwise);
+    EXPECT_EQ(select_conv_algorithm(makeShape(32, 12, 12, 64, 3, 1, 1, 1, 4), true), ConvAlgorithm::Im2colGemm);
+    EXPECT_EQ(select_conv_algorithm(makeShape(64, 14, 14, 64, 1, 1, 0), true), ConvAlgorithm::Im2colGemm);
+    EXPECT_EQ(select_conv_algorithm(makeShape(64, 32, 32, 64, 3, 1, 1), true), ConvAlgorithm::WinogradF4x3);
+    EXPECT_EQ(select_conv_algorithm(makeShape(64, 8, 8, 64, 3, 1, 1), true), ConvAlgorithm::WinogradF2x3);
+    EXPECT_EQ(select_conv_algorithm(makeShape(32, 16, 16, 32, 3, 2, 1), true), ConvAlgorithm::DirectNchwc);
+    EXPECT_EQ(select_conv_algorithm(makeShape(32, 16, 16, 32, 3, 2, 1), false), ConvAlgorithm::Im2colGemm);
+    EXPECT_EQ(select_conv_algorithm(makeShape(3, 16, 16, 4, 3, 2, 1), true), ConvAlgorithm::Im2colGemm);
+}
+
+TEST(ConvTest, AutotuneResultIsSupportedAndCached) {
+    const Conv2dShape s = makeShape(16, 12, 12, 16, 3, 1, 1);
+    const ConvAlgorithm first = autotune_conv_algorithm(s, false);
+    EXPECT_TRUE(conv_algorithm_supports(first, s));
+    EXPECT_NE(first, ConvAlgorithm::DirectNchwc);
+    for (int i = 0; i < 3; ++i) EXPECT_EQ(autotune_conv_algorithm(s, false), first);
+    Conv2dShape bigger_batch = s;
+    bigger_batch.batch = 8;
+    EXPECT_EQ(autotune_conv_algorithm(bigger_batch, false), first);
+    const ConvAlgorithm blocked = autotune_conv_algorithm(s, true);
+    EXPECT_TRUE(conv_algorithm_supports(blocked, s));
+}
@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/kernels/elementwise.h"
+#include "inference_engine/kernels/registry.h"
+#include "inference_engine/ops/activation.h"
+#include "inference_engine/ops/binary_elementwise.h"
+#include "inference_engine/passes/fusion.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+constexpr BinaryKind kBinaryKinds[] = {BinaryKind::Add, BinaryKind::Sub, BinaryKind::Mul,
+                                       BinaryKind::Div, BinaryKind::Max, BinaryKind::Min};
+
+float reference(BinaryKind kind, float a, float b) {
+    switch (kind) {
+    case BinaryKind::Add: return a + b;
+    case BinaryKind::Sub: return a - b;
+    case BinaryKind::Mul: return a * b;
+    case BinaryKind::Div: return a / b;
+    case BinaryKind::Max: return a > b ? a : b;
+    case BinaryKind::Min: return a < b ? a : b;
+    }
+    return 0.0f;
+}
+
+float reference(ElementwiseKind kind, float x) {
+    switch (kind) {
+    case ElementwiseKind::ReLU: return x > 0.0f ? x : 0.0f;
+    case ElementwiseKind::Sigmoid: return 1.0f / (1.0f + std::exp(-x));
+    case ElementwiseKind::Tanh: return std::tanh(x);
+    case ElementwiseKind::GELU: return 0.5f * x * std::erfc(-x * 0.70710678f);
+    }
+    return 0.0f;
+}
+
+std::int32_t ulpDistance(float a, float b) {
+    std::int32_t ia, ib;
+    std::memcpy(&ia, &a, sizeof(ia));
+    std::memcpy(&ib, &b, sizeof(ib));
+    if ((ia < 0) != (ib < 0)) return a == b ? 0 : INT32_MAX;
+    return std::abs(ia - ib);
+}
+
+std::vector<float> ramp(std::size_t n, float lo, float step) {
+    std::vector<float> v(n);
+    for (std::size_t i = 0; i < n; ++i) v[i] = lo + step * static_cast<float>(i);
+    return v;
+}
+
+// Naive broadcast: index every operand from the output coordinates.
+std::vector<float> referenceBroadcast(BinaryKind kind, const std::vector<float>& a, const Shape& as,
+                                      const std::vector<float>& b, const Shape& bs, const Shape& ys) {
+    const std::size_t rank = ys.rank();
+    std::vector<float> y(static_cast<std::size_t>(ys.num_elements()));
+    std::vector<std::int64_t> idx(rank, 0);
+    auto offset = [&](const Shape& s) {
+        std::int64_t off = 0;
+        for (std::size_t i = 0; i < s.rank(); ++i) {
+            const std::int64_t d = s.dim(i);
+            off = off * d + (d == 1 ? 0 : idx[rank - s.rank() + i]);
+        }
+        return static_cast<std::size_t>(off);
+    };
+    for (float& out : y) {
+        out = reference(kind, a[offset(as)], b[offset(bs)]);
+        for (std::size_t i = rank; i-- > 0;) {
+            if (++idx[i] < ys.dim(i)) break;
+            idx[i] = 0;
+        }
+    }
+    return y;
+}
+
+} // namespace
+
+TEST(ElementwiseTest, UnaryKernelsMatchReference) {
+    // 8003 values: not a multiple of any vector width, so every tail path runs.
+    const std::vector<float> x = ramp(8003, -30.0f, 0.0075f);
+    for (const KernelEntry* e : KernelRegistry::instance().candidates("elementwise_unary", DataType::FP32)) {
+        auto* fn = reinterpret_cast<ElementwiseUnaryFn*>(e->fn);
+        for (ElementwiseKind kind :
+             {ElementwiseKind::ReLU, ElementwiseKind::Sigmoid, ElementwiseKind::Tanh, ElementwiseKind::GELU}) {
+            std::vector<float> y(x.size());
+            fn(kind, x.data(), y.data(), x.size());
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                const float want = reference(kind, x[i]);
+                if (kind == ElementwiseKind::GELU) {
+                    ASSERT_NEAR(y[i], want, 2.5e-7f * std::max(1.0f, std::fabs(x[i])))
+                        << isa_to_string(e->isa) << " x=" << x[i];
+                } else {
+                    ASSERT_LE(ulpDistance(y[i], want), 4) << isa_to_string(e->isa) << " " << static_cast<int>(kind)
+                                                          << " x=" << x[i] << " got " << y[i] << " want " << want;
+                }
+            }
+        }
+    }
+}
+
+TEST(ElementwiseTest, BinaryKernelsMatchScalarExactly) {
+    const std::size_t n = 37;
+    std::vector<float> a = ramp(n, -3.0f, 0.17f);
+    std::vector<float> b = ramp(n, 2.5f, -0.13f);
+    b[5] = std::nanf("");
+    a[9] = std::nanf("");
+    for (const KernelEntry* e : KernelRegistry::instance().candidates("elementwise_binary", DataType::FP32)) {
+        auto* fn = reinterpret_cast<ElementwiseBinaryFn*>(e->fn);
+        for (BinaryKind kind : kBinaryKinds) {
+            for (BinaryOperands operands :
+                 {BinaryOperands::VectorVector, BinaryOperands::VectorScalar, BinaryOperands::ScalarVector}) {
+                std::vector<float> y(n);
+                fn(kind, operands, a.data() + 1, b.data() + 1, y.data(), n - 1);
+                for (std::size_t i = 0; i + 1 < n; ++i) {
+                    const float pa = operands == BinaryOperands::ScalarVector ? a[1] : a[i + 1];
+                    const float pb = operands == BinaryOperands::VectorScalar ? b[1] : b[i + 1];
+                    const float want = reference(kind, pa, pb);
+                    if (std::isnan(want)) {
+                        EXPECT_TRUE(std::isnan(y[i])) << isa_to_string(e->isa);
+                    } else {
+                        EXPECT_EQ(y[i], want) << isa_to_string(e->isa) << " i=" << i;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(ElementwiseTest, BroadcastsLikeNumpy) {
+    struct Case {
+        Shape a, b;
+    };
+    const Case cases[] = {
+        {Shape({4, 37}), Shape({4, 37})},       // same shape: one vector-vector run
+        {Shape({5, 37}), Shape({37})},          // bias row
+        {Shape({5, 37}), Shape({5, 1})},        // per-row scale (vector-scalar)
+        {Shape({1}), Shape({3, 11})},           // scalar on the left
+        {Shape({3, 1, 5}), Shape({4, 1})},      // both operands broadcast
+        {Shape({2, 1, 3, 1}), Shape({1, 4, 1, 6})},
+        {Shape({2, 3, 1}), Shape({2, 3, 1})},   // single-column output
+        {Shape({1, 1}), Shape({1})},            // single element
+    };
+    for (const Case& c : cases) {
+        const Shape y_shape = Shape::broadcast(c.a, c.b);
+        const std::vector<float> a = ramp(static_cast<std::size_t>(c.a.num_elements()), -2.0f, 0.37f);
+        const std::vector<float> b = ramp(static_cast<std::size_t>(c.b.num_elements()), 1.5f, -0.21f);
+        for (BinaryKind kind : kBinaryKinds) {
+            std::vector<float> y(static_cast<std::size_t>(y_shape.num_elements()), -99.0f);
+            elementwise_binary(kind, a.data(), c.a, b.data(), c.b, y.data(), y_shape);
+            EXPECT_EQ(y, referenceBroadcast(kind, a, c.a, b, c.b, y_shape))
+                << inference_engine::core::shape_to_string(c.a) << " op "
+                << inference_engine::core::shape_to_string(c.b);
+        }
+    }
+    std::vector<float> y(6);
+    const std::vector<float> a(6), b(4);
+    EXPECT_THROW(elementwise_binary(BinaryKind::Add, a.data(), Shape({2, 3}), b.data(), Shape({4}), y.data(),
+                                    Shape({2, 3})),
+                 std::invalid_argument);
+}
+
+TEST(ElementwiseTest, EpilogueAndLargeOutputsOnThePool) {
+    ThreadPool pool(4);
+    ThreadPool::Scope scope(&pool);
+    // [512, 384] + bias row, then ReLU and Tanh: big enough to be split into tasks.
+    const Shape a_shape({512, 384});
+    const std::vector<float> a = ramp(512 * 384, -8.0f, 1e-4f);
+    const std::vector<float> bias = ramp(384, -0.5f, 0.003f);
+    std::vector<float> y(a.size());
+    const ElementwiseKind post[] = {ElementwiseKind::ReLU, ElementwiseKind::Tanh};
+    elementwise_binary(BinaryKind::Add, a.data(), a_shape, bias.data(), Shape({384}), y.data(), a_shape, post, 2);
+    for (std::size_t i = 0; i < y.size(); ++i) {
+        const float want = std::tanh(std::max(0.0f, a[i] + bias[i % 384]));
+        ASSERT_LE(ulpDistance(y[i], want), 4) << i;
+    }
+
+    // The unary engine runs a chain in place.
+    std::vector<float> z = a;
+    elementwise_unary(post, 2, z.data(), z.data(), z.size());
+    for (std::size_t i = 0; i < z.size(); ++i) ASSERT_LE(ulpDistance(z[i], std::tanh(std::max(0.0f, a[i]))), 4);
+    EXPECT_GT(pool.stats().executed, 0u);
+}
+
+TEST(ElementwiseTest, FusionFoldsActivationIntoBinaryOp) {
+    Graph g;
+    Value* x = g.createValue(Shape({2, 3}), DataType::FP32, "x");
+    Value* bias = g.createValue(Shape({3}), DataType::FP32, "bias");
+    Value* sum = g.createValue(Shape({2, 3}), DataType::FP32, "sum");
+    Value* y = g.createValue(Shape({2, 3}), DataType::FP32, "y");
+    const std::vector<float> bias_data = {0.5f, -1.0f, 2.0f};
+    g.setInitializer(bias, Tensor(Shape({3}), DataType::FP32, const_cast<float*>(bias_data.data()), false));
+    Node* add = g.addNode(std::make_unique<BinaryElementwiseOp>(BinaryKind::Add), "add");
+    add->setInputs({x, bias});
+    add->setOutputs({sum});
+    Node* gelu = g.addNode(std::make_unique<GeluOp>(), "gelu");
+    gelu->setInputs({sum});
+    gelu->setOutputs({y});
+    g.setInputs({x});
+    g.setOutputs({y});
+
+    FusionPass pass;
+    g.applyPass(pass);
+    EXPECT_EQ(pass.fusedCount(), 1u);
+    ASSERT_EQ(g.nodes().size(), 1u);
+    const auto* op = dynamic_cast<const BinaryElementwiseOp*>(g.nodes()[0]->op());
+    ASSERT_NE(op, nullptr);
+    EXPECT_EQ(op->type(), "Add");
+    EXPECT_EQ(op->epilogue(), std::vector<ElementwiseKind>{ElementwiseKind::GELU});
+
+    std::vector<float> in = {1.0f, 2.0f, -3.0f, -0.25f, 0.0f, 0.75f};
+    const Tensor out = g.execute(Tensor(Shape({2, 3}), DataType::FP32, in.data(), false));
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        EXPECT_NEAR(out.data_as<float>()[i], reference(ElementwiseKind::GELU, in[i] + bias_data[i % 3]), 1e-6f);
+    }
+}
@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/core/dtype.h"
+#include "inference_engine/core/half.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/kernels/convert.h"
+#include "inference_engine/kernels/linear.h"
+#include "inference_engine/kernels/linear_scalar.h"
+#include "inference_engine/kernels/registry.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/matmul_bias_fp16.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Half;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using inference_engine::core::fp16_to_fp32;
+using inference_engine::core::fp32_to_fp16;
+using namespace infer;
+
+namespace {
+
+float fromBits(std::uint32_t b) {
+    float f;
+    std::memcpy(&f, &b, sizeof(f));
+    return f;
+}
+
+std::uint32_t toBits(float f) {
+    std::uint32_t b;
+    std::memcpy(&b, &f, sizeof(b));
+    return b;
+}
+
+// Values around every rounding boundary the conversion has to get right.
+std::vector<float> trickyFloats() {
+    std::vector<float> v = {0.0f,
+                            -0.0f,
+                            1.0f,
+                            -1.0f,
+                            1.0f + std::ldexp(1.0f, -11),       // tie, rounds down to even
+                            1.0f + 3.0f * std::ldexp(1.0f, -11), // tie, rounds up to even
+                            65504.0f,
+                            65519.99f,
+                            65520.0f, // tie at the top, overflows to Inf
+                            -70000.0f,
+                            std::ldexp(1.0f, -14),             // smallest normal
+                            std::ldexp(1.0f, -14) * 0.999f,    // largest subnormal region
+                            std::ldexp(1.0f, -24),             // smallest subnormal
+                            std::ldexp(1.0f, -25),             // tie to zero
+                            std::ldexp(1.0f, -25) * 1.0001f,   // rounds up to the smallest subnormal
+                            std::ldexp(3.0f, -25),             // subnormal tie, rounds to even (2)
+                            std::ldexp(1.0f, -30),
+                            std::numeric_limits<float>::denorm_min(),
+                            std::numeric_limits<float>::infinity(),
+                            -std::numeric_limits<float>::infinity(),
+                            std::numeric_limits<float>::quiet_NaN(),
+                            fromBits(0x7F800001u), // signaling NaN
+                            fromBits(0xFFC12345u)};
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<std::uint32_t> bits;
+    for (int i = 0; i < 4000; ++i) v.push_back(fromBits(bits(rng)));
+    std::uniform_real_distribution<float> dist(-70000.0f, 70000.0f);
+    for (int i = 0; i < 4000; ++i) v.push_back(dist(rng));
+    return v;
+}
+
+} // namespace
+
+TEST(HalfTest, KnownEncodings) {
+    EXPECT_EQ(fp32_to_fp16(1.0f), 0x3C00);
+    EXPECT_EQ(fp32_to_fp16(-2.0f), 0xC000);
+    EXPECT_EQ(fp32_to_fp16(65504.0f), 0x7BFF);
+    EXPECT_EQ(fp32_to_fp16(65520.0f), 0x7C00);
+    EXPECT_EQ(fp32_to_fp16(1.0f + std::ldexp(1.0f, -11)), 0x3C00);
+    EXPECT_EQ(fp32_to_fp16(1.0f + 3.0f * std::ldexp(1.0f, -11)), 0x3C02);
+    EXPECT_EQ(fp32_to_fp16(std::ldexp(1.0f, -24)), 0x0001);
+    EXPECT_EQ(fp32_to_fp16(std::ldexp(1.0f, -25)), 0x0000);
+    EXPECT_EQ(fp32_to_fp16(std::ldexp(3.0f, -25)), 0x0002);
+    EXPECT_EQ(fp32_to_fp16(-0.0f), 0x8000);
+    EXPECT_EQ(fp32_to_fp16(fromBits(0x7F800001u)) & 0x7E00, 0x7E00);
+    EXPECT_EQ(fp16_to_fp32(0x0001), std::ldexp(1.0f, -24));
+    EXPECT_EQ(fp16_to_fp32(0x7BFF), 65504.0f);
+    EXPECT_TRUE(std::isinf(fp16_to_fp32(0xFC00)));
+    EXPECT_TRUE(std::isnan(fp16_to_fp32(0x7D00)));
+
+    const Half h(0.5f);
+    EXPECT_EQ(h.bits, 0x3800);
+    EXPECT_EQ(static_cast<float>(h), 0.5f);
+    EXPECT_TRUE(Half::from_bits(0x3800).same_bits(h));
+}
+
+TEST(HalfTest, EveryHalfRoundTripsThroughFloat) {
+    for (std::uint32_t b = 0; b <= 0xFFFF; ++b) {
+        const auto h = static_cast<std::uint16_t>(b);
+        const bool nan = (h & 0x7C00) == 0x7C00 && (h & 0x03FF) != 0;
+        // Signaling NaNs come back quieted; everything else is exact.
+        const std::uint16_t expected = nan ? static_cast<std::uint16_t>(h | 0x0200) : h;
+        ASSERT_EQ(fp32_to_fp16(fp16_to_fp32(h)), expected) << std::hex << b;
+    }
+}
+
+TEST(HalfTest, EveryConversionKernelMatchesScalarBits) {
+    const std::vector<float> input = trickyFloats();
+    std::vector<std::uint16_t> expected(input.size());
+    for (std::size_t i = 0; i < input.size(); ++i) expected[i] = fp32_to_fp16(input[i]);
+
+    auto& r = KernelRegistry::instance();
+    const auto to_half = r.candidates("fp32_to_fp16", DataType::FP16);
+    ASSERT_FALSE(to_half.empty());
+    for (const KernelEntry* kernel : to_half) {
+        SCOPED_TRACE(isa_to_string(kernel->isa));
+        // Odd lengths exercise each kernel's tail handling.
+        for (std::size_t count : {input.size(), std::size_t{13}, std::size_t{1}}) {
+            std::vector<std::uint16_t> out(count, 0xDEAD);
+            reinterpret_cast<ConvertFp32ToFp16Fn*>(kernel->fn)(input.data(), out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(out[i], expected[i]) << "input bits " << std::hex << toBits(input[i]);
+            }
+        }
+    }
+
+    std::vector<std::uint16_t> halves(0x10000);
+    for (std::uint32_t b = 0; b <= 0xFFFF; ++b) halves[b] = static_cast<std::uint16_t>(b);
+    for (const KernelEntry* kernel : r.candidates("fp16_to_fp32", DataType::FP16)) {
+        SCOPED_TRACE(isa_to_string(kernel->isa));
+        std::vector<float> out(halves.size() - 3);
+        reinterpret_cast<ConvertFp16ToFp32Fn*>(kernel->fn)(halves.data(), out.data(), out.size());
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            ASSERT_EQ(toBits(out[i]), toBits(fp16_to_fp32(halves[i]))) << std::hex << i;
+        }
+    }
+}
+
+TEST(HalfTest, BufferApiRoundTrips) {
+    std::vector<float> x = {0.1f, -3.25f, 1e-6f, 1234.5f, 0.0f};
+    std::vector<Half> h(x.size());
+    std::vector<float> back(x.size());
+    inference_engine::core::convert_fp32_to_fp16(x.data(), h.data(), x.size());
+    inference_engine::core::convert_fp16_to_fp32(h.data(), back.data(), x.size());
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        EXPECT_EQ(h[i].bits, fp32_to_fp16(x[i]));
+        EXPECT_NEAR(back[i], x[i], std::fabs(x[i]) * 1e-3f + 1e-7f);
+    }
+}
+
+TEST(LinearFp16Test, EveryKernelMatchesFloatKernelOnWidenedWeights) {
+    using LinearFp16Fn = void(const LinearFp16Args&);
+    const std::size_t shapes[][3] = {{1, 1, 1}, {1, 37, 75}, {3, 64, 33}, {13, 70, 100}, {40, 300, 129}, {2, 0, 9}};
+    for (const auto& s : shapes) {
+        const std::size_t m = s[0], k = s[1], n = s[2];
+        std::mt19937 rng(static_cast<unsigned>(m * 31 + k * 7 + n));
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        const std::size_t ldw = n + 5;
+        std::vector<float> x(std::max<std::size_t>(1, m * k));
+        std::vector<std::uint16_t> w(std::max<std::size_t>(1, k * ldw));
+        std::vector<float> w_wide(w.size());
+        std::vector<float> bias(n);
+        for (auto& v : x) v = dist(rng);
+        for (auto& v : bias) v = dist(rng);
+        for (std::size_t i = 0; i < w.size(); ++i) {
+            w[i] = fp32_to_fp16(dist(rng));
+            w_wide[i] = fp16_to_fp32(w[i]);
+        }
+
+        LinearArgs ref;
+        ref.x = x.data();
+        ref.ldx = k;
+        ref.w = w_wide.data();
+        ref.ldw = ldw;
+        ref.bias = bias.data();
+        ref.ldy = n;
+        ref.m = m;
+        ref.k = k;
+        ref.n = n;
+        ref.activation = Activation::ReLU;
+        std::vector<float> expected(m * n);
+        ref.y = expected.data();
+        linear_scalar(ref);
+
+        LinearFp16Args args;
+        args.x = x.data();
+        args.ldx = k;
+        args.w = w.data();
+        args.ldw = ldw;
+        args.bias = bias.data();
+        args.ldy = n;
+        args.m = m;
+        args.k = k;
+        args.n = n;
+        args.activation = Activation::ReLU;
+        const auto kernels = KernelRegistry::instance().candidates("linear", DataType::FP16);
+        ASSERT_FALSE(kernels.empty());
+        for (const KernelEntry* kernel : kernels) {
+            SCOPED_TRACE(isa_to_string(kernel->isa));
+            std::vector<float> actual(m * n, -42.0f);
+            args.y = actual.data();
+            reinterpret_cast<LinearFp16Fn*>(kernel->fn)(args);
+            for (std::size_t i = 0; i < m * n; ++i) {
+                ASSERT_NEAR(actual[i], expected[i], 1e-4f * (1.0f + static_cast<float>(k)))
+                    << "m=" << m << " k=" << k << " n=" << n << " at " << i;
+            }
+        }
+    }
+}
+
+TEST(LinearFp16Test, OpTracksFp32Layer) {
+    const std::int64_t batch = 3, in_dim = 96, out_dim = 80;
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> w(static_cast<std::size_t>(in_dim * out_dim));
+    std::vector<float> b(static_cast<std::size_t>(out_dim));
+    std::vector<float> x(static_cast<std::size_t>(batch * in_dim));
+    for (auto& v : w) v = dist(rng);
+    for (auto& v : b) v = dist(rng);
+    for (auto& v : x) v = dist(rng);
+
+    MatMulBiasOp ref_op(in_dim, out_dim, w, b);
+    auto op = MatMulBiasFp16Op::fromFloat(in_dim, out_dim, w, b);
+    EXPECT_EQ(op->estimateMemoryBytes() * 2, ref_op.estimateMemoryBytes() + b.size() * sizeof(float));
+
+    Tensor xt(Shape({batch, in_dim}), DataType::FP32, static_cast<void*>(x.data()));
+    Value in(Shape({batch, in_dim}), DataType::FP32, "x");
+    in.setTensor(&xt);
+    Value ref_out(Shape({batch, out_dim}), DataType::FP32, "y_ref");
+    Value out(Shape({batch, out_dim}), DataType::FP32, "y");
+    ref_op.setInputs({&in});
+    ref_op.setOutputs({&ref_out});
+    op->setInputs({&in});
+    op->setOutputs({&out});
+    ASSERT_NO_THROW(op->validate());
+    ref_op.execute();
+    op->execute();
+
+    const float* expected = ref_out.tensor()->data_as<float>();
+    const float* actual = out.tensor()->data_as<float>();
+    // FP16 weights carry a relative error of 2^-11 each; sums over in_dim terms of
+    // |x * w| <= 1 stay well inside this bound.
+    for (std::int64_t i = 0; i < batch * out_dim; ++i) {
+        EXPECT_NEAR(actual[i], expected[i], 0.05f) << "at " << i;
+    }
+}
@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/core/dtype.h"
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/kernels/linear_blockq.h"
+#include "inference_engine/kernels/registry.h"
+#include "inference_engine/ops/matmul_bias_blockq.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Half;
+using inference_engine::core::QuantizationParams;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+std::vector<float> randomWeights(std::size_t count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> dist(0.0f, 0.05f);
+    std::vector<float> w(count);
+    for (auto& v : w) v = dist(rng);
+    return w;
+}
+
+// y = act(x * w + bias) in double over the dequantized weights.
+std::vector<float> reference(const std::vector<float>& x, std::size_t ldx, const std::vector<float>& w,
+                             const std::vector<float>& bias, std::size_t m, std::size_t k, std::size_t n,
+                             Activation act) {
+    std::vector<float> y(m * n);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            double acc = bias.empty() ? 0.0 : bias[j];
+            for (std::size_t p = 0; p < k; ++p) acc += static_cast<double>(x[i * ldx + p]) * w[p * n + j];
+            const auto v = static_cast<float>(acc);
+            y[i * n + j] = act == Activation::ReLU ? std::max(0.0f, v) : v;
+        }
+    }
+    return y;
+}
+
+struct Quantized {
+    QuantizationParams qp;
+    std::vector<std::int8_t> q;
+    std::vector<float> dequantized;
+    std::vector<std::uint8_t> packed;
+    std::vector<Half> scales;
+};
+
+Quantized quantize(const std::vector<float>& w, std::size_t k, std::size_t n, int bits, std::size_t group) {
+    const std::vector<std::int64_t> dims = {static_cast<std::int64_t>(k), static_cast<std::int64_t>(n)};
+    Quantized out;
+    out.qp = inference_engine::core::calculate_group_quant_params(w.data(), dims, 0,
+                                                                  static_cast<std::int32_t>(group), bits);
+    out.q.resize(k * n);
+    inference_engine::core::quantize_buffer_grouped(w.data(), out.q.data(), dims, out.qp);
+    out.dequantized.resize(k * n);
+    inference_engine::core::dequantize_buffer_grouped(out.q.data(), out.dequantized.data(), dims, out.qp);
+    out.packed.resize(blockq_weight_bytes(k, n, bits));
+    out.scales.resize(blockq_scale_count(k, n, group));
+    pack_blockq_weights(out.q.data(), out.qp.group_scales.data(), k, n, bits, group, out.packed.data(),
+                        out.scales.data());
+    return out;
+}
+
+// Runs every "linear_blockq" kernel on the full column range and on a window
+// starting at the second panel, against the reference over dequantized weights.
+void expectAllKernelsMatch(std::size_t m, std::size_t k, std::size_t n, int bits, std::size_t group, Activation act,
+                           bool with_bias) {
+    const auto w = randomWeights(k * n, static_cast<unsigned>(m * 31 + k * 7 + n + bits));
+    const Quantized qw = quantize(w, k, n, bits, group);
+    const std::size_t ldx = k + 5;
+    std::vector<float> x(m * ldx);
+    for (std::size_t i = 0; i < x.size(); ++i) x[i] = std::sin(0.37f * static_cast<float>(i));
+    std::vector<float> bias;
+    if (with_bias) {
+        for (std::size_t j = 0; j < n; ++j) bias.push_back(0.01f * static_cast<float>(j % 7) - 0.03f);
+    }
+    const auto expected = reference(x, ldx, qw.dequantized, bias, m, k, n, act);
+
+    const std::size_t ldy = n + 3;
+    const std::size_t panel_bytes = blockq_weight_bytes(k, kBlockQPanel, bits);
+    const auto kernels = KernelRegistry::instance().candidates("linear_blockq", DataType::FP32);
+    ASSERT_FALSE(kernels.empty());
+    for (const KernelEntry* kernel : kernels) {
+        SCOPED_TRACE(isa_to_string(kernel->isa));
+        const std::size_t tail = n > kBlockQPanel ? kBlockQPanel : 0;
+        const std::size_t windows[][2] = {{0, n}, {tail, n - tail}};
+        for (const auto& window : windows) {
+            const std::size_t col0 = window[0];
+            std::vector<float> y(m * ldy, -7.0f);
+            LinearBlockQArgs args;
+            args.x = x.data();
+            args.ldx = ldx;
+            args.w = qw.packed.data() + col0 / kBlockQPanel * panel_bytes;
+            args.scales = reinterpret_cast<const std::uint16_t*>(qw.scales.data()) + col0 * (k / group);
+            args.bits = bits;
+            args.group = group;
+            args.bias = with_bias ? bias.data() + col0 : nullptr;
+            args.y = y.data() + col0;
+            args.ldy = ldy;
+            args.m = m;
+            args.k = k;
+            args.n = window[1];
+            args.activation = act;
+            reinterpret_cast<LinearBlockQFn*>(kernel->fn)(args);
+
+            for (std::size_t i = 0; i < m; ++i) {
+                for (std::size_t j = col0; j < col0 + window[1]; ++j) {
+                    ASSERT_NEAR(y[i * ldy + j], expected[i * n + j], 1e-4f)
+                        << "bits=" << bits << " group=" << group << " m=" << m << " n=" << n << " at (" << i
+                        << ", " << j << ")";
+                }
+                for (std::size_t j = col0 + window[1]; j < ldy; ++j) {
+                    ASSERT_EQ(y[i * ldy + j], -7.0f) << "wrote past the column window";
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(LinearBlockQTest, GroupedQuantizationRoundTrips) {
+    const std::size_t k = 96, n = 5;
+    const auto w = randomWeights(k * n, 3);
+    for (int bits : {4, 8}) {
+        const Quantized qw = quantize(w, k, n, bits, 32);
+        EXPECT_TRUE(qw.qp.is_grouped());
+        ASSERT_EQ(qw.qp.group_scales.size(), 3 * n);
+        const int qmax = (1 << (bits - 1)) - 1;
+        for (std::size_t i = 0; i < w.size(); ++i) {
+            ASSERT_LE(std::abs(qw.q[i]), qmax);
+            // Half a quantization step of the element's group, plus FP16 scale rounding.
+            const float step = qw.qp.group_scales[i / n / 32 * n + i % n].to_float();
+            ASSERT_LE(std::abs(qw.dequantized[i] - w[i]), 0.5f * step * 1.001f + 1e-7f) << "bits=" << bits;
+        }
+    }
+}
+
+TEST(LinearBlockQTest, GroupedQuantizationRejectsBadParameters) {
+    const std::vector<float> w(64, 1.0f);
+    const std::vector<std::int64_t> dims = {16, 4};
+    EXPECT_THROW((void)inference_engine::core::calculate_group_quant_params(w.data(), dims, 0, 32, 3),
+                 std::invalid_argument);
+    EXPECT_THROW((void)inference_engine::core::calculate_group_quant_params(w.data(), dims, 0, 0, 4),
+                 std::invalid_argument);
+    EXPECT_THROW((void)inference_engine::core::calculate_group_quant_params(w.data(), dims, 2, 32, 4),
+                 std::invalid_argument);
+    QuantizationParams qp = inference_engine::core::calculate_group_quant_params(w.data(), dims, 0, 8, 4);
+    qp.group_scales.pop_back();
+    std::vector<std::int8_t> q(64);
+    EXPECT_THROW(inference_engine::core::quantize_buffer_grouped(w.data(), q.data(), dims, qp),
+                 std::invalid_argument);
+}
+
+TEST(LinearBlockQTest, PackedLayout) {
+    // k = 2, n = 17: two panels; column 16 is the first of the second panel.
+    std::vector<std::int8_t> q(2 * 17);
+    for (std::size_t i = 0; i < q.size(); ++i) q[i] = static_cast<std::int8_t>(static_cast<int>(i % 15) - 7);
+    std::vector<Half> scales(17, Half(0.5f));
+    std::vector<std::uint8_t> packed(blockq_weight_bytes(2, 17, 4));
+    std::vector<Half> packed_scales(blockq_scale_count(2, 17, 2));
+    ASSERT_EQ(packed.size(), 2u * 2u * 8u);
+    ASSERT_EQ(packed_scales.size(), 2u * 16u);
+    pack_blockq_weights(q.data(), scales.data(), 2, 17, 4, 2, packed.data(), packed_scales.data());
+    // Row 1 of panel 0: column 3 in the low nibble of byte 3, column 11 in its high nibble.
+    EXPECT_EQ(packed[8 + 3] & 0x0F, q[17 + 3] + 8);
+    EXPECT_EQ(packed[8 + 3] >> 4, q[17 + 11] + 8);
+    // Panel 1 holds column 16 and zero padding.
+    EXPECT_EQ(packed[16] & 0x0F, q[16] + 8);
+    EXPECT_EQ(packed[16] >> 4, 8);
+    EXPECT_EQ(packed[17], 0x88);
+    EXPECT_TRUE(packed_scales[16].same_bits(Half(0.5f)));
+    EXPECT_EQ(packed_scales[17].bits, 0);
+
+    const std::vector<std::int8_t> too_big = {8, 0};
+    EXPECT_THROW(pack_blockq_weights(too_big.data(), scales.data(), 1, 2, 4, 1, packed.data(), packed_scales.data()),
+                 std::invalid_argument);
+    EXPECT_THROW(pack_blockq_weights(q.data(), scales.data(), 2, 17, 4, 3, packed.data(), packed_scales.data()),
+                 std::invalid_argument);
+}
+
+TEST(LinearBlockQTest, EveryKernelMatchesDequantizedReference) {
+    const std::size_t shapes[][3] = {{1, 64, 16}, {1, 128, 37}, {3, 64, 5}, {4, 192, 48}, {9, 128, 33}};
+    for (int bits : {4, 8}) {
+        for (std::size_t group : {std::size_t{32}, std::size_t{64}}) {
+            for (const auto& s : shapes) {
+                if (s[1] % group != 0) continue;
+                expectAllKernelsMatch(s[0], s[1], s[2], bits, group, Activation::None, true);
+            }
+        }
+    }
+    expectAllKernelsMatch(6, 64, 40, 4, 32, Activation::ReLU, false);
+    expectAllKernelsMatch(6, 64, 40, 8, 64, Activation::ReLU, true);
+}
+
+TEST(LinearBlockQTest, OperatorTracksFloatLayer) {
+    const std::int64_t in_dim = 256, out_dim = 40, batch = 3;
+    const auto w = randomWeights(static_cast<std::size_t>(in_dim * out_dim), 11);
+    std::vector<float> bias(static_cast<std::size_t>(out_dim), 0.1f);
+    std::vector<float> x(static_cast<std::size_t>(batch * in_dim));
+    for (std::size_t i = 0; i < x.size(); ++i) x[i] = std::cos(0.11f * static_cast<float>(i));
+    const auto exact = reference(x, static_cast<std::size_t>(in_dim), w, bias, static_cast<std::size_t>(batch),
+                                 static_cast<std::size_t>(in_dim), static_cast<std::size_t>(out_dim),
+                                 Activation::None);
+
+    for (int bits : {4, 8}) {
+        auto op = MatMulBiasBlockQOp::fromFloat(in_dim, out_dim, w, bias, bits, 32);
+        EXPECT_EQ(op->estimateMemoryBytes(), static_cast<std::size_t>(in_dim * 48 * bits / 8) +
+                                                 static_cast<std::size_t>(in_dim / 32 * 48) * sizeof(Half) +
+                                                 bias.size() * sizeof(float));
+        const QuantizationParams qp = op->weightQuantization();
+        EXPECT_EQ(qp.group_size, 32);
+        EXPECT_EQ(qp.bits, bits);
+        ASSERT_EQ(qp.group_scales.size(), static_cast<std::size_t>(in_dim / 32 * out_dim));
+
+        Value in(Shape({batch, in_dim}), DataType::FP32, "x");
+        Value out(Shape({batch, out_dim}), DataType::FP32, "y");
+        Tensor xt(Shape({batch, in_dim}), DataType::FP32, x.data(), false);
+        in.setTensor(&xt);
+        op->setInputs({&in});
+        op->setOutputs({&out});
+        op->validate();
+        op->execute();
+        const float* y = out.tensor()->data_as<float>();
+        // Weight error is at most half a step per element; INT4 steps are ~18x coarser.
+        const float tolerance = bits == 4 ? 0.25f : 0.02f;
+        double err = 0.0;
+        for (std::size_t i = 0; i < exact.size(); ++i) {
+            ASSERT_NEAR(y[i], exact[i], tolerance) << "bits=" << bits << " at " << i;
+            err += std::abs(y[i] - exact[i]);
+        }
+        EXPECT_GT(err, 0.0);
+    }
+}
+
+TEST(LinearBlockQTest, OperatorRejectsMismatchedBuffers) {
+    std::vector<std::uint8_t> packed(blockq_weight_bytes(64, 16, 4));
+    std::vector<Half> scales(blockq_scale_count(64, 16, 32));
+    std::vector<float> bias(16);
+    EXPECT_NO_THROW(MatMulBiasBlockQOp(64, 16, 4, 32, packed, scales, bias));
+    EXPECT_THROW(MatMulBiasBlockQOp(64, 16, 8, 32, packed, scales, bias), std::invalid_argument);
+    EXPECT_THROW(MatMulBiasBlockQOp(64, 16, 4, 48, packed, scales, bias), std::invalid_argument);
+    EXPECT_THROW(MatMulBiasBlockQOp(64, 16, 4, 64, packed, scales, bias), std::invalid_argument);
+}
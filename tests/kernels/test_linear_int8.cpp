@@ -0,0 +1,317 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/kernels/linear_int8.h"
+#include "inference_engine/kernels/registry.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/quantized_linear.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::QuantizationParams;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+// Direct evaluation of the contract in linear_int8.h on unpacked weights.
+std::vector<float> reference(const std::vector<std::uint8_t>& x, std::size_t ldx, DataType x_dtype, std::int32_t x_zp,
+                             const std::vector<std::int8_t>& w, std::size_t k, std::size_t n,
+                             const std::vector<std::int32_t>& bias, const std::vector<float>& scales, DataType y_dtype,
+                             std::int32_t y_zp, Activation act, std::size_t m) {
+    std::vector<float> y(m * n);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            std::int32_t acc = bias.empty() ? 0 : bias[j];
+            for (std::size_t p = 0; p < k; ++p) {
+                const std::uint8_t b = x[i * ldx + p];
+                const std::int32_t xv = x_dtype == DataType::UINT8 ? b : static_cast<std::int8_t>(b);
+                acc += (xv - x_zp) * w[p * n + j];
+            }
+            float v = static_cast<float>(acc) * scales[j];
+            if (y_dtype == DataType::FP32) {
+                y[i * n + j] = act == Activation::ReLU ? std::max(0.0f, v) : v;
+                continue;
+            }
+            const float qmin = y_dtype == DataType::UINT8 ? 0.0f : -128.0f;
+            const float qmax = y_dtype == DataType::UINT8 ? 255.0f : 127.0f;
+            const float lo = act == Activation::ReLU ? std::max(qmin, static_cast<float>(y_zp)) : qmin;
+            v = std::nearbyint(v) + static_cast<float>(y_zp);
+            y[i * n + j] = std::min(qmax, std::max(lo, v));
+        }
+    }
+    return y;
+}
+
+float readOutput(const std::vector<std::uint8_t>& y, DataType dtype, std::size_t index) {
+    switch (dtype) {
+    case DataType::UINT8: return y[index];
+    case DataType::INT8: return static_cast<std::int8_t>(y[index]);
+    default: {
+        float f;
+        std::memcpy(&f, y.data() + index * sizeof(float), sizeof(float));
+        return f;
+    }
+    }
+}
+
+// Runs every INT8 "linear" kernel the host supports on the full column range and
+// on a 16-aligned column window, and requires results identical to the reference.
+void expectAllKernelsExact(std::size_t m, std::size_t k, std::size_t n, DataType x_dtype, DataType y_dtype,
+                           Activation act, bool with_bias) {
+    std::mt19937 rng(static_cast<unsigned>(m * 7919 + k * 131 + n));
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::uniform_int_distribution<int> weight(-127, 127);
+    std::uniform_real_distribution<float> scale(0.0005f, 0.002f);
+
+    const std::size_t ldx = k + 3;
+    std::vector<std::uint8_t> x(std::max<std::size_t>(1, m * ldx));
+    for (auto& v : x) v = static_cast<std::uint8_t>(byte(rng));
+    std::vector<std::int8_t> w(k * n);
+    for (auto& v : w) v = static_cast<std::int8_t>(weight(rng));
+    std::vector<std::int32_t> bias;
+    if (with_bias) {
+        std::uniform_int_distribution<int> b(-20000, 20000);
+        for (std::size_t j = 0; j < n; ++j) bias.push_back(b(rng));
+    }
+    std::vector<float> scales(n);
+    for (auto& s : scales) s = scale(rng);
+    const std::int32_t x_zp = x_dtype == DataType::UINT8 ? 121 : -7;
+    const std::int32_t y_zp = y_dtype == DataType::UINT8 ? 130 : (y_dtype == DataType::INT8 ? 5 : 0);
+    const auto expected = reference(x, ldx, x_dtype, x_zp, w, k, n, bias, scales, y_dtype, y_zp, act, m);
+
+    const PackedInt8Weights packed = pack_int8_weights(w.data(), k, n);
+    const std::size_t y_elem = inference_engine::core::bytes_per_element(y_dtype);
+    const std::size_t ldy = n + 2;
+
+    const auto kernels = KernelRegistry::instance().candidates("linear", DataType::INT8);
+    ASSERT_FALSE(kernels.empty());
+    for (const KernelEntry* kernel : kernels) {
+        SCOPED_TRACE(isa_to_string(kernel->isa));
+        const std::size_t tail = n > 16 ? 16 : 0;
+        const std::size_t windows[][2] = {{0, n}, {tail, n - tail}};
+        for (const auto& window : windows) {
+            const std::size_t col0 = window[0];
+            std::vector<std::uint8_t> y(std::max<std::size_t>(1, m * ldy) * y_elem, 0xAB);
+            LinearInt8Args args;
+            args.x = x.data();
+            args.ldx = ldx;
+            args.x_dtype = x_dtype;
+            args.x_zero_point = x_zp;
+            args.w = &packed;
+            args.col_begin = col0;
+            args.bias = with_bias ? bias.data() + col0 : nullptr;
+            args.scales = scales.data() + col0;
+            args.y = y.data() + col0 * y_elem;
+            args.ldy = ldy;
+            args.y_dtype = y_dtype;
+            args.y_zero_point = y_zp;
+            args.m = m;
+            args.n = window[1];
+            args.activation = act;
+            reinterpret_cast<LinearInt8Fn*>(kernel->fn)(args);
+
+            for (std::size_t i = 0; i < m; ++i) {
+                for (std::size_t j = col0; j < col0 + window[1]; ++j) {
+                    ASSERT_EQ(readOutput(y, y_dtype, i * ldy + j), expected[i * n + j])
+                        << "m=" << m << " k=" << k << " n=" << n << " at (" << i << ", " << j << ")";
+                }
+                for (std::size_t j = col0 + window[1]; j < ldy; ++j) {
+                    ASSERT_EQ(y[(i * ldy + j) * y_elem], 0xAB) << "wrote past the column window";
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(LinearInt8Test, PackRejectsMinus128) {
+    const std::vector<std::int8_t> w = {1, -128, 3, 4};
+    EXPECT_THROW((void)pack_int8_weights(w.data(), 2, 2), std::invalid_argument);
+}
+
+TEST(LinearInt8Test, PackedLayoutAndColumnSums) {
+    // k = 5, n = 3: one panel, two k-groups.
+    std::vector<std::int8_t> w(15);
+    for (std::size_t i = 0; i < w.size(); ++i) w[i] = static_cast<std::int8_t>(i + 1);
+    const PackedInt8Weights p = pack_int8_weights(w.data(), 5, 3);
+    EXPECT_EQ(p.k_groups, 2u);
+    EXPECT_EQ(p.panels, 1u);
+    // Column 1, k = 0..3 in group 0; k = 4 in group 1 followed by padding.
+    const std::int8_t* g0 = p.panel(0) + 1 * 4;
+    EXPECT_EQ(g0[0], w[0 * 3 + 1]);
+    EXPECT_EQ(g0[3], w[3 * 3 + 1]);
+    const std::int8_t* g1 = p.panel(0) + (16 + 1) * 4;
+    EXPECT_EQ(g1[0], w[4 * 3 + 1]);
+    EXPECT_EQ(g1[1], 0);
+    EXPECT_EQ(p.col_sums[0], 1 + 4 + 7 + 10 + 13);
+    EXPECT_EQ(p.col_sums[3], 0);
+}
+
+TEST(LinearInt8Test, EveryKernelIsExactOnEdgeShapes) {
+    const std::size_t shapes[][3] = {{1, 1, 1}, {1, 7, 5}, {3, 4, 16}, {4, 33, 17}, {9, 64, 48}, {13, 130, 40}, {2, 0, 3}};
+    for (const auto& s : shapes) {
+        expectAllKernelsExact(s[0], s[1], s[2], DataType::UINT8, DataType::UINT8, Activation::None, true);
+    }
+}
+
+TEST(LinearInt8Test, EveryKernelIsExactForAllTypeCombinations) {
+    for (DataType x_dtype : {DataType::UINT8, DataType::INT8}) {
+        for (DataType y_dtype : {DataType::UINT8, DataType::INT8, DataType::FP32}) {
+            for (Activation act : {Activation::None, Activation::ReLU}) {
+                expectAllKernelsExact(11, 37, 35, x_dtype, y_dtype, act, act == Activation::None);
+            }
+        }
+    }
+}
+
+TEST(LinearInt8Test, SaturatingInputsDoNotOverflow) {
+    // Extreme activations against extreme weights: the AVX2 pair sums sit at the
+    // s16 limit, so any saturation would show up here.
+    const std::size_t m = 5, k = 64, n = 32;
+    std::vector<std::uint8_t> x(m * k, 0x80); // -128 as INT8
+    std::vector<std::int8_t> w(k * n, -127);
+    const PackedInt8Weights packed = pack_int8_weights(w.data(), k, n);
+    const std::vector<float> scales(n, 1.0f);
+    std::vector<float> y(m * n);
+    LinearInt8Args args;
+    args.x = x.data();
+    args.ldx = k;
+    args.x_dtype = DataType::INT8;
+    args.w = &packed;
+    args.scales = scales.data();
+    args.y = y.data();
+    args.ldy = n;
+    args.y_dtype = DataType::FP32;
+    args.m = m;
+    args.n = n;
+    for (const KernelEntry* kernel : KernelRegistry::instance().candidates("linear", DataType::INT8)) {
+        SCOPED_TRACE(isa_to_string(kernel->isa));
+        std::fill(y.begin(), y.end(), 0.0f);
+        reinterpret_cast<LinearInt8Fn*>(kernel->fn)(args);
+        for (float v : y) ASSERT_EQ(v, 128.0f * 127.0f * k);
+    }
+}
+
+TEST(LinearInt8Test, DispatcherValidatesArguments) {
+    const std::vector<std::int8_t> w(4 * 32, 1);
+    const PackedInt8Weights packed = pack_int8_weights(w.data(), 4, 32);
+    const std::vector<float> scales(32, 1.0f);
+    std::vector<std::uint8_t> x(4, 1);
+    std::vector<float> y(32);
+    LinearInt8Args args;
+    args.x = x.data();
+    args.ldx = 4;
+    args.w = &packed;
+    args.scales = scales.data();
+    args.y = y.data();
+    args.ldy = 32;
+    args.y_dtype = DataType::FP32;
+    args.m = 1;
+    args.n = 32;
+    EXPECT_NO_THROW(linear_int8(args));
+    EXPECT_EQ(y[0], 4.0f);
+
+    LinearInt8Args bad = args;
+    bad.col_begin = 8;
+    bad.n = 8;
+    EXPECT_THROW(linear_int8(bad), std::invalid_argument);
+    bad = args;
+    bad.x_dtype = DataType::FP32;
+    EXPECT_THROW(linear_int8(bad), std::invalid_argument);
+    bad = args;
+    bad.scales = nullptr;
+    EXPECT_THROW(linear_int8(bad), std::invalid_argument);
+}
+
+TEST(QuantizedLinearOpTest, TracksFloatLayerWithinQuantizationError) {
+    const std::int64_t batch = 6, in_dim = 48, out_dim = 40;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> w(static_cast<std::size_t>(in_dim * out_dim));
+    std::vector<float> b(static_cast<std::size_t>(out_dim));
+    std::vector<float> xf(static_cast<std::size_t>(batch * in_dim));
+    for (auto& v : w) v = dist(rng);
+    for (auto& v : b) v = dist(rng);
+    for (auto& v : xf) v = dist(rng);
+
+    // Float reference through MatMulBiasOp.
+    MatMulBiasOp ref_op(in_dim, out_dim, w, b, Activation::ReLU);
+    Value ref_in(Shape({batch, in_dim}), DataType::FP32, "x");
+    Value ref_out(Shape({batch, out_dim}), DataType::FP32, "y");
+    Tensor ref_x(Shape({batch, in_dim}), DataType::FP32, static_cast<void*>(xf.data()));
+    ref_in.setTensor(&ref_x);
+    ref_op.setInputs({&ref_in});
+    ref_op.setOutputs({&ref_out});
+    ref_op.execute();
+    const float* ref = ref_out.tensor()->data_as<float>();
+    float ref_max = 0.0f;
+    for (std::int64_t i = 0; i < batch * out_dim; ++i) ref_max = std::max(ref_max, ref[i]);
+
+    QuantizationParams x_qp;
+    x_qp.scale = 2.0f / 255.0f;
+    x_qp.zero_point = 128;
+    QuantizationParams y_qp;
+    y_qp.scale = ref_max / 255.0f;
+    y_qp.zero_point = 0;
+    std::vector<std::uint8_t> xq(xf.size());
+    inference_engine::core::quantize_buffer_asymmetric_uint8(xf.data(), xq.data(), xf.size(), x_qp.scale,
+                                                             x_qp.zero_point);
+
+    auto op = QuantizedLinearOp::fromFloat(in_dim, out_dim, w, b, Activation::ReLU);
+    Value in(Shape({batch, in_dim}), DataType::UINT8, x_qp, "xq");
+    Value out(Shape({batch, out_dim}), DataType::UINT8, y_qp, "yq");
+    Tensor x_tensor(Shape({batch, in_dim}), DataType::UINT8, static_cast<void*>(xq.data()));
+    in.setTensor(&x_tensor);
+    op->setInputs({&in});
+    op->setOutputs({&out});
+    ASSERT_NO_THROW(op->validate());
+    op->execute();
+
+    const Tensor* yt = out.tensor();
+    ASSERT_NE(yt, nullptr);
+    EXPECT_EQ(yt->dtype(), DataType::UINT8);
+    EXPECT_FLOAT_EQ(yt->quant_params().scale, y_qp.scale);
+    const auto* yq = static_cast<const std::uint8_t*>(yt->data());
+    // Input rounding (x_scale / 2 per element) and per-channel weight rounding
+    // accumulate over in_dim terms; allow a few output steps.
+    for (std::int64_t i = 0; i < batch * out_dim; ++i) {
+        const float got = (static_cast<float>(yq[i]) - y_qp.zero_point) * y_qp.scale;
+        EXPECT_NEAR(got, ref[i], 4.0f * y_qp.scale) << "at " << i;
+    }
+
+    // FP32 output from the same layer dequantizes in the epilogue.
+    Value out_f(Shape({batch, out_dim}), DataType::FP32, "yf");
+    op->setOutputs({&out_f});
+    op->execute();
+    const float* yf = out_f.tensor()->data_as<float>();
+    for (std::int64_t i = 0; i < batch * out_dim; ++i) {
+        EXPECT_NEAR(yf[i], ref[i], 3.0f * y_qp.scale) << "at " << i;
+    }
+}
+
+TEST(QuantizedLinearOpTest, RejectsAsymmetricWeightsAndUnquantizedValues) {
+    std::vector<std::int8_t> w(8, 1);
+    QuantizationParams qp;
+    qp.scale = 0.1f;
+    qp.zero_point = 3;
+    EXPECT_THROW(QuantizedLinearOp(2, 4, w, qp, std::vector<float>(4), Activation::None), std::invalid_argument);
+
+    qp.zero_point = 0;
+    QuantizedLinearOp op(2, 4, w, qp, std::vector<float>(4), Activation::None);
+    Value in(Shape({1, 2}), DataType::FP32, "x");
+    Value out(Shape({1, 4}), DataType::FP32, "y");
+    op.setInputs({&in});
+    op.setOutputs({&out});
+    EXPECT_THROW(op.validate(), std::invalid_argument);
+}
@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/core/dtype.h"
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/kernels/linear_sparse.h"
+#include "inference_engine/kernels/registry.h"
+#include "inference_engine/ops/matmul_bias_sparse.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+const SparsePattern kPatterns[] = {SparsePattern::nm(2, 4),       SparsePattern::nm(1, 4),
+                                   SparsePattern::nm(3, 8),       SparsePattern::nm(1, 8),
+                                   SparsePattern::blockCsr(8, 1), SparsePattern::blockCsr(4, 4)};
+
+// Random w[k, n] pruned to fit `p`: N:M runs keep up to n weights (sometimes fewer),
+// block CSR keeps about a third of the blocks.
+std::vector<float> prunedWeights(std::size_t k, std::size_t n, const SparsePattern& p, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> dist(0.0f, 0.05f);
+    std::vector<float> w(k * n, 0.0f);
+    if (p.format == SparseFormat::NM) {
+        std::vector<std::size_t> rows(p.m);
+        for (std::size_t p0 = 0; p0 < k; p0 += p.m) {
+            for (std::size_t j = 0; j < n; ++j) {
+                for (std::size_t i = 0; i < p.m; ++i) rows[i] = i;
+                std::shuffle(rows.begin(), rows.end(), rng);
+                const std::size_t kept = p.n - (rng() % 3 == 0 ? 1 : 0);
+                for (std::size_t t = 0; t < kept; ++t) w[(p0 + rows[t]) * n + j] = dist(rng);
+            }
+        }
+        return w;
+    }
+    for (std::size_t b = 0; b * p.block_out < n; ++b) {
+        for (std::size_t ib = 0; ib < k / p.block_in; ++ib) {
+            if (rng() % 3 != 0) continue;
+            for (std::size_t q = 0; q < p.block_in; ++q) {
+                for (std::size_t o = 0; o < p.block_out && b * p.block_out + o < n; ++o) {
+                    w[(ib * p.block_in + q) * n + b * p.block_out + o] = dist(rng);
+                }
+            }
+        }
+    }
+    return w;
+}
+
+// y = act(x * w + bias) in double.
+std::vector<float> reference(const std::vector<float>& x, std::size_t ldx, const std::vector<float>& w,
+                             const std::vector<float>& bias, std::size_t m, std::size_t k, std::size_t n,
+                             Activation act) {
+    std::vector<float> y(m * n);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            double acc = bias.empty() ? 0.0 : bias[j];
+            for (std::size_t p = 0; p < k; ++p) acc += static_cast<double>(x[i * ldx + p]) * w[p * n + j];
+            const auto v = static_cast<float>(acc);
+            y[i * n + j] = act == Activation::ReLU ? std::max(0.0f, v) : v;
+        }
+    }
+    return y;
+}
+
+// Runs every "linear_sparse" kernel on the full column range and on a window starting
+// at the second panel, against the dense reference.
+void expectAllKernelsMatch(std::size_t m, std::size_t k, std::size_t n, const SparsePattern& p, Activation act,
+                           bool with_bias) {
+    SCOPED_TRACE(sparse_pattern_name(p) + " m=" + std::to_string(m) + " k=" + std::to_string(k) +
+                 " n=" + std::to_string(n));
+    const auto w = prunedWeights(k, n, p, static_cast<unsigned>(m * 31 + k * 7 + n));
+    const SparseWeights packed = pack_sparse_weights(w.data(), k, n, p);
+    const std::size_t ldx = k + 5;
+    std::vector<float> x(m * ldx);
+    for (std::size_t i = 0; i < x.size(); ++i) x[i] = std::sin(0.37f * static_cast<float>(i));
+    std::vector<float> bias;
+    if (with_bias) {
+        for (std::size_t j = 0; j < n; ++j) bias.push_back(0.01f * static_cast<float>(j % 7) - 0.03f);
+    }
+    const auto expected = reference(x, ldx, w, bias, m, k, n, act);
+
+    const std::size_t ldy = n + 3;
+    const std::size_t panel_values = sparse_nm_value_count(k, kSparsePanel, p);
+    const auto kernels = KernelRegistry::instance().candidates("linear_sparse", DataType::FP32);
+    ASSERT_FALSE(kernels.empty());
+    for (const KernelEntry* kernel : kernels) {
+        SCOPED_TRACE(isa_to_string(kernel->isa));
+        const std::size_t tail = n > kSparsePanel ? kSparsePanel : 0;
+        const std::size_t windows[][2] = {{0, n}, {tail, n - tail}};
+        for (const auto& window : windows) {
+            const std::size_t col0 = window[0];
+            std::vector<float> y(m * ldy, -7.0f);
+            LinearSparseArgs args;
+            args.x = x.data();
+            args.ldx = ldx;
+            args.pattern = p;
+            if (p.format == SparseFormat::NM) {
+                args.values = packed.values.data() + col0 / kSparsePanel * panel_values;
+                args.indices = packed.indices.data() + col0 / kSparsePanel * panel_values;
+            } else {
+                args.values = packed.values.data();
+                args.row_ptr = packed.row_ptr.data() + col0 / p.block_out;
+                args.col_idx = packed.col_idx.data();
+            }
+            args.bias = with_bias ? bias.data() + col0 : nullptr;
+            args.y = y.data() + col0;
+            args.ldy = ldy;
+            args.m = m;
+            args.k = k;
+            args.n = window[1];
+            args.activation = act;
+            reinterpret_cast<LinearSparseFn*>(kernel->fn)(args);
+
+            for (std::size_t i = 0; i < m; ++i) {
+                for (std::size_t j = col0; j < col0 + window[1]; ++j) {
+                    ASSERT_NEAR(y[i * ldy + j], expected[i * n + j], 1e-4f) << "at (" << i << ", " << j << ")";
+                }
+                for (std::size_t j = col0 + window[1]; j < ldy; ++j) {
+                    ASSERT_EQ(y[i * ldy + j], -7.0f) << "wrote past the column window";
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(LinearSparseTest, PackedLayoutRoundTrips) {
+    constexpr std::size_t k = 32, n = 21;
+    for (const SparsePattern& p : kPatterns) {
+        SCOPED_TRACE(sparse_pattern_name(p));
+        const auto w = prunedWeights(k, n, p, 3);
+        ASSERT_TRUE(fits_sparse_pattern(w.data(), k, n, p));
+        const SparseWeights packed = pack_sparse_weights(w.data(), k, n, p);
+        EXPECT_EQ(unpack_sparse_weights(p, k, n, packed.values.data(), packed.indices.data(), packed.row_ptr.data(),
+                                        packed.col_idx.data()),
+                  w);
+        if (p.format == SparseFormat::NM) {
+            EXPECT_EQ(packed.values.size(), 2 * (k / p.m) * p.n * kSparsePanel);
+            EXPECT_EQ(sparse_stored_weights(w.data(), k, n, p), k / p.m * p.n * n);
+            EXPECT_TRUE(packed.row_ptr.empty());
+        } else {
+            ASSERT_EQ(packed.row_ptr.size(), sparse_block_rows(n, p) + 1);
+            EXPECT_EQ(packed.row_ptr.back(), packed.col_idx.size());
+            EXPECT_EQ(packed.values.size(), packed.col_idx.size() * p.block_out * p.block_in);
+            EXPECT_EQ(sparse_stored_weights(w.data(), k, n, p), packed.values.size());
+            EXPECT_LT(packed.col_idx.size(), sparse_block_rows(n, p) * (k / p.block_in));
+        }
+    }
+
+    // The first panel of 2:4: column 1 keeps rows 1 and 3 of the first run.
+    std::vector<float> w(8 * 2, 0.0f);
+    w[1 * 2 + 1] = 0.5f;
+    w[3 * 2 + 1] = -0.25f;
+    const SparseWeights nm = pack_sparse_weights(w.data(), 8, 2, SparsePattern::nm(2, 4));
+    EXPECT_EQ(nm.values[1], 0.5f);
+    EXPECT_EQ(nm.indices[1], 1);
+    EXPECT_EQ(nm.values[kSparsePanel + 1], -0.25f);
+    EXPECT_EQ(nm.indices[kSparsePanel + 1], 3);
+    EXPECT_EQ(nm.values[2 * kSparsePanel + 1], 0.0f);
+}
+
+TEST(LinearSparseTest, RejectsWeightsOutsideThePattern) {
+    std::vector<float> w(8 * 4, 0.0f);
+    w[0 * 4 + 2] = 1.0f;
+    w[1 * 4 + 2] = 1.0f;
+    w[2 * 4 + 2] = 1.0f;
+    EXPECT_FALSE(fits_sparse_pattern(w.data(), 8, 4, SparsePattern::nm(2, 4)));
+    EXPECT_TRUE(fits_sparse_pattern(w.data(), 8, 4, SparsePattern::nm(3, 4)));
+    EXPECT_THROW((void)pack_sparse_weights(w.data(), 8, 4, SparsePattern::nm(2, 4)), std::invalid_argument);
+
+    EXPECT_FALSE(sparse_pattern_supported(SparsePattern::nm(4, 4), 8));
+    EXPECT_FALSE(sparse_pattern_supported(SparsePattern::nm(2, 6), 12));
+    EXPECT_FALSE(sparse_pattern_supported(SparsePattern::nm(2, 4), 10));
+    EXPECT_FALSE(sparse_pattern_supported(SparsePattern::blockCsr(2, 2), 8));
+    EXPECT_FALSE(sparse_pattern_supported(SparsePattern::blockCsr(4, 4), 6));
+    EXPECT_TRUE(sparse_pattern_supported(SparsePattern::blockCsr(8, 1), 7));
+    EXPECT_THROW((void)pack_sparse_weights(w.data(), 8, 4, SparsePattern::blockCsr(2, 2)), std::invalid_argument);
+}
+
+TEST(LinearSparseTest, EveryKernelMatchesDenseReference) {
+    const std::size_t shapes[][3] = {{1, 64, 16}, {1, 128, 37}, {3, 32, 5}, {4, 96, 48}, {9, 64, 33}};
+    for (const SparsePattern& p : kPatterns) {
+        for (const auto& s : shapes) expectAllKernelsMatch(s[0], s[1], s[2], p, Activation::None, true);
+        expectAllKernelsMatch(6, 64, 40, p, Activation::ReLU, false);
+    }
+    // 8x1 blocks need no particular in_dim.
+    expectAllKernelsMatch(5, 13, 19, SparsePattern::blockCsr(8, 1), Activation::ReLU, true);
+}
+
+TEST(LinearSparseTest, OperatorMatchesDenseLayer) {
+    const std::int64_t in_dim = 128, out_dim = 40, batch = 3;
+    std::vector<float> bias(static_cast<std::size_t>(out_dim), 0.1f);
+    std::vector<float> x(static_cast<std::size_t>(batch * in_dim));
+    for (std::size_t i = 0; i < x.size(); ++i) x[i] = std::cos(0.11f * static_cast<float>(i));
+
+    for (const SparsePattern& p : kPatterns) {
+        SCOPED_TRACE(sparse_pattern_name(p));
+        const auto w = prunedWeights(static_cast<std::size_t>(in_dim), static_cast<std::size_t>(out_dim), p, 11);
+        const auto expected = reference(x, static_cast<std::size_t>(in_dim), w, bias, static_cast<std::size_t>(batch),
+                                        static_cast<std::size_t>(in_dim), static_cast<std::size_t>(out_dim),
+                                        Activation::ReLU);
+        auto op = MatMulBiasSparseOp::fromFloat(in_dim, out_dim, w.data(), bias, p, Activation::ReLU);
+        EXPECT_EQ(op->rowMajorWeights(), w);
+        const std::size_t stored = op->storedWeights();
+        EXPECT_EQ(stored, sparse_stored_weights(w.data(), static_cast<std::size_t>(in_dim),
+                                                static_cast<std::size_t>(out_dim), p));
+
+        Value in(Shape({batch, in_dim}), DataType::FP32, "x");
+        Value out(Shape({batch, out_dim}), DataType::FP32, "y");
+        Tensor xt(Shape({batch, in_dim}), DataType::FP32, x.data(), false);
+        in.setTensor(&xt);
+        op->setInputs({&in});
+        op->setOutputs({&out});
+        op->validate();
+        EXPECT_EQ(op->estimateFlops(), static_cast<std::uint64_t>(batch) * (2 * stored + out_dim));
+        op->execute();
+        const float* y = out.tensor()->data_as<float>();
+        for (std::size_t i = 0; i < expected.size(); ++i) ASSERT_NEAR(y[i], expected[i], 1e-4f) << i;
+    }
+}
+
+TEST(LinearSparseTest, OperatorRejectsCorruptBuffers) {
+    const std::vector<float> w = prunedWeights(16, 8, SparsePattern::blockCsr(8, 1), 5);
+    const SparseWeights bsr = pack_sparse_weights(w.data(), 16, 8, SparsePattern::blockCsr(8, 1));
+    ASSERT_FALSE(bsr.col_idx.empty());
+    const std::vector<float> bias(8);
+    auto make = [&](std::vector<std::uint32_t> row_ptr, std::vector<std::uint32_t> col_idx) {
+        return MatMulBiasSparseOp(16, 8, SparsePattern::blockCsr(8, 1), bsr.values, {}, std::move(row_ptr),
+                                  std::move(col_idx), bias);
+    };
+    EXPECT_NO_THROW(make(bsr.row_ptr, bsr.col_idx));
+    std::vector<std::uint32_t> bad_col = bsr.col_idx;
+    bad_col[0] = 16;
+    EXPECT_THROW(make(bsr.row_ptr, bad_col), std::invalid_argument);
+    EXPECT_THROW(make({0, 0}, bsr.col_idx), std::invalid_argument);
+
+    const SparseWeights nm = pack_sparse_weights(prunedWeights(16, 8, SparsePattern::nm(2, 4), 5).data(), 16, 8,
+                                                 SparsePattern::nm(2, 4));
+    std::vector<std::uint8_t> bad_index = nm.indices;
+    bad_index[3] = 4;
+    EXPECT_NO_THROW(MatMulBiasSparseOp(16, 8, SparsePattern::nm(2, 4), nm.values, nm.indices, {}, {}, bias));
+    EXPECT_THROW(MatMulBiasSparseOp(16, 8, SparsePattern::nm(2, 4), nm.values, bad_index, {}, {}, bias),
+                 std::invalid_argument);
+    EXPECT_THROW(MatMulBiasSparseOp(16, 8, SparsePattern::nm(2, 8), nm.values, nm.indices, {}, {}, bias),
+                 std::invalid_argument);
+    EXPECT_THROW(MatMulBiasSparseOp(12, 8, SparsePattern::nm(2, 8), nm.values, nm.indices, {}, {}, bias),
+                 std::invalid_argument);
+}
@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/graph/value.h"
+#include "inference_engine/kernels/reduce.h"
+#include "inference_engine/kernels/registry.h"
+#include "inference_engine/ops/normalization.h"
+#include "inference_engine/ops/softmax.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+// Rows of every length up to 70 cover the full-vector, unrolled and tail paths of
+// all ISAs (16 lanes x 4 accumulators = 64).
+constexpr std::size_t kMaxRow = 70;
+
+std::vector<float> wave(std::size_t n, float scale) {
+    std::vector<float> v(n);
+    for (std::size_t i = 0; i < n; ++i) v[i] = scale * std::sin(0.7f * static_cast<float>(i) + 0.3f);
+    return v;
+}
+
+// Double-precision references.
+std::vector<float> softmaxRef(const float* x, std::size_t n, bool log) {
+    double max_v = -std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < n; ++i) max_v = std::max(max_v, static_cast<double>(x[i]));
+    double sum = 0.0;
+    for (std::size_t i = 0; i < n; ++i) sum += std::exp(x[i] - max_v);
+    std::vector<float> y(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        y[i] = static_cast<float>(log ? x[i] - max_v - std::log(sum) : std::exp(x[i] - max_v) / sum);
+    }
+    return y;
+}
+
+std::vector<float> normRef(const float* x, std::size_t n, const float* gamma, const float* beta, float epsilon,
+                           bool rms) {
+    double mean = 0.0;
+    if (!rms) {
+        for (std::size_t i = 0; i < n; ++i) mean += x[i];
+        mean /= static_cast<double>(n);
+    }
+    double sq = 0.0;
+    for (std::size_t i = 0; i < n; ++i) sq += (x[i] - mean) * (x[i] - mean);
+    const double rstd = 1.0 / std::sqrt(sq / static_cast<double>(n) + epsilon);
+    std::vector<float> y(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        y[i] = static_cast<float>((x[i] - mean) * rstd * (gamma != nullptr ? gamma[i] : 1.0f) +
+                                  (beta != nullptr ? beta[i] : 0.0f));
+    }
+    return y;
+}
+
+template <typename Fn>
+std::vector<Fn*> kernels(const char* name) {
+    std::vector<Fn*> fns;
+    for (const KernelEntry* e : KernelRegistry::instance().candidates(name, DataType::FP32)) {
+        fns.push_back(reinterpret_cast<Fn*>(e->fn));
+    }
+    return fns;
+}
+
+} // namespace
+
+TEST(ReduceTest, ReductionKernelsMatchReference) {
+    for (const KernelEntry* e : KernelRegistry::instance().candidates("reduce_sum", DataType::FP32)) {
+        auto* fn = reinterpret_cast<ReduceFn*>(e->fn);
+        EXPECT_EQ(fn(nullptr, 0), 0.0f) << isa_to_string(e->isa);
+        for (std::size_t n = 1; n <= kMaxRow; ++n) {
+            const std::vector<float> x = wave(n, 3.0f);
+            double want = 0.0;
+            for (float v : x) want += v;
+            ASSERT_NEAR(fn(x.data(), n), want, 1e-5) << isa_to_string(e->isa) << " n=" << n;
+        }
+    }
+    for (const KernelEntry* e : KernelRegistry::instance().candidates("reduce_max", DataType::FP32)) {
+        auto* fn = reinterpret_cast<ReduceFn*>(e->fn);
+        EXPECT_EQ(fn(nullptr, 0), -std::numeric_limits<float>::infinity()) << isa_to_string(e->isa);
+        for (std::size_t n = 1; n <= kMaxRow; ++n) {
+            // All-negative rows: masked-out tail lanes must not contribute a 0.
+            std::vector<float> x = wave(n, 1.0f);
+            for (float& v : x) v -= 5.0f;
+            x[n - 1] = -1.5f;
+            ASSERT_EQ(fn(x.data(), n), *std::max_element(x.begin(), x.end())) << isa_to_string(e->isa) << " n=" << n;
+        }
+    }
+    for (const KernelEntry* e : KernelRegistry::instance().candidates("reduce_moments", DataType::FP32)) {
+        auto* fn = reinterpret_cast<MomentsFn*>(e->fn);
+        for (std::size_t n = 1; n <= kMaxRow; ++n) {
+            std::vector<float> x = wave(n, 2.0f);
+            for (float& v : x) v += 100.0f; // a large mean must not cost variance precision
+            double mean = 0.0, var = 0.0;
+            for (float v : x) mean += v;
+            mean /= static_cast<double>(n);
+            for (float v : x) var += (v - mean) * (v - mean);
+            var /= static_cast<double>(n);
+            float m = 0.0f, s = 0.0f;
+            fn(x.data(), n, &m, &s);
+            ASSERT_NEAR(m, mean, 1e-4) << isa_to_string(e->isa) << " n=" << n;
+            ASSERT_NEAR(s, var, 1e-3) << isa_to_string(e->isa) << " n=" << n;
+        }
+    }
+}
+
+TEST(ReduceTest, SoftmaxKernelsMatchReference) {
+    for (const char* name : {"softmax_row", "log_softmax_row"}) {
+        const bool log = name[0] == 'l';
+        for (SoftmaxRowFn* fn : kernels<SoftmaxRowFn>(name)) {
+            for (std::size_t n = 1; n <= kMaxRow; ++n) {
+                std::vector<float> x = wave(n, 20.0f);
+                x[0] = -200.0f; // exp underflows to exactly 0 after the max shift
+                const std::vector<float> want = softmaxRef(x.data(), n, log);
+                std::vector<float> y(n);
+                fn(x.data(), y.data(), n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    ASSERT_NEAR(y[i], want[i], log ? 2e-5f * std::max(1.0f, std::fabs(want[i])) : 1e-6f)
+                        << name << " n=" << n << " i=" << i;
+                }
+                // In place.
+                fn(x.data(), x.data(), n);
+                for (std::size_t i = 0; i < n; ++i) ASSERT_EQ(x[i], y[i]) << name << " in place";
+            }
+        }
+    }
+    // A constant row is uniform.
+    for (SoftmaxRowFn* fn : kernels<SoftmaxRowFn>("softmax_row")) {
+        const std::vector<float> x(19, 1e-3f);
+        std::vector<float> y(19);
+        fn(x.data(), y.data(), x.size());
+        for (float v : y) EXPECT_NEAR(v, 1.0f / 19.0f, 1e-7f);
+    }
+}
+
+TEST(ReduceTest, NormKernelsMatchReference) {
+    for (const char* name : {"layer_norm_row", "rms_norm_row"}) {
+        const bool rms = name[0] == 'r';
+        for (NormRowFn* fn : kernels<NormRowFn>(name)) {
+            for (std::size_t n = 1; n <= kMaxRow; ++n) {
+                const std::vector<float> x = wave(n, 4.0f);
+                const std::vector<float> gamma = wave(n, 1.5f);
+                const std::vector<float> beta = wave(n + 3, 0.5f);
+                for (const float* g : {static_cast<const float*>(nullptr), gamma.data()}) {
+                    for (const float* b : {static_cast<const float*>(nullptr), beta.data() + 3}) {
+                        const std::vector<float> want = normRef(x.data(), n, g, b, 1e-5f, rms);
+                        std::vector<float> y(n);
+                        fn(x.data(), y.data(), n, g, b, 1e-5f);
+                        for (std::size_t i = 0; i < n; ++i) {
+                            ASSERT_NEAR(y[i], want[i], 2e-5f) << name << " n=" << n << " i=" << i;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(ReduceTest, RowDriversHonourStridesAndUseThePool) {
+    ThreadPool pool(4);
+    ThreadPool::Scope scope(&pool);
+    // 512 rows of 333 elements, each padded to 340 in the source: the drivers read
+    // the padded rows in place and write dense ones.
+    const std::size_t rows = 512, n = 333, ld = 340;
+    std::vector<float> x(rows * ld, std::nanf(""));
+    for (std::size_t r = 0; r < rows; ++r) {
+        const std::vector<float> row = wave(n, 1.0f + 0.01f * static_cast<float>(r));
+        std::copy(row.begin(), row.end(), x.begin() + static_cast<std::ptrdiff_t>(r * ld));
+    }
+    const std::vector<float> gamma = wave(n, 0.9f);
+    std::vector<float> y(rows * n);
+
+    softmax_rows(x.data(), ld, y.data(), n, rows, n);
+    for (std::size_t r = 0; r < rows; r += 37) {
+        const std::vector<float> want = softmaxRef(x.data() + r * ld, n, false);
+        for (std::size_t i = 0; i < n; ++i) ASSERT_NEAR(y[r * n + i], want[i], 1e-6f) << r;
+    }
+    log_softmax_rows(x.data(), ld, y.data(), n, rows, n);
+    for (std::size_t r = 0; r < rows; r += 37) {
+        const std::vector<float> want = softmaxRef(x.data() + r * ld, n, true);
+        for (std::size_t i = 0; i < n; ++i) ASSERT_NEAR(y[r * n + i], want[i], 2e-5f) << r;
+    }
+    layer_norm_rows(x.data(), ld, y.data(), n, rows, n, gamma.data(), nullptr, 1e-5f);
+    for (std::size_t r = 0; r < rows; r += 37) {
+        const std::vector<float> want = normRef(x.data() + r * ld, n, gamma.data(), nullptr, 1e-5f, false);
+        for (std::size_t i = 0; i < n; ++i) ASSERT_NEAR(y[r * n + i], want[i], 2e-5f) << r;
+    }
+    rms_norm_rows(x.data(), ld, y.data(), n, rows, n, gamma.data(), nullptr, 1e-5f);
+    for (std::size_t r = 0; r < rows; r += 37) {
+        const std::vector<float> want = normRef(x.data() + r * ld, n, gamma.data(), nullptr, 1e-5f, true);
+        for (std::size_t i = 0; i < n; ++i) ASSERT_NEAR(y[r * n + i], want[i], 2e-5f) << r;
+    }
+    // The calling thread may drain every chunk before a worker wakes up; the helper
+    // tasks it enqueued still run (and count) shortly after.
+    for (int i = 0; i < 2000 && pool.stats().executed == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_GT(pool.stats().executed, 0u);
+}
+
+TEST(ReduceTest, OperatorsReadStridedRowsOverTheLastAxis) {
+    // A [2, 3, 5] window of a [2, 4, 9] tensor: rows are 9 apart along axis 1 but the
+    // batch axis breaks the even spacing, so the ops copy; a [3, 5] window is read
+    // in place.
+    std::vector<float> buf = wave(2 * 4 * 9, 6.0f);
+    const Tensor full(Shape({2, 4, 9}), DataType::FP32, buf.data(), false);
+    for (Tensor window : {full.slice({{0, 2}, {1, 4}, {2, 7}}), full.slice({{1, 2}, {1, 4}, {2, 7}})}) {
+        const Tensor dense = window.contiguous();
+        const std::size_t rows = static_cast<std::size_t>(dense.num_elements() / 5);
+        const std::vector<float> gamma = wave(5, 2.0f), beta = wave(5, -1.0f);
+
+        SoftmaxOp softmax;
+        LogSoftmaxOp log_softmax;
+        LayerNormOp layer_norm(gamma, beta, 1e-6f);
+        RmsNormOp rms_norm(gamma);
+        Operator* ops[] = {&softmax, &log_softmax, &layer_norm, &rms_norm};
+        for (Operator* op : ops) {
+            Value in(window.shape(), DataType::FP32, "x");
+            Value out(window.shape(), DataType::FP32, "y");
+            in.setTensor(&window);
+            op->setInputs({&in});
+            op->setOutputs({&out});
+            op->validate();
+            op->execute();
+            const float* y = out.tensor()->data_as<float>();
+            for (std::size_t r = 0; r < rows; ++r) {
+                const float* xr = dense.data_as<float>() + r * 5;
+                std::vector<float> want;
+                if (op == &softmax) want = softmaxRef(xr, 5, false);
+                if (op == &log_softmax) want = softmaxRef(xr, 5, true);
+                if (op == &layer_norm) want = normRef(xr, 5, gamma.data(), beta.data(), 1e-6f, false);
+                if (op == &rms_norm) want = normRef(xr, 5, gamma.data(), nullptr, 1e-5f, true);
+                for (std::size_t i = 0; i < 5; ++i) ASSERT_NEAR(y[r * 5 + i], want[i], 2e-5f) << op->type();
+            }
+        }
+    }
+
+    Value in(Shape({2, 4}), DataType::FP32, "x");
+    Value out(Shape({2, 4}), DataType::FP32, "y");
+    LayerNormOp bad(std::vector<float>(3, 1.0f), {});
+    bad.setInputs({&in});
+    bad.setOutputs({&out});
+    EXPECT_THROW(bad.validate(), std::invalid_argument);
+    EXPECT_THROW(RmsNormOp(std::vector<float>(4), std::vector<float>(3)), std::invalid_argument);
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/kernels/cpu_features.h"
+#include "inference_engine/kernels/linear.h"
+#include "inference_engine/kernels/registry.h"
+
+using inference_engine::core::DataType;
+using namespace infer;
+
+namespace {
+void fakeKernelA() {}
+void fakeKernelB() {}
+} // namespace
+
+TEST(KernelRegistryTest, ScalarLinearIsAlwaysRegistered) {
+    auto& r = KernelRegistry::instance();
+    const KernelEntry* scalar = r.select("linear", DataType::FP32, Isa::Scalar);
+    ASSERT_NE(scalar, nullptr);
+    EXPECT_EQ(scalar->isa, Isa::Scalar);
+}
+
+TEST(KernelRegistryTest, SelectsBestRunnableIsa) {
+    auto& r = KernelRegistry::instance();
+    const KernelEntry* best = r.select("linear", DataType::FP32);
+    ASSERT_NE(best, nullptr);
+    EXPECT_TRUE(isa_supported(best->isa));
+    EXPECT_LE(isa_rank(best->isa), isa_rank(max_isa()));
+    for (const KernelEntry* e : r.candidates("linear", DataType::FP32)) {
+        if (isa_rank(e->isa) <= isa_rank(max_isa())) {
+            EXPECT_LE(isa_rank(e->isa), isa_rank(best->isa)) << isa_to_string(e->isa);
+        }
+    }
+}
+
+TEST(KernelRegistryTest, DataTypeIsPartOfTheKey) {
+    auto& r = KernelRegistry::instance();
+    r.add("test_op", DataType::FP32, Isa::Scalar, &fakeKernelA);
+    r.add("test_op", DataType::INT8, Isa::Scalar, &fakeKernelB);
+    ASSERT_NE(r.select("test_op", DataType::FP32), nullptr);
+    ASSERT_NE(r.select("test_op", DataType::INT8), nullptr);
+    EXPECT_EQ(r.select("test_op", DataType::FP32)->fn, &fakeKernelA);
+    EXPECT_EQ(r.select("test_op", DataType::INT8)->fn, &fakeKernelB);
+    EXPECT_EQ(r.select("test_op", DataType::FP16), nullptr);
+    EXPECT_THROW((void)r.lookup<void()>("test_op", DataType::FP16), std::runtime_error);
+}
+
+TEST(KernelRegistryTest, UnsupportedIsaIsNeverSelected) {
+    auto& r = KernelRegistry::instance();
+    // Whatever the host, registering every ISA must still yield a runnable pick.
+    r.add("test_isa", DataType::FP32, Isa::Scalar, &fakeKernelA);
+    r.add("test_isa", DataType::FP32, Isa::AVX512, &fakeKernelB);
+    r.add("test_isa", DataType::FP32, Isa::NEON, &fakeKernelB);
+    const KernelEntry* e = r.select("test_isa", DataType::FP32);
+    ASSERT_NE(e, nullptr);
+    EXPECT_TRUE(isa_supported(e->isa));
+    EXPECT_EQ(r.select("test_isa", DataType::FP32, Isa::Scalar)->fn, &fakeKernelA);
+}
+
+TEST(CpuFeaturesTest, FeatureImplications) {
+    const CpuFeatures& f = cpu_features();
+    if (f.avx512bw || f.avx512vl || f.avx512dq) {
+        EXPECT_TRUE(f.avx512f);
+    }
+    EXPECT_TRUE(isa_supported(Isa::Scalar));
+    EXPECT_TRUE(isa_supported(max_isa()));
+    EXPECT_STREQ(isa_to_string(Isa::AVX2), "avx2");
+    EXPECT_STREQ(isa_to_string(Isa::AVX512_VNNI), "avx512_vnni");
+    if (isa_supported(Isa::AVX512_VNNI)) {
+        EXPECT_TRUE(isa_supported(Isa::AVX512));
+    }
+    if (isa_supported(Isa::NEON_DOTPROD)) {
+        EXPECT_TRUE(isa_supported(Isa::NEON));
+    }
+}
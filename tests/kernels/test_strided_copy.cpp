@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/kernels/registry.h"
+#include "inference_engine/kernels/strided_copy.h"
+#include "inference_engine/ops/transpose.h"
+#include "inference_engine/scheduler/thread_pool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+// Element-by-element reference: out[i...] = in[perm...], both dense.
+template <typename T>
+std::vector<T> referenceTranspose(const std::vector<T>& in, const std::vector<std::int64_t>& dims,
+                                  const std::vector<int>& perm) {
+    const std::size_t rank = dims.size();
+    std::vector<std::int64_t> in_strides(rank, 1);
+    for (std::size_t i = rank - 1; i-- > 0;) in_strides[i] = in_strides[i + 1] * dims[i + 1];
+    std::vector<std::int64_t> out_dims(rank);
+    for (std::size_t i = 0; i < rank; ++i) out_dims[i] = dims[static_cast<std::size_t>(perm[i])];
+
+    std::vector<T> out(in.size());
+    std::vector<std::int64_t> idx(rank, 0);
+    for (std::size_t flat = 0; flat < out.size(); ++flat) {
+        std::int64_t src = 0;
+        for (std::size_t i = 0; i < rank; ++i) src += idx[i] * in_strides[static_cast<std::size_t>(perm[i])];
+        out[flat] = in[static_cast<std::size_t>(src)];
+        for (std::size_t i = rank; i-- > 0;) {
+            if (++idx[i] < out_dims[i]) break;
+            idx[i] = 0;
+        }
+    }
+    return out;
+}
+
+template <typename T>
+std::vector<T> iota(std::size_t n) {
+    std::vector<T> v(n);
+    for (std::size_t i = 0; i < n; ++i) v[i] = static_cast<T>(i * 7 + 3);
+    return v;
+}
+
+template <typename T>
+void expectAllPermutations(DataType dtype, const std::vector<std::int64_t>& dims) {
+    const std::size_t n = static_cast<std::size_t>(Shape(dims).num_elements());
+    std::vector<T> in = iota<T>(n);
+    const Tensor src(Shape(dims), dtype, in.data(), false);
+    std::vector<int> perm(dims.size());
+    std::iota(perm.begin(), perm.end(), 0);
+    do {
+        const Tensor dense = src.transpose(perm).contiguous();
+        ASSERT_TRUE(dense.is_contiguous());
+        const std::vector<T> expected = referenceTranspose(in, dims, perm);
+        const T* got = dense.data_as<T>();
+        for (std::size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(got[i], expected[i]) << "element " << i;
+        }
+    } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+} // namespace
+
+TEST(StridedCopyTest, EveryPermutationMatchesReference) {
+    // Odd extents exercise the ragged edges of the transpose tiles.
+    expectAllPermutations<float>(DataType::FP32, {3, 5, 9, 11});
+    expectAllPermutations<std::uint16_t>(DataType::FP16, {2, 7, 10, 3});
+    expectAllPermutations<std::int8_t>(DataType::INT8, {4, 1, 17, 5});
+    expectAllPermutations<std::int64_t>(DataType::INT64, {6, 2, 5});
+}
+
+TEST(StridedCopyTest, TransposeKernelsMatchScalar) {
+    const std::size_t rows = 37, cols = 70, ld_src = 75, ld_dst = 41;
+    const std::vector<std::uint32_t> src = iota<std::uint32_t>(rows * ld_src);
+    const auto* scalar = KernelRegistry::instance().select("transpose2d", DataType::FP32, Isa::Scalar);
+    ASSERT_NE(scalar, nullptr);
+    std::vector<std::uint32_t> expected(cols * ld_dst, 0);
+    reinterpret_cast<Transpose2dFn*>(scalar->fn)(src.data(), ld_src, expected.data(), ld_dst, rows, cols);
+    EXPECT_EQ(expected[5 * ld_dst + 2], src[2 * ld_src + 5]);
+    for (const KernelEntry* e : KernelRegistry::instance().candidates("transpose2d", DataType::FP32)) {
+    	std::vector<std::uint32_t> got(cols * ld_dst, 0);
+    	reinterpret_cast<Transpose2dFn*>(e->fn)(src.data(), ld_src, got.data(), ld_dst, rows, cols);
+    	EXPECT_EQ(got, expected) << isa_to_string(e->isa);
+    }
+}
+
+TEST(StridedCopyTest, SliceViewsCopyIntoStridedDestinations) {
+    std::vector<float> in = iota<float>(6 * 8);
+    const Tensor src(Shape({6, 8}), DataType::FP32, in.data(), false);
+    const Tensor window = src.slice({{1, 5}, {2, 7}});
+
+    const Tensor dense = window.contiguous();
+    ASSERT_TRUE(dense.owns_data());
+    for (int r = 0; r < 4; ++r) {
+    	for (int c = 0; c < 5; ++c) {
+    		EXPECT_FLOAT_EQ(dense.data_as<float>()[r * 5 + c], in[(r + 1) * 8 + c + 2]);
+    	}
+    }
+
+    // Write the window back into another buffer's matching window.
+    std::vector<float> out(6 * 8, -1.0f);
+    Tensor target = Tensor(Shape({6, 8}), DataType::FP32, out.data(), false).slice({{1, 5}, {2, 7}});
+    window.copy_into(target);
+    EXPECT_FLOAT_EQ(out[1 * 8 + 2], in[1 * 8 + 2]);
+    EXPECT_FLOAT_EQ(out[4 * 8 + 6], in[4 * 8 + 6]);
+    EXPECT_FLOAT_EQ(out[0], -1.0f);
+    EXPECT_FLOAT_EQ(out[1 * 8 + 7], -1.0f);
+
+    Tensor wrong(Shape({5, 4}), DataType::FP32, out.data(), false);
+    EXPECT_THROW(window.copy_into(wrong), std::invalid_argument);
+    // Contiguous tensors are returned as-is.
+    EXPECT_EQ(src.contiguous().data(), src.data());
+}
+
+TEST(StridedCopyTest, LargeCopiesRunOnThePool) {
+    ThreadPool pool(4);
+    ThreadPool::Scope scope(&pool);
+    // NCHW -> NHWC of 4 MiB, and a contiguous 4 MiB block.
+    const std::vector<std::int64_t> dims = {2, 64, 64, 128};
+    std::vector<float> in = iota<float>(2 * 64 * 64 * 128);
+    const Tensor nchw(Shape(dims), DataType::FP32, in.data(), false);
+    const std::vector<int> to_nhwc = {0, 2, 3, 1};
+    const Tensor nhwc = nchw.transpose(to_nhwc).contiguous();
+    EXPECT_EQ(std::vector<float>(nhwc.data_as<float>(), nhwc.data_as<float>() + in.size()),
+              referenceTranspose(in, dims, to_nhwc));
+
+    std::vector<float> copy(in.size());
+    Tensor dst(Shape(dims), DataType::FP32, copy.data(), false);
+    nchw.copy_into(dst);
+    EXPECT_EQ(copy, in);
+    EXPECT_GT(pool.stats().executed, 0u);
+}
+
+TEST(StridedCopyTest, TransposeOpConvertsLayoutInGraph) {
+    Graph g;
+    Value* x = g.createValue(Shape({2, 3, 4, 5}), DataType::FP32, "nchw");
+    Value* y = g.createValue(Shape({2, 4, 5, 3}), DataType::FP32, "nhwc");
+    Node* n = g.addNode(std::make_unique<TransposeOp>(std::vector<int>{0, 2, 3, 1}));
+    n->setInputs({x});
+    n->setOutputs({y});
+    g.setInputs({x});
+    g.setOutputs({y});
+
+    std::vector<float> in = iota<float>(2 * 3 * 4 * 5);
+    const Tensor out = g.execute(Tensor(Shape({2, 3, 4, 5}), DataType::FP32, in.data(), false));
+    ASSERT_EQ(out.shape(), Shape({2, 4, 5, 3}));
+    EXPECT_EQ(std::vector<float>(out.data_as<float>(), out.data_as<float>() + in.size()),
+              referenceTranspose(in, {2, 3, 4, 5}, {0, 2, 3, 1}));
+
+    // An empty perm reverses the dimensions.
+    TransposeOp reverse;
+    reverse.setInputs({y});
+    Value* z = g.createValue(Shape({1}), DataType::FP32, "z");
+    reverse.setOutputs({z});
+    reverse.inferShapes();
+    EXPECT_EQ(z->shape(), Shape({3, 5, 4, 2}));
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "inference_engine/memory/allocator.h"
+#include "inference_engine/memory/pages.h"
 
 #include <cstring>
 #include <cstdint>
@@ -11,6 +12,7 @@
 using inference_engine::core::Allocator;
 using inference_engine::core::AllocatorConfig;
 using inference_engine::core::ArenaAllocator;
+using inference_engine::core::PageAllocator;
 using inference_engine::core::SystemAllocator;
 
 TEST(AllocatorTest, SystemAllocatorBasicAllocFreeTracking) {
@@ -123,3 +125,113 @@ TEST(AllocatorTest, SystemAllocatorIsThreadSafeWithTracking) {
 	EXPECT_EQ(s.live_bytes, 0u);
 }
 
+
+TEST(AllocatorTest, TrackingMergesShardsAcrossManyThreads) {
+	SystemAllocator alloc(AllocatorConfig{alignof(std::max_align_t), true});
+
+	constexpr int kThreads = 32;
+	constexpr int kIters = 200;
+	constexpr std::size_t kHeld = 4; // blocks each thread keeps live at the end
+	std::vector<std::vector<void*>> held(kThreads);
+	std::vector<std::thread> threads;
+	threads.reserve(kThreads);
+
+	for (int t = 0; t < kThreads; ++t) {
+		threads.emplace_back([&alloc, &held, t]() {
+			for (int i = 0; i < kIters; ++i) {
+				void* p = alloc.allocate(32);
+				ASSERT_NE(p, nullptr);
+				alloc.deallocate(p);
+			}
+			for (std::size_t i = 0; i < kHeld; ++i) {
+				held[t].push_back(alloc.allocate(100));
+			}
+		});
+	}
+	for (auto& th : threads) {
+		th.join();
+	}
+
+	auto s = alloc.stats();
+	EXPECT_EQ(s.allocations, static_cast<std::size_t>(kThreads) * (kIters + kHeld));
+	EXPECT_EQ(s.frees, static_cast<std::size_t>(kThreads) * kIters);
+	EXPECT_EQ(s.bytes_allocated, static_cast<std::size_t>(kThreads) * (kIters * 32 + kHeld * 100));
+	EXPECT_EQ(s.live_allocations, kThreads * kHeld);
+	EXPECT_EQ(s.live_bytes, kThreads * kHeld * 100);
+	EXPECT_GE(s.peak_live_bytes, s.live_bytes);
+
+	for (auto& blocks : held) {
+		for (void* p : blocks) {
+			EXPECT_TRUE(alloc.owns(p));
+			alloc.deallocate(p);
+		}
+	}
+	s = alloc.stats();
+	EXPECT_EQ(s.live_allocations, 0u);
+	EXPECT_EQ(s.live_bytes, 0u);
+	EXPECT_EQ(s.bytes_freed, s.bytes_allocated);
+}
+
+TEST(AllocatorTest, ResetStatsClearsCountersAndPeak) {
+	SystemAllocator alloc(AllocatorConfig{alignof(std::max_align_t), true});
+	void* p = alloc.allocate(256);
+	ASSERT_NE(p, nullptr);
+	alloc.deallocate(p);
+	EXPECT_EQ(alloc.stats().peak_live_bytes, 256u);
+
+	alloc.reset_stats();
+	const auto s = alloc.stats();
+	EXPECT_EQ(s.allocations, 0u);
+	EXPECT_EQ(s.frees, 0u);
+	EXPECT_EQ(s.peak_live_bytes, 0u);
+}
+
+TEST(AllocatorTest, PageAllocatorMapsPageAlignedRegions) {
+	AllocatorConfig config;
+	config.track_allocations = true;
+	config.pages.prefault = true;
+	config.pages.numa_node = inference_engine::memory::kLocalNumaNode;
+	PageAllocator alloc(config);
+	const std::size_t page = inference_engine::memory::page_size();
+	EXPECT_EQ(alloc.alignment(), page);
+
+	void* p = alloc.allocate(10000);
+	ASSERT_NE(p, nullptr);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % page, 0u);
+	std::memset(p, 0x5a, 10000);
+	EXPECT_TRUE(alloc.owns(p));
+
+	const auto region = alloc.region(p);
+	EXPECT_EQ(region.data, p);
+	EXPECT_GE(region.bytes, 10000u);
+	EXPECT_EQ(region.bytes % page, 0u);
+	// Binding is best effort: either the node of this thread or none.
+	EXPECT_TRUE(region.numa_node == inference_engine::memory::kAnyNumaNode || region.numa_node >= 0);
+
+	EXPECT_EQ(alloc.allocate_aligned(64, page * 2), nullptr);
+	EXPECT_EQ(alloc.stats().live_bytes, 10000u);
+
+	alloc.deallocate(p);
+	EXPECT_FALSE(alloc.owns(p));
+	EXPECT_EQ(alloc.region(p).data, nullptr);
+	EXPECT_EQ(alloc.stats().live_allocations, 0u);
+}
+
+TEST(AllocatorTest, PageAllocatorHugePagesFallBackWhenUnavailable) {
+	AllocatorConfig config;
+	config.pages.huge_pages = inference_engine::memory::HugePages::Explicit;
+	PageAllocator alloc(config);
+	EXPECT_EQ(alloc.alignment(), inference_engine::memory::huge_page_size());
+
+	// Without a reserved hugetlb pool the mapping falls back to transparent huge pages.
+	void* p = alloc.allocate(3 << 20);
+	ASSERT_NE(p, nullptr);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alloc.alignment(), 0u);
+	EXPECT_EQ(alloc.region(p).bytes % alloc.alignment(), 0u);
+	static_cast<std::uint8_t*>(p)[(3 << 20) - 1] = 1;
+
+	void* q = alloc.reallocate(p, 5 << 20);
+	ASSERT_NE(q, nullptr);
+	EXPECT_EQ(static_cast<std::uint8_t*>(q)[(3 << 20) - 1], 1);
+	alloc.deallocate(q);
+}
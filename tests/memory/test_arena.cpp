@@ -53,3 +53,127 @@ TEST(ArenaTest, ResetReusesAndResetsStats) {
 	void* c = arena.allocate(64, 32);
 	EXPECT_NE(c, nullptr);
 }
+
+TEST(ArenaTest, GrowableChainsChunksWhenFull) {
+	Arena arena = Arena::growable(64);
+	EXPECT_TRUE(arena.is_growable());
+
+	void* a = arena.allocate(48, 16);
+	void* b = arena.allocate(1000, 16); // does not fit the first chunk
+	ASSERT_NE(a, nullptr);
+	ASSERT_NE(b, nullptr);
+	EXPECT_EQ(arena.chunk_count(), 2u);
+	EXPECT_TRUE(arena.owns(a));
+	EXPECT_TRUE(arena.owns(b));
+	EXPECT_GE(arena.capacity(), 64u + 1000u);
+
+	void* c = arena.allocate(8192, 256);
+	ASSERT_NE(c, nullptr);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(c) % 256u, 0u);
+
+	const Arena::Stats stats = arena.stats();
+	EXPECT_EQ(stats.allocations, 3u);
+	EXPECT_EQ(stats.growths, arena.chunk_count() - 1);
+	ASSERT_EQ(stats.chunks.size(), arena.chunk_count());
+	EXPECT_EQ(stats.chunks[0].capacity_bytes, 64u);
+	EXPECT_EQ(stats.chunks[0].allocations, 1u);
+	std::size_t used = 0;
+	for (const Arena::ChunkStats& chunk : stats.chunks) used += chunk.used_bytes;
+	EXPECT_EQ(used, arena.used());
+	EXPECT_EQ(stats.peak_used_bytes, arena.used());
+}
+
+TEST(ArenaTest, ResetKeepsGrownChunksForReuse) {
+	Arena arena = Arena::growable(64);
+	ASSERT_NE(arena.allocate(48), nullptr);
+	ASSERT_NE(arena.allocate(4096), nullptr);
+	const std::size_t chunks = arena.chunk_count();
+	const std::size_t capacity = arena.capacity();
+
+	arena.reset();
+	EXPECT_EQ(arena.used(), 0u);
+	EXPECT_EQ(arena.remaining(), capacity);
+
+	// The same cycle again fits the retained chunks without growing.
+	ASSERT_NE(arena.allocate(48), nullptr);
+	ASSERT_NE(arena.allocate(4096), nullptr);
+	EXPECT_EQ(arena.chunk_count(), chunks);
+	EXPECT_EQ(arena.stats().growths, chunks - 1);
+}
+
+TEST(ArenaTest, GrowthRespectsTotalLimit) {
+	Arena::Options options;
+	options.initial_bytes = 64;
+	options.growable = true;
+	options.max_total_bytes = 8192;
+	Arena arena(options);
+
+	EXPECT_NE(arena.allocate(4096), nullptr);
+	EXPECT_EQ(arena.allocate(8192), nullptr);
+	EXPECT_LE(arena.capacity(), 8192u);
+}
+
+TEST(ArenaTest, ScratchScopesRewindInLifoOrder) {
+	Arena arena = Arena::growable(256);
+	void* base = arena.allocate(32, 16);
+	ASSERT_NE(base, nullptr);
+	const std::size_t used_outer = arena.used();
+
+	void* first = nullptr;
+	{
+		Arena::ScratchScope outer(arena);
+		first = arena.allocate(64, 16);
+		ASSERT_NE(first, nullptr);
+		const std::size_t used_inner = arena.used();
+		{
+			Arena::ScratchScope inner(arena);
+			// Spills into a new chunk; the inner scope releases it again.
+			ASSERT_NE(arena.allocate(4096, 64), nullptr);
+			EXPECT_GT(arena.chunk_count(), 1u);
+		}
+		EXPECT_EQ(arena.used(), used_inner);
+	}
+	EXPECT_EQ(arena.used(), used_outer);
+
+	// Released space is handed out again.
+	EXPECT_EQ(arena.allocate(64, 16), first);
+}
+
+TEST(ArenaTest, FixedArenaRewindsToMarker) {
+	Arena arena(256);
+	ASSERT_NE(arena.allocate(16), nullptr);
+	const Arena::Marker marker = arena.mark();
+	ASSERT_NE(arena.allocate(64), nullptr);
+	arena.rewind(marker);
+	EXPECT_EQ(arena.used(), 16u);
+	EXPECT_EQ(arena.chunk_count(), 1u);
+	EXPECT_FALSE(arena.is_growable());
+}
+
+TEST(ArenaTest, ThreadScratchArenaIsGrowable) {
+	Arena& scratch = inference_engine::memory::thread_scratch_arena();
+	EXPECT_TRUE(scratch.is_growable());
+	Arena::ScratchScope scope(scratch);
+	const std::size_t before = scratch.used();
+	EXPECT_NE(scratch.allocate(1 << 20, 64), nullptr);
+	EXPECT_GT(scratch.used(), before);
+}
+
+TEST(ArenaTest, PageBackedChunksArePrefaultedAndMapped) {
+	Arena::Options options;
+	options.initial_bytes = 64 << 10;
+	options.base_alignment = 64;
+	options.growable = true;
+	options.pages.prefault = true;
+	options.pages.numa_node = inference_engine::memory::kLocalNumaNode;
+	Arena arena(options);
+
+	ASSERT_NE(arena.allocate(48 << 10, 64), nullptr);
+	ASSERT_NE(arena.allocate(96 << 10, 64), nullptr);
+	const Arena::Stats stats = arena.stats();
+	ASSERT_EQ(stats.chunks.size(), 2u);
+	for (const auto& chunk : stats.chunks) {
+		EXPECT_TRUE(chunk.numa_node == inference_engine::memory::kAnyNumaNode || chunk.numa_node >= 0);
+		EXPECT_FALSE(chunk.huge_pages);
+	}
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/memory/pool_allocator.h"
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using inference_engine::core::AllocatorConfig;
+using inference_engine::core::PoolAllocator;
+using inference_engine::core::PoolConfig;
+
+TEST(PoolAllocatorTest, BlocksAreAlignedAndSizeClassed) {
+	PoolAllocator pool;
+	for (int64_t size : {1, 63, 64, 65, 1000, 1025, 5000, 100000}) {
+		void* p = pool.allocate(size);
+		ASSERT_NE(p, nullptr) << size;
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % PoolAllocator::kAlignment, 0u);
+		const std::size_t block = pool.block_size(static_cast<std::size_t>(size));
+		EXPECT_GE(block, static_cast<std::size_t>(size));
+		EXPECT_EQ(block % PoolAllocator::kAlignment, 0u);
+		std::memset(p, 0x5A, block);
+		EXPECT_TRUE(pool.owns(p));
+		pool.deallocate(p);
+	}
+	EXPECT_EQ(pool.block_size(1), 64u);
+	EXPECT_EQ(pool.block_size(1025), 1280u);
+	EXPECT_EQ(pool.allocate(0), nullptr);
+	EXPECT_EQ(pool.allocate(-8), nullptr);
+}
+
+TEST(PoolAllocatorTest, FreedBlocksAreReusedFromTheThreadCache) {
+	PoolAllocator pool;
+	void* a = pool.allocate(4096);
+	ASSERT_NE(a, nullptr);
+	pool.deallocate(a);
+	const auto fetches = pool.pool_stats().depot_fetches;
+
+	// Same size class again: served from this thread's list, LIFO.
+	void* b = pool.allocate(4000);
+	EXPECT_EQ(b, a);
+	pool.deallocate(b);
+	for (int i = 0; i < 100; ++i) {
+		void* p = pool.allocate(4096);
+		ASSERT_NE(p, nullptr);
+		pool.deallocate(p);
+	}
+	EXPECT_EQ(pool.pool_stats().depot_fetches, fetches);
+	EXPECT_EQ(pool.pool_stats().slabs, 1u);
+}
+
+TEST(PoolAllocatorTest, LargeAndOveralignedRequestsGoDirect) {
+	PoolConfig config;
+	config.max_pooled_bytes = 1 << 16;
+	PoolAllocator pool(config);
+
+	void* big = pool.allocate(1 << 20);
+	ASSERT_NE(big, nullptr);
+	void* aligned = pool.allocate_aligned(256, 4096);
+	ASSERT_NE(aligned, nullptr);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 4096u, 0u);
+	EXPECT_EQ(pool.pool_stats().direct_allocations, 2u);
+	EXPECT_TRUE(pool.owns(big));
+	EXPECT_TRUE(pool.owns(aligned));
+
+	pool.deallocate(big);
+	pool.deallocate(aligned);
+	EXPECT_FALSE(pool.owns(big));
+	EXPECT_EQ(pool.allocate_aligned(64, 3), nullptr);
+}
+
+TEST(PoolAllocatorTest, ReallocateKeepsBlockWithinClassAndCopiesOtherwise) {
+	PoolAllocator pool;
+	auto* p = static_cast<std::uint8_t*>(pool.allocate(100));
+	ASSERT_NE(p, nullptr);
+	for (int i = 0; i < 100; ++i) p[i] = static_cast<std::uint8_t>(i);
+
+	// 100 and 120 share the 128-byte class.
+	EXPECT_EQ(pool.reallocate(p, 120), p);
+
+	auto* q = static_cast<std::uint8_t*>(pool.reallocate(p, 10000));
+	ASSERT_NE(q, nullptr);
+	EXPECT_NE(q, p);
+	for (int i = 0; i < 100; ++i) EXPECT_EQ(q[i], static_cast<std::uint8_t>(i));
+	EXPECT_EQ(pool.reallocate(q, 0), nullptr);
+}
+
+TEST(PoolAllocatorTest, TracksLiveBlocksWhenEnabled) {
+	PoolAllocator pool(PoolConfig{}, AllocatorConfig{64, true});
+	EXPECT_TRUE(pool.tracking_enabled());
+
+	void* a = pool.allocate(300);
+	void* b = pool.allocate(5000);
+	auto s = pool.stats();
+	EXPECT_EQ(s.allocations, 2u);
+	EXPECT_EQ(s.live_bytes, 5300u);
+	EXPECT_TRUE(pool.owns(a));
+
+	pool.deallocate(a);
+	EXPECT_FALSE(pool.owns(a));
+	pool.deallocate(b);
+	s = pool.stats();
+	EXPECT_EQ(s.live_allocations, 0u);
+	EXPECT_EQ(s.peak_live_bytes, 5300u);
+}
+
+TEST(PoolAllocatorTest, BlocksMoveBetweenThreadsThroughTheDepot) {
+	PoolConfig config;
+	config.transfer_bytes = 4 * 256; // four 256-byte blocks per transfer
+	PoolAllocator pool(config, AllocatorConfig{64, true});
+
+	constexpr int kThreads = 8;
+	constexpr int kBlocks = 64;
+	std::vector<std::vector<void*>> produced(kThreads);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < kThreads; ++t) {
+		threads.emplace_back([&pool, &produced, t]() {
+			for (int i = 0; i < kBlocks; ++i) {
+				void* p = pool.allocate(256);
+				ASSERT_NE(p, nullptr);
+				std::memset(p, t, 256);
+				produced[t].push_back(p);
+			}
+		});
+	}
+	for (auto& th : threads) th.join();
+	threads.clear();
+
+	// Every block is freed by a different thread than the one that allocated it.
+	for (int t = 0; t < kThreads; ++t) {
+		threads.emplace_back([&pool, &produced, t]() {
+			for (void* p : produced[(t + 1) % kThreads]) pool.deallocate(p);
+		});
+	}
+	for (auto& th : threads) th.join();
+
+	const auto s = pool.stats();
+	EXPECT_EQ(s.allocations, static_cast<std::size_t>(kThreads * kBlocks));
+	EXPECT_EQ(s.live_allocations, 0u);
+	EXPECT_GT(pool.pool_stats().depot_returns, 0u);
+
+	// Blocks returned by exited threads are handed out again without new slabs.
+	const auto slabs = pool.pool_stats().slabs;
+	std::vector<void*> again;
+	for (int i = 0; i < kThreads * kBlocks; ++i) again.push_back(pool.allocate(256));
+	EXPECT_EQ(pool.pool_stats().slabs, slabs);
+	for (void* p : again) pool.deallocate(p);
+}
+
+TEST(PoolAllocatorTest, ThreadCachesOutliveTheirPool) {
+	std::thread worker;
+	{
+		PoolAllocator pool;
+		worker = std::thread([&pool]() {
+			void* p = pool.allocate(128);
+			pool.deallocate(p); // stays cached on this thread
+		});
+		worker.join();
+		void* p = pool.allocate(128);
+		pool.deallocate(p);
+	}
+	// A new pool on this thread does not pick up the destroyed pool's blocks.
+	PoolAllocator next;
+	void* q = next.allocate(128);
+	ASSERT_NE(q, nullptr);
+	EXPECT_TRUE(next.owns(q));
+	next.deallocate(q);
+}
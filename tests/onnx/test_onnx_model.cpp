@@ -0,0 +1,400 @@
+#include <gtest/gtest.h>
+
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/onnx/onnx_model.h"
+#include "inference_engine/onnx/onnx_node_op.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+// Just enough of a protobuf encoder to write ONNX test models.
+class Proto {
+public:
+	Proto& varint(std::uint32_t field, std::uint64_t v) {
+		key(field, 0);
+		putVarint(v);
+		return *this;
+	}
+	Proto& f32(std::uint32_t field, float v) {
+		key(field, 5);
+		buf_.append(reinterpret_cast<const char*>(&v), sizeof(v));
+		return *this;
+	}
+	Proto& bytes(std::uint32_t field, const std::string& s) {
+		key(field, 2);
+		putVarint(s.size());
+		buf_ += s;
+		return *this;
+	}
+	Proto& msg(std::uint32_t field, const Proto& m) { return bytes(field, m.buf_); }
+	template <typename T>
+	Proto& raw(std::uint32_t field, const std::vector<T>& v) {
+		return bytes(field, std::string(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T)));
+	}
+	Proto& packedVarints(std::uint32_t field, const std::vector<std::int64_t>& v) {
+		Proto p;
+		for (std::int64_t x : v) p.putVarint(static_cast<std::uint64_t>(x));
+		return bytes(field, p.buf_);
+	}
+	const std::string& str() const { return buf_; }
+
+private:
+	void key(std::uint32_t field, std::uint32_t wire) { putVarint((field << 3) | wire); }
+	void putVarint(std::uint64_t v) {
+		do {
+			std::uint8_t b = v & 0x7F;
+			v >>= 7;
+			if (v != 0) b |= 0x80;
+			buf_.push_back(static_cast<char>(b));
+		} while (v != 0);
+	}
+	std::string buf_;
+};
+
+constexpr std::uint64_t kFloat = 1;
+constexpr std::uint64_t kInt64 = 7;
+
+Proto valueInfo(const std::string& name, std::uint64_t elem, const std::vector<Proto>& dims) {
+	Proto shape;
+	for (const auto& d : dims) shape.msg(1, d);
+	Proto tensor;
+	tensor.varint(1, elem).msg(2, shape);
+	Proto type;
+	type.msg(1, tensor);
+	return Proto().bytes(1, name).msg(2, type);
+}
+
+Proto dim(std::int64_t v) { return Proto().varint(1, static_cast<std::uint64_t>(v)); }
+Proto dimParam(const std::string& p) { return Proto().bytes(2, p); }
+
+Proto tensorHeader(const std::string& name, std::uint64_t elem, const std::vector<std::int64_t>& dims) {
+	Proto t;
+	for (std::int64_t d : dims) t.varint(1, static_cast<std::uint64_t>(d));
+	return t.varint(2, elem).bytes(8, name);
+}
+
+Proto node(const std::string& op, const std::vector<std::string>& in, const std::vector<std::string>& out,
+		   const std::string& name, const std::vector<Proto>& attrs = {}) {
+	Proto n;
+	for (const auto& i : in) n.bytes(1, i);
+	for (const auto& o : out) n.bytes(2, o);
+	n.bytes(3, name).bytes(4, op);
+	for (const auto& a : attrs) n.msg(5, a);
+	return n;
+}
+
+Proto intAttr(const std::string& name, std::int64_t v) {
+	return Proto().bytes(1, name).varint(3, static_cast<std::uint64_t>(v)).varint(20, 2);
+}
+Proto floatAttr(const std::string& name, float v) { return Proto().bytes(1, name).f32(2, v).varint(20, 1); }
+
+struct TestFiles {
+	std::filesystem::path dir;
+	std::filesystem::path model;
+	std::filesystem::path external;
+
+	explicit TestFiles(const std::string& stem)
+		: dir(std::filesystem::temp_directory_path() / ("ie_test_onnx_" + stem)),
+		  model(dir / "model.onnx"),
+		  external(dir / "weights.bin") {
+		std::filesystem::create_directories(dir);
+	}
+	~TestFiles() {
+		std::error_code ec;
+		std::filesystem::remove_all(dir, ec);
+	}
+};
+
+// Reference parameters of the test MLP: y = softmax(relu(x * W1t^T * 0.5 + b1) * W2)
+const std::vector<float> kW1t = {0.5f, -1.0f, 0.25f, 2.0f,    // [3, 4] (Gemm transB = 1)
+								 1.0f, 0.5f,  -0.5f, 0.0f,
+								 -0.25f, 1.5f, 1.0f, -1.0f};
+const std::vector<float> kB1 = {0.1f, -0.2f, 0.3f};
+const std::vector<float> kW2 = {1.0f, -1.0f, 0.5f, 0.25f, -2.0f, 1.0f}; // [3, 2], external data
+
+// x[batch, 4] -> Gemm(transB, alpha 0.5) -> Relu -> MatMul -> Softmax -> y[batch, 2]
+void writeMlp(const TestFiles& files) {
+	{
+		std::ofstream ext(files.external, std::ios::binary);
+		ext.write(reinterpret_cast<const char*>(kW2.data()), static_cast<std::streamsize>(kW2.size() * 4));
+	}
+	Proto w1 = tensorHeader("W1", kFloat, {3, 4});
+	w1.raw(9, kW1t);
+	Proto b1 = tensorHeader("b1", kFloat, {3});
+	b1.raw(4, kB1); // packed float_data
+	Proto w2 = tensorHeader("W2", kFloat, {3, 2});
+	w2.msg(13, Proto().bytes(1, "location").bytes(2, "weights.bin"))
+		.msg(13, Proto().bytes(1, "offset").bytes(2, "0"))
+		.msg(13, Proto().bytes(1, "length").bytes(2, std::to_string(kW2.size() * 4)))
+		.varint(14, 1);
+
+	Proto graph;
+	graph.msg(1, node("Gemm", {"x", "W1", "b1"}, {"h"}, "fc1", {intAttr("transB", 1), floatAttr("alpha", 0.5f)}))
+		.msg(1, node("Relu", {"h"}, {"h_relu"}, "relu"))
+		.msg(1, node("MatMul", {"h_relu", "W2"}, {"logits"}, "fc2"))
+		.msg(1, node("Softmax", {"logits"}, {"y"}, "softmax", {intAttr("axis", 1)}))
+		.bytes(2, "mlp")
+		.msg(5, w1)
+		.msg(5, b1)
+		.msg(5, w2)
+		.msg(11, valueInfo("x", kFloat, {dimParam("batch"), dim(4)}))
+		.msg(11, valueInfo("W1", kFloat, {dim(3), dim(4)})) // old exporters list initializers as inputs
+		.msg(12, valueInfo("y", kFloat, {dimParam("batch"), dim(2)}));
+	Proto model;
+	model.varint(1, 8).bytes(2, "unit-test").bytes(3, "1.0").msg(7, graph).msg(8, Proto().varint(2, 13));
+
+	std::ofstream out(files.model, std::ios::binary);
+	out.write(model.str().data(), static_cast<std::streamsize>(model.str().size()));
+}
+
+std::vector<float> referenceMlp(const std::vector<float>& x, std::size_t batch) {
+	std::vector<float> y(batch * 2);
+	for (std::size_t b = 0; b < batch; ++b) {
+		float h[3];
+		for (int j = 0; j < 3; ++j) {
+			float acc = 0.0f;
+			for (int k = 0; k < 4; ++k) acc += x[b * 4 + k] * kW1t[j * 4 + k];
+			h[j] = std::max(0.0f, 0.5f * acc + kB1[j]);
+		}
+		float logits[2];
+		for (int j = 0; j < 2; ++j) logits[j] = h[0] * kW2[j] + h[1] * kW2[2 + j] + h[2] * kW2[4 + j];
+		const float m = std::max(logits[0], logits[1]);
+		const float e0 = std::exp(logits[0] - m), e1 = std::exp(logits[1] - m);
+		y[b * 2] = e0 / (e0 + e1);
+		y[b * 2 + 1] = e1 / (e0 + e1);
+	}
+	return y;
+}
+
+} // namespace
+
+TEST(OnnxModelTest, ParsesStructureAndInitializerMetadata) {
+	TestFiles files("structure");
+	writeMlp(files);
+	OnnxModel model(files.model.string());
+
+	EXPECT_EQ(model.irVersion(), 8);
+	EXPECT_EQ(model.producerName(), "unit-test");
+	EXPECT_EQ(model.graphName(), "mlp");
+	ASSERT_EQ(model.opsets().size(), 1u);
+	EXPECT_EQ(model.opsets()[0].version, 13);
+
+	ASSERT_EQ(model.inputs().size(), 1u); // W1 is an initializer, not an input
+	EXPECT_EQ(model.inputs()[0].name, "x");
+	EXPECT_EQ(model.inputs()[0].dims, (std::vector<std::int64_t>{-1, 4}));
+	EXPECT_EQ(model.inputs()[0].dim_params[0], "batch");
+
+	ASSERT_EQ(model.nodes().size(), 4u);
+	const OnnxNode& gemm = model.nodes()[0];
+	EXPECT_EQ(gemm.op_type, "Gemm");
+	EXPECT_EQ(gemm.attributes.get<AttributeMap::Int>("transB"), 1);
+	EXPECT_DOUBLE_EQ(gemm.attributes.get<AttributeMap::Float>("alpha"), 0.5);
+
+	ASSERT_EQ(model.initializers().size(), 3u);
+	const OnnxInitializer* w2 = model.findInitializer("W2");
+	ASSERT_NE(w2, nullptr);
+	EXPECT_EQ(w2->storage, OnnxInitializer::Storage::External);
+	EXPECT_EQ(w2->location, "weights.bin");
+	EXPECT_EQ(model.findInitializer("W1")->storage, OnnxInitializer::Storage::Raw);
+	EXPECT_EQ(model.findInitializer("b1")->storage, OnnxInitializer::Storage::Raw);
+	EXPECT_EQ(model.weightBytes(), (kW1t.size() + kB1.size() + kW2.size()) * sizeof(float));
+	EXPECT_EQ(model.loadedWeightBytes(), 0u);
+}
+
+TEST(OnnxModelTest, StructureOnlyImportPlansMemoryWithoutWeights) {
+	TestFiles files("inspect");
+	writeMlp(files);
+	std::filesystem::remove(files.external); // never needed without weights
+
+	OnnxModel model(files.model.string());
+	OnnxImportOptions options;
+	options.load_weights = false;
+	options.symbolic_dim_value = 8;
+	Graph g;
+	model.buildGraph(g, options);
+
+	ASSERT_EQ(g.nodes().size(), 4u);
+	const auto* gemm = dynamic_cast<const OnnxNodeOp*>(g.nodes()[0]->op());
+	ASSERT_NE(gemm, nullptr);
+	EXPECT_EQ(gemm->type(), "Gemm");
+	EXPECT_EQ(gemm->estimateMemoryBytes(), (kW1t.size() + kB1.size()) * sizeof(float));
+	ASSERT_NE(gemm->attributes(), nullptr);
+	EXPECT_EQ(gemm->attributes()->get<AttributeMap::Int>("transB"), 1);
+
+	// Shapes of unannotated intermediates are inferred from the ops.
+	for (const auto& v : g.values()) {
+		if (v->name() == "h" || v->name() == "h_relu") EXPECT_EQ(v->shape(), Shape({8, 3})) << v->name();
+		if (v->name() == "logits") EXPECT_EQ(v->shape(), Shape({8, 2}));
+	}
+	const MemoryPlan plan = g.planMemory();
+	EXPECT_GE(plan.peak_bytes, 8u * 3 * sizeof(float));
+	EXPECT_EQ(model.loadedWeightBytes(), 0u);
+
+	std::vector<float> in(8 * 4, 1.0f);
+	EXPECT_THROW(g.execute(Tensor(Shape({8, 4}), DataType::FP32, in.data(), false)), std::runtime_error);
+}
+
+TEST(OnnxModelTest, ExecutesImportedGraph) {
+	TestFiles files("execute");
+	writeMlp(files);
+	OnnxModel model(files.model.string());
+	OnnxImportOptions options;
+	options.symbolic_dim_value = 2;
+	Graph g;
+	model.buildGraph(g, options);
+	EXPECT_EQ(model.loadedWeightBytes(), model.weightBytes());
+
+	const std::vector<float> x = {1.0f, -2.0f, 0.5f, 3.0f, -1.0f, 0.0f, 2.0f, 1.5f};
+	const Tensor y = g.execute(Tensor(Shape({2, 4}), DataType::FP32, const_cast<float*>(x.data()), false));
+	ASSERT_EQ(y.shape(), Shape({2, 2}));
+	const std::vector<float> ref = referenceMlp(x, 2);
+	for (std::size_t i = 0; i < ref.size(); ++i) EXPECT_NEAR(y.data_as<float>()[i], ref[i], 1e-6f) << i;
+
+	// Mapped external data is used in place and loaded only once.
+	const Tensor w2 = model.initializerData(*model.findInitializer("W2"));
+	EXPECT_EQ(model.initializerData(*model.findInitializer("W2")).data(), w2.data());
+	EXPECT_EQ(std::memcmp(w2.data(), kW2.data(), kW2.size() * sizeof(float)), 0);
+}
+
+TEST(OnnxModelTest, ImportsBroadcastingElementwiseOps) {
+	TestFiles files("elementwise");
+	const std::vector<float> bias = {0.5f, -1.0f, 2.0f};
+	Proto scale = tensorHeader("scale", kFloat, {});
+	scale.f32(4, 2.0f);
+	Proto b = tensorHeader("bias", kFloat, {3});
+	b.raw(9, bias);
+	Proto graph;
+	graph.msg(1, node("Mul", {"x", "scale"}, {"scaled"}, "mul"))
+		.msg(1, node("Add", {"scaled", "bias"}, {"shifted"}, "add"))
+		.msg(1, node("Max", {"shifted", "x"}, {"y"}, "max"))
+		.msg(5, scale)
+		.msg(5, b)
+		.msg(11, valueInfo("x", kFloat, {dim(2), dim(3)}))
+		.msg(12, valueInfo("y", kFloat, {dim(2), dim(3)}));
+	Proto model;
+	model.varint(1, 8).msg(7, graph);
+	{
+		std::ofstream out(files.model, std::ios::binary);
+		out.write(model.str().data(), static_cast<std::streamsize>(model.str().size()));
+	}
+
+	OnnxModel m(files.model.string());
+	Graph g;
+	m.buildGraph(g);
+	EXPECT_EQ(g.initializerCount(), 2u); // scale and bias feed the operators as Values
+	const std::vector<float> x = {1.0f, -2.0f, 0.5f, -3.0f, 4.0f, 0.0f};
+	const Tensor y = g.execute(Tensor(Shape({2, 3}), DataType::FP32, const_cast<float*>(x.data()), false));
+	ASSERT_EQ(y.shape(), Shape({2, 3}));
+	for (std::size_t i = 0; i < x.size(); ++i) {
+		EXPECT_FLOAT_EQ(y.data_as<float>()[i], std::max(x[i] * 2.0f + bias[i % 3], x[i])) << i;
+	}
+}
+
+TEST(OnnxModelTest, ImportsNormalizationOverTheLastAxis) {
+	TestFiles files("layernorm");
+	const std::vector<float> gamma = {1.0f, 2.0f, 0.5f}, beta = {0.0f, -1.0f, 1.0f};
+	Proto g_init = tensorHeader("gamma", kFloat, {3});
+	g_init.raw(9, gamma);
+	Proto b_init = tensorHeader("beta", kFloat, {3});
+	b_init.raw(9, beta);
+	Proto graph;
+	graph.msg(1, node("LayerNormalization", {"x", "gamma", "beta"}, {"norm"}, "ln", {floatAttr("epsilon", 1e-3f)}))
+		.msg(1, node("LogSoftmax", {"norm"}, {"y"}, "log_softmax", {intAttr("axis", 2)}))
+		.msg(5, g_init)
+		.msg(5, b_init)
+		.msg(11, valueInfo("x", kFloat, {dim(2), dim(2), dim(3)}))
+		.msg(12, valueInfo("y", kFloat, {dim(2), dim(2), dim(3)}));
+	Proto model;
+	model.varint(1, 8).msg(7, graph);
+	{
+		std::ofstream out(files.model, std::ios::binary);
+		out.write(model.str().data(), static_cast<std::streamsize>(model.str().size()));
+	}
+
+	OnnxModel m(files.model.string());
+	Graph g;
+	m.buildGraph(g);
+	ASSERT_EQ(g.nodes().size(), 2u);
+	EXPECT_EQ(g.nodes()[0]->op()->type(), "LayerNorm");
+	const std::vector<float> x = {1.0f, 2.0f, 3.0f, -1.0f, 0.0f, 4.0f, 0.5f, 0.5f, 2.0f, 3.0f, -3.0f, 1.0f};
+	const Tensor y = g.execute(Tensor(Shape({2, 2, 3}), DataType::FP32, const_cast<float*>(x.data()), false));
+	ASSERT_EQ(y.shape(), Shape({2, 2, 3}));
+	for (std::size_t r = 0; r < 4; ++r) {
+		const float* xr = x.data() + r * 3;
+		const float mean = (xr[0] + xr[1] + xr[2]) / 3.0f;
+		float var = 0.0f;
+		for (int i = 0; i < 3; ++i) var += (xr[i] - mean) * (xr[i] - mean) / 3.0f;
+		float norm[3], sum = 0.0f;
+		for (int i = 0; i < 3; ++i) {
+			norm[i] = (xr[i] - mean) / std::sqrt(var + 1e-3f) * gamma[i] + beta[i];
+			sum += std::exp(norm[i]);
+		}
+		for (int i = 0; i < 3; ++i) EXPECT_NEAR(y.data_as<float>()[r * 3 + i], norm[i] - std::log(sum), 1e-5f) << r;
+	}
+}
+
+TEST(OnnxModelTest, DecodesTypedDataAndConstants) {
+	TestFiles files("typed");
+	Proto shape = tensorHeader("shape", kInt64, {3});
+	shape.packedVarints(7, {2, -1, 300});
+	Proto constant = tensorHeader("", kFloat, {2});
+	constant.f32(4, 1.5f).f32(4, -2.0f); // unpacked float_data
+	Proto graph;
+	graph.msg(1, node("Constant", {}, {"c"}, "const", {Proto().bytes(1, "value").msg(5, constant).varint(20, 4)}))
+		.msg(1, node("Identity", {"x"}, {"y"}, "id"))
+		.msg(5, shape)
+		.msg(11, valueInfo("x", kFloat, {dim(2)}))
+		.msg(12, valueInfo("y", kFloat, {dim(2)}));
+	Proto model;
+	model.varint(1, 8).msg(7, graph);
+	{
+		std::ofstream out(files.model, std::ios::binary);
+		out.write(model.str().data(), static_cast<std::streamsize>(model.str().size()));
+	}
+
+	OnnxModel m(files.model.string());
+	ASSERT_EQ(m.nodes().size(), 1u); // the Constant became an initializer
+	const Tensor s = m.initializerData(*m.findInitializer("shape"));
+	ASSERT_EQ(s.dtype(), DataType::INT64);
+	EXPECT_EQ(s.data_as<std::int64_t>()[0], 2);
+	EXPECT_EQ(s.data_as<std::int64_t>()[1], -1);
+	EXPECT_EQ(s.data_as<std::int64_t>()[2], 300);
+	const Tensor c = m.initializerData(*m.findInitializer("c"));
+	EXPECT_EQ(c.data_as<float>()[0], 1.5f);
+	EXPECT_EQ(c.data_as<float>()[1], -2.0f);
+
+	Graph g;
+	EXPECT_THROW(m.buildGraph(g), std::invalid_argument); // Identity has no executable op
+}
+
+TEST(OnnxModelTest, RejectsMalformedFiles) {
+	TestFiles files("malformed");
+	writeMlp(files);
+	std::string bytes;
+	{
+		std::ifstream in(files.model, std::ios::binary);
+		bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	}
+	{
+		std::ofstream out(files.model, std::ios::binary | std::ios::trunc);
+		out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() / 2));
+	}
+	EXPECT_THROW(OnnxModel(files.model.string()), std::runtime_error);
+	EXPECT_THROW(OnnxModel((files.dir / "missing.onnx").string()), std::runtime_error);
+}
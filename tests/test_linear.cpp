@@ -1,8 +1,79 @@
 #include <gtest/gtest.h>
 #include "kernels/linear_scalar.h"
+#include "inference_engine/kernels/linear.h"
+#include "inference_engine/kernels/registry.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
 
 using namespace infer;
 
+namespace {
+std::vector<float> randomVector(std::size_t n, std::mt19937& rng) {
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> v(n);
+    for (auto& x : v) x = dist(rng);
+    return v;
+}
+
+using LinearFn = void(const LinearArgs&);
+
+// Compares every "linear" kernel the host can run with the scalar reference on an
+// m x k x n product embedded in larger, padded matrices to exercise the leading
+// dimensions.
+void expectMatchesScalar(std::size_t m, std::size_t k, std::size_t n, bool with_bias, Activation act) {
+    std::mt19937 rng(static_cast<unsigned>(m * 131 + k * 17 + n));
+    const std::size_t ldx = k + 3;
+    const std::size_t ldw = n + 5;
+    const std::size_t ldy = n + 7;
+    const auto x = randomVector(std::max<std::size_t>(1, m * ldx), rng);
+    const auto w = randomVector(std::max<std::size_t>(1, k * ldw), rng);
+    const auto bias = randomVector(std::max<std::size_t>(1, n), rng);
+    std::vector<float> expected(std::max<std::size_t>(1, m * ldy), -42.0f);
+    std::vector<float> actual(expected);
+
+    LinearArgs args;
+    args.x = x.data();
+    args.ldx = ldx;
+    args.w = w.data();
+    args.ldw = ldw;
+    args.bias = with_bias ? bias.data() : nullptr;
+    args.ldy = ldy;
+    args.m = m;
+    args.k = k;
+    args.n = n;
+    args.activation = act;
+
+    args.y = expected.data();
+    linear_scalar(args);
+
+    const auto kernels = KernelRegistry::instance().candidates("linear", inference_engine::core::DataType::FP32);
+    ASSERT_FALSE(kernels.empty());
+    for (const KernelEntry* kernel : kernels) {
+        SCOPED_TRACE(isa_to_string(kernel->isa));
+        std::fill(actual.begin(), actual.end(), -42.0f);
+        args.y = actual.data();
+        reinterpret_cast<LinearFn*>(kernel->fn)(args);
+
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t j = 0; j < ldy; ++j) {
+                const float e = expected[i * ldy + j];
+                const float a = actual[i * ldy + j];
+                if (j >= n) {
+                    // Padding past n must be untouched.
+                    ASSERT_EQ(a, -42.0f) << "m=" << m << " k=" << k << " n=" << n;
+                } else {
+                    ASSERT_NEAR(a, e, 1e-4f * (1.0f + static_cast<float>(k)))
+                        << "m=" << m << " k=" << k << " n=" << n << " at (" << i << ", " << j << ")";
+                }
+            }
+        }
+    }
+}
+} // namespace
+
 TEST(LinearTest, ScalarLinearLayer) {
     int input_size = 4;
     int output_size = 2;
@@ -18,6 +89,151 @@ TEST(LinearTest, ScalarLinearLayer) {
     EXPECT_FLOAT_EQ(output[1], 5.0f);
 }
 
+TEST(LinearTest, ScalarWeightsAreInputMajor) {
+    // W = [[1, 2, 3], [4, 5, 6]] as [in=2, out=3].
+    const float input[] = {1.0f, -1.0f};
+    const float weights[] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+    const float bias[] = {0.5f, 0.0f, -0.5f};
+    float output[3];
+    linear_scalar(input, weights, bias, output, 2, 3);
+    EXPECT_FLOAT_EQ(output[0], -2.5f);
+    EXPECT_FLOAT_EQ(output[1], -3.0f);
+    EXPECT_FLOAT_EQ(output[2], -3.5f);
+}
+
+TEST(LinearTest, EpilogueAppliesReluAfterBias) {
+    const float input[] = {1.0f, 1.0f};
+    const float weights[] = {1.0f, -1.0f, 1.0f, -1.0f};
+    const float bias[] = {-3.0f, 3.0f};
+    float output[2];
+    LinearArgs args;
+    args.x = input;
+    args.ldx = 2;
+    args.w = weights;
+    args.ldw = 2;
+    args.bias = bias;
+    args.y = output;
+    args.ldy = 2;
+    args.m = 1;
+    args.k = 2;
+    args.n = 2;
+    args.activation = Activation::ReLU;
+    linear(args);
+    EXPECT_FLOAT_EQ(output[0], 0.0f);
+    EXPECT_FLOAT_EQ(output[1], 1.0f);
+}
+
+TEST(LinearTest, BlockedKernelMatchesScalarOnEdgeShapes) {
+    // Sizes straddling the 6x16 register block and the KC/MC/NC cache blocks.
+    const std::size_t ms[] = {1, 5, 6, 7, 13, 73, 150};
+    const std::size_t ks[] = {0, 1, 17, 256, 300};
+    const std::size_t ns[] = {1, 15, 16, 33, 1030};
+    for (std::size_t m : ms) {
+        for (std::size_t k : ks) {
+            for (std::size_t n : ns) {
+                if (m * k * n > 20'000'000) continue;
+                expectMatchesScalar(m, k, n, true, Activation::None);
+            }
+        }
+    }
+}
+
+TEST(LinearTest, BlockedKernelFusesBiasAndActivation) {
+    expectMatchesScalar(37, 513, 70, true, Activation::ReLU);
+    expectMatchesScalar(37, 513, 70, false, Activation::ReLU);
+    expectMatchesScalar(3, 64, 70, false, Activation::ReLU);
+}
+
+TEST(LinearTest, PackedKernelsMatchScalarOnEdgeShapes) {
+    using PackedFn = void(const LinearPackedArgs&);
+    using PanelFn = std::size_t();
+    const auto& registry = KernelRegistry::instance();
+    const auto kernels = registry.candidates("linear_packed", inference_engine::core::DataType::FP32);
+    ASSERT_FALSE(kernels.empty());
+    EXPECT_EQ(linear_packed_panel() % 4, 0u);
+
+    const std::size_t ms[] = {1, 3, 6, 17, 70};
+    const std::size_t ks[] = {0, 1, 37, 300};
+    const std::size_t ns[] = {1, 12, 16, 33, 100};
+    for (const KernelEntry* kernel : kernels) {
+        SCOPED_TRACE(isa_to_string(kernel->isa));
+        const KernelEntry* panel_entry =
+            registry.select("linear_packed_panel", inference_engine::core::DataType::FP32, kernel->isa);
+        ASSERT_NE(panel_entry, nullptr);
+        ASSERT_EQ(panel_entry->isa, kernel->isa);
+        const std::size_t panel = reinterpret_cast<PanelFn*>(panel_entry->fn)();
+        for (std::size_t m : ms) {
+            for (std::size_t k : ks) {
+                for (std::size_t n : ns) {
+                    std::mt19937 rng(static_cast<unsigned>(m * 7 + k * 13 + n));
+                    const auto x = randomVector(std::max<std::size_t>(1, m * k), rng);
+                    const auto w = randomVector(std::max<std::size_t>(1, k * n), rng);
+                    const auto bias = randomVector(n, rng);
+                    std::vector<float> packed(std::max<std::size_t>(1, packed_linear_size(k, n, panel)));
+                    pack_linear_weights(w.data(), n, k, n, panel, packed.data());
+
+                    std::vector<float> expected(m * n), actual(m * n, -42.0f);
+                    LinearArgs ref;
+                    ref.x = x.data();
+                    ref.ldx = k;
+                    ref.w = w.data();
+                    ref.ldw = n;
+                    ref.bias = bias.data();
+                    ref.y = expected.data();
+                    ref.ldy = n;
+                    ref.m = m;
+                    ref.k = k;
+                    ref.n = n;
+                    ref.activation = Activation::ReLU;
+                    linear_scalar(ref);
+
+                    LinearPackedArgs args;
+                    args.x = x.data();
+                    args.ldx = k;
+                    args.w = packed.data();
+                    args.panel = panel;
+                    args.bias = bias.data();
+                    args.y = actual.data();
+                    args.ldy = n;
+                    args.m = m;
+                    args.k = k;
+                    args.n = n;
+                    args.activation = Activation::ReLU;
+                    reinterpret_cast<PackedFn*>(kernel->fn)(args);
+                    for (std::size_t i = 0; i < m * n; ++i) {
+                        ASSERT_NEAR(actual[i], expected[i], 1e-4f * (1.0f + static_cast<float>(k)))
+                            << "m=" << m << " k=" << k << " n=" << n << " at " << i;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(LinearTest, PackedDispatcherRejectsForeignPanelWidth) {
+    const float x[2] = {1.0f, 2.0f};
+    const std::size_t panel = linear_packed_panel();
+    std::vector<float> packed(packed_linear_size(2, 1, panel), 0.0f);
+    packed[0] = 3.0f;     // w[0, 0]
+    packed[panel] = 4.0f; // w[1, 0]
+    float y = 0.0f;
+    LinearPackedArgs args;
+    args.x = x;
+    args.ldx = 2;
+    args.w = packed.data();
+    args.panel = panel;
+    args.y = &y;
+    args.ldy = 1;
+    args.m = 1;
+    args.k = 2;
+    args.n = 1;
+    linear_packed(args);
+    EXPECT_FLOAT_EQ(y, 11.0f);
+
+    args.panel = panel + 1;
+    EXPECT_THROW(linear_packed(args), std::invalid_argument);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -1,8 +1,14 @@
 #include <gtest/gtest.h>
 
 #include "inference_engine/core/dtype.h"
+#include "inference_engine/kernels/quantize.h"
+#include "inference_engine/kernels/registry.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <limits>
+#include <stdexcept>
 #include <vector>
 
 using namespace inference_engine::core;
@@ -68,3 +74,140 @@ TEST(QuantTest, QuantParamCalculations) {
 	EXPECT_TRUE(pc.symmetric);
 	EXPECT_EQ(pc.axis, 0);
 }
+
+namespace {
+// Inputs that stress rounding ties, saturation and non-finite values.
+std::vector<float> tricky_inputs(std::size_t n) {
+	const float specials[] = { 0.5f, -0.5f, 1.5f, -1.5f, 2.5f, -2.5f, 126.5f, -127.5f, -128.5f, 127.49f,
+	                           1e9f, -1e9f, 0.0f, -0.0f, std::numeric_limits<float>::infinity(),
+	                           -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(),
+	                           8388609.0f, -8388609.5f };
+	std::vector<float> v(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		v[i] = (i % 3 == 0) ? specials[i % (sizeof(specials) / sizeof(specials[0]))]
+		                    : static_cast<float>((static_cast<int>(i * 37) % 601) - 300) * 0.25f;
+	}
+	return v;
+}
+} // namespace
+
+TEST(QuantTest, BufferOpsMatchScalarHelpersExactly) {
+	for (std::size_t n : { std::size_t{0}, std::size_t{1}, std::size_t{15}, std::size_t{31}, std::size_t{32},
+	                       std::size_t{33}, std::size_t{100}, std::size_t{1027} }) {
+		const auto in = tricky_inputs(n);
+		std::vector<int8_t> qs(n);
+		std::vector<uint8_t> qa(n);
+		quantize_buffer_symmetric_int8(in.data(), qs.data(), n, 0.5f);
+		quantize_buffer_asymmetric_uint8(in.data(), qa.data(), n, 0.5f, 100);
+		for (std::size_t i = 0; i < n; ++i) {
+			ASSERT_EQ(qs[i], quantize_symmetric_int8(in[i], 0.5f)) << "n=" << n << " i=" << i << " x=" << in[i];
+			// The asymmetric buffer API rounds after adding the zero point.
+			const float scaled = std::round(in[i] * 2.0f + 100.0f);
+			const uint8_t expected = static_cast<uint8_t>(std::max(0.0f, std::min(scaled, 255.0f)));
+			ASSERT_EQ(qa[i], expected) << "n=" << n << " i=" << i << " x=" << in[i];
+		}
+
+		std::vector<float> ds(n);
+		std::vector<float> da(n);
+		dequantize_buffer_symmetric_int8(qs.data(), ds.data(), n, 0.25f);
+		dequantize_buffer_asymmetric_uint8(qa.data(), da.data(), n, 0.25f, 100);
+		for (std::size_t i = 0; i < n; ++i) {
+			ASSERT_EQ(ds[i], dequantize_symmetric_int8(qs[i], 0.25f));
+			ASSERT_EQ(da[i], dequantize_asymmetric_uint8(qa[i], 0.25f, 100));
+		}
+	}
+}
+
+TEST(QuantTest, BufferOpsRejectNonPositiveScaleOnce) {
+	std::vector<float> in(64, 1.0f);
+	std::vector<int8_t> q(64);
+	std::vector<uint8_t> u(64);
+	EXPECT_THROW(quantize_buffer_symmetric_int8(in.data(), q.data(), q.size(), 0.0f), std::invalid_argument);
+	EXPECT_THROW(quantize_buffer_asymmetric_uint8(in.data(), u.data(), u.size(), -1.0f, 0), std::invalid_argument);
+}
+
+TEST(QuantTest, PerChannelInnermostAxis) {
+	// [rows=3, channels=37]: channel axis is contiguous.
+	const std::vector<int64_t> dims = { 3, 37 };
+	QuantizationParams p;
+	p.axis = -1;
+	for (int c = 0; c < 37; ++c) p.per_channel_scales.push_back(0.1f * static_cast<float>(c + 1));
+	for (int c = 0; c < 37; ++c) p.per_channel_zero_points.push_back(c - 18);
+
+	const auto in = tricky_inputs(3 * 37);
+	std::vector<int8_t> q(in.size());
+	quantize_buffer_per_channel_int8(in.data(), q.data(), dims, p);
+	std::vector<float> back(in.size());
+	dequantize_buffer_per_channel_int8(q.data(), back.data(), dims, p);
+	for (std::size_t i = 0; i < in.size(); ++i) {
+		const std::size_t c = i % 37;
+		const float inv = 1.0f / p.per_channel_scales[c];
+		const float scaled = std::round(in[i] * inv + static_cast<float>(p.per_channel_zero_points[c]));
+		const int8_t expected = static_cast<int8_t>(std::max(-128.0f, std::min(scaled, 127.0f)));
+		ASSERT_EQ(q[i], expected) << "i=" << i;
+		ASSERT_EQ(back[i], static_cast<float>(q[i] - p.per_channel_zero_points[c]) * p.per_channel_scales[c]);
+	}
+}
+
+TEST(QuantTest, PerChannelOuterAxisUsesTensorZeroPoint) {
+	// [channels=2, 3, 40]: each channel is a contiguous run of 120 values.
+	const std::vector<int64_t> dims = { 2, 3, 40 };
+	QuantizationParams p;
+	p.axis = 0;
+	p.per_channel_scales = { 0.05f, 0.5f };
+	p.zero_point = 128;
+
+	const auto in = tricky_inputs(240);
+	std::vector<uint8_t> q(in.size());
+	quantize_buffer_per_channel_uint8(in.data(), q.data(), dims, p);
+	std::vector<float> back(in.size());
+	dequantize_buffer_per_channel_uint8(q.data(), back.data(), dims, p);
+	for (std::size_t i = 0; i < in.size(); ++i) {
+		const float scale = p.per_channel_scales[i / 120];
+		std::vector<uint8_t> one(1);
+		quantize_buffer_asymmetric_uint8(&in[i], one.data(), 1, scale, 128);
+		ASSERT_EQ(q[i], one[0]) << "i=" << i;
+		ASSERT_EQ(back[i], dequantize_asymmetric_uint8(q[i], scale, 128));
+	}
+}
+
+TEST(QuantTest, PerChannelValidatesParams) {
+	std::vector<float> in(6, 0.0f);
+	std::vector<int8_t> q(6);
+	QuantizationParams p;
+	EXPECT_THROW(quantize_buffer_per_channel_int8(in.data(), q.data(), { 2, 3 }, p), std::invalid_argument);
+	p.per_channel_scales = { 1.0f, 1.0f };
+	p.axis = 1;
+	EXPECT_THROW(quantize_buffer_per_channel_int8(in.data(), q.data(), { 2, 3 }, p), std::invalid_argument);
+	p.axis = 2;
+	EXPECT_THROW(quantize_buffer_per_channel_int8(in.data(), q.data(), { 2, 3 }, p), std::invalid_argument);
+	p.axis = 0;
+	p.per_channel_scales = { 1.0f, 0.0f };
+	EXPECT_THROW(quantize_buffer_per_channel_int8(in.data(), q.data(), { 2, 3 }, p), std::invalid_argument);
+	p.per_channel_scales = { 1.0f, 2.0f };
+	EXPECT_NO_THROW(quantize_buffer_per_channel_int8(in.data(), q.data(), { 2, 3 }, p));
+}
+
+TEST(QuantTest, EverySimdKernelMatchesScalar) {
+	using infer::KernelRegistry;
+	const auto& r = KernelRegistry::instance();
+	const auto in = tricky_inputs(1000);
+	const auto* ref_s8 = r.select("quantize", DataType::INT8, infer::Isa::Scalar);
+	const auto* ref_u8 = r.select("quantize", DataType::UINT8, infer::Isa::Scalar);
+	ASSERT_NE(ref_s8, nullptr);
+	ASSERT_NE(ref_u8, nullptr);
+	std::vector<int8_t> want_s8(in.size()), got_s8(in.size());
+	std::vector<uint8_t> want_u8(in.size()), got_u8(in.size());
+	reinterpret_cast<infer::QuantizeS8Fn*>(ref_s8->fn)(in.data(), want_s8.data(), in.size(), 3.0f, 0.0f);
+	reinterpret_cast<infer::QuantizeU8Fn*>(ref_u8->fn)(in.data(), want_u8.data(), in.size(), 3.0f, 7.0f);
+	for (const auto* k : r.candidates("quantize", DataType::INT8)) {
+		SCOPED_TRACE(infer::isa_to_string(k->isa));
+		reinterpret_cast<infer::QuantizeS8Fn*>(k->fn)(in.data(), got_s8.data(), in.size(), 3.0f, 0.0f);
+		EXPECT_EQ(got_s8, want_s8);
+	}
+	for (const auto* k : r.candidates("quantize", DataType::UINT8)) {
+		SCOPED_TRACE(infer::isa_to_string(k->isa));
+		reinterpret_cast<infer::QuantizeU8Fn*>(k->fn)(in.data(), got_u8.data(), in.size(), 3.0f, 7.0f);
+		EXPECT_EQ(got_u8, want_u8);
+	}
+}
@@ -1,8 +1,88 @@
 #include <gtest/gtest.h>
 #include "scheduler/thread_pool.h"
+#include "inference_engine/core/model.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/operator.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/scheduler/batcher.h"
+#include "inference_engine/scheduler/executor.h"
+#include "inference_engine/scheduler/pipeline.h"
+#include "inference_engine/scheduler/pipeline_executor.h"
+#include "inference_engine/scheduler/spsc_queue.h"
 #include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 using namespace infer;
+using inference_engine::core::DataType;
+using inference_engine::core::Shape;
+using inference_engine::core::Tensor;
+
+namespace {
+// Copies its single input to its output plus `delta`, recording which thread ran it.
+class AddConstOp final : public Operator {
+public:
+    explicit AddConstOp(float delta) : Operator("AddConst"), delta_(delta) {}
+    void execute() override {
+        const Tensor* in = inputs()[0]->tensor();
+        Tensor* out = outputs()[0]->tensor();
+        const float* x = in->data_as<float>();
+        float* y = out->data_as<float>();
+        for (std::int64_t i = 0; i < in->num_elements(); ++i) y[i] = x[i] + delta_;
+        if (fail) throw std::runtime_error("AddConst failed");
+    }
+    std::unique_ptr<Operator> clone() const override { return std::make_unique<AddConstOp>(*this); }
+    bool fail = false;
+
+private:
+    float delta_;
+};
+
+// Sums its two inputs.
+class AddOp final : public Operator {
+public:
+    AddOp() : Operator("Add") {}
+    void execute() override {
+        const float* a = inputs()[0]->tensor()->data_as<float>();
+        const float* b = inputs()[1]->tensor()->data_as<float>();
+        Tensor* out = outputs()[0]->tensor();
+        float* y = out->data_as<float>();
+        for (std::int64_t i = 0; i < out->num_elements(); ++i) y[i] = a[i] + b[i];
+    }
+    std::unique_ptr<Operator> clone() const override { return std::make_unique<AddOp>(*this); }
+};
+
+// x -> (x+1 -> +10) and (x+2 -> +20) -> add: two independent two-step branches.
+AddConstOp* buildDiamond(Graph& g) {
+    const Shape s({1, 256});
+    Value* x = g.createValue(s, DataType::FP32, "x");
+    Value* a1 = g.createValue(s, DataType::FP32, "a1");
+    Value* a2 = g.createValue(s, DataType::FP32, "a2");
+    Value* b1 = g.createValue(s, DataType::FP32, "b1");
+    Value* b2 = g.createValue(s, DataType::FP32, "b2");
+    Value* y = g.createValue(s, DataType::FP32, "y");
+    g.setInputs({x});
+    g.setOutputs({y});
+    auto link = [&g](std::unique_ptr<Operator> op, std::vector<Value*> in, std::vector<Value*> out,
+                     const char* name) {
+        Node* n = g.addNode(std::move(op), name);
+        n->setInputs(std::move(in));
+        n->setOutputs(std::move(out));
+    };
+    auto first = std::make_unique<AddConstOp>(1.0f);
+    AddConstOp* first_ptr = first.get();
+    link(std::move(first), {x}, {a1}, "a_first");
+    link(std::make_unique<AddConstOp>(10.0f), {a1}, {a2}, "a_second");
+    link(std::make_unique<AddConstOp>(2.0f), {x}, {b1}, "b_first");
+    link(std::make_unique<AddConstOp>(20.0f), {b1}, {b2}, "b_second");
+    link(std::make_unique<AddOp>(), {a2, b2}, {y}, "join");
+    return first_ptr;
+}
+} // namespace
 
 TEST(SchedulerTest, ThreadPoolExecution) {
     ThreadPool pool(2);
@@ -18,6 +98,653 @@ TEST(SchedulerTest, ThreadPoolExecution) {
     EXPECT_EQ(counter.load(), 10);
 }
 
+TEST(SchedulerTest, NumaPoolBindsWorkersAndArenas) {
+    ThreadPool pool(2, 0);
+    EXPECT_EQ(pool.numaNode(), 0);
+    EXPECT_EQ(pool.pageOptions().numa_node, 0);
+    std::atomic<int> counter(0);
+    for (int i = 0; i < 8; ++i) {
+        pool.enqueue([&counter]() { counter++; });
+    }
+    pool.wait();
+    EXPECT_EQ(counter.load(), 8);
+
+    ThreadPool unbound(1);
+    EXPECT_EQ(unbound.numaNode(), inference_engine::memory::kAnyNumaNode);
+}
+
+TEST(SchedulerTest, NestedTasksAreWaitedFor) {
+    ThreadPool pool(3);
+    std::atomic<int> counter(0);
+    for (int i = 0; i < 8; ++i) {
+        pool.enqueue([&pool, &counter]() {
+            for (int j = 0; j < 8; ++j) {
+                pool.enqueue([&counter]() { counter++; });
+            }
+        });
+    }
+    pool.wait();
+    EXPECT_EQ(counter.load(), 64);
+    EXPECT_EQ(pool.stats().executed, 72u);
+}
+
+TEST(SchedulerTest, WaitRethrowsTaskException) {
+    ThreadPool pool(2);
+    pool.enqueue([]() { throw std::runtime_error("boom"); });
+    EXPECT_THROW(pool.wait(), std::runtime_error);
+    // The error is consumed; the pool stays usable.
+    std::atomic<int> counter(0);
+    pool.enqueue([&counter]() { counter++; });
+    EXPECT_NO_THROW(pool.wait());
+    EXPECT_EQ(counter.load(), 1);
+}
+
+TEST(SchedulerTest, ParallelForCoversRangeExactlyOnce) {
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallelFor(0, hits.size(), 7, [&](std::size_t b, std::size_t e) {
+        for (std::size_t i = b; i < e; ++i) hits[i]++;
+    });
+    for (const auto& h : hits) EXPECT_EQ(h.load(), 1);
+}
+
+TEST(SchedulerTest, ParallelForNestsInsideTasks) {
+    ThreadPool pool(2);
+    std::atomic<int> total(0);
+    for (int t = 0; t < 4; ++t) {
+        pool.enqueue([&total]() {
+            // Free parallelFor resolves to the worker's pool.
+            parallelFor(0, 100, 10, [&total](std::size_t b, std::size_t e) {
+                total += static_cast<int>(e - b);
+            });
+        });
+    }
+    pool.wait();
+    EXPECT_EQ(total.load(), 400);
+}
+
+TEST(SchedulerTest, ScopeInstallsCurrentPool) {
+    ThreadPool pool(1);
+    ThreadPool::Scope scope(&pool);
+    EXPECT_EQ(ThreadPool::current(), &pool);
+    std::atomic<int> total(0);
+    parallelFor(0, 64, 1, [&total](std::size_t b, std::size_t e) { total += static_cast<int>(e - b); });
+    EXPECT_EQ(total.load(), 64);
+}
+
+TEST(SchedulerTest, CompileRecordsStepDependencies) {
+    Graph g;
+    buildDiamond(g);
+    auto plan = g.compile();
+    ASSERT_EQ(plan->steps().size(), 5u);
+    std::size_t roots = 0;
+    for (const auto& step : plan->steps()) {
+        if (step.num_predecessors == 0) ++roots;
+        if (step.node->name() == "join") {
+            EXPECT_EQ(step.num_predecessors, 2u);
+            EXPECT_TRUE(step.successors.empty());
+        }
+    }
+    EXPECT_EQ(roots, 2u);
+}
+
+TEST(SchedulerTest, ParallelPlanKeepsConcurrentBranchesApart) {
+    Graph seq_graph;
+    buildDiamond(seq_graph);
+    const auto seq = seq_graph.planMemory();
+
+    Graph par_graph;
+    buildDiamond(par_graph);
+    MemoryPlanOptions options;
+    options.concurrent = true;
+    const auto par = par_graph.planMemory(options);
+    EXPECT_TRUE(par.concurrent);
+    EXPECT_GE(par.arena_bytes, seq.arena_bytes);
+
+    // a-branch and b-branch values may be live simultaneously under a parallel schedule.
+    auto lifetimeOf = [&](const char* name) {
+        for (const auto& v : par_graph.values()) {
+            if (v->name() == name) return par.lifetimes.at(v->id());
+        }
+        throw std::logic_error("missing value");
+    };
+    const auto a1 = lifetimeOf("a1");
+    const auto b1 = lifetimeOf("b1");
+    const auto a2 = lifetimeOf("a2");
+    const auto b2 = lifetimeOf("b2");
+    EXPECT_NE(a1.offset, b1.offset);
+    EXPECT_NE(a2.offset, b2.offset);
+    EXPECT_NE(a1.offset, b2.offset);
+    EXPECT_NE(b1.offset, a2.offset);
+}
+
+TEST(SchedulerTest, ParallelExecutorMatchesSequentialRun) {
+    Graph g;
+    buildDiamond(g);
+    CompileOptions options;
+    options.parallel = true;
+    auto plan = g.compile(options);
+
+    ThreadPool pool(4);
+    ParallelExecutor executor(*plan, pool);
+
+    std::vector<float> xs(256);
+    for (std::size_t i = 0; i < xs.size(); ++i) xs[i] = static_cast<float>(i);
+    Tensor x(Shape({1, 256}), DataType::FP32, xs.data(), false);
+    for (int iter = 0; iter < 20; ++iter) {
+        std::vector<Tensor> outputs;
+        executor.run({x}, outputs);
+        ASSERT_EQ(outputs.size(), 1u);
+        const float* y = outputs[0].data_as<float>();
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            ASSERT_FLOAT_EQ(y[i], 2.0f * xs[i] + 33.0f);
+        }
+    }
+    for (const auto& step : plan->steps()) {
+        EXPECT_TRUE(step.node->isExecuted());
+    }
+}
+
+TEST(SchedulerTest, ParallelExecutorsShareOnePlanThroughContexts) {
+    Graph g;
+    buildDiamond(g);
+    CompileOptions options;
+    options.parallel = true;
+    options.bind_memory = false;
+    auto plan = g.compile(options);
+
+    ThreadPool pool(4);
+    constexpr int kRequests = 3;
+    std::vector<std::thread> clients;
+    std::atomic<int> mismatches(0);
+    for (int r = 0; r < kRequests; ++r) {
+        clients.emplace_back([&, r] {
+            ParallelExecutor executor(*plan, pool);
+            auto ctx = plan->createContext();
+            std::vector<float> xs(256);
+            for (std::size_t i = 0; i < xs.size(); ++i) xs[i] = static_cast<float>(i) + 1000.0f * static_cast<float>(r);
+            const std::vector<Tensor> inputs = {Tensor(Shape({1, 256}), DataType::FP32, xs.data(), false)};
+            std::vector<Tensor> outputs;
+            for (int iter = 0; iter < 20; ++iter) {
+                executor.run(*ctx, inputs, outputs);
+                const float* y = outputs[0].data_as<float>();
+                for (std::size_t i = 0; i < xs.size(); ++i) {
+                    if (y[i] != 2.0f * xs[i] + 33.0f) ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& c : clients) c.join();
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+TEST(SchedulerTest, ParallelExecutorRequiresParallelPlan) {
+    Graph g;
+    buildDiamond(g);
+    auto plan = g.compile();
+    ThreadPool pool(2);
+    EXPECT_THROW(ParallelExecutor(*plan, pool), std::invalid_argument);
+}
+
+TEST(SchedulerTest, ParallelExecutorPropagatesOperatorError) {
+    Graph g;
+    AddConstOp* first = buildDiamond(g);
+    CompileOptions options;
+    options.parallel = true;
+    auto plan = g.compile(options);
+    ThreadPool pool(2);
+    ParallelExecutor executor(*plan, pool);
+
+    std::vector<float> xs(256, 0.0f);
+    Tensor x(Shape({1, 256}), DataType::FP32, xs.data(), false);
+    std::vector<Tensor> outputs;
+    first->fail = true;
+    EXPECT_THROW(executor.run({x}, outputs), std::runtime_error);
+    first->fail = false;
+    EXPECT_NO_THROW(executor.run({x}, outputs));
+}
+
+namespace {
+constexpr std::int64_t kBatch = 8;
+constexpr std::int64_t kInDim = 4;
+constexpr std::int64_t kOutDim = 3;
+
+float weightAt(std::int64_t i) {
+    return static_cast<float>(i % 5) - 2.0f;
+}
+
+// y[kBatch, kOutDim] = x[kBatch, kInDim] * W + b
+void buildLinear(Graph& g) {
+    Value* x = g.createValue(Shape({kBatch, kInDim}), DataType::FP32, "x");
+    Value* y = g.createValue(Shape({kBatch, kOutDim}), DataType::FP32, "y");
+    std::vector<float> w(static_cast<std::size_t>(kInDim * kOutDim));
+    for (std::size_t i = 0; i < w.size(); ++i) w[i] = weightAt(static_cast<std::int64_t>(i));
+    Node* n = g.addNode(std::make_unique<MatMulBiasOp>(kInDim, kOutDim, w, std::vector<float>(kOutDim, 0.5f)));
+    n->setInputs({x});
+    n->setOutputs({y});
+    g.setInputs({x});
+    g.setOutputs({y});
+}
+
+std::vector<float> sampleFor(int request) {
+    std::vector<float> row(kInDim);
+    for (std::int64_t k = 0; k < kInDim; ++k) row[k] = static_cast<float>(request) + 0.25f * static_cast<float>(k);
+    return row;
+}
+
+void expectRowMatches(const Tensor& y, const std::vector<float>& x) {
+    ASSERT_EQ(y.shape(), Shape({1, kOutDim}));
+    for (std::int64_t j = 0; j < kOutDim; ++j) {
+        float expected = 0.5f;
+        for (std::int64_t k = 0; k < kInDim; ++k) expected += x[k] * weightAt(k * kOutDim + j);
+        EXPECT_FLOAT_EQ(y.data_as<float>()[j], expected);
+    }
+}
+} // namespace
+
+TEST(SchedulerTest, BatcherMergesRequestsIntoFullBatches) {
+    Model model;
+    buildLinear(model.graph());
+    BatcherOptions options;
+    options.max_wait = std::chrono::seconds(10); // only full batches are dispatched early
+    DynamicBatcher batcher(model, options);
+    EXPECT_EQ(batcher.maxBatchSize(), static_cast<std::size_t>(kBatch));
+
+    constexpr int kRequests = 2 * kBatch;
+    std::vector<std::vector<float>> samples;
+    std::vector<std::future<Tensor>> results;
+    for (int r = 0; r < kRequests; ++r) {
+        samples.push_back(sampleFor(r));
+        // Alternate the two accepted sample shapes.
+        const Shape shape = (r % 2 == 0) ? Shape({1, kInDim}) : Shape({kInDim});
+        results.push_back(batcher.submit(Tensor(shape, DataType::FP32, samples.back().data(), false)));
+    }
+    for (int r = 0; r < kRequests; ++r) {
+        const Tensor y = results[r].get();
+        EXPECT_TRUE(y.owns_data());
+        expectRowMatches(y, samples[r]);
+    }
+    const DynamicBatcher::Stats stats = batcher.stats();
+    EXPECT_EQ(stats.requests, static_cast<std::uint64_t>(kRequests));
+    EXPECT_EQ(stats.batches, 2u);
+    EXPECT_EQ(stats.padded_rows, 0u);
+}
+
+TEST(SchedulerTest, BatcherFlushesPartialBatchAfterMaxWait) {
+    Model model;
+    buildLinear(model.graph());
+    BatcherOptions options;
+    options.max_wait = std::chrono::milliseconds(2);
+    DynamicBatcher batcher(model, options);
+
+    const std::vector<float> x = sampleFor(3);
+    const Tensor y = batcher.submit(Tensor(Shape({1, kInDim}), DataType::FP32, const_cast<float*>(x.data()), false)).get();
+    expectRowMatches(y, x);
+    EXPECT_EQ(batcher.stats().batches, 1u);
+    EXPECT_EQ(batcher.stats().padded_rows, static_cast<std::uint64_t>(kBatch - 1));
+}
+
+TEST(SchedulerTest, BatcherServesConcurrentClients) {
+    Model model;
+    buildLinear(model.graph());
+    BatcherOptions options;
+    options.max_batch_size = 4;
+    options.max_wait = std::chrono::microseconds(200);
+    DynamicBatcher batcher(model, options);
+
+    std::vector<std::thread> clients;
+    std::atomic<int> failures(0);
+    for (int c = 0; c < 4; ++c) {
+        clients.emplace_back([&, c] {
+            for (int i = 0; i < 25; ++i) {
+                std::vector<float> x = sampleFor(c * 100 + i);
+                const Tensor y = batcher.submit(Tensor(Shape({kInDim}), DataType::FP32, x.data(), false)).get();
+                float expected = 0.5f;
+                for (std::int64_t k = 0; k < kInDim; ++k) expected += x[k] * weightAt(k * kOutDim);
+                if (y.data_as<float>()[0] != expected) ++failures;
+            }
+        });
+    }
+    for (auto& t : clients) t.join();
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_EQ(batcher.stats().requests, 100u);
+    EXPECT_LE(batcher.stats().batches, 100u);
+}
+
+TEST(SchedulerTest, BatcherRejectsInvalidUse) {
+    Model model;
+    buildLinear(model.graph());
+    BatcherOptions too_big;
+    too_big.max_batch_size = kBatch + 1;
+    EXPECT_THROW(DynamicBatcher(model, too_big), std::invalid_argument);
+
+    DynamicBatcher batcher(model);
+    std::vector<float> wrong(kInDim + 1, 1.0f);
+    EXPECT_THROW(batcher.submit(Tensor(Shape({1, kInDim + 1}), DataType::FP32, wrong.data(), false)),
+                 std::invalid_argument);
+    EXPECT_THROW(batcher.submit(Tensor(Shape({2, kInDim}), DataType::FP32, wrong.data(), false)),
+                 std::invalid_argument);
+
+    batcher.shutdown();
+    EXPECT_THROW(batcher.submit(Tensor(Shape({kInDim}), DataType::FP32, wrong.data(), false)), std::runtime_error);
+}
+
+namespace {
+std::vector<float> batchFor(int request) {
+    std::vector<float> x;
+    for (std::int64_t r = 0; r < kBatch; ++r) {
+        const std::vector<float> row = sampleFor(request * 10 + static_cast<int>(r));
+        x.insert(x.end(), row.begin(), row.end());
+    }
+    return x;
+}
+
+void expectBatchMatches(const Tensor& y, const std::vector<float>& x, float scale = 1.0f) {
+    ASSERT_EQ(y.shape(), Shape({kBatch, kOutDim}));
+    for (std::int64_t r = 0; r < kBatch; ++r) {
+        for (std::int64_t j = 0; j < kOutDim; ++j) {
+            float expected = 0.5f;
+            for (std::int64_t k = 0; k < kInDim; ++k) {
+                expected += scale * x[r * kInDim + k] * weightAt(k * kOutDim + j);
+            }
+            EXPECT_FLOAT_EQ(y.data_as<float>()[r * kOutDim + j], expected);
+        }
+    }
+}
+} // namespace
+
+TEST(SchedulerTest, InferAsyncDeliversThroughFutureAndCallback) {
+    Model model;
+    buildLinear(model.graph());
+    ThreadPool pool(2);
+
+    std::vector<std::vector<float>> inputs;
+    for (int r = 0; r < 6; ++r) inputs.push_back(batchFor(r));
+    std::vector<std::future<Tensor>> futures;
+    for (auto& x : inputs) {
+        futures.push_back(model.inferAsync(pool, Tensor(Shape({kBatch, kInDim}), DataType::FP32, x.data(), false)));
+    }
+    for (std::size_t r = 0; r < inputs.size(); ++r) {
+        const Tensor y = futures[r].get();
+        EXPECT_TRUE(y.owns_data());
+        expectBatchMatches(y, inputs[r]);
+    }
+
+    std::promise<void> called;
+    std::exception_ptr seen;
+    std::vector<float> wrong(3, 0.0f);
+    model.inferAsync(pool, Tensor(Shape({1, 3}), DataType::FP32, wrong.data(), false),
+                     [&](Tensor, std::exception_ptr error) {
+                         seen = error;
+                         called.set_value();
+                     });
+    called.get_future().wait();
+    ASSERT_TRUE(seen);
+    EXPECT_THROW(std::rethrow_exception(seen), std::invalid_argument);
+}
+
+TEST(SchedulerTest, PipelineRunsStagesForMoreRequestsThanDepth) {
+    Model model;
+    buildLinear(model.graph());
+    ThreadPool pool(3);
+
+    std::atomic<int> posting(0);
+    std::atomic<int> max_posting(0);
+    // Preprocess scales the request by 2; postprocess copies the output.
+    auto pre = [](const Tensor& request, Tensor& input) {
+        for (std::int64_t i = 0; i < input.num_elements(); ++i) {
+            input.data_as<float>()[i] = 2.0f * request.data_as<float>()[i];
+        }
+    };
+    auto post = [&](const Tensor& output) {
+        const int now = ++posting;
+        int seen = max_posting.load();
+        while (now > seen && !max_posting.compare_exchange_weak(seen, now)) {
+        }
+        Tensor copy = output.clone();
+        --posting;
+        return copy;
+    };
+    PipelineOptions options;
+    options.depth = 2;
+    InferencePipeline pipeline(model, pool, options, pre, post);
+
+    constexpr int kRequests = 12;
+    std::vector<std::vector<float>> inputs;
+    for (int r = 0; r < kRequests; ++r) inputs.push_back(batchFor(r));
+    std::vector<std::future<Tensor>> futures;
+    for (auto& x : inputs) {
+        futures.push_back(pipeline.submit(Tensor(Shape({kBatch, kInDim}), DataType::FP32, x.data(), false)));
+    }
+    std::atomic<int> callbacks(0);
+    pipeline.submit(Tensor(Shape({kBatch, kInDim}), DataType::FP32, inputs[0].data(), false),
+                    [&](Tensor y, std::exception_ptr error) {
+                        EXPECT_FALSE(error);
+                        EXPECT_EQ(y.shape(), Shape({kBatch, kOutDim}));
+                        ++callbacks;
+                    });
+    for (int r = 0; r < kRequests; ++r) expectBatchMatches(futures[r].get(), inputs[r], 2.0f);
+    pipeline.drain();
+    EXPECT_EQ(callbacks.load(), 1);
+    EXPECT_EQ(pipeline.inFlight(), 0u);
+    EXPECT_LE(max_posting.load(), 2); // postprocessing is bounded by the slots
+}
+
+TEST(SchedulerTest, PipelineReportsStageErrors) {
+    Model model;
+    buildLinear(model.graph());
+    ThreadPool pool(2);
+    InferencePipeline pipeline(model, pool);
+
+    std::vector<float> wrong(kInDim, 1.0f);
+    auto bad = pipeline.submit(Tensor(Shape({1, kInDim}), DataType::FP32, wrong.data(), false));
+    EXPECT_THROW(bad.get(), std::invalid_argument);
+
+    // The pipeline keeps serving after a failed request.
+    std::vector<float> x = batchFor(1);
+    expectBatchMatches(pipeline.submit(Tensor(Shape({kBatch, kInDim}), DataType::FP32, x.data(), false)).get(), x);
+
+    PipelineOptions zero;
+    zero.depth = 0;
+    EXPECT_THROW(InferencePipeline(model, pool, zero), std::invalid_argument);
+}
+
+TEST(SchedulerTest, SpscQueueHandsValuesOverInOrder) {
+    SpscQueue<int> queue(5);
+    EXPECT_EQ(queue.capacity(), 8u);
+    constexpr int kCount = 20000;
+    std::thread producer([&queue]() {
+        for (int i = 0; i < kCount; ++i) {
+            while (!queue.tryPush(i)) std::this_thread::yield();
+        }
+    });
+    int expected = 0;
+    while (expected < kCount) {
+        int v = -1;
+        if (!queue.tryPop(v)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(v, expected);
+        ++expected;
+    }
+    producer.join();
+    EXPECT_TRUE(queue.empty());
+
+    SpscQueue<int> full(2);
+    EXPECT_TRUE(full.tryPush(1));
+    EXPECT_TRUE(full.tryPush(2));
+    EXPECT_FALSE(full.tryPush(3));
+}
+
+namespace {
+// Identity step with a fixed cost estimate.
+class CostOp final : public Operator {
+public:
+    explicit CostOp(std::uint64_t flops) : Operator("Cost"), flops_(flops) {}
+    void execute() override {
+        const Tensor* in = inputs()[0]->tensor();
+        Tensor* out = outputs()[0]->tensor();
+        std::copy(in->data_as<float>(), in->data_as<float>() + in->num_elements(), out->data_as<float>());
+    }
+    std::uint64_t estimateFlops() const noexcept override { return flops_; }
+    std::unique_ptr<Operator> clone() const override { return std::make_unique<CostOp>(*this); }
+
+private:
+    std::uint64_t flops_;
+};
+
+constexpr std::int64_t kWidth = 16;
+
+// x -> `layers` square MatMulBias layers with ReLU -> y, on a [kBatch, kWidth] input.
+void buildDeepChain(Graph& g, int layers, AddConstOp** failing = nullptr) {
+    Value* cur = g.createValue(Shape({kBatch, kWidth}), DataType::FP32, "x");
+    g.setInputs({cur});
+    for (int l = 0; l < layers; ++l) {
+        std::vector<float> w(static_cast<std::size_t>(kWidth * kWidth));
+        for (std::size_t i = 0; i < w.size(); ++i) w[i] = 0.05f * weightAt(static_cast<std::int64_t>(i) + l);
+        Value* next = g.createValue(Shape({kBatch, kWidth}), DataType::FP32, "h" + std::to_string(l));
+        Node* n = g.addNode(std::make_unique<MatMulBiasOp>(kWidth, kWidth, w, std::vector<float>(kWidth, 0.1f),
+                                                           Activation::ReLU));
+        n->setInputs({cur});
+        n->setOutputs({next});
+        cur = next;
+    }
+    if (failing != nullptr) {
+        auto op = std::make_unique<AddConstOp>(1.0f);
+        *failing = op.get();
+        Value* next = g.createValue(Shape({kBatch, kWidth}), DataType::FP32, "tail");
+        Node* n = g.addNode(std::move(op), "tail");
+        n->setInputs({cur});
+        n->setOutputs({next});
+        cur = next;
+    }
+    g.setOutputs({cur});
+}
+
+std::vector<float> chainInput(int request) {
+    std::vector<float> x(static_cast<std::size_t>(kBatch * kWidth));
+    for (std::size_t i = 0; i < x.size(); ++i) x[i] = 0.01f * static_cast<float>((request * 7 + i) % 23) - 0.1f;
+    return x;
+}
+} // namespace
+
+TEST(SchedulerTest, PartitionBalancesStepCosts) {
+    Graph g;
+    const Shape s({1, 4});
+    Value* cur = g.createValue(s, DataType::FP32, "x");
+    g.setInputs({cur});
+    for (std::uint64_t flops : {10u, 10u, 10u, 30u, 5u, 5u, 5u, 5u, 10u}) {
+        Value* next = g.createValue(s, DataType::FP32);
+        Node* n = g.addNode(std::make_unique<CostOp>(flops));
+        n->setInputs({cur});
+        n->setOutputs({next});
+        cur = next;
+    }
+    g.setOutputs({cur});
+    auto plan = g.compile();
+
+    const std::vector<PipelineStage> three = partitionStages(*plan, 3);
+    ASSERT_EQ(three.size(), 3u);
+    std::uint64_t largest = 0;
+    for (std::size_t i = 0; i < three.size(); ++i) {
+        EXPECT_LT(three[i].begin, three[i].end);
+        EXPECT_EQ(three[i].begin, i == 0 ? 0u : three[i - 1].end);
+        largest = std::max(largest, three[i].cost);
+    }
+    EXPECT_EQ(three.back().end, plan->steps().size());
+    EXPECT_EQ(largest, 30u); // {10,10,10} {30} {5,5,5,5,10}
+
+    // More stages than steps: one step each.
+    const std::vector<PipelineStage> all = partitionStages(*plan, 20);
+    ASSERT_EQ(all.size(), plan->steps().size());
+    for (std::size_t i = 0; i < all.size(); ++i) EXPECT_EQ(all[i].end - all[i].begin, 1u);
+    // Forced splits still give every stage a step when the bound alone would not.
+    const std::vector<PipelineStage> eight = partitionStages(*plan, 8);
+    ASSERT_EQ(eight.size(), 8u);
+    for (const auto& stage : eight) EXPECT_LT(stage.begin, stage.end);
+}
+
+TEST(SchedulerTest, PipelineExecutorMatchesSequentialRun) {
+    Graph g;
+    buildDeepChain(g, 6);
+    auto plan = g.compile();
+
+    std::vector<std::vector<float>> inputs;
+    for (int r = 0; r < 24; ++r) inputs.push_back(chainInput(r));
+    std::vector<std::vector<float>> expected;
+    {
+        auto ctx = plan->createContext();
+        std::vector<Tensor> outputs;
+        for (auto& x : inputs) {
+            plan->run(*ctx, {Tensor(Shape({kBatch, kWidth}), DataType::FP32, x.data(), false)}, outputs);
+            const float* y = outputs[0].data_as<float>();
+            expected.emplace_back(y, y + outputs[0].num_elements());
+        }
+    }
+
+    for (std::size_t cores : {1u, 2u}) {
+        PipelineExecutorOptions options;
+        options.stages = 3;
+        options.cores_per_stage = cores;
+        options.micro_batches = 4;
+        PipelineExecutor pipeline(*plan, options);
+        ASSERT_EQ(pipeline.stages().size(), 3u);
+        EXPECT_EQ(pipeline.microBatches(), 4u);
+        EXPECT_EQ(pipeline.stages().back().end, plan->steps().size());
+
+        std::vector<std::future<std::vector<Tensor>>> futures;
+        for (auto& x : inputs) {
+            futures.push_back(pipeline.submit({Tensor(Shape({kBatch, kWidth}), DataType::FP32, x.data(), false)}));
+        }
+        for (std::size_t r = 0; r < inputs.size(); ++r) {
+            const std::vector<Tensor> y = futures[r].get();
+            ASSERT_EQ(y.size(), 1u);
+            EXPECT_TRUE(y[0].owns_data());
+            for (std::size_t i = 0; i < expected[r].size(); ++i) {
+                EXPECT_FLOAT_EQ(y[0].data_as<float>()[i], expected[r][i]) << "request " << r;
+            }
+        }
+        pipeline.drain();
+    }
+}
+
+TEST(SchedulerTest, PipelineExecutorReportsStepErrors) {
+    Graph g;
+    AddConstOp* tail = nullptr;
+    buildDeepChain(g, 3, &tail);
+    auto plan = g.compile();
+    PipelineExecutorOptions options;
+    options.stages = 2;
+    options.pin = false;
+    PipelineExecutor pipeline(*plan, options);
+
+    std::vector<float> x = chainInput(0);
+    const Tensor in(Shape({kBatch, kWidth}), DataType::FP32, x.data(), false);
+    tail->fail = true;
+    auto bad = pipeline.submit({in});
+    EXPECT_THROW(bad.get(), std::runtime_error);
+    tail->fail = false;
+
+    // Mismatched inputs are rejected before queuing, and the pipeline keeps serving.
+    std::vector<float> wrong(3, 0.0f);
+    EXPECT_THROW(pipeline.submit({Tensor(Shape({1, 3}), DataType::FP32, wrong.data(), false)}), std::invalid_argument);
+    std::atomic<int> delivered(0);
+    for (int r = 0; r < 8; ++r) {
+        pipeline.submit({in}, [&delivered](std::vector<Tensor> y, std::exception_ptr error) {
+            EXPECT_FALSE(error);
+            EXPECT_EQ(y.size(), 1u);
+            ++delivered;
+        });
+    }
+    pipeline.drain();
+    EXPECT_EQ(delivered.load(), 8);
+
+    PipelineExecutorOptions zero;
+    zero.cores_per_stage = 0;
+    EXPECT_THROW(PipelineExecutor(*plan, zero), std::invalid_argument);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
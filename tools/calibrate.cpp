@@ -0,0 +1,176 @@
+// Calibrates the activation quantization of a model file and writes the model back
+// in the same (mmap) format, with the ranges attached to its Values. The output is
+// not an activation-quantized model: its layers stay FP32 (the format cannot store
+// QuantizedLinear), and nothing quantizes activations at load time; the ranges are
+// for a runtime or pass that does.
+//
+//   calibrate model.iem out.iem --data samples.bin [--data more.bin ...]
+//             [--method minmax|entropy|percentile] [--percentile P] [--bins N]
+//             [--per-channel AXIS] [--uint8] [--asymmetric] [--threads N]
+//             [--weight-bits 4|8 [--group N]]
+//
+// Every data file holds raw little-endian FP32 samples back to back; one sample is
+// the graph inputs in order, each in its compiled shape. --weight-bits is the only
+// quantization it applies: weight-only, replacing each MatMulBias layer whose input
+// size is a multiple of the group size (default 32) with its block-quantized
+// MatMulBiasBlockQ form, which still computes in FP32.
+
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "inference_engine/core/model.h"
+#include "inference_engine/core/tensor.h"
+#include "inference_engine/graph/calibration.h"
+#include "inference_engine/graph/graph.h"
+#include "inference_engine/graph/node.h"
+#include "inference_engine/graph/value.h"
+#include "inference_engine/ops/matmul_bias.h"
+#include "inference_engine/ops/matmul_bias_blockq.h"
+
+using inference_engine::core::DataType;
+using inference_engine::core::Tensor;
+using namespace infer;
+
+namespace {
+
+struct Dataset {
+    std::vector<std::vector<float>> files;
+    std::vector<std::vector<Tensor>> samples; // views into `files`
+};
+
+// Reads the data files and splits them into samples of the graph's input shapes.
+Dataset readSamples(const Graph& g, const std::vector<std::string>& paths) {
+    std::size_t sample_floats = 0;
+    for (const Value* v : g.inputs()) {
+        if (v->dtype() != DataType::FP32) {
+            throw std::runtime_error("input '" + v->name() + "' is not FP32");
+        }
+        sample_floats += static_cast<std::size_t>(v->shape().num_elements());
+    }
+    Dataset data;
+    data.files.reserve(paths.size());
+    for (const std::string& path : paths) {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) throw std::runtime_error("cannot open " + path);
+        const auto bytes = static_cast<std::size_t>(in.tellg());
+        if (sample_floats == 0 || bytes == 0 || bytes % (sample_floats * sizeof(float)) != 0) {
+            throw std::runtime_error(path + " does not hold a whole number of samples");
+        }
+        std::vector<float>& floats = data.files.emplace_back(bytes / sizeof(float));
+        in.seekg(0);
+        in.read(reinterpret_cast<char*>(floats.data()), static_cast<std::streamsize>(bytes));
+        if (!in) throw std::runtime_error("cannot read " + path);
+        for (float* p = floats.data(); p != floats.data() + floats.size();) {
+            std::vector<Tensor> sample;
+            for (const Value* v : g.inputs()) {
+                sample.emplace_back(v->shape(), DataType::FP32, p, false);
+                p += v->shape().num_elements();
+            }
+            data.samples.push_back(std::move(sample));
+        }
+    }
+    return data;
+}
+
+std::size_t quantizeWeights(Graph& g, int bits, std::int64_t group) {
+    std::size_t replaced = 0;
+    for (const auto& node : g.nodes()) {
+        const auto* fc = dynamic_cast<const MatMulBiasOp*>(node->op());
+        if (fc == nullptr || fc->inDim() % group != 0) continue;
+        const std::vector<float> bias(fc->bias().begin(), fc->bias().end());
+        node->setOperator(MatMulBiasBlockQOp::fromFloat(fc->inDim(), fc->outDim(), fc->rowMajorWeights(), bias, bits,
+                                                        group, fc->activation()));
+        ++replaced;
+    }
+    return replaced;
+}
+
+int usage(const char* argv0) {
+    std::cerr << "usage: " << argv0 << " model.iem out.iem --data FILE [--data FILE ...]\n"
+              << "       [--method minmax|entropy|percentile] [--percentile P] [--bins N]\n"
+              << "       [--per-channel AXIS] [--uint8] [--asymmetric] [--threads N]\n"
+              << "       [--weight-bits 4|8 [--group N]]\n"
+              << "Writes an FP32 model annotated with the calibrated activation ranges (not an\n"
+              << "activation-quantized model); --weight-bits adds weight-only block quantization.\n";
+    return 2;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) return usage(argv[0]);
+    CalibrationOptions options;
+    std::vector<std::string> data;
+    int weight_bits = 0;
+    std::int64_t group = 32;
+    try {
+        for (int i = 3; i < argc; ++i) {
+            const std::string arg = argv[i];
+            const bool has_value = i + 1 < argc;
+            if (arg == "--data" && has_value) {
+                data.emplace_back(argv[++i]);
+            } else if (arg == "--method" && has_value) {
+                options.method = parseCalibrationMethod(argv[++i]);
+            } else if (arg == "--percentile" && has_value) {
+                options.percentile = std::atof(argv[++i]);
+            } else if (arg == "--bins" && has_value) {
+                options.bins = static_cast<std::size_t>(std::atoll(argv[++i]));
+            } else if (arg == "--per-channel" && has_value) {
+                options.per_channel = true;
+                options.axis = std::atoi(argv[++i]);
+            } else if (arg == "--uint8") {
+                options.dtype = DataType::UINT8;
+            } else if (arg == "--asymmetric") {
+                options.symmetric = false;
+                options.dtype = DataType::UINT8;
+            } else if (arg == "--threads" && has_value) {
+                options.threads = static_cast<std::size_t>(std::atoll(argv[++i]));
+            } else if (arg == "--weight-bits" && has_value) {
+                weight_bits = std::atoi(argv[++i]);
+            } else if (arg == "--group" && has_value) {
+                group = std::atoll(argv[++i]);
+            } else {
+                std::cerr << "unknown argument: " << arg << '\n';
+                return usage(argv[0]);
+            }
+        }
+        if (data.empty()) return usage(argv[0]);
+        if (std::strcmp(argv[1], argv[2]) == 0) {
+            std::cerr << "the output must not overwrite the mapped input model\n";
+            return 2;
+        }
+        if ((weight_bits != 0 && weight_bits != 4 && weight_bits != 8) || group <= 0) {
+            std::cerr << "--weight-bits must be 4 or 8 and --group positive\n";
+            return 2;
+        }
+
+        Model model;
+        model.load(argv[1]);
+        Graph& g = model.graph();
+        const Dataset dataset = readSamples(g, data);
+        const CalibrationReport report = calibrate(g, dataset.samples, options);
+        std::cout << "Calibrated " << report.values.size() << " values over " << report.samples << " samples\n";
+        for (const auto& e : report.values) {
+            std::cout << "  " << e.value->name() << "  [" << e.min.front() << ", " << e.max.front() << "]";
+            if (e.min.size() > 1) std::cout << "  (" << e.min.size() << " channels)";
+            std::cout << '\n';
+        }
+        if (weight_bits != 0) {
+            const std::size_t n = quantizeWeights(g, weight_bits, group);
+            std::cout << "Quantized " << n << " dense layers to INT" << weight_bits << ", group " << group << '\n';
+        }
+        model.save(argv[2]);
+        std::cout << "Wrote " << argv[2] << " (FP32 activations, calibrated ranges attached)\n";
+    } catch (const std::exception& e) {
+        std::cerr << "error: " << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}